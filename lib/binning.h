@@ -3,7 +3,7 @@
 
 #include <stddef.h>
 
-static const size_t binning_shader_size = 32678;
+static const size_t binning_shader_size = 43651;
 static const char binning_shader[] =
     "#include <metal_stdlib>\n"
     "#ifndef __COMMON_H__\n"
@@ -14,7 +14,8 @@ static const char binning_shader[] =
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
-    "// renderer constants\n"
+    "// renderer constants, the MAX_* are the defaults of onedraw_def.limits (the clips can't go higher, a binning pass\n"
+    "// holds LAST_COMMAND commands at most)\n"
     "#define TILE_SIZE (16)\n"
     "#define REGION_SIZE (16)\n"
     "#define MAX_NODES_COUNT (1<<22)\n"
@@ -26,6 +27,10 @@ static const char binning_shader[] =
     "#define LAST_COMMAND (MAX_COMMANDS-1)\n"
     "#define MAX_THREADS_PER_THREADGROUP (1024)\n"
     "#define MAX_GLYPHS (128)\n"
+    "#define MAX_FONT_SLOTS (256)         // entries of the glyph table, the commands store 8 bits glyph indices\n"
+    "#define MAX_RUN_GLYPHS (255)\n"
+    "#define FONT_PLANES (3)              // the font textures stack the red, green and blue planes of the msdf vertically\n"
+    "#define MAX_DRAW_VALUES (10)\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "// cpp compatibility\n"
@@ -37,6 +42,7 @@ static const char binning_shader[] =
     "#define command_buffer void*\n"
     "#define texture_half uint64_t\n"
     "#define texture_array uint64_t\n"
+    "#include <string.h>\n"
     "#ifdef __cplusplus\n"
     "    typedef struct alignas(8) {float x, y;} float2;\n"
     "    typedef struct alignas(16) {float x, y, z, w;} float4;\n"
@@ -64,6 +70,7 @@ static const char binning_shader[] =
     "    primitive_blurred_box = 8,\n"
     "    primitive_quad = 9,\n"
     "    primitive_oriented_quad = 10,\n"
+    "    primitive_text_run = 11,\n"
     "    \n"
     "    begin_group = 32,\n"
     "    end_group = 33\n"
@@ -77,11 +84,29 @@ static const char binning_shader[] =
     "    fill_gradient = 3,\n"
     "};\n"
     "\n"
+    "// set in the fillmode of opaque boxes and quads by the occlusion pass, the tile binning stops at them\n"
+    "#define FILLMODE_OCCLUDER (0x80)\n"
+    "\n"
     "#define COMMAND_TYPE_MASK   (0x3f)\n"
     "#define PRIMITIVE_FILLMODE_MASK (0xC0)\n"
     "#define PRIMITIVE_FILLMODE_SHIFT (6)\n"
     "\n"
     "\n"
+    "// set in the data_index of the commands with packed draw data\n"
+    "#define DRAW_DATA_PACKED (0x80000000)\n"
+    "#define PACKED_POSITION_SCALE (8.f)\n"
+    "\n"
+    "// encoding of a value in packed draw data\n"
+    "enum packed_kind\n"
+    "{\n"
+    "    packed_end = 0,\n"
+    "    packed_position = 1,    // unsigned 13.3 fixed point : positions and lengths in [0; 8192[\n"
+    "    packed_unorm = 2,       // uv in [0; 1]\n"
+    "    packed_snorm = 3,       // direction, sin/cos in [-1; 1]\n"
+    "    packed_half = 4,        // other floats\n"
+    "    packed_color = 5        // two 16 bits, the 32 bits color is bitcast to a float\n"
+    "};\n"
+    "\n"
     "enum sdf_operator\n"
     "{\n"
     "    op_overwrite = 0,\n"
@@ -107,14 +132,15 @@ static const char binning_shader[] =
     "    uint32_t next;\n"
     "    uint16_t command_index;\n"
     "    uint8_t command_type;\n"
-    "    uint8_t padding;\n"
+    "    uint8_t first_glyph;        // text runs : first glyph overlapping the tile\n"
     "} tile_node;\n"
     "\n"
     "typedef struct counters\n"
     "{\n"
     "    atomic_uint num_nodes;\n"
     "    atomic_uint num_tiles;\n"
-    "    uint32_t pad[2];\n"
+    "    atomic_uint max_tile_nodes;\n"
+    "    uint32_t pad;\n"
     "} counters;\n"
     "\n"
     "enum clip_type \n"
@@ -133,16 +159,14 @@ static const char binning_shader[] =
     "    enum clip_type type;\n"
     "} clip_shape;\n"
     "\n"
+    "// tile coordinates of a command's bounding box, stored on 8 bits (one word per command) or on 16 bits when the wide\n"
+    "// mode is enabled (two words per command), see load_quantized_aabb()\n"
     "typedef struct quantized_aabb\n"
     "{\n"
-    "#ifdef RASTERIZER_SHADER\n"
-    "    uint32_t packed_data;\n"
-    "#else\n"
-    "    uint8_t min_x;\n"
-    "    uint8_t min_y;\n"
-    "    uint8_t max_x;\n"
-    "    uint8_t max_y;\n"
-    "#endif\n"
+    "    uint16_t min_x;\n"
+    "    uint16_t min_y;\n"
+    "    uint16_t max_x;\n"
+    "    uint16_t max_y;\n"
     "} quantized_aabb;\n"
     "\n"
     "typedef struct font_char\n"
@@ -151,13 +175,15 @@ static const char binning_shader[] =
     "    float2 uv_bottomright;\n"
     "    float width;\n"
     "    float height;\n"
+    "    float top;                  // from the top of the text line to the top of the glyph\n"
+    "    float distance_range;       // pixels of distance between the texel values 0 and 1\n"
     "} font_char;\n"
     "\n"
     "typedef struct draw_cmd_arguments\n"
     "{\n"
     "    constant draw_command* commands;\n"
     "    constant uint32_t* colors;\n"
-    "    constant quantized_aabb* commands_aabb;\n"
+    "    constant uint32_t* commands_aabb;\n"
     "    constant float* draw_data;\n"
     "    constant clip_shape* clips;\n"
     "    constant font_char* glyphs;\n"
@@ -173,16 +199,19 @@ static const char binning_shader[] =
     "    uint32_t num_groups;\n"
     "    float aa_width;\n"
     "    float2 screen_div;\n"
+    "    float2 atlas_half_texel;    // half texel of the atlas in uv, the bilinear sampler fades to zero beyond it\n"
     "    uint32_t num_elements_per_thread;\n"
     "    bool culling_debug;\n"
     "    bool srgb_backbuffer;\n"
+    "    bool wide_aabb;\n"
+    "    bool load_backbuffer;       // blends over the pixels of the previous binning pass instead of the clear color\n"
     "} draw_cmd_arguments;\n"
     "\n"
     "typedef struct tiles_data\n"
     "{\n"
     "    device uint32_t* head;\n"
     "    device tile_node* nodes;\n"
-    "    device uint16_t* tile_indices;\n"
+    "    device uint32_t* tile_indices;\n"
     "} tiles_data;\n"
     "\n"
     "typedef struct output_command_buffer\n"
@@ -190,6 +219,141 @@ static const char binning_shader[] =
     "    command_buffer cmd_buffer;\n"
     "} output_command_buffer;\n"
     "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// packed draw data\n"
+    "//      * a command's values are stored as 16 bits when they fit in their encoding, see od_pack_draw_data()\n"
+    "//      * the layout is an octal number, one digit (packed_kind) per value, the first value in the lowest digit\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "\n"
+    "typedef struct draw_values\n"
+    "{\n"
+    "    float v[MAX_DRAW_VALUES];\n"
+    "} draw_values;\n"
+    "\n"
+    "static inline uint32_t packed_layout(uint32_t type, uint32_t fillmode)\n"
+    "{\n"
+    "    switch(type)\n"
+    "    {\n"
+    "    case primitive_char: return packed_end;     // glyphs are sampled at their exact position\n"
+    "    case primitive_text_run: return packed_end;\n"
+    "    case primitive_aabox: return 011111;\n"
+    "    case primitive_oriented_box: return (fillmode == fill_gradient) ? 05111111 : 0111111;\n"
+    "    case primitive_disc: return (fillmode == fill_hollow) ? 01111 : ((fillmode == fill_gradient) ? 05111 : 0111);\n"
+    "    case primitive_triangle: return 01111111;\n"
+    "    case primitive_ellipse: return (fillmode == fill_hollow) ? 0111111 : 011111;\n"
+    "    case primitive_pie: return (fillmode == fill_hollow) ? 013333111 : 03333111;\n"
+    "    case primitive_arc: return 013333111;\n"
+    "    case primitive_blurred_box: return 011111;\n"
+    "    case primitive_quad: return 022221111;\n"
+    "    case primitive_oriented_quad: return 02222334411;\n"
+    "    case begin_group: return 011;\n"
+    "    case end_group: return 01;\n"
+    "    default: return packed_end;\n"
+    "    }\n"
+    "}\n"
+    "\n"
+    "#ifndef __METAL_VERSION__\n"
+    "static inline float half_to_float(uint16_t value)\n"
+    "{\n"
+    "    // the packing doesn't produce denormals, infinites and nans\n"
+    "    uint32_t bits = (uint32_t)(value & 0x8000) << 16;\n"
+    "    if ((value & 0x7fff) != 0)\n"
+    "        bits |= ((uint32_t)(value & 0x7fff) << 13) + ((127 - 15) << 23);\n"
+    "\n"
+    "    float result;\n"
+    "    memcpy(&result, &bits, sizeof(float));\n"
+    "    return result;\n"
+    "}\n"
+    "#endif\n"
+    "\n"
+    "// returns the draw data of a command, decoded if packed\n"
+    "static inline draw_values load_draw_data(constant float* draw_data, uint32_t data_index, uint32_t type, uint32_t fillmode)\n"
+    "{\n"
+    "    draw_values values;\n"
+    "    uint32_t layout = packed_layout(type, fillmode);\n"
+    "\n"
+    "    if ((data_index & DRAW_DATA_PACKED) == 0)\n"
+    "    {\n"
+    "        for(uint32_t i=0; (layout >> (i * 3)) != 0; ++i)\n"
+    "            values.v[i] = draw_data[data_index + i];\n"
+    "        return values;\n"
+    "    }\n"
+    "\n"
+    "    constant uint16_t* packed = (constant uint16_t*) &draw_data[data_index & ~DRAW_DATA_PACKED];\n"
+    "    for(uint32_t i=0; layout != 0; ++i, layout >>= 3)\n"
+    "    {\n"
+    "        uint16_t value = *packed++;\n"
+    "        switch(layout & 7)\n"
+    "        {\n"
+    "        case packed_position: values.v[i] = (float) value * (1.f / PACKED_POSITION_SCALE); break;\n"
+    "        case packed_unorm: values.v[i] = (float) value * (1.f / 65535.f); break;\n"
+    "        case packed_snorm: values.v[i] = (float) (int16_t) value * (1.f / 32767.f); break;\n"
+    "#ifdef __METAL_VERSION__\n"
+    "        case packed_half: values.v[i] = (float) as_type<half>(value); break;\n"
+    "        case packed_color: values.v[i] = as_type<float>((uint32_t) value | ((uint32_t) (*packed++) << 16)); break;\n"
+    "#else\n"
+    "        case packed_half: values.v[i] = half_to_float(value); break;\n"
+    "        case packed_color:\n"
+    "        {\n"
+    "            uint32_t color = (uint32_t) value | ((uint32_t) (*packed++) << 16);\n"
+    "            memcpy(&values.v[i], &color, sizeof(float));\n"
+    "            break;\n"
+    "        }\n"
+    "#endif\n"
+    "        }\n"
+    "    }\n"
+    "    return values;\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// returns the bounding box of a command, the 8 bits coordinates are in the bytes of the word (min_x in the lowest)\n"
+    "static inline quantized_aabb load_quantized_aabb(constant uint32_t* boxes, uint32_t index, bool wide)\n"
+    "{\n"
+    "    quantized_aabb box;\n"
+    "    if (wide)\n"
+    "    {\n"
+    "        uint32_t min_xy = boxes[index * 2], max_xy = boxes[index * 2 + 1];\n"
+    "        box.min_x = (uint16_t) (min_xy & 0xffff); box.min_y = (uint16_t) (min_xy >> 16);\n"
+    "        box.max_x = (uint16_t) (max_xy & 0xffff); box.max_y = (uint16_t) (max_xy >> 16);\n"
+    "    }\n"
+    "    else\n"
+    "    {\n"
+    "        uint32_t packed = boxes[index];\n"
+    "        box.min_x = (uint16_t) (packed & 0xff); box.min_y = (uint16_t) ((packed >> 8) & 0xff);\n"
+    "        box.max_x = (uint16_t) ((packed >> 16) & 0xff); box.max_y = (uint16_t) (packed >> 24);\n"
+    "    }\n"
+    "    return box;\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// text runs\n"
+    "//      * the draw data are the top of the text line, the left edge of each glyph and the glyph indices (4 per float)\n"
+    "//      * the number of glyphs is in the extra field of the command, left and right edges of the glyphs are increasing\n"
+    "//      * the tile binning keeps the first glyph overlapping the tile in the node, the rasterizer walks from there\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "\n"
+    "static inline uint32_t text_run_size(uint32_t count) {return 1 + count + (count + 3) / 4;}\n"
+    "\n"
+    "static inline uint32_t text_run_glyph(constant const float* run, uint32_t count, uint32_t index)\n"
+    "{\n"
+    "    return ((constant const uint8_t*) &run[1 + count])[index];\n"
+    "}\n"
+    "\n"
+    "// first glyph whose right edge is after [min_x], [count] if none\n"
+    "static inline uint32_t text_run_first_glyph(constant const float* run, uint32_t count, constant const font_char* glyphs, float min_x)\n"
+    "{\n"
+    "    uint32_t first = 0, last = count;\n"
+    "    while (first < last)\n"
+    "    {\n"
+    "        uint32_t middle = (first + last) / 2;\n"
+    "        if (run[1 + middle] + glyphs[text_run_glyph(run, count, middle)].width < min_x)\n"
+    "            first = middle + 1;\n"
+    "        else\n"
+    "            last = middle;\n"
+    "    }\n"
+    "    return first;\n"
+    "}\n"
+    "\n"
     "#ifdef __METAL_VERSION__\n"
     "inline float2 skew(float2 v) {return float2(-v.y, v.x);}\n"
     "inline float cross2(float2 a, float2 b ) {return a.x*b.y - a.y*b.x;}\n"
@@ -544,7 +708,7 @@ static const char binning_shader[] =
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "// returns true if the command intersects with the tile\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
-    "bool intersection_tile_command(aabb tile_aabb, draw_command cmd, sdf_operator op, constant float* data, float aabb_margin)\n"
+    "bool intersection_tile_command(aabb tile_aabb, draw_command cmd, sdf_operator op, thread const float* data, float aabb_margin)\n"
     "{\n"
     "    // grow the bounding box for anti-aliasing, smooth blend and outline\n"
     "    aabb tile_enlarge_aabb = aabb_grow(tile_aabb, aabb_margin);\n"
@@ -653,7 +817,8 @@ static const char binning_shader[] =
     "        case primitive_aabox :\n"
     "        case primitive_blurred_box :\n"
     "        case primitive_quad:\n"
-    "        case primitive_char : intersection = true; break;\n"
+    "        case primitive_char :\n"
+    "        case primitive_text_run : intersection = true; break;     // the glyphs are tested by tile_bin()\n"
     "        default : intersection = false; break;\n"
     "    }\n"
     "\n"
@@ -673,7 +838,7 @@ static const char binning_shader[] =
     "    // reverse order for the tile linked list \n"
     "    uint cmd_index = input.num_commands - index - 1;\n"
     "\n"
-    "    quantized_aabb aabb = input.commands_aabb[cmd_index];\n"
+    "    quantized_aabb aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);\n"
     "    aabb.min_x /= REGION_SIZE; aabb.min_y /= REGION_SIZE;\n"
     "    aabb.max_x /= REGION_SIZE; aabb.max_y /= REGION_SIZE;\n"
     "\n"
@@ -780,7 +945,7 @@ static const char binning_shader[] =
     "// linked-list cleaning\n"
     "//      * detect combination with no primitive and skip it\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
-    "void clean_list(device tiles_data& tiles, uint16_t tile_index)\n"
+    "void clean_list(device tiles_data& tiles, uint32_t tile_index)\n"
     "{\n"
     "    uint32_t node_index = tiles.head[tile_index];\n"
     "    uint32_t previous_index = INVALID_INDEX;\n"
@@ -840,6 +1005,45 @@ static const char binning_shader[] =
     "}\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// range on one axis of a quad where the sampled texels are opaque, the sampler fades to zero in the half texel border\n"
+    "// and outside of [0, 1], returns false if there is no such range\n"
+    "static inline bool quad_opaque_range(float p0, float p1, float uv0, float uv1, float half_texel, thread float& range_min, thread float& range_max)\n"
+    "{\n"
+    "    float uv_min = max(min(uv0, uv1), half_texel), uv_max = min(max(uv0, uv1), 1.f - half_texel);\n"
+    "    if (uv_min > uv_max)\n"
+    "        return false;\n"
+    "\n"
+    "    float a = (uv0 != uv1) ? mix(p0, p1, (uv_min - uv0) / (uv1 - uv0)) : p0;\n"
+    "    float b = (uv0 != uv1) ? mix(p0, p1, (uv_max - uv0) / (uv1 - uv0)) : p1;\n"
+    "    range_min = min(a, b);\n"
+    "    range_max = max(a, b);\n"
+    "    return true;\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// true if an occluder (opaque box or quad) fully covers the tile, anti-aliased edges and clip rect excluded\n"
+    "static inline bool is_tile_occluded(aabb tile, draw_command cmd, thread const float* data, clip_shape clip, float aa_width, float2 half_texel)\n"
+    "{\n"
+    "    if (clip.type != clip_rect)\n"
+    "        return false;\n"
+    "\n"
+    "    aabb occluder;\n"
+    "    if (cmd.type == primitive_aabox)\n"
+    "    {\n"
+    "        occluder.min = float2(data[0], data[1]) - float2(data[2], data[3]);\n"
+    "        occluder.max = float2(data[0], data[1]) + float2(data[2], data[3]);\n"
+    "    }\n"
+    "    else if (!quad_opaque_range(data[0], data[2], data[4], data[6], half_texel.x, occluder.min.x, occluder.max.x) ||\n"
+    "             !quad_opaque_range(data[1], data[3], data[5], data[7], half_texel.y, occluder.min.y, occluder.max.y))\n"
+    "        return false;\n"
+    "    occluder = aabb_grow(occluder, -aa_width);\n"
+    "    occluder.min = max(occluder.min, float2(clip.rect.min_x, clip.rect.min_y));\n"
+    "    occluder.max = min(occluder.max, float2(clip.rect.max_x, clip.rect.max_y));\n"
+    "\n"
+    "    return all(tile.min >= occluder.min) && all(tile.max <= occluder.max);\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "// for each tile of the screen, we traverse the list of commands of the region and if the command has an impact on the tile\n"
     "// we add the command to the linked list of the tile\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
@@ -859,7 +1063,8 @@ static const char binning_shader[] =
     "    if (tile_xy.x >= input.num_tile_width || tile_xy.y >= input.num_tile_height)\n"
     "        return;\n"
     "\n"
-    "    ushort tile_index = tile_xy.y * input.num_tile_width + tile_xy.x;\n"
+    "    // more than 65536 tiles above 4K\n"
+    "    uint tile_index = uint(tile_xy.y) * input.num_tile_width + tile_xy.x;\n"
     "\n"
     "    // compute tile bounding box\n"
     "    aabb tile_aabb = {.min = float2(tile_xy), .max = float2(tile_xy.x + 1, tile_xy.y + 1)};\n"
@@ -867,6 +1072,7 @@ static const char binning_shader[] =
     "\n"
     "    float aabb_margin = 0.f;\n"
     "    sdf_operator group_op = op_overwrite;\n"
+    "    uint num_nodes = 0;\n"
     "    constant const uint16_t* indices = &regions_indices[region_index * input.num_commands];\n"
     "\n"
     "    for(uint32_t i=0; i<input.num_commands; ++i)\n"
@@ -875,7 +1081,7 @@ static const char binning_shader[] =
     "        if (cmd_index == LAST_COMMAND)\n"
     "            break;\n"
     "\n"
-    "        quantized_aabb cmd_aabb = input.commands_aabb[cmd_index];\n"
+    "        quantized_aabb cmd_aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);\n"
     "        if (any(ushort4(tile_xy, cmd_aabb.max_x, cmd_aabb.max_y) < ushort4(cmd_aabb.min_x, cmd_aabb.min_y, tile_xy)))\n"
     "            continue;\n"
     "\n"
@@ -889,10 +1095,21 @@ static const char binning_shader[] =
     "        if (clip_tile(tile_box, clip))\n"
     "            continue;\n"
     "\n"
-    "        constant float* data = &input.draw_data[cmd.data_index];\n"
+    "        draw_values values = load_draw_data(input.draw_data, cmd.data_index, cmd.type, cmd.fillmode);\n"
+    "        thread const float* data = values.v;\n"
     "\n"
     "        bool to_be_added = intersection_tile_command(tile_aabb, cmd, group_op, data, input.aa_width + aabb_margin);\n"
     "\n"
+    "        // a text run is added if one of its glyphs overlaps the tile, the node starts at this glyph\n"
+    "        uint32_t first_glyph = 0;\n"
+    "        if (to_be_added && cmd.type == primitive_text_run)\n"
+    "        {\n"
+    "            constant float* run = &input.draw_data[cmd.data_index];\n"
+    "            float margin = input.aa_width + aabb_margin;\n"
+    "            first_glyph = text_run_first_glyph(run, cmd.extra, input.glyphs, tile_aabb.min.x - margin);\n"
+    "            to_be_added = (first_glyph < cmd.extra) && (run[1 + first_glyph] <= tile_aabb.max.x + margin);\n"
+    "        }\n"
+    "\n"
     "        // we traverse in reverse order, so the end comes first\n"
     "        if (cmd.type == begin_group)\n"
     "        {\n"
@@ -909,6 +1126,7 @@ static const char binning_shader[] =
     "        {\n"
     "            // allocate one node\n"
     "            uint new_node_index = atomic_fetch_add_explicit(&counter.num_nodes, 1, memory_order_relaxed);\n"
+    "            num_nodes++;\n"
     "\n"
     "            // avoid access beyond the end of the buffer\n"
     "            if (new_node_index<input.max_nodes)\n"
@@ -918,16 +1136,25 @@ static const char binning_shader[] =
     "                {\n"
     "                    .command_index = (uint16_t)cmd_index,\n"
     "                    .next  = output.head[tile_index],\n"
-    "                    .command_type = (uint8_t) cmd.type\n"
+    "                    .command_type = (uint8_t) cmd.type,\n"
+    "                    .first_glyph = (uint8_t) first_glyph\n"
     "                };\n"
     "\n"
     "                output.head[tile_index] = new_node_index;\n"
     "            }\n"
+    "\n"
+    "            // outside of a group, the commands below an occluder covering the tile are hidden\n"
+    "            if ((cmd.fillmode & FILLMODE_OCCLUDER) && aabb_margin == 0.f && is_tile_occluded(tile_aabb, cmd, data, clip, input.aa_width, input.atlas_half_texel))\n"
+    "                break;\n"
     "        }\n"
     "    }\n"
     "\n"
     "    clean_list(output, tile_index);\n"
     "\n"
+    "    // longest list, reported in the stats (nodes dropped by an overflow included)\n"
+    "    if (num_nodes > 0)\n"
+    "        atomic_fetch_max_explicit(&counter.max_tile_nodes, num_nodes, memory_order_relaxed);\n"
+    "\n"
     "    // if the tile has some draw command to proceed\n"
     "    if (output.head[tile_index] != INVALID_INDEX)\n"
     "    {\n"
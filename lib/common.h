@@ -6,7 +6,8 @@
 // ---------------------------------------------------------------------------------------------------------------------------
 
 // ---------------------------------------------------------------------------------------------------------------------------
-// renderer constants
+// renderer constants, the MAX_* are the defaults of onedraw_def.limits (the clips can't go higher, a binning pass
+// holds LAST_COMMAND commands at most)
 #define TILE_SIZE (16)
 #define REGION_SIZE (16)
 #define MAX_NODES_COUNT (1<<22)
@@ -18,6 +19,10 @@
 #define LAST_COMMAND (MAX_COMMANDS-1)
 #define MAX_THREADS_PER_THREADGROUP (1024)
 #define MAX_GLYPHS (128)
+#define MAX_FONT_SLOTS (256)         // entries of the glyph table, the commands store 8 bits glyph indices
+#define MAX_RUN_GLYPHS (255)
+#define FONT_PLANES (3)              // the font textures stack the red, green and blue planes of the msdf vertically
+#define MAX_DRAW_VALUES (10)
 
 // ---------------------------------------------------------------------------------------------------------------------------
 // cpp compatibility
@@ -29,6 +34,7 @@
 #define command_buffer void*
 #define texture_half uint64_t
 #define texture_array uint64_t
+#include <string.h>
 #ifdef __cplusplus
     typedef struct alignas(8) {float x, y;} float2;
     typedef struct alignas(16) {float x, y, z, w;} float4;
@@ -56,6 +62,7 @@ enum command_type
     primitive_blurred_box = 8,
     primitive_quad = 9,
     primitive_oriented_quad = 10,
+    primitive_text_run = 11,
     
     begin_group = 32,
     end_group = 33
@@ -69,11 +76,29 @@ enum primitive_fillmode
     fill_gradient = 3,
 };
 
+// set in the fillmode of opaque boxes and quads by the occlusion pass, the tile binning stops at them
+#define FILLMODE_OCCLUDER (0x80)
+
 #define COMMAND_TYPE_MASK   (0x3f)
 #define PRIMITIVE_FILLMODE_MASK (0xC0)
 #define PRIMITIVE_FILLMODE_SHIFT (6)
 
 
+// set in the data_index of the commands with packed draw data
+#define DRAW_DATA_PACKED (0x80000000)
+#define PACKED_POSITION_SCALE (8.f)
+
+// encoding of a value in packed draw data
+enum packed_kind
+{
+    packed_end = 0,
+    packed_position = 1,    // unsigned 13.3 fixed point : positions and lengths in [0; 8192[
+    packed_unorm = 2,       // uv in [0; 1]
+    packed_snorm = 3,       // direction, sin/cos in [-1; 1]
+    packed_half = 4,        // other floats
+    packed_color = 5        // two 16 bits, the 32 bits color is bitcast to a float
+};
+
 enum sdf_operator
 {
     op_overwrite = 0,
@@ -99,14 +124,15 @@ typedef struct tile_node
     uint32_t next;
     uint16_t command_index;
     uint8_t command_type;
-    uint8_t padding;
+    uint8_t first_glyph;        // text runs : first glyph overlapping the tile
 } tile_node;
 
 typedef struct counters
 {
     atomic_uint num_nodes;
     atomic_uint num_tiles;
-    uint32_t pad[2];
+    atomic_uint max_tile_nodes;
+    uint32_t pad;
 } counters;
 
 enum clip_type 
@@ -125,16 +151,14 @@ typedef struct clip_shape
     enum clip_type type;
 } clip_shape;
 
+// tile coordinates of a command's bounding box, stored on 8 bits (one word per command) or on 16 bits when the wide
+// mode is enabled (two words per command), see load_quantized_aabb()
 typedef struct quantized_aabb
 {
-#ifdef RASTERIZER_SHADER
-    uint32_t packed_data;
-#else
-    uint8_t min_x;
-    uint8_t min_y;
-    uint8_t max_x;
-    uint8_t max_y;
-#endif
+    uint16_t min_x;
+    uint16_t min_y;
+    uint16_t max_x;
+    uint16_t max_y;
 } quantized_aabb;
 
 typedef struct font_char
@@ -143,13 +167,15 @@ typedef struct font_char
     float2 uv_bottomright;
     float width;
     float height;
+    float top;                  // from the top of the text line to the top of the glyph
+    float distance_range;       // pixels of distance between the texel values 0 and 1
 } font_char;
 
 typedef struct draw_cmd_arguments
 {
     constant draw_command* commands;
     constant uint32_t* colors;
-    constant quantized_aabb* commands_aabb;
+    constant uint32_t* commands_aabb;
     constant float* draw_data;
     constant clip_shape* clips;
     constant font_char* glyphs;
@@ -165,16 +191,19 @@ typedef struct draw_cmd_arguments
     uint32_t num_groups;
     float aa_width;
     float2 screen_div;
+    float2 atlas_half_texel;    // half texel of the atlas in uv, the bilinear sampler fades to zero beyond it
     uint32_t num_elements_per_thread;
     bool culling_debug;
     bool srgb_backbuffer;
+    bool wide_aabb;
+    bool load_backbuffer;       // blends over the pixels of the previous binning pass instead of the clear color
 } draw_cmd_arguments;
 
 typedef struct tiles_data
 {
     device uint32_t* head;
     device tile_node* nodes;
-    device uint16_t* tile_indices;
+    device uint32_t* tile_indices;
 } tiles_data;
 
 typedef struct output_command_buffer
@@ -182,6 +211,141 @@ typedef struct output_command_buffer
     command_buffer cmd_buffer;
 } output_command_buffer;
 
+// ---------------------------------------------------------------------------------------------------------------------------
+// packed draw data
+//      * a command's values are stored as 16 bits when they fit in their encoding, see od_pack_draw_data()
+//      * the layout is an octal number, one digit (packed_kind) per value, the first value in the lowest digit
+// ---------------------------------------------------------------------------------------------------------------------------
+
+typedef struct draw_values
+{
+    float v[MAX_DRAW_VALUES];
+} draw_values;
+
+static inline uint32_t packed_layout(uint32_t type, uint32_t fillmode)
+{
+    switch(type)
+    {
+    case primitive_char: return packed_end;     // glyphs are sampled at their exact position
+    case primitive_text_run: return packed_end;
+    case primitive_aabox: return 011111;
+    case primitive_oriented_box: return (fillmode == fill_gradient) ? 05111111 : 0111111;
+    case primitive_disc: return (fillmode == fill_hollow) ? 01111 : ((fillmode == fill_gradient) ? 05111 : 0111);
+    case primitive_triangle: return 01111111;
+    case primitive_ellipse: return (fillmode == fill_hollow) ? 0111111 : 011111;
+    case primitive_pie: return (fillmode == fill_hollow) ? 013333111 : 03333111;
+    case primitive_arc: return 013333111;
+    case primitive_blurred_box: return 011111;
+    case primitive_quad: return 022221111;
+    case primitive_oriented_quad: return 02222334411;
+    case begin_group: return 011;
+    case end_group: return 01;
+    default: return packed_end;
+    }
+}
+
+#ifndef __METAL_VERSION__
+static inline float half_to_float(uint16_t value)
+{
+    // the packing doesn't produce denormals, infinites and nans
+    uint32_t bits = (uint32_t)(value & 0x8000) << 16;
+    if ((value & 0x7fff) != 0)
+        bits |= ((uint32_t)(value & 0x7fff) << 13) + ((127 - 15) << 23);
+
+    float result;
+    memcpy(&result, &bits, sizeof(float));
+    return result;
+}
+#endif
+
+// returns the draw data of a command, decoded if packed
+static inline draw_values load_draw_data(constant float* draw_data, uint32_t data_index, uint32_t type, uint32_t fillmode)
+{
+    draw_values values;
+    uint32_t layout = packed_layout(type, fillmode);
+
+    if ((data_index & DRAW_DATA_PACKED) == 0)
+    {
+        for(uint32_t i=0; (layout >> (i * 3)) != 0; ++i)
+            values.v[i] = draw_data[data_index + i];
+        return values;
+    }
+
+    constant uint16_t* packed = (constant uint16_t*) &draw_data[data_index & ~DRAW_DATA_PACKED];
+    for(uint32_t i=0; layout != 0; ++i, layout >>= 3)
+    {
+        uint16_t value = *packed++;
+        switch(layout & 7)
+        {
+        case packed_position: values.v[i] = (float) value * (1.f / PACKED_POSITION_SCALE); break;
+        case packed_unorm: values.v[i] = (float) value * (1.f / 65535.f); break;
+        case packed_snorm: values.v[i] = (float) (int16_t) value * (1.f / 32767.f); break;
+#ifdef __METAL_VERSION__
+        case packed_half: values.v[i] = (float) as_type<half>(value); break;
+        case packed_color: values.v[i] = as_type<float>((uint32_t) value | ((uint32_t) (*packed++) << 16)); break;
+#else
+        case packed_half: values.v[i] = half_to_float(value); break;
+        case packed_color:
+        {
+            uint32_t color = (uint32_t) value | ((uint32_t) (*packed++) << 16);
+            memcpy(&values.v[i], &color, sizeof(float));
+            break;
+        }
+#endif
+        }
+    }
+    return values;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// returns the bounding box of a command, the 8 bits coordinates are in the bytes of the word (min_x in the lowest)
+static inline quantized_aabb load_quantized_aabb(constant uint32_t* boxes, uint32_t index, bool wide)
+{
+    quantized_aabb box;
+    if (wide)
+    {
+        uint32_t min_xy = boxes[index * 2], max_xy = boxes[index * 2 + 1];
+        box.min_x = (uint16_t) (min_xy & 0xffff); box.min_y = (uint16_t) (min_xy >> 16);
+        box.max_x = (uint16_t) (max_xy & 0xffff); box.max_y = (uint16_t) (max_xy >> 16);
+    }
+    else
+    {
+        uint32_t packed = boxes[index];
+        box.min_x = (uint16_t) (packed & 0xff); box.min_y = (uint16_t) ((packed >> 8) & 0xff);
+        box.max_x = (uint16_t) ((packed >> 16) & 0xff); box.max_y = (uint16_t) (packed >> 24);
+    }
+    return box;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// text runs
+//      * the draw data are the top of the text line, the left edge of each glyph and the glyph indices (4 per float)
+//      * the number of glyphs is in the extra field of the command, left and right edges of the glyphs are increasing
+//      * the tile binning keeps the first glyph overlapping the tile in the node, the rasterizer walks from there
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static inline uint32_t text_run_size(uint32_t count) {return 1 + count + (count + 3) / 4;}
+
+static inline uint32_t text_run_glyph(constant const float* run, uint32_t count, uint32_t index)
+{
+    return ((constant const uint8_t*) &run[1 + count])[index];
+}
+
+// first glyph whose right edge is after [min_x], [count] if none
+static inline uint32_t text_run_first_glyph(constant const float* run, uint32_t count, constant const font_char* glyphs, float min_x)
+{
+    uint32_t first = 0, last = count;
+    while (first < last)
+    {
+        uint32_t middle = (first + last) / 2;
+        if (run[1 + middle] + glyphs[text_run_glyph(run, count, middle)].width < min_x)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return first;
+}
+
 #ifdef __METAL_VERSION__
 inline float2 skew(float2 v) {return float2(-v.y, v.x);}
 inline float cross2(float2 a, float2 b ) {return a.x*b.y - a.y*b.x;}
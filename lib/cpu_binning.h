@@ -0,0 +1,730 @@
+#ifndef __CPU_BINNING_H__
+#define __CPU_BINNING_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// cpu version of src/shaders/binning.metal
+//      * the kernels are executed per region (predicate/scan/region binning) or per tile (tile binning)
+//      * keep in sync with the shader
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include "cpu_common.h"
+
+namespace cpu
+{
+
+typedef struct counters
+{
+    std::atomic<uint32_t> num_nodes;
+    std::atomic<uint32_t> num_tiles;
+    std::atomic<uint32_t> max_tile_nodes;
+} counters;
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void atomic_max(std::atomic<uint32_t>& target, uint32_t value)
+{
+    uint32_t current = target.load(std::memory_order_relaxed);
+    while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Collisions functions
+// ---------------------------------------------------------------------------------------------------------------------------
+
+struct aabb
+{
+    float2 min;
+    float2 max;
+};
+
+static inline aabb aabb_grow(aabb box, float amount)
+{
+    return aabb{.min = box.min - amount, .max = box.max + amount};
+}
+
+static inline float2 aabb_get_extents(aabb box) {return box.max - box.min;}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline float edge_distance(float2 p, float2 e0, float2 e1)
+{
+    return (p.x - e1.x) * (e0.y - e1.y) - (e0.x - e1.x) * (p.y - e1.y);
+}
+
+struct obb
+{
+    float2 axis_i;
+    float2 axis_j;
+    float2 center;
+    float2 extents;
+};
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline obb compute_obb(float2 p0, float2 p1, float width)
+{
+    obb result;
+    result.center = (p0 + p1) * .5f;
+    result.axis_j = (p1 - result.center);
+    result.extents.y = length(result.axis_j);
+    result.axis_j /= result.extents.y;
+    result.axis_i = skew(result.axis_j);
+    result.extents.x = width * .5f;
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline float2 obb_transform(obb obox, float2 point)
+{
+    point = point - obox.center;
+    return float2{fabsf(dot(obox.axis_i, point)), fabsf(dot(obox.axis_j, point))};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void aabb_vertices(aabb box, float2* vertices)
+{
+    vertices[0] = box.min;
+    vertices[1] = box.max;
+    vertices[2] = float2{box.min.x, box.max.y};
+    vertices[3] = float2{box.max.x, box.min.y};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// slab test
+static inline bool intersection_aabb_ray(aabb box, float2 origin, float2 direction)
+{
+    float tmin = 0.f;
+    float tmax = 1e10f;
+    const float box_min[2] = {box.min.x, box.min.y};
+    const float box_max[2] = {box.max.x, box.max.y};
+    const float ray_origin[2] = {origin.x, origin.y};
+    const float ray_direction[2] = {direction.x, direction.y};
+
+    for (int i = 0; i < 2; i++)
+    {
+        float inv_dir = 1.f / ray_direction[i];
+        float t1 = (box_min[i] - ray_origin[i]) * inv_dir;
+        float t2 = (box_max[i] - ray_origin[i]) * inv_dir;
+
+        if (t1 > t2)
+        {
+            float temp = t1;
+            t1 = t2;
+            t2 = temp;
+        }
+
+        tmin = max(tmin, t1);
+        tmax = min(tmax, t2);
+
+        if (tmin > tmax)
+            return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_disc(aabb box, float2 center, float radius)
+{
+    float2 nearest_point = clamp(center, box.min, box.max);
+    return distance_squared(nearest_point, center) < square(radius);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_circle(aabb box, float2 center, float radius, float half_width)
+{
+    if (!intersection_aabb_disc(box, center, radius + half_width))
+        return false;
+
+    float2 candidate0 = abs(center - box.min);
+    float2 candidate1 = abs(center - box.max);
+    float2 furthest_point = max(candidate0, candidate1);
+
+    return length_squared(furthest_point) > square(radius - half_width);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_obb(aabb box, float2 p0, float2 p1, float width)
+{
+    float2 dir = p1 - p0;
+    float2 center = (p0 + p1) * 0.5f;
+    float height = length(dir);
+
+    float2 axis_j = dir / height;
+    float2 axis_i = float2{-axis_j.y, axis_j.x};
+
+    float half_i = width * 0.5f;
+    float half_j = height * 0.5f;
+
+    float2 aabb_extent = abs(axis_i * half_i) + abs(axis_j * half_j);
+    float2 obb_min = center - aabb_extent;
+    float2 obb_max = center + aabb_extent;
+    if (obb_max.x < box.min.x || obb_max.y < box.min.y || box.max.x < obb_min.x || box.max.y < obb_min.y)
+        return false;
+
+    float2 aabb_center = (box.min + box.max) * 0.5f;
+    float2 aabb_half = (box.max - box.min) * 0.5f;
+
+    float d = fabsf(dot(axis_i, center - aabb_center));
+    float r = aabb_half.x * fabsf(axis_i.x) + aabb_half.y * fabsf(axis_i.y);
+    if (d > (half_i + r))
+        return false;
+
+    d = fabsf(dot(axis_j, center - aabb_center));
+    r = aabb_half.x * fabsf(axis_j.x) + aabb_half.y * fabsf(axis_j.y);
+    if (d > (half_j + r))
+        return false;
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool edge_separation(float2 e0, float2 e1, float2 refp, const float2* vertices)
+{
+    float ref = edge_distance(refp, e0, e1);
+    float d0 = edge_distance(vertices[0], e0, e1);
+    float d1 = edge_distance(vertices[1], e0, e1);
+    float d2 = edge_distance(vertices[2], e0, e1);
+    float d3 = edge_distance(vertices[3], e0, e1);
+    if (ref > 0.0f)
+        return (d0 < 0.0f && d1 < 0.0f && d2 < 0.0f && d3 < 0.0f);
+    else if (ref < 0.0f)
+        return (d0 > 0.0f && d1 > 0.0f && d2 > 0.0f && d3 > 0.0f);
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_triangle(aabb box, float2 p0, float2 p1, float2 p2)
+{
+    float2 pmin = min(min(p0, p1), p2);
+    float2 pmax = max(max(p0, p1), p2);
+    if (pmax.x < box.min.x || pmax.y < box.min.y || box.max.x < pmin.x || box.max.y < pmin.y)
+        return false;
+
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    if (edge_separation(p0, p1, p2, vertices) || edge_separation(p1, p2, p0, vertices) ||
+        edge_separation(p2, p0, p1, vertices))
+        return false;
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_pie(aabb box, float2 center, float2 direction, float2 aperture, float radius)
+{
+    if (!intersection_aabb_disc(box, center, radius))
+        return false;
+
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    for(int i=0; i<4; ++i)
+    {
+        float2 center_vertex = normalize(vertices[i] - center);
+        if (dot(center_vertex, direction) > aperture.y)
+            return true;
+    }
+    return intersection_aabb_ray(box, center, direction);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_aabb_arc(aabb box, float2 center, float2 direction, float2 aperture, float radius, float thickness)
+{
+    float half_thickness = thickness * .5f;
+
+    if (!intersection_aabb_circle(box, center, radius, half_thickness))
+        return false;
+
+    return intersection_aabb_pie(box, center, direction, aperture, radius + half_thickness);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool point_in_pie(float2 center, float2 direction, float radius, float cos_aperture, float2 point)
+{
+    if (distance_squared(center, point) > square(radius))
+        return false;
+
+    float2 to_point = normalize(point - center);
+    return dot(to_point, direction) > cos_aperture;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_ellipse_circle(float2 p0, float2 p1, float width, float2 center, float radius)
+{
+    obb obox = compute_obb(p0, p1, width);
+    center = obb_transform(obox, center);
+
+    float2 transformed_center = center / obox.extents;
+    float scaled_radius = radius / min(obox.extents.x, obox.extents.y);
+    float squared_distance = dot(transformed_center, transformed_center);
+
+    return (squared_distance <= square(1.f + scaled_radius));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool is_aabb_inside_ellipse(float2 p0, float2 p1, float width, aabb box)
+{
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    obb obox = compute_obb(p0, p1, width);
+
+    // transform each vertex in ellipse space and test all are in the ellipse
+    for(int i=0; i<4; ++i)
+    {
+        float2 vertex_ellipse_space = obb_transform(obox, vertices[i]);
+        float distance =  square(vertex_ellipse_space.x) / square(obox.extents.x) + square(vertex_ellipse_space.y) / square(obox.extents.y);
+        if (distance>1.f)
+            return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool is_aabb_inside_triangle(float2 p0, float2 p1, float2 p2, aabb box)
+{
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    for(int i=0; i<4; ++i)
+    {
+        float d0 = edge_distance(p0, p1, vertices[i]);
+        float d1 = edge_distance(p1, p2, vertices[i]);
+        float d2 = edge_distance(p2, p0, vertices[i]);
+
+        bool has_neg = (d1 < 0) || (d2 < 0) || (d0 < 0);
+        bool has_pos = (d1 > 0) || (d2 > 0) || (d0 > 0);
+
+        if (has_neg&&has_pos)
+            return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool is_aabb_inside_obb(float2 p0, float2 p1, float width, aabb box)
+{
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    obb obox = compute_obb(p0, p1, width);
+
+    for(int i=0; i<4; ++i)
+    {
+        float2 point = obb_transform(obox, vertices[i]);
+        if (point.x > obox.extents.x || point.y > obox.extents.y)
+            return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool is_aabb_inside_pie(float2 center, float2 direction, float2 aperture, float radius, aabb box)
+{
+    float2 vertices[4];
+    aabb_vertices(box, vertices);
+
+    for(int i=0; i<4; ++i)
+    {
+        if (!point_in_pie(center, direction, radius, aperture.y, vertices[i]))
+            return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// returns true if the command intersects with the tile
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool intersection_tile_command(aabb tile_aabb, draw_command cmd, const float* data, float aabb_margin)
+{
+    // grow the bounding box for anti-aliasing, smooth blend and outline
+    aabb tile_enlarge_aabb = aabb_grow(tile_aabb, aabb_margin);
+
+    const bool is_hollow = (cmd.fillmode == fill_hollow);
+    bool intersection = false;
+
+    switch(cmd.type)
+    {
+        case primitive_oriented_box :
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            float width = data[4];
+            aabb tile_rounded = aabb_grow(tile_enlarge_aabb, data[5]);
+            intersection = intersection_aabb_obb(tile_rounded, p0, p1, width);
+
+            if (intersection && is_hollow && is_aabb_inside_obb(p0, p1, width, tile_rounded))
+                intersection = false;
+            break;
+        }
+        case primitive_ellipse :
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            float width = data[4];
+            float2 tile_center = (tile_aabb.min + tile_aabb.max) * .5f;
+
+            aabb tile_smooth = aabb_grow(tile_enlarge_aabb, (is_hollow ? data[5] : 0.f));
+            intersection = intersection_ellipse_circle(p0, p1, width, tile_center, length(aabb_get_extents(tile_smooth) * .5f));
+
+            if (intersection && is_hollow && is_aabb_inside_ellipse(p0, p1, width, tile_smooth))
+                intersection = false;
+            break;
+        }
+        case primitive_arc :
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+            float2 direction = float2{data[3], data[4]};
+            float2 aperture = float2{data[5], data[6]};
+            float thickness = data[7];
+            intersection = intersection_aabb_arc(tile_enlarge_aabb, center, direction, aperture, radius, thickness);
+            break;
+        }
+        case primitive_pie :
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+            float2 direction = float2{data[3], data[4]};
+            float2 aperture = float2{data[5], data[6]};
+
+            aabb tile_smooth = aabb_grow(tile_enlarge_aabb, (is_hollow ? data[7] : 0.f));
+            intersection = intersection_aabb_pie(tile_smooth, center, direction, aperture, radius);
+
+            if (intersection && is_hollow && is_aabb_inside_pie(center, direction, aperture, radius, tile_smooth))
+                intersection = false;
+
+            break;
+        }
+
+        case primitive_disc :
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+
+            if (is_hollow)
+            {
+                float half_width = data[3] + aabb_margin;
+                intersection = intersection_aabb_circle(tile_aabb, center, radius, half_width);
+            }
+            else
+            {
+                radius += aabb_margin;
+                intersection = intersection_aabb_disc(tile_aabb, center, radius);
+            }
+            break;
+        }
+        case primitive_triangle :
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            float2 p2 = float2{data[4], data[5]};
+            aabb tile_rounded = aabb_grow(tile_enlarge_aabb, data[6]);
+            intersection = intersection_aabb_triangle(tile_rounded, p0, p1, p2);
+
+            if (intersection && is_hollow && is_aabb_inside_triangle(p0, p1, p2, tile_rounded))
+                intersection = false;
+
+            break;
+        }
+        case primitive_oriented_quad:
+        {
+            float2 center = float2{data[0], data[1]};
+            float2 dimensions = float2{data[2], data[3]};
+            float2 axis = float2{data[4], data[5]};
+            float2 dir = axis * (.5f/dimensions.x);
+            float2 p0 = center + dir;
+            float2 p1 = center - dir;
+            intersection = intersection_aabb_obb(tile_aabb, p0, p1, 1.f/dimensions.y);
+            break;
+        }
+
+        case begin_group:
+        case end_group:
+        case primitive_aabox :
+        case primitive_blurred_box :
+        case primitive_quad:
+        case primitive_char :
+        case primitive_text_run : intersection = true; break;     // the glyphs are tested by tile_bin()
+        default : intersection = false; break;
+    }
+
+    return intersection;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// for each draw command, test aabb vs aabb of the region and put 1 if visible (otherwise 0)
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void predicate(const draw_cmd_arguments& input, uint8_t* predicate, uint32_t region_index)
+{
+    const uint32_t x = region_index % input.num_region_width;
+    const uint32_t y = region_index / input.num_region_width;
+    uint8_t* output = &predicate[region_index * input.num_commands];
+
+    for(uint32_t index=0; index<input.num_commands; ++index)
+    {
+        // reverse order for the tile linked list
+        uint32_t cmd_index = input.num_commands - index - 1;
+
+        quantized_aabb aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);
+        aabb.min_x /= REGION_SIZE; aabb.min_y /= REGION_SIZE;
+        aabb.max_x /= REGION_SIZE; aabb.max_y /= REGION_SIZE;
+
+        bool visible = (x >= aabb.min_x && x <= aabb.max_x && y >= aabb.min_y && y <= aabb.max_y);
+        output[index] = visible ? 1 : 0;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// one thread per region, a simple running sum is enough
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void exclusive_scan(const draw_cmd_arguments& input, const uint8_t* predicate, uint16_t* scan, uint32_t region_index)
+{
+    const uint32_t region_offset = region_index * input.num_commands;
+    uint16_t sum = 0;
+
+    for(uint32_t i=0; i<input.num_commands; ++i)
+    {
+        scan[region_offset + i] = sum;
+        sum += predicate[region_offset + i];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// bin commands for region
+//      * the gpu relies on the indices buffer being cleared before binning, here we terminate the list instead
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void region_bin(const draw_cmd_arguments& input, uint16_t* regions_indices, const uint16_t* scan, const uint8_t* predicate, uint32_t region_index)
+{
+    const uint32_t region_offset = region_index * input.num_commands;
+    uint32_t count = 0;
+
+    for(uint32_t cmd_index=0; cmd_index<input.num_commands; ++cmd_index)
+    {
+        if (predicate[region_offset + cmd_index] == 1)
+        {
+            uint16_t position = scan[region_offset + cmd_index];
+            if (position < input.num_commands)
+                regions_indices[region_offset + position] = (uint16_t)(input.num_commands - cmd_index - 1);
+            count++;
+        }
+    }
+
+    if (count < input.num_commands)
+        regions_indices[region_offset + count] = LAST_COMMAND;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// linked-list cleaning
+//      * detect combination with no primitive and skip it
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void clean_list(tiles_data& tiles, uint32_t tile_index)
+{
+    uint32_t node_index = tiles.head[tile_index];
+    uint32_t previous_index = INVALID_INDEX;
+    uint32_t before_begin = INVALID_INDEX;
+    uint32_t num_primitives = 0;
+
+    while (node_index != INVALID_INDEX)
+    {
+        tile_node node = tiles.nodes[node_index];
+
+        if (node.command_type == begin_group)
+        {
+            before_begin = previous_index;
+            previous_index = node_index;
+            num_primitives = 0;
+        }
+        else if (node.command_type == end_group)
+        {
+            // no primitive
+            if (num_primitives == 0)
+            {
+                // change head
+                if (before_begin == INVALID_INDEX)
+                    tiles.head[tile_index] = node.next;
+                else
+                    tiles.nodes[before_begin].next = node.next;
+
+                previous_index = before_begin;
+            }
+            else
+                previous_index = node_index;
+        }
+        else
+        {
+            num_primitives++;
+            previous_index = node_index;
+        }
+
+        node_index = node.next;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool clip_tile(aabb tile, clip_shape clip)
+{
+    switch(clip.type)
+    {
+    case clip_rect:
+        return (tile.max.x < clip.rect.min_x || tile.max.y < clip.rect.min_y ||
+                tile.min.x > clip.rect.max_x || tile.min.y > clip.rect.max_y);
+    case clip_disc:
+    {
+        float2 center = float2{clip.disc.center_x, clip.disc.center_y};
+        float2 nearest_point = clamp(center, tile.min, tile.max);
+        return distance_squared(nearest_point, center) > clip.disc.squared_radius;
+    }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// range on one axis of a quad where the sampled texels are opaque, the sampler fades to zero in the half texel border
+// and outside of [0, 1], returns false if there is no such range
+static inline bool quad_opaque_range(float p0, float p1, float uv0, float uv1, float half_texel, float& range_min, float& range_max)
+{
+    float uv_min = max(min(uv0, uv1), half_texel), uv_max = min(max(uv0, uv1), 1.f - half_texel);
+    if (uv_min > uv_max)
+        return false;
+
+    float a = (uv0 != uv1) ? mix(p0, p1, (uv_min - uv0) / (uv1 - uv0)) : p0;
+    float b = (uv0 != uv1) ? mix(p0, p1, (uv_max - uv0) / (uv1 - uv0)) : p1;
+    range_min = min(a, b);
+    range_max = max(a, b);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// true if an occluder (opaque box or quad) fully covers the tile, anti-aliased edges and clip rect excluded
+static inline bool is_tile_occluded(aabb tile, draw_command cmd, const float* data, clip_shape clip, float aa_width, float2 half_texel)
+{
+    if (clip.type != clip_rect)
+        return false;
+
+    aabb occluder;
+    if (cmd.type == primitive_aabox)
+        occluder = aabb{.min = float2{data[0] - data[2], data[1] - data[3]}, .max = float2{data[0] + data[2], data[1] + data[3]}};
+    else if (!quad_opaque_range(data[0], data[2], data[4], data[6], half_texel.x, occluder.min.x, occluder.max.x) ||
+             !quad_opaque_range(data[1], data[3], data[5], data[7], half_texel.y, occluder.min.y, occluder.max.y))
+        return false;
+    occluder = aabb_grow(occluder, -aa_width);
+    occluder.min = max(occluder.min, float2{clip.rect.min_x, clip.rect.min_y});
+    occluder.max = min(occluder.max, float2{clip.rect.max_x, clip.rect.max_y});
+
+    return tile.min.x >= occluder.min.x && tile.min.y >= occluder.min.y && tile.max.x <= occluder.max.x && tile.max.y <= occluder.max.y;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// for the tile, we traverse the list of commands of the region and if the command has an impact on the tile
+// we add the command to the linked list of the tile
+//      * cpu only : the number of nodes of the tile is written in [tile_costs] next to the tile index, it's used
+//        to schedule the longest lists first
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void tile_bin(const draw_cmd_arguments& input, tiles_data& output, counters& counter, uint32_t* tile_costs,
+                            const uint16_t* regions_indices, uint32_t tile_x, uint32_t tile_y)
+{
+    const uint32_t region_index = (tile_y / REGION_SIZE) * input.num_region_width + (tile_x / REGION_SIZE);
+    const uint32_t tile_index = tile_y * input.num_tile_width + tile_x;
+
+    // compute tile bounding box
+    aabb tile_aabb = {.min = float2{(float)tile_x, (float)tile_y}, .max = float2{(float)(tile_x + 1), (float)(tile_y + 1)}};
+    tile_aabb.min *= TILE_SIZE; tile_aabb.max *= TILE_SIZE;
+
+    float aabb_margin = 0.f;
+    uint32_t num_nodes = 0;
+    const uint16_t* indices = &regions_indices[region_index * input.num_commands];
+
+    output.head[tile_index] = INVALID_INDEX;
+
+    for(uint32_t i=0; i<input.num_commands; ++i)
+    {
+        uint32_t cmd_index = indices[i];
+        if (cmd_index == LAST_COMMAND)
+            break;
+
+        quantized_aabb cmd_aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);
+        if (tile_x < cmd_aabb.min_x || tile_y < cmd_aabb.min_y || cmd_aabb.max_x < tile_x || cmd_aabb.max_y < tile_y)
+            continue;
+
+        draw_command cmd = input.commands[cmd_index];
+        clip_shape clip = input.clips[cmd.clip_index];
+
+        if (clip_tile(tile_aabb, clip))
+            continue;
+
+        // the shader always decodes in a local copy, here the unpacked draw data are read in place
+        draw_values values;
+        const float* data;
+        if (cmd.data_index & DRAW_DATA_PACKED)
+        {
+            values = load_draw_data(input.draw_data, cmd.data_index, cmd.type, cmd.fillmode);
+            data = values.v;
+        }
+        else
+            data = &input.draw_data[cmd.data_index];
+
+        bool to_be_added = intersection_tile_command(tile_aabb, cmd, data, input.aa_width + aabb_margin);
+
+        // a text run is added if one of its glyphs overlaps the tile, the node starts at this glyph
+        uint32_t first_glyph = 0;
+        if (to_be_added && cmd.type == primitive_text_run)
+        {
+            const float* run = &input.draw_data[cmd.data_index];
+            float margin = input.aa_width + aabb_margin;
+            first_glyph = text_run_first_glyph(run, cmd.extra, input.glyphs, tile_aabb.min.x - margin);
+            to_be_added = (first_glyph < cmd.extra) && (run[1 + first_glyph] <= tile_aabb.max.x + margin);
+        }
+
+        // we traverse in reverse order, so the end comes first
+        if (cmd.type == begin_group)
+            aabb_margin = 0.f;
+        else if (cmd.type == end_group)
+            aabb_margin = data[0];
+
+        if (to_be_added)
+        {
+            // allocate one node
+            uint32_t new_node_index = counter.num_nodes.fetch_add(1, std::memory_order_relaxed);
+            num_nodes++;
+
+            // avoid access beyond the end of the buffer
+            if (new_node_index<input.max_nodes)
+            {
+                // insert in the linked list the new node
+                output.nodes[new_node_index] = tile_node
+                {
+                    .next  = output.head[tile_index],
+                    .command_index = (uint16_t)cmd_index,
+                    .command_type = (uint8_t) cmd.type,
+                    .first_glyph = (uint8_t) first_glyph
+                };
+
+                output.head[tile_index] = new_node_index;
+            }
+
+            // outside of a group, the commands below an occluder covering the tile are hidden
+            if ((cmd.fillmode & FILLMODE_OCCLUDER) && aabb_margin == 0.f && is_tile_occluded(tile_aabb, cmd, data, clip, input.aa_width, input.atlas_half_texel))
+                break;
+        }
+    }
+
+    clean_list(output, tile_index);
+
+    // longest list, reported in the stats (nodes dropped by an overflow included)
+    if (num_nodes > 0)
+        atomic_max(counter.max_tile_nodes, num_nodes);
+
+    // if the tile has some draw command to proceed
+    if (output.head[tile_index] != INVALID_INDEX)
+    {
+        uint32_t pos = counter.num_tiles.fetch_add(1, std::memory_order_relaxed);
+
+        // add tile index
+        output.tile_indices[pos] = tile_index;
+        tile_costs[pos] = num_nodes;
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef __CPU_COMMON_H__
+#define __CPU_COMMON_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Subset of the metal standard library used by the shaders, the cpu backend mirrors binning.metal and rasterizer.metal
+// almost line by line so any change in a shader is easy to report here
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "common.h"
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// vector operators
+static inline float2 operator+(float2 a, float2 b) {return float2{a.x + b.x, a.y + b.y};}
+static inline float2 operator-(float2 a, float2 b) {return float2{a.x - b.x, a.y - b.y};}
+static inline float2 operator*(float2 a, float2 b) {return float2{a.x * b.x, a.y * b.y};}
+static inline float2 operator/(float2 a, float2 b) {return float2{a.x / b.x, a.y / b.y};}
+static inline float2 operator+(float2 a, float f) {return float2{a.x + f, a.y + f};}
+static inline float2 operator-(float2 a, float f) {return float2{a.x - f, a.y - f};}
+static inline float2 operator*(float2 a, float f) {return float2{a.x * f, a.y * f};}
+static inline float2 operator/(float2 a, float f) {return float2{a.x / f, a.y / f};}
+static inline float2 operator-(float2 a) {return float2{-a.x, -a.y};}
+static inline float2& operator+=(float2& a, float2 b) {a = a + b; return a;}
+static inline float2& operator-=(float2& a, float2 b) {a = a - b; return a;}
+static inline float2& operator*=(float2& a, float f) {a = a * f; return a;}
+static inline float2& operator/=(float2& a, float f) {a = a / f; return a;}
+
+static inline float4 operator*(float4 a, float4 b) {return float4{a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w};}
+
+namespace cpu
+{
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// scalar functions
+static inline float min(float a, float b) {return (a<b) ? a : b;}
+static inline float max(float a, float b) {return (a>b) ? a : b;}
+static inline float clamp(float x, float a, float b) {return min(max(x, a), b);}
+static inline float saturate(float x) {return clamp(x, 0.f, 1.f);}
+static inline float sign(float x) {return (x > 0.f) ? 1.f : ((x < 0.f) ? -1.f : 0.f);}
+static inline float mix(float a, float b, float t) {return a + (b - a) * t;}
+static inline float square(float value) {return value*value;}
+static inline float linearstep(float edge0, float edge1, float x) {return clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);}
+
+static inline float smoothstep(float edge0, float edge1, float x)
+{
+    float t = clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+    return t * t * (3.f - 2.f * t);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// float2 functions
+static inline float2 splat(float value) {return float2{value, value};}
+static inline float2 min(float2 a, float2 b) {return float2{min(a.x, b.x), min(a.y, b.y)};}
+static inline float2 max(float2 a, float2 b) {return float2{max(a.x, b.x), max(a.y, b.y)};}
+static inline float2 max(float2 a, float b) {return float2{max(a.x, b), max(a.y, b)};}
+static inline float2 clamp(float2 v, float2 a, float2 b) {return min(max(v, a), b);}
+static inline float2 saturate(float2 v) {return float2{saturate(v.x), saturate(v.y)};}
+static inline float2 abs(float2 v) {return float2{fabsf(v.x), fabsf(v.y)};}
+static inline float2 mix(float2 a, float2 b, float2 t) {return float2{mix(a.x, b.x, t.x), mix(a.y, b.y, t.y)};}
+static inline float dot(float2 a, float2 b) {return a.x * b.x + a.y * b.y;}
+static inline float length_squared(float2 v) {return dot(v, v);}
+static inline float length(float2 v) {return sqrtf(dot(v, v));}
+static inline float distance_squared(float2 a, float2 b) {return length_squared(b - a);}
+static inline float2 normalize(float2 v) {return v * (1.f / length(v));}
+static inline float2 skew(float2 v) {return float2{-v.y, v.x};}
+static inline float cross2(float2 a, float2 b) {return a.x*b.y - a.y*b.x;}
+
+// column-major 2x2 matrix (same as metal float2x2(c0.x, c0.y, c1.x, c1.y)) times vector
+static inline float2 mul2x2(float c0x, float c0y, float c1x, float c1y, float2 v) {return float2{c0x * v.x + c1x * v.y, c0y * v.x + c1y * v.y};}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// float4 functions (colors)
+static inline float4 mix(float4 a, float4 b, float t)
+{
+    return float4{mix(a.x, b.x, t), mix(a.y, b.y, t), mix(a.z, b.z, t), mix(a.w, b.w, t)};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// color space conversion, tables are filled once by init_color_tables()
+static float srgb_to_linear_table[256];
+static uint8_t linear_to_srgb_table[4096];
+
+static inline void init_color_tables(void)
+{
+    for(uint32_t i=0; i<256; ++i)
+    {
+        float c = (float)i / 255.f;
+        srgb_to_linear_table[i] = (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+    }
+
+    for(uint32_t i=0; i<4096; ++i)
+    {
+        float c = (float)i / 4095.f;
+        c = (c <= 0.0031308f) ? c * 12.92f : 1.055f * powf(c, 1.f / 2.4f) - 0.055f;
+        linear_to_srgb_table[i] = (uint8_t)(saturate(c) * 255.f + .5f);
+    }
+}
+
+// equivalent of unpack_unorm4x8_srgb_to_half()
+static inline float4 unpack_unorm4x8_srgb(uint32_t packed)
+{
+    return float4{srgb_to_linear_table[packed & 0xff], srgb_to_linear_table[(packed >> 8) & 0xff],
+                  srgb_to_linear_table[(packed >> 16) & 0xff], (float)(packed >> 24) / 255.f};
+}
+
+// packs a linear color in a B8G8R8A8 srgb pixel
+static inline uint32_t pack_bgra8_srgb(float4 color)
+{
+    uint32_t r = linear_to_srgb_table[(uint32_t)(saturate(color.x) * 4095.f + .5f)];
+    uint32_t g = linear_to_srgb_table[(uint32_t)(saturate(color.y) * 4095.f + .5f)];
+    uint32_t b = linear_to_srgb_table[(uint32_t)(saturate(color.z) * 4095.f + .5f)];
+    uint32_t a = (uint32_t)(saturate(color.w) * 255.f + .5f);
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+// B8G8R8A8 srgb pixel to linear color, reads the pixels of the previous binning pass
+static inline float4 unpack_bgra8_srgb(uint32_t pixel)
+{
+    return float4{srgb_to_linear_table[(pixel >> 16) & 0xff], srgb_to_linear_table[(pixel >> 8) & 0xff],
+                  srgb_to_linear_table[pixel & 0xff], (float)(pixel >> 24) / 255.f};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// textures
+// ---------------------------------------------------------------------------------------------------------------------------
+
+typedef struct texture
+{
+    uint8_t* pixels;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_slices;
+} texture;
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline float texel_r8(const texture& tex, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= (int)tex.width || y >= (int)tex.height)
+        return 0.f;     // address::clamp_to_zero
+
+    return (float)tex.pixels[y * tex.width + x] / 255.f;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline float4 texel_rgba8_srgb(const texture& tex, int x, int y, uint32_t slice)
+{
+    if (x < 0 || y < 0 || x >= (int)tex.width || y >= (int)tex.height)
+        return float4{0.f, 0.f, 0.f, 0.f};
+
+    const uint8_t* texel = &tex.pixels[((slice * tex.height + y) * tex.width + x) * 4];
+    return float4{srgb_to_linear_table[texel[0]], srgb_to_linear_table[texel[1]], srgb_to_linear_table[texel[2]], (float)texel[3] / 255.f};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// bilinear filtering, same convention as metal : texel centers are at (i + .5) / size
+static inline float sample_r8(const texture& tex, float2 uv)
+{
+    float u = uv.x * (float)tex.width - .5f;
+    float v = uv.y * (float)tex.height - .5f;
+    float x0 = floorf(u), y0 = floorf(v);
+    float fx = u - x0, fy = v - y0;
+    int x = (int)x0, y = (int)y0;
+
+    float top = mix(texel_r8(tex, x, y), texel_r8(tex, x + 1, y), fx);
+    float bottom = mix(texel_r8(tex, x, y + 1), texel_r8(tex, x + 1, y + 1), fx);
+    return mix(top, bottom, fy);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline float4 sample_rgba8_srgb(const texture& tex, float2 uv, uint32_t slice)
+{
+    if (slice >= tex.num_slices)
+        return float4{0.f, 0.f, 0.f, 0.f};
+
+    float u = uv.x * (float)tex.width - .5f;
+    float v = uv.y * (float)tex.height - .5f;
+    float x0 = floorf(u), y0 = floorf(v);
+    float fx = u - x0, fy = v - y0;
+    int x = (int)x0, y = (int)y0;
+
+    float4 top = mix(texel_rgba8_srgb(tex, x, y, slice), texel_rgba8_srgb(tex, x + 1, y, slice), fx);
+    float4 bottom = mix(texel_rgba8_srgb(tex, x, y + 1, slice), texel_rgba8_srgb(tex, x + 1, y + 1, slice), fx);
+    return mix(top, bottom, fy);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// decodes a BC4 texture (the format used by the font atlas) into a R8 texture
+static inline void bc4_decode(const uint8_t* input, uint8_t* output, uint32_t width, uint32_t height)
+{
+    for(uint32_t by=0; by<height; by+=4)
+    {
+        for(uint32_t bx=0; bx<width; bx+=4)
+        {
+            uint32_t r0 = input[0];
+            uint32_t r1 = input[1];
+            uint8_t palette[8];
+            palette[0] = (uint8_t) r0;
+            palette[1] = (uint8_t) r1;
+
+            if (r0 > r1)
+            {
+                for(uint32_t i=1; i<7; ++i)
+                    palette[i+1] = (uint8_t)(((7-i) * r0 + i * r1) / 7);
+            }
+            else
+            {
+                for(uint32_t i=1; i<5; ++i)
+                    palette[i+1] = (uint8_t)(((5-i) * r0 + i * r1) / 5);
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+
+            uint64_t bits = 0;
+            for(uint32_t i=0; i<6; ++i)
+                bits |= ((uint64_t)input[2+i]) << (8*i);
+
+            for(uint32_t i=0; i<16; ++i)
+                output[(by + i/4) * width + bx + (i%4)] = palette[(bits >> (3*i)) & 7];
+
+            input += 8;
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,606 @@
+#ifndef __CPU_RASTERIZER_H__
+#define __CPU_RASTERIZER_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// cpu version of src/shaders/rasterizer.metal
+//      * tile_fs() is executed for a whole tile and writes B8G8R8A8 srgb pixels
+//      * a row of the tile is shaded SIMD_WIDTH pixels at a time (see cpu_simd.h), all pixels of a tile share the
+//        same list of nodes so only the clipping and the group state are tracked per lane
+//      * keep in sync with the shader
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include "cpu_common.h"
+#include "cpu_simd.h"
+
+namespace cpu
+{
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// signed distance functions
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static inline vfloat erf(vfloat x) {return sign(x) * sqrt(1.f - vmap(-1.787776f * x * x, exp2f));}
+static inline vfloat sd_disc(vfloat2 position, float2 center, float radius) {return length(vsplat(center)-position) - radius;}
+
+//-----------------------------------------------------------------------------
+// based on https://www.shadertoy.com/view/NsVSWy
+//   [blur_radius] is half of the roundness
+// returns a float2
+//      .x = distance to box
+//      .y = gaussian blur value (alpha)
+static inline vfloat2 sd_gaussian_box(vfloat2 position, float2 box_center, float2 box_size, float radius)
+{
+    position = position - vsplat(box_center);
+    vfloat2 d = abs(position) - vsplat(box_size);
+    vfloat sd = length(max(d, 0.f)) + min(max(d.x,d.y),0.f) - radius;
+    float blur_radius = radius * 0.5f;
+
+    vfloat u = erf((position.x + box_size.x) / blur_radius) - erf((position.x - box_size.x) / blur_radius);
+    vfloat v = erf((position.y + box_size.y) / blur_radius) - erf((position.y - box_size.y) / blur_radius);
+    return vfloat2{sd, u * v / 4.f};
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_aabox(vfloat2 position, float2 box_center, float2 half_extents, float radius)
+{
+    position = position - vsplat(box_center);
+    position = abs(position) - vsplat(half_extents) + radius;
+    return length(max(position, 0.f)) + min(max(position.x, position.y), 0.f) - radius;
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_oriented_box(vfloat2 position, float2 a, float2 b, float width)
+{
+    float l = length(b-a);
+    float2 d = (b-a)/l;
+    vfloat2 q = (position-vsplat((a+b)*0.5f));
+    q = mul2x2(d.x,-d.y,d.y,d.x, q);
+    q = abs(q)-vsplat(float2{l,width}*0.5f);
+    return length(max(q,0.f)) + min(max(q.x,q.y),0.f);
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_triangle(vfloat2 p, float2 p0, float2 p1, float2 p2 )
+{
+    vfloat2 e0 = vsplat(p1 - p0);
+    vfloat2 e1 = vsplat(p2 - p1);
+    vfloat2 e2 = vsplat(p0 - p2);
+
+    vfloat2 v0 = p - vsplat(p0);
+    vfloat2 v1 = p - vsplat(p1);
+    vfloat2 v2 = p - vsplat(p2);
+
+    vfloat2 pq0 = v0 - e0*saturate(dot(v0,e0)/dot(e0,e0));
+    vfloat2 pq1 = v1 - e1*saturate(dot(v1,e1)/dot(e1,e1));
+    vfloat2 pq2 = v2 - e2*saturate(dot(v2,e2)/dot(e2,e2));
+
+    vfloat s = e0.x*e2.y - e0.y*e2.x;
+    vfloat2 d = min(min(vfloat2{dot(pq0, pq0), s*(v0.x*e0.y-v0.y*e0.x)},
+                        vfloat2{dot(pq1, pq1), s*(v1.x*e1.y-v1.y*e1.x)}),
+                        vfloat2{dot(pq2, pq2), s*(v2.x*e2.y-v2.y*e2.x)});
+
+    return -sqrt(d.x)*sign(d.y);
+}
+
+//-----------------------------------------------------------------------------
+// based on https://www.shadertoy.com/view/tt3yz7
+static inline vfloat sd_ellipse(vfloat2 p, float2 e)
+{
+    vfloat2 pAbs = abs(p);
+    float2 ei = float2{1.f / e.x, 1.f / e.y};
+    float2 e2 = e*e;
+    vfloat2 ve = vsplat(ei * float2{e2.x - e2.y, e2.y - e2.x});
+
+    vfloat2 t = vsplat(float2{0.70710678118654752f, 0.70710678118654752f});
+
+    for (int i = 0; i < 3; i++)
+    {
+        vfloat2 v = ve*t*t*t;
+        vfloat2 u = normalize(pAbs - v) * length(t * vsplat(e) - v);
+        vfloat2 w = vsplat(ei) * (v + u);
+        t = normalize(saturate(w));
+    }
+
+    vfloat2 nearestAbs = t * vsplat(e);
+    vfloat dist = length(pAbs - nearestAbs);
+    return select(dot(pAbs, pAbs) < dot(nearestAbs, nearestAbs), -dist, dist);
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_oriented_ellipse(vfloat2 position, float2 a, float2 b, float width)
+{
+    float height = length(b-a);
+    float2 axis = (b-a)/height;
+    vfloat2 position_translated = (position-vsplat((a+b)*.5f));
+    vfloat2 position_boxspace = mul2x2(axis.x,-axis.y, axis.y, axis.x, position_translated);
+    return sd_ellipse(position_boxspace, float2{height * .5f, width * .5f});
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_oriented_pie(vfloat2 position, float2 center, float2 direction, float2 aperture, float radius)
+{
+    direction = -skew(direction);
+    position = position - vsplat(center);
+    position = mul2x2(direction.x,-direction.y, direction.y, direction.x, position);
+    position.x = abs(position.x);
+    vfloat l = length(position) - radius;
+    vfloat m = length(position - vsplat(aperture)*clamp(dot(position,vsplat(aperture)),0.f,radius));
+    return max(l,m*sign(aperture.y*position.x - aperture.x*position.y));
+}
+
+//-----------------------------------------------------------------------------
+static inline vfloat sd_oriented_ring(vfloat2 position, float2 center, float2 direction, float2 aperture, float radius, float thickness)
+{
+    direction = -skew(direction);
+    position = position - vsplat(center);
+    position = mul2x2(direction.x,-direction.y, direction.y, direction.x, position);
+    position.x = abs(position.x);
+    position = mul2x2(aperture.y,aperture.x,-aperture.x,aperture.y, position);
+    return max(abs(length(position)-radius)-thickness*0.5f,length(vfloat2{position.x,max(0.f,abs(radius-position.y)-thickness*0.5f)})*sign(position.x) );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline vfloat sd_segment(vfloat2 p, float2 a, float2 b )
+{
+    vfloat2 pa = p-vsplat(a), ba = vsplat(b-a);
+    vfloat h = saturate(dot(pa,ba)/dot(ba,ba));
+    return length( pa - ba*h );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline vmask clip_pixel(const clip_shape& clip, vfloat2 pos)
+{
+    switch(clip.type)
+    {
+    case clip_rect: return (pos.x < clip.rect.min_x) | (pos.y < clip.rect.min_y) |
+                           (pos.x > clip.rect.max_x) | (pos.y > clip.rect.max_y);
+    case clip_disc: return (distance_squared(pos, vsplat(float2{clip.disc.center_x, clip.disc.center_y})) > clip.disc.squared_radius);
+    }
+    return vmask(false);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// smooth minimum : quadratic polynomial
+//
+// returns
+//  .x = smallest distance
+//  .y = blend factor between [0; 1]
+static inline vfloat2 smooth_minimum(vfloat a, vfloat b, vfloat k)
+{
+    b = max(b, 0.f);    // a is always on top
+    vmask a_smaller = a < b;
+
+    // smooth min, lanes with k == 0 produce garbage that is discarded by the last select
+    vfloat h = max( k-abs(a-b), 0.0f )/k;
+    vfloat m = h*h*h*0.5f;
+    vfloat s = m*k*(1.0f/3.0f);
+    vfloat2 smooth = vfloat2{select(a_smaller, a-s, b-s), select(a_smaller, 0.f, 1.f - smoothstep(-k, 0.f, b-a))};
+
+    // hard min
+    vfloat2 hard = vfloat2{min(a, b), select(a_smaller, 0.f, 1.f)};
+
+    return select(k > 0.f, smooth, hard);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline vcolor accumulate_color(vcolor color, vcolor backbuffer)
+{
+    return vcolor{mix(backbuffer.r, color.r, color.a), mix(backbuffer.g, color.g, color.a), mix(backbuffer.b, color.b, color.a), 1.f};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// texture fetches are done lane by lane and only for the lanes in [inside]
+static inline vfloat sample_r8(const texture& tex, vfloat2 uv, vmask inside)
+{
+    float u[SIMD_WIDTH], v[SIMD_WIDTH], output[SIMD_WIDTH];
+    vstore(u, uv.x); vstore(v, uv.y);
+    for(uint32_t i=0; i<SIMD_WIDTH; ++i)
+        output[i] = lane(inside, i) ? sample_r8(tex, float2{u[i], v[i]}) : 0.f;
+    return vload(output);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// coverage of a glyph : the median of the msdf planes is the distance to the outline, 0.5 on the edge
+static inline vfloat msdf_coverage(const texture& font, vfloat2 uv, float distance_range, vfloat aa_width, vmask inside)
+{
+    const float plane = 1.f / FONT_PLANES;
+    vfloat r = sample_r8(font, uv, inside);
+    vfloat g = sample_r8(font, vfloat2{uv.x, uv.y + plane}, inside);
+    vfloat b = sample_r8(font, vfloat2{uv.x, uv.y + plane * 2.f}, inside);
+    vfloat median = max(min(r, g), min(max(r, g), b));
+    return saturate((median - .5f) * distance_range / aa_width + .5f);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline vcolor sample_rgba8_srgb(const texture& tex, vfloat2 uv, uint32_t slice, vmask inside)
+{
+    float u[SIMD_WIDTH], v[SIMD_WIDTH], r[SIMD_WIDTH], g[SIMD_WIDTH], b[SIMD_WIDTH], a[SIMD_WIDTH];
+    vstore(u, uv.x); vstore(v, uv.y);
+    for(uint32_t i=0; i<SIMD_WIDTH; ++i)
+    {
+        float4 texel = lane(inside, i) ? sample_rgba8_srgb(tex, float2{u[i], v[i]}, slice) : float4{0.f, 0.f, 0.f, 0.f};
+        r[i] = texel.x; g[i] = texel.y; b[i] = texel.z; a[i] = texel.w;
+    }
+    return vcolor{vload(r), vload(g), vload(b), vload(a)};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// pixel shader for SIMD_WIDTH pixels of a row, returns linear colors
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline vcolor pixel_fs(vfloat2 position, vcolor output, uint32_t node_index, const draw_cmd_arguments& input,
+                              const tiles_data& tiles, const texture& font, const texture& atlas,
+                              const float* const* node_data, uint32_t num_node_data)
+{
+    const vfloat aa_width = input.aa_width;
+
+    // a clip can cut a group for some of the pixels only, so the group state is per lane
+    vfloat previous_distance = 0.f;
+    vcolor previous_color = {0.f, 0.f, 0.f, 0.f};
+    vfloat group_smoothness = 0.f;
+    vmask group_blend = vmask(false);
+    vmask grouping = vmask(false);
+
+    vfloat outline_width = 0.f;
+
+    for(uint32_t rank=0; node_index != INVALID_INDEX; ++rank)
+    {
+        const tile_node node = tiles.nodes[node_index];
+        const draw_command cmd = input.commands[node.command_index];
+        const command_type type = (command_type) cmd.type;
+        const primitive_fillmode fillmode = (primitive_fillmode) cmd.fillmode;
+        const clip_shape& clip = input.clips[cmd.clip_index];
+        node_index = node.next;
+
+        // check if the pixels are in the clip rect
+        const vmask active = ~clip_pixel(clip, position);
+        if (!any(active))
+            continue;
+
+        vcolor cmd_color = vsplat(unpack_unorm4x8_srgb(input.colors[node.command_index]));
+        vfloat distance = 10.f;
+        // the shader decodes the packed draw data per pixel, here tile_fs() decodes them once for the first nodes
+        draw_values values;
+        const float* data;
+        if (rank < num_node_data)
+            data = node_data[rank];
+        else if (cmd.data_index & DRAW_DATA_PACKED)
+        {
+            values = load_draw_data(input.draw_data, cmd.data_index, cmd.type, cmd.fillmode);
+            data = values.v;
+        }
+        else
+            data = &input.draw_data[cmd.data_index];
+
+        if (type == begin_group)
+        {
+            previous_color = select(active, vcolor{0.f, 0.f, 0.f, 0.f}, previous_color);
+            previous_distance = select(active, 100000000.f, previous_distance);
+            group_smoothness = select(active, data[0], group_smoothness);
+            grouping |= active;
+            group_blend = (active & vmask(cmd.extra == op_blend)) | (~active & group_blend);
+            outline_width = select(active, data[1], outline_width);
+            continue;
+        }
+
+        switch(type)
+        {
+        case primitive_disc :
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+            distance = sd_disc(position, center, radius);
+            if (fillmode == fill_hollow)
+                distance = abs(distance) - data[3];
+            else if (fillmode == fill_gradient)
+            {
+                uint32_t packed_color;
+                memcpy(&packed_color, &data[3], sizeof(uint32_t));
+                vcolor inner_color = vsplat(unpack_unorm4x8_srgb(packed_color));
+                cmd_color = mix(inner_color, cmd_color, linearstep(-radius, 0.f, distance));
+            }
+            break;
+        }
+        case primitive_oriented_box :
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            float width = data[4];
+
+            if (width == 0.f)
+                distance = sd_segment(position, p0, p1);
+            else
+                distance = sd_oriented_box(position, p0, p1, data[4]);
+
+            if (fillmode == fill_hollow)
+                distance = abs(distance);
+            else if (fillmode == fill_gradient)
+            {
+                uint32_t packed_color;
+                memcpy(&packed_color, &data[6], sizeof(uint32_t));
+                vcolor inner_color = vsplat(unpack_unorm4x8_srgb(packed_color));
+                vfloat2 pa = position-vsplat(p0), ba = vsplat(p1-p0);
+                vfloat h = saturate(dot(pa,ba)/dot(ba,ba));
+                cmd_color = mix(inner_color, cmd_color, h);
+            }
+            distance -= data[5];
+            break;
+        }
+        case primitive_ellipse :
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            distance = sd_oriented_ellipse(position, p0, p1, data[4]);
+            if (fillmode == fill_hollow)
+                distance = abs(distance) - data[5];
+            break;
+        }
+        case primitive_aabox:
+        {
+            float2 center = float2{data[0], data[1]};
+            float2 half_extents = float2{data[2], data[3]};
+            float radius = data[4];
+            distance = sd_aabox(position, center, half_extents, radius);
+            break;
+        }
+        case primitive_char:
+        {
+            float2 top_left = float2{data[0], data[1]};
+            const font_char& g = input.glyphs[cmd.extra];
+            float2 char_size = float2{g.width, g.height};
+            vfloat2 t = (position - vsplat(top_left)) / vsplat(char_size);
+            vmask inside = (t.x >= 0.f) & (t.y >= 0.f) & (t.x <= 1.f) & (t.y <= 1.f) & active;
+
+            if (any(inside))
+            {
+                vfloat2 uv = mix(vsplat(g.uv_topleft), vsplat(g.uv_bottomright), t);
+                vfloat coverage = msdf_coverage(font, uv, g.distance_range, aa_width, inside);
+                distance = select(inside, (1.f - coverage) * aa_width, distance);
+            }
+            break;
+        }
+        case primitive_text_run:
+        {
+            // overlapping glyphs are composited like separate commands (the transparencies multiply),
+            // the walk stops at the first glyph on the right of the span
+            const float* run = data;
+            const uint32_t count = cmd.extra;
+            vfloat transparency = 1.f;
+            for(uint32_t i=node.first_glyph; i<count && any(position.x >= run[1 + i]); ++i)
+            {
+                const font_char& g = input.glyphs[text_run_glyph(run, count, i)];
+                vfloat2 t = (position - vsplat(float2{run[1 + i], run[0] + g.top})) / vsplat(float2{g.width, g.height});
+                vmask inside = (t.x >= 0.f) & (t.y >= 0.f) & (t.x <= 1.f) & (t.y <= 1.f) & active;
+
+                if (any(inside))
+                {
+                    vfloat2 uv = mix(vsplat(g.uv_topleft), vsplat(g.uv_bottomright), t);
+                    vfloat coverage = msdf_coverage(font, uv, g.distance_range, aa_width, inside);
+                    transparency = select(inside, transparency * (1.f - coverage), transparency);
+                    distance = select(inside, transparency * aa_width, distance);
+                }
+            }
+            break;
+        }
+        case primitive_triangle:
+        {
+            float2 p0 = float2{data[0], data[1]};
+            float2 p1 = float2{data[2], data[3]};
+            float2 p2 = float2{data[4], data[5]};
+            distance = sd_triangle(position, p0, p1, p2);
+
+            if (fillmode == fill_hollow)
+                distance = abs(distance);
+
+            distance -= data[6];
+            break;
+        }
+        case primitive_pie:
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+            float2 direction = float2{data[3], data[4]};
+            float2 aperture = float2{data[5], data[6]};
+
+            distance = sd_oriented_pie(position, center, direction, aperture, radius);
+            if (fillmode == fill_hollow)
+                distance = abs(distance) - data[7];
+            break;
+        }
+        case primitive_arc:
+        {
+            float2 center = float2{data[0], data[1]};
+            float radius = data[2];
+            float2 direction = float2{data[3], data[4]};
+            float2 aperture = float2{data[5], data[6]};
+            float thickness = data[7];
+
+            distance = sd_oriented_ring(position, center, direction, aperture, radius, thickness);
+            if (fillmode == fill_hollow)
+                distance = abs(distance) - data[7];
+            break;
+        }
+        case primitive_blurred_box:
+        {
+            float2 center = float2{data[0], data[1]};
+            float2 size = float2{data[2], data[3]};
+            float roundness = data[4];
+
+            vfloat2 dist_alpha = sd_gaussian_box(position, center, size, roundness);
+
+            distance = dist_alpha.x;
+            cmd_color.a *= dist_alpha.y;
+            break;
+        }
+        case primitive_quad:
+        {
+            float2 top_left = float2{data[0], data[1]};
+            float2 bottom_right = float2{data[2], data[3]};
+            float2 uv_topleft = float2{data[4], data[5]};
+            float2 uv_bottomright = float2{data[6], data[7]};
+            vfloat2 t = (position - vsplat(top_left)) / vsplat(bottom_right - top_left);
+            vmask inside = (t.x >= 0.f) & (t.y >= 0.f) & (t.x <= 1.f) & (t.y <= 1.f) & active;
+
+            if (any(inside))
+            {
+                vfloat2 uv = mix(vsplat(uv_topleft), vsplat(uv_bottomright), t);
+                cmd_color = select(inside, cmd_color * sample_rgba8_srgb(atlas, uv, cmd.extra, inside), cmd_color);
+                distance = select(inside, 0.f, distance);
+            }
+            break;
+        }
+
+        case primitive_oriented_quad:
+        {
+            float2 center = float2{data[0], data[1]};
+            float2 dimensions = float2{data[2], data[3]};
+            vfloat2 axis = vsplat(float2{data[4], data[5]});
+            float2 uv_topleft = float2{data[6], data[7]};
+            float2 uv_bottomright = float2{data[8], data[9]};
+
+            vfloat2 relative = position - vsplat(center);
+            vfloat2 t = vfloat2{dot(axis, relative), dot(skew(axis), relative)};
+            t = t * vsplat(dimensions);
+            t = t + .5f;
+            vmask inside = (t.x >= 0.f) & (t.y >= 0.f) & (t.x <= 1.f) & (t.y <= 1.f) & active;
+
+            if (any(inside))
+            {
+                vfloat2 uv = mix(vsplat(uv_topleft), vsplat(uv_bottomright), t);
+                cmd_color = select(inside, cmd_color * sample_rgba8_srgb(atlas, uv, cmd.extra, inside), cmd_color);
+                distance = select(inside, 0.f, distance);
+            }
+            break;
+        }
+
+        default: break;
+        }
+
+        vcolor color;
+        if (type == end_group)
+        {
+            grouping = grouping & ~active;
+            group_blend = group_blend & ~active;
+            color = previous_color;
+            distance = previous_distance;
+        }
+        else
+        {
+            color = cmd_color;
+        }
+
+        // blend distance / color and skip writing output
+        const vmask blend = grouping & active;
+        if (any(blend))
+        {
+            vfloat smooth_factor = select(group_blend, group_smoothness, aa_width);
+            vfloat2 smooth = smooth_minimum(distance, previous_distance, smooth_factor);
+            previous_distance = select(blend, smooth.x, previous_distance);
+            previous_color = select(blend, mix(color, previous_color, smooth.y), previous_color);
+        }
+
+        const vmask write = ~grouping & active;
+        if (any(write))
+        {
+            vfloat alpha_factor = linearstep(aa_width, 0.f, distance);    // anti-aliasing
+            if (type == end_group)
+            {
+                const vmask outline = (outline_width > 0.f) & write;
+                if (any(outline))
+                {
+                    vfloat t = select(distance > aa_width, 0.f, linearstep(aa_width, 0.f, distance));
+                    vcolor outline_color = vcolor{mix(cmd_color.r, color.r, t), mix(cmd_color.g, color.g, t),
+                                                  mix(cmd_color.b, color.b, t), color.a};
+                    color = select(outline, outline_color, color);
+                    alpha_factor = select(outline, linearstep(aa_width*2.f+outline_width, aa_width+outline_width, distance), alpha_factor);
+                    outline_width = select(outline, 0.f, outline_width);
+                }
+            }
+
+            color.a *= alpha_factor;
+            output = select(write, accumulate_color(color, output), output);
+        }
+    }
+
+    return output;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// nodes of a tile list whose draw data are prepared once per tile by tile_fs()
+static const uint32_t MAX_DECODED_NODES = 256;
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// rasterizes one tile in a B8G8R8A8 srgb buffer of [width] x [height] pixels
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void tile_fs(const draw_cmd_arguments& input, const tiles_data& tiles, const texture& font, const texture& atlas,
+                           uint32_t tile_index, uint32_t* pixels, uint32_t width, uint32_t height)
+{
+    static_assert(TILE_SIZE % SIMD_WIDTH == 0, "a tile row must be a multiple of SIMD_WIDTH");
+
+    const uint32_t tile_x = (tile_index % input.num_tile_width) * TILE_SIZE;
+    const uint32_t tile_y = (tile_index / input.num_tile_width) * TILE_SIZE;
+    const uint32_t max_x = (tile_x + TILE_SIZE < width) ? tile_x + TILE_SIZE : width;
+    const uint32_t max_y = (tile_y + TILE_SIZE < height) ? tile_y + TILE_SIZE : height;
+    const uint32_t head = tiles.head[tile_index];
+    const vcolor background = vsplat(input.culling_debug ? float4{0.f, 0.f, 1.f, 1.f} : input.clear_color);
+
+    float lane_offset[SIMD_WIDTH];
+    for(uint32_t i=0; i<SIMD_WIDTH; ++i)
+        lane_offset[i] = (float)i + .5f;
+
+    // draw data of the first nodes of the list, the packed ones are decoded once for all the spans of the tile
+    draw_values decoded[MAX_DECODED_NODES];
+    const float* node_data[MAX_DECODED_NODES];
+    uint32_t num_node_data = 0;
+    for(uint32_t node_index = head; node_index != INVALID_INDEX && num_node_data < MAX_DECODED_NODES; ++num_node_data)
+    {
+        const tile_node node = tiles.nodes[node_index];
+        const draw_command cmd = input.commands[node.command_index];
+        if (cmd.data_index & DRAW_DATA_PACKED)
+        {
+            decoded[num_node_data] = load_draw_data(input.draw_data, cmd.data_index, cmd.type, cmd.fillmode);
+            node_data[num_node_data] = decoded[num_node_data].v;
+        }
+        else
+            node_data[num_node_data] = &input.draw_data[cmd.data_index];
+        node_index = node.next;
+    }
+
+    for(uint32_t y=tile_y; y<max_y; ++y)
+    {
+        uint32_t* row = &pixels[y * width];
+        for(uint32_t x=tile_x; x<max_x; x+=SIMD_WIDTH)
+        {
+            // the last span of the screen can be partial
+            const uint32_t count = (x + SIMD_WIDTH <= max_x) ? SIMD_WIDTH : max_x - x;
+            float r[SIMD_WIDTH], g[SIMD_WIDTH], b[SIMD_WIDTH], a[SIMD_WIDTH];
+
+            // binning passes after the first one blend over the pixels already written
+            vcolor span_background = background;
+            if (input.load_backbuffer)
+            {
+                for(uint32_t i=0; i<SIMD_WIDTH; ++i)
+                {
+                    float4 pixel = unpack_bgra8_srgb(row[x + ((i < count) ? i : 0)]);
+                    r[i] = pixel.x; g[i] = pixel.y; b[i] = pixel.z; a[i] = pixel.w;
+                }
+                span_background = vcolor{vload(r), vload(g), vload(b), vload(a)};
+            }
+
+            vcolor color = span_background;
+            if (head != INVALID_INDEX)
+            {
+                vfloat2 position = vfloat2{vload(lane_offset) + (float)x, (float)y + .5f};
+                color = pixel_fs(position, span_background, head, input, tiles, font, atlas, node_data, num_node_data);
+            }
+
+            vstore(r, color.r); vstore(g, color.g); vstore(b, color.b); vstore(a, color.a);
+
+            for(uint32_t i=0; i<count; ++i)
+                row[x + i] = pack_bgra8_srgb(float4{r[i], g[i], b[i], a[i]});
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,318 @@
+#ifndef __CPU_SIMD_H__
+#define __CPU_SIMD_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Minimal SIMD layer for the cpu rasterizer
+//      * vfloat holds SIMD_WIDTH pixels of a tile row (structure of arrays)
+//      * AVX2 (8 lanes), SSE2 or NEON (4 lanes), otherwise a scalar fallback of 4 lanes
+//      * define ONEDRAW_NO_SIMD to force the scalar fallback
+//      * only operations that are exact (or identical) in every backend are exposed, so all backends produce
+//        the same results, anything else (exp2, texture sampling) is done lane by lane with vmap()
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdint.h>
+
+#if defined(ONEDRAW_NO_SIMD)
+    #define CPU_SIMD_SCALAR
+#elif defined(__AVX2__)
+    #define CPU_SIMD_AVX2
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #define CPU_SIMD_SSE
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define CPU_SIMD_NEON
+    #include <arm_neon.h>
+#else
+    #define CPU_SIMD_SCALAR
+#endif
+
+namespace cpu
+{
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// AVX2
+// ---------------------------------------------------------------------------------------------------------------------------
+#if defined(CPU_SIMD_AVX2)
+
+#define SIMD_WIDTH (8)
+
+struct vfloat
+{
+    __m256 v;
+    vfloat() = default;
+    vfloat(float f) : v(_mm256_set1_ps(f)) {}
+    explicit vfloat(__m256 x) : v(x) {}
+};
+
+struct vmask
+{
+    __m256 v;
+    vmask() = default;
+    explicit vmask(__m256 x) : v(x) {}
+    explicit vmask(bool b) : v(_mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0))) {}
+};
+
+static inline vfloat vload(const float* p) {return vfloat(_mm256_loadu_ps(p));}
+static inline void vstore(float* p, vfloat a) {_mm256_storeu_ps(p, a.v);}
+
+static inline vfloat operator+(vfloat a, vfloat b) {return vfloat(_mm256_add_ps(a.v, b.v));}
+static inline vfloat operator-(vfloat a, vfloat b) {return vfloat(_mm256_sub_ps(a.v, b.v));}
+static inline vfloat operator*(vfloat a, vfloat b) {return vfloat(_mm256_mul_ps(a.v, b.v));}
+static inline vfloat operator/(vfloat a, vfloat b) {return vfloat(_mm256_div_ps(a.v, b.v));}
+static inline vfloat operator-(vfloat a) {return vfloat(_mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)));}
+
+static inline vmask operator<(vfloat a, vfloat b) {return vmask(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ));}
+static inline vmask operator>(vfloat a, vfloat b) {return vmask(_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ));}
+static inline vmask operator<=(vfloat a, vfloat b) {return vmask(_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ));}
+static inline vmask operator>=(vfloat a, vfloat b) {return vmask(_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ));}
+
+static inline vmask operator&(vmask a, vmask b) {return vmask(_mm256_and_ps(a.v, b.v));}
+static inline vmask operator|(vmask a, vmask b) {return vmask(_mm256_or_ps(a.v, b.v));}
+static inline vmask operator~(vmask a) {return vmask(_mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))));}
+static inline bool any(vmask a) {return _mm256_movemask_ps(a.v) != 0;}
+static inline bool all(vmask a) {return _mm256_movemask_ps(a.v) == 0xff;}
+static inline bool lane(vmask a, uint32_t i) {return (_mm256_movemask_ps(a.v) >> i) & 1;}
+
+static inline vfloat min(vfloat a, vfloat b) {return vfloat(_mm256_min_ps(a.v, b.v));}
+static inline vfloat max(vfloat a, vfloat b) {return vfloat(_mm256_max_ps(a.v, b.v));}
+static inline vfloat abs(vfloat a) {return vfloat(_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v));}
+static inline vfloat sqrt(vfloat a) {return vfloat(_mm256_sqrt_ps(a.v));}
+static inline vfloat select(vmask m, vfloat a, vfloat b) {return vfloat(_mm256_blendv_ps(b.v, a.v, m.v));}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// SSE2
+// ---------------------------------------------------------------------------------------------------------------------------
+#elif defined(CPU_SIMD_SSE)
+
+#define SIMD_WIDTH (4)
+
+struct vfloat
+{
+    __m128 v;
+    vfloat() = default;
+    vfloat(float f) : v(_mm_set1_ps(f)) {}
+    explicit vfloat(__m128 x) : v(x) {}
+};
+
+struct vmask
+{
+    __m128 v;
+    vmask() = default;
+    explicit vmask(__m128 x) : v(x) {}
+    explicit vmask(bool b) : v(_mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0))) {}
+};
+
+static inline vfloat vload(const float* p) {return vfloat(_mm_loadu_ps(p));}
+static inline void vstore(float* p, vfloat a) {_mm_storeu_ps(p, a.v);}
+
+static inline vfloat operator+(vfloat a, vfloat b) {return vfloat(_mm_add_ps(a.v, b.v));}
+static inline vfloat operator-(vfloat a, vfloat b) {return vfloat(_mm_sub_ps(a.v, b.v));}
+static inline vfloat operator*(vfloat a, vfloat b) {return vfloat(_mm_mul_ps(a.v, b.v));}
+static inline vfloat operator/(vfloat a, vfloat b) {return vfloat(_mm_div_ps(a.v, b.v));}
+static inline vfloat operator-(vfloat a) {return vfloat(_mm_xor_ps(a.v, _mm_set1_ps(-0.f)));}
+
+static inline vmask operator<(vfloat a, vfloat b) {return vmask(_mm_cmplt_ps(a.v, b.v));}
+static inline vmask operator>(vfloat a, vfloat b) {return vmask(_mm_cmpgt_ps(a.v, b.v));}
+static inline vmask operator<=(vfloat a, vfloat b) {return vmask(_mm_cmple_ps(a.v, b.v));}
+static inline vmask operator>=(vfloat a, vfloat b) {return vmask(_mm_cmpge_ps(a.v, b.v));}
+
+static inline vmask operator&(vmask a, vmask b) {return vmask(_mm_and_ps(a.v, b.v));}
+static inline vmask operator|(vmask a, vmask b) {return vmask(_mm_or_ps(a.v, b.v));}
+static inline vmask operator~(vmask a) {return vmask(_mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))));}
+static inline bool any(vmask a) {return _mm_movemask_ps(a.v) != 0;}
+static inline bool all(vmask a) {return _mm_movemask_ps(a.v) == 0xf;}
+static inline bool lane(vmask a, uint32_t i) {return (_mm_movemask_ps(a.v) >> i) & 1;}
+
+static inline vfloat min(vfloat a, vfloat b) {return vfloat(_mm_min_ps(a.v, b.v));}
+static inline vfloat max(vfloat a, vfloat b) {return vfloat(_mm_max_ps(a.v, b.v));}
+static inline vfloat abs(vfloat a) {return vfloat(_mm_andnot_ps(_mm_set1_ps(-0.f), a.v));}
+static inline vfloat sqrt(vfloat a) {return vfloat(_mm_sqrt_ps(a.v));}
+static inline vfloat select(vmask m, vfloat a, vfloat b) {return vfloat(_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)));}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// NEON (aarch64)
+// ---------------------------------------------------------------------------------------------------------------------------
+#elif defined(CPU_SIMD_NEON)
+
+#define SIMD_WIDTH (4)
+
+struct vfloat
+{
+    float32x4_t v;
+    vfloat() = default;
+    vfloat(float f) : v(vdupq_n_f32(f)) {}
+    explicit vfloat(float32x4_t x) : v(x) {}
+};
+
+struct vmask
+{
+    uint32x4_t v;
+    vmask() = default;
+    explicit vmask(uint32x4_t x) : v(x) {}
+    explicit vmask(bool b) : v(vdupq_n_u32(b ? 0xffffffff : 0)) {}
+};
+
+static inline vfloat vload(const float* p) {return vfloat(vld1q_f32(p));}
+static inline void vstore(float* p, vfloat a) {vst1q_f32(p, a.v);}
+
+static inline vfloat operator+(vfloat a, vfloat b) {return vfloat(vaddq_f32(a.v, b.v));}
+static inline vfloat operator-(vfloat a, vfloat b) {return vfloat(vsubq_f32(a.v, b.v));}
+static inline vfloat operator*(vfloat a, vfloat b) {return vfloat(vmulq_f32(a.v, b.v));}
+static inline vfloat operator/(vfloat a, vfloat b) {return vfloat(vdivq_f32(a.v, b.v));}
+static inline vfloat operator-(vfloat a) {return vfloat(vnegq_f32(a.v));}
+
+static inline vmask operator<(vfloat a, vfloat b) {return vmask(vcltq_f32(a.v, b.v));}
+static inline vmask operator>(vfloat a, vfloat b) {return vmask(vcgtq_f32(a.v, b.v));}
+static inline vmask operator<=(vfloat a, vfloat b) {return vmask(vcleq_f32(a.v, b.v));}
+static inline vmask operator>=(vfloat a, vfloat b) {return vmask(vcgeq_f32(a.v, b.v));}
+
+static inline vmask operator&(vmask a, vmask b) {return vmask(vandq_u32(a.v, b.v));}
+static inline vmask operator|(vmask a, vmask b) {return vmask(vorrq_u32(a.v, b.v));}
+static inline vmask operator~(vmask a) {return vmask(vmvnq_u32(a.v));}
+static inline bool any(vmask a) {return vmaxvq_u32(a.v) != 0;}
+static inline bool all(vmask a) {return vminvq_u32(a.v) != 0;}
+static inline bool lane(vmask a, uint32_t i) {uint32_t m[4]; vst1q_u32(m, a.v); return m[i] != 0;}
+
+static inline vfloat min(vfloat a, vfloat b) {return vfloat(vbslq_f32(vcltq_f32(a.v, b.v), a.v, b.v));}
+static inline vfloat max(vfloat a, vfloat b) {return vfloat(vbslq_f32(vcgtq_f32(a.v, b.v), a.v, b.v));}
+static inline vfloat abs(vfloat a) {return vfloat(vabsq_f32(a.v));}
+static inline vfloat sqrt(vfloat a) {return vfloat(vsqrtq_f32(a.v));}
+static inline vfloat select(vmask m, vfloat a, vfloat b) {return vfloat(vbslq_f32(m.v, a.v, b.v));}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// scalar fallback
+// ---------------------------------------------------------------------------------------------------------------------------
+#else
+
+#define SIMD_WIDTH (4)
+
+struct vfloat
+{
+    float v[SIMD_WIDTH];
+    vfloat() = default;
+    vfloat(float f) {for(int i=0; i<SIMD_WIDTH; ++i) v[i] = f;}
+};
+
+struct vmask
+{
+    bool v[SIMD_WIDTH];
+    vmask() = default;
+    explicit vmask(bool b) {for(int i=0; i<SIMD_WIDTH; ++i) v[i] = b;}
+};
+
+#define SIMD_LOOP(expr) for(int i=0; i<SIMD_WIDTH; ++i) expr;
+
+static inline vfloat vload(const float* p) {vfloat r; SIMD_LOOP(r.v[i] = p[i]) return r;}
+static inline void vstore(float* p, vfloat a) {SIMD_LOOP(p[i] = a.v[i])}
+
+static inline vfloat operator+(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = a.v[i] + b.v[i]) return r;}
+static inline vfloat operator-(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = a.v[i] - b.v[i]) return r;}
+static inline vfloat operator*(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = a.v[i] * b.v[i]) return r;}
+static inline vfloat operator/(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = a.v[i] / b.v[i]) return r;}
+static inline vfloat operator-(vfloat a) {vfloat r; SIMD_LOOP(r.v[i] = -a.v[i]) return r;}
+
+static inline vmask operator<(vfloat a, vfloat b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] < b.v[i]) return r;}
+static inline vmask operator>(vfloat a, vfloat b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] > b.v[i]) return r;}
+static inline vmask operator<=(vfloat a, vfloat b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] <= b.v[i]) return r;}
+static inline vmask operator>=(vfloat a, vfloat b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] >= b.v[i]) return r;}
+
+static inline vmask operator&(vmask a, vmask b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] && b.v[i]) return r;}
+static inline vmask operator|(vmask a, vmask b) {vmask r; SIMD_LOOP(r.v[i] = a.v[i] || b.v[i]) return r;}
+static inline vmask operator~(vmask a) {vmask r; SIMD_LOOP(r.v[i] = !a.v[i]) return r;}
+static inline bool any(vmask a) {bool r = false; SIMD_LOOP(r = r || a.v[i]) return r;}
+static inline bool all(vmask a) {bool r = true; SIMD_LOOP(r = r && a.v[i]) return r;}
+static inline bool lane(vmask a, uint32_t i) {return a.v[i];}
+
+static inline vfloat min(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = (a.v[i] < b.v[i]) ? a.v[i] : b.v[i]) return r;}
+static inline vfloat max(vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = (a.v[i] > b.v[i]) ? a.v[i] : b.v[i]) return r;}
+static inline vfloat abs(vfloat a) {vfloat r; SIMD_LOOP(r.v[i] = fabsf(a.v[i])) return r;}
+static inline vfloat sqrt(vfloat a) {vfloat r; SIMD_LOOP(r.v[i] = sqrtf(a.v[i])) return r;}
+static inline vfloat select(vmask m, vfloat a, vfloat b) {vfloat r; SIMD_LOOP(r.v[i] = m.v[i] ? a.v[i] : b.v[i]) return r;}
+
+#undef SIMD_LOOP
+
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// common functions, built on top of the backend
+// ---------------------------------------------------------------------------------------------------------------------------
+
+static inline vfloat& operator+=(vfloat& a, vfloat b) {a = a + b; return a;}
+static inline vfloat& operator-=(vfloat& a, vfloat b) {a = a - b; return a;}
+static inline vfloat& operator*=(vfloat& a, vfloat b) {a = a * b; return a;}
+static inline vmask& operator&=(vmask& a, vmask b) {a = a & b; return a;}
+static inline vmask& operator|=(vmask& a, vmask b) {a = a | b; return a;}
+
+static inline float lane(vfloat a, uint32_t i) {float v[SIMD_WIDTH]; vstore(v, a); return v[i];}
+
+// applies a scalar function lane by lane
+template<typename F>
+static inline vfloat vmap(vfloat a, const F& function)
+{
+    float v[SIMD_WIDTH];
+    vstore(v, a);
+    for(uint32_t i=0; i<SIMD_WIDTH; ++i)
+        v[i] = function(v[i]);
+    return vload(v);
+}
+
+static inline vfloat clamp(vfloat x, vfloat a, vfloat b) {return min(max(x, a), b);}
+static inline vfloat saturate(vfloat x) {return clamp(x, 0.f, 1.f);}
+static inline vfloat sign(vfloat x) {return select(x > 0.f, 1.f, select(x < 0.f, -1.f, 0.f));}
+static inline vfloat mix(vfloat a, vfloat b, vfloat t) {return a + (b - a) * t;}
+static inline vfloat linearstep(vfloat edge0, vfloat edge1, vfloat x) {return clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);}
+
+static inline vfloat smoothstep(vfloat edge0, vfloat edge1, vfloat x)
+{
+    vfloat t = clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+    return t * t * (3.f - 2.f * t);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// 2d vectors of pixels
+struct vfloat2 {vfloat x, y;};
+
+static inline vfloat2 operator+(vfloat2 a, vfloat2 b) {return vfloat2{a.x + b.x, a.y + b.y};}
+static inline vfloat2 operator-(vfloat2 a, vfloat2 b) {return vfloat2{a.x - b.x, a.y - b.y};}
+static inline vfloat2 operator*(vfloat2 a, vfloat2 b) {return vfloat2{a.x * b.x, a.y * b.y};}
+static inline vfloat2 operator/(vfloat2 a, vfloat2 b) {return vfloat2{a.x / b.x, a.y / b.y};}
+static inline vfloat2 operator*(vfloat2 a, vfloat f) {return vfloat2{a.x * f, a.y * f};}
+static inline vfloat2 operator-(vfloat2 a, vfloat f) {return vfloat2{a.x - f, a.y - f};}
+static inline vfloat2 operator+(vfloat2 a, vfloat f) {return vfloat2{a.x + f, a.y + f};}
+static inline vfloat2 operator-(vfloat2 a) {return vfloat2{-a.x, -a.y};}
+
+static inline vfloat2 vsplat(float2 v) {return vfloat2{v.x, v.y};}
+static inline vfloat2 min(vfloat2 a, vfloat2 b) {return vfloat2{min(a.x, b.x), min(a.y, b.y)};}
+static inline vfloat2 max(vfloat2 a, vfloat b) {return vfloat2{max(a.x, b), max(a.y, b)};}
+static inline vfloat2 abs(vfloat2 v) {return vfloat2{abs(v.x), abs(v.y)};}
+static inline vfloat2 saturate(vfloat2 v) {return vfloat2{saturate(v.x), saturate(v.y)};}
+static inline vfloat2 mix(vfloat2 a, vfloat2 b, vfloat2 t) {return vfloat2{mix(a.x, b.x, t.x), mix(a.y, b.y, t.y)};}
+static inline vfloat dot(vfloat2 a, vfloat2 b) {return a.x * b.x + a.y * b.y;}
+static inline vfloat length(vfloat2 v) {return sqrt(dot(v, v));}
+static inline vfloat distance_squared(vfloat2 a, vfloat2 b) {vfloat2 d = b - a; return dot(d, d);}
+static inline vfloat2 normalize(vfloat2 v) {return v * (1.f / length(v));}
+static inline vfloat2 skew(vfloat2 v) {return vfloat2{-v.y, v.x};}
+static inline vfloat2 select(vmask m, vfloat2 a, vfloat2 b) {return vfloat2{select(m, a.x, b.x), select(m, a.y, b.y)};}
+
+// column-major 2x2 matrix (same as metal float2x2(c0.x, c0.y, c1.x, c1.y)) times vector
+static inline vfloat2 mul2x2(float c0x, float c0y, float c1x, float c1y, vfloat2 v) {return vfloat2{v.x * c0x + v.y * c1x, v.x * c0y + v.y * c1y};}
+static inline vfloat2 mul2x2(vfloat c0x, vfloat c0y, vfloat c1x, vfloat c1y, vfloat2 v) {return vfloat2{v.x * c0x + v.y * c1x, v.x * c0y + v.y * c1y};}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// linear colors of pixels
+struct vcolor {vfloat r, g, b, a;};
+
+static inline vcolor vsplat(float4 c) {return vcolor{c.x, c.y, c.z, c.w};}
+static inline vcolor operator*(vcolor a, vcolor b) {return vcolor{a.r * b.r, a.g * b.g, a.b * b.b, a.a * b.a};}
+static inline vcolor mix(vcolor a, vcolor b, vfloat t) {return vcolor{mix(a.r, b.r, t), mix(a.g, b.g, t), mix(a.b, b.b, t), mix(a.a, b.a, t)};}
+
+static inline vcolor select(vmask m, vcolor a, vcolor b)
+{
+    return vcolor{select(m, a.r, b.r), select(m, a.g, b.g), select(m, a.b, b.b), select(m, a.a, b.a)};
+}
+
+}
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef __CPU_THREAD_POOL_H__
+#define __CPU_THREAD_POOL_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Minimal thread pool used by the cpu backend
+//      * Dispatch() is blocking, the calling thread participates to the work
+//      * Dispatch() : tasks are claimed with an atomic counter
+//      * DispatchByCost() : tasks are sorted by cost and dealt round-robin in per-worker deques, each worker pops
+//        the most expensive task of its own deque and steals the cheapest ones of other deques once it's empty
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class ThreadPool
+{
+public:
+    typedef void (*TaskFunction)(void* context, uint32_t index);
+
+    void Init(uint32_t num_threads);
+    void Dispatch(TaskFunction function, void* context, uint32_t count);
+    void DispatchByCost(TaskFunction function, void* context, const uint32_t* costs, uint32_t count);
+    void Terminate();
+    uint32_t GetNumThreads() const {return m_NumWorkers + 1;}
+
+    template<typename F>
+    void ParallelFor(uint32_t count, const F& function)
+    {
+        Dispatch([](void* context, uint32_t index) {(*(const F*)context)(index);}, (void*)&function, count);
+    }
+
+    template<typename F>
+    void ParallelForByCost(uint32_t count, const uint32_t* costs, const F& function)
+    {
+        DispatchByCost([](void* context, uint32_t index) {(*(const F*)context)(index);}, (void*)&function, costs, count);
+    }
+
+private:
+    // range of m_pOrder owned by a worker, packed as (begin << 32) | end
+    struct alignas(64) Deque
+    {
+        std::atomic<uint64_t> range;
+    };
+
+    void WorkerLoop(uint32_t worker_index);
+    void Execute(uint32_t worker_index);
+    void Run(TaskFunction function, void* context, uint32_t count, bool use_deques);
+    bool PopFront(Deque& deque, uint32_t& task);
+    bool StealBack(Deque& deque, uint32_t& task);
+
+    std::thread* m_pWorkers {nullptr};
+    uint32_t m_NumWorkers {0};
+
+    Deque* m_pDeques {nullptr};
+    uint32_t* m_pOrder {nullptr};
+    uint32_t m_OrderCapacity {0};
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkAvailable;
+    std::condition_variable m_WorkDone;
+
+    TaskFunction m_Function {nullptr};
+    void* m_pContext {nullptr};
+    uint32_t m_TaskCount {0};
+    std::atomic<uint32_t> m_NextTask {0};
+    uint32_t m_Generation {0};
+    uint32_t m_NumBusy {0};
+    bool m_UseDeques {false};
+    bool m_Quit {false};
+};
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::Init(uint32_t num_threads)
+{
+    if (num_threads == 0)
+        num_threads = std::thread::hardware_concurrency();
+
+    m_NumWorkers = (num_threads > 1) ? num_threads - 1 : 0;
+    m_Quit = false;
+
+    // one deque per worker plus one for the calling thread
+    m_pDeques = new Deque[m_NumWorkers + 1];
+
+    if (m_NumWorkers > 0)
+    {
+        m_pWorkers = new std::thread[m_NumWorkers];
+        for(uint32_t i=0; i<m_NumWorkers; ++i)
+            m_pWorkers[i] = std::thread(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline bool ThreadPool::PopFront(Deque& deque, uint32_t& task)
+{
+    uint64_t range = deque.range.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+        if (begin >= end)
+            return false;
+
+        if (deque.range.compare_exchange_weak(range, ((uint64_t)(begin + 1) << 32) | end, std::memory_order_relaxed))
+        {
+            task = m_pOrder[begin];
+            return true;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline bool ThreadPool::StealBack(Deque& deque, uint32_t& task)
+{
+    uint64_t range = deque.range.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+        if (begin >= end)
+            return false;
+
+        if (deque.range.compare_exchange_weak(range, ((uint64_t)begin << 32) | (end - 1), std::memory_order_relaxed))
+        {
+            task = m_pOrder[end - 1];
+            return true;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::Execute(uint32_t worker_index)
+{
+    if (!m_UseDeques)
+    {
+        for(uint32_t index = m_NextTask.fetch_add(1, std::memory_order_relaxed); index < m_TaskCount;
+            index = m_NextTask.fetch_add(1, std::memory_order_relaxed))
+            m_Function(m_pContext, index);
+        return;
+    }
+
+    const uint32_t num_deques = m_NumWorkers + 1;
+    uint32_t task;
+
+    // own deque first, most expensive tasks first
+    while (PopFront(m_pDeques[worker_index], task))
+        m_Function(m_pContext, task);
+
+    // then steal the cheapest tasks of the others
+    for(uint32_t i=1; i<num_deques; ++i)
+    {
+        Deque& victim = m_pDeques[(worker_index + i) % num_deques];
+        while (StealBack(victim, task))
+            m_Function(m_pContext, task);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::Run(TaskFunction function, void* context, uint32_t count, bool use_deques)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Function = function;
+        m_pContext = context;
+        m_TaskCount = count;
+        m_NextTask.store(0, std::memory_order_relaxed);
+        m_UseDeques = use_deques;
+        m_NumBusy = m_NumWorkers;
+        m_Generation++;
+    }
+    m_WorkAvailable.notify_all();
+
+    Execute(m_NumWorkers);
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_WorkDone.wait(lock, [this] {return m_NumBusy == 0;});
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::Dispatch(TaskFunction function, void* context, uint32_t count)
+{
+    if (count == 0)
+        return;
+
+    if (m_NumWorkers == 0 || count == 1)
+    {
+        for(uint32_t i=0; i<count; ++i)
+            function(context, i);
+        return;
+    }
+
+    Run(function, context, count, false);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::DispatchByCost(TaskFunction function, void* context, const uint32_t* costs, uint32_t count)
+{
+    if (count == 0)
+        return;
+
+    if (m_NumWorkers == 0 || count == 1)
+    {
+        for(uint32_t i=0; i<count; ++i)
+            function(context, i);
+        return;
+    }
+
+    if (count > m_OrderCapacity)
+    {
+        delete[] m_pOrder;
+        m_OrderCapacity = std::max(count, m_OrderCapacity * 2);
+        m_pOrder = new uint32_t[m_OrderCapacity * 2];
+    }
+
+    // longest first
+    uint32_t* sorted = m_pOrder + m_OrderCapacity;
+    for(uint32_t i=0; i<count; ++i)
+        sorted[i] = i;
+    std::sort(sorted, sorted + count, [costs](uint32_t a, uint32_t b) {return costs[a] > costs[b];});
+
+    // deal the tasks round-robin so each deque starts with one of the most expensive tasks
+    const uint32_t num_deques = m_NumWorkers + 1;
+    uint32_t begin = 0;
+    for(uint32_t d=0; d<num_deques; ++d)
+    {
+        uint32_t end = begin;
+        for(uint32_t i=d; i<count; i+=num_deques)
+            m_pOrder[end++] = sorted[i];
+
+        m_pDeques[d].range.store(((uint64_t)begin << 32) | end, std::memory_order_relaxed);
+        begin = end;
+    }
+
+    Run(function, context, count, true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::WorkerLoop(uint32_t worker_index)
+{
+    uint32_t generation = 0;
+    for(;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WorkAvailable.wait(lock, [&] {return m_Quit || m_Generation != generation;});
+            if (m_Quit)
+                return;
+            generation = m_Generation;
+        }
+
+        Execute(worker_index);
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (--m_NumBusy == 0)
+            m_WorkDone.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+inline void ThreadPool::Terminate()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Quit = true;
+    }
+    m_WorkAvailable.notify_all();
+
+    for(uint32_t i=0; i<m_NumWorkers; ++i)
+        m_pWorkers[i].join();
+
+    delete[] m_pWorkers;
+    delete[] m_pDeques;
+    delete[] m_pOrder;
+    m_pWorkers = nullptr;
+    m_pDeques = nullptr;
+    m_pOrder = nullptr;
+    m_OrderCapacity = 0;
+    m_NumWorkers = 0;
+}
+
+#endif
@@ -4,759 +4,653 @@
 #include <stdint.h>
 #include <stddef.h>
 
-static const size_t default_font_atlas_size = 32768;
+static const size_t default_font_atlas_size = 75264;
 static const uint8_t default_font_atlas[] =
 {
-    0xFF, 0x00, 0x49, 0x92, 0x98, 0x09, 0x91, 0x10, 0xFF, 0x00, 0x49, 0xC2, 0xE7, 0x78, 0x88, 0x87, 0xFF, 0x00, 0x49, 0x42, 0x27, 0x40, 0x0A, 0xA4, 0xFF, 0x00, 0x49, 0x52, 0x27, 0xC0, 0x03, 0x3C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xD2, 0x11, 0x78, 0xC0, 0xC4, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x96, 0x04, 0xFF, 0x00, 0x49, 0xC2, 0x26, 0x50, 0x02, 0x26, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x70, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x98, 0x21, 0x60, 0xA0, 0xFF, 0x00, 0x49, 0xA2, 0x31, 0x00, 0xF4, 0x0F, 0xC3, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xC5, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 
-    0xFF, 0x00, 0x49, 0xE2, 0x36, 0x42, 0x83, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x91, 0x03, 0xFF, 0x00, 0x49, 0xC2, 0x8D, 0x00, 0xB0, 0x7B, 
-    0xFF, 0x00, 0x49, 0xF2, 0x24, 0x70, 0x02, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xD3, 0x21, 0x10, 0x02, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x90, 0x21, 0x6A, 0x28, 0xFF, 0x00, 0x49, 0x92, 0x90, 0x89, 0x91, 0x64, 0xFF, 0x00, 0x49, 0xF2, 0x24, 0x4B, 0x82, 0x26, 0x46, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0xE0, 
-    0xF6, 0x00, 0x49, 0x92, 0x2A, 0x29, 0x92, 0x22, 0x2F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x28, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x21, 0x1A, 0xA2, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x95, 0x18, 0xFF, 0x00, 0x49, 0xE2, 0x24, 0x50, 0x02, 0x38, 0xFF, 0x00, 0x49, 0x62, 0x49, 0x05, 0x70, 0xDB, 
-    0xFF, 0x00, 0x49, 0x22, 0x49, 0x00, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0xD2, 0x24, 0x4D, 0xF4, 0x18, 0xFF, 0x00, 0x49, 0xE2, 0x24, 0xD0, 0x03, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0xA4, 0xC9, 0x91, 0x10, 0xFF, 0x00, 0x49, 0x52, 0x27, 0x70, 0xA2, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x91, 0x02, 0xFF, 0x00, 0x49, 0xD2, 0x49, 0x00, 0x00, 0xB6, 
-    0xFF, 0x00, 0x49, 0x32, 0x27, 0x80, 0x3E, 0x00, 0x31, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x12, 0x92, 0x07, 0xF0, 0x6D, 0xFF, 0x00, 0x49, 0x42, 0xF2, 0x00, 0x2E, 0xE0, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x10, 0xFF, 0x00, 0x49, 0x72, 0x4E, 0x00, 0x00, 0xB1, 0xFF, 0x00, 0x49, 0x32, 0x3E, 0x00, 0x48, 0x00, 0x81, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0xFF, 0x00, 0x49, 0x72, 0x92, 0x05, 0xE0, 0x6D, 0xFF, 0x00, 0x49, 0x42, 0x92, 0x00, 0xB0, 0x6D, 0xFF, 0x00, 0x49, 0x42, 0x92, 0x00, 0x30, 0x00, 0x22, 0x00, 0x49, 0xC2, 0x24, 0x48, 0xC2, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xC4, 0xC9, 0x91, 0x0C, 0xFF, 0x00, 0x49, 0x42, 0x36, 0x80, 0x02, 0x28, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x93, 0x29, 0x10, 0x42, 0xFF, 0x00, 0x49, 0x42, 0x92, 0x00, 0x20, 0x49, 0xFF, 0x00, 0x49, 0x42, 0x32, 0x00, 0x2E, 0xE9, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 0xFF, 0x00, 0x78, 0x8A, 0xA7, 0x78, 0x8C, 0xE7, 0xFF, 0x00, 0x50, 0x8C, 0xE5, 0x60, 0x82, 0x26, 0xFF, 0x00, 0x40, 0x02, 0x25, 0x50, 0xA2, 0x25, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x71, 0x1B, 0x01, 0xFF, 0x00, 0x06, 0x5E, 0x28, 0x83, 0x0A, 0x00, 0xFF, 0x00, 0x49, 0x90, 0x1C, 0x2D, 0x01, 0x00, 0xFF, 0x00, 0x68, 0x02, 0x27, 0x68, 0x0D, 0xA0, 
-    0xFF, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x94, 0x14, 0xFF, 0x00, 0x31, 0x35, 0x00, 0xC0, 0x06, 0xA7, 0xFF, 0x08, 0x58, 0x0F, 0x00, 0xA0, 0x80, 0x67, 0xFF, 0x00, 0x49, 0xC2, 0x24, 0x68, 0x02, 0x24, 
-    0xFF, 0x00, 0x43, 0x23, 0x3C, 0xC2, 0x43, 0x30, 0xF3, 0x00, 0x49, 0x94, 0x64, 0x49, 0x96, 0x1C, 0xFF, 0x00, 0x78, 0x02, 0x27, 0x70, 0x82, 0x27, 0xFF, 0x00, 0x09, 0x11, 0x03, 0x07, 0x2A, 0x30, 
-    0xD9, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x90, 0x42, 0x31, 0x90, 0x0C, 0xE9, 0x00, 0x49, 0x9E, 0xE4, 0x4E, 0xAA, 0x1C, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0x50, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x29, 0x94, 0x62, 0x31, 0x98, 0xA3, 0xE3, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x04, 
-    0xFF, 0x00, 0x43, 0x03, 0x3C, 0x58, 0x82, 0x26, 0x52, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0x22, 0x38, 0xC4, 0x62, 0x20, 0xFF, 0x00, 0x39, 0x90, 0x9C, 0x49, 0x92, 0x24, 
-    0xFE, 0x1F, 0xF5, 0x3C, 0x40, 0x91, 0xAA, 0x1D, 0xFF, 0x00, 0xC2, 0xC2, 0x26, 0x49, 0xE2, 0x24, 0xA6, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x21, 0x1A, 0xA2, 0x21, 0x3A, 0x41, 
-    0xA6, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xC7, 0x00, 0x49, 0x90, 0x24, 0x49, 0xB6, 0x84, 0xFF, 0x00, 0x80, 0x63, 0x25, 0x70, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xDE, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xD0, 0xE3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x10, 0x03, 0x19, 0x76, 0xC0, 0x74, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x9E, 0x64, 0xFF, 0x00, 0x07, 0x34, 0xE0, 0x40, 0x03, 0x3C, 0x1B, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xB1, 0x90, 0x18, 0x49, 0x96, 0xA4, 0xFF, 0x00, 0x4A, 0x82, 0x26, 0x50, 0x02, 0x3C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x31, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
-    0xFF, 0x00, 0x39, 0x10, 0x02, 0x19, 0x14, 0xAE, 0xC6, 0x00, 0x78, 0xE2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xB9, 0x90, 0x18, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x78, 0x82, 0x26, 0x60, 0x82, 0x26, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x5C, 0xB9, 0x70, 0x41, 0xFF, 0x00, 0x82, 0x0E, 0x3D, 0x7A, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x94, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x29, 0x70, 0x80, 0x82, 0x02, 0x3C, 0xFF, 0x00, 0x83, 0x42, 0x28, 0x84, 0x42, 0x28, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x11, 0x7A, 0xC0, 0x06, 0x42, 0x2C, 0x5F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x61, 0x06, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x09, 0x91, 0x10, 0x49, 0x91, 0x14, 0xFF, 0x00, 0x78, 0x82, 0x24, 0x48, 0x82, 0x24, 0x5A, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x58, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xE7, 0x00, 0x01, 0x90, 0xC4, 0x49, 0x9A, 0x64, 0xFF, 0x00, 0x80, 0x04, 0x3C, 0x40, 0x82, 0x25, 0xFF, 0x00, 0x12, 0x90, 0x00, 0x39, 0x10, 0x03, 0xF3, 0x00, 0x00, 0xDC, 0x24, 0x4E, 0x92, 0x24, 
-    0xFF, 0x00, 0xC9, 0x90, 0x08, 0xC9, 0x90, 0x14, 0xFF, 0x00, 0x4B, 0xCA, 0xA4, 0x4B, 0x0A, 0xA6, 0xFF, 0x00, 0x70, 0x0E, 0x27, 0x70, 0x02, 0x27, 0xFF, 0x00, 0x80, 0x63, 0x3F, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x07, 0x16, 0x0B, 0xC9, 0x9D, 0x24, 0xFF, 0x00, 0xAD, 0x00, 0x60, 0xAC, 0x93, 0x24, 0xFF, 0x00, 0x4C, 0x98, 0x14, 0x39, 0x10, 0x81, 0xFF, 0x00, 0x50, 0x82, 0x27, 0x4E, 0x92, 0x78, 
-    0xFB, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0xA8, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0xC9, 0x95, 0x84, 0xF9, 0x70, 0x61, 0xFF, 0x28, 0x18, 0x00, 0xC0, 0x00, 0x9C, 0x02, 
-    0x9D, 0x00, 0x48, 0x92, 0x24, 0x49, 0xC2, 0x24, 0xA6, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x38, 0x5A, 0x00, 0x09, 0x9A, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x91, 0x14, 0x09, 0x91, 0x10, 
-    0xFF, 0x00, 0x70, 0x82, 0x24, 0x4A, 0xA2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x07, 0x1C, 0x81, 0x19, 0x96, 0x61, 0x9F, 0x00, 0x49, 0x90, 0x84, 0x49, 0x92, 0x24, 
-    0xFA, 0x00, 0x78, 0xD6, 0xE4, 0x49, 0x92, 0x24, 0xF1, 0x00, 0x78, 0xB2, 0x27, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0xD0, 0x61, 0x21, 0x1A, 0xA2, 
-    0xFF, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0xD8, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 
-    0xFF, 0x00, 0x84, 0x22, 0x34, 0xC0, 0x83, 0x25, 0xB9, 0x00, 0x49, 0x96, 0x44, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x40, 0x02, 0x25, 0x58, 0x02, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x3F, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0xC4, 0xFF, 0x00, 0x80, 0x03, 0x34, 0x40, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x31, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x91, 0x0C, 0x29, 0x60, 0x60, 0xFF, 0x00, 0x70, 0x82, 0x24, 0x4D, 0x92, 0x24, 
-    0x4A, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x9A, 0x24, 0xFF, 0x00, 0x02, 0x08, 0x00, 0x2D, 0x97, 0x24, 0xFF, 0x00, 0x4E, 0x02, 0x3D, 0x00, 0x6C, 0x40, 0x09, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0xFF, 0x00, 0x89, 0x91, 0x0B, 0x19, 0x50, 0xC0, 0xFF, 0x00, 0x68, 0xB2, 0x24, 0x4F, 0x92, 0x24, 0xFF, 0x00, 0x84, 0x42, 0x28, 0x84, 0x42, 0x28, 0x4C, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x90, 0x24, 
-    0xFF, 0x00, 0xC2, 0x04, 0x00, 0xC0, 0xEE, 0x26, 0xFF, 0x00, 0x00, 0xA0, 0x09, 0x49, 0x9C, 0x24, 0xFF, 0x00, 0x6A, 0x02, 0x30, 0x02, 0x7C, 0x40, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x91, 0x18, 0xC9, 0x9B, 0x24, 0xDA, 0x00, 0x48, 0xA2, 0x24, 0x4D, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x6F, 0x45, 0x00, 0x93, 0x90, 0x14, 0xFF, 0x00, 0x58, 0x0B, 0x00, 0x90, 0x84, 0x24, 0xFF, 0x1D, 0x1E, 0x00, 0x00, 0x02, 0x14, 0xE0, 0xFF, 0x00, 0xAD, 0x03, 0x30, 0x92, 0x93, 0x24, 
-    0xD6, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x34, 0x00, 0x79, 0x95, 0xA4, 0xFF, 0x00, 0x70, 0x02, 0x88, 0x00, 0x80, 0x12, 0xFF, 0x00, 0x49, 0xF2, 0x24, 0x68, 0x02, 0x3C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xA4, 0xC9, 0x91, 0x08, 0xFF, 0x00, 0x84, 0x02, 0x3C, 0x70, 0xC2, 0x24, 0xFF, 0x00, 0x29, 0x70, 0xA0, 0xC6, 0x42, 0x34, 
-    0xFF, 0x00, 0x12, 0x90, 0x58, 0x49, 0x9A, 0xC4, 0xFF, 0x00, 0x4C, 0x02, 0xA7, 0x60, 0x86, 0x65, 0xFF, 0x00, 0xC2, 0x02, 0x3C, 0x58, 0x02, 0x25, 0xFF, 0x00, 0x09, 0x91, 0x64, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x70, 0x0E, 0xDD, 0x82, 0x78, 0x01, 0xFF, 0x00, 0xC0, 0x03, 0x24, 0x50, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x90, 0x0C, 0xC9, 0x90, 0x10, 
-    0xD4, 0x00, 0x4A, 0xA2, 0x24, 0x4A, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x14, 0x42, 0x21, 0x94, 0x61, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x1A, 0xA2, 0xA9, 0x9A, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x91, 0x14, 0x89, 0x10, 0x03, 
-    0xFF, 0x00, 0x70, 0xA2, 0x24, 0x4C, 0xF2, 0x24, 0xA1, 0x00, 0x49, 0x90, 0x64, 0x49, 0x9A, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x80, 0x23, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xED, 0x00, 0x49, 0x9E, 0xC4, 0x49, 0x98, 0x1C, 0xFF, 0x00, 0x40, 0x03, 0x38, 0x40, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x31, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
-    0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x49, 0x9A, 0x10, 0x19, 0x30, 0x80, 0xFF, 0x00, 0x80, 0x82, 0x25, 0x4B, 0x92, 0x24, 0x27, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x64, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x9B, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x29, 0x90, 0x03, 0x09, 0x10, 0x03, 0xFF, 0x00, 0x4E, 0xCE, 0x64, 0xCC, 0xD1, 0x1C, 
-    0xFF, 0x00, 0xC0, 0x02, 0x25, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x84, 0x42, 0x28, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x88, 0x84, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x63, 0x02, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x90, 0x02, 0x29, 0x90, 0x01, 0x2E, 0x00, 0x4D, 0x82, 0x24, 0x4A, 0xF2, 0x24, 
-    0xFF, 0x00, 0x49, 0x9E, 0x0C, 0x09, 0x90, 0x0C, 0xFF, 0x00, 0x4F, 0x82, 0x27, 0x60, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x09, 0x91, 0x08, 0x09, 0x10, 0x03, 0xBF, 0x00, 0x48, 0xB2, 0x24, 0x4D, 0xE2, 0x24, 0xFF, 0x00, 0x06, 0x4E, 0x28, 0xC3, 0x22, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x89, 0x94, 0x08, 0xCA, 0x00, 0x49, 0x98, 0x84, 0x4C, 0x88, 0x84, 0xFF, 0x00, 0x70, 0x0E, 0x27, 0x70, 0x02, 0xE7, 0xFF, 0x00, 0x00, 0x33, 0x2C, 0xC3, 0x02, 0x34, 
-    0xE1, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x1C, 0xFF, 0x00, 0x19, 0x56, 0xE8, 0x80, 0x83, 0x26, 0x04, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x05, 0x73, 0xE0, 0x21, 0x90, 0x14, 
-    0xFF, 0x00, 0x49, 0x9C, 0x5C, 0x9B, 0x00, 0x60, 0xFF, 0x00, 0x58, 0x88, 0xC6, 0x4A, 0xF2, 0x24, 0xFF, 0x00, 0xC0, 0x03, 0xC8, 0x05, 0x10, 0x0F, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x90, 0x00, 0x00, 
-    0xFF, 0x00, 0x39, 0xE0, 0x01, 0x00, 0x28, 0x3E, 0xFF, 0x00, 0x48, 0x02, 0x26, 0x40, 0x53, 0xC0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x91, 0x18, 0xC9, 0x91, 0x44, 
-    0xFF, 0x00, 0x4A, 0x82, 0x27, 0x70, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x19, 0x16, 0xA0, 0x07, 0x6C, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x16, 0xA0, 0x05, 0x22, 0x30, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x05, 0x1A, 0x01, 0xB9, 0x90, 0x84, 0xFF, 0x00, 0x49, 0xC2, 0x27, 0x00, 0x20, 0x00, 
-    0xFF, 0x00, 0xC9, 0xE0, 0x01, 0x00, 0x06, 0x35, 0xFD, 0x00, 0x70, 0xC2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x31, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
-    0xFF, 0x00, 0xC9, 0x15, 0x0B, 0x11, 0x10, 0x01, 0xFF, 0x00, 0x40, 0x83, 0xB5, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x52, 0x27, 0x58, 0x82, 0x25, 
-    0xFF, 0x00, 0x82, 0x52, 0x40, 0x21, 0x90, 0x54, 0xFF, 0x00, 0x49, 0xE2, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x19, 0x30, 0x60, 0xC0, 0xA2, 0x26, 0x43, 0x00, 0xCC, 0x91, 0x24, 0x49, 0x92, 0x24, 
-    0x43, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x43, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x83, 0x4C, 0x28, 0x84, 0x42, 0x28, 0x61, 0x00, 0x4B, 0x90, 0xE4, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x40, 0x23, 0xA0, 0x06, 0x90, 0x0F, 0xFF, 0x00, 0x49, 0xF2, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x06, 0x06, 0xE0, 0x80, 0xB3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x4B, 0x00, 0xC9, 0x91, 0x24, 0x49, 0x92, 0x24, 0x27, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x91, 0x64, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xD8, 0x0B, 0x00, 0x15, 0x90, 0x84, 0xFF, 0x00, 0x70, 0x05, 0x00, 0x00, 0x06, 0x27, 0xFF, 0x00, 0xD0, 0x03, 0x27, 0x4F, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0A, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0x42, 0x00, 0x82, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x08, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x04, 0x98, 0x24, 0x49, 0x92, 0x24, 
-    0x02, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x80, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x50, 0x02, 0x3C, 0x03, 0x73, 0xE0, 0xDA, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 0xFF, 0x00, 0xC3, 0x02, 0x38, 0x50, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x19, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0x25, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x44, 0x00, 0x04, 0x98, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x49, 0x00, 0xC2, 0x9E, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x21, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x22, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 
-    0x6F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x1C, 0xC6, 0x00, 0x49, 0x98, 0xC4, 0x49, 0x22, 0x40, 0xFF, 0x00, 0x70, 0xD2, 0x27, 0x49, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xB5, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x13, 0xCF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0xAC, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xCE, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x14, 
-    0xAA, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0xCE, 0x00, 0x49, 0x92, 0x24, 0x49, 0x52, 0xE8, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x59, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
-    0xFF, 0x00, 0x29, 0x98, 0xB4, 0x49, 0xD2, 0xD6, 0xFF, 0x00, 0x49, 0x91, 0xB4, 0x49, 0x92, 0x24, 0x9E, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xCD, 0x00, 0x49, 0x92, 0x24, 0x49, 0x22, 0x40, 0x59, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x08, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xCD, 0x00, 0x49, 0x92, 0x24, 0x49, 0xE2, 0x09, 0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0xCD, 
-    0x05, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x80, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x08, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0xCD, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x79, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x18, 
-    0xC6, 0x00, 0x49, 0x92, 0x24, 0x49, 0x22, 0x40, 0x75, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x22, 0x00, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x60, 0x3D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x01, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0xD2, 0x08, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
-    0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x82, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x94, 0x10, 0x31, 0x70, 0x41, 0xFF, 0x00, 0xC0, 0x03, 0x27, 0x4C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x02, 0x40, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x20, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x20, 0x09, 0xC9, 0x90, 0x03, 0xFF, 0x00, 0x78, 0x82, 0x27, 0x4A, 0xD2, 0xE4, 
-    0xFF, 0x00, 0xA9, 0x60, 0x00, 0x82, 0x02, 0x38, 0xFF, 0x00, 0x00, 0xC0, 0x96, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0x03, 0xC0, 0x17, 0x94, 0x02, 0xFF, 0x00, 0x49, 0x92, 0xA4, 0xC9, 0xF1, 0x10, 
-    0xFF, 0x00, 0x05, 0x00, 0x60, 0xD0, 0x03, 0x27, 0xFF, 0x00, 0x00, 0x50, 0x0A, 0x49, 0x9A, 0x24, 0xFF, 0x00, 0x7B, 0x02, 0x3D, 0xC0, 0x42, 0xE0, 0xFF, 0x00, 0x09, 0x90, 0x08, 0xC9, 0x99, 0x24, 
-    0xFF, 0x00, 0x60, 0x82, 0x26, 0x4D, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x28, 0xA0, 0x67, 0x93, 0x24, 0x72, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x18, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x39, 0x25, 0x00, 
-    0xFF, 0x00, 0x49, 0x6C, 0x0A, 0x00, 0x80, 0x35, 0xFF, 0x00, 0x54, 0x00, 0x65, 0x73, 0x92, 0x24, 0xFF, 0x00, 0x00, 0xB0, 0x6D, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0xB0, 0x6D, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0xB4, 0x8D, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x1D, 0x00, 0xE9, 0x90, 0xE4, 0xFF, 0x00, 0x49, 0x22, 0x3E, 0x00, 0xD4, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x7D, 0x02, 0xAC, 
-    0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0xE4, 0xFF, 0x00, 0xB9, 0x70, 0x01, 0x04, 0x2A, 0x2C, 0xFF, 0x00, 0x00, 0xB0, 0x52, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xD0, 0x03, 0x28, 0x04, 0x1A, 0x60, 
-    0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xFF, 0x00, 0x49, 0xF5, 0x41, 0x02, 0x83, 0x26, 0xFF, 0x00, 0x80, 0xD6, 0x27, 0x49, 0x92, 0xDC, 0xFF, 0x00, 0x12, 0x90, 0xBC, 0x49, 0xF2, 0x24, 
-    0xFF, 0x00, 0x6A, 0x22, 0xEC, 0x21, 0x94, 0x14, 0xB6, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x91, 0x0C, 0x09, 0x90, 0x02, 
-    0xFF, 0x00, 0x80, 0x03, 0x30, 0x02, 0x52, 0xC0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x00, 0xA0, 0x6D, 0x4B, 0xB2, 0x24, 
-    0xFF, 0x00, 0x00, 0xB0, 0x01, 0x49, 0x98, 0x24, 0xFF, 0x00, 0x7B, 0x02, 0x3C, 0xC0, 0x32, 0x20, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x95, 0x0C, 0xFF, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x8F, 0x26, 
-    0xFF, 0x00, 0x00, 0x30, 0x4E, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x03, 0x40, 0x1F, 0x90, 0x0C, 0xFF, 0x00, 0x49, 0xF2, 0x24, 0x4B, 0x82, 0x26, 0xFF, 0x00, 0x02, 0x20, 0x40, 0xC2, 0x22, 0x2C, 
-    0xFF, 0x00, 0x00, 0x20, 0x09, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x0F, 0x40, 0x27, 0x90, 0x18, 0xFF, 0x00, 0x49, 0xE2, 0x24, 0x70, 0x02, 0x3D, 0xFF, 0x00, 0x11, 0x10, 0x01, 0x11, 0x16, 0x61, 
-    0xFF, 0x00, 0x00, 0x20, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x20, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x8D, 0xE0, 0x08, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x49, 0x4B, 0xB2, 0x24, 
-    0xFF, 0x00, 0x00, 0x20, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x70, 0x22, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0xA4, 0xC9, 0x91, 0x0C, 0xFF, 0x23, 0x03, 0x02, 0x8C, 0x00, 0x00, 0xB0, 0xFF, 0x00, 0x49, 0x32, 0x3A, 0x00, 0xD4, 0x01, 0xF4, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x27, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x21, 0x14, 0x80, 0x05, 0x2E, 0x2C, 0x11, 0x00, 0x4C, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x80, 0x23, 0x30, 0x05, 0x98, 0x02, 0xFE, 0x00, 0x49, 0x92, 0x24, 0x49, 0x0E, 0x09, 0xFF, 0x00, 0x31, 0x10, 0x42, 0x04, 0x0A, 0x34, 0xFF, 0x00, 0x8F, 0x90, 0x08, 0x89, 0x90, 0x0C, 
-    0xE8, 0x00, 0x4A, 0xB2, 0x24, 0x4B, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x08, 0x07, 0x1A, 0x80, 0x01, 0x68, 0xA0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x19, 0x10, 0x40, 0x01, 0x90, 0x57, 0xFF, 0x00, 0xC0, 0xDA, 0x24, 0x98, 0x03, 0x00, 
-    0xAB, 0x00, 0x4F, 0x92, 0x24, 0x49, 0x02, 0x26, 0xF3, 0x00, 0x49, 0x92, 0x04, 0x49, 0x90, 0xE4, 0xFF, 0x00, 0x49, 0x02, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x49, 0x02, 0x00, 0x00, 0xF0, 0xFF, 
-    0xFF, 0x00, 0x49, 0x02, 0x40, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF9, 0x00, 0xC9, 0x9B, 0x24, 0x49, 0x92, 0x0E, 0xFF, 0x00, 0x03, 0x90, 0x17, 0x1D, 0x00, 0x60, 
-    0xFF, 0x00, 0x60, 0x0E, 0x25, 0x50, 0xD2, 0x27, 0xFF, 0x00, 0x40, 0xF3, 0x27, 0x49, 0x92, 0x24, 0x31, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x06, 0x2A, 0x28, 
-    0xFF, 0x00, 0x49, 0x91, 0x48, 0x31, 0x1A, 0xE2, 0xC2, 0x00, 0x4B, 0x92, 0xC4, 0x49, 0x90, 0x44, 0xFF, 0x00, 0x16, 0x00, 0x8C, 0x70, 0xB2, 0x24, 0xFF, 0x00, 0xC0, 0x4E, 0x41, 0x89, 0x90, 0x10, 
-    0xA4, 0x00, 0x49, 0x90, 0xE4, 0x4C, 0xA2, 0x24, 0xFF, 0x00, 0x70, 0x82, 0x25, 0xC3, 0x53, 0x38, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x19, 0x76, 0xA0, 0x05, 0x2E, 0x2C, 
-    0xFF, 0x00, 0x11, 0x16, 0x02, 0x39, 0x90, 0x0C, 0xCA, 0x00, 0x49, 0xF2, 0x24, 0x4C, 0x82, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xC6, 0x00, 0x4A, 0xA2, 0x24, 0x4A, 0x82, 0xB6, 
-    0xF5, 0x00, 0x49, 0x92, 0x24, 0x49, 0xEE, 0x12, 0xFF, 0x00, 0x04, 0x32, 0x28, 0x00, 0x03, 0x3D, 0xFF, 0x00, 0x39, 0x90, 0x02, 0x19, 0x10, 0x61, 0xBB, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFB, 0x00, 0xC9, 0x91, 0xA4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x58, 0xD2, 0x26, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5F, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x23, 0x28, 0x05, 0x6E, 0xC0, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x11, 0x16, 0x41, 
-    0x6B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x6B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x80, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xB4, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0xFF, 
-    0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x31, 0x10, 0x02, 0x11, 0x14, 0x61, 0xD8, 0x00, 0x78, 0xE2, 0x24, 0x49, 0x92, 0x24, 0xFB, 0x00, 0x89, 0x91, 0x84, 0x49, 0x9E, 0x24, 0xFF, 0x00, 0x50, 0x02, 0x38, 0x40, 0x03, 0x30, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x9C, 0x64, 0xC9, 0x91, 0x0C, 0xFF, 0x00, 0x80, 0x03, 0x25, 0x68, 0xA2, 0x24, 0x94, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 
-    0xFF, 0x00, 0xB1, 0x50, 0x40, 0x00, 0x03, 0x25, 0xFF, 0x00, 0x00, 0xC0, 0x96, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x90, 0x23, 0x80, 0x21, 0x90, 0x08, 0xFF, 0x00, 0x49, 0x91, 0x44, 0x4F, 0xCE, 0x24, 
-    0xFF, 0x00, 0x60, 0x02, 0xF0, 0x02, 0x70, 0x0A, 0xFF, 0x00, 0x49, 0x92, 0x58, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x0E, 0x2C, 0xC0, 0x83, 0x26, 0xFF, 0x00, 0x49, 0x9C, 0x0C, 0x09, 0x90, 0x0C, 
-    0xFF, 0x00, 0x4F, 0x02, 0x27, 0x60, 0x02, 0x27, 0xFF, 0x00, 0xF1, 0x33, 0xE0, 0x00, 0x48, 0x80, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xA7, 0x90, 0xC4, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x46, 0x01, 0x89, 0x99, 0x24, 0xFF, 0x00, 0x4E, 0x02, 0x25, 0x50, 0x12, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x17, 0x00, 0x81, 0x18, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xF1, 0x4E, 0x92, 0x24, 0xD2, 0x00, 0xE0, 0x93, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x11, 0x03, 0x07, 0x36, 0x2C, 0xFF, 0x00, 0xD0, 0xA3, 0x27, 0x49, 0x92, 0x24, 
-    0xFB, 0x00, 0x19, 0x12, 0x29, 0x91, 0x92, 0x21, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x1C, 0xFF, 0x00, 0x89, 0x4B, 0x00, 0x50, 0x8D, 0x27, 0xFF, 0x00, 0xE5, 0x00, 0x00, 0x4F, 0x91, 0x10, 
-    0xB7, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x00, 0x46, 0x73, 0x34, 0x46, 0x53, 0x38, 0xFF, 0x00, 0x49, 0x9C, 0x84, 0x49, 0x90, 0x18, 0xFF, 0x00, 0x80, 0x03, 0x25, 0x60, 0x02, 0x6D, 
-    0xFF, 0x00, 0x49, 0x91, 0x04, 0x49, 0xB6, 0x4D, 0xFF, 0x00, 0x78, 0x02, 0x26, 0x50, 0x02, 0x38, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x49, 0x4B, 0xB2, 0x24, 
-    0xFF, 0x00, 0x00, 0x20, 0x01, 0x49, 0x9A, 0x24, 0xFF, 0x00, 0x4B, 0x82, 0x25, 0xC0, 0x42, 0xE0, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x11, 0x14, 0x02, 0x1A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x11, 0x07, 0x7A, 0xC0, 0x06, 0x4C, 0x20, 0xFF, 0x00, 0x11, 0x10, 0x01, 0x11, 0x16, 0x61, 
-    0xFF, 0x00, 0x00, 0x20, 0x49, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x28, 0xA9, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xBF, 0x24, 
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x11, 0x96, 0x01, 0x31, 0x90, 0x0C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x3D, 0xFF, 0x00, 0x49, 0x9E, 0xC4, 0x49, 0x74, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0x38, 0x40, 0x82, 0x26, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x39, 0x10, 0x02, 0x11, 0x58, 0xE0, 0x7F, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0x49, 0x90, 0x04, 0x49, 0x96, 0xE4, 
-    0xFF, 0x00, 0x58, 0x02, 0x25, 0x80, 0x03, 0x80, 0x22, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x1F, 0xFF, 0x00, 0xC9, 0x90, 0x08, 0x31, 0x40, 0x00, 0xC3, 0x00, 0x48, 0x82, 0x24, 0x4B, 0xF2, 0x24, 
-    0x54, 0x00, 0x49, 0x9A, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x3F, 0x10, 0x41, 0x04, 0x0C, 0x30, 0xC0, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0x3D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0x1F, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF0, 0x00, 0x39, 0x5C, 0x30, 0x76, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x42, 0x53, 0x3E, 0x77, 0x02, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x21, 0x1C, 0x83, 0x89, 0x90, 0x14, 0xFF, 0x00, 0x89, 0x91, 0x1C, 0x4F, 0xB8, 0x24, 0xFF, 0x00, 0x4A, 0x82, 0x26, 0x00, 0x60, 0x6E, 0xFF, 0x00, 0x89, 0xE0, 0x09, 0xD0, 0xD7, 0x24, 
-    0xFF, 0x00, 0x4B, 0xA2, 0xA4, 0x90, 0xC0, 0xAD, 0xFF, 0x00, 0x53, 0x82, 0x26, 0x4B, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x90, 0x03, 0x29, 0x90, 0x41, 0xFF, 0x00, 0x00, 0xB0, 0xB6, 0x4F, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x33, 0x20, 0x06, 0x1A, 0x61, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xBC, 0x00, 0x4A, 0xA2, 0x24, 0x4A, 0x02, 0xDB, 
-    0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0x62, 0x17, 0xFF, 0x00, 0x06, 0x6C, 0xC0, 0x03, 0x0E, 0x2C, 0xFF, 0x00, 0x31, 0x90, 0x08, 0x49, 0x91, 0x64, 0xFF, 0x00, 0x4D, 0x82, 0x27, 0xD0, 0x03, 0x80, 
-    0x5A, 0x00, 0x49, 0x92, 0x24, 0x49, 0xA2, 0x12, 0xFF, 0x00, 0x49, 0x96, 0x18, 0x31, 0x30, 0x00, 0xFF, 0x00, 0x52, 0x82, 0x25, 0x78, 0xD2, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0xCC, 
-    0x77, 0x00, 0x49, 0x92, 0x24, 0x49, 0xB2, 0x0D, 0xFF, 0x00, 0x49, 0x9E, 0x64, 0xF9, 0x30, 0x00, 0xFF, 0x00, 0xC0, 0x02, 0x38, 0x58, 0xB2, 0x24, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x11, 0x16, 0x61, 
-    0x54, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x54, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0xF0, 0x08, 0xA8, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xC2, 0x00, 0xC9, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x50, 0x01, 0xC9, 0x9D, 0x24, 0xFF, 0x00, 0x00, 0x00, 0xC8, 0x7E, 0x92, 0x24, 0x8A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x46, 0x00, 0x49, 0x92, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x02, 0x38, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x06, 0x90, 0x13, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x9F, 0x24, 0xFF, 0x00, 0x00, 0x0C, 0x3E, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC9, 0x91, 0x08, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0x82, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7E, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x2C, 0x77, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xAE, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x60, 0x22, 0xEC, 0x19, 0x90, 0x58, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x74, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x89, 0x07, 0x00, 
-    0xFC, 0x00, 0x49, 0xF2, 0x26, 0xC0, 0xB3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x07, 0x4A, 0xE0, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x90, 0x03, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x8F, 0xD0, 0x08, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x00, 0x68, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xD0, 0xD3, 0x24, 0x49, 0x92, 0x24, 0x03, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x04, 0x90, 0x0F, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x9F, 0x24, 0xFF, 0x00, 0x00, 0x2C, 0x3E, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x02, 0x20, 0x00, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x00, 0x40, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0xB8, 0x3E, 0x49, 0x92, 0x24, 0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x10, 0x01, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x8D, 0xD0, 0x08, 0x49, 0x92, 0x24, 0xA8, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x7B, 0x02, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x9B, 0x06, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x7C, 0x02, 0xEC, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xA5, 0x23, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x04, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0xE4, 0x03, 0x38, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xA5, 0x23, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x21, 0x1D, 0x80, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x29, 0x1D, 0x61, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD6, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0xA4, 0x03, 0x3C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xA5, 0x23, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x65, 0x23, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF8, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x6C, 0x0A, 0x45, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x6C, 0x02, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xDE, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x04, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x74, 0x02, 0x26, 0xAA, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x1C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xEF, 0x04, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x5A, 0x0F, 0x00, 
-    0x9A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x99, 0x08, 0xFF, 0x00, 0x2F, 0x97, 0x24, 0x24, 0x09, 0x00, 0xFF, 0x00, 0xA4, 0x9F, 0x24, 0x6C, 0x0F, 0x00, 
-    0xBA, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xC9, 0xFB, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x93, 0x06, 0x00, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x25, 0x29, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x24, 0x0B, 0x00, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x7E, 0x02, 0xC8, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x0B, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x9C, 0x06, 0x00, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x7C, 0x02, 0x30, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x89, 0x99, 0x0C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x24, 0x09, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x24, 0x09, 0x00, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x24, 0x09, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x99, 0x00, 0x87, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x39, 0x99, 0x02, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x8F, 0xF9, 0x14, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x21, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x65, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x9E, 0x44, 0x09, 0x91, 0x03, 0xFF, 0x00, 0x02, 0x00, 0xF0, 0x68, 0xB2, 0x24, 0xBC, 0x00, 0x90, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x74, 0x02, 0x09, 0x91, 0x04, 
-    0xFF, 0x00, 0x4F, 0xA2, 0x24, 0x68, 0x02, 0x25, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x11, 0x16, 0x61, 0x1D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0xC9, 0x90, 0x02, 0x06, 0x26, 0xE8, 
-    0xFE, 0x00, 0x70, 0xC2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x6E, 0x03, 0x32, 0x60, 0x03, 0x30, 0x00, 0xA8, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x91, 0x08, 0x31, 0x90, 0x01, 
-    0xFF, 0x00, 0x50, 0x04, 0x45, 0x50, 0x04, 0x45, 0xFF, 0x14, 0x80, 0x02, 0x80, 0x00, 0x80, 0x0D, 0xE7, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x27, 0xDE, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0xE6, 0xFF, 0x00, 0xB9, 0x70, 0x01, 0x04, 0x0A, 0x2C, 0xFF, 0x00, 0xC0, 0xC8, 0x27, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x13, 0x90, 0x7C, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xD0, 0x03, 0x28, 0x04, 0x18, 0x01, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xE9, 0x00, 0x90, 0xB4, 0x24, 0x4B, 0xB2, 0x24, 0xFF, 0x00, 0x13, 0x90, 0x9C, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xD0, 0x03, 0x30, 0x02, 0x52, 0xC0, 0xFF, 0x00, 0x49, 0x9E, 0x5C, 0x09, 0x91, 0x03, 0xFF, 0x00, 0x02, 0x00, 0xF0, 0x68, 0xB2, 0x24, 0xCB, 0x00, 0x90, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0xF4, 0x01, 0x09, 0x91, 0x44, 0xFF, 0x00, 0x4F, 0xA2, 0x24, 0x60, 0x02, 0x24, 0xFF, 0x00, 0x82, 0x26, 0x2C, 0xC2, 0x22, 0x2C, 0xCB, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x90, 0x02, 0x09, 0x91, 0x18, 0xFF, 0x00, 0x4E, 0xA2, 0x24, 0x70, 0x82, 0x26, 0xFF, 0x00, 0x11, 0x40, 0xA0, 0x82, 0x22, 0x30, 0xCB, 0x00, 0x18, 0x97, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x02, 0x18, 0x01, 0x31, 0x90, 0xD8, 0xCB, 0x00, 0x09, 0x91, 0x24, 0x4E, 0xF2, 0x24, 0xCE, 0x00, 0x00, 0x90, 0xE4, 0x49, 0x9E, 0xE4, 0xFF, 0x00, 0x80, 0x04, 0x34, 0x40, 0x03, 0x34, 
-    0xCB, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x87, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0xF0, 0x00, 0x4F, 0xF0, 0x84, 0x4F, 0xFC, 0x24, 0xFF, 0x00, 0x58, 0x02, 0x3C, 0x40, 0x23, 0x28, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x98, 0x44, 0x89, 0x91, 0x0C, 0xFF, 0x00, 0xC0, 0x83, 0x25, 0x68, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x01, 0x11, 0x14, 0x61, 0x49, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xF9, 0x9F, 0x02, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 
-    0xFF, 0x00, 0x4F, 0x92, 0x24, 0x7F, 0x02, 0x3C, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0x82, 0x28, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x24, 0x09, 0x00, 0xFF, 0x00, 0x49, 0x9E, 0xE4, 0x24, 0x09, 0x00, 
-    0xFF, 0x00, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xFF, 0x00, 0x11, 0x16, 0x61, 0x11, 0x16, 0x61, 0xFF, 0x00, 0x49, 0x94, 0x10, 0x29, 0x70, 0x00, 0xFF, 0x00, 0xC0, 0x83, 0x26, 0x4A, 0x82, 0x26, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x12, 0xC2, 0x20, 0x54, 0x42, 0x2B, 0x30, 0xFF, 0x00, 0x78, 0x82, 0x26, 0x50, 0x02, 0x38, 0x55, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x0E, 0x01, 0x56, 0xA8, 0x42, 0x0B, 0x84, 
-    0xFF, 0x00, 0x50, 0x04, 0x45, 0x50, 0x04, 0x45, 0xFF, 0x00, 0xD8, 0x81, 0xA5, 0x58, 0x82, 0x25, 0xFF, 0x00, 0x60, 0x02, 0x38, 0x82, 0x72, 0x80, 0xDE, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x60, 0x0A, 0x66, 0x60, 0x04, 0x46, 0xFF, 0x00, 0x80, 0x03, 0x24, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x03, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x8D, 0xC0, 0x08, 0x8B, 0xA0, 0x08, 0xA8, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xC4, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x18, 
-    0xFF, 0x00, 0x05, 0x4C, 0xE0, 0x02, 0x02, 0x30, 0xFF, 0x00, 0x29, 0x90, 0x01, 0x11, 0x16, 0x61, 0x45, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x62, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x03, 0x30, 0xC2, 0x22, 0x28, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x88, 0x99, 0x00, 0x49, 0x92, 0x24, 0x49, 0x22, 0x09, 
-    0xFF, 0x00, 0x89, 0x91, 0x14, 0x31, 0x30, 0x00, 0xFF, 0x00, 0x68, 0x02, 0x27, 0x4A, 0xE2, 0x24, 0xFF, 0x00, 0x83, 0x52, 0x80, 0x11, 0x90, 0x0F, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x58, 0x0D, 0x00, 
-    0xF2, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x3D, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x10, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0x87, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0x2E, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x00, 0x05, 0x7C, 0x80, 0x19, 0x10, 0x03, 0x60, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 
-    0xFF, 0x00, 0x09, 0x90, 0x02, 0x19, 0x74, 0xA0, 0x9C, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x11, 0x16, 0x41, 0x21, 0x10, 0x03, 0x73, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xFF, 0x00, 0x29, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0xC4, 0x49, 0x9C, 0x84, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xFF, 0x00, 0x82, 0x26, 0x2C, 0xC2, 0x22, 0x2C, 0xC8, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xD1, 0x00, 0x00, 0x90, 0xC4, 0x49, 0x9C, 0xC4, 
-    0xFF, 0x00, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x52, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xFF, 0x00, 0x11, 0x16, 0x01, 0x11, 0x10, 0x01, 0xFF, 0x00, 0x82, 0x04, 0xB8, 0x68, 0xB2, 0x24, 0xFF, 0x00, 0x50, 0x02, 0x30, 0x03, 0x7E, 0x60, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x02, 0x23, 0x30, 0x02, 0x23, 0x30, 0xFF, 0x00, 0xC4, 0x62, 0xE0, 0x11, 0x98, 0x42, 0xFF, 0x00, 0x49, 0x96, 0x1C, 0x09, 0x91, 0x00, 0xFF, 0x00, 0x60, 0x88, 0x87, 0x4A, 0xD8, 0x84, 
-    0xFF, 0x00, 0x50, 0x04, 0x45, 0x50, 0x04, 0x45, 0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0xFF, 0x00, 0x29, 0x90, 0x08, 0xC9, 0x91, 0x84, 0xFF, 0x00, 0x4E, 0xA4, 0x44, 0x60, 0x04, 0x58, 
-    0xFF, 0x00, 0x60, 0x04, 0x46, 0x60, 0x08, 0xC6, 0xFF, 0x00, 0x58, 0x02, 0x25, 0xC0, 0x03, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x90, 0x00, 0x31, 0x10, 0x02, 0xFF, 0x00, 0x8B, 0xB0, 0x08, 0x8D, 0xF0, 0x08, 0xFF, 0x00, 0x90, 0x04, 0x00, 0x6A, 0xBB, 0x24, 0xFF, 0x00, 0x02, 0x00, 0x00, 0xAD, 0x93, 0x24, 
-    0xFF, 0x00, 0x50, 0xC2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x16, 0x41, 0x21, 0x10, 0x03, 0x80, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xF9, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x4B, 0x8C, 0x85, 0xFF, 0x00, 0xC2, 0x02, 0x2C, 0x40, 0x03, 0x3C, 0xFF, 0x00, 0x02, 0x20, 0x68, 0xC2, 0x22, 0x2C, 0xFF, 0x00, 0x00, 0xB0, 0x4D, 0x49, 0x9C, 0x24, 
-    0xFF, 0x00, 0x80, 0x0C, 0x3C, 0x00, 0x33, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2A, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x1C, 0x90, 0xC4, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x00, 0x4A, 0x00, 0x31, 0x90, 0x08, 0xB6, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x24, 0x10, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x08, 0xB8, 0x00, 0x4B, 0xB2, 0x24, 0x4A, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x02, 0x29, 0x10, 0x02, 0x2E, 0x00, 0x48, 0x82, 0x24, 0x4A, 0xC2, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x10, 0xC9, 0x91, 0x44, 0xFF, 0x00, 0x4B, 0x82, 0x27, 0x60, 0x0C, 0x85, 
-    0xFF, 0x00, 0x04, 0x2E, 0x2C, 0x80, 0x03, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x90, 0x14, 0x49, 0x98, 0x24, 0xFF, 0x00, 0x7A, 0x02, 0x3D, 0x00, 0x48, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xFE, 0x0D, 0x00, 0xFF, 0x00, 0x49, 0x94, 0x0F, 0x05, 0x04, 0xE8, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0xFF, 0x00, 0x05, 0x62, 0xA0, 0x11, 0x10, 0x03, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xFD, 0x0B, 0x00, 
-    0xFF, 0x00, 0x07, 0x5A, 0xC0, 0x80, 0x02, 0x38, 0xFF, 0x00, 0x11, 0x14, 0x61, 0x11, 0x16, 0x61, 0x0A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x90, 0x08, 0x49, 0x91, 0x44, 
-    0xFF, 0x00, 0x4E, 0xA2, 0x24, 0x60, 0x02, 0x3C, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x2C, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xB6, 0x0D, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xB6, 0x03, 0x28, 
-    0xFF, 0x00, 0x02, 0x23, 0x30, 0x02, 0x23, 0x30, 0xFF, 0x00, 0x09, 0x90, 0x10, 0xC9, 0x91, 0x44, 0xFF, 0x00, 0x2E, 0x30, 0x81, 0x00, 0x0E, 0x2C, 0x97, 0x00, 0x4F, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x50, 0x04, 0x45, 0x50, 0x04, 0x45, 0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x06, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x82, 0x74, 0x00, 0x21, 0x90, 0x08, 
-    0xFF, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xFF, 0x00, 0x02, 0x6E, 0x40, 0x21, 0x90, 0x14, 0xFF, 0x00, 0x49, 0xF2, 0x24, 0xA0, 0x0F, 0x00, 0xFF, 0x00, 0x49, 0x92, 0xC4, 0xF7, 0x00, 0x00, 
-    0xFF, 0x00, 0x06, 0x06, 0xE0, 0x40, 0x83, 0x26, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0xA8, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x18, 0x49, 0x98, 0x24, 0xFF, 0x00, 0x78, 0x02, 0x3D, 0x00, 0x58, 0x00, 0xFF, 0x00, 0x49, 0x9C, 0x24, 0xFE, 0x0D, 0x00, 
-    0xFF, 0x75, 0x40, 0x11, 0x00, 0x05, 0x00, 0x00, 0xFF, 0x00, 0x58, 0x82, 0x27, 0x4C, 0x02, 0x27, 0xFF, 0x00, 0xC2, 0x22, 0x2C, 0xC2, 0x22, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x06, 0x1A, 0x41, 0x31, 0x90, 0x08, 0xE4, 0x00, 0x49, 0x9E, 0x24, 0x4D, 0x82, 0x24, 0xFF, 0x00, 0x52, 0x23, 0x28, 0x04, 0x96, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x0E, 0x00, 
-    0xFF, 0x00, 0x89, 0x10, 0x03, 0x15, 0x00, 0xC0, 0xB5, 0x00, 0x48, 0xB2, 0x24, 0x4F, 0x92, 0x24, 0x10, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x90, 0x14, 0x49, 0x94, 0xE4, 0xFF, 0x00, 0x78, 0x02, 0x26, 0x80, 0x2A, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xBE, 0x07, 0x00, 
-    0xFF, 0x00, 0x11, 0x54, 0x80, 0x80, 0x0E, 0x38, 0x01, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6A, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xFF, 0x32, 0x40, 0x04, 0x0C, 0x04, 0x70, 0x00, 
-    0xFF, 0x00, 0x60, 0x02, 0x27, 0x4A, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF3, 0x00, 0xF9, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x70, 0xFB, 0x49, 0x92, 0x24, 0xDE, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC0, 0x93, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x80, 0x93, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD0, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x70, 0x3B, 0x49, 0x92, 0x24, 
-    0xCB, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x96, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x38, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC0, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x02, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x80, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x02, 0x93, 0x24, 0x49, 0x92, 0x24, 0x65, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x93, 0x24, 0x49, 0x92, 0x24, 0x97, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x50, 0x94, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x58, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFC, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x03, 0x90, 0xDC, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x80, 0xE8, 0x27, 0x49, 0x92, 0x24, 
-    0x1A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x24, 0x49, 0x92, 0x24, 0xA8, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF0, 0x00, 0xF9, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x70, 0xFB, 0x49, 0x92, 0x24, 
-    0xE9, 0x00, 0xE0, 0x95, 0xE4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x23, 0x26, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC2, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD6, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0xFB, 0x49, 0x92, 0x24, 
-    0xF8, 0x00, 0xD8, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x10, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x93, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xA1, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x60, 0x3F, 0x49, 0x92, 0x24, 
-    0x9D, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0x1B, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x31, 0x19, 0x03, 0x09, 0x90, 0x0C, 0xE3, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x24, 0x69, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xFF, 0x28, 0x6F, 0x33, 0xA0, 0x00, 0x04, 0x00, 
-    0x29, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x9E, 0x84, 0x49, 0x94, 0x1C, 0xFF, 0x00, 0xE4, 0x03, 0x24, 0x58, 0x82, 0x26, 0xFF, 0x00, 0x27, 0x1D, 0x01, 0x39, 0x90, 0x10, 
-    0xFF, 0x00, 0x49, 0xF2, 0x24, 0x4A, 0x02, 0x26, 0xCB, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xFF, 0x00, 0x29, 0x5B, 0xA0, 0xC0, 0x02, 0x3C, 0xFC, 0x00, 0x89, 0x99, 0x1C, 0x49, 0x98, 0xE4, 
-    0xFF, 0x00, 0x7C, 0x02, 0x26, 0xC0, 0x03, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x99, 0x03, 0x21, 0x70, 0x80, 0xAF, 0x00, 0x7B, 0x82, 0x24, 0x4F, 0x92, 0x24, 
-    0xFF, 0x00, 0x25, 0x29, 0x00, 0x93, 0x94, 0x24, 0xFF, 0x00, 0x24, 0x09, 0x00, 0x92, 0x94, 0x24, 0xFF, 0x00, 0x24, 0x09, 0x00, 0x12, 0x90, 0x01, 0xF9, 0x00, 0x4C, 0x8C, 0x84, 0x48, 0xD8, 0x84, 
-    0xFF, 0x00, 0x24, 0x09, 0x00, 0x90, 0x8D, 0x25, 0xFF, 0x00, 0x4C, 0x8A, 0x84, 0x4E, 0x9C, 0x24, 0xFF, 0x00, 0x75, 0x02, 0x25, 0xC0, 0x23, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x09, 0x99, 0x08, 0x89, 0x9D, 0x24, 0xFF, 0x00, 0x24, 0x0B, 0x80, 0x1E, 0x18, 0x82, 0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x29, 0x7D, 0x00, 0x04, 0x00, 0x18, 
-    0xD0, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 0xFF, 0x00, 0x26, 0x59, 0x00, 0x6F, 0x9B, 0x24, 0xFF, 0x00, 0x24, 0x09, 0x00, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x24, 0x03, 0x20, 0x6D, 0x93, 0x24, 
-    0xFF, 0x00, 0x49, 0x12, 0x62, 0x89, 0x90, 0x18, 0xC0, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0xA4, 0xFF, 0x00, 0x49, 0x77, 0x01, 0xC2, 0x0C, 0x25, 0xFF, 0x00, 0xD2, 0x0C, 0x00, 0x7F, 0x91, 0x84, 
-    0xFF, 0x00, 0x49, 0xB2, 0x24, 0x68, 0x02, 0x25, 0xFF, 0x20, 0x97, 0x72, 0x20, 0x07, 0x72, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x9C, 0x0F, 0x19, 0x50, 0xA0, 0xFF, 0x00, 0x93, 0x06, 0x00, 0xAB, 0x99, 0x24, 0xFF, 0x00, 0x4D, 0x02, 0x3D, 0x80, 0x6E, 0xA0, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x14, 0x33, 0x30, 0x03, 0x33, 0x30, 
-    0xFF, 0x00, 0x49, 0x92, 0x7C, 0xC9, 0x90, 0x02, 0xFF, 0x00, 0x9E, 0x04, 0x00, 0xA8, 0xFD, 0x24, 0xFF, 0x00, 0x6B, 0x02, 0xE8, 0x05, 0x94, 0x03, 0x60, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0xFF, 0x00, 0x49, 0x17, 0x01, 0x05, 0x48, 0x28, 0xFF, 0x00, 0x62, 0x82, 0x25, 0x75, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x9A, 0x0B, 0x11, 0x50, 0xA0, 0xFF, 0x00, 0x93, 0x08, 0x00, 0xAB, 0x9B, 0x24, 
-    0xFF, 0x00, 0x8F, 0x89, 0x0E, 0x82, 0x70, 0x01, 0xFF, 0x00, 0x8E, 0xC5, 0x18, 0x8C, 0xC1, 0x18, 0xFF, 0x00, 0x7A, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x01, 0x61, 0x43, 0xA0, 0x04, 0x9C, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x91, 0x1C, 0x49, 0x94, 0x84, 0xFF, 0x00, 0x78, 0x82, 0x26, 0x50, 0x02, 0x3C, 0xFF, 0x00, 0x49, 0x96, 0x04, 0x89, 0x91, 0x0C, 0xFF, 0x01, 0x10, 0x00, 0x0E, 0x78, 0xA1, 0x1C, 
-    0xFF, 0x00, 0x4D, 0xB2, 0x24, 0x78, 0x82, 0x26, 0xFF, 0x00, 0x49, 0x91, 0x0C, 0x09, 0x10, 0x03, 0xFF, 0x00, 0x78, 0xA2, 0x24, 0x4C, 0xE2, 0x24, 0xCE, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x80, 0x03, 0x28, 0x05, 0x9A, 0x01, 0xFF, 0x00, 0x49, 0x91, 0x03, 0x11, 0x40, 0xA0, 0xFF, 0x00, 0x68, 0xB2, 0x24, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x05, 0x1C, 0x41, 0x31, 0x90, 0x0C, 0xFF, 0x00, 0x49, 0x92, 0xC4, 0x4D, 0xA4, 0x14, 0xFF, 0x00, 0x83, 0x02, 0x34, 0x50, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x10, 0xFF, 0x00, 0x05, 0x06, 0xE8, 0x80, 0x03, 0x26, 0x7D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x05, 0x72, 0xC0, 0x19, 0x16, 0x03, 0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0xFF, 0x00, 0x49, 0x9A, 0x44, 0x89, 0x91, 0x0C, 0xFF, 0x00, 0x58, 0x04, 0xA7, 0x4A, 0xDE, 0x24, 
-    0xFF, 0x00, 0x70, 0x02, 0x26, 0xC0, 0x33, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x44, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x56, 0x00, 0x78, 0x98, 0x24, 0x49, 0x92, 0x64, 0xFF, 0x00, 0x75, 0x92, 0xBC, 0x16, 0x00, 0xA8, 0xFF, 0x00, 0x49, 0x4C, 0x4E, 0x00, 0xF0, 0xC7, 
-    0xFF, 0x00, 0x40, 0x02, 0x3C, 0xC0, 0x03, 0x3C, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0xE0, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xE9, 0x24, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xE2, 0x03, 0xA0, 
-    0x0E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0xA4, 0xFF, 0x00, 0x83, 0x02, 0x34, 0x80, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB4, 0x00, 0x19, 0x96, 0x24, 0x49, 0x92, 0x24, 
-    0x1C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xE9, 0x24, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xE2, 0x03, 0xA0, 0xFF, 0x00, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 
-    0xFF, 0x00, 0x19, 0x18, 0x80, 0x01, 0x10, 0xA0, 0xFF, 0x00, 0x49, 0xD2, 0xB6, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xC9, 0xD0, 0x0E, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x4B, 0xA2, 0x24, 0x8A, 0xF9, 0x10, 
-    0xFF, 0x00, 0xC3, 0x32, 0x2C, 0x82, 0x08, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x74, 0x02, 0x26, 0xFF, 0x00, 0xC3, 0x02, 0x34, 0x40, 0x23, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x31, 0x90, 0x00, 0x09, 0x90, 0x03, 0xFF, 0x00, 0x8C, 0xC1, 0x18, 0x8C, 0xC1, 0x18, 0xFF, 0x00, 0x78, 0x82, 0x27, 0xF8, 0x09, 0x0B, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xD3, 0x0A, 0x00, 
-    0xD2, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x27, 0x6F, 0xE0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x3C, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x23, 0x2C, 0x04, 0x62, 0xC0, 0xFF, 0x00, 0x09, 0x10, 0x03, 0x21, 0x10, 0x61, 0xDA, 0x00, 0x4B, 0xE0, 0x64, 0x49, 0x9C, 0x24, 
-    0xFF, 0x00, 0x58, 0x02, 0x24, 0x80, 0x23, 0x30, 0xFF, 0x00, 0x21, 0x14, 0x81, 0x06, 0x4C, 0x20, 0x03, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x39, 0x90, 0x14, 0xC9, 0x90, 0x02, 0xFF, 0x00, 0xC0, 0x02, 0x3C, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFC, 0x00, 0xC9, 0x91, 0x84, 0x49, 0x9E, 0x24, 0xFF, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x58, 0x20, 0xB8, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x60, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0x31, 0x10, 0x01, 0x03, 0x0A, 0x2C, 0xCF, 0x00, 0x48, 0xF2, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x14, 0xC9, 0x91, 0x64, 0xFF, 0x00, 0x4C, 0xA2, 0x24, 0x70, 0x82, 0x25, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0xC1, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0x13, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xC2, 0x00, 0x86, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD2, 0x00, 0x49, 0x94, 0x04, 0x49, 0x94, 0xC4, 0xFF, 0x00, 0x50, 0x02, 0x26, 0x50, 0x02, 0x88, 0xFF, 0x00, 0x49, 0x9A, 0x64, 0x49, 0x41, 0x81, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xFF, 0x42, 0x01, 0x14, 0x00, 0x01, 0x18, 0xE0, 0xFF, 0x00, 0x58, 0xDB, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x04, 0x90, 0x03, 0x49, 0x91, 0x1C, 
-    0xFF, 0x00, 0x4E, 0xB2, 0x24, 0x78, 0x02, 0x27, 0xFF, 0x00, 0x02, 0x43, 0xE0, 0x07, 0x94, 0x02, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x0E, 0x08, 0xFF, 0x00, 0xB9, 0x1F, 0x81, 0x03, 0x0E, 0x34, 
-    0xFF, 0x00, 0x49, 0x94, 0x14, 0xC9, 0x90, 0x00, 0xFF, 0x00, 0xC0, 0x0A, 0x26, 0x4A, 0xC2, 0x24, 0xFC, 0x00, 0x25, 0x90, 0x5C, 0x49, 0x9C, 0x24, 0xFF, 0x00, 0x02, 0x03, 0x30, 0x00, 0x03, 0x30, 
-    0xFF, 0x00, 0x11, 0x18, 0x42, 0x39, 0x90, 0x18, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x7B, 0x02, 0x68, 0xFF, 0x00, 0x49, 0x92, 0x54, 0x31, 0x20, 0x60, 0xAF, 0x00, 0x49, 0x87, 0x24, 0x4C, 0x92, 0x24, 
-    0xFF, 0x00, 0x82, 0x38, 0x2C, 0xC3, 0x32, 0x2C, 0x81, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x83, 0x52, 0x80, 0x19, 0x90, 0x0C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x22, 0x07, 0x00, 
-    0xFF, 0x00, 0x29, 0x60, 0x00, 0x80, 0x20, 0x0B, 0xFF, 0x00, 0x8C, 0xC1, 0x18, 0x8C, 0xC1, 0x18, 0xFF, 0x00, 0x00, 0x08, 0x3C, 0x68, 0x02, 0x27, 0xFF, 0x00, 0xAD, 0x90, 0x44, 0x49, 0x9A, 0xC4, 
-    0xFF, 0x00, 0x68, 0x02, 0x25, 0x40, 0x02, 0x3C, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x98, 0x61, 0x29, 0x90, 0x03, 0xFF, 0x00, 0x07, 0x5A, 0x20, 0xC3, 0x02, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x84, 0x62, 0xE0, 0x01, 0x96, 0x01, 0xFF, 0x00, 0xC3, 0x02, 0x34, 0xC0, 0x03, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFA, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x1C, 
-    0xFF, 0x00, 0x07, 0x26, 0xE0, 0x40, 0x83, 0x25, 0xFF, 0x00, 0x07, 0x16, 0x02, 0x89, 0x90, 0x18, 0xFF, 0x00, 0x49, 0xD2, 0x24, 0x78, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x09, 0x05, 0x52, 0x20, 0x05, 0x52, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC9, 0x91, 0x08, 0x21, 0x60, 0x40, 0xFF, 0x00, 0xD0, 0x03, 0x27, 0x4C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x4D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x23, 0x34, 0x84, 0x72, 0xC0, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x15, 0x90, 0xDC, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0xF3, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC0, 0x93, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x37, 0x01, 0x12, 0xE0, 0x01, 0x1C, 0x40, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x1C, 0x89, 0x91, 0x08, 
-    0xFF, 0x00, 0x68, 0x82, 0x26, 0x70, 0x82, 0x24, 0xCB, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x70, 0xFB, 0x49, 0x92, 0x24, 0xCB, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x09, 0x90, 0x00, 0x89, 0x90, 0x10, 0xFC, 0x00, 0x4D, 0xD2, 0x24, 0x4B, 0x82, 0x27, 0xA1, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xFF, 0x00, 0x02, 0x23, 0x30, 0x00, 0x03, 0x30, 
-    0x35, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x03, 0x90, 0xDB, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0xF3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC3, 0x32, 0x2C, 0xC3, 0x32, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0xFC, 0x3F, 0xC3, 0x52, 0xC0, 0xA2, 0x00, 0x82, 0x98, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x90, 0x08, 0x39, 0x90, 0x41, 0xFF, 0x00, 0x8C, 0xD1, 0x18, 0x8E, 0x91, 0x18, 0xFF, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x46, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x10, 0x89, 0x91, 0x24, 0xFF, 0x00, 0xC0, 0x03, 0x25, 0x60, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x29, 0x90, 0x03, 0x89, 0x90, 0x24, 0xFF, 0x00, 0x60, 0x02, 0x27, 0x4A, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x10, 0x02, 0x06, 0x96, 0x24, 
-    0xEF, 0x00, 0x78, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x8F, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x23, 0xE0, 0x07, 0x94, 0x24, 0x04, 0x00, 0x49, 0x92, 0x24, 0x48, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x05, 0x52, 0x20, 0x05, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x14, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x90, 0x24, 
-    0xFF, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0xB6, 0x0D, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0xB6, 0x0D, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x4E, 0x8A, 0xA4, 0x48, 0x9A, 0xA4, 
-    0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x19, 0x16, 0x03, 0x89, 0x90, 0x24, 
-    0x6E, 0x00, 0x49, 0xF2, 0x24, 0x48, 0x92, 0x24, 0xFF, 0x00, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x06, 0x60, 0xA0, 0x06, 0x92, 0x24, 0xFF, 0x00, 0x72, 0x02, 0x00, 0x16, 0x90, 0xDC, 0xFF, 0x00, 0x1F, 0x00, 0x60, 0x00, 0xE3, 0x24, 
-    0x84, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFB, 0x00, 0xC9, 0x91, 0xA4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x90, 0x03, 0x00, 0x16, 0x90, 0xDC, 0xFF, 0x00, 0x39, 0x01, 0x60, 0x00, 0xE3, 0x24, 0xFF, 0x00, 0x00, 0x33, 0x30, 0x04, 0x93, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC3, 0x32, 0x2C, 0xC3, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x19, 0x90, 0x0B, 0x49, 0x9C, 0x24, 0xFF, 0x00, 0xB4, 0x0B, 0x00, 0x93, 0x94, 0x24, 
-    0xFF, 0x00, 0x02, 0x0A, 0x34, 0x7C, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x24, 0xFF, 0x00, 0x78, 0x82, 0x27, 0x78, 0x92, 0x24, 0x46, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x24, 
-    0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x93, 0x24, 0xFF, 0x00, 0x06, 0x6E, 0xE0, 0x06, 0x9E, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x94, 0x24, 
-    0xFF, 0x00, 0x58, 0x02, 0x00, 0x92, 0x94, 0x24, 0xF8, 0x00, 0x49, 0x82, 0x24, 0x48, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xF8, 0x00, 0x49, 0x92, 0x08, 0x89, 0x90, 0x24, 0xFF, 0x00, 0x21, 0x08, 0x80, 0x92, 0x98, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x01, 0x21, 0x43, 0xA0, 0x05, 0x9A, 0x3A, 0xFF, 0x00, 0xB9, 0x94, 0x03, 0x39, 0x90, 0x03, 0x33, 0x00, 0x4A, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x95, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x7A, 0x8E, 0xC7, 0x78, 0x8C, 0xC7, 0xFF, 0x00, 0x6C, 0x0C, 0x14, 0x00, 0x04, 0x28, 
-    0xFF, 0x00, 0x93, 0x08, 0x00, 0xED, 0x90, 0x84, 0xFF, 0x00, 0x4F, 0xAC, 0x17, 0x18, 0x04, 0xE8, 0xFF, 0x00, 0xD3, 0x08, 0x00, 0x35, 0x91, 0xA4, 0xFF, 0x00, 0x4F, 0x02, 0x27, 0x50, 0x02, 0x38, 
-    0xFF, 0x00, 0x67, 0x63, 0xC0, 0x06, 0x60, 0x00, 0xFF, 0x00, 0xE7, 0x24, 0x00, 0x60, 0xFB, 0x24, 0xFF, 0x00, 0x6B, 0x02, 0x28, 0x02, 0x1A, 0x41, 0x4A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 
-    0xFF, 0x00, 0xC9, 0x19, 0x02, 0x04, 0x04, 0x30, 0xFF, 0x00, 0xD3, 0x08, 0x00, 0x35, 0x95, 0x24, 0xFF, 0x00, 0x4F, 0x82, 0x26, 0x00, 0x33, 0xE0, 0xFF, 0x00, 0x39, 0x1B, 0x03, 0x31, 0x10, 0x03, 
-    0xFF, 0x00, 0x49, 0x77, 0x01, 0xC2, 0x8A, 0x26, 0xFF, 0x00, 0x12, 0x0F, 0x00, 0x25, 0x90, 0x18, 0xFF, 0x00, 0x49, 0xD2, 0x24, 0x70, 0x02, 0x25, 0xFF, 0x00, 0x49, 0x92, 0x5C, 0x89, 0x90, 0x02, 
-    0xFF, 0x00, 0x9D, 0x04, 0x00, 0x58, 0xCB, 0x24, 0xFF, 0x00, 0x7C, 0x0C, 0x98, 0x04, 0x94, 0x0B, 0xFF, 0x00, 0x74, 0x0E, 0xC6, 0x60, 0x0C, 0xC6, 0xFF, 0x02, 0x6D, 0x0E, 0x18, 0x00, 0x00, 0xC0, 
-    0xFF, 0x00, 0x1C, 0x03, 0x28, 0x22, 0x93, 0x24, 0xFF, 0x00, 0x49, 0x9A, 0x0B, 0x21, 0x14, 0xA1, 0xFF, 0x00, 0xD3, 0x08, 0x00, 0xCE, 0x97, 0xE4, 0xFF, 0x00, 0x4F, 0x02, 0x27, 0x40, 0x02, 0x38, 
-    0xFF, 0x00, 0x49, 0x9A, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x7D, 0x02, 0x27, 0x70, 0x02, 0x27, 0xFF, 0x00, 0x31, 0x99, 0x02, 0x29, 0x90, 0x02, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x89, 0x99, 0x10, 0x09, 0x91, 0x10, 0xFF, 0x00, 0x4D, 0xB9, 0x14, 0x4B, 0xB0, 0x84, 0xFF, 0x00, 0x4D, 0x82, 0x27, 0x60, 0x02, 0x25, 0xDB, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 
-    0xFF, 0x00, 0x65, 0x03, 0x34, 0x40, 0x02, 0x26, 0xFF, 0x00, 0x66, 0x63, 0xE0, 0x01, 0x9A, 0x61, 0x66, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xFF, 0x0F, 0x6E, 0x33, 0xC0, 0x00, 0x06, 0x01, 
-    0x28, 0x00, 0x49, 0x92, 0x24, 0x49, 0xE2, 0x04, 0xFF, 0x00, 0x27, 0x4F, 0x20, 0x02, 0x03, 0x38, 0xFF, 0x00, 0x31, 0x99, 0x0B, 0x89, 0x91, 0x84, 0xFF, 0x00, 0x4F, 0xB2, 0x24, 0x68, 0x02, 0x3C, 
-    0xFF, 0x00, 0x49, 0x19, 0x03, 0x17, 0x36, 0xE8, 0x76, 0x00, 0x48, 0xA6, 0x44, 0x49, 0x9E, 0x24, 0xFF, 0x00, 0x6C, 0x02, 0x3C, 0x40, 0x43, 0x28, 0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 
-    0xFF, 0x00, 0x21, 0x6D, 0xE0, 0x83, 0x02, 0x34, 0xFF, 0x00, 0x09, 0x99, 0x00, 0x09, 0x99, 0x24, 0xFF, 0x00, 0x24, 0x09, 0x00, 0x24, 0x99, 0xE4, 0xFF, 0x0D, 0x6D, 0x0D, 0x60, 0x03, 0x28, 0x28, 
-    0x70, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x04, 0xFF, 0x00, 0x29, 0x29, 0x00, 0x40, 0x8D, 0x25, 0xFF, 0x00, 0xC9, 0x9D, 0x08, 0x89, 0x90, 0x08, 0xFF, 0x00, 0x09, 0xF9, 0x08, 0x8F, 0xFB, 0x24, 
-    0xFF, 0x00, 0x7C, 0x02, 0x3C, 0x42, 0x43, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x27, 0x6F, 0xE0, 0xFF, 0x00, 0x39, 0x90, 0x03, 0x39, 0x90, 0x03, 0x33, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x31, 0x69, 0x60, 0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xCE, 0x91, 0x1C, 0xFF, 0x00, 0x78, 0x8C, 0xC7, 0x78, 0x8C, 0xC7, 0xFF, 0x00, 0x80, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 
-    0x32, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x9C, 0xC4, 0xFF, 0x00, 0x40, 0x03, 0x38, 0x80, 0x03, 0x38, 0x07, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x23, 0x34, 0x42, 0x23, 0x34, 
-    0xFF, 0x26, 0x07, 0x7A, 0xE0, 0x07, 0x72, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x29, 0x10, 0x03, 0x31, 0x10, 0x03, 0xFF, 0x00, 0x49, 0xF6, 0x04, 0x4F, 0xF0, 0x04, 
-    0xFF, 0x00, 0x50, 0x02, 0x26, 0x68, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x07, 0x98, 0x41, 0x21, 0x14, 0x42, 0xFF, 0x00, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
-    0xB2, 0x00, 0x48, 0xC2, 0x24, 0x4E, 0xD2, 0x24, 0x7E, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0xE4, 0xFF, 0x00, 0xC0, 0x03, 0x38, 0x40, 0x03, 0x38, 0xFF, 0x00, 0x11, 0x14, 0x80, 0x01, 0x1A, 0xA0, 
-    0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x91, 0x04, 0x49, 0x94, 0x44, 0xFF, 0x00, 0x60, 0x0C, 0xC6, 0x60, 0x0C, 0xC6, 0xFF, 0x00, 0x00, 0x03, 0x38, 0xC0, 0x03, 0x3C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x11, 0x18, 0x02, 0x09, 0x91, 0xE4, 0xFF, 0x00, 0x49, 0xA2, 0x3E, 0x00, 0x54, 0x0A, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x02, 0x25, 
-    0xFF, 0x00, 0x26, 0x41, 0x00, 0x26, 0x91, 0x1C, 0xFF, 0x00, 0x18, 0x0B, 0x60, 0x20, 0x0B, 0x27, 0xFF, 0x00, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
-    0xFF, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x0C, 0xC5, 0x00, 0x48, 0x8C, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x00, 0x80, 0x33, 0x2C, 0x05, 0x1E, 0x80, 0xFF, 0x00, 0x89, 0x91, 0x0C, 0x39, 0x90, 0x42, 
-    0xFF, 0x00, 0x78, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x90, 0x00, 0xC9, 0x90, 0x14, 0xFF, 0x00, 0x4F, 0xD6, 0x04, 0x4B, 0x81, 0x0C, 0xFF, 0x00, 0xA8, 0x80, 0x13, 0x8A, 0xC1, 0x04, 
-    0xFF, 0x00, 0x4E, 0xCA, 0x44, 0xC8, 0x01, 0x17, 0xFF, 0x00, 0x40, 0x02, 0x26, 0x70, 0xA2, 0x24, 0x10, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x82, 0x6C, 0x00, 0x21, 0x10, 0x01, 
-    0xFF, 0x00, 0x80, 0x03, 0x26, 0x4A, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x06, 0x1E, 0x81, 0x29, 0x94, 0x03, 0xFF, 0x00, 0x49, 0x9A, 0x64, 0xC9, 0xE1, 0x14, 
-    0xFF, 0x00, 0x40, 0x02, 0x26, 0x70, 0xA2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x94, 0x10, 0x29, 0x60, 0x60, 0xFF, 0x00, 0xC0, 0x03, 0x27, 0x4D, 0x92, 0x24, 
-    0x71, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0x18, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0xFF, 0x00, 0x04, 0x43, 0x30, 0x04, 0x43, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0xFF, 0x00, 0x39, 0x90, 0x03, 0x39, 0x90, 0x03, 0xFF, 0x00, 0x4F, 0xFE, 0x5C, 0xBF, 0x60, 0x01, 
-    0xFF, 0x00, 0xC0, 0x02, 0x25, 0x7A, 0xF2, 0x24, 0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x78, 0x8C, 0xC7, 0x78, 0x8C, 0xC7, 0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 
-    0x11, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x42, 0x23, 0x34, 0x42, 0x23, 0x34, 
-    0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 0xD7, 0x00, 0x4F, 0xF0, 0x84, 0x4F, 0xFE, 0x24, 
-    0xFF, 0x00, 0x58, 0x02, 0x38, 0x02, 0x6A, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x0A, 0x01, 0xFF, 0x00, 0x11, 0x66, 0xA0, 0x80, 0x02, 0x3D, 0xFF, 0x00, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
-    0xFF, 0x00, 0x4D, 0xA2, 0x24, 0x90, 0x43, 0x00, 0xFF, 0x00, 0x49, 0x9C, 0x64, 0xF9, 0x20, 0x00, 0xFF, 0x00, 0xC0, 0x03, 0x24, 0x60, 0xB2, 0x24, 0xFF, 0x00, 0x11, 0x16, 0x02, 0x39, 0x90, 0x14, 
-    0xFF, 0x00, 0x49, 0xF2, 0x24, 0x72, 0x02, 0x40, 0xFF, 0x00, 0xC9, 0x91, 0x10, 0x27, 0x00, 0x48, 0xFF, 0x00, 0x60, 0x0C, 0xC6, 0x60, 0x0C, 0xC6, 0xFF, 0x00, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x72, 0x32, 0x01, 0x1A, 0x02, 0xF7, 0x00, 0x49, 0x9A, 0x24, 0x49, 0x2E, 0x0E, 0xFF, 0x00, 0x40, 0x23, 0x34, 0x80, 0x83, 0x25, 
-    0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 0xFF, 0x00, 0x29, 0x10, 0x03, 0x09, 0x90, 0x14, 0xFF, 0x00, 0x4F, 0xD2, 0x24, 0x7A, 0x02, 0x48, 
-    0xFF, 0x00, 0x89, 0x90, 0x03, 0x17, 0x00, 0x0C, 0xC5, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x00, 0x21, 0x94, 0x03, 0xC9, 0x90, 0x14, 0xFF, 0x00, 0x11, 0x68, 0xE0, 0xC2, 0x02, 0x38, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xF9, 0x00, 0x49, 0x90, 0x64, 0x49, 0x9A, 0xE4, 0xFF, 0x4B, 0x88, 0x80, 0x41, 0x00, 0x0A, 0x20, 0xAF, 0x00, 0x4D, 0x90, 0x84, 0x49, 0x9E, 0x24, 
-    0xFF, 0x86, 0x88, 0x01, 0x0A, 0x00, 0x54, 0xE0, 0x96, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xC4, 0xC9, 0x95, 0x0C, 0xFF, 0x00, 0x04, 0x04, 0xF4, 0x58, 0x82, 0x27, 
-    0xFF, 0x00, 0x50, 0x02, 0x30, 0x05, 0x1C, 0x41, 0x12, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xFF, 0x00, 0xC9, 0x90, 0x18, 0x49, 0x90, 0x84, 0xFF, 0x01, 0x8C, 0x00, 0x03, 0x10, 0x06, 0xC0, 
-    0x7A, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x9E, 0x64, 0x09, 0x91, 0x00, 0xFF, 0x00, 0x82, 0x02, 0x3C, 0x70, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x60, 
-    0xFF, 0x00, 0x49, 0x9A, 0x64, 0x31, 0x11, 0x01, 0xFF, 0x00, 0x58, 0x82, 0x25, 0x70, 0xD2, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0x18, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0xFF, 0x00, 0x04, 0x43, 0x28, 0x07, 0x16, 0x03, 0xFC, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0xFF, 0x00, 0x39, 0x90, 0x03, 0x39, 0x90, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x11, 0x7A, 0xE4, 0xC4, 
-    0xFF, 0x00, 0x4C, 0x02, 0x27, 0x50, 0x02, 0x30, 0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x78, 0x8C, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0xC0, 0x93, 0x24, 0x49, 0x92, 0x24, 
-    0x11, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x80, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x42, 0x93, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x06, 0x9E, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x90, 0x24, 0x49, 0x92, 0x24, 0x22, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xF7, 0x00, 0xF9, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x60, 0x3F, 0x49, 0x92, 0x24, 0x95, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
-    0xFF, 0x00, 0xAF, 0xF0, 0xE4, 0x4F, 0xF2, 0x24, 0xFF, 0x00, 0x00, 0x68, 0x27, 0x49, 0x92, 0x24, 0x0D, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x59, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x02, 0x90, 0xDB, 0x49, 0x92, 0x24, 0xF9, 0x00, 0x58, 0xF6, 0x64, 0x49, 0x96, 0x64, 0xFF, 0x00, 0x60, 0x0C, 0x26, 0x60, 0x02, 0x26, 0xFF, 0x00, 0xC0, 0x93, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xEF, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x70, 0x3F, 0x49, 0x92, 0x24, 0x93, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 0x74, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0xFB, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x7B, 0x91, 0x24, 0x49, 0x92, 0x24, 0xC5, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xEC, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x50, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x03, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x05, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x29, 0x90, 0x24, 0x49, 0x92, 0x24, 0x5B, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x39, 0x90, 0x24, 0x49, 0x92, 0x24, 0xA9, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x88, 0x00, 0x49, 0x9A, 0x24, 0x49, 0x9E, 0x04, 0xFF, 0x00, 0x80, 0x22, 0x30, 0xC0, 0x83, 0x25, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x96, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xA1, 0x90, 0x64, 0x49, 0x9A, 0xA4, 0xFF, 0x00, 0x78, 0x02, 0x26, 0x58, 0x82, 0x25, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0x18, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0xFF, 0x00, 0x17, 0x50, 0xE8, 0xC4, 0x42, 0x30, 0xAF, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x26, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0xFF, 0x00, 0x39, 0x90, 0x03, 0x39, 0x90, 0x24, 0x33, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 
-    0xFF, 0x00, 0x04, 0x1E, 0x41, 0x31, 0x90, 0x24, 0xFF, 0x00, 0xC9, 0x91, 0x1C, 0xCD, 0x91, 0x24, 0xFF, 0x00, 0x78, 0x82, 0x27, 0x78, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x31, 0x10, 0x03, 0x39, 0x99, 0x24, 
-    0x26, 0x00, 0x48, 0x82, 0x24, 0x4C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x49, 0x90, 0x04, 0x49, 0x98, 0x24, 0xFF, 0x00, 0x60, 0x02, 0x26, 0x6C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xC9, 0x91, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x76, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x98, 0x24, 0xFF, 0x00, 0xED, 0x00, 0x00, 0xD3, 0x9A, 0x24, 0xFF, 0x00, 0x70, 0xB2, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x71, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0x08, 0x18, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
-    0xFF, 0x00, 0x04, 0x43, 0x30, 0x04, 0x43, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9B, 0x03, 0xFF, 0x00, 0x06, 0x5E, 0x20, 0x82, 0x02, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x62, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x03, 0x00, 0x9E, 0x94, 0x24, 0xFF, 0x00, 0x89, 0x90, 0x08, 0x89, 0x90, 0xDC, 0xFD, 0x00, 0x4F, 0xFE, 0x08, 0x8F, 0x94, 0x24, 
-    0xFF, 0x00, 0x02, 0x03, 0x38, 0x6A, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0xB1, 0x94, 0x24, 0xC9, 0x97, 0x03, 0xFF, 0x00, 0x73, 0x92, 0x24, 0xA2, 0x03, 0x60, 0x51, 0x00, 0x49, 0x92, 0x24, 0x49, 0xCC, 0x04, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x63, 0x8E, 0x65, 
-    0xFF, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0xFF, 0x00, 0x19, 0x18, 0xE1, 0xF9, 0x93, 0x24, 0xFF, 0x00, 0xAE, 0x90, 0xA4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x10, 0x21, 0x00, 0x71, 0x9F, 0x24, 0xFF, 0x00, 0x70, 0xC6, 0x64, 0x49, 0x96, 0x64, 
-    0xA1, 0x00, 0xB0, 0xAD, 0x24, 0x4A, 0xA2, 0x24, 0x29, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xCC, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0x8F, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0x8F, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0x8F, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0x8F, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
-    0x8F, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x58, 0x82, 0x25, 0x58, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x49, 0x90, 0x04, 0x49, 0x98, 0x24, 
-    0xDA, 0x00, 0x4B, 0x02, 0x49, 0xDB, 0x96, 0x24, 0xAC, 0x00, 0x49, 0x02, 0x00, 0x92, 0x94, 0x24, 0xEB, 0x00, 0x62, 0x02, 0x26, 0x73, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
-    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x87, 0x00, 0x49, 0x92, 0xB4, 0x09, 0x91, 0x10, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0x1B, 0x0F, 0xF1, 0xC0, 0x00, 0x49, 0xE2, 0xE4, 0x4B, 0x8C, 0xA4, 0xC2, 0x00, 0x49, 0xE2, 0xFA, 0x1C, 0x3B, 0xA8, 
+    0xBA, 0x00, 0x49, 0xE2, 0xFA, 0xDC, 0x3A, 0x88, 0x2D, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBF, 0x00, 0x31, 0x15, 0x0F, 0xEF, 0xF6, 0x0A, 
+    0xC0, 0x01, 0xE2, 0xE3, 0xDE, 0xEB, 0x37, 0x07, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0xAC, 0x2F, 0x00, 0x49, 0x82, 0x24, 0x4B, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA0, 0x00, 0x49, 0xF2, 0xFF, 0x21, 0x99, 0x04, 0xA0, 0x00, 0x49, 0xF2, 0xFF, 0x24, 0x0D, 0xCC, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x24, 
+    0xAE, 0x00, 0x49, 0x92, 0xDC, 0x71, 0xF7, 0x0E, 0xBD, 0x09, 0x79, 0xD2, 0xD6, 0xD3, 0x06, 0x09, 0x9B, 0x00, 0x49, 0xE2, 0x27, 0xEB, 0x83, 0x35, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 
+    0xEF, 0x00, 0x79, 0x71, 0x53, 0xEE, 0xD6, 0x8D, 0xBD, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xD2, 0x27, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x13, 0x40, 0x02, 0xD8, 0x80, 0xA4, 0x91, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x02, 0x10, 0x02, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x24, 
+    0xC2, 0x00, 0x49, 0x92, 0xBB, 0x31, 0x97, 0x0E, 0x9E, 0x00, 0x49, 0xD2, 0x27, 0xEB, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0x49, 0x92, 0xB8, 0x31, 0xF7, 0x0E, 
+    0xC6, 0x07, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0x86, 0x00, 0x49, 0x12, 0x92, 0xF1, 0x90, 0x54, 0xC6, 0x07, 0x49, 0x62, 0xDB, 0xDB, 0x26, 0x00, 0xC6, 0x00, 0x49, 0xD2, 0x36, 0xDB, 0x02, 0x20, 
+    0x79, 0x00, 0x49, 0x92, 0x3C, 0x89, 0x93, 0x10, 0xBD, 0x00, 0xF9, 0x1F, 0xB7, 0xF1, 0x74, 0x0F, 0x97, 0x00, 0xFF, 0x4F, 0x26, 0x40, 0xC2, 0xBB, 0x20, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x05, 0xF1, 0x10, 0x0F, 0xF1, 0x18, 0x4F, 0x7E, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x67, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x97, 0x14, 0xB2, 0x00, 0x49, 0x62, 0x3B, 0x1C, 0x2D, 0x88, 0x26, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0xB2, 0x17, 0x49, 0xE2, 0xB6, 0xA6, 0x64, 0x02, 
+    0xB2, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 0xB2, 0x00, 0xFF, 0xD3, 0x3A, 0x9A, 0x83, 0x39, 0x64, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 0xB3, 0x00, 0x49, 0x62, 0xFB, 0x1C, 0x2D, 0x88, 
+    0x2B, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6C, 0x00, 0x49, 0x92, 0x84, 0x89, 0x97, 0x14, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x26, 0x00, 
+    0xBE, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x24, 0x7A, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x19, 0x0F, 0xC2, 0x00, 0xC9, 0x6F, 0xB7, 0xDC, 0x26, 0x00, 0xC5, 0x00, 0x7F, 0xD2, 0xFA, 0x1B, 0x0B, 0x68, 
+    0x70, 0x00, 0x49, 0xF2, 0x24, 0x7C, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x87, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 0xFF, 0x29, 0xA3, 0x33, 0x3A, 0xA3, 0x33, 0x38, 0xFF, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xE4, 0xC6, 0x46, 0xC4, 0x5E, 0xF0, 0x15, 0x63, 0x35, 
+    0xB9, 0x53, 0x85, 0x6C, 0xED, 0xD6, 0xFE, 0x31, 0x77, 0x00, 0x4E, 0xE2, 0x24, 0x4E, 0xFA, 0x04, 0x77, 0x00, 0x49, 0x92, 0x24, 0x6D, 0x0B, 0x00, 0xC7, 0x26, 0xE9, 0xF4, 0x4A, 0xA7, 0x46, 0x62, 
+    0xFF, 0x00, 0x7D, 0xD0, 0x27, 0xB5, 0xDD, 0xB6, 0xFF, 0x37, 0x58, 0x8F, 0x39, 0xA1, 0x63, 0xDA, 0x8C, 0x00, 0x4F, 0x93, 0x38, 0xE5, 0x03, 0x3E, 0x64, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 
+    0xC5, 0x04, 0xB9, 0xEB, 0x72, 0x9C, 0x30, 0x68, 0xCC, 0x2E, 0x56, 0x43, 0x35, 0x92, 0xD0, 0x92, 0xFF, 0x00, 0x49, 0x10, 0x00, 0x02, 0x30, 0x01, 0xFF, 0x00, 0x40, 0x02, 0xE4, 0x40, 0x0E, 0xE4, 
+    0xB1, 0x3E, 0x21, 0xF4, 0xA1, 0x96, 0xEC, 0xA9, 0x87, 0x00, 0x9A, 0x50, 0x7B, 0x4E, 0xE8, 0x9C, 0xB9, 0x20, 0x58, 0x33, 0xF1, 0x03, 0x3F, 0xF0, 0xAC, 0x00, 0x89, 0x99, 0x77, 0xEF, 0x60, 0x0A, 
+    0xBB, 0x00, 0xC3, 0x0A, 0xD1, 0xA2, 0xB3, 0x3E, 0x22, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x24, 0xFF, 0x3D, 0x00, 0x04, 0x40, 0x88, 0x07, 0x40, 
+    0xB2, 0x17, 0x18, 0xA9, 0xFE, 0x6A, 0x2E, 0xDE, 0xFF, 0x62, 0x26, 0x90, 0xEA, 0xA9, 0xFE, 0x0A, 0xFF, 0x2D, 0x00, 0x10, 0x00, 0x00, 0x0C, 0xD0, 0xFF, 0x00, 0x48, 0xF2, 0x24, 0x4F, 0xF2, 0x24, 
+    0xC6, 0x00, 0xE9, 0x10, 0x0F, 0x31, 0x15, 0x53, 0x9B, 0x00, 0xE0, 0x03, 0x3E, 0xEA, 0xA3, 0x26, 0x4A, 0x00, 0x49, 0x92, 0xA4, 0x49, 0x96, 0x1C, 0xFF, 0x3B, 0x31, 0xF5, 0x0E, 0xA6, 0xD0, 0x01, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x54, 0x00, 0x89, 0x91, 0x64, 0x49, 0x9A, 0xE4, 0xFF, 0x46, 0x1D, 0x60, 0x0A, 0xEF, 0x10, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xA7, 0x00, 0x39, 0x15, 0x13, 0x29, 0x97, 0xDC, 0xCB, 0x37, 0x48, 0xA5, 0xD4, 0xE4, 0xF8, 0xBB, 0xDD, 0x21, 0x76, 0x5B, 0x8E, 0x16, 0x46, 0x47, 0x7D, 0x00, 0x4D, 0xC2, 0x27, 0x72, 0x0E, 0x86, 
+    0x49, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0xBD, 0x05, 0xF1, 0x10, 0x0F, 0xF1, 0xD0, 0x0E, 0x7E, 0x00, 0x68, 0x82, 0x26, 0xE8, 0x0F, 0x92, 0x49, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 
+    0x73, 0x00, 0x49, 0x91, 0x58, 0xC9, 0x9B, 0x7C, 0xD9, 0x46, 0xC3, 0x4C, 0xD6, 0x3F, 0x4F, 0x3A, 0x35, 0x00, 0x48, 0x82, 0x24, 0x4B, 0xE2, 0x24, 0xF8, 0x00, 0x6E, 0xEB, 0xFF, 0xEE, 0x90, 0x24, 
+    0xFF, 0x00, 0x6D, 0xFB, 0xFF, 0x00, 0x90, 0x24, 0xBA, 0x00, 0xA4, 0x63, 0x3B, 0x98, 0x93, 0x24, 0x73, 0x00, 0x49, 0x91, 0x54, 0xC9, 0x99, 0xE4, 0xF2, 0x0E, 0xC3, 0xCA, 0xB1, 0x6D, 0xFD, 0x3F, 
+    0x36, 0x00, 0x48, 0xA2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC8, 0x00, 0x89, 0x97, 0x77, 0x31, 0xF5, 0x0E, 0xFF, 0xBE, 0x11, 0x50, 0x00, 0x03, 0x00, 0x00, 
+    0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x8E, 0xE4, 0xC5, 0x16, 0x31, 0x75, 0x0A, 0x1E, 0x56, 0x81, 0xBE, 0x00, 0xD0, 0x38, 0xD6, 0x74, 0xE2, 0x24, 0xC8, 0x00, 0x9C, 0xE0, 0x72, 0xB9, 0x99, 0xBC, 
+    0xC9, 0x08, 0xA3, 0x83, 0xF5, 0x12, 0x3D, 0xAC, 0x1B, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x86, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x14, 0xFF, 0x21, 0xA3, 0x33, 0x1A, 0xA3, 0x33, 0x3A, 0xFF, 0x00, 0x48, 0x8E, 0xE4, 0x48, 0x8E, 0x24, 0xA6, 0x29, 0xC5, 0x5E, 0xF2, 0xD5, 0x63, 0x31, 
+    0x9A, 0x35, 0x85, 0xEC, 0xED, 0x57, 0xFE, 0x31, 0xD8, 0x00, 0x49, 0x90, 0x64, 0x49, 0x9A, 0xE4, 0xD8, 0x19, 0x90, 0xB4, 0x6D, 0xB6, 0x9D, 0xE4, 0xD4, 0x19, 0x12, 0xB4, 0x6D, 0x95, 0x4D, 0x25, 
+    0xB7, 0x19, 0x00, 0x20, 0x49, 0x6D, 0x95, 0x53, 0xE6, 0x19, 0xE3, 0x44, 0x92, 0xB2, 0x8D, 0x24, 0x7F, 0x00, 0x60, 0xA2, 0x26, 0x73, 0xF2, 0x27, 0x9B, 0x00, 0x49, 0x95, 0x13, 0x39, 0x91, 0x13, 
+    0xCA, 0x02, 0x10, 0x8B, 0xF5, 0xA0, 0x83, 0xF5, 0xAD, 0x00, 0x46, 0x19, 0xC4, 0x01, 0x7F, 0xF0, 0xF4, 0x35, 0x1D, 0x60, 0x6E, 0xB6, 0x9D, 0x24, 0xF4, 0x00, 0x40, 0xB2, 0x25, 0x6D, 0x62, 0x27, 
+    0xB8, 0x00, 0x1D, 0x66, 0x4A, 0xEF, 0x94, 0x97, 0xBA, 0x36, 0x4F, 0xCA, 0x72, 0x00, 0x44, 0xB2, 0xBC, 0x2E, 0x53, 0x83, 0xD9, 0xEB, 0xE9, 0x57, 0xB9, 0x39, 0x1E, 0x48, 0xCC, 0x52, 0xA3, 0x3E, 
+    0x64, 0x00, 0x72, 0xD2, 0x24, 0x6E, 0x2D, 0x40, 0x47, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFB, 0x00, 0x49, 0x90, 0xE4, 0xB9, 0x7B, 0x97, 
+    0xC4, 0x41, 0xA0, 0x1D, 0x71, 0x9D, 0xAA, 0x55, 0xFF, 0x00, 0x54, 0x31, 0xE0, 0x7E, 0x5E, 0xFF, 0xB3, 0x49, 0x16, 0x6A, 0xA1, 0x16, 0xEA, 0xA4, 0x33, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xA6, 0x00, 0x31, 0x91, 0x73, 0x39, 0x95, 0x57, 0x7E, 0x00, 0x60, 0x82, 0x26, 0x6D, 0x22, 0x27, 0x84, 0x00, 0x89, 0x97, 0x58, 0x49, 0x95, 0x10, 0xFF, 0x9A, 0x21, 0xF0, 0x01, 0x16, 0x50, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xED, 0x0F, 0xEF, 0xF0, 0x0E, 0x31, 0x15, 0x53, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x27, 
+    0x8A, 0x00, 0x49, 0xEC, 0x0C, 0x79, 0x99, 0xC4, 0xE3, 0x0C, 0x10, 0xBB, 0xD5, 0xA4, 0x63, 0x3F, 0xD2, 0x0D, 0xA2, 0x83, 0xF5, 0x62, 0xCD, 0x3E, 0x39, 0x00, 0x49, 0x98, 0x84, 0x4C, 0x98, 0x04, 
+    0xB9, 0x39, 0x26, 0x69, 0x00, 0x26, 0x99, 0x24, 0xBD, 0x39, 0x24, 0x01, 0x00, 0x2D, 0x91, 0x13, 0xB9, 0x39, 0x24, 0x09, 0x00, 0x24, 0xC9, 0x24, 0xB9, 0x16, 0x5B, 0x03, 0x35, 0x64, 0x63, 0xDB, 
+    0x56, 0x00, 0x89, 0x91, 0x58, 0x89, 0x9F, 0x24, 0x83, 0x00, 0x10, 0xCD, 0x3E, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x38, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 0xFF, 0x2D, 0x31, 0xF5, 0x0E, 0xA6, 0x60, 0x0A, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xC4, 0xCF, 0x4F, 0xD6, 0x5E, 0xF1, 0x05, 0x43, 0x30, 0x2C, 0x00, 0x48, 0xB2, 0x24, 0x4D, 0xE2, 0x24, 0x3B, 0x00, 0x49, 0x90, 0x64, 0x49, 0x98, 0x84, 
+    0xBE, 0x60, 0xD6, 0x7E, 0xC9, 0x19, 0x9C, 0xC1, 0x3F, 0x00, 0x4B, 0xA2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x95, 0x54, 0xFF, 0x0C, 0x83, 0x31, 0x38, 0x9B, 0xD3, 0x3A, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x4B, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD6, 0x00, 0x49, 0x9C, 0x84, 0x49, 0x90, 0x64, 0xB9, 0x39, 0x49, 0x4E, 0x92, 0x00, 0xB0, 0x6D, 0xC7, 0x39, 0x44, 0xB2, 0xB6, 0x92, 0xA4, 0x6D, 
+    0xCD, 0x39, 0x49, 0xD5, 0x56, 0x92, 0x40, 0x52, 0xB9, 0x39, 0x49, 0x42, 0x92, 0x00, 0xC8, 0xAC, 0x50, 0x00, 0x6B, 0x02, 0x27, 0x4A, 0xB2, 0x24, 0x82, 0x00, 0x39, 0x91, 0x78, 0xC9, 0x9B, 0xE4, 
+    0xC0, 0x33, 0x10, 0x3D, 0x68, 0xA5, 0x10, 0x97, 0xC6, 0x1F, 0x7E, 0x43, 0xB6, 0x90, 0x36, 0x48, 0xC2, 0x00, 0x4F, 0x52, 0x3F, 0x63, 0x0F, 0xB1, 0x19, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x2C, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x6E, 0x00, 0x24, 0x9B, 0xC4, 0xC9, 0x97, 0x13, 0xB9, 0x2D, 0xE9, 0x60, 0x62, 0x94, 0x2A, 0xF1, 0xBA, 0x36, 0xBC, 0xE9, 0x53, 0xA9, 0x14, 0x82, 
+    0xAC, 0x17, 0x02, 0x04, 0x09, 0x6C, 0xD9, 0xC4, 0xB6, 0x00, 0xA3, 0x83, 0xF5, 0xC2, 0x3C, 0xAC, 0x52, 0x00, 0x49, 0x9E, 0x84, 0xC9, 0xF5, 0x18, 0xCD, 0x41, 0xF1, 0x64, 0x8A, 0xD5, 0x4C, 0xF0, 
+    0xFF, 0x00, 0xAC, 0xD5, 0x1F, 0x4F, 0x90, 0x04, 0xFF, 0x21, 0xEC, 0x23, 0xF6, 0x18, 0x0D, 0x8C, 0xBC, 0x59, 0x6F, 0xFD, 0xC9, 0xD6, 0x5E, 0x30, 0x33, 0x00, 0x48, 0x82, 0x24, 0x4A, 0xC2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x91, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xFF, 0x0C, 0x82, 0x23, 0x3A, 0xA2, 0x23, 0x1A, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC7, 0x03, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0xF0, 0x43, 0x3F, 0xF4, 0x43, 0x23, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x46, 0x92, 0x24, 0x49, 0x92, 0x24, 0x46, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x05, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x6F, 0x7E, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x94, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xFF, 0x8A, 0x21, 0xF0, 0x01, 0x15, 0x40, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xE4, 0xCE, 0x50, 0x05, 0x53, 0x30, 0x15, 0xEF, 0xCD, 0x37, 0x00, 0x4E, 0xD2, 0x24, 0x4C, 0x82, 0x24, 0x46, 0x00, 0x49, 0x9A, 0x84, 0x49, 0x96, 0x1C, 
+    0xBF, 0x61, 0x19, 0x9C, 0xC1, 0x97, 0x6E, 0x2C, 0x3E, 0x00, 0x48, 0xA2, 0x24, 0x4A, 0xC2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA4, 0x00, 0x89, 0x9B, 0x98, 0x39, 0x15, 0x13, 0xE4, 0x19, 0xFF, 0xDF, 0x3A, 0x5B, 0x0F, 0xD1, 0x3C, 0x00, 0x48, 0x92, 0x24, 0x49, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x56, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xA0, 0x00, 0x24, 0xF7, 0x57, 0x39, 0x15, 0x13, 0xC6, 0x00, 0x58, 0x8B, 0xF5, 0x98, 0x23, 0x3A, 
+    0xFF, 0x17, 0xB6, 0x97, 0x88, 0x80, 0x28, 0x8D, 0xA9, 0x00, 0x23, 0x48, 0x83, 0x7C, 0xDA, 0x27, 0x2C, 0x00, 0x48, 0xB2, 0x24, 0x4D, 0xF2, 0x24, 0x95, 0x00, 0x49, 0x92, 0xFF, 0x31, 0x19, 0x0F, 
+    0x95, 0x00, 0xB9, 0xFB, 0xBF, 0x24, 0x0B, 0xA0, 0xFA, 0x11, 0x5D, 0xDB, 0xDD, 0x1D, 0xD2, 0x21, 0xCD, 0x4E, 0xC4, 0xEC, 0xA9, 0x21, 0x98, 0x82, 0x51, 0x00, 0x4B, 0xA2, 0x27, 0x78, 0x82, 0x27, 
+    0x3D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 0xBB, 0x00, 0x31, 0xF5, 0x0E, 0x1D, 0x44, 0x89, 0xB4, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xD2, 0x27, 0xBE, 0x1B, 0x26, 0x68, 0x82, 0xA7, 0x14, 0x0F, 
+    0x9F, 0x00, 0x4D, 0xDC, 0xC7, 0x6B, 0x09, 0x09, 0xBB, 0x29, 0xD5, 0x4C, 0xCC, 0x03, 0x8F, 0x35, 0x54, 0x00, 0x8E, 0xF1, 0x5C, 0x49, 0x96, 0xC4, 0xCD, 0x4E, 0x44, 0x53, 0xF0, 0x9E, 0x98, 0x0E, 
+    0xA9, 0x00, 0x4F, 0xE2, 0xFF, 0x63, 0x0B, 0x49, 0xBF, 0x00, 0x89, 0x71, 0x77, 0xE5, 0x20, 0x41, 0xBB, 0x2D, 0x03, 0x0F, 0x35, 0x02, 0x4D, 0x89, 0x4D, 0x00, 0x4F, 0x92, 0x24, 0x4D, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x8A, 0x00, 0x39, 0x91, 0x14, 0x49, 0x95, 0x78, 0xFF, 0x12, 0x83, 0x33, 0x38, 0x03, 0x40, 0x01, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xE2, 0x09, 0x31, 0x15, 0x53, 0xEF, 0xF0, 0x0E, 0xFF, 0x00, 0xF0, 0x03, 0x20, 0x05, 0x02, 0x20, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x53, 0x00, 0x11, 0x10, 0xD9, 0x49, 0x92, 0x24, 0x53, 0x00, 0x58, 0xE2, 0x25, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xDF, 0x00, 0x31, 0x77, 0x53, 0xEF, 0x60, 0x0A, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x48, 0x8E, 0x24, 0x48, 0xA2, 0x24, 0xC5, 0x06, 0x1D, 0x66, 0x4A, 0xEF, 0x10, 0x73, 0xBA, 0x00, 0x7D, 0xB2, 0xFA, 0x1A, 0x0B, 0x48, 0xC1, 0x00, 0x89, 0x79, 0x77, 0xE5, 0x24, 0x41, 
+    0xC6, 0x00, 0xC3, 0x0A, 0xD1, 0x5A, 0xBF, 0x3A, 0x13, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x8F, 0x00, 0x39, 0x91, 0x74, 0x49, 0x9C, 0x24, 0xB4, 0x00, 0xD0, 0x3C, 0xF6, 0xF6, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB8, 0x00, 0x31, 0x11, 0x0F, 0xE9, 0x9F, 0x24, 0xA9, 0x00, 0xA0, 0x4F, 0x9E, 0xEA, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x44, 0x92, 0xFF, 0x9F, 0x24, 0x40, 0x00, 0x48, 0xA2, 0x24, 0x4C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9B, 0x00, 0x39, 0x91, 0x57, 0x89, 0x99, 0xC4, 
+    0xE7, 0x00, 0x92, 0x2C, 0xC4, 0x9C, 0x5C, 0x6E, 0xB4, 0x23, 0x44, 0x4E, 0x94, 0x94, 0x00, 0x40, 0xC6, 0x1E, 0x1D, 0x38, 0xAC, 0x10, 0xBD, 0x3A, 0x44, 0x00, 0x78, 0xB2, 0x24, 0x4E, 0x92, 0x24, 
+    0x64, 0x00, 0x49, 0x91, 0x0A, 0xB6, 0x9D, 0x24, 0x9F, 0x00, 0x80, 0x4A, 0xD2, 0xFF, 0x93, 0x24, 0x1A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x85, 0x00, 0xF1, 0x90, 0x98, 0x49, 0x9E, 0x24, 
+    0xB4, 0x00, 0x02, 0x40, 0x8E, 0xB6, 0x9D, 0x24, 0x8D, 0x00, 0x58, 0xC3, 0x3E, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x90, 0x00, 0xA6, 0x90, 0x97, 0x49, 0x9E, 0x24, 
+    0xB4, 0x00, 0x02, 0x40, 0x8E, 0xB6, 0x9D, 0x24, 0xAB, 0x00, 0xD0, 0x48, 0xD6, 0xFE, 0x93, 0x24, 0xFF, 0x00, 0xEE, 0x76, 0x53, 0xF9, 0x9F, 0x1C, 0xF5, 0x00, 0xF5, 0xB3, 0x3A, 0x7F, 0x03, 0x31, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x59, 0x00, 0x89, 0x91, 0x5C, 0x49, 0x98, 0xC4, 0xFF, 0x51, 0x1D, 0x60, 0x02, 0xAF, 0x10, 0xCF, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x3D, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x98, 0x04, 0xFF, 0x37, 0x31, 0xF5, 0x0E, 0xAF, 0x60, 0x0A, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x32, 0x00, 0x49, 0x98, 0x04, 0x49, 0x96, 0x24, 0x9F, 0x00, 0x14, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 0x62, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xB4, 0x00, 0x13, 0x50, 0x72, 0xBF, 0x9D, 0x24, 0xB3, 0x00, 0x80, 0x36, 0xB2, 0xF6, 0x93, 0x24, 
+    0x59, 0x00, 0x60, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x02, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x6A, 0x00, 0x9D, 0x90, 0x9B, 0x49, 0x98, 0x84, 0xAD, 0x2E, 0x04, 0x4B, 0x34, 0x44, 0x43, 0x34, 0x51, 0x00, 0x98, 0xE3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xDA, 0x00, 0xE6, 0x70, 0x53, 0x79, 0x99, 0xD8, 
+    0xFA, 0x3B, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 0x7B, 0x00, 0x89, 0x97, 0x13, 0xA9, 0x90, 0xB6, 0xFF, 0x3B, 0x1D, 0xC0, 0x6D, 0xB6, 0x9D, 0x24, 0xFF, 0x00, 0x00, 0xB2, 0x2D, 0x6D, 0x63, 0x3B, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA6, 0x00, 0x49, 0x92, 0x24, 0x31, 0x11, 0xB3, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x02, 0x64, 0xDB, 0xAC, 0x00, 0x49, 0x92, 0x24, 0xA0, 0x53, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x47, 0x00, 0x49, 0x92, 0x24, 0x49, 0x1E, 0x0F, 0x56, 0x00, 0x49, 0x92, 0x24, 0xF6, 0x0F, 0x40, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x01, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x94, 0x24, 0x49, 0x82, 0x24, 0xAD, 0x00, 0x03, 0x9D, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD6, 0x00, 0x49, 0x92, 0x24, 0x71, 0xF1, 0xCE, 
+    0x96, 0x00, 0x49, 0x92, 0x24, 0xE0, 0x53, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5C, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x95, 0x18, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x14, 0x40, 0xD9, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x64, 0xDB, 0xA6, 0x00, 0x49, 0x92, 0x24, 0xA0, 0x53, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x03, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x26, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x3F, 0x60, 0x03, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x40, 0x02, 0x24, 0x11, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x55, 0x00, 0x49, 0x92, 0x24, 0xC9, 0xCD, 0x01, 0x54, 0x00, 0x49, 0x92, 0x24, 0x7E, 0x02, 0xAD, 
+    0x02, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x49, 0x92, 0x24, 0xB9, 0xED, 0x01, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 
+    0x43, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x14, 0x57, 0x00, 0x49, 0x92, 0x24, 0x76, 0x02, 0xF0, 0x5D, 0x00, 0x49, 0x92, 0x24, 0x89, 0x91, 0x18, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x14, 0x40, 0x01, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x04, 0x40, 0x96, 0x00, 0x49, 0x92, 0x24, 0xE0, 0x03, 0x3E, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x38, 0x00, 0x49, 0x92, 0x24, 0x89, 0xD3, 0x10, 
+    0x22, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA6, 0x00, 0x31, 0x17, 0x13, 0x31, 0x15, 0xB7, 0xCF, 0x4F, 0x6D, 0x0B, 0x09, 0x24, 0x99, 0x78, 0xAC, 0x00, 0xA3, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x6D, 0x00, 0x49, 0x92, 0xA4, 0x89, 0x97, 0x14, 
+    0xC2, 0x2B, 0x71, 0x69, 0x0A, 0x14, 0x26, 0xD0, 0xC2, 0x3A, 0x1C, 0x09, 0x00, 0x2C, 0x97, 0xDC, 0xC7, 0x00, 0xAC, 0xA3, 0xF5, 0xD0, 0x3A, 0x88, 0x2B, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 
+    0xB6, 0x00, 0xF1, 0x16, 0x0F, 0xF1, 0x10, 0xB7, 0xFF, 0x0B, 0x6D, 0xBB, 0x6D, 0x00, 0x60, 0x38, 0xC0, 0x09, 0xDB, 0x06, 0x00, 0x71, 0xE7, 0x0E, 0xC8, 0x16, 0x64, 0x0F, 0xF5, 0x18, 0xBF, 0x3A, 
+    0xC0, 0x00, 0x4B, 0x82, 0x24, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7F, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x97, 0x13, 0xC3, 0x43, 0x69, 0xEB, 0x01, 0x04, 0xA1, 0x10, 
+    0x96, 0x00, 0xE2, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x97, 0x00, 0x89, 0x97, 0x54, 0x79, 0x95, 0x13, 0xD5, 0x53, 0xB6, 0x3D, 0x48, 0x6A, 0x8B, 0x24, 
+    0xD2, 0x53, 0xB6, 0x0D, 0x00, 0x6D, 0x9B, 0x24, 0xA6, 0x00, 0xA3, 0x03, 0x3A, 0xA2, 0x43, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x18, 
+    0xFF, 0x03, 0x79, 0x7B, 0x73, 0xE6, 0xD4, 0x09, 0xFF, 0x00, 0x24, 0xB9, 0x6D, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x24, 0xB9, 0x6D, 0x00, 0x80, 0x24, 0xC0, 0x00, 0x79, 0x97, 0x17, 0x79, 0x97, 0xB6, 
+    0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC6, 0x53, 0x6D, 0x0B, 0x60, 0xE4, 0x96, 0x82, 0x68, 0x00, 0x68, 0x82, 0x26, 0x68, 0x22, 0x27, 
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x43, 0x00, 0x00, 0x6D, 0x62, 0xBD, 0x3E, 0xFF, 0x37, 0x00, 0x40, 0x6E, 0x76, 0x9B, 0xC4, 0xFF, 0x90, 0x00, 0x20, 0x00, 0x15, 0x90, 0x02, 
+    0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xC4, 0x00, 0xC9, 0x9B, 0x97, 0x2F, 0x65, 0x0A, 0xC3, 0x3B, 0x2E, 0x37, 0x00, 0x18, 0x4B, 0x3F, 0xC6, 0x3E, 0x64, 0x0F, 0x88, 0xA5, 0x90, 0x77, 
+    0xC1, 0x00, 0x7E, 0x42, 0x3F, 0xA2, 0x83, 0xF5, 0x21, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x90, 0xA4, 0xD2, 0x42, 0x29, 0x79, 0x42, 0x27, 0x14, 0xB3, 0x83, 0x00, 0x6B, 0x02, 0x26, 0x60, 0x32, 0x27, 
+    0x9E, 0x00, 0x79, 0x97, 0x13, 0x39, 0x91, 0x77, 0xD2, 0x2A, 0xA3, 0x03, 0xF1, 0x10, 0x4F, 0x3A, 0x5D, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x9C, 0x19, 0x90, 0x01, 0x19, 0x90, 0x01, 
+    0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x8B, 0x00, 0x08, 0x80, 0xD0, 0x48, 0x3F, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x23, 0x3E, 0xB7, 0x1D, 0x29, 0x99, 0x02, 0xE9, 0x66, 0xDB, 
+    0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0F, 0xEC, 0x24, 0x9F, 0x24, 0x5D, 0x00, 0x8E, 0xE1, 0x18, 0x8E, 0xE1, 0x18, 
+    0xE8, 0x1F, 0xFE, 0x43, 0xD6, 0xD4, 0x48, 0x40, 0xBE, 0x00, 0x49, 0x52, 0x3F, 0x63, 0x0D, 0x6D, 0x68, 0x00, 0x49, 0x92, 0x24, 0x75, 0x02, 0xB1, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x10, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x79, 0x97, 0x57, 0x79, 0x85, 0x57, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x99, 0x00, 0x49, 0x95, 0x13, 0x39, 0x91, 0x93, 
+    0xCD, 0x06, 0x58, 0x8D, 0xF5, 0x9B, 0x83, 0x39, 0x39, 0x00, 0xCF, 0x91, 0x84, 0x49, 0x98, 0x44, 0xC1, 0x62, 0x97, 0x9C, 0xC1, 0x19, 0xFC, 0xC9, 0x42, 0x00, 0x4A, 0x82, 0x24, 0x48, 0xA2, 0x24, 
+    0xB6, 0x00, 0xF1, 0x1F, 0x0F, 0x71, 0x92, 0x24, 0xC3, 0x00, 0x7F, 0x9C, 0x9B, 0x37, 0x67, 0x0E, 0xC0, 0x3C, 0x1E, 0x36, 0xCC, 0x98, 0x33, 0xD6, 0x6C, 0x00, 0xE0, 0xC3, 0x27, 0x4F, 0x42, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 0xFF, 0x07, 0x79, 0x79, 0x73, 0xE6, 0xD4, 0x09, 0xD8, 0x04, 0x30, 0x15, 0x53, 0x31, 0x15, 0x53, 
+    0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC3, 0x00, 0x39, 0x15, 0x53, 0xE9, 0xF0, 0xAE, 0xF2, 0x13, 0x48, 0x82, 0xFC, 0x77, 0x5B, 0x6E, 
+    0xB9, 0x0D, 0x49, 0x62, 0x3F, 0x64, 0x0D, 0x68, 0x59, 0x00, 0xB6, 0x93, 0x24, 0x4D, 0x02, 0x26, 0x02, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xD8, 0x00, 0x89, 0x9B, 0x77, 0x37, 0x65, 0x0E, 
+    0xCE, 0x0E, 0x43, 0x02, 0xDB, 0xE5, 0x36, 0x49, 0xC6, 0x00, 0x49, 0x52, 0x3F, 0x63, 0x0D, 0x8D, 0x46, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x02, 0x27, 0x13, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0xFF, 0x9B, 0x9C, 0x89, 0x95, 0x10, 0xBF, 0x2D, 0x95, 0x48, 0xCC, 0x03, 0x0F, 0x35, 0x3F, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x81, 0x57, 0x00, 0x90, 0x04, 0xD7, 0x00, 0xA2, 0x23, 0x3E, 0xA2, 0x8F, 0xB1, 0x7D, 0x00, 0xC9, 0x9B, 0xA4, 0xBF, 0xB9, 0x09, 0xFF, 0x00, 0x1D, 0xDA, 0xA1, 0x1C, 0x30, 0x21, 
+    0xFF, 0x00, 0x40, 0x72, 0xE4, 0x40, 0x9E, 0xE4, 0xCD, 0x47, 0xA9, 0x76, 0x82, 0x27, 0x7A, 0xA2, 0x6C, 0x00, 0xE0, 0xB3, 0x27, 0x4B, 0xB2, 0x27, 0x81, 0x00, 0x31, 0x91, 0x58, 0x89, 0x97, 0x78, 
+    0xC5, 0x30, 0x52, 0x23, 0xF0, 0x03, 0x3F, 0xF0, 0x06, 0x00, 0x49, 0x92, 0x24, 0x48, 0xA2, 0x24, 0x4C, 0x00, 0x1E, 0x90, 0xFC, 0x49, 0x92, 0x24, 0x2C, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3A, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x4C, 0x00, 0x00, 0xF3, 0x27, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x3A, 0x15, 0x54, 0x8D, 0x65, 0x5D, 0x3E, 
+    0xDC, 0x00, 0x90, 0x36, 0xB2, 0xB5, 0xFF, 0x27, 0xD5, 0x00, 0x63, 0x5B, 0xFF, 0x4F, 0x92, 0x04, 0x3B, 0x00, 0x98, 0x93, 0x24, 0x49, 0x92, 0x34, 0xA5, 0x1D, 0x49, 0x92, 0xB6, 0x29, 0x90, 0x02, 
+    0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x80, 0x0A, 0xA8, 0x5D, 0x00, 0x8E, 0xE1, 0x18, 0x8E, 0xE3, 0x24, 
+    0xFF, 0x00, 0x14, 0x40, 0x01, 0x49, 0x92, 0xFC, 0xFF, 0x00, 0x90, 0x06, 0x00, 0xF9, 0x6D, 0xB7, 0xE1, 0x4F, 0xAC, 0x0F, 0x8D, 0xB9, 0x5B, 0x6E, 0x9D, 0x00, 0xAC, 0xA3, 0x3D, 0x20, 0x02, 0x2E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x2D, 0x88, 0x85, 0x58, 0x88, 0x85, 0x58, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x9E, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x27, 
+    0xC4, 0x00, 0x98, 0x83, 0x39, 0x48, 0x92, 0xE4, 0xBE, 0x00, 0xC9, 0x9B, 0x97, 0x2F, 0xD5, 0x09, 0xC0, 0x03, 0x83, 0x28, 0xAC, 0x58, 0x3F, 0x3A, 0x29, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 
+    0xAF, 0x00, 0x4E, 0xE2, 0x24, 0x66, 0x62, 0x02, 0xBB, 0x00, 0x26, 0x60, 0x6E, 0xB6, 0xCD, 0x24, 0xC6, 0x00, 0x80, 0xC6, 0x09, 0x2E, 0x97, 0x9B, 0xCB, 0x00, 0xEC, 0x23, 0x3A, 0x58, 0x2F, 0xD1, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD1, 0x00, 0x89, 0x9B, 0x77, 0x37, 0x65, 0x0E, 0xFF, 0x00, 0x14, 0x30, 0x20, 0x42, 0xF2, 0xFF, 0xC3, 0x04, 0xF1, 0x10, 0x0F, 0xF1, 0x70, 0x0F, 
+    0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0xFE, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x0E, 0x84, 0xBC, 0x11, 0xAF, 0x76, 0x0A, 0x2E, 0x99, 0xDF, 0xFF, 0x0F, 0x93, 0x30, 0x01, 0xE4, 0x62, 0xB7, 
+    0xFF, 0xB2, 0x5A, 0x03, 0x80, 0x00, 0x00, 0x00, 0xE3, 0x00, 0xEC, 0x33, 0x3A, 0x5A, 0x8F, 0xF5, 0x58, 0x00, 0x49, 0x9A, 0x64, 0xC9, 0x95, 0x18, 0xCD, 0x51, 0x21, 0xE4, 0x89, 0xC5, 0x4E, 0x30, 
+    0x9C, 0x00, 0xD0, 0xB6, 0xB6, 0x7E, 0xF2, 0x24, 0xCB, 0x00, 0x13, 0x54, 0x0A, 0x37, 0x95, 0x53, 0xBE, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCA, 0x00, 0x79, 0x17, 0x53, 0xEF, 0x60, 0x4A, 0xC4, 0x00, 0x58, 0x2F, 0x3A, 0xEB, 0x43, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA9, 0x00, 0x49, 0x9E, 0xB8, 0x79, 0x17, 0x0F, 0xBD, 0x40, 0x31, 0xD6, 0x09, 0xD2, 0x2A, 0x3E, 0xBD, 0x36, 0x9B, 0x00, 0x40, 0x2D, 0x97, 0xDC, 0xB2, 0x00, 0xEC, 0xA3, 0xD5, 0xC0, 0x3A, 0x80, 
+    0x38, 0x00, 0x49, 0x9C, 0x24, 0x4C, 0x82, 0x24, 0xCD, 0x07, 0x1D, 0x66, 0x4A, 0xEF, 0x10, 0x73, 0xBD, 0x00, 0x7D, 0xB2, 0xFA, 0x1A, 0x0B, 0x48, 0xD8, 0x00, 0x89, 0x79, 0x77, 0xE5, 0x34, 0x09, 
+    0xC6, 0x00, 0x02, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0x96, 0x04, 0xE3, 0x02, 0xB9, 0xFF, 0xB6, 0xE5, 0xD6, 0x41, 0x86, 0x00, 0x4F, 0xC2, 0x27, 0x6A, 0x02, 0x26, 
+    0xA3, 0x00, 0x49, 0x9C, 0x98, 0x39, 0x15, 0x13, 0xE1, 0x00, 0xFE, 0xC3, 0xFA, 0x5A, 0x0D, 0xD1, 0x52, 0x00, 0x49, 0x91, 0xC4, 0x49, 0x92, 0x24, 0xA7, 0x00, 0x9C, 0xE0, 0x92, 0xC9, 0x9D, 0x24, 
+    0xFC, 0x08, 0x93, 0x50, 0x6E, 0x76, 0x99, 0xDF, 0xFF, 0x5D, 0x00, 0x36, 0x61, 0x25, 0x97, 0xBB, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x65, 0x00, 0x16, 0xD0, 0xB6, 0x49, 0x92, 0x24, 
+    0x65, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x65, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x65, 0x00, 0x00, 0xD4, 0xB6, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x4E, 0xEE, 0x58, 0x89, 0x91, 0x18, 
+    0xC1, 0x27, 0xB9, 0x5B, 0x4E, 0x13, 0xB4, 0xB1, 0xBE, 0x1B, 0x9C, 0x00, 0x68, 0x63, 0x5B, 0x3F, 0xBA, 0x00, 0xD0, 0x36, 0xD6, 0xF6, 0x93, 0x24, 0x65, 0x00, 0x18, 0xD3, 0x27, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x2D, 0x88, 0x85, 0x58, 0x88, 0x85, 0x58, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x14, 
+    0xBE, 0x00, 0x89, 0x1B, 0x77, 0xE6, 0xC0, 0x41, 0xBA, 0x30, 0x14, 0x06, 0xCC, 0xA2, 0x43, 0x27, 0x64, 0x00, 0xE0, 0xC3, 0x27, 0x49, 0x42, 0x92, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 
+    0xCB, 0x1D, 0xAF, 0xF5, 0x6E, 0xA9, 0x14, 0x0F, 0x92, 0x00, 0x73, 0x32, 0x27, 0x6A, 0x82, 0xD5, 0x87, 0x00, 0x89, 0x97, 0x78, 0x49, 0xE5, 0x12, 0xC5, 0x30, 0x03, 0x3F, 0xF0, 0x02, 0x0F, 0x35, 
+    0x28, 0x00, 0x4F, 0xF4, 0x04, 0x49, 0x90, 0x04, 0xDD, 0x59, 0xA9, 0x72, 0x92, 0xE7, 0x70, 0xFE, 0xB0, 0x5D, 0x49, 0xB2, 0x6D, 0x00, 0x60, 0xDB, 0xC3, 0x04, 0xED, 0x20, 0x09, 0xD2, 0x10, 0x0E, 
+    0xB0, 0x5D, 0x4B, 0xB2, 0xED, 0x80, 0x6E, 0xFB, 0xB0, 0x00, 0x64, 0x7E, 0xE5, 0x47, 0x72, 0x26, 0xF0, 0x3D, 0xFF, 0xFF, 0xB6, 0xEF, 0x14, 0x0F, 0xFF, 0x0E, 0xB6, 0xED, 0x90, 0x92, 0x04, 0x20, 
+    0xFF, 0x37, 0x47, 0x5C, 0xC0, 0x00, 0x00, 0x00, 0xEC, 0x13, 0x58, 0x8F, 0xF5, 0x5A, 0x2F, 0x3A, 0x5C, 0x00, 0x89, 0x91, 0x18, 0xC9, 0x95, 0x64, 0xC9, 0x47, 0x43, 0x43, 0x30, 0x04, 0x5F, 0xA9, 
+    0x51, 0x00, 0x4F, 0xF2, 0x24, 0x4D, 0x02, 0xB6, 0xC7, 0x00, 0x79, 0x97, 0x57, 0x31, 0xE5, 0x0E, 0xC5, 0x00, 0x98, 0x83, 0x39, 0xA2, 0x23, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x49, 0x9E, 0xA4, 0xC9, 0x97, 0x14, 0xC3, 0x4D, 0x21, 0xE6, 0xA9, 0xC5, 0x3C, 0x34, 0x5E, 0x00, 0x68, 0xB2, 0x27, 0x4D, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xCE, 0x07, 0xF1, 0x90, 0x0E, 0xE9, 0x10, 0x53, 0xA6, 0x00, 0xA2, 0xA3, 0x26, 0xEA, 0x83, 0xD5, 0x45, 0x00, 0x49, 0x98, 0xE4, 0x49, 0xDC, 0x12, 0xCE, 0x4A, 0x27, 0x9A, 0x82, 0x21, 0xE8, 0xA9, 
+    0x54, 0x00, 0x7A, 0x02, 0x27, 0x70, 0xA2, 0x27, 0x65, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xE4, 0xE6, 0xB6, 0xF9, 0x9F, 0x04, 0xDB, 0x2A, 0x63, 0x57, 0x8B, 0x11, 0x8D, 0xF5, 
+    0x7F, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0xF2, 0x24, 0x1A, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xB0, 0x00, 0x15, 0x60, 0x8E, 0xB9, 0x9D, 0x24, 0x74, 0x00, 0x60, 0x32, 0x27, 0x4F, 0x92, 0x24, 
+    0x88, 0x00, 0x39, 0x91, 0x98, 0x09, 0x91, 0x10, 0xAC, 0x00, 0xD0, 0x4A, 0xCC, 0x58, 0xBF, 0x3A, 0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x0B, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x61, 0x00, 0xE6, 0x90, 0xBC, 0x49, 0x92, 0x24, 0x76, 0x00, 0xD8, 0xD3, 0x3D, 0xF9, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x58, 0x89, 0x9F, 0x24, 
+    0x74, 0x00, 0x10, 0x5B, 0x3F, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x2D, 0x88, 0xA5, 0x98, 0x8C, 0x69, 0xDB, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA2, 0x43, 0x3A, 0x94, 0x00, 0x79, 0x97, 0x13, 0x39, 0x91, 0x73, 
+    0xDF, 0x5F, 0x15, 0x2F, 0x6C, 0x24, 0x99, 0x24, 0xB6, 0x5F, 0xB6, 0x0D, 0x00, 0xDB, 0x96, 0x24, 0xB6, 0x5E, 0xB6, 0x0D, 0x00, 0xDB, 0x96, 0x24, 0x4B, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 
+    0xB1, 0x00, 0xE9, 0x90, 0x77, 0x89, 0x9B, 0xE4, 0xC2, 0x43, 0xA2, 0x2D, 0x68, 0x9D, 0x94, 0xBB, 0xBE, 0x46, 0x37, 0x35, 0x01, 0xD2, 0x5A, 0x3F, 0xBC, 0x00, 0x58, 0x3F, 0x3A, 0x74, 0xE2, 0x24, 
+    0x28, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x68, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0xFF, 0x00, 0x00, 0x02, 0x24, 0x48, 0x82, 0x24, 0xC3, 0x04, 0xF1, 0x10, 0x0F, 0xF1, 0x14, 0xB7, 
+    0x96, 0x00, 0xA0, 0x0D, 0x3E, 0xE0, 0x43, 0x9E, 0x60, 0x00, 0x64, 0x92, 0x24, 0x49, 0x02, 0x24, 0xCC, 0x00, 0xEF, 0x10, 0x73, 0xB9, 0x99, 0xDC, 0xFF, 0x51, 0x00, 0x32, 0x09, 0x2E, 0x99, 0xFF, 
+    0xFF, 0x36, 0x00, 0x26, 0x8D, 0x64, 0x6D, 0x3F, 0xA1, 0x00, 0x98, 0xB3, 0x3E, 0x7D, 0xF2, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0x1D, 0x64, 0x0E, 0x71, 0x97, 0xBC, 
+    0xBD, 0x5C, 0x7D, 0x82, 0x6D, 0x94, 0x94, 0xDB, 0xC6, 0x1F, 0x1D, 0x24, 0x88, 0x1A, 0x5D, 0x3F, 0x7D, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC6, 0x00, 0x89, 0x99, 0x77, 0x31, 0xF5, 0x0E, 0xCA, 0x00, 0x12, 0x8D, 0xF5, 0xA2, 0xD3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xCB, 0x34, 0x58, 0x3D, 0x68, 0xE5, 0x94, 0xBB, 0xB6, 0x5C, 0xC9, 0xBB, 0x09, 0x80, 0x66, 0x3F, 0xCB, 0x00, 0x83, 0x08, 0xD1, 0xA3, 0x5F, 0x3F, 
+    0xFF, 0x00, 0x4F, 0xF0, 0x44, 0x49, 0x98, 0xA4, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x60, 0x00, 0x24, 0x89, 0x6D, 0x9B, 0x24, 0xB5, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xD2, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x47, 0x00, 0x39, 0x90, 0xFB, 0x49, 0x92, 0x24, 0x38, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x93, 0x24, 0x49, 0x72, 0x00, 0xFF, 0x00, 0xF9, 0x9F, 0x24, 0x49, 0x02, 0x00, 
+    0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x82, 0x00, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x7F, 0x92, 0x24, 0x49, 0x82, 0xFC, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xF9, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x93, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 
+    0x28, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x9D, 0x90, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x20, 0x00, 0x07, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x33, 0x00, 0x1D, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x50, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0F, 0x00, 0x49, 0x96, 0x24, 0x49, 0x92, 0x18, 
+    0x33, 0x00, 0x14, 0x90, 0x24, 0x49, 0xD2, 0x3A, 0x2A, 0x00, 0xE0, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 
+    0x6B, 0x00, 0x85, 0x9D, 0x24, 0x49, 0x92, 0x24, 0x7E, 0x00, 0xE0, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x18, 0xFF, 0x00, 0xF9, 0x9F, 0x24, 0x49, 0x42, 0x01, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x4F, 0x92, 0x24, 0x49, 0x02, 0xAC, 
+    0x3C, 0x00, 0x49, 0x98, 0x24, 0x49, 0x82, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1E, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x14, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x01, 
+    0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x16, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0xD2, 0x61, 
+    0x4A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x16, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 
+    0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0xD2, 0x61, 0x4A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x0A, 0x81, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x26, 0xC9, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x0E, 0x8A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x72, 0x43, 0xB0, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xC0, 0x08, 0x3A, 0xFF, 0x54, 0x09, 0x00, 0x00, 0xE4, 0x64, 0x9B, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
+    0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x78, 0x00, 0x00, 0x40, 0x10, 0xBB, 0x3E, 0xFF, 0x50, 0x48, 0xA2, 0xAD, 0x6D, 0xFB, 0x24, 
+    0xFF, 0x4F, 0x01, 0x30, 0x09, 0x2D, 0x97, 0xBB, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x03, 0x90, 0x02, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xB1, 0x1D, 0x92, 0xD9, 0x16, 0x00, 
+    0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0xAC, 0xC1, 0x00, 0x76, 0xB2, 0x3E, 0xA2, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC0, 0x40, 0x49, 0x72, 0x92, 0x1F, 0xF0, 0x91, 0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC9, 0x1E, 0xFF, 0x43, 0xD6, 0x90, 0xB6, 0x09, 
+    0x9F, 0x00, 0x49, 0xD2, 0x27, 0xEB, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9C, 0x00, 0x49, 0x92, 0xDC, 0x79, 0xF7, 0x0E, 0xCC, 0x1A, 0xB9, 0xED, 0x72, 0x94, 0x00, 0x6D, 
+    0xCB, 0x41, 0xFF, 0x43, 0xB2, 0x00, 0x44, 0x72, 0xC1, 0x00, 0x7E, 0xC2, 0x3A, 0x1A, 0x0D, 0x8C, 0x37, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x96, 0x00, 0x69, 0x9B, 0x53, 0x39, 0x91, 0x13, 
+    0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0xB0, 0x6D, 0xC0, 0x33, 0x7F, 0x42, 0xB2, 0x00, 0xB4, 0x4D, 0xBE, 0x00, 0x7F, 0xC2, 0xFA, 0x1A, 0x0B, 0x88, 0x4A, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x26, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xD2, 0x40, 0x49, 0xD2, 0xB6, 0x14, 0x44, 0x92, 0xD2, 0x40, 0x49, 0xD2, 0xB6, 0x02, 0x40, 0x92, 0xD2, 0x40, 0x49, 0xDA, 0xB6, 0x80, 0x4A, 0xB2, 
+    0x40, 0x00, 0x48, 0x80, 0xC4, 0x48, 0x8C, 0xC4, 0xC9, 0x40, 0x49, 0xF2, 0xB6, 0x27, 0x70, 0x82, 0xFF, 0x0A, 0xB6, 0xDD, 0xB6, 0xDB, 0xE6, 0x00, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0x80, 
+    0x74, 0x00, 0x6C, 0x82, 0x26, 0x68, 0x82, 0x26, 0x3D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x1C, 0xBE, 0x00, 0xC9, 0x1D, 0x97, 0xE6, 0x44, 0x01, 0xCA, 0x40, 0xF9, 0x5F, 0x92, 0x02, 0x30, 0xB6, 
+    0xC9, 0x1B, 0xF6, 0x33, 0xD6, 0x80, 0xB6, 0x09, 0x9B, 0x00, 0x49, 0xE2, 0x27, 0xEB, 0x83, 0x35, 0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC9, 0x40, 0x4F, 0xF2, 0xB6, 0x27, 0x78, 0x82, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0xB1, 0x1D, 0xF2, 0xD9, 0x1E, 0xE0, 0xF4, 0x40, 0x49, 0xE2, 0xD6, 0xE6, 0x6C, 0xCC, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x40, 0x4F, 0xF2, 0xB6, 0x27, 0x78, 0x82, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xE9, 0x9F, 0x92, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x65, 0x02, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xA9, 0x9D, 0x92, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE5, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x88, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x17, 0x13, 0xC5, 0x40, 0x69, 0xE2, 0x82, 0xC4, 0xAC, 0x35, 0x88, 0x00, 0x60, 0x32, 0x27, 0x4D, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x28, 0x00, 0x20, 0x49, 0x8C, 0x69, 0xDB, 0xDE, 0x00, 0x18, 0x2B, 0xF6, 0xA3, 0xD3, 0x3A, 0x82, 0x00, 0xED, 0x90, 0x78, 0xC9, 0x99, 0x7C, 0xFF, 0x53, 0x14, 0xD0, 0x01, 0x1E, 0xD2, 0x01, 
+    0xFF, 0x00, 0x08, 0x80, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x5D, 0x00, 0x06, 0xAC, 0x10, 0x8D, 0x39, 0xA8, 0x1E, 0x58, 0x3D, 0xC7, 0x8E, 0x17, 0x0F, 0xB1, 0x26, 0xC9, 0xDF, 0x92, 0x02, 0xA0, 0x6D, 
+    0xB9, 0x26, 0xC9, 0x5B, 0x3F, 0x5A, 0x3F, 0xAC, 0xFF, 0x20, 0xA5, 0xF0, 0x52, 0x71, 0x97, 0x98, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x3E, 0x00, 0x0D, 0xD1, 0x58, 0x0F, 0x3A, 0xDD, 0x02, 0x5E, 0x7F, 0xD1, 0x17, 0x1D, 0xAC, 0x29, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x4E, 0xE9, 0x92, 0xCE, 0xE9, 0x90, 0xCE, 0x4E, 0x00, 0x00, 0x80, 0xFF, 0x78, 0x82, 0x27, 0xAA, 0x00, 0xE5, 0xF0, 0x57, 0x49, 0x97, 0x57, 
+    0xCA, 0x12, 0x98, 0x83, 0x35, 0x58, 0x8F, 0x35, 0x43, 0x00, 0x49, 0x92, 0xA4, 0x49, 0x96, 0x1C, 0xCA, 0x33, 0xF1, 0x70, 0x42, 0x1D, 0x48, 0xA9, 0xA9, 0x00, 0x18, 0xBB, 0xFA, 0x7D, 0xE2, 0x24, 
+    0x6A, 0x00, 0x9B, 0x90, 0xBF, 0x49, 0x92, 0x24, 0xC1, 0x10, 0x13, 0xD6, 0x41, 0xAF, 0x10, 0x93, 0x91, 0x00, 0x74, 0xA2, 0x26, 0xE0, 0xA3, 0x39, 0x96, 0x00, 0x39, 0x99, 0x13, 0x39, 0x91, 0x13, 
+    0x8A, 0x00, 0x24, 0x79, 0xF0, 0x01, 0x1F, 0xF0, 0x6B, 0x00, 0x9B, 0xF0, 0xBB, 0x49, 0x92, 0x24, 0xCF, 0x00, 0x14, 0x54, 0x0E, 0x37, 0x95, 0x77, 0xCC, 0x00, 0x74, 0x32, 0x3A, 0x5A, 0x83, 0xF5, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x4A, 0x5D, 0xD2, 0x39, 0x1D, 0xD2, 0x39, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x4F, 0xF2, 0x24, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x3C, 0x00, 0x48, 0xEA, 0xA4, 0x49, 0x9A, 0xA4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xFF, 0x00, 0xB6, 0xE1, 0xFF, 0x4E, 0xE2, 0x24, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x74, 0x00, 0x6B, 0xF2, 0x26, 0x68, 0x92, 0x24, 0xBB, 0x00, 0x89, 0x99, 0x77, 0x31, 0x15, 0x0F, 0xC6, 0x00, 0x83, 0x06, 0xB1, 0x58, 0x2F, 0x3A, 0x64, 0x00, 0xD8, 0xD6, 0x27, 0x49, 0x92, 0x24, 
+    0xAA, 0x00, 0xE5, 0x70, 0x77, 0x89, 0x99, 0xA4, 0xC9, 0x29, 0x98, 0x23, 0xF1, 0xDB, 0x4C, 0xCC, 0x22, 0x00, 0x49, 0xE6, 0x64, 0x4B, 0x86, 0x64, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0x01, 0x9E, 0xE4, 0x49, 0x9E, 0xE4, 0xF4, 0x6B, 0x01, 0x1F, 0xF0, 0x01, 0x9F, 0xF2, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0xFE, 0xE0, 0x0B, 0x7A, 
+    0xC8, 0x19, 0x31, 0x65, 0x0A, 0x1D, 0x36, 0xAC, 0xB3, 0x00, 0x58, 0xBF, 0x3A, 0x74, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x26, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x4B, 0x00, 0x24, 0x93, 0x24, 0x49, 0x9A, 0x18, 0xF5, 0x00, 0x89, 0x7B, 0x97, 0x2E, 0xD5, 0x09, 0xFF, 0x7F, 0x5E, 0x40, 0x00, 0x02, 0x00, 0x00, 
+    0xFF, 0x00, 0x08, 0x80, 0x00, 0xC8, 0x8D, 0xDC, 0xF5, 0x16, 0x58, 0x8F, 0xF5, 0xA2, 0x23, 0x3A, 0xAA, 0x05, 0xAF, 0x70, 0x4A, 0x67, 0x1B, 0x53, 0xB1, 0x32, 0xF4, 0xEF, 0xE4, 0x2D, 0x29, 0x00, 
+    0xBF, 0x41, 0x1E, 0x9A, 0x82, 0x24, 0xB8, 0x81, 0x88, 0x0B, 0x0D, 0xC1, 0x54, 0x8C, 0xC5, 0x78, 0xFF, 0x02, 0x03, 0x30, 0x00, 0x83, 0x31, 0x39, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0xDC, 0x00, 0x58, 0x2F, 0xFA, 0xA2, 0xB3, 0xFE, 0xFF, 0x00, 0xC1, 0x1A, 0x88, 0x81, 0xF6, 0x7F, 0x81, 0x00, 0x4D, 0xB2, 0x27, 0x6A, 0x02, 0x3E, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xD6, 0x56, 0x21, 0x1A, 0xDA, 0x21, 0x16, 0xB6, 0xB5, 0x36, 0x4F, 0xD2, 0xB6, 0x00, 0xB0, 0x6D, 0xBE, 0x36, 0x79, 0x57, 0x0E, 0xC0, 0xB8, 0xE9, 
+    0xBF, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xE2, 0x24, 0x5C, 0x00, 0xC9, 0x95, 0x18, 0x89, 0x91, 0x18, 0xCF, 0x4C, 0x04, 0x4F, 0x30, 0x44, 0x43, 0x34, 0x1F, 0x00, 0x48, 0xC2, 0x24, 0x4D, 0xD2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x3D, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x26, 0x3D, 0x00, 0xC0, 0x92, 0x24, 0x49, 0x92, 0xC4, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0x8A, 0x00, 0x01, 0x1F, 0xF0, 0x01, 0x1F, 0xF0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7C, 0x00, 0x09, 0x91, 0x54, 0x89, 0x95, 0x54, 0xBB, 0x2F, 0x50, 0x23, 0x30, 0x02, 0x2F, 0xF0, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xD6, 0x4A, 0x44, 0x43, 0xDB, 0x84, 0x44, 0x95, 0xFA, 0x3B, 0x49, 0x62, 0xDB, 0xDB, 0x56, 0x00, 0xFA, 0x3B, 0x49, 0x62, 0x3B, 0x5B, 0x83, 0x36, 
+    0x16, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0xF0, 0x04, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x16, 0x62, 0xA8, 0x29, 0x4E, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA8, 0x29, 0x49, 0xD2, 0xB6, 0x80, 0x0A, 0xA8, 
+    0xA8, 0x00, 0xB6, 0x73, 0x32, 0x07, 0x72, 0x20, 0xD0, 0x11, 0xF1, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x9B, 0x00, 0xE0, 0x03, 0x3E, 0xEA, 0xA3, 0x3E, 0xAB, 0x2C, 0x49, 0x42, 0x92, 0x38, 0x81, 0x13, 
+    0xAB, 0x2C, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xAC, 0x2C, 0x49, 0x42, 0xB2, 0x00, 0x2A, 0xA0, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xD6, 0x56, 0xA1, 0x1A, 0xAA, 0x21, 0x14, 0xB6, 
+    0xC2, 0x43, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC2, 0x43, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC2, 0x6B, 0x99, 0x6E, 0xEB, 0x80, 0xDE, 0xE9, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xC9, 0x4A, 0x4C, 0xCA, 0x74, 0xF4, 0x40, 0x82, 
+    0xCF, 0x22, 0x12, 0x0D, 0x3A, 0x12, 0x3F, 0xAC, 0x2C, 0x00, 0x4D, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9A, 0x00, 0x49, 0x97, 0x53, 0x39, 0x91, 0x53, 0xFF, 0x74, 0x1E, 0x40, 0x00, 0x0D, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x46, 0x26, 
+    0xFF, 0x00, 0xC8, 0x8D, 0x00, 0x0B, 0x90, 0x00, 0xF8, 0x17, 0xA4, 0x23, 0x3A, 0x58, 0x8F, 0xF5, 0xBC, 0x22, 0xE9, 0x70, 0x4A, 0x27, 0xF6, 0x4A, 0x92, 0x1F, 0xD8, 0x46, 0xFF, 0x4D, 0x2E, 0x72, 
+    0xCD, 0x43, 0xAE, 0x98, 0x8A, 0x27, 0x48, 0x9E, 0xAA, 0x0E, 0x8D, 0xD9, 0x78, 0x7D, 0xC5, 0x0E, 0xFF, 0x3E, 0x54, 0x40, 0x00, 0x03, 0x20, 0x00, 0xFF, 0x00, 0x01, 0x10, 0x00, 0xC1, 0x16, 0xA0, 
+    0xFF, 0x79, 0x00, 0x08, 0xA8, 0x6D, 0x9B, 0x24, 0xB8, 0x52, 0x4C, 0x42, 0x92, 0x00, 0xD0, 0xB6, 0xB8, 0x52, 0x49, 0x42, 0x92, 0x00, 0xD0, 0x96, 0xC3, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x0F, 0xF5, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x55, 0x69, 0x92, 0xCE, 0xE9, 0x90, 0xCE, 0x55, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x9F, 0x00, 0xE4, 0xF0, 0x57, 0x89, 0x97, 0x78, 
+    0xFF, 0x00, 0x02, 0x32, 0x00, 0x43, 0x31, 0xF4, 0xFF, 0x00, 0xC9, 0x8D, 0xC4, 0x48, 0x8C, 0xE4, 0xD3, 0x56, 0x04, 0x53, 0xF1, 0xDE, 0x7C, 0x82, 0x68, 0x00, 0x4E, 0xD2, 0x24, 0x7B, 0x02, 0x3E, 
+    0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC3, 0x00, 0xF9, 0x15, 0xB3, 0xEF, 0x66, 0x0A, 0x9F, 0x00, 0x5F, 0x43, 0x3A, 0xA0, 0xA3, 0x3E, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0x8A, 0x00, 0x01, 0x1F, 0xF0, 0x01, 0x1F, 0xF0, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xBE, 0x00, 0x89, 0x99, 0x77, 0x31, 0xE5, 0x0E, 0xCB, 0x02, 0x12, 0x0D, 0xF1, 0x58, 0x2F, 0x3A, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x4F, 0x30, 0x04, 0x43, 0x30, 0xFF, 0x00, 0xB6, 0x9D, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x36, 0x8D, 0xD1, 0x49, 0x92, 0x24, 
+    0x16, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0x90, 0x04, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x69, 0x00, 0x00, 0xB0, 0xB6, 0x7B, 0xB2, 0x27, 0x69, 0x00, 0x00, 0xD4, 0xB6, 0x49, 0x92, 0x24, 
+    0x69, 0x00, 0x06, 0xD2, 0x36, 0x49, 0x92, 0x24, 0xD2, 0x00, 0xEF, 0x90, 0x0E, 0x31, 0x95, 0x77, 0xD0, 0x00, 0xEB, 0xB3, 0x3E, 0xA2, 0x83, 0xD5, 0x62, 0x00, 0x00, 0x60, 0xDB, 0x49, 0xF2, 0x24, 
+    0x62, 0x00, 0x00, 0x60, 0x9B, 0xC9, 0x97, 0x17, 0xD0, 0x69, 0x19, 0x93, 0x31, 0x16, 0x53, 0x30, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xFF, 0x52, 0xE9, 0x92, 0xCE, 0xE9, 0x90, 0xCE, 
+    0x52, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x52, 0x00, 0x00, 0x60, 0x9B, 0x49, 0x98, 0x84, 0xB5, 0x6B, 0x11, 0x1E, 0xE1, 0x11, 0x1E, 0xE1, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xBC, 0x24, 0x49, 0xF2, 0xB6, 0xA7, 0x74, 0x42, 0x5F, 0x00, 0x75, 0x02, 0x27, 0x70, 0x02, 0x27, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x82, 0x26, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x4F, 0xE0, 0x00, 0xD4, 0x88, 0xD1, 0x62, 0xBF, 0x3E, 
+    0xC5, 0x16, 0x14, 0xD8, 0x41, 0xA7, 0x10, 0x13, 0xAE, 0x00, 0x7D, 0x42, 0x27, 0xEA, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x79, 0x19, 0x53, 0xF1, 0x10, 0x53, 0xE6, 0x00, 0xAD, 0x33, 0xF6, 0x58, 0x2F, 0xF6, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x63, 0x58, 0x03, 0xD1, 0x80, 0x0A, 0x60, 0xAF, 0x2C, 0xF1, 0xE0, 0x98, 0x74, 0x8E, 0xF5, 0xB1, 0x1A, 0x90, 0x30, 0x6D, 0xAE, 0xFD, 0x24, 
+    0xEA, 0x0C, 0xEC, 0x57, 0x07, 0x4F, 0xFE, 0xBB, 0xFF, 0x00, 0xE4, 0x24, 0x09, 0x7D, 0x40, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x91, 0x14, 0x92, 
+    0xFF, 0x00, 0xB6, 0x0D, 0x24, 0x92, 0x44, 0x92, 0xDF, 0x00, 0xB6, 0x9D, 0x24, 0x48, 0xB2, 0x25, 0x71, 0x00, 0x24, 0x91, 0x58, 0xC9, 0x99, 0xA4, 0xC9, 0x3B, 0x52, 0x33, 0xF0, 0xD4, 0xEC, 0xA9, 
+    0x41, 0x00, 0x49, 0xEC, 0xC4, 0x4B, 0x8C, 0xC7, 0xEE, 0x56, 0xA9, 0x9C, 0xFE, 0xA9, 0x98, 0x0A, 0xEE, 0x2E, 0x4F, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xFF, 0x2E, 0xC9, 0x6B, 0x97, 0xE4, 0x24, 0x00, 
+    0xFF, 0xC3, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xC2, 0x00, 0xA5, 0xF0, 0x0E, 0x71, 0x97, 0xB8, 0xC7, 0x33, 0xEB, 0x83, 0xB1, 0x02, 0x54, 0x4E, 
+    0xC3, 0x29, 0xC9, 0xDD, 0x96, 0x92, 0x20, 0x69, 0xCA, 0x20, 0x1D, 0x36, 0x88, 0x18, 0xCD, 0x3A, 0x6D, 0x00, 0x68, 0xB2, 0x27, 0x4E, 0x92, 0x24, 0x96, 0x00, 0x39, 0x91, 0x73, 0x39, 0x91, 0x13, 
+    0xB4, 0x35, 0xD9, 0x43, 0x92, 0x00, 0x20, 0x49, 0xC8, 0x35, 0x49, 0xDE, 0x96, 0x92, 0xB0, 0x8D, 0xC0, 0x2B, 0x9D, 0x20, 0x60, 0x10, 0xCD, 0x3A, 0x8A, 0x00, 0xA0, 0xB3, 0x26, 0x4D, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xD6, 0x4A, 0x54, 0x43, 0xD5, 0xC4, 0x46, 0x92, 0xB4, 0x35, 0x49, 0x42, 0x92, 0x00, 0x20, 0x49, 0xB4, 0x35, 0x49, 0x42, 0x92, 0x00, 0x28, 0x89, 
+    0xB4, 0x00, 0x76, 0xBE, 0xE5, 0x46, 0x6E, 0xE5, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xB2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7B, 0x00, 0x39, 0x91, 0x78, 0x49, 0x9A, 0x24, 0xC6, 0x2B, 0xC2, 0x4A, 0x61, 0xA6, 0x10, 0x97, 0xBE, 0x25, 0x7E, 0xC2, 0xB6, 0x90, 0x24, 0x49, 
+    0xBA, 0x2D, 0xB9, 0x57, 0x0E, 0x02, 0xA6, 0xB1, 0xB8, 0x5F, 0x90, 0x4E, 0xE9, 0x9F, 0x9E, 0xED, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xD6, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xB2, 
+    0xFF, 0x00, 0x0E, 0xE2, 0x00, 0x8E, 0xE2, 0x30, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB5, 0x6B, 0x11, 0x1E, 0xE1, 0x11, 0x1E, 0xE1, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xB2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xCC, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x95, 0x97, 0xCC, 0x24, 0x7D, 0xB2, 0xB6, 0xD0, 0x36, 0x49, 
+    0xCD, 0x41, 0xA9, 0xD4, 0x81, 0xC2, 0x3A, 0xF6, 0x75, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xE2, 0x24, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x6F, 0xDF, 0x00, 0x75, 0x62, 0x27, 0x74, 0x40, 0x67, 
+    0x9A, 0x00, 0xF1, 0x90, 0x57, 0x89, 0x99, 0xA4, 0xCE, 0x29, 0x98, 0x23, 0xF1, 0xC4, 0xDA, 0x81, 0x54, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6D, 0x00, 0xF1, 0x90, 0xBC, 0x49, 0x92, 0x24, 0x76, 0x00, 0x50, 0x53, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x81, 0xEB, 0x03, 0xAD, 0x00, 0x00, 0x00, 0xFF, 0x4B, 0xFF, 0xCF, 0xB6, 0x92, 0x04, 0x24, 
+    0xFF, 0x63, 0xB9, 0xDB, 0x72, 0x12, 0x00, 0x00, 0xFF, 0x03, 0xAB, 0x33, 0xFA, 0x5A, 0x0D, 0xB1, 0x2D, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x60, 0x00, 0x01, 0x10, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x62, 0x3B, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xCF, 0x00, 0x2D, 0x66, 0xFE, 0x49, 0x92, 0x24, 
+    0x6D, 0x00, 0x72, 0x8E, 0xE6, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x20, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x2D, 0x70, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x6C, 0x00, 0x9C, 0x90, 0xBB, 0x49, 0x92, 0x24, 
+    0x71, 0x00, 0x00, 0xD4, 0xD6, 0x49, 0x92, 0x24, 0x49, 0x00, 0x98, 0xF3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0xB1, 0x10, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x64, 0xFB, 0x49, 0x92, 0x24, 0x43, 0x00, 0x98, 0xF3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0xB8, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x40, 0x6C, 0xC7, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x78, 0xD2, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x50, 0x00, 0xF1, 0x90, 0xC4, 0x49, 0x92, 0x24, 0x73, 0x00, 0x02, 0xE0, 0xB6, 0x49, 0x92, 0x24, 
+    0x6B, 0x00, 0xD0, 0x5A, 0xFF, 0x49, 0x9E, 0x24, 0xA9, 0x00, 0x14, 0x49, 0x81, 0x15, 0x98, 0x24, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x3B, 0x62, 0xDB, 0x49, 0x92, 0x24, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x78, 0xD2, 0x27, 0x49, 0x92, 0x24, 0x3E, 0x00, 0x49, 0x91, 0xE4, 0x49, 0x92, 0x24, 0x72, 0x00, 0x03, 0xE0, 0xB6, 0x49, 0x92, 0x24, 
+    0x6A, 0x00, 0x10, 0x5D, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0x16, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0xD8, 0x61, 0xDB, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x49, 0x86, 0x24, 0x49, 0x92, 0x24, 0xAB, 0x00, 0x1D, 0xE1, 0xEB, 0x49, 0x92, 0x24, 0x74, 0x00, 0x60, 0x62, 0x25, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC9, 0x00, 0x49, 0x92, 0x24, 0xEF, 0xF0, 0xDA, 0x8A, 0x00, 0x49, 0x92, 0x24, 0xE0, 0x53, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x09, 0x90, 0x24, 0x49, 0x72, 0xDB, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x62, 0xDB, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x62, 0x27, 0xFF, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x72, 0xDB, 0xFF, 0x00, 0xC0, 0x98, 0x24, 0x49, 0x62, 0xE7, 0x4E, 0x00, 0x70, 0x92, 0x24, 0x49, 0x22, 0x49, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x18, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x44, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x0E, 0x55, 0x00, 0x49, 0x92, 0x24, 0xB7, 0x0F, 0x40, 0x42, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x3C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x35, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x55, 0x00, 0x49, 0x92, 0x24, 0xF9, 0x4D, 0x01, 
+    0x55, 0x00, 0x49, 0x92, 0x24, 0x7E, 0x02, 0x8D, 0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x68, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x53, 0x00, 0x49, 0x92, 0x24, 0xC9, 0xDD, 0x09, 0x56, 0x00, 0x49, 0x92, 0x24, 0xFE, 0x03, 0x88, 0x1A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x49, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x1C, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x2F, 0x61, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 
+    0xDF, 0x00, 0x49, 0x92, 0x24, 0x58, 0x6F, 0xF7, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x14, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x02, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x92, 0x24, 0x49, 0x91, 0x14, 0xB6, 0x00, 0x49, 0x92, 0x24, 0x00, 0x6D, 0xD3, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x0C, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x0C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x28, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x52, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x38, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x26, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x27, 
+    0xC9, 0x16, 0x29, 0x99, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0x31, 0x19, 0x4F, 0xF1, 0x10, 0x0F, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x50, 0x01, 0xFF, 0x00, 0x64, 0xB2, 0x25, 0x40, 0x02, 0x24, 0x5B, 0x00, 0x49, 0x9E, 0xA4, 0xC9, 0x97, 0x18, 
+    0xF3, 0x4D, 0xB1, 0x7D, 0xAE, 0x1E, 0x5A, 0x09, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x56, 0xB1, 0x1D, 0x4A, 0x21, 0x10, 0x82, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x30, 0x00, 
+    0x18, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xD7, 0x57, 0xB1, 0x1D, 0x4A, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x99, 0x00, 0x49, 0x9E, 0xBC, 0x79, 0x17, 0x0F, 
+    0xC9, 0x34, 0x71, 0x6B, 0x0A, 0x83, 0x06, 0xD1, 0xCD, 0x46, 0x24, 0x09, 0x00, 0x6C, 0xF9, 0xE4, 0xC4, 0x30, 0xAC, 0x03, 0xB1, 0x03, 0x56, 0x0A, 0x94, 0x00, 0x4F, 0xD2, 0x27, 0x6B, 0x82, 0x39, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC0, 0x4F, 0x6D, 0x4B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x4F, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC3, 0x36, 0xAD, 0x03, 0xB1, 0x13, 0x66, 0x0A, 
+    0x89, 0x00, 0x4F, 0xD2, 0x27, 0x6B, 0x02, 0x3E, 0x31, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xC9, 0x00, 0xB9, 0x7B, 0x73, 0xE6, 0xC0, 0x41, 0xCD, 0x46, 0x2E, 0x39, 0x01, 0x1A, 0x5B, 0x3F, 
+    0xCC, 0x47, 0x64, 0x0D, 0x68, 0xE5, 0x94, 0xBB, 0xC4, 0x00, 0x75, 0x32, 0xFA, 0x18, 0x2D, 0xAC, 0x2C, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xC9, 0x16, 0x29, 0x99, 0x0E, 0xE9, 0x90, 0x0E, 
+    0xFF, 0x4F, 0xB6, 0xBD, 0x6D, 0x6E, 0xE1, 0x24, 0xFF, 0x4F, 0xB6, 0x3F, 0x92, 0x2D, 0x94, 0x00, 0xFF, 0x00, 0xF6, 0xC3, 0xFA, 0x5A, 0x0D, 0xB1, 0x23, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 
+    0xBC, 0x00, 0xC9, 0x9D, 0x98, 0x31, 0x95, 0x0E, 0xC6, 0x3F, 0x2F, 0x49, 0x01, 0x10, 0xAB, 0x3E, 0xC2, 0x3A, 0x23, 0x0B, 0x40, 0xE5, 0x90, 0x98, 0xC3, 0x00, 0x75, 0xB2, 0x3E, 0x5A, 0x0F, 0xD1, 
+    0x49, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x00, 0x24, 0xC9, 0x6D, 0x1C, 0x62, 0xDB, 0xD2, 0x24, 0x24, 0x29, 0x09, 0xE9, 0x98, 0x4E, 0xD2, 0x53, 0xB6, 0x2D, 0x01, 0x6D, 0xEB, 0x24, 
+    0xD2, 0x20, 0x64, 0x83, 0x35, 0x64, 0x63, 0x3B, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x6D, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x64, 0x03, 0x35, 0x50, 0x03, 0x35, 0x52, 0x00, 0x89, 0x91, 0x64, 0x49, 0x9A, 0xE4, 0xC8, 0x4A, 0x6D, 0x5F, 0xC9, 0x1F, 0x98, 0x62, 
+    0x67, 0x00, 0x4E, 0xC2, 0x24, 0x7B, 0x82, 0x26, 0xFF, 0x00, 0x21, 0x99, 0x6D, 0x01, 0x90, 0x00, 0xFF, 0x80, 0x49, 0x42, 0xB2, 0xC0, 0x0C, 0xF0, 0x80, 0x00, 0x98, 0x03, 0x26, 0x72, 0xB2, 0x27, 
+    0xB1, 0x00, 0xE9, 0x16, 0x0F, 0x39, 0x95, 0x57, 0xCA, 0x00, 0xEC, 0x23, 0x3A, 0x58, 0x83, 0xF5, 0xFF, 0x00, 0x09, 0x99, 0x6C, 0x09, 0x90, 0x00, 0xFF, 0x80, 0x49, 0x42, 0xB2, 0x40, 0x87, 0xB9, 
+    0xA8, 0x00, 0x73, 0xB2, 0x26, 0xE2, 0x03, 0x3A, 0xFF, 0x00, 0x21, 0x99, 0x6D, 0x01, 0x90, 0x00, 0xFF, 0x3F, 0xB6, 0xBD, 0xF1, 0x58, 0x0F, 0x3A, 0x39, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x10, 0xCF, 0xF1, 0x14, 0x4F, 0xFF, 0x59, 0x15, 0xE0, 0x01, 0xA7, 0x90, 0x0E, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xBB, 0x00, 0x89, 0x99, 0x77, 0x31, 0x95, 0x0E, 
+    0xF9, 0x3B, 0x34, 0x1B, 0x0F, 0xE9, 0x9A, 0xAE, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x37, 0xE7, 0x7B, 0xC2, 0x27, 0x72, 0x82, 0xFF, 0x49, 0x14, 0xD0, 0x01, 0xEF, 0x10, 0x53, 
+    0xFF, 0x00, 0x48, 0x8E, 0xE4, 0x48, 0x0E, 0xE4, 0xD7, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x8E, 0xC7, 0xCD, 0x17, 0x31, 0xF5, 0x0A, 0xA6, 0xE4, 0x61, 
+    0xAE, 0x00, 0x58, 0xAD, 0x3E, 0x73, 0xC2, 0x27, 0x15, 0x00, 0x72, 0x91, 0x24, 0x49, 0x92, 0x24, 0xB4, 0x00, 0xEE, 0x10, 0x53, 0x89, 0x97, 0x9C, 0xCB, 0x11, 0xA2, 0x83, 0xF5, 0x12, 0x3D, 0xD0, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0xF1, 0x18, 0x96, 0x00, 0xB8, 0x8A, 0xA8, 0x88, 0x8A, 0xA8, 0x12, 0x00, 0x92, 0xC0, 0x24, 0x4C, 0xC2, 0x24, 0xC8, 0x00, 0xEF, 0x10, 0x53, 0x31, 0x15, 0x13, 
+    0xB3, 0x00, 0xE2, 0x03, 0x3A, 0x98, 0x03, 0x3A, 0x8F, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xCD, 0x1F, 0x94, 0x38, 0xD0, 0x52, 0x8F, 0x35, 0x50, 0x00, 0xA0, 0xDF, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x37, 0x91, 0xA4, 0x49, 0x92, 0x24, 0xCB, 0x26, 0x94, 0xE8, 0x61, 0xAF, 0x94, 0x0E, 0x88, 0x00, 0x7C, 0x32, 0x27, 0x6A, 0x02, 0x3E, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x6C, 0x57, 0x03, 0xF0, 0x01, 0x0F, 0x35, 0x3D, 0x00, 0x4A, 0x82, 0x24, 0x48, 0xA2, 0x24, 
+    0xCD, 0x0A, 0xE9, 0xF0, 0x0E, 0xE9, 0x10, 0x53, 0xAF, 0x00, 0xEA, 0xB3, 0x26, 0xAA, 0x8F, 0xB1, 0x6F, 0x00, 0x49, 0x91, 0x58, 0x89, 0xCB, 0xFA, 0xB4, 0x00, 0xC0, 0xBC, 0xCD, 0xB6, 0x9D, 0x24, 
+    0x49, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xC8, 0x00, 0xFF, 0x3F, 0x24, 0x43, 0xB2, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0xFF, 0x00, 0xF5, 0x5F, 0x27, 0x75, 0x52, 0x23, 
+    0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCF, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x95, 0x77, 
+    0xC2, 0x00, 0x73, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x34, 0x10, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 0x3C, 0x00, 0x48, 0xC2, 0x24, 0x4E, 0x92, 0x24, 
+    0x7B, 0x00, 0x09, 0x91, 0x54, 0xC9, 0x97, 0x84, 0xCE, 0x30, 0x5A, 0x33, 0xF1, 0x04, 0x4D, 0xCD, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x0F, 0xF0, 0x00, 0xFF, 0x5B, 0x98, 0x0B, 0xDA, 0xEA, 0xBD, 0xE6, 
+    0xCD, 0x04, 0xA2, 0x83, 0xF5, 0x52, 0x2F, 0xD1, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x40, 0xE3, 0x00, 0x58, 0xAF, 0xF5, 0xA2, 0xB3, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xF2, 0x00, 0xE6, 0xF0, 0x4E, 0x37, 0x15, 0x77, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x2E, 0xE4, 0xEC, 0x06, 0x2F, 0xE5, 0x0E, 0xA6, 0xD2, 0x21, 
+    0xC5, 0x45, 0x29, 0x16, 0x62, 0x21, 0x16, 0x62, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xFF, 0x56, 0xE9, 0x9C, 0x0E, 0xE9, 0x90, 0x0E, 0xC6, 0x0A, 0xEF, 0x60, 0x53, 0x8E, 0xE9, 0xBC, 
+    0xFF, 0x00, 0x40, 0x2E, 0xE4, 0x13, 0xCE, 0xE1, 0xD7, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xAA, 0x49, 0x00, 0x78, 0x8C, 0xA7, 0x78, 0x8A, 0xC7, 0xD3, 0x55, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0x82, 
+    0x56, 0x00, 0x78, 0xA2, 0x27, 0x7A, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x5C, 0x89, 0x95, 0x18, 0xD3, 0x4E, 0x04, 0x43, 0x30, 0x04, 0x43, 0x34, 
+    0x56, 0x00, 0x8F, 0xE1, 0x18, 0x8E, 0xF1, 0x18, 0xC9, 0x17, 0xCB, 0xBC, 0xB6, 0xDB, 0x36, 0x48, 0xB9, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 0xCD, 0x31, 0x31, 0x51, 0x4A, 0x93, 0xA8, 0xD1, 
+    0x9E, 0x00, 0xA0, 0xA3, 0x3E, 0x74, 0xE2, 0x24, 0x9C, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xD3, 0x0C, 0x98, 0x83, 0x39, 0x98, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA4, 0x00, 0x49, 0x92, 0xBC, 0x79, 0xE7, 0x0E, 0xD3, 0x13, 0xE9, 0x10, 0x0F, 0xF1, 0x90, 0x0E, 0x95, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x6E, 
+    0xFF, 0x43, 0x4D, 0xD2, 0x18, 0xDD, 0xD6, 0xB6, 0xFF, 0x43, 0x09, 0x60, 0x43, 0xDB, 0xD8, 0xAE, 0xFF, 0x00, 0x10, 0xAB, 0xD5, 0xAC, 0x5F, 0x3F, 0x25, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 
+    0x98, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0xEB, 0x25, 0xCC, 0x1D, 0xD0, 0x38, 0x01, 0x2E, 0x97, 0xDB, 0xC6, 0x50, 0xF5, 0x23, 0x8D, 0x9B, 0x70, 0x77, 0xC9, 0x00, 0x7E, 0xC2, 0x3E, 0x62, 0x0F, 0xD1, 
+    0x49, 0x00, 0xC9, 0x91, 0x3C, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0xFF, 0x3C, 0x0E, 0xE0, 0x00, 0x0E, 0xE0, 0x00, 
+    0xFF, 0x00, 0x49, 0x82, 0x24, 0x40, 0x02, 0x20, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x8B, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0x9C, 
+    0xCA, 0x26, 0x58, 0x23, 0xF1, 0x03, 0x4D, 0xAC, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x0F, 0xF4, 0x40, 0xD0, 0x00, 0x58, 0x2F, 0x3A, 0xE2, 0xB3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x32, 0x00, 0x49, 0x90, 0x64, 0x49, 0x9C, 0x24, 0xC8, 0x39, 0x95, 0xEA, 0x81, 0x27, 0x96, 0x4A, 0xFF, 0x00, 0x0E, 0xE0, 0x40, 0x3D, 0xD4, 0x63, 0xC2, 0x10, 0x98, 0x2B, 0xDA, 0xEA, 0x3F, 0xE7, 
+    0xC8, 0x4F, 0x04, 0x53, 0xED, 0x9E, 0x7C, 0xA2, 0xFF, 0x00, 0x0F, 0xF4, 0x60, 0x0E, 0xE6, 0x88, 0x9A, 0x00, 0xE0, 0xA3, 0x3E, 0x6B, 0x42, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0xB6, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0x93, 0x00, 0x3A, 0xA1, 0x54, 0x8A, 0xA7, 0x9C, 0xFF, 0x0D, 0x42, 0x3C, 0xDC, 0xD4, 0xCB, 0x99, 0xFF, 0x00, 0x1C, 0x42, 0x21, 0x03, 0x22, 0x24, 
+    0xC5, 0x46, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x86, 0xC7, 0x78, 0x82, 0x27, 
+    0xD8, 0x04, 0x1C, 0x6E, 0xEA, 0xEF, 0x14, 0x73, 0xC8, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x8E, 0x27, 0x78, 0x82, 0x27, 0xD0, 0x09, 0x26, 0x66, 0x4A, 0xEF, 0x10, 0x53, 
+    0xC3, 0x00, 0x74, 0x32, 0x3F, 0xA2, 0x8F, 0xB1, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x0D, 0xC9, 0x00, 0x89, 0x99, 0x77, 0x37, 0x55, 0x0E, 0xC9, 0x02, 0x02, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x4B, 0x30, 0x04, 0x43, 0x30, 0x79, 0x00, 0x00, 0xD0, 0xB6, 0x4F, 0xF2, 0x24, 0x73, 0x00, 0xD0, 0x5A, 0x3F, 0x49, 0x92, 0x24, 
+    0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x88, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 0xD0, 0x2A, 0x58, 0x23, 0xF1, 0xC3, 0x5A, 0x89, 0x6A, 0x00, 0x49, 0xFA, 0x9C, 0x7C, 0x8C, 0xB5, 
+    0xD3, 0x16, 0xE6, 0xD0, 0x21, 0xE6, 0x74, 0x53, 0xC9, 0x31, 0xA9, 0x70, 0x42, 0x1D, 0x38, 0xAC, 0x81, 0x00, 0x60, 0xA2, 0x26, 0x73, 0xD2, 0x24, 0xFF, 0x00, 0x37, 0x7D, 0x33, 0x37, 0x73, 0x13, 
+    0x8A, 0x00, 0x24, 0x09, 0xFE, 0xE0, 0x03, 0x3E, 0xC7, 0x00, 0xA5, 0xF0, 0x0E, 0x31, 0x95, 0x77, 0xCA, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC8, 0x20, 0xAF, 0xF4, 0x5A, 0xA9, 0x96, 0x0E, 0x8E, 0x00, 0x6A, 0xAE, 0x26, 0x6A, 0x02, 0xD6, 0x6F, 0x00, 0x2E, 0x91, 0x7C, 0xC9, 0x67, 0x13, 0xD0, 0x44, 0x53, 0x43, 0xF0, 0x04, 0x3F, 0x35, 
+    0x11, 0x00, 0x4C, 0x82, 0x24, 0x48, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0xFF, 0x3C, 0x0E, 0xE0, 0x00, 0x0E, 0xE0, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x8B, 0xBC, 0xC8, 0x8D, 0xC4, 0xCB, 0x42, 0x43, 0x33, 0x30, 0x04, 0x5F, 0xA9, 0x56, 0x00, 0x49, 0xF2, 0x24, 0x4D, 0x82, 0xB5, 
+    0xAC, 0x00, 0x89, 0x97, 0x74, 0x79, 0xE5, 0x0E, 0xCB, 0x0E, 0x52, 0x2F, 0xF5, 0x58, 0x0F, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x49, 0x90, 0x84, 0x49, 0x92, 0x24, 
+    0xCD, 0x28, 0x9D, 0x68, 0x62, 0xAF, 0x94, 0x4E, 0xEE, 0x09, 0x0E, 0xD6, 0x6B, 0xBD, 0x48, 0xAF, 0x77, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCC, 0x00, 0xAF, 0xF0, 0x0E, 0x31, 0x15, 0x53, 0xF1, 0x45, 0x0D, 0xD6, 0x8B, 0xFC, 0x4A, 0xCF, 0x77, 0x00, 0x68, 0x2E, 0x27, 0x7B, 0xC2, 0x24, 
+    0xC6, 0x13, 0x1E, 0x76, 0x4A, 0xEF, 0x10, 0x0F, 0xCA, 0x1F, 0x0D, 0xD6, 0x8B, 0xFC, 0x4A, 0xCF, 0x50, 0x00, 0x70, 0xB2, 0x24, 0x4C, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x16, 0xB7, 0xB4, 0x60, 0xB4, 0x0D, 0x00, 0xDB, 0x96, 0x24, 0xB4, 0x60, 0xB6, 0x0D, 0x00, 0xDB, 0x96, 0x24, 0x93, 0x00, 0xE2, 0x03, 0x3E, 0xE0, 0x33, 0x3E, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x16, 0xB7, 0xFF, 0x00, 0x44, 0x4E, 0xE7, 0x74, 0x52, 0x27, 0xDF, 0x26, 0x5D, 0x67, 0x0A, 0xEF, 0x16, 0xDB, 0xFF, 0x00, 0x42, 0x22, 0x29, 0x64, 0xD2, 0x26, 
+    0xC5, 0x46, 0x29, 0x98, 0x82, 0xE9, 0x98, 0xFF, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x9B, 0xFF, 0xFF, 0x00, 0x0E, 0xE2, 0x28, 0x0E, 0xE3, 0x34, 
+    0x81, 0x00, 0x39, 0x91, 0x78, 0x49, 0x9A, 0xE4, 0xEB, 0x4C, 0x83, 0xDA, 0xAD, 0x26, 0x99, 0xFF, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x84, 0x00, 0x31, 0x91, 0x78, 0x49, 0x9C, 0x24, 
+    0xC4, 0x18, 0x82, 0x48, 0x01, 0xE6, 0x94, 0xBB, 0xB2, 0x67, 0x4F, 0x0E, 0x09, 0x02, 0xF4, 0x3F, 0xC9, 0x13, 0x14, 0x04, 0x8C, 0x63, 0x5D, 0x3F, 0x7E, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x1C, 0xF3, 0x3F, 0x0A, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xC4, 0x00, 0x9D, 0xE0, 0x4E, 0x79, 0x99, 0xDC, 0xC4, 0x4E, 0xAB, 0x0D, 0x68, 0x9C, 0x94, 0xDB, 
+    0xC2, 0x4B, 0x36, 0x37, 0x01, 0xD2, 0x6A, 0x3F, 0xD8, 0x33, 0x58, 0x3F, 0xAD, 0xA6, 0x16, 0x53, 0x9A, 0x00, 0x4F, 0xD2, 0x27, 0xEB, 0x83, 0x35, 0xFF, 0x16, 0x31, 0x11, 0x53, 0x31, 0x19, 0xDB, 
+    0xDF, 0x00, 0x74, 0x42, 0x07, 0x74, 0x56, 0xA7, 0x76, 0x00, 0x09, 0x91, 0x78, 0x49, 0x98, 0xC4, 0xCF, 0x42, 0x53, 0x43, 0xF0, 0x95, 0x7A, 0x83, 0x5C, 0x00, 0x4F, 0xD2, 0x24, 0x7B, 0x82, 0x26, 
+    0xB7, 0x00, 0xEF, 0x10, 0x73, 0x89, 0x9B, 0xE4, 0xC1, 0x44, 0xA2, 0x2D, 0x68, 0x9D, 0x94, 0xBB, 0xC6, 0x51, 0xBF, 0xB9, 0x09, 0xD2, 0x68, 0x3F, 0xC5, 0x00, 0x10, 0x2D, 0xF6, 0xEC, 0xE3, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x94, 0xB6, 0xFF, 0x3C, 0x0E, 0xE0, 0x48, 0x0E, 0xF9, 0xFF, 
+    0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x48, 0xAE, 0x24, 0x4C, 0xD2, 0x24, 0xC5, 0x00, 0x1D, 0x64, 0x0E, 0x37, 0x97, 0xB8, 0xC6, 0x5E, 0xF5, 0x0F, 0x6D, 0x9C, 0x94, 0xFF, 
+    0xCE, 0x33, 0xE5, 0x20, 0x69, 0x1B, 0x5D, 0x3F, 0x9D, 0x00, 0x98, 0xB3, 0x3E, 0x7D, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC4, 0x00, 0xEF, 0x10, 0x53, 0x79, 0x97, 0x78, 0xDF, 0x15, 0x34, 0x0D, 0xD1, 0x58, 0xDF, 0x3A, 0x1D, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x95, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0x98, 0xD2, 0x30, 0xE8, 0x2C, 0xD0, 0x53, 0x6F, 0x37, 0x2B, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 
+    0xB7, 0x00, 0xF1, 0x10, 0x53, 0x79, 0x95, 0x74, 0xDF, 0x0C, 0x13, 0x8D, 0xF5, 0x5A, 0x5F, 0x3A, 0x06, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x03, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x03, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x05, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x9E, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x96, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x23, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x02, 0x94, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x0A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x9D, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x32, 0x00, 0xD0, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x98, 0x00, 0xE9, 0x90, 0x77, 0xC9, 0x9B, 0x24, 0xC4, 0x00, 0x18, 0x23, 0x2C, 0x14, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x48, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x7C, 0x00, 0x84, 0x9D, 0x24, 0x49, 0x92, 0x24, 0x78, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x32, 0x00, 0xA7, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xD0, 0x9A, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x14, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x2E, 0x00, 0x58, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x2E, 0x00, 0x09, 0x96, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x00, 0x98, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x4D, 0x00, 0xC9, 0x91, 0x24, 0x49, 0x92, 0x24, 0x97, 0x00, 0xC2, 0x9F, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x2F, 0x00, 0x09, 0x96, 0x24, 0x49, 0x92, 0x24, 0xA9, 0x00, 0xB8, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x93, 0x00, 0x49, 0xD2, 0xB6, 0xA7, 0x14, 0x0F, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x00, 0x49, 0x62, 0x27, 0x5B, 0x82, 0x24, 0xB4, 0x00, 0x49, 0x92, 0xB8, 0x39, 0xF7, 0x0E, 
+    0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x00, 0x49, 0xE2, 0xD8, 0xCB, 0x8B, 0xC4, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x46, 0x01, 0xC0, 0x00, 0x49, 0x62, 0x3B, 0xDB, 0x02, 0x20, 
+    0x66, 0x00, 0x49, 0x92, 0xA4, 0xC9, 0x97, 0x14, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x26, 0x00, 0xC0, 0x00, 0x49, 0x62, 0x27, 0x5B, 0x02, 0x24, 0xC0, 0x01, 0x49, 0x72, 0xDB, 0xEF, 0xF6, 0x0A, 
+    0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x0A, 0xA8, 0xC0, 0x00, 0x49, 0x62, 0x27, 0x5F, 0x72, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x10, 0x27, 0x71, 0x11, 0x8F, 0xFF, 0x48, 0x50, 0x9F, 0xE4, 0xB2, 0x4F, 0xF6, 0x55, 0x00, 0x4D, 0xD0, 0x64, 0x4D, 0xDA, 0xE4, 0xCC, 0x4B, 0x44, 0x53, 0xED, 0x9F, 0x9A, 0x8A, 
+    0x55, 0x00, 0x4F, 0xD2, 0x24, 0x4B, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB2, 0x00, 0x49, 0x92, 0xB4, 0xC9, 0x96, 0xA0, 0xB2, 0x09, 0x49, 0xD2, 0xB6, 0xDB, 0x26, 0x00, 
+    0xC8, 0x08, 0x49, 0x62, 0x3B, 0x9B, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA8, 0x00, 0x49, 0x92, 0xB4, 0x39, 0x17, 0x0F, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xC0, 0x00, 0x49, 0x62, 0x3B, 0xDB, 0x02, 0x20, 0xB6, 0x00, 0x49, 0x12, 0xB7, 0xF1, 0x16, 0x0F, 0xB6, 0x02, 0x49, 0xD2, 0xB6, 0xDB, 0x06, 0x00, 0xC2, 0x02, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xA1, 0x00, 0x49, 0xD2, 0x3E, 0xE2, 0x03, 0x3E, 0x80, 0x00, 0x49, 0x12, 0xDB, 0xE9, 0x96, 0x13, 0xA4, 0x00, 0x49, 0x62, 0xDB, 0x24, 0x09, 0x00, 0xFF, 0x00, 0x49, 0xF2, 0x27, 0x6D, 0x32, 0x24, 
+    0x9D, 0x00, 0x49, 0x92, 0xDC, 0x79, 0xF7, 0x0E, 0xBC, 0x06, 0xC9, 0xEF, 0xB6, 0x9B, 0x04, 0x49, 0xB4, 0x00, 0x4F, 0x52, 0x3F, 0x1B, 0x0D, 0x8C, 0x29, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 
+    0xB0, 0x00, 0xF1, 0x1F, 0xB7, 0x31, 0x11, 0x13, 0xA9, 0x00, 0xBF, 0x43, 0x3A, 0xA0, 0x03, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x65, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x99, 0x10, 0xC2, 0x00, 0xC9, 0x7F, 0xB7, 0xE5, 0x36, 0x41, 0xBC, 0x00, 0x7F, 0xD2, 0xDA, 0xDA, 0x08, 0x40, 
+    0x70, 0x00, 0x49, 0xF2, 0x24, 0x7C, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC7, 0x11, 0x71, 0x12, 0xB7, 0xF1, 0x10, 0x0F, 0x87, 0x00, 0x67, 0x42, 0x26, 0x60, 0x02, 0x26, 0x36, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xB7, 0x00, 0x49, 0x9E, 0xBB, 0xEE, 0xC6, 0x01, 
+    0xB6, 0x02, 0xFF, 0xD3, 0xD6, 0xD2, 0x06, 0x00, 0x93, 0x00, 0x49, 0xE2, 0x24, 0xEC, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x94, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x17, 0x0F, 
+    0xBE, 0x09, 0xC9, 0xE3, 0xB6, 0xDB, 0x06, 0x60, 0x7D, 0x00, 0x4F, 0xC2, 0x26, 0x44, 0xC2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x6F, 0x00, 0x09, 0x91, 0x7C, 0x49, 0x9A, 0x24, 0xFF, 0x38, 0x14, 0x50, 0x0A, 0xEF, 0x10, 0x53, 0xFF, 0x00, 0x48, 0x82, 0xE4, 0xC8, 0x8D, 0xB8, 0xFF, 0x38, 0x31, 0xF5, 0x0E, 0xA6, 0x40, 0x01, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x8E, 0x24, 0x48, 0x82, 0x24, 0xF4, 0x00, 0xE6, 0xF0, 0x4E, 0x31, 0x97, 0x97, 0xFF, 0x00, 0x00, 0x02, 0x24, 0x42, 0x22, 0x24, 
+    0xE1, 0x00, 0xB9, 0x19, 0x77, 0x2F, 0x65, 0x0E, 0xFF, 0xBD, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xDA, 0x13, 0xE9, 0x10, 0xDB, 0x49, 0x92, 0x0E, 
+    0xFF, 0x00, 0x00, 0x60, 0x03, 0xFF, 0x8F, 0x24, 0xFF, 0x11, 0xC0, 0xED, 0xB8, 0x71, 0xF7, 0x52, 0xD5, 0x00, 0xC3, 0x28, 0xD1, 0x5A, 0xBF, 0x3A, 0x1E, 0x00, 0x78, 0xB2, 0x24, 0x49, 0x92, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x1C, 0xAF, 0xF1, 0x10, 0x0F, 0x72, 0x00, 0x00, 0xB4, 0xB6, 0x4B, 0xB2, 0x24, 0x21, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0xBF, 0x00, 0xA6, 0xF4, 0x0E, 0xF1, 0x10, 0x53, 
+    0xB2, 0x00, 0x74, 0xB2, 0x3E, 0xE2, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x72, 0x00, 0x09, 0x90, 0xB4, 0x49, 0x92, 0x24, 0x84, 0x00, 0x92, 0xD0, 0x12, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xCE, 0x06, 0x31, 0xFD, 0xCE, 0xA6, 0xDE, 0x21, 0xFF, 0x41, 0x1D, 0x60, 0x0A, 0xEF, 0x10, 0x13, 
+    0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xBD, 0x00, 0xF1, 0x18, 0x0F, 0xF1, 0x90, 0x24, 0xFF, 0x00, 0x6D, 0x0B, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x6D, 0x0B, 0x40, 0x00, 0x94, 0x24, 
+    0xA1, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x93, 0x24, 0x5D, 0x00, 0x49, 0x91, 0x84, 0x49, 0x9C, 0x24, 0xF5, 0x2B, 0x1C, 0x60, 0x6E, 0x6F, 0x9B, 0x24, 0xF5, 0x00, 0x40, 0xB2, 0x25, 0x6D, 0x62, 0x27, 
+    0xBF, 0x29, 0xE9, 0x74, 0x62, 0x27, 0x78, 0xDE, 0x87, 0x23, 0xD8, 0xC6, 0x27, 0xB5, 0x3D, 0x01, 0xBD, 0x49, 0x1D, 0x9A, 0x62, 0xB1, 0x46, 0x4A, 0x65, 0x00, 0x7B, 0x22, 0x27, 0x68, 0x82, 0x26, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0xBA, 0x58, 0x00, 0x49, 0x92, 0x24, 0xB6, 0x0F, 0x40, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC9, 0x00, 0x79, 0x17, 0x53, 0xEF, 0xF0, 0x4A, 0xBF, 0x00, 0xD0, 0x28, 0xD6, 0xEB, 0x43, 0x27, 0xC7, 0x00, 0x9C, 0x60, 0x53, 0x79, 0x97, 0xB8, 
+    0xBC, 0x00, 0xA2, 0x83, 0x35, 0x5B, 0xDF, 0xF6, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x13, 0x57, 0x00, 0x49, 0x92, 0x24, 0xB7, 0x2F, 0x40, 
+    0xC7, 0x11, 0xF1, 0x10, 0x0F, 0xF1, 0x70, 0x0F, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x9E, 0x00, 0x89, 0x99, 0x74, 0x39, 0x95, 0x13, 0xEC, 0x35, 0x1D, 0x3B, 0xFA, 0xEB, 0x33, 0x07, 
+    0xEC, 0x2B, 0x76, 0x99, 0xDC, 0xFF, 0x0F, 0xE0, 0xC5, 0x25, 0x98, 0x33, 0xF1, 0xC4, 0x4C, 0xCC, 0x41, 0x00, 0x49, 0x92, 0x24, 0x4E, 0xD2, 0x00, 0xCA, 0x02, 0x31, 0x95, 0x0E, 0xEF, 0xE0, 0x0E, 
+    0xAB, 0x01, 0xD8, 0xA6, 0xDA, 0x6A, 0xA2, 0xB6, 0x4D, 0x00, 0x78, 0xB2, 0x25, 0x49, 0x22, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB2, 0x00, 0xEF, 0x90, 0x53, 0x89, 0x99, 0xBC, 0xE7, 0x25, 0x88, 0xA9, 0x77, 0x2C, 0xD5, 0x89, 0xFF, 0x00, 0x03, 0x20, 0x00, 0x4F, 0xE2, 0x27, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0x75, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9A, 0xE4, 0xE4, 0x00, 0x43, 0x4E, 0xC5, 0xDD, 0x6B, 0x8A, 
+    0xFF, 0x00, 0xE6, 0xD0, 0x09, 0x14, 0x30, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x92, 0x24, 0xDA, 0x00, 0xEF, 0xF0, 0x2E, 0x49, 0x92, 0x24, 
+    0x97, 0x00, 0x49, 0x9C, 0x9C, 0x49, 0x17, 0x0F, 0xCA, 0x38, 0x26, 0x56, 0x89, 0x03, 0x8D, 0x35, 0x74, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x46, 0x62, 0x20, 0x06, 0x60, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x89, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 
+    0xC4, 0x17, 0x98, 0x23, 0xF5, 0x03, 0x4D, 0xAC, 0x21, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x66, 0x00, 0x49, 0x98, 0x7C, 0x49, 0x91, 0x4F, 0xE7, 0x00, 0x1D, 0x42, 0x49, 0x24, 0x69, 0xDB, 0xDB, 0x00, 0xEF, 0x70, 0x53, 0x31, 0x97, 0xB7, 
+    0xFF, 0x00, 0x00, 0x22, 0x29, 0x24, 0x63, 0x3B, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x18, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x04, 
+    0xCB, 0x1D, 0x31, 0x77, 0x4A, 0x1E, 0xE6, 0x81, 0xB5, 0x06, 0x00, 0xB4, 0x91, 0xB5, 0xEF, 0xE4, 0xC2, 0x36, 0x9B, 0xE4, 0x4A, 0xA9, 0x74, 0x42, 0x65, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xB9, 0x4D, 0xF2, 0x2B, 0x0F, 0xA2, 0x28, 0x35, 0xC2, 0x34, 0xDB, 0x28, 0x01, 0x2D, 0x97, 0xBC, 0xCB, 0x00, 0xEC, 0x23, 0xF6, 0x10, 0x3D, 0xAC, 
+    0x1B, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xC2, 0x0D, 0xAF, 0xF4, 0x0A, 0xEF, 0x10, 0x0F, 0x9B, 0x00, 0x73, 0x32, 0x27, 0xEA, 0x83, 0xF9, 0x92, 0x00, 0xC9, 0x9F, 0xD8, 0x49, 0x75, 0x13, 
+    0xAE, 0x0D, 0x49, 0x82, 0xF3, 0x54, 0x8F, 0x35, 0x41, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 0xC4, 0x0F, 0x71, 0xE9, 0x4E, 0x1D, 0x44, 0x89, 0xC5, 0x34, 0xDC, 0x08, 0x09, 0x6C, 0xF9, 0xE4, 
+    0xC7, 0x50, 0x0E, 0xB1, 0x12, 0x1C, 0x71, 0x12, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x39, 0x91, 0x57, 0xC0, 0x2C, 0x92, 0xA4, 0xB6, 0xE0, 0x83, 0x39, 
+    0xAC, 0x0D, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0xDC, 0xB8, 0x58, 0xD2, 0xF2, 0x3F, 0x97, 0x5E, 0x30, 0x46, 0x00, 0xCD, 0xD1, 0x1C, 0xCC, 0xD1, 0x48, 0xC9, 0x40, 0x2D, 0x01, 0x00, 0x2D, 0x91, 0x13, 
+    0xC0, 0x40, 0x24, 0x09, 0x80, 0x24, 0xC9, 0x27, 0x48, 0x00, 0x78, 0x82, 0x27, 0x78, 0x22, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x82, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x9E, 0x24, 0x00, 0x00, 0x40, 0xE6, 0x00, 0xE5, 0x86, 0x51, 0x62, 0xBF, 0x3A, 0xE5, 0x00, 0xF4, 0xB3, 0x3A, 0x62, 0x8F, 0xD1, 
+    0x12, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xE1, 0x00, 0xEF, 0x10, 0x53, 0x71, 0x17, 0x1B, 
+    0xA2, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5C, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x14, 
+    0xCB, 0x20, 0x31, 0x65, 0x4A, 0x1D, 0x36, 0xAC, 0xAE, 0x00, 0x58, 0xAF, 0x3E, 0x74, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x4D, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x82, 0x24, 0x2C, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 
+    0xC6, 0x21, 0x9D, 0xE8, 0x61, 0xA7, 0x96, 0x0E, 0x7E, 0x00, 0x4D, 0xC2, 0x27, 0x72, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x11, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x11, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x11, 0x00, 0x29, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x11, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x13, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 
+    0xCD, 0x00, 0x1D, 0x66, 0x4A, 0x2F, 0x97, 0xBB, 0xB3, 0x45, 0x4E, 0x3E, 0x72, 0x00, 0xD6, 0xD6, 0xAB, 0x46, 0x95, 0x01, 0x06, 0xBC, 0x14, 0xDB, 0x65, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xC1, 0x00, 0x58, 0x2F, 0x3A, 0xA2, 0x23, 0x3A, 0x42, 0x00, 0x89, 0x91, 0x84, 0x49, 0x9A, 0x84, 0xBB, 0x5E, 0x86, 0xFE, 0xC1, 0x19, 0x9C, 0xC1, 
+    0x3C, 0x00, 0x4B, 0xA2, 0x24, 0x48, 0x82, 0x24, 0xA3, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xC3, 0x3D, 0xA0, 0x2F, 0x68, 0x9D, 0x94, 0xBB, 0xBD, 0x40, 0x37, 0x31, 0x41, 0xD2, 0x5A, 0x3F, 
+    0xA9, 0x00, 0x98, 0xB3, 0x3E, 0x75, 0xF2, 0x24, 0x64, 0x00, 0xC9, 0x95, 0x18, 0x49, 0x91, 0x18, 0xCC, 0x37, 0x04, 0x3F, 0x35, 0x53, 0x33, 0x35, 0x21, 0x00, 0x48, 0x9C, 0x24, 0x49, 0x92, 0x24, 
+    0xC7, 0x13, 0xA7, 0x90, 0x0E, 0xF1, 0x90, 0x0E, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x6A, 0x00, 0x49, 0x91, 0x7C, 0x49, 0x9C, 0x24, 0xB9, 0x18, 0xC2, 0x4A, 0x41, 0xE6, 0x94, 0xB7, 
+    0xB2, 0x4C, 0xC9, 0x3B, 0x4E, 0x00, 0xD6, 0xFA, 0xB6, 0x00, 0xC2, 0x8A, 0xF1, 0xA3, 0x53, 0x27, 0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC9, 0x10, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x44, 0x80, 0x08, 0xAC, 0x58, 0x2F, 0x3A, 0xDF, 0x00, 0xF4, 0xD3, 0x27, 0x4E, 0x92, 0x04, 0xFF, 0x6B, 0x58, 0x03, 0xD0, 0x80, 0x2A, 0x69, 
+    0xA1, 0x00, 0x4E, 0x42, 0x27, 0xEB, 0x83, 0x39, 0xFF, 0x00, 0x49, 0x92, 0x00, 0x09, 0x90, 0x48, 0xFF, 0x00, 0x49, 0x02, 0x00, 0x00, 0x20, 0x49, 0xFF, 0x00, 0x31, 0x04, 0x57, 0x70, 0x25, 0x57, 
+    0xA2, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xDF, 0x00, 0xB9, 0x19, 0x73, 0xEF, 0xF4, 0x0E, 
+    0xC3, 0x35, 0x12, 0x8F, 0x39, 0x6B, 0x2B, 0x49, 0xB4, 0x00, 0x4F, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xB4, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0x88, 0xB4, 0x00, 0x49, 0x62, 0x27, 0x5F, 0x72, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x06, 0x60, 0x20, 0x46, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xBC, 0x00, 0xE9, 0x10, 0x53, 0x79, 0x97, 0x98, 0xC4, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x2F, 0xF1, 0x57, 0x00, 0x49, 0x92, 0x24, 0x89, 0x93, 0x18, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x24, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x80, 0x96, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x05, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xCF, 0x08, 0xA2, 0x83, 0xD5, 0xDD, 0x68, 0x4A, 0xBC, 0x00, 0x49, 0xFC, 0xBB, 0x2D, 0x27, 0x09, 0xC3, 0x2B, 0x95, 0x4A, 0xAC, 0x02, 0x8F, 0x39, 
+    0x33, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x32, 0x00, 0xA7, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x10, 0x9F, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5B, 0x00, 0x89, 0x91, 0x5C, 0x49, 0x98, 0xC4, 0xC8, 0x4B, 0x44, 0x53, 0xCC, 0x1E, 0x98, 0x0E, 0xAB, 0x00, 0x4F, 0xE2, 0xDF, 0x23, 0x09, 0x09, 
+    0xC7, 0x2B, 0xE9, 0x60, 0x0A, 0x54, 0x21, 0x1A, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 
+    0x33, 0x00, 0x80, 0x96, 0x24, 0x49, 0x92, 0x24, 0x0D, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC9, 0x10, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x10, 0x4F, 0x3A, 0xFF, 0x93, 0x24, 0x9F, 0x00, 0x49, 0x90, 0x84, 0xC9, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x10, 0x4D, 0xB2, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x09, 0xF0, 0x90, 0xCF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0xA8, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0xA0, 0x43, 0x3A, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x26, 0x60, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x48, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x47, 0x42, 0x26, 0x7F, 0x92, 0x24, 
+    0xFE, 0x3F, 0xF1, 0x10, 0xAF, 0xF1, 0x1E, 0xAF, 0x9E, 0x00, 0x4D, 0xD2, 0xFF, 0x24, 0x09, 0x80, 0x9E, 0x00, 0x49, 0xF2, 0x27, 0x64, 0x72, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x5F, 0x00, 0x49, 0x91, 0x7C, 0x49, 0x9C, 0x24, 0x9F, 0x00, 0xC0, 0x4A, 0x92, 0xFF, 0x9F, 0x24, 0x57, 0x00, 0x89, 0xE1, 0x18, 0x8D, 0x91, 0x18, 0x9E, 0x04, 0x48, 0xF5, 0x57, 0x24, 0x05, 0x40, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0xF1, 0x10, 0x93, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0xE0, 0x40, 0x96, 0x7F, 0x9E, 0x24, 0xB3, 0x00, 0x00, 0xC4, 0x91, 0xB6, 0x9F, 0x24, 0x84, 0x00, 0x58, 0x43, 0x27, 0x4F, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x97, 0x00, 0xA6, 0x90, 0x97, 0x49, 0x9E, 0x24, 0xB3, 0x00, 0x00, 0xC4, 0x91, 0xB6, 0x9D, 0x24, 
+    0x9F, 0x00, 0x22, 0x50, 0x92, 0xFF, 0x9F, 0x24, 0x87, 0x00, 0x60, 0x32, 0x26, 0x76, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC9, 0x00, 0xEF, 0xF0, 0xB6, 0xEF, 0x9F, 0x24, 
+    0x8A, 0x00, 0xE0, 0x33, 0x3E, 0xE6, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9A, 0x00, 0x15, 0x50, 0x92, 0xFF, 0x9F, 0x24, 0x9A, 0x00, 0x00, 0x48, 0x92, 0xFF, 0x9F, 0x24, 0x9A, 0x00, 0x46, 0x42, 0x26, 0x7F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x24, 0xD7, 0x00, 0x83, 0xD9, 0xB6, 0xFF, 0x9F, 0x24, 
+    0xC8, 0x00, 0x58, 0xD3, 0x36, 0x7F, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x1C, 0xBF, 0x00, 0x49, 0x9E, 0xBB, 0xEE, 0xC6, 0x01, 0xB7, 0x00, 0xFF, 0xD3, 0xD6, 0xD2, 0x08, 0x40, 0xC4, 0x01, 0x4E, 0xE2, 0xD9, 0xDD, 0xC6, 0x61, 
+    0x44, 0x00, 0x49, 0x82, 0x24, 0x48, 0x82, 0x24, 0xB0, 0x16, 0x49, 0xF2, 0xB6, 0xA7, 0x74, 0x02, 0xD5, 0x16, 0x49, 0x62, 0xDB, 0xFD, 0xD6, 0x03, 0xD5, 0x00, 0xFF, 0xDF, 0x36, 0x5B, 0x82, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x86, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBF, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x85, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBE, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xAD, 0x16, 0x49, 0xD2, 0xB6, 0x04, 0x48, 0x80, 
+    0x2D, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x09, 0x90, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xAD, 0x16, 0x49, 0xF2, 0xB6, 0xA7, 0x74, 0x02, 
+    0xD5, 0x00, 0xFF, 0xD3, 0x36, 0xDB, 0x42, 0x20, 0xB0, 0x00, 0x49, 0x12, 0xB7, 0x31, 0x17, 0x13, 0xC8, 0x00, 0x49, 0x6E, 0xBB, 0x1B, 0x57, 0x0A, 0xD6, 0x00, 0x7F, 0xD2, 0xDA, 0x1B, 0x0B, 0x68, 
+    0xB7, 0x00, 0x49, 0xFE, 0xBB, 0x2D, 0xC7, 0x01, 0xC5, 0x00, 0x7F, 0xD2, 0xD6, 0xDB, 0x28, 0x40, 0x79, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x02, 0x3E, 0x70, 0x00, 0x49, 0x92, 0x94, 0x49, 0x91, 0x14, 
+    0xC0, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x28, 0x50, 0xD7, 0x09, 0xC9, 0xE3, 0xD6, 0xDC, 0x26, 0x00, 0xB9, 0x00, 0x49, 0x52, 0x27, 0xA3, 0x03, 0xD1, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x10, 0xC2, 0x00, 0x49, 0x7E, 0xB7, 0xE5, 0x36, 0x01, 0xBF, 0x00, 0x7F, 0xD2, 0xD6, 0xDA, 0x08, 0x40, 0x82, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x82, 0x39, 
+    0x30, 0x00, 0x49, 0x92, 0x04, 0x49, 0x90, 0x04, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDC, 0x46, 0x81, 0xB9, 0x00, 0xC9, 0xEF, 0xB6, 0xDC, 0x24, 0x00, 0xC2, 0x00, 0x4F, 0xD2, 0xFA, 0x1B, 0x0B, 0x68, 
+    0x4F, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x26, 0x09, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xB8, 0x00, 0x49, 0x92, 0xD8, 0x37, 0x67, 0x0A, 0xC6, 0x0C, 0x49, 0xD2, 0xD6, 0xDB, 0x06, 0x09, 
+    0xC0, 0x00, 0x71, 0x60, 0xDB, 0xEC, 0x26, 0x0E, 0x87, 0x00, 0x49, 0xD2, 0x26, 0x60, 0x02, 0x26, 0xBF, 0x00, 0x49, 0x62, 0xDB, 0x33, 0x07, 0x53, 0xFF, 0x00, 0x49, 0x60, 0x1F, 0xED, 0xB1, 0x5E, 
+    0xC5, 0x11, 0x59, 0xD3, 0x35, 0x5B, 0x83, 0x35, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xCF, 0x00, 0x49, 0x9E, 0xBB, 0x2E, 0xC7, 0x09, 0xD4, 0x00, 0x7F, 0xD2, 0xDA, 0xDB, 0x38, 0x68, 
+    0x7A, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x02, 0x3E, 0x7B, 0x00, 0x49, 0x92, 0xB6, 0x41, 0x90, 0x24, 0xB1, 0x00, 0x49, 0x62, 0xDB, 0xE6, 0x66, 0x02, 0x71, 0x00, 0x49, 0xC2, 0x26, 0x68, 0x82, 0x26, 
+    0x3A, 0x00, 0x49, 0x92, 0x04, 0x49, 0xE0, 0x04, 0xBA, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x38, 0x88, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDF, 0x72, 0x20, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDD, 0x56, 0x60, 
+    0x51, 0x00, 0x49, 0xA2, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x89, 0x99, 0x54, 0x39, 0x95, 0x13, 0xC8, 0x00, 0x83, 0x26, 0xB1, 0x58, 0x0F, 0x3A, 0x95, 0x00, 0x9B, 0x60, 0x77, 0x49, 0x9A, 0xC4, 0xC4, 0x5F, 0x2B, 0x5A, 0xA2, 0x1F, 0x1A, 0xA2, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xF0, 0x30, 0xF1, 0x10, 0x0F, 0xF1, 0x18, 0x8F, 0xFF, 0x00, 0x3D, 0xD2, 0x27, 0x7D, 0x9E, 0xDB, 0x58, 0x00, 0x49, 0x92, 0x24, 0xF6, 0x03, 0xAC, 
+    0x09, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x83, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9C, 0xB4, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xDB, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x82, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9C, 0x94, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xDB, 0x41, 0x00, 0x49, 0x96, 0x64, 0x49, 0x86, 0x64, 0xAD, 0x6C, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
+    0x2D, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x84, 0xFF, 0x00, 0x09, 0x90, 0x03, 0x49, 0xE2, 0xDA, 0xFF, 0x00, 0x50, 0xA2, 0x25, 0x61, 0x42, 0x27, 0xEC, 0x2D, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0x05, 0x52, 0x20, 0x05, 0x52, 0x20, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x29, 0xA6, 0xD0, 0x01, 0x10, 0x00, 0x07, 0xFF, 0x24, 0x05, 0x06, 0x40, 0x00, 0x80, 0x18, 
+    0xBA, 0x00, 0x93, 0x26, 0xD1, 0x98, 0x03, 0x3A, 0xD0, 0x00, 0xE4, 0x60, 0x53, 0x79, 0x97, 0x77, 0xBE, 0x00, 0xE2, 0x03, 0x3A, 0x98, 0x83, 0x39, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 
+    0xFF, 0x5D, 0x8C, 0xC7, 0x53, 0xD4, 0x40, 0x01, 0xFF, 0x32, 0x30, 0x80, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x4A, 0xA2, 0x83, 0xF5, 0x10, 0x6F, 0xF2, 0x28, 0x00, 0x4D, 0xB2, 0x24, 0x48, 0x82, 0x24, 
+    0xCA, 0x00, 0x79, 0x17, 0x53, 0xEF, 0xF0, 0x0E, 0xB7, 0x00, 0xC0, 0x86, 0xD5, 0xEA, 0x33, 0x27, 0xB4, 0x00, 0x9C, 0x60, 0x73, 0x89, 0x99, 0xA4, 0xC3, 0x18, 0xA2, 0x03, 0xF1, 0xC3, 0x4C, 0xAC, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x4E, 0xC0, 0x04, 0xC2, 0x57, 0x56, 0x68, 0x79, 0x16, 0x6A, 0xC9, 0xA6, 0x00, 0xD0, 0xB6, 0xDA, 0x7D, 0xE2, 0x24, 0xCC, 0x00, 0x1C, 0x64, 0x0E, 0x37, 0x95, 0x53, 
+    0xB6, 0x00, 0x73, 0xA2, 0x3E, 0xA0, 0x83, 0x39, 0x60, 0x00, 0x49, 0x9A, 0x7C, 0x89, 0x95, 0x18, 0xCC, 0x40, 0x26, 0x56, 0xA9, 0x04, 0x3F, 0x35, 0x8B, 0x00, 0x90, 0xC4, 0xB6, 0x4E, 0x9E, 0x24, 
+    0xC7, 0x1E, 0xD3, 0xD0, 0x0D, 0xAF, 0x90, 0x0E, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xFF, 0x30, 0x88, 0x89, 0x58, 0x88, 0x81, 0x58, 0xBB, 0x00, 0xA2, 0x06, 0xB1, 0x58, 0x2F, 0x3A, 
+    0x85, 0x00, 0xC0, 0x4E, 0xF2, 0x49, 0x92, 0x24, 0x5B, 0x00, 0xC9, 0x95, 0x18, 0x89, 0x91, 0x5C, 0xFF, 0x80, 0xA7, 0xE0, 0x01, 0x5F, 0x90, 0x0E, 0xFF, 0x22, 0x96, 0x44, 0x92, 0xB6, 0x8D, 0xE4, 
+    0xA2, 0x00, 0xA0, 0x83, 0x39, 0xA4, 0xE3, 0x3F, 0x85, 0x00, 0x49, 0x92, 0xB4, 0x09, 0x91, 0x10, 0xF1, 0x28, 0x31, 0x76, 0x73, 0x6D, 0xB7, 0x71, 0xC0, 0x01, 0x74, 0x42, 0xDB, 0xDC, 0x0A, 0xAC, 
+    0x3A, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xF9, 0x5F, 0x27, 0x72, 0x22, 0x27, 0x72, 0x22, 0xFF, 0x07, 0x07, 0x72, 0x20, 0x07, 0x72, 0x20, 0xD1, 0x47, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA3, 0x00, 0x31, 0x91, 0x13, 0x39, 0x95, 0x74, 0xCC, 0x00, 0xA2, 0x23, 0x3A, 0x58, 0x2F, 0xB1, 0x6D, 0x00, 0x49, 0x9C, 0xC4, 0xC9, 0x49, 0x0E, 0xC4, 0x5A, 0x21, 0xFA, 0xA1, 0x16, 0xCA, 0xA2, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xB0, 0x30, 0x21, 0x10, 0xE2, 0x21, 0x1A, 0x82, 0xFF, 0x35, 0x71, 0x6B, 0x6E, 0x1D, 0x4C, 0x21, 0xFF, 0x62, 0xF6, 0xB3, 0xD1, 0x80, 0x08, 0x60, 
+    0x9A, 0x00, 0x4D, 0x32, 0x27, 0xEA, 0x03, 0x3E, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x5B, 0x03, 0x34, 0x40, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xF0, 0x29, 0xAD, 0xB3, 0x39, 0x83, 0x33, 0x38, 0xFF, 0x00, 0x4C, 0xBE, 0xE4, 0x48, 0x8E, 0xE4, 0xAD, 0x6C, 0x01, 0x12, 0x20, 0x01, 0x12, 0x20, 
+    0xBF, 0x00, 0xCE, 0xEB, 0x97, 0x36, 0x65, 0x0A, 0xBD, 0x07, 0x1C, 0x26, 0xAC, 0x58, 0x3D, 0x3A, 0x5D, 0x00, 0x60, 0xC2, 0x24, 0x49, 0x92, 0x24, 0xEC, 0x2D, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0x05, 0x52, 0x20, 0x05, 0x52, 0x20, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x29, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0xFF, 0x24, 0x88, 0x81, 0x18, 0x88, 0x81, 0x18, 
+    0xB3, 0x00, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x97, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xBE, 0x00, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 
+    0xF0, 0x29, 0x83, 0x33, 0x38, 0x83, 0x33, 0x38, 0xFF, 0x31, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xB1, 0x68, 0x87, 0x72, 0x28, 0x87, 0x72, 0x28, 0x28, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xC5, 0x0A, 0xAF, 0xF4, 0x0A, 0xEF, 0x10, 0x0F, 0xA3, 0x00, 0x73, 0xB2, 0x26, 0xEA, 0x83, 0xF5, 0x73, 0x00, 0x49, 0x98, 0x84, 0x89, 0x77, 0x13, 0xCB, 0x3F, 0xD5, 0x5E, 0xED, 0x04, 0x3F, 0x35, 
+    0x30, 0x00, 0x4C, 0xC0, 0x04, 0x4D, 0x90, 0x04, 0xCE, 0x6B, 0xD9, 0x92, 0x2D, 0x99, 0x9E, 0xA1, 0x61, 0x00, 0x4D, 0xD2, 0x24, 0x7B, 0x02, 0xDA, 0xC2, 0x00, 0x79, 0x95, 0x53, 0x31, 0xE5, 0x0E, 
+    0xBB, 0x00, 0x98, 0x83, 0x39, 0xA0, 0x23, 0x3E, 0x65, 0x00, 0x49, 0x91, 0x18, 0x89, 0x95, 0x7C, 0xC3, 0x37, 0x53, 0x33, 0x35, 0x03, 0x4F, 0xAC, 0x3A, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x76, 
+    0xC7, 0x13, 0xF1, 0x90, 0x0E, 0xAF, 0x60, 0x0A, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xFF, 0x30, 0x88, 0x89, 0x98, 0x88, 0x89, 0x98, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x88, 0x00, 0x49, 0x9C, 0x24, 0x21, 0x19, 0x54, 0xB8, 0x22, 0x9D, 0x70, 0x97, 0xB6, 0xBF, 0x35, 0xFF, 0x0C, 0x93, 0x40, 0x4E, 0x76, 0x99, 0x98, 
+    0xFF, 0x00, 0x49, 0x02, 0x24, 0x02, 0x20, 0x3A, 0x80, 0x00, 0x09, 0x91, 0x90, 0x49, 0x92, 0x30, 0xC5, 0x28, 0xA8, 0xF8, 0x4A, 0xA9, 0x94, 0x4A, 0x80, 0x00, 0x00, 0x28, 0x92, 0x6A, 0xA2, 0x26, 
+    0x3A, 0x00, 0x4E, 0xE0, 0x04, 0x49, 0x90, 0x44, 0xFF, 0x5F, 0x27, 0x72, 0x22, 0x27, 0x70, 0x0A, 0xFF, 0x07, 0x07, 0x72, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x47, 0xF1, 0x1A, 0xAF, 0xC0, 0x2A, 0xAE, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x6A, 0x00, 0x89, 0x95, 0xA4, 0x69, 0x1B, 0x0B, 0xC1, 0x32, 0x84, 0x66, 0x0A, 0x71, 0xD9, 0xF6, 0xBE, 0x29, 0x24, 0x05, 0x60, 0x23, 0xEB, 0x3F, 0xFF, 0x0D, 0xEC, 0x5A, 0xAF, 0xCE, 0x1A, 0xAC, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xF0, 0x30, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x29, 0x02, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0xFF, 0x31, 0x00, 0x84, 0x98, 0x88, 0x89, 0x98, 
+    0xA8, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xF0, 0x29, 0x83, 0x33, 0x38, 0x83, 0x33, 0x38, 0xFF, 0x00, 0x48, 0x8E, 0xE4, 0x48, 0x8E, 0xE4, 0xC7, 0x6C, 0xD9, 0x92, 0x2D, 0xD9, 0x9A, 0x0D, 
+    0xC4, 0x67, 0x21, 0x4A, 0x30, 0xA0, 0x4C, 0x6B, 0x73, 0x00, 0xEA, 0xD3, 0x27, 0x73, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xEC, 0x2D, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0x05, 0x52, 0x20, 0x05, 0x52, 0x20, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x15, 0x93, 0xFF, 0x29, 0x70, 0x40, 0x47, 0x74, 0x68, 0xDB, 0xFF, 0x24, 0x88, 0xA1, 0x98, 0x8C, 0x69, 0xDB, 
+    0xB3, 0x00, 0x98, 0x83, 0x39, 0x9A, 0x43, 0x3A, 0x97, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x93, 0xBE, 0x00, 0x98, 0x83, 0x39, 0x98, 0x43, 0x3A, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x54, 
+    0xF0, 0x29, 0x83, 0xB3, 0x39, 0xA4, 0x63, 0xDB, 0xFF, 0x31, 0x00, 0x22, 0x29, 0x24, 0x63, 0xDB, 0xB1, 0x60, 0x87, 0x7E, 0xE8, 0xDF, 0x9E, 0x24, 0x28, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x9A, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xC7, 0x33, 0x58, 0x3D, 0x68, 0xE5, 0x94, 0xBB, 0xBE, 0x4C, 0x7F, 0xB7, 0x09, 0xD2, 0x68, 0x3F, 0xC6, 0x00, 0x58, 0x3F, 0x3A, 0xF4, 0xE3, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB0, 0x69, 0x87, 0x74, 0xC8, 0x87, 0x72, 0x28, 0xB5, 0x46, 0xF3, 0x0F, 0x6D, 0x1D, 0x10, 0xB7, 0xBB, 0x2E, 0xA5, 0x20, 0x60, 0x10, 0xDB, 0x3A, 
+    0x82, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0x92, 0x24, 0x34, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 0xC7, 0x00, 0x14, 0x56, 0x0A, 0x2F, 0x97, 0xBB, 0xB4, 0x56, 0x4E, 0xAE, 0x4D, 0x02, 0x64, 0xFB, 
+    0xC7, 0x31, 0x14, 0xA1, 0x19, 0x74, 0xF0, 0x10, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xFF, 0x30, 0x88, 0xA9, 0x98, 0x8C, 0x69, 0xDB, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xD9, 0x16, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x51, 0xA3, 0x83, 0xD1, 0x80, 0x06, 0x00, 0xFF, 0x45, 0xC9, 0xEB, 0x76, 0x9C, 0x60, 0x03, 
+    0xFF, 0xD8, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0xFF, 0x00, 0x7D, 0xD2, 0x23, 0x3D, 0xD0, 0x03, 
+    0xFF, 0x00, 0x49, 0x9E, 0xE4, 0x48, 0x82, 0x24, 0xFF, 0x00, 0xA5, 0x60, 0x4E, 0x37, 0x99, 0xBB, 0xFF, 0x56, 0x00, 0x20, 0x69, 0x64, 0xFD, 0x3F, 0xD1, 0x39, 0x22, 0x38, 0x8B, 0xDE, 0x18, 0xDB, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x90, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 0xFF, 0x05, 0xDB, 0x32, 0x49, 0x9C, 0x50, 0x4E, 0xFF, 0x00, 0x49, 0x92, 0x07, 0x2D, 0x20, 0x69, 0xFF, 0x00, 0xC1, 0x0A, 0xB1, 0x5A, 0xBD, 0xFA, 
+    0x37, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0xF0, 0x30, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x8F, 0xFF, 0x29, 0x0E, 0xE0, 0x00, 0x0E, 0xE0, 0x48, 0xFF, 0x31, 0x88, 0x89, 0x98, 0x88, 0xA9, 0x98, 
+    0xA8, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xF0, 0x29, 0x83, 0x33, 0x38, 0x83, 0x33, 0x38, 0xFF, 0x00, 0x48, 0x8E, 0xE4, 0x48, 0x8E, 0xE4, 0xC9, 0x6C, 0x19, 0x98, 0x31, 0x59, 0x92, 0x2D, 
+    0xDF, 0x00, 0xED, 0x64, 0x73, 0xBF, 0x89, 0xBC, 0xC6, 0x00, 0xEB, 0xA3, 0xF5, 0x10, 0x3D, 0xAC, 0x24, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xEC, 0x2D, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x6F, 
+    0xFF, 0x00, 0x05, 0x52, 0x20, 0x05, 0x52, 0x29, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x58, 0x00, 0x31, 0x9A, 0x24, 0x49, 0x92, 0x24, 0x3E, 0x00, 0x24, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0xA9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xD0, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB0, 0x69, 0x87, 0x72, 0x28, 0x87, 0x72, 0x28, 0x35, 0x00, 0x9B, 0xB0, 0x24, 0x4B, 0xB2, 0x24, 0x32, 0x00, 0x50, 0x93, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x21, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 0xC6, 0x00, 0xB6, 0x9F, 0x24, 0x49, 0x92, 0x00, 
+    0xFF, 0x00, 0x37, 0x16, 0x63, 0x30, 0x37, 0x73, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x29, 0x90, 0x02, 0xA9, 0x94, 0xB6, 0xFF, 0x31, 0x0E, 0xE0, 0x48, 0x0E, 0x69, 0xDB, 
+    0xFF, 0x00, 0x48, 0xA2, 0x24, 0x4C, 0xD2, 0x24, 0x27, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x80, 0x98, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x10, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x8E, 0x00, 0x9D, 0x10, 0x97, 0x49, 0x9E, 0x24, 0x9B, 0x00, 0x00, 0x44, 0xB2, 0xFF, 0x9F, 0x24, 0x6F, 0x00, 0x98, 0x53, 0x27, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9E, 0x00, 0x1E, 0x60, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x33, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0xF0, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x98, 0x43, 0x3A, 0xFF, 0x93, 0x24, 0x70, 0x00, 0x49, 0x91, 0x54, 0x49, 0x9D, 0x24, 0xB0, 0x00, 0x00, 0x4D, 0xD2, 0xFF, 0x9D, 0x24, 0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x4F, 0xC1, 0x16, 0xFF, 0x29, 0x84, 0x43, 0x38, 0x84, 0x33, 0x00, 0xFF, 0x00, 0x48, 0x8E, 0xE4, 0x48, 0x8E, 0x24, 0x9F, 0x00, 0x03, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x48, 0xCA, 0xE4, 0x7F, 0x92, 0x24, 0xD4, 0x00, 0x94, 0xD8, 0x61, 0xFE, 0x9F, 0x24, 0x8A, 0x00, 0x7C, 0xB2, 0x26, 0x60, 0x92, 0x24, 0x9F, 0x00, 0x1E, 0x60, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x42, 0x32, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x24, 0xB0, 0x00, 0x04, 0xD8, 0xB6, 0x49, 0x92, 0x24, 0x29, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x07, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x24, 0x86, 0x00, 0x01, 0x40, 0x92, 0x49, 0x92, 0x24, 
+    0x86, 0x00, 0x00, 0x40, 0x92, 0x49, 0x92, 0x24, 0x86, 0x00, 0x60, 0x42, 0x26, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x46, 0x00, 0x49, 0x98, 0x64, 0x49, 0x94, 0x1C, 
+    0xFF, 0x5A, 0xF9, 0xFD, 0x72, 0x27, 0xE0, 0x05, 0xFF, 0xC8, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -769,18 +663,47 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x32, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0xA2, 0x10, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x04, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0xE2, 0x04, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x07, 0x52, 0x00, 0x89, 0x91, 0x24, 0x49, 0x22, 0x49, 
+    0xFF, 0x00, 0xD4, 0x91, 0x24, 0x49, 0xE2, 0x24, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x62, 0xDB, 0xFF, 0x00, 0x48, 0x92, 0x24, 0x49, 0x62, 0xFB, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x01, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x0B, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x92, 0x04, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 
+    0x0E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x48, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x3F, 0x01, 0x48, 0x00, 0x49, 0x92, 0x24, 0x7F, 0x82, 0x26, 0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x52, 0x00, 
+    0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x25, 0x48, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x6F, 0x00, 0x44, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x02, 0xDB, 0x4D, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 
+    0x16, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB4, 0x00, 0xEF, 0x16, 0x0F, 0x39, 0x95, 0x77, 0xBF, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x03, 0xF5, 0xFF, 0x00, 0x21, 0x99, 0x6D, 0x01, 0x90, 0x00, 0xD8, 0x0F, 0x24, 0x2B, 0xD1, 0x58, 0x2F, 0x3A, 
+    0x4D, 0x00, 0xCD, 0x91, 0x64, 0x49, 0x9A, 0xC4, 0xC7, 0x4E, 0x6D, 0x63, 0xCD, 0x9F, 0x9A, 0x82, 0xFF, 0x00, 0x0F, 0xF9, 0x6C, 0x0E, 0xE0, 0x07, 0xDC, 0x64, 0xB6, 0xB3, 0xED, 0xE8, 0xAC, 0xB2, 
+    0xFF, 0x00, 0x4F, 0xE8, 0x6C, 0x4E, 0xD0, 0x07, 0xFF, 0x37, 0x6D, 0xBD, 0xF1, 0x58, 0x2F, 0x3A, 0xFF, 0x00, 0x4E, 0xF8, 0x64, 0x49, 0x90, 0x04, 0xFF, 0x81, 0x49, 0x42, 0x92, 0x00, 0x04, 0x00, 
+    0xD5, 0x00, 0x75, 0xB2, 0x3E, 0xA2, 0x8F, 0xD1, 0xF3, 0x00, 0x24, 0x29, 0x69, 0xC1, 0x18, 0xB1, 0x81, 0x00, 0x50, 0x03, 0x3E, 0x73, 0xD2, 0x24, 0x81, 0x00, 0xF9, 0x90, 0x14, 0x89, 0x97, 0x9C, 
+    0xFF, 0x81, 0x49, 0x52, 0x92, 0x1E, 0x10, 0x02, 0xFF, 0x00, 0x4C, 0xBE, 0xC4, 0x48, 0x9C, 0xBC, 0xFF, 0x5D, 0xB1, 0x7D, 0x92, 0x1E, 0xD0, 0x01, 0xFF, 0x00, 0x64, 0xB2, 0x25, 0x40, 0x02, 0x24, 
+    0xC0, 0x22, 0x29, 0x99, 0x0A, 0x29, 0x99, 0xFF, 0xFF, 0x37, 0x6D, 0xBB, 0x6D, 0x40, 0x93, 0xC4, 0xC5, 0x61, 0xB6, 0x0D, 0xA0, 0x9F, 0x4A, 0x30, 0x7F, 0x00, 0x7C, 0x82, 0x27, 0x7B, 0xD2, 0x24, 
+    0x7C, 0x00, 0xC9, 0x9B, 0x58, 0x49, 0x91, 0x14, 0xFB, 0x32, 0x6E, 0xCB, 0x8D, 0x83, 0x3C, 0x28, 0x60, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 0xA5, 0x15, 0x29, 0x99, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xD7, 0x18, 0x31, 0x19, 0x4F, 0x71, 0x11, 0x1F, 0xF9, 0x14, 0xAD, 0x33, 0xF6, 0x58, 0xDF, 0xD5, 0x07, 0x00, 0x49, 0x92, 0x24, 0x4B, 0x82, 0x24, 
+    0xFF, 0x5A, 0x00, 0x00, 0x60, 0x92, 0xD8, 0xB4, 0xFF, 0x2B, 0x10, 0x30, 0x6E, 0x75, 0xEB, 0xDC, 0xFF, 0x25, 0x40, 0x23, 0x60, 0x93, 0x5A, 0x6E, 0xE4, 0x24, 0x26, 0x2D, 0xD1, 0x58, 0x3F, 0x3A, 
+    0x16, 0x00, 0x48, 0xB2, 0x24, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x6C, 0x00, 0x49, 0x91, 0x58, 0x49, 0x98, 0xC4, 0xC9, 0x3B, 0x53, 0x43, 0xF0, 0xD5, 0xEC, 0xA9, 0xFF, 0x00, 0x09, 0xF4, 0x40, 0x8F, 0xE6, 0x88, 0xA7, 0x00, 0x98, 0x23, 0x3E, 0x73, 0xC2, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC8, 0x00, 0xA6, 0xF4, 0x4A, 0xEF, 0x10, 0x53, 0xFB, 0x00, 0x7D, 0x50, 0x07, 0xF4, 0xC5, 0x7E, 0xC4, 0x49, 0xE8, 0x24, 0x13, 0x7B, 0xD5, 0x7C, 
+    0xFF, 0x00, 0x75, 0x40, 0x07, 0xEC, 0xB5, 0x5E, 0xD7, 0x00, 0x58, 0x2F, 0x3A, 0xA2, 0xB3, 0x3E, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0xE4, 
+    0xF9, 0x14, 0x18, 0x1D, 0xAF, 0x2F, 0x65, 0x76, 0xBB, 0x00, 0x17, 0x8D, 0xF5, 0xA2, 0x43, 0x27, 0x0D, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x36, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 
+    0xFF, 0x2D, 0xA6, 0x60, 0x0E, 0xEF, 0x10, 0x53, 0xBB, 0x00, 0x89, 0x97, 0x77, 0x31, 0x95, 0x0E, 0xFF, 0xB5, 0x11, 0x60, 0x00, 0x04, 0x20, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0x61, 0x00, 0x4E, 0x62, 0x24, 0x49, 0x9C, 0x7C, 0xBB, 0x00, 0x31, 0xF7, 0x0E, 0x1D, 0x40, 0x61, 0xC3, 0x00, 0x10, 0x2D, 0xFA, 0xEB, 0xD3, 0x27, 0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xFF, 0x0F, 0x83, 0x32, 0x20, 0x83, 0x33, 0x38, 0xFF, 0x00, 0x7D, 0xD2, 0x27, 0x7D, 0x82, 0x27, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xFF, 0x06, 0x77, 0x74, 0x07, 0x77, 0x7C, 0xC4, 0xC6, 0x47, 0x45, 0x53, 0x34, 0x45, 0x53, 0x34, 0x07, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x6C, 0x00, 0x16, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x70, 0x5A, 0x27, 0x49, 0x92, 0x24, 0x7A, 0x00, 0x14, 0x70, 0xB7, 0x49, 0x92, 0x24, 0x71, 0x00, 0x58, 0x53, 0x27, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -788,6 +711,14 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xBE, 0x01, 0x1D, 0x64, 0x4A, 0xEF, 0x10, 0x13, 0xBB, 0x1E, 0x0D, 0xC8, 0xAB, 0xF4, 0x3C, 0xF1, 0x45, 0x00, 0x78, 0xC2, 0x24, 0x4E, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA0, 0x00, 0x31, 0x91, 0x53, 0x49, 0x97, 0x98, 0xDE, 0x36, 0x6B, 0xA6, 0x9E, 0xE3, 0x3B, 0xAC, 0x8B, 0x00, 0x2A, 0x31, 0x57, 0xBC, 0xD7, 0x9C, 
+    0xC9, 0x45, 0x68, 0x20, 0x5E, 0x9B, 0x49, 0xA0, 0x85, 0x00, 0xE0, 0xA3, 0x26, 0x73, 0xC2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xC9, 0x9B, 0x98, 0x31, 0xF5, 0x0E, 
+    0xFF, 0x00, 0x5C, 0x39, 0xB9, 0xC2, 0x2D, 0xE5, 0xFF, 0x00, 0x7B, 0x42, 0x01, 0x9D, 0x50, 0x4E, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x49, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC9, 0x00, 0xEF, 0x10, 0x53, 0x79, 0x97, 0x74, 0xFF, 0x1E, 0x31, 0xF5, 0x52, 0xEF, 0x30, 0x0A, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xDD, 0x00, 0x89, 0x9B, 0x77, 0x2F, 0xF5, 0x0E, 0xC5, 0x3A, 0x03, 0x8D, 0x39, 0xAA, 0xBD, 0x6D, 0xA1, 0x00, 0x4E, 0xF2, 0xFF, 0x24, 0x09, 0x40, 0x4E, 0x00, 0x49, 0xD2, 0xC6, 0x78, 0x8C, 0xC7, 
+    0xC0, 0x00, 0x89, 0x67, 0x77, 0xE5, 0xD4, 0x61, 0xFF, 0x00, 0x83, 0x33, 0x20, 0x4F, 0x52, 0x3F, 0xFF, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xFF, 0x00, 0x41, 0x9C, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x0B, 0x1C, 0x0D, 0xD1, 0xF9, 0xF8, 0x76, 0x9F, 0x00, 0x49, 0x62, 0x3B, 0xE3, 0x03, 0x3E, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -796,6 +727,14 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9A, 0x00, 0x31, 0x91, 0x57, 0x89, 0x9F, 0x24, 0xCE, 0x00, 0x58, 0x5F, 0x3A, 0xFB, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x51, 0x00, 0x89, 0x91, 0x64, 0x49, 0x98, 0x24, 0xCA, 0x00, 0xC3, 0xCA, 0xAE, 0xD7, 0x9D, 0x24, 0x3C, 0x00, 0x4C, 0xE0, 0x64, 0x49, 0x9C, 0x24, 
+    0xB5, 0x00, 0x03, 0x48, 0xB2, 0xD7, 0x9A, 0x24, 0x32, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 0x36, 0x00, 0x49, 0x9C, 0x04, 0x49, 0x98, 0x24, 0x9F, 0x00, 0x1D, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x42, 0x26, 0xFF, 0x93, 0x24, 0x9F, 0x00, 0x1E, 0xF0, 0x92, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x7D, 0x00, 0x49, 0x93, 0x14, 0x49, 0x91, 0xB4, 
+    0xFD, 0x00, 0xC9, 0xBB, 0xDC, 0x4B, 0x6C, 0xE4, 0xFF, 0x65, 0x9D, 0xE0, 0x01, 0xA7, 0x90, 0x0E, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0x9F, 0x00, 0x26, 0x60, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x44, 0x92, 0xFF, 0x9F, 0x24, 0x4E, 0x00, 0x78, 0x8C, 0xC7, 0x6D, 0x9C, 0xC4, 
+    0xF6, 0x08, 0xA6, 0x66, 0x0B, 0x89, 0x6A, 0xAA, 0xCE, 0x00, 0xA3, 0x83, 0x35, 0x58, 0x8F, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0x49, 0x96, 0x04, 0xC9, 0x91, 0x1C, 0xC5, 0x47, 0x9E, 0x56, 0xD0, 0x05, 0x53, 0x30, 0x89, 0x00, 0x98, 0x43, 0x32, 0x4F, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -807,6 +746,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 
+    0xFF, 0x00, 0x2D, 0xBE, 0x21, 0x24, 0x60, 0x03, 0xFF, 0x20, 0xEF, 0xF0, 0x52, 0x31, 0x85, 0x77, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x9E, 0xE4, 0x49, 0x9E, 0x04, 
+    0xFF, 0x3C, 0x6F, 0x7C, 0xC4, 0x40, 0x0C, 0xC4, 0xCE, 0x0F, 0x98, 0x83, 0x39, 0x98, 0x83, 0xF9, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0xE1, 0x16, 0xC5, 0x47, 0x05, 0x53, 0x30, 0x05, 0x53, 0x30, 0x07, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -818,6 +762,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x3B, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x97, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x02, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
+    0xFF, 0x3B, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x5B, 0x73, 0x22, 0xB6, 0x90, 0x0A, 0x24, 0x60, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x92, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x9E, 0x18, 0x29, 0x99, 0x02, 0x29, 0x90, 0x92, 0xC5, 0x00, 0xC3, 0x2C, 0xD1, 0x63, 0x5F, 0x3F, 0x06, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -831,6 +780,9 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x9F, 0x24, 0x49, 0x92, 0x24, 0x21, 0x00, 0x42, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x00, 0xA7, 0x7D, 0x0A, 0x49, 0x92, 0x24, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x02, 0x90, 0x24, 0x49, 0x92, 0x24, 0x17, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -839,18 +791,650 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x87, 0x00, 0x09, 0x91, 0xB0, 0x09, 0x91, 0x10, 0xC7, 0x29, 0x50, 0xF3, 0x37, 0x64, 0x03, 0x35, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0xC4, 0xFF, 0x05, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xC0, 0x00, 0x49, 0x62, 0xDB, 0xD9, 0x96, 0x04, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0x80, 0x01, 0x49, 0xD2, 0xDE, 0xE0, 0x0B, 0x86, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDC, 0x36, 0x00, 0xC0, 0x00, 0x49, 0x62, 0x3B, 0xDB, 0x02, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x92, 0x84, 0x49, 0x90, 0x04, 0xA0, 0x00, 0x49, 0xF2, 0xFF, 0x24, 0x39, 0x00, 0x61, 0x00, 0x49, 0x62, 0x3B, 0x40, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xAE, 0x00, 0x49, 0x92, 0xDC, 0x71, 0xF7, 0x0E, 0xBD, 0x09, 0x79, 0xD2, 0xD6, 0xD3, 0x06, 0x09, 0x9B, 0x00, 0x49, 0xE2, 0x27, 0xEB, 0x83, 0x35, 0xBE, 0x00, 0x49, 0x12, 0xDB, 0xC9, 0x96, 0x00, 
+    0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x24, 0x7C, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x99, 0x13, 
+    0xC4, 0x00, 0xC9, 0xEF, 0xB6, 0xDC, 0x26, 0x48, 0xBE, 0x00, 0x49, 0x52, 0x3F, 0x63, 0x0F, 0xD1, 0x0B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x05, 0x00, 0x02, 0xC0, 0x00, 0x10, 0x03, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB3, 0x00, 0xC9, 0x93, 0x98, 0x31, 0xF5, 0x0E, 
+    0xC2, 0x00, 0xC9, 0x8A, 0xF5, 0xA2, 0xC3, 0x3E, 0xBB, 0x00, 0x59, 0x92, 0x0E, 0x31, 0x95, 0x98, 0xAA, 0x00, 0x79, 0xB2, 0x3E, 0xA0, 0x03, 0xD1, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x76, 0x00, 0x49, 0x92, 0x24, 0xF5, 0x03, 0xAD, 0x9D, 0x00, 0xE9, 0x9F, 0x92, 0xA9, 0xE0, 0x0A, 0x5D, 0x00, 0x76, 0x02, 0x27, 0x70, 0x0E, 0x73, 0x6F, 0x00, 0x49, 0x92, 0x24, 0x6E, 0x22, 0x24, 
+    0xA1, 0x00, 0x49, 0xF2, 0xFF, 0x09, 0x99, 0x04, 0xA1, 0x00, 0x49, 0xF2, 0xFF, 0x29, 0x99, 0x02, 0x7E, 0x00, 0x49, 0x62, 0x27, 0x6B, 0x82, 0x26, 0x56, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x9C, 0xC0, 
+    0x67, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x97, 0x14, 0xB2, 0x00, 0x49, 0x62, 0x3B, 0x1C, 0x2D, 0x88, 0xB2, 0x00, 0x49, 0x9E, 0xA4, 0x49, 0xE4, 0x04, 0xB2, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 
+    0xB2, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 0xB2, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 0x64, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 0xB3, 0x00, 0x49, 0x62, 0xFB, 0x1C, 0x2D, 0x88, 
+    0x2B, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6C, 0x00, 0x49, 0x9C, 0x84, 0x89, 0x97, 0x14, 0xF1, 0x35, 0xC6, 0x5A, 0xD1, 0x5D, 0x4F, 0x3A, 
+    0x3F, 0x00, 0x48, 0xC2, 0x24, 0x4E, 0x92, 0x24, 0x7A, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x19, 0x0F, 0xC2, 0x00, 0xC9, 0x6F, 0xB7, 0xDC, 0x26, 0x00, 0xC5, 0x00, 0x7F, 0xD2, 0xFA, 0x1B, 0x0B, 0x68, 
+    0x70, 0x00, 0x49, 0xF2, 0x24, 0x7C, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x87, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 0xC7, 0x29, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0xFF, 0x00, 0x09, 0x9C, 0xC0, 0x09, 0x9C, 0x00, 0xFF, 0x4D, 0x06, 0x60, 0x00, 0x46, 0x03, 0x00, 
+    0xFF, 0x53, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x47, 0x02, 0x24, 0x40, 0x72, 0x24, 0x77, 0x00, 0x49, 0x92, 0x24, 0x69, 0x7B, 0x02, 0xFF, 0x00, 0x00, 0x96, 0x68, 0xB6, 0xD8, 0x96, 
+    0x77, 0x13, 0x70, 0x28, 0x7F, 0x7B, 0x45, 0x00, 0xFF, 0x00, 0x14, 0x40, 0x25, 0x9B, 0xBD, 0xB6, 0xFF, 0x00, 0x48, 0x92, 0x24, 0xF6, 0x53, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC2, 0x2E, 0x94, 0xCF, 0x8D, 0x54, 0x41, 0x35, 0xDF, 0x00, 0x7E, 0xC2, 0x3E, 0x63, 0x0F, 0xD1, 0x1A, 0x00, 0x49, 0x9E, 0x64, 0x49, 0xB0, 0x04, 
+    0xB1, 0x3E, 0x21, 0xF4, 0xA1, 0x96, 0xEC, 0xA9, 0x87, 0x00, 0x9A, 0x50, 0x7B, 0x4E, 0xE8, 0x9C, 0xB9, 0x20, 0x58, 0x33, 0xF1, 0x03, 0x3F, 0xF0, 0xFF, 0x00, 0x09, 0x90, 0x04, 0x49, 0x90, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 0xBC, 0x00, 0x31, 0x15, 0x0F, 0xF1, 0x10, 0x53, 
+    0xFC, 0x00, 0x6A, 0x8B, 0xFF, 0x48, 0xAE, 0xC4, 0xBB, 0x5E, 0x05, 0xF3, 0xE9, 0x99, 0x6E, 0x2D, 0x2E, 0x00, 0x4B, 0x82, 0x24, 0x48, 0xA2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x37, 0x78, 0x81, 0x14, 0x88, 0x01, 0x00, 0xFF, 0x15, 0x00, 0x00, 0x07, 0x34, 0x00, 0x00, 0x4A, 0x00, 0x49, 0x92, 0xA4, 0x49, 0x96, 0x1C, 0xC2, 0x3B, 0xA9, 0x76, 0xAA, 0xD5, 0x4C, 0xF0, 
+    0x5D, 0x00, 0x68, 0xB2, 0x27, 0x4D, 0xF2, 0x24, 0x54, 0x00, 0x89, 0x91, 0x64, 0x49, 0x9A, 0xE4, 0xC0, 0x43, 0x54, 0x53, 0xCD, 0x9F, 0x1A, 0x82, 0x53, 0x00, 0x4F, 0xD2, 0x24, 0x4B, 0x02, 0x27, 
+    0xA8, 0x00, 0x80, 0xC6, 0x09, 0x2E, 0x97, 0xDC, 0x9E, 0x45, 0x3E, 0x81, 0x51, 0x13, 0x94, 0x42, 0xA9, 0x26, 0x2D, 0x37, 0x41, 0x1A, 0x3B, 0x3F, 0xB1, 0x00, 0x42, 0xB2, 0x25, 0x75, 0xF2, 0xE4, 
+    0xE1, 0x00, 0x49, 0x90, 0x24, 0x49, 0x62, 0xDB, 0xFF, 0x05, 0xB1, 0x16, 0x60, 0x49, 0x66, 0x7B, 0xFF, 0x00, 0x75, 0x52, 0x27, 0x75, 0x50, 0xDB, 0xD5, 0x00, 0x59, 0x8F, 0xF5, 0x58, 0x6F, 0xF7, 
+    0x76, 0x00, 0x49, 0x91, 0x58, 0xC9, 0x1B, 0x1D, 0xD9, 0x46, 0xC3, 0x4C, 0xD2, 0x37, 0x5F, 0x3A, 0x72, 0x00, 0x4D, 0xD0, 0xA4, 0x4E, 0xF2, 0x24, 0x72, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 
+    0x72, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x72, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x73, 0x00, 0x49, 0x91, 0x54, 0xC9, 0x99, 0xE4, 0xF2, 0x0E, 0xC3, 0xCA, 0xB1, 0x6D, 0xFD, 0x3F, 
+    0x36, 0x00, 0x48, 0xA2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC5, 0x00, 0x49, 0x97, 0x77, 0x31, 0xF5, 0x0E, 0xBE, 0x00, 0x58, 0x8F, 0x39, 0xA2, 0xB3, 0x3E, 
+    0x2B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x04, 0xC5, 0x16, 0x31, 0x75, 0x0A, 0x1E, 0x56, 0x81, 0xBE, 0x00, 0xD0, 0x38, 0xD6, 0x74, 0xE2, 0x24, 0xC8, 0x00, 0x9C, 0xE0, 0x72, 0xB9, 0x99, 0xBC, 
+    0xC9, 0x08, 0xA3, 0x83, 0xF5, 0x12, 0x3D, 0xAC, 0x1B, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x86, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x14, 0xC6, 0x21, 0x50, 0x03, 0x35, 0x50, 0x83, 0x35, 0xB6, 0x00, 0x09, 0x90, 0x6C, 0x89, 0x9D, 0x24, 0xB6, 0x00, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 
+    0x9A, 0x00, 0x84, 0xBA, 0x6D, 0xB6, 0x9D, 0x24, 0xB6, 0x00, 0x40, 0xB2, 0x25, 0x76, 0x92, 0x24, 0xB7, 0x17, 0xE9, 0xF0, 0xEA, 0x2F, 0x6E, 0xC6, 0xBB, 0x5C, 0x00, 0xFA, 0xC9, 0x97, 0x6E, 0x2C, 
+    0xB7, 0x11, 0x80, 0xE7, 0x74, 0x7F, 0xF5, 0x53, 0xC7, 0x19, 0x90, 0x04, 0x5A, 0xA0, 0x2B, 0x3E, 0x7F, 0x00, 0x60, 0xA2, 0x26, 0x72, 0x72, 0x27, 0x9B, 0x00, 0x49, 0x92, 0x24, 0x39, 0x91, 0x24, 
+    0x82, 0x00, 0x49, 0x9A, 0xA4, 0x01, 0x9B, 0xA4, 0xAD, 0x2E, 0x44, 0x43, 0x34, 0x44, 0x43, 0x34, 0xF4, 0x35, 0x10, 0xBD, 0xCD, 0xB6, 0x9D, 0x24, 0x3E, 0x00, 0x4B, 0xAC, 0x24, 0x48, 0xA2, 0x24, 
+    0xB8, 0x00, 0x1D, 0x66, 0x4A, 0xEF, 0x94, 0x97, 0xBA, 0x36, 0x4F, 0xCA, 0x72, 0x00, 0x44, 0xB2, 0xBC, 0x00, 0x12, 0x8D, 0xF5, 0xA3, 0x53, 0x27, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x10, 
+    0x64, 0x00, 0x49, 0x92, 0x24, 0x6E, 0x2D, 0x40, 0x47, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x90, 0x00, 0x31, 0x91, 0x74, 0xC9, 0x9B, 0xE4, 
+    0xC5, 0x20, 0xC8, 0x3B, 0x71, 0x94, 0x64, 0x4A, 0xB3, 0x00, 0xC2, 0x8A, 0xD5, 0xAB, 0xB3, 0xBE, 0x49, 0x00, 0x4F, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0x33, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 
+    0xB6, 0x00, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 0xB6, 0x00, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 0x84, 0x00, 0x89, 0x97, 0x58, 0x49, 0x95, 0x10, 0xC3, 0x18, 0x03, 0x2D, 0xF5, 0x50, 0x83, 0x35, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCC, 0x0F, 0xA7, 0xF6, 0x4E, 0xE9, 0x10, 0x0F, 0x8D, 0x00, 0x73, 0xA2, 0x26, 0x68, 0x02, 0x3E, 
+    0x9B, 0x00, 0x49, 0x9C, 0x9C, 0x79, 0x17, 0x0F, 0xAA, 0x0C, 0x94, 0x36, 0xB0, 0x58, 0xAD, 0x3E, 0xAD, 0x10, 0x98, 0x33, 0xD1, 0x94, 0x6A, 0x62, 0x49, 0x00, 0x49, 0x9A, 0xA4, 0x4C, 0x0A, 0xA7, 
+    0xC9, 0x39, 0x26, 0xE9, 0x01, 0x6E, 0xEB, 0x24, 0xBD, 0x39, 0x24, 0x01, 0x10, 0x3D, 0x9B, 0x13, 0xF8, 0x39, 0x2D, 0xB0, 0x6D, 0xB6, 0xDD, 0x24, 0xB9, 0x16, 0x5B, 0x03, 0x35, 0x64, 0x63, 0x3B, 
+    0x9C, 0x00, 0xC1, 0x15, 0xB2, 0xF9, 0x9F, 0x24, 0x83, 0x00, 0x10, 0xCD, 0x3E, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x38, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 0xBB, 0x2D, 0xA9, 0x74, 0x62, 0x1E, 0x58, 0xA9, 0x72, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xD2, 0x24, 
+    0x4F, 0x00, 0x49, 0x96, 0x5C, 0xC9, 0x91, 0x1C, 0xCF, 0x4F, 0xD6, 0x5E, 0xF1, 0x05, 0x43, 0x30, 0x2C, 0x00, 0x48, 0xB2, 0x24, 0x4D, 0xE2, 0x24, 0x3B, 0x00, 0x49, 0x90, 0x64, 0x49, 0x98, 0x84, 
+    0xBE, 0x60, 0xD6, 0x7E, 0xC9, 0x19, 0x9C, 0xC1, 0x3F, 0x00, 0x4B, 0xA2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x95, 0x54, 0xBC, 0x0C, 0x50, 0x0F, 0xF5, 0x58, 0x23, 0x36, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x15, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 0xB9, 0x2E, 0xA9, 0x7E, 0x92, 0x27, 0xEA, 0xAD, 0xC7, 0x44, 0x04, 0x4F, 0x34, 0x53, 0x25, 0x92, 
+    0xCD, 0x11, 0x31, 0x45, 0x12, 0xD2, 0xB0, 0x4D, 0xB9, 0x39, 0x72, 0x32, 0x92, 0x00, 0xB0, 0x6D, 0xB9, 0x00, 0xB6, 0xB3, 0x2D, 0x00, 0x22, 0x29, 0xBA, 0x00, 0x71, 0x12, 0x2F, 0xF1, 0x10, 0x13, 
+    0xB0, 0x00, 0x49, 0x9C, 0xC4, 0x49, 0x8C, 0xC4, 0xD8, 0x2E, 0x5D, 0xD3, 0xD5, 0xD5, 0x56, 0x15, 0xC2, 0x00, 0x4F, 0x52, 0x3F, 0x63, 0x0F, 0xB1, 0x19, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x2C, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x45, 0x00, 0x02, 0x96, 0x27, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBA, 0x00, 0x79, 0xF7, 0x4E, 0xA6, 0xE4, 0x61, 
+    0xAC, 0x17, 0x02, 0x04, 0x09, 0x6C, 0xD9, 0xC4, 0xB6, 0x00, 0xA3, 0x83, 0xF5, 0xC2, 0x3C, 0xAC, 0x52, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x18, 0xCD, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x2C, 
+    0xB0, 0x00, 0xEF, 0x10, 0x77, 0x89, 0x99, 0xC4, 0xC1, 0x21, 0xA2, 0x03, 0xF5, 0xC3, 0xDA, 0x61, 0xE4, 0x35, 0x6E, 0x2D, 0xCD, 0xC1, 0xEC, 0xF0, 0x33, 0x00, 0x48, 0x82, 0x24, 0x4A, 0xC2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x91, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xCD, 0x0C, 0x58, 0x83, 0x39, 0x98, 0x83, 0x39, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC7, 0x03, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0x9A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x9A, 0x00, 0xA6, 0x90, 0x24, 0x49, 0x92, 0x24, 0x66, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA2, 0x00, 0xAF, 0x90, 0x24, 0x49, 0x92, 0x24, 0x6E, 0x00, 0x60, 0x9C, 0xC4, 0x49, 0x9C, 0xC4, 
+    0xDC, 0x00, 0x1D, 0xD2, 0x21, 0x4D, 0x92, 0x24, 0xC4, 0x05, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x6F, 0xFF, 0x00, 0x70, 0x52, 0x23, 0xB5, 0x54, 0x93, 0x93, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x94, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xC6, 0x0B, 0xC3, 0x2A, 0xD1, 0x58, 0x0F, 0x3A, 0x15, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x4E, 0x00, 0xC9, 0x91, 0x1C, 0x49, 0x94, 0x64, 0xCE, 0x50, 0x05, 0x53, 0x30, 0x15, 0xEF, 0xCD, 0x37, 0x00, 0x4E, 0xD2, 0x24, 0x4C, 0x82, 0x24, 0x46, 0x00, 0x49, 0x9A, 0x84, 0x49, 0x96, 0x1C, 
+    0xBF, 0x61, 0x19, 0x9C, 0xC1, 0x97, 0x6E, 0x2C, 0x3E, 0x00, 0x48, 0xA2, 0x24, 0x4A, 0xC2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA4, 0x00, 0x89, 0x99, 0x98, 0x39, 0x15, 0x13, 0xE4, 0x04, 0xA6, 0xD3, 0xFA, 0x5B, 0x0D, 0xD1, 0x05, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x3C, 0x00, 0x49, 0x98, 0x44, 0x49, 0x90, 0x24, 0xAC, 0x00, 0x94, 0x47, 0x54, 0x79, 0x95, 0x13, 0xFF, 0x00, 0xB3, 0xBD, 0xFF, 0x42, 0x22, 0x29, 
+    0xCA, 0x35, 0xF6, 0x94, 0x6A, 0xA7, 0x76, 0x82, 0x71, 0x00, 0xD8, 0x26, 0xFF, 0x72, 0xB2, 0x27, 0x56, 0x00, 0x00, 0x62, 0x3B, 0x49, 0x92, 0x24, 0xB4, 0x00, 0xF1, 0x10, 0x13, 0x31, 0x1B, 0x13, 
+    0xB6, 0x00, 0x60, 0x0C, 0xDA, 0x98, 0xAD, 0xD9, 0xAD, 0x2E, 0x44, 0x43, 0x34, 0x44, 0x43, 0x34, 0xFF, 0x00, 0xD0, 0x1A, 0x8C, 0x81, 0x18, 0x88, 0xFF, 0x00, 0x4F, 0xE0, 0x04, 0x4E, 0xE0, 0x44, 
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x49, 0x82, 0x24, 0x48, 0x22, 0x25, 0xBE, 0x1B, 0x26, 0x68, 0x82, 0xA7, 0x14, 0x0F, 
+    0x9F, 0x00, 0x4D, 0xDC, 0xC7, 0x6B, 0x09, 0x09, 0xBB, 0x29, 0xD5, 0x4C, 0xCC, 0x03, 0x8F, 0x35, 0x54, 0x00, 0x8E, 0xF1, 0x24, 0x49, 0x92, 0x24, 0xCD, 0x00, 0xC1, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x90, 0x00, 0x49, 0x92, 0x3C, 0x09, 0x99, 0x00, 0xBE, 0x00, 0xA6, 0x10, 0x53, 0xB9, 0x99, 0xBC, 0xDF, 0x0F, 0x14, 0xAD, 0xF5, 0xA3, 0xC3, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x20, 0x00, 0x22, 0x29, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x8A, 0x00, 0x39, 0x91, 0x14, 0x49, 0x95, 0x78, 0xC9, 0x12, 0x98, 0x83, 0x35, 0x5A, 0x2F, 0xF1, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCA, 0x09, 0xF1, 0x90, 0x0E, 0xEF, 0xF0, 0x4A, 0x93, 0x00, 0xE0, 0x03, 0x3E, 0x6A, 0x32, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x53, 0x00, 0x11, 0x10, 0xDB, 0x49, 0x92, 0x24, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x53, 0x00, 0x40, 0x62, 0xDB, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC3, 0x00, 0x31, 0xF5, 0x0E, 0xA7, 0x64, 0x42, 0xA6, 0x00, 0xA0, 0x23, 0x3E, 0x6B, 0x42, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x23, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xC5, 0x06, 0x1D, 0x66, 0x4A, 0xEF, 0x10, 0x73, 0xBA, 0x00, 0x7D, 0xB2, 0xFA, 0x1A, 0x0B, 0x48, 0xC1, 0x00, 0x89, 0x79, 0x77, 0xE5, 0x24, 0x41, 
+    0xC6, 0x00, 0xC3, 0x0A, 0xD1, 0x5A, 0xBF, 0x3A, 0x13, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x8F, 0x00, 0x39, 0x91, 0x74, 0x49, 0x9C, 0x24, 0xB4, 0x00, 0xD0, 0x3C, 0xF6, 0xF6, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0xF1, 0x90, 0x92, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x4E, 0xD2, 0xFF, 0x9D, 0x24, 
+    0xBD, 0x00, 0x15, 0x46, 0x91, 0xBC, 0x9E, 0x24, 0x40, 0x00, 0x48, 0xA2, 0x24, 0x4C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9B, 0x00, 0x39, 0x91, 0x57, 0x89, 0x99, 0xC4, 
+    0xC7, 0x3B, 0xE0, 0x23, 0xD1, 0x14, 0xE6, 0x6E, 0xB4, 0x2E, 0x44, 0x43, 0x34, 0x42, 0x01, 0x40, 0xFC, 0x00, 0xC1, 0x08, 0xB1, 0x5A, 0xCD, 0xFA, 0x9F, 0x00, 0x4D, 0xE0, 0x84, 0x4F, 0x9E, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x42, 0x26, 0xFF, 0x93, 0x24, 0x85, 0x00, 0xF1, 0x90, 0x98, 0x49, 0x9E, 0x24, 
+    0xB4, 0x00, 0x02, 0x40, 0x8E, 0xB6, 0x9D, 0x24, 0x8D, 0x00, 0x58, 0xC3, 0x3E, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB3, 0x00, 0x41, 0x10, 0x6E, 0x89, 0x93, 0x24, 0x1F, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x15, 0x60, 0x92, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x42, 0x32, 0xFF, 0x93, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x59, 0x00, 0x89, 0x91, 0x5C, 0x49, 0x98, 0xC4, 0xBE, 0x40, 0x43, 0x43, 0xF0, 0x96, 0x7C, 0x82, 
+    0x45, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x82, 0x27, 0x3D, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x98, 0x04, 0xC3, 0x37, 0xA9, 0x76, 0x82, 0x9E, 0x5A, 0xCD, 0x62, 0x00, 0x68, 0xA2, 0x27, 0x4C, 0xE2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x49, 0x00, 0x49, 0x9A, 0x64, 0x49, 0x90, 0x24, 0xBF, 0x00, 0x1D, 0x46, 0x91, 0xFB, 0x9E, 0x24, 0x49, 0x00, 0x78, 0xB2, 0x24, 0x4D, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x62, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xB4, 0x00, 0x13, 0x50, 0x72, 0xBF, 0x9D, 0x24, 0xB3, 0x00, 0x80, 0x36, 0xB2, 0xF6, 0x93, 0x24, 
+    0x59, 0x00, 0x60, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x02, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x7E, 0x00, 0xE6, 0x94, 0xDB, 0x09, 0x10, 0x92, 0xBE, 0x25, 0x65, 0x0B, 0x35, 0x24, 0xF9, 0xFF, 0x7E, 0x00, 0xEB, 0xF3, 0x24, 0x48, 0x42, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB6, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x97, 0xD8, 
+    0xA4, 0x00, 0x74, 0xA2, 0x3E, 0x58, 0x53, 0xD1, 0x9C, 0x00, 0x89, 0x99, 0x77, 0xF1, 0x10, 0xAA, 0xB0, 0x00, 0xC2, 0x0C, 0xF5, 0xA3, 0x43, 0x27, 0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x2C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x47, 0x00, 0x49, 0x92, 0x24, 0x49, 0x1E, 0x0F, 0x56, 0x00, 0x49, 0x92, 0x24, 0xF6, 0x0F, 0x40, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB6, 0x00, 0x49, 0x92, 0x24, 0xF1, 0x10, 0xCF, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 0xE8, 0x00, 0x49, 0x92, 0x24, 0x58, 0x6F, 0xF7, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x38, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x30, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x77, 0x00, 0x49, 0x92, 0x24, 0x89, 0x97, 0x13, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xD0, 0x6A, 0xD3, 0x45, 0x00, 0x49, 0x92, 0x24, 0x70, 0xD2, 0x24, 0x92, 0x00, 0x49, 0x92, 0x24, 0x39, 0x91, 0xB3, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x02, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x62, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x80, 0x66, 0xDB, 0x68, 0x00, 0xC9, 0x99, 0x24, 0x68, 0x82, 0x26, 
+    0xEE, 0x00, 0x10, 0x9D, 0x24, 0x49, 0x92, 0x24, 0xE7, 0x00, 0xE1, 0x90, 0x24, 0x49, 0xF2, 0xDB, 0x55, 0x00, 0x72, 0x92, 0x24, 0xF6, 0x03, 0x60, 0x2E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x11, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x55, 0x00, 0x49, 0x92, 0x24, 0xC9, 0xCD, 0x01, 0x54, 0x00, 0x49, 0x92, 0x24, 0x7E, 0x02, 0xAD, 
+    0x02, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x49, 0x92, 0x24, 0xB9, 0xED, 0x01, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 
+    0x43, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x14, 0x57, 0x00, 0x49, 0x92, 0x24, 0x76, 0x02, 0xF0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x3A, 0x00, 0x49, 0x92, 0x24, 0x89, 0x43, 0x34, 0xDC, 0x00, 0x49, 0x92, 0x24, 0xEF, 0xF0, 0xDA, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x10, 0x6D, 0xDB, 0x5D, 0x00, 0x49, 0x92, 0x24, 0x8E, 0xE1, 0x18, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x14, 0x40, 0x01, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x04, 0x40, 0x96, 0x00, 0x49, 0x92, 0x24, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC0, 0x4F, 0x6D, 0x0B, 0x7C, 0x24, 0x99, 0x24, 0xC0, 0x4F, 0x6D, 0x0B, 0x00, 0x24, 0x95, 0x58, 0xAC, 0x00, 0xA3, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x6D, 0x00, 0x49, 0x92, 0xA4, 0x89, 0x97, 0x14, 
+    0xFF, 0x2B, 0xB9, 0xEB, 0x72, 0x9D, 0x40, 0x01, 0xFF, 0x3A, 0x6D, 0x3B, 0x6D, 0x30, 0x80, 0x00, 0xFF, 0x00, 0xF5, 0x33, 0xFA, 0x1A, 0x0D, 0xB1, 0x2B, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 
+    0xB6, 0x00, 0xF1, 0x16, 0x0F, 0xF1, 0x16, 0xB7, 0xCD, 0x4E, 0x6D, 0x0B, 0x00, 0x6D, 0x9B, 0x24, 0xCD, 0x4E, 0x6D, 0x2B, 0x09, 0x6D, 0x9B, 0x24, 0xC8, 0x16, 0x64, 0x0F, 0xF5, 0x58, 0xBF, 0x3A, 
+    0xFF, 0x00, 0x09, 0x99, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x80, 0x49, 0x02, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFD, 0x60, 0xFF, 0x4F, 0x92, 0x98, 0xB3, 0x9E, 
+    0x96, 0x00, 0xE2, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xFF, 0x00, 0x49, 0x98, 0x64, 0x49, 0x90, 0x04, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xCC, 0x03, 0x24, 0x09, 0x00, 0x58, 0x2F, 0x3A, 
+    0xFF, 0x53, 0xB6, 0x4D, 0x92, 0x00, 0x14, 0x20, 0xA6, 0x00, 0xA3, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x18, 
+    0xC0, 0x03, 0x31, 0xF7, 0x0E, 0x1D, 0x44, 0x61, 0xC4, 0x00, 0x58, 0x2D, 0x3A, 0xF4, 0xD3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x92, 0x00, 0x39, 0x95, 0x13, 0x39, 0x91, 0x93, 
+    0xFF, 0x53, 0xB6, 0x4D, 0x92, 0x03, 0x90, 0x24, 0xC0, 0x00, 0xDB, 0x06, 0x00, 0x49, 0xD2, 0xF6, 0xC6, 0x1E, 0x24, 0x19, 0x43, 0xA7, 0xE4, 0x41, 0x68, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x96, 0x00, 0x49, 0x9C, 0x98, 0x49, 0x95, 0x13, 0xC4, 0x43, 0x71, 0xD9, 0x01, 0xD2, 0x0A, 0x3A, 0xBF, 0x37, 0x1B, 0x09, 0x00, 0x2D, 0x97, 0xDC, 0xC7, 0x00, 0xEC, 0x23, 0xF6, 0x10, 0x3D, 0xAC, 
+    0x1C, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0xC4, 0x00, 0xC9, 0x9B, 0x97, 0x2F, 0x65, 0x0A, 0xC3, 0x3B, 0x2E, 0x37, 0x00, 0x18, 0x4B, 0x3F, 0xC6, 0x3E, 0x64, 0x0F, 0x88, 0xA5, 0x90, 0x77, 
+    0xC1, 0x00, 0x7E, 0x42, 0x3F, 0xA2, 0x83, 0xF5, 0x21, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x90, 0xA4, 0xD2, 0x42, 0x29, 0x79, 0x42, 0x27, 0x14, 0xB3, 0x83, 0x00, 0x6B, 0x02, 0x26, 0x60, 0x32, 0x27, 
+    0x9E, 0x00, 0x79, 0x97, 0x13, 0x39, 0x91, 0x77, 0xD2, 0x2A, 0xA3, 0x03, 0xF1, 0x10, 0x4F, 0x3A, 0x05, 0x00, 0x49, 0x82, 0x24, 0x4A, 0x92, 0x24, 0x55, 0x00, 0x49, 0x92, 0x24, 0x49, 0x6C, 0x0E, 
+    0xAB, 0x00, 0x49, 0x92, 0xDC, 0x2E, 0xC7, 0x09, 0xEA, 0x0B, 0xF9, 0xED, 0x96, 0xE4, 0x24, 0x41, 0x96, 0x00, 0xE3, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xB7, 0x1D, 0x29, 0x99, 0x0A, 0xE9, 0x96, 0xDA, 
+    0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0F, 0xEC, 0x24, 0x9F, 0xE4, 0x5D, 0x00, 0x8E, 0xE1, 0x18, 0x8E, 0xE1, 0x18, 
+    0xFF, 0x79, 0x1E, 0xE0, 0x01, 0xE6, 0x94, 0xBB, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0E, 0xFF, 0xD5, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x10, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x37, 0x11, 0x13, 0x31, 0x11, 0x13, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x92, 0x00, 0x49, 0x95, 0x13, 0x39, 0x91, 0x93, 
+    0xFF, 0x06, 0x03, 0x20, 0x49, 0xA4, 0x69, 0x3B, 0xFF, 0x22, 0x00, 0xB0, 0x01, 0x6D, 0xF3, 0x03, 0xFF, 0x62, 0x00, 0x0F, 0xF0, 0x01, 0x0F, 0xF1, 0x42, 0x00, 0x4A, 0x82, 0x24, 0x48, 0xA2, 0x24, 
+    0x0E, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x0E, 0x49, 0xF2, 0x0E, 0xEF, 0xF4, 0x6E, 0xF0, 0x0D, 0x81, 0x08, 0xB1, 0x62, 0xCF, 0x3E, 0x6C, 0x00, 0xE0, 0xC3, 0x27, 0x4F, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x9E, 0xE4, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x7C, 0x00, 0x04, 0x80, 0xC0, 0x0C, 0x35, 0xD6, 0x27, 0xE2, 0x45, 0x47, 0x3D, 0xF5, 0x13, 
+    0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xBC, 0x00, 0x06, 0xA0, 0x00, 0x0C, 0x20, 0xB9, 0x13, 0xE0, 0xA3, 0xDE, 0x2B, 0x39, 0x01, 
+    0xB9, 0x0D, 0x49, 0x62, 0x3F, 0x64, 0x0D, 0x68, 0x66, 0x00, 0x7F, 0x13, 0x34, 0x4D, 0xA2, 0x26, 0x02, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xD8, 0x00, 0x89, 0x9B, 0x77, 0x37, 0x65, 0x0E, 
+    0xC3, 0x4F, 0x03, 0x8F, 0x39, 0x2B, 0x39, 0x49, 0xC6, 0x00, 0x4E, 0x52, 0x3F, 0x63, 0x0D, 0x8D, 0x46, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x02, 0x27, 0x92, 0x00, 0x39, 0x9F, 0x13, 0x39, 0x91, 0x13, 
+    0xFF, 0x00, 0xFF, 0x2F, 0x20, 0x02, 0x22, 0x24, 0x7D, 0x00, 0xFF, 0x9B, 0x9C, 0x89, 0x95, 0x10, 0xFF, 0x6B, 0xA9, 0x7A, 0xA2, 0x1E, 0x40, 0x01, 0xFF, 0x00, 0x7D, 0xD2, 0x27, 0x7D, 0x82, 0x27, 
+    0xA6, 0x00, 0x31, 0x11, 0x13, 0x39, 0x95, 0x74, 0xB9, 0x00, 0xA0, 0x23, 0x3A, 0x58, 0x0F, 0x8D, 0x7D, 0x00, 0xC9, 0x9B, 0xA4, 0xBF, 0xB9, 0x09, 0xBB, 0x45, 0x95, 0x5C, 0xC9, 0xC4, 0x2E, 0x35, 
+    0x27, 0x00, 0x48, 0x8C, 0x84, 0x4B, 0xE6, 0x64, 0xCD, 0x47, 0xA9, 0x76, 0x82, 0x27, 0x7A, 0xA2, 0x6C, 0x00, 0xE0, 0xB3, 0x27, 0x4B, 0xB2, 0x27, 0x81, 0x00, 0x31, 0x91, 0x58, 0x89, 0x97, 0x78, 
+    0xC5, 0x30, 0x52, 0x23, 0xF0, 0x03, 0x3F, 0xF0, 0x06, 0x00, 0x49, 0x92, 0x24, 0x48, 0xA2, 0x24, 0x4C, 0x00, 0x1E, 0x90, 0xFC, 0x49, 0x92, 0x24, 0x2C, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3A, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x4C, 0x00, 0x00, 0xF3, 0x27, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x89, 0x9B, 0x7C, 0x09, 0x98, 0x8C, 0xCE, 0x52, 0xB9, 0xD9, 0x09, 0xA8, 0x3F, 0x8D, 
+    0xFF, 0x11, 0x9C, 0x24, 0x00, 0xFE, 0xC3, 0xDA, 0xFF, 0x00, 0x00, 0x04, 0x40, 0x49, 0xE2, 0x27, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xC9, 0x93, 0x24, 0xA5, 0x1D, 0x69, 0x92, 0xB6, 0x29, 0x90, 0x02, 
+    0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xDA, 0xB6, 0x80, 0x0A, 0xA8, 0x29, 0x00, 0x0C, 0xC1, 0x24, 0x4C, 0xC2, 0x2C, 
+    0xDC, 0x00, 0x6E, 0x99, 0xDF, 0x49, 0x32, 0x24, 0xCA, 0x00, 0x93, 0x50, 0x72, 0xBF, 0x9B, 0xE4, 0xFF, 0x28, 0x02, 0xC4, 0x4D, 0x6E, 0x99, 0x5F, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x0E, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0xFF, 0x00, 0x09, 0x10, 0x00, 0x00, 0x04, 0x68, 0xFF, 0x03, 0x10, 0xAB, 0xD1, 0xA3, 0xCF, 0x3E, 0x29, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0xA4, 
+    0x11, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xF2, 0x00, 0xEF, 0xF6, 0x92, 0xAF, 0xFD, 0x0C, 0xFF, 0x00, 0x75, 0xD2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x28, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x68, 0x01, 0x90, 0x02, 0x29, 0x94, 0x8A, 0xF4, 0x0F, 0x18, 0x2D, 0xF6, 0xAB, 0x43, 0x27, 0xD6, 0x00, 0x37, 0x11, 0x13, 0x31, 0x71, 0x53, 
+    0xA3, 0x00, 0xE2, 0x23, 0x3E, 0xE2, 0x29, 0x82, 0xBB, 0x00, 0x49, 0x90, 0x64, 0x4F, 0xFC, 0xE4, 0xEA, 0x11, 0x12, 0x46, 0x6E, 0x6E, 0x99, 0xDF, 0xAA, 0x00, 0x80, 0xA4, 0xB1, 0xF4, 0xEF, 0x24, 
+    0xC2, 0x00, 0x13, 0x54, 0x0E, 0x37, 0x95, 0x74, 0xCF, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x0F, 0xF5, 0x58, 0x00, 0x49, 0x9A, 0x64, 0xC9, 0x95, 0x18, 0xCD, 0x51, 0x21, 0xE4, 0x89, 0xC5, 0x4E, 0x30, 
+    0x9C, 0x00, 0xD0, 0xB6, 0xB6, 0x7E, 0xF2, 0x24, 0xCB, 0x00, 0x13, 0x54, 0x0A, 0x37, 0x95, 0x53, 0xBE, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0x39, 0x92, 0x00, 0x39, 0x91, 0x33, 0x79, 0x92, 0x24, 
+    0xD2, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xE3, 0x00, 0x79, 0x17, 0x73, 0x2F, 0xE5, 0x0E, 0xFF, 0xD1, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x00, 0x02, 0x20, 
+    0xFF, 0x00, 0xC9, 0x9D, 0xE4, 0x49, 0x00, 0x40, 0xDB, 0x40, 0xE5, 0x18, 0x57, 0x18, 0xBB, 0x3E, 0xBD, 0x36, 0x9B, 0x00, 0x80, 0x2D, 0x97, 0xDC, 0xFF, 0x00, 0xAC, 0x5F, 0x3F, 0x13, 0xC2, 0x09, 
+    0xFF, 0x00, 0x49, 0x9E, 0x24, 0x49, 0x02, 0x24, 0xCD, 0x07, 0x1D, 0x66, 0x4A, 0xEF, 0x10, 0x73, 0xBD, 0x00, 0x7D, 0xB2, 0xFA, 0x1A, 0x0B, 0x48, 0xD8, 0x00, 0x89, 0x79, 0x77, 0xE5, 0x34, 0x09, 
+    0xC6, 0x00, 0x02, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0x96, 0x04, 0xE3, 0x02, 0xB9, 0xFF, 0xB6, 0xE5, 0xD6, 0x41, 0x86, 0x00, 0x4F, 0xC2, 0x27, 0x6A, 0x02, 0x26, 
+    0xA3, 0x00, 0x49, 0x9C, 0x98, 0x39, 0x15, 0x13, 0xE1, 0x00, 0xFE, 0xC3, 0xFA, 0x5A, 0x0D, 0xD1, 0x52, 0x00, 0xC9, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xA7, 0x00, 0x9C, 0xE0, 0x92, 0xC9, 0x9D, 0x24, 
+    0xC0, 0x08, 0x90, 0xB6, 0x09, 0x2E, 0x97, 0xDB, 0xC3, 0x39, 0xF5, 0xA3, 0xB1, 0x13, 0xE4, 0x72, 0xB2, 0x00, 0x7F, 0xC2, 0x3A, 0xEA, 0x82, 0x3E, 0xDC, 0x00, 0x6F, 0xFB, 0xFE, 0xEF, 0x90, 0x24, 
+    0xFF, 0x00, 0x6D, 0xFB, 0xFF, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x6D, 0xFB, 0xFF, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x6D, 0xFD, 0xDF, 0x10, 0x9D, 0x24, 0x5D, 0x00, 0x8E, 0xE1, 0x18, 0x8E, 0x91, 0x18, 
+    0xFF, 0x9C, 0x19, 0x90, 0x01, 0x19, 0x90, 0x01, 0xFF, 0x00, 0x49, 0x82, 0x24, 0x48, 0x02, 0x24, 0xFF, 0x00, 0xC9, 0x95, 0x40, 0x09, 0x14, 0x40, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0x94, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xFF, 0xA7, 0x04, 0x40, 0x00, 0x04, 0x48, 0x34, 0xFF, 0x00, 0xD0, 0xA8, 0xB1, 0xA3, 0x5F, 0x3F, 0xFF, 0x00, 0x75, 0xF2, 0x84, 0x89, 0x18, 0x88, 0xFF, 0x00, 0x49, 0xEC, 0x84, 0x4E, 0xE4, 0x04, 
+    0xFF, 0x2E, 0xFF, 0x1F, 0xB7, 0xDB, 0x06, 0x00, 0xFF, 0x30, 0xFF, 0xEF, 0xB4, 0xDB, 0x06, 0x00, 0xFF, 0x00, 0x40, 0x42, 0xB2, 0x92, 0x04, 0x00, 0xFF, 0x00, 0x19, 0xCD, 0xD1, 0x49, 0x82, 0x24, 
+    0x28, 0x00, 0x4F, 0x90, 0x04, 0x49, 0x90, 0x04, 0xCC, 0x68, 0x19, 0x9A, 0x91, 0xD9, 0x96, 0xFF, 0xB0, 0x5D, 0x4F, 0xB2, 0x6D, 0x00, 0x60, 0xDB, 0xC3, 0x5D, 0x49, 0x41, 0x92, 0x92, 0xF4, 0x17, 
+    0xB0, 0x5D, 0x4B, 0xBE, 0xED, 0x83, 0x3E, 0xEB, 0x23, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8C, 0x24, 0xC8, 0x3D, 0xE7, 0x79, 0x92, 0x27, 0x96, 0x4A, 0x76, 0x00, 0x7B, 0xB2, 0x27, 0x73, 0x02, 0xDA, 
+    0xA1, 0x00, 0x89, 0x97, 0x78, 0x79, 0xE5, 0x0E, 0xC4, 0x13, 0x12, 0x0F, 0xF5, 0x50, 0x8F, 0x39, 0x5C, 0x00, 0x89, 0x91, 0x18, 0xC9, 0x95, 0x64, 0xC9, 0x47, 0x43, 0x43, 0x30, 0x04, 0x5F, 0xA9, 
+    0x51, 0x00, 0x4F, 0xF2, 0x24, 0x4D, 0x02, 0xB6, 0xC7, 0x00, 0x79, 0x97, 0x57, 0x31, 0xE5, 0x0E, 0xC5, 0x00, 0x98, 0x83, 0x39, 0xA2, 0x23, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x49, 0x9E, 0xA4, 0xC9, 0x97, 0x14, 0xFF, 0x4E, 0xF1, 0xF0, 0x0A, 0x26, 0xD0, 0x01, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xFF, 0x11, 0x00, 0x14, 0x73, 0x31, 0x04, 0x40, 0xA6, 0x00, 0xA2, 0xA3, 0x26, 0xEA, 0x83, 0xD5, 0x45, 0x00, 0x49, 0x98, 0xE4, 0x49, 0xDC, 0x12, 0xFF, 0x4A, 0xEF, 0x10, 0x0F, 0xE9, 0x6A, 0x0A, 
+    0xFF, 0x00, 0x40, 0xE2, 0x27, 0x46, 0x02, 0x24, 0x65, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xAF, 0x00, 0x13, 0x50, 0x92, 0xBF, 0x99, 0x77, 0xC3, 0x41, 0xA2, 0xE4, 0x81, 0xC4, 0x2C, 0x35, 
+    0x7F, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0xF2, 0x24, 0x1A, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xB0, 0x00, 0x15, 0x60, 0x8E, 0xB9, 0x9D, 0x24, 0x74, 0x00, 0x60, 0x32, 0x27, 0x4F, 0x92, 0x24, 
+    0x9E, 0x00, 0x39, 0x95, 0x98, 0xCC, 0x84, 0x48, 0xA1, 0x00, 0x90, 0x4A, 0xCC, 0x12, 0x3F, 0x3A, 0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x0B, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x61, 0x00, 0xE6, 0x90, 0xBC, 0x49, 0x92, 0x24, 0x8B, 0x00, 0xC2, 0x53, 0x2E, 0xB9, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x24, 
+    0xFF, 0x00, 0x14, 0x40, 0x01, 0x14, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x01, 0x04, 0x40, 0x00, 0x94, 0x24, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x93, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x93, 0xAC, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 0x94, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x73, 
+    0xDF, 0x16, 0xD0, 0x0A, 0xD4, 0xDB, 0xD3, 0xB6, 0xFF, 0x00, 0x7E, 0xBB, 0x6D, 0x64, 0xD0, 0xB6, 0xB6, 0x5E, 0xB6, 0x09, 0x80, 0xDB, 0x98, 0x24, 0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x5E, 0x00, 0x02, 0xA0, 0x00, 0x08, 0xE0, 0xFF, 0x5D, 0x01, 0x50, 0x00, 0x04, 0x70, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x20, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x49, 0x9E, 0x24, 0x48, 0x82, 0x24, 0x31, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0xB6, 0x9D, 0x24, 0x49, 0x90, 0x90, 0xD6, 0x00, 0x36, 0x15, 0x13, 0x33, 0xD7, 0xB6, 
+    0xA3, 0x00, 0x22, 0x28, 0x3E, 0xE2, 0x43, 0x3E, 0x23, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 0xCC, 0x00, 0xEF, 0x10, 0x73, 0xB9, 0x99, 0xDC, 0xC4, 0x51, 0xEB, 0x0F, 0x6D, 0x9C, 0x94, 0xDB, 
+    0xC7, 0x36, 0xEE, 0x30, 0x61, 0x1A, 0x5B, 0x3F, 0xA1, 0x00, 0x98, 0xB3, 0x3E, 0x7D, 0xF2, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0x1D, 0x64, 0x0E, 0x71, 0x97, 0xBC, 
+    0xBD, 0x5C, 0x7D, 0x82, 0x6D, 0x94, 0x94, 0xDB, 0xC6, 0x1F, 0x1D, 0x24, 0x88, 0x1A, 0x5D, 0x3F, 0x7D, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x49, 0x97, 0x53, 0xF1, 0x70, 0x92, 0xFF, 0x60, 0x14, 0x30, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x00, 0x22, 0x29, 0x24, 0xD3, 0x36, 
+    0xFF, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x66, 0xEB, 0x83, 0xB1, 0x80, 0x04, 0x00, 0xFF, 0x5C, 0x49, 0xDE, 0x96, 0x9B, 0xF4, 0x03, 0xFF, 0x9E, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x51, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x14, 0xC3, 0x11, 0x31, 0x65, 0x0A, 0x1D, 0x34, 0x94, 0xB5, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xD2, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x5F, 0x00, 0xD0, 0x66, 0xFF, 0x49, 0x92, 0x24, 0x38, 0x00, 0x60, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2D, 0x00, 0xC1, 0x96, 0x24, 0x49, 0x92, 0xC4, 0x2C, 0x00, 0x1B, 0x92, 0x24, 0x49, 0xD2, 0x3A, 0x54, 0x00, 0x31, 0x9A, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xC2, 0x9F, 0x24, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x9F, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x4E, 0x90, 0x04, 0x49, 0x92, 0xFC, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0xC0, 0x92, 0x24, 0x49, 0x92, 0x64, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x62, 0x0A, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x33, 0x00, 0x1D, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x50, 0x93, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x82, 0x03, 0xFF, 0x00, 0x7F, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x96, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x13, 
+    0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x22, 0x20, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x02, 0x24, 0x49, 0x92, 0x24, 0x78, 0x00, 0x39, 0x91, 0x24, 0x49, 0x92, 0x24, 0x85, 0x00, 0x36, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x1E, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0xFC, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x04, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x04, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x65, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 0xC6, 0x06, 0xB9, 0xEB, 0x72, 0x9C, 0x30, 0x68, 0xC9, 0x3C, 0xFF, 0x43, 0xB2, 0x12, 0xD4, 0x52, 0xC3, 0x00, 0x4F, 0x52, 0x3F, 0xA3, 0x83, 0xF5, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x69, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x99, 0x13, 0xB2, 0x00, 0xC9, 0xED, 0x72, 0x9C, 0x20, 0x68, 0xA1, 0x47, 0xF9, 0x3F, 0x49, 0x90, 0xE4, 0xFF, 
+    0xB0, 0x23, 0xF6, 0xB3, 0xB1, 0x12, 0xD4, 0x52, 0xB3, 0x00, 0x49, 0xD2, 0x27, 0xA3, 0x0F, 0xD1, 0x0C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x12, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC5, 0x0C, 0xB1, 0xFD, 0x92, 0xA6, 0xD0, 0x61, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x36, 0x00, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xFF, 0x00, 0x76, 0x4E, 0xE6, 0x5B, 0x0E, 0xE4, 0xC9, 0x40, 0x4F, 0xF2, 0xB6, 0x27, 0x70, 0x82, 0xC0, 0x00, 0xB6, 0xBD, 0x6D, 0x00, 0xD0, 0x24, 0x7F, 0x00, 0x69, 0x02, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x7F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+    0xFF, 0x53, 0x09, 0xD0, 0x02, 0x03, 0x60, 0x03, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x96, 0x00, 0x39, 0x9B, 0x53, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0xB6, 0x4D, 0x92, 0x00, 0x80, 0x39, 0xC0, 0x00, 0x4E, 0xB2, 0x31, 0x08, 0x92, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0xC9, 0x96, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x40, 0x49, 0xD2, 0xB6, 0x04, 0x40, 0xF0, 0xFF, 0x0A, 0xB6, 0xDD, 0xB6, 0xDB, 0x16, 0x00, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x0C, 0xCC, 
+    0x3C, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 0xC9, 0x40, 0x49, 0xF2, 0xB6, 0x27, 0x70, 0x82, 0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0xB0, 0x6D, 0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0xB0, 0x6D, 
+    0xC0, 0x00, 0xB6, 0x43, 0x2F, 0x34, 0x42, 0x2F, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x04, 0x30, 0xFF, 0x53, 0x40, 0x02, 0x00, 0xDA, 0x56, 0xDB, 
+    0xFF, 0x4E, 0x01, 0x50, 0x00, 0x9B, 0xE0, 0x52, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x0C, 0xE4, 0x40, 0x0E, 0xE4, 0xC9, 0x40, 0x49, 0xF2, 0xB6, 0x27, 0x78, 0x82, 
+    0x4A, 0x00, 0x7A, 0x82, 0x27, 0x78, 0x82, 0x27, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xEA, 0x40, 0x49, 0xE2, 0xD6, 0xE6, 0x6C, 0xC2, 0xFF, 0x00, 0x76, 0x7C, 0xE6, 0x5F, 0x7E, 0xE4, 
+    0xFF, 0x40, 0x49, 0x72, 0xDB, 0xEF, 0xFA, 0xA2, 0xC0, 0x00, 0x76, 0xDC, 0x64, 0x4D, 0xD0, 0x24, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xC1, 0x1F, 0xFF, 0x9F, 0x92, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x6D, 0x03, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xB6, 0x9D, 0x92, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xED, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0xFF, 0x00, 0x89, 0x1D, 0x92, 0xD9, 0x16, 0x00, 0xDA, 0x40, 0x49, 0xD2, 0xB6, 0x12, 0x8D, 0x39, 0x61, 0x00, 0x5B, 0x82, 0x26, 0x7C, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA7, 0x00, 0x79, 0x95, 0x13, 0x31, 0x11, 0x93, 0xC4, 0x00, 0x10, 0x8B, 0xF5, 0xA2, 0x43, 0x3A, 0x82, 0x00, 0xED, 0x90, 0x78, 0xC9, 0x99, 0x7C, 0xCF, 0x3E, 0x52, 0x33, 0xF0, 0x04, 0x4F, 0xF0, 
+    0x26, 0x00, 0x49, 0xD2, 0x24, 0x4C, 0xDA, 0x04, 0xB5, 0x05, 0x31, 0x75, 0x4A, 0x1D, 0x46, 0x89, 0xA8, 0x1E, 0x58, 0x3D, 0xC7, 0x8E, 0x17, 0x0F, 0xEF, 0x26, 0x49, 0x62, 0xB7, 0xDC, 0x26, 0x14, 
+    0xE2, 0x26, 0xC9, 0x6D, 0x3F, 0x63, 0x0F, 0xD1, 0xAF, 0x20, 0x83, 0x6A, 0x62, 0xF1, 0x90, 0x57, 0x92, 0x00, 0x4D, 0x42, 0x27, 0x6A, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x69, 0x00, 0x49, 0x9A, 0x84, 0x89, 0x95, 0x14, 0xCB, 0x44, 0x9E, 0x5A, 0xCD, 0x04, 0x3F, 0x35, 0xFF, 0x80, 0x04, 0x60, 0x01, 0x1F, 0x90, 0x02, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x0E, 0xE4, 0x40, 0x0E, 0xE4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4E, 0x00, 0x00, 0x80, 0xFF, 0x78, 0x82, 0x27, 0x82, 0x00, 0x4C, 0xF2, 0x24, 0x09, 0x91, 0x24, 
+    0xA1, 0x00, 0x49, 0x92, 0xF0, 0x01, 0x93, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0xC9, 0x96, 0xB4, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x6D, 0x9B, 0x24, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x6D, 0x9B, 0x24, 
+    0xFF, 0x46, 0x09, 0x00, 0x00, 0x24, 0x69, 0xDB, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x6D, 0x9B, 0x24, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x6D, 0x9B, 0x24, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x98, 0x8B, 0x39, 0x98, 0x83, 0x39, 0x53, 0x00, 0x40, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x04, 0x43, 0x30, 0xFF, 0x00, 0x36, 0xFC, 0xFF, 0x49, 0x92, 0x24, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x3C, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x9A, 0xA4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x53, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0xFF, 0x00, 0xB6, 0xFD, 0xFF, 0x49, 0x02, 0x25, 
+    0x53, 0x00, 0x00, 0x62, 0x3B, 0x49, 0xE2, 0x24, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x00, 0xD0, 0xA8, 0xD5, 0xA3, 0xBF, 0x3E, 0x64, 0x00, 0xD8, 0xD6, 0x27, 0x49, 0x92, 0x24, 
+    0xAA, 0x00, 0xE5, 0x70, 0x77, 0x89, 0x99, 0xA4, 0xFF, 0x64, 0x03, 0x40, 0x49, 0x6E, 0x9B, 0x24, 0xFF, 0x00, 0x40, 0x2E, 0xE5, 0x5B, 0xDE, 0xE6, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0xF0, 0x1F, 0xEA, 0x6B, 0x21, 0x1E, 0xE2, 0x21, 0x1E, 0xE2, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x47, 0x7E, 0xE4, 
+    0xFF, 0x56, 0x29, 0x9C, 0xC2, 0x29, 0x9C, 0xC2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0x09, 0x90, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0xFF, 0x00, 0x01, 0x04, 0x60, 0xC0, 0x08, 0xB1, 0xB3, 0x00, 0x58, 0xBF, 0x3A, 0x74, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA9, 0x00, 0xB1, 0x1D, 0x13, 0x31, 0x11, 0x33, 0xB4, 0x00, 0xBF, 0x83, 0x39, 0x48, 0x9E, 0xBC, 0xC4, 0x00, 0xB9, 0x79, 0x73, 0xA5, 0x40, 0x61, 0xC7, 0x00, 0x02, 0x8D, 0xD1, 0xA3, 0x43, 0x3F, 
+    0x57, 0x00, 0x49, 0x96, 0x5C, 0x89, 0x91, 0x18, 0xB4, 0x16, 0xC4, 0x3C, 0xF1, 0x52, 0x23, 0x35, 0xC9, 0x05, 0xEF, 0xF0, 0x6E, 0xB7, 0x1B, 0x77, 0xC9, 0x00, 0x40, 0x32, 0xDB, 0x24, 0x29, 0x49, 
+    0xF0, 0x02, 0xC1, 0x68, 0x8B, 0x24, 0xB9, 0x91, 0x88, 0x0B, 0x0D, 0xC1, 0x54, 0x8C, 0xC5, 0x78, 0xB6, 0x00, 0xA2, 0x83, 0x39, 0x98, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x00, 0x89, 0x97, 0x77, 0x31, 0x95, 0x0E, 0xC6, 0x02, 0x10, 0x8D, 0xF5, 0xA2, 0xB3, 0xFE, 0xFF, 0x28, 0xA6, 0xF0, 0x0E, 0xEF, 0x10, 0x53, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x0E, 0xE4, 0x40, 0x0E, 0xE4, 0xD6, 0x56, 0xA1, 0x1A, 0xAA, 0x21, 0x1A, 0xAA, 0xFA, 0x00, 0x4E, 0xD2, 0x36, 0xDB, 0x46, 0x12, 0xE6, 0x00, 0x7E, 0xD2, 0xDA, 0x1A, 0x0B, 0x69, 
+    0x8B, 0x00, 0x49, 0xF2, 0x24, 0x6C, 0x82, 0x35, 0x5C, 0x00, 0xC9, 0x96, 0x18, 0x49, 0x90, 0x04, 0xCD, 0x00, 0xB6, 0x9D, 0xAC, 0xCB, 0x3A, 0xAC, 0x3D, 0x00, 0x00, 0x90, 0x24, 0x4F, 0x92, 0x24, 
+    0x3D, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x3D, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x3D, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x91, 0x14, 0xBB, 0x00, 0x49, 0x92, 0x24, 0xC2, 0x9C, 0xCC, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0xB0, 0x84, 0x44, 0x90, 0xBA, 0x3B, 0x49, 0xD2, 0xB6, 0x00, 0xB0, 0x6D, 0xBA, 0x3B, 0x49, 0xD2, 0xF6, 0x00, 0xBF, 0xF1, 
+    0xBA, 0x00, 0x76, 0x9E, 0xE5, 0x41, 0x1E, 0xE5, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xFF, 0x00, 0x4E, 0xD0, 0xB6, 0xDB, 0xE6, 0x04, 0xFF, 0x5B, 0x58, 0xF3, 0x37, 0x6D, 0x83, 0x35, 
+    0x1B, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x58, 0x00, 0x86, 0x74, 0x48, 0x87, 0x74, 0x9B, 0x00, 0xE0, 0x03, 0x3E, 0xEA, 0xA3, 0x3E, 0xAB, 0x00, 0xB1, 0x1D, 0x93, 0xF1, 0x10, 0x0F, 
+    0xEB, 0x2C, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x90, 0xAC, 0x2C, 0x49, 0x42, 0xB2, 0x00, 0x4A, 0xA0, 0xEB, 0x00, 0x7F, 0xFE, 0xE6, 0x5F, 0x7E, 0xE4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x92, 0x00, 0x6C, 0x4B, 0x49, 0x4C, 0x02, 0x00, 0x92, 0x00, 0x6D, 0x2B, 0x49, 0x49, 0x0C, 0x00, 0xEA, 0x6B, 0x21, 0x1E, 0xE2, 0x21, 0x1E, 0xE2, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x47, 0x7E, 0xE4, 
+    0xFF, 0x56, 0x29, 0x9C, 0xC2, 0x29, 0x9C, 0xC2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xFF, 0x0A, 0x74, 0x40, 0x87, 0xB4, 0x4B, 0xDF, 
+    0xFF, 0x00, 0x5A, 0x3D, 0xFA, 0xEB, 0x43, 0x21, 0x15, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x2A, 0x00, 0x41, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9B, 0x00, 0x49, 0x97, 0x53, 0x39, 0x91, 0x13, 0xC4, 0x00, 0xD2, 0x8A, 0xD5, 0xA2, 0x23, 0x3A, 0x38, 0x00, 0x70, 0xF2, 0x24, 0x49, 0x92, 0x24, 
+    0x57, 0x00, 0x89, 0x91, 0x1C, 0xC9, 0x95, 0x84, 0xB0, 0x17, 0x52, 0x23, 0x35, 0x03, 0x4F, 0xCC, 0xBC, 0x22, 0xE9, 0x70, 0x4A, 0x27, 0xF6, 0x4A, 0x92, 0x1E, 0xD0, 0x46, 0xFF, 0x4C, 0x22, 0x92, 
+    0xE5, 0x1E, 0xB6, 0x98, 0x88, 0x98, 0x28, 0x8E, 0xAA, 0x0E, 0x8D, 0xD9, 0x78, 0x7D, 0xC5, 0x0E, 0xB2, 0x00, 0x98, 0x83, 0x39, 0xA2, 0xB3, 0x3E, 0x29, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 
+    0xC6, 0x23, 0xE9, 0x70, 0x4A, 0x26, 0xD6, 0x81, 0x92, 0x00, 0xE2, 0x39, 0x00, 0x7C, 0xD2, 0x48, 0xC5, 0x00, 0xEF, 0xB0, 0x51, 0x79, 0xC5, 0x77, 0xFF, 0xC3, 0x00, 0x30, 0x00, 0x06, 0x10, 0x00, 
+    0xFF, 0x00, 0x40, 0x0E, 0xE4, 0x40, 0x0E, 0xE4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x55, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0xFF, 0x15, 0x06, 0x14, 0x00, 0xC0, 0x0B, 0x00, 
+    0xF5, 0x19, 0xA3, 0xA3, 0xF5, 0x58, 0x8F, 0xF5, 0xD6, 0x00, 0xC9, 0x9B, 0xB4, 0xC9, 0x96, 0x00, 0xD6, 0x17, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xD6, 0x17, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xD6, 0x17, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xD6, 0x17, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xD6, 0x17, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x4F, 0x30, 0x04, 0x43, 0x30, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x4F, 0xF2, 0x24, 0xFF, 0x00, 0xB6, 0xFD, 0xFF, 0x49, 0x82, 0x24, 
+    0x53, 0x00, 0x41, 0x6C, 0xC7, 0x49, 0xBC, 0xC4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x69, 0x00, 0x03, 0xB0, 0xB6, 0x7B, 0xB2, 0x27, 0xFF, 0x29, 0xB6, 0x9D, 0xC4, 0x10, 0x0D, 0xD1, 
+    0x1B, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0x16, 0x31, 0x04, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x00, 0xEB, 0xB3, 0x3E, 0xA2, 0x83, 0xD5, 0xB9, 0x00, 0x31, 0x19, 0xFF, 0xF1, 0xF0, 0x24, 
+    0xF9, 0x00, 0x6D, 0xFB, 0xFF, 0x48, 0x9C, 0xBC, 0xF9, 0x69, 0xA9, 0x92, 0x22, 0x27, 0xE2, 0x35, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x47, 0x7E, 0xE4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x52, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x52, 0x00, 0x00, 0x60, 0x9B, 0x49, 0x98, 0x84, 0xEA, 0x6B, 0x21, 0x1E, 0xE2, 0x21, 0x1E, 0xE2, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x47, 0x7E, 0xE4, 
+    0xFF, 0x56, 0x29, 0x9C, 0xC2, 0x29, 0x9C, 0xC2, 0xE3, 0x00, 0x4E, 0xEE, 0xA4, 0x4E, 0xE6, 0x04, 0xE3, 0x24, 0x49, 0x62, 0xDB, 0xEF, 0xF8, 0x02, 0xE3, 0x1C, 0x49, 0xE2, 0xB4, 0xCE, 0x06, 0x00, 
+    0xE3, 0x1F, 0xF1, 0x14, 0x4F, 0xF1, 0x04, 0x40, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x82, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xE0, 0x00, 0x74, 0x0C, 0xE7, 0x74, 0x42, 0x27, 
+    0xFF, 0x16, 0x9D, 0x60, 0x0E, 0x2F, 0x15, 0x77, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x79, 0x19, 0x53, 0xF1, 0x10, 0x53, 0xE6, 0x00, 0xAD, 0x33, 0xF6, 0x58, 0x2F, 0xF6, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x22, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xB1, 0x00, 0x94, 0xD8, 0x61, 0xAF, 0x10, 0x53, 0xAF, 0x2C, 0xF1, 0xE0, 0x98, 0x74, 0x8E, 0xF5, 0xBA, 0x1A, 0x90, 0xB0, 0x8D, 0xB6, 0xFD, 0x24, 
+    0xB6, 0x0C, 0xA2, 0x40, 0x73, 0xCF, 0x7D, 0x97, 0xB7, 0x00, 0x92, 0xA6, 0x8D, 0xAC, 0x2D, 0x2C, 0x60, 0x00, 0x68, 0xC2, 0x24, 0x49, 0x92, 0x24, 0x80, 0x00, 0x49, 0x9A, 0x7C, 0x49, 0x95, 0x10, 
+    0xCC, 0x2B, 0xD5, 0x4A, 0xD0, 0x13, 0xAF, 0x35, 0x39, 0x00, 0x00, 0xD0, 0x24, 0x4F, 0x92, 0x24, 0x71, 0x00, 0x24, 0x91, 0x58, 0xC9, 0x99, 0xA4, 0xFF, 0x6C, 0x15, 0xE0, 0x01, 0xE7, 0x16, 0xDB, 
+    0xFF, 0x00, 0x40, 0x0E, 0xE4, 0x52, 0x4E, 0xE6, 0xD6, 0x56, 0xA1, 0x1A, 0xAA, 0x21, 0x1A, 0x92, 0xAE, 0x2E, 0x4E, 0x42, 0x92, 0x00, 0x20, 0x49, 0xFF, 0x2E, 0x01, 0x60, 0x40, 0xD4, 0x46, 0xB6, 
+    0xE4, 0x00, 0x58, 0x2F, 0xF6, 0xAB, 0x53, 0x27, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+    0xFF, 0x68, 0x00, 0x90, 0x00, 0x2D, 0xD0, 0x02, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xD6, 0x0A, 0xA0, 0x0F, 0x9A, 0xA0, 0x03, 0x3A, 0xB5, 0x00, 0x4E, 0xB2, 0x25, 0x41, 0x12, 0x25, 0x7F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x04, 0xC5, 0x6D, 0xFF, 0x35, 0x49, 0x62, 0xD8, 0x24, 0x49, 0x92, 0xBB, 0x35, 0x49, 0xD2, 0xB6, 0x00, 0x28, 0x89, 
+    0x3C, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xDB, 0x00, 0xC1, 0x9A, 0xAC, 0x49, 0x9A, 0x24, 
+    0x1B, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x68, 0xA2, 0x03, 0xB1, 0x00, 0x06, 0x00, 0xFB, 0x25, 0x4F, 0x52, 0xDB, 0x23, 0x09, 0x4C, 
+    0xFF, 0x1F, 0xB9, 0xEB, 0x72, 0x9C, 0x22, 0x20, 0xEC, 0x5F, 0x24, 0x1E, 0xE2, 0x29, 0x9F, 0xF6, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x57, 0x7E, 0xE6, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xB2, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xEA, 0x6B, 0x21, 0x1E, 0xE2, 0x21, 0x9F, 0xF6, 0xFF, 0x00, 0x47, 0x7E, 0xE4, 0x57, 0x7E, 0xE6, 
+    0xFF, 0x56, 0x29, 0x9C, 0xC2, 0xA9, 0x9C, 0xD6, 0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x6E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x9A, 0x00, 0xF1, 0x90, 0x57, 0x89, 0x99, 0xA4, 0xFF, 0x70, 0x03, 0x50, 0x01, 0xE6, 0x16, 0xDB, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x52, 0x42, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6D, 0x00, 0xF1, 0x90, 0xBC, 0x49, 0x92, 0x24, 0x76, 0x00, 0x50, 0x53, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x62, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x82, 0xD6, 0x09, 0x37, 0x99, 0xDC, 0xAB, 0x3E, 0xB5, 0x0D, 0x49, 0xDC, 0x96, 0xFF, 
+    0xAF, 0x15, 0xE4, 0x20, 0x68, 0x1B, 0x6B, 0x3F, 0xA1, 0x00, 0x18, 0xBD, 0x3E, 0x7E, 0x92, 0x24, 0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x96, 0x00, 0x39, 0x11, 0xCF, 0x49, 0x92, 0x24, 
+    0xD2, 0x00, 0x68, 0x7F, 0x3A, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x40, 0x6C, 0xC7, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x80, 0x66, 0x3F, 0x49, 0x92, 0x24, 
+    0x28, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0x60, 0x00, 0xB1, 0x10, 0xCB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0xC0, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0xE2, 0x38, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0xB4, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x3C, 0x00, 0x48, 0xCA, 0xA4, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x20, 0xDB, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x1B, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x40, 0x0B, 0xFC, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x40, 0x0E, 0xE4, 0x48, 0x92, 0x24, 0x61, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x61, 0x00, 0x40, 0x6C, 0xC7, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x4A, 0x00, 0x78, 0xD2, 0x27, 0x49, 0x92, 0x24, 0x2B, 0x00, 0x49, 0x90, 0x64, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x40, 0x6C, 0xC7, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x4E, 0xF0, 0x07, 0x49, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x40, 0x0B, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x92, 0x24, 0x60, 0x00, 0x16, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0xD8, 0x63, 0x3F, 0x49, 0x92, 0x24, 
+    0x18, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x40, 0x62, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x3C, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA9, 0x00, 0x49, 0x92, 0x24, 0xA7, 0x74, 0x16, 0x56, 0x00, 0x49, 0x92, 0x24, 0x70, 0x32, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0C, 0x00, 0x19, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0xAB, 0x00, 0x49, 0x92, 0x24, 0xA7, 0xE4, 0xA2, 0x57, 0x00, 0x49, 0x92, 0x24, 0x70, 0x0C, 0xC7, 0x9A, 0x00, 0x49, 0x92, 0x24, 0xC4, 0xCA, 0xA2, 0x30, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 
+    0x18, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x04, 0xC8, 0x00, 0x49, 0x92, 0x24, 0x1D, 0x56, 0xDB, 0x49, 0x00, 0x49, 0x92, 0x24, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x44, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x0E, 0x55, 0x00, 0x49, 0x92, 0x24, 0xB7, 0x0F, 0x40, 0x42, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x49, 0x92, 0x24, 0x89, 0x91, 0x18, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x14, 0x60, 0xDB, 0x40, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x02, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x55, 0x00, 0x49, 0x92, 0x24, 0xF9, 0x4D, 0x01, 
+    0x55, 0x00, 0x49, 0x92, 0x24, 0x7E, 0x02, 0x8D, 0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x62, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x68, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x04, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x0E, 0xC0, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x3F, 0x60, 0x03, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x82, 0xD8, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x80, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x48, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x48, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x32, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x1F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 
+    0xC9, 0x16, 0x29, 0x99, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0x31, 0x19, 0x4F, 0xF1, 0x10, 0x0F, 0xCF, 0x00, 0xEB, 0xB3, 0x3E, 0xA2, 0x83, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5B, 0x00, 0x49, 0x9E, 0xA4, 0xC9, 0x97, 0x18, 
+    0xD7, 0x4D, 0x69, 0x7B, 0x8A, 0x1E, 0x48, 0x80, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x56, 0xB1, 0x1B, 0x6A, 0x21, 0x10, 0xA2, 0xBD, 0x00, 0x7D, 0x42, 0x27, 0xA2, 0x83, 0xF5, 
+    0x18, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC8, 0x57, 0x69, 0x1B, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x99, 0x00, 0x49, 0x9E, 0xBC, 0x79, 0x17, 0x0F, 
+    0xC9, 0x34, 0x71, 0x6B, 0x0A, 0x83, 0x06, 0xD1, 0xCD, 0x46, 0x24, 0x09, 0x00, 0x6C, 0xF9, 0xE4, 0xC4, 0x30, 0xAC, 0x03, 0xB1, 0x03, 0x56, 0x0A, 0x94, 0x00, 0x4F, 0xD2, 0x27, 0x6B, 0x82, 0x39, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4F, 0x6D, 0x4B, 0x00, 0x44, 0x49, 0x34, 0xC0, 0x00, 0xDB, 0x06, 0x20, 0xDB, 0xD6, 0xB6, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xF4, 0x00, 0x89, 0x7D, 0x97, 0x2E, 0x55, 0x0A, 0xFF, 0x46, 0x76, 0xCB, 0x6D, 0x02, 0x0C, 0x20, 
+    0xFF, 0x47, 0xAD, 0xBF, 0x8D, 0x06, 0x14, 0x00, 0xF0, 0x00, 0x7E, 0xC2, 0x3A, 0x62, 0x0D, 0xB1, 0x2C, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xD6, 0x16, 0x31, 0x19, 0x4F, 0xF1, 0x18, 0x0F, 
+    0xC0, 0x4F, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x4F, 0x6D, 0x0D, 0x40, 0xE4, 0x94, 0xDC, 0xCF, 0x00, 0xF5, 0x33, 0xF6, 0x10, 0x3D, 0xAC, 0xFF, 0x00, 0x49, 0x90, 0x24, 0x49, 0xF2, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x7A, 0x00, 0x50, 0x00, 0x01, 0x20, 0x49, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xC4, 0xC0, 0x53, 0x6D, 0x5B, 0x00, 0x25, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x91, 0x04, 0xFF, 0x3C, 0xB6, 0xBD, 0x6D, 0x0E, 0xE0, 0xFC, 
+    0xDF, 0x20, 0xA4, 0xA3, 0x39, 0x98, 0x63, 0x3B, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x6D, 0x33, 0x20, 0x43, 0x33, 0x34, 0xFF, 0x02, 0x69, 0x9B, 0x6D, 0x01, 0x10, 0x00, 
+    0xFF, 0x76, 0xFF, 0x4F, 0x32, 0x00, 0x02, 0x20, 0xB6, 0x2B, 0x64, 0x03, 0x35, 0x50, 0x03, 0x35, 0xFF, 0x00, 0x0C, 0xB9, 0x6C, 0x08, 0x80, 0x00, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x24, 0xB9, 0x6D, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xFF, 0x17, 0x71, 0x7B, 0x73, 0xEF, 0x60, 0x0A, 0xFF, 0x00, 0x24, 0xB3, 0x2D, 0x00, 0x02, 0x20, 
+    0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0xB2, 0xE4, 0x48, 0x9E, 0xC4, 0xE1, 0x42, 0x69, 0xFB, 0x4A, 0x26, 0xE4, 0x79, 
+    0xFF, 0x00, 0x24, 0xB9, 0x6D, 0x00, 0x00, 0x20, 0x68, 0x00, 0x49, 0x9A, 0x64, 0x89, 0x95, 0x14, 0xFF, 0x6E, 0xF9, 0x7F, 0x92, 0x1E, 0x50, 0x01, 0xFF, 0x00, 0x64, 0xB2, 0x25, 0x40, 0x02, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x20, 
+    0xD6, 0x16, 0xF1, 0x10, 0x4F, 0xF1, 0x14, 0x4F, 0xC4, 0x36, 0x55, 0x53, 0xF0, 0xFC, 0xCC, 0x8B, 0x43, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x27, 0xBB, 0x00, 0x89, 0x99, 0x77, 0x31, 0x95, 0x0E, 
+    0xD7, 0x4C, 0x23, 0xA8, 0x86, 0xB3, 0xC8, 0x8B, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xF1, 0x0A, 0x5E, 0x6D, 0xB1, 0xC6, 0xE8, 0x68, 
+    0x75, 0x00, 0x4F, 0xDE, 0xE4, 0x73, 0x0E, 0xFE, 0xC8, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x8E, 0xC7, 0xCD, 0x17, 0x31, 0xF5, 0x0A, 0xA6, 0xE4, 0x61, 
+    0xAE, 0x00, 0x58, 0xAD, 0x3E, 0x73, 0xC2, 0x27, 0x15, 0x00, 0x72, 0x91, 0x24, 0x49, 0x92, 0x24, 0xB4, 0x00, 0xEE, 0x10, 0x53, 0x89, 0x97, 0x9C, 0xCB, 0x11, 0xA2, 0x83, 0xF5, 0x12, 0x3D, 0xD0, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0xF1, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x04, 0x43, 0x30, 0x0A, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x75, 0x00, 0x49, 0x92, 0x24, 0x29, 0x92, 0x24, 
+    0xB3, 0x00, 0x49, 0x92, 0x24, 0x58, 0x92, 0x24, 0x8F, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xFF, 0x89, 0xA9, 0xE0, 0x01, 0x05, 0x40, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x24, 0xFF, 0x83, 0x50, 0x03, 0xCC, 0x80, 0x0A, 0x80, 0x88, 0x00, 0x7C, 0x32, 0x27, 0x6A, 0x02, 0x3E, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0x74, 0x02, 0x27, 0x70, 0x42, 0x27, 0x48, 0x00, 0x76, 0x91, 0x64, 0x49, 0x98, 0x58, 0xBC, 0x6C, 0x86, 0x1E, 0xE1, 0x11, 0x7E, 0xE8, 0x3D, 0x00, 0x4A, 0x82, 0x24, 0x48, 0xA2, 0x24, 
+    0xC5, 0x00, 0x89, 0xF4, 0x0A, 0x49, 0x92, 0x24, 0xB4, 0x00, 0x00, 0xB0, 0x6E, 0xB6, 0x9D, 0x24, 0xB4, 0x00, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 0xB4, 0x00, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 
+    0xB4, 0x00, 0xC8, 0xBF, 0x24, 0x4E, 0x92, 0x24, 0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x13, 0x77, 0x76, 0x63, 0x07, 0x76, 0x63, 0x7C, 0x00, 0xE8, 0x8F, 0x26, 0x68, 0x82, 0x26, 
+    0xDF, 0x00, 0xFF, 0x8F, 0xF5, 0x58, 0x9F, 0xF5, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0xFF, 0x02, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0x76, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x02, 0x24, 0x48, 0x92, 0x24, 0x7A, 0x00, 0x49, 0x9A, 0x9C, 0x89, 0x95, 0x10, 0xFF, 0x71, 0xA9, 0x70, 0x02, 0x1E, 0x50, 0x01, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x24, 0x48, 0x92, 0x24, 0x89, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xFF, 0x2E, 0x9D, 0x49, 0xBD, 0xC4, 0x3B, 0xC4, 
+    0xFF, 0x00, 0x02, 0x22, 0x20, 0x03, 0x32, 0x21, 0xB2, 0x00, 0x89, 0x97, 0x57, 0x39, 0x15, 0x0F, 0xFF, 0xB8, 0x11, 0x60, 0x00, 0x04, 0x30, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x94, 0x40, 0x93, 0x00, 0xE1, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xEA, 0x07, 0xB4, 0x48, 0x63, 0x74, 0x44, 0x07, 0xA4, 0x00, 0x7C, 0x32, 0x27, 0xEA, 0x0F, 0xDA, 0xC1, 0x22, 0xE9, 0x74, 0x6A, 0x1E, 0x58, 0xA9, 
+    0xC5, 0x00, 0x34, 0xD6, 0x63, 0x3D, 0xE6, 0x60, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xFF, 0x00, 0x0E, 0xE4, 0x00, 0x4E, 0xE0, 0x04, 
+    0xFF, 0x18, 0xF4, 0xB3, 0x3A, 0x62, 0x8F, 0xD1, 0xC8, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x8C, 0xA7, 0x78, 0x8A, 0xC7, 0xD3, 0x55, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0x82, 
+    0x56, 0x00, 0x78, 0xA2, 0x27, 0x7A, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x5C, 0x89, 0x95, 0x18, 0xD3, 0x4E, 0x04, 0x43, 0x30, 0x04, 0x43, 0x34, 
+    0x56, 0x00, 0x8F, 0xE1, 0x18, 0x8E, 0xF1, 0x18, 0xD6, 0x4A, 0x54, 0x43, 0x35, 0x54, 0x43, 0x54, 0xB9, 0x00, 0xFF, 0xD3, 0xB6, 0x49, 0x04, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9C, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xFF, 0x0C, 0x82, 0x23, 0x3A, 0xA2, 0x23, 0x00, 0xFF, 0x09, 0x18, 0x0B, 0x8E, 0x2F, 0x97, 0x97, 
+    0xC4, 0x00, 0x7E, 0x42, 0x3F, 0xA2, 0x83, 0xD1, 0xFF, 0x00, 0x07, 0x74, 0x50, 0x31, 0x95, 0x40, 0x95, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0xD6, 0x16, 0xF1, 0x10, 0x8F, 0xF1, 0x10, 0x0F, 
+    0xC2, 0x17, 0xB3, 0x4D, 0x92, 0x00, 0xB0, 0x2D, 0xCB, 0x43, 0xC9, 0xDD, 0x72, 0x00, 0x74, 0xA2, 0xD0, 0x00, 0xC3, 0x0A, 0xD1, 0x63, 0x5F, 0x3F, 0x25, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x24, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x60, 0x00, 0x09, 0x9C, 0xC4, 0x49, 0x92, 0x24, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0xFF, 0x02, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0x76, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x24, 0xFF, 0x00, 0x00, 0x82, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD4, 0x00, 0x79, 0x17, 0x53, 0x31, 0xF5, 0x0E, 0xFF, 0xCC, 0x01, 0x50, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xFF, 0x00, 0x00, 0x82, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD4, 0x00, 0x79, 0x17, 0x53, 0x31, 0xF5, 0x0E, 0xFF, 0x00, 0xC2, 0x2D, 0xC4, 0x40, 0x0E, 0xE4, 
+    0xFF, 0x00, 0x14, 0xC2, 0x21, 0x9D, 0x52, 0x2A, 0xFB, 0x0D, 0x31, 0x77, 0x53, 0xEF, 0xE4, 0x0E, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0xB6, 0xFF, 0x00, 0x09, 0x14, 0x40, 0x01, 0xF4, 0xFF, 0x93, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x53, 0x3E, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xFF, 0x00, 0x74, 0x40, 0x07, 0x74, 0x40, 0x27, 0xFF, 0x46, 0x74, 0xB2, 0xFE, 0xA2, 0x8D, 0xB5, 0xBF, 0x0E, 0xC3, 0x2A, 0xD0, 0x50, 0x8F, 0x39, 
+    0xD7, 0x00, 0x27, 0x16, 0x62, 0x21, 0x16, 0x62, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xFF, 0x00, 0x4E, 0xE0, 0x24, 0x4E, 0xE2, 0x24, 
+    0xFF, 0x85, 0x50, 0x03, 0xCC, 0x00, 0x08, 0x40, 0xC8, 0x57, 0x21, 0x6A, 0xA2, 0x24, 0x2A, 0xA2, 0x49, 0x00, 0x78, 0x8E, 0x27, 0x78, 0x82, 0x27, 0xD0, 0x09, 0x26, 0x66, 0x4A, 0xEF, 0x10, 0x53, 
+    0xC3, 0x00, 0x74, 0x32, 0x3F, 0xA2, 0x8F, 0xB1, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x0D, 0xC9, 0x00, 0x89, 0x99, 0x77, 0x37, 0x55, 0x0E, 0xC9, 0x02, 0x02, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x4B, 0x30, 0x04, 0x43, 0x30, 0x79, 0x00, 0x00, 0xD0, 0xB6, 0x4F, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x88, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 0xFF, 0x78, 0x04, 0x50, 0x01, 0x1E, 0x90, 0x0E, 0xFF, 0x00, 0x89, 0x9B, 0xDC, 0x48, 0x0E, 0xE4, 
+    0xBF, 0x1E, 0xC2, 0x4A, 0x61, 0xA6, 0x10, 0x53, 0xFC, 0x00, 0x0F, 0xD6, 0x6B, 0xB4, 0x38, 0xAE, 0x81, 0x00, 0x60, 0xA2, 0x26, 0x73, 0xD2, 0x24, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 
+    0x8A, 0x00, 0x20, 0x09, 0xFE, 0xE0, 0x03, 0x3E, 0xC7, 0x00, 0xA5, 0xF0, 0x0E, 0x31, 0x95, 0x77, 0xFF, 0x00, 0x4F, 0x82, 0x24, 0x02, 0x20, 0x00, 0xFF, 0x00, 0x49, 0x9E, 0xC4, 0x40, 0x08, 0x44, 
+    0xD5, 0x16, 0x49, 0x62, 0xDB, 0xEF, 0x06, 0x00, 0xD5, 0x16, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xD5, 0x00, 0xFF, 0xD3, 0xB6, 0xDB, 0x06, 0x00, 0xD5, 0x00, 0x49, 0x52, 0xAC, 0xDB, 0x0A, 0x24, 
+    0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFC, 0x24, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC9, 0x9B, 0xBC, 0x09, 0x90, 0x00, 0xFF, 0x42, 0x85, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x76, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2B, 0xA3, 0x03, 0x1A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x08, 0x80, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x02, 0x20, 
+    0x37, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x96, 0x04, 0xFF, 0x38, 0x31, 0xF5, 0x0E, 0xA7, 0x60, 0x0A, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x02, 0x00, 0x1D, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 0xFF, 0x2F, 0x31, 0xF5, 0x0E, 0xEF, 0x60, 0x0A, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xC4, 0x13, 0x1E, 0x72, 0xEA, 0xAF, 0x1E, 0xCF, 0xFF, 0x56, 0xE9, 0xF0, 0x0A, 0xA7, 0x60, 0x02, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x96, 0xB6, 0xFF, 0x4A, 0x8E, 0x61, 0x92, 0x6D, 0xFB, 0xFF, 0xD2, 0x60, 0xFF, 0xBF, 0x0D, 0x24, 0x99, 0x24, 0x93, 0x00, 0xE2, 0x03, 0x3E, 0xE0, 0x33, 0x3E, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0xB6, 0xDF, 0x00, 0x74, 0x42, 0x07, 0x74, 0x52, 0x27, 0xFF, 0x60, 0x50, 0x2B, 0x69, 0x6D, 0x9B, 0x24, 0xA7, 0x00, 0x98, 0x23, 0x3E, 0x6B, 0x42, 0x27, 
+    0xFF, 0x46, 0xF0, 0x1A, 0xAF, 0x69, 0x9B, 0xFF, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x9A, 0xFF, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 
+    0xFF, 0x00, 0x00, 0x10, 0x49, 0x21, 0x99, 0xB6, 0xEB, 0x60, 0xC2, 0x2C, 0xCD, 0x6D, 0x9D, 0x24, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x84, 0x00, 0x31, 0x91, 0x78, 0x49, 0x9C, 0x24, 
+    0xC4, 0x18, 0x82, 0x48, 0x01, 0xE6, 0x94, 0xBB, 0xB2, 0x67, 0x4F, 0x0E, 0x09, 0x02, 0xF4, 0x3F, 0xC9, 0x13, 0x14, 0x04, 0x8C, 0x63, 0x5D, 0x3F, 0x7E, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x04, 0xF3, 0x3F, 0x0A, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xDB, 0x00, 0xA5, 0xF0, 0x72, 0x79, 0x99, 0xDC, 0xFF, 0x4E, 0x00, 0x30, 0x49, 0x2E, 0x99, 0xFF, 
+    0xE9, 0x00, 0x79, 0x39, 0x48, 0xDB, 0xD8, 0xD6, 0xDC, 0x24, 0x58, 0x3D, 0x3A, 0x3D, 0x76, 0x8C, 0xB5, 0x00, 0x8F, 0x82, 0x31, 0xA3, 0x53, 0x27, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0xB6, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x33, 0x3E, 0x76, 0x00, 0x09, 0x91, 0x78, 0x49, 0x98, 0xC4, 0xFF, 0x5E, 0x14, 0xE0, 0x49, 0x6F, 0x9B, 0x24, 0xFF, 0x00, 0x40, 0x20, 0x05, 0x64, 0xD0, 0x06, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x5C, 0x01, 0x50, 0x00, 0x24, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x09, 0x90, 0x48, 0x08, 0x89, 0xB4, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFC, 0x24, 0x31, 0x16, 0x6B, 0x31, 0x69, 0xDB, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0xB2, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x68, 0x40, 0x02, 0xB4, 0x40, 0x01, 0xE4, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x08, 0x80, 0x48, 0x08, 0x89, 0xB4, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 
+    0xFF, 0x0C, 0x40, 0x2C, 0x49, 0x24, 0x69, 0xDB, 0xFF, 0x60, 0x26, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x00, 0x22, 0x29, 0x24, 0xD3, 0x36, 
+    0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x2A, 0x00, 0x22, 0x49, 0x24, 0x69, 0xDB, 0xFF, 0x60, 0xA9, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x40, 0x22, 0x25, 0x64, 0xD2, 0x26, 
+    0xB7, 0x00, 0xF1, 0x10, 0x53, 0x79, 0x95, 0x94, 0xFF, 0x60, 0x1E, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x40, 0x22, 0x25, 0x64, 0xD2, 0x26, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x93, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x46, 0x9B, 0x24, 0x49, 0x92, 0x24, 0x47, 0x00, 0xC5, 0x9B, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x68, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x58, 0x96, 0x24, 0x49, 0x92, 0x24, 0x56, 0x00, 0x68, 0x9B, 0x24, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x23, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x02, 0x94, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x6D, 0x91, 0x24, 0x49, 0x92, 0x24, 0x0A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x9D, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x32, 0x00, 0xD0, 0x9C, 0x24, 0x49, 0x92, 0x24, 0xA8, 0x00, 0xC1, 0x8A, 0xF5, 0xEB, 0x93, 0x24, 0x27, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x56, 0x00, 0x46, 0x9B, 0x24, 0x49, 0x92, 0x24, 
+    0x4A, 0x00, 0xC5, 0x93, 0x24, 0x49, 0x92, 0x24, 0x09, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x7F, 0x90, 0x04, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xC8, 0x8F, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC8, 0x8F, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xA5, 0xE0, 0xDA, 0x37, 0x97, 0x97, 0xC0, 0x00, 0x74, 0xB2, 0x3E, 0x5B, 0x0F, 0xD1, 0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xB4, 0x00, 0xC9, 0x9B, 0xB8, 0x39, 0xF5, 0x0E, 
+    0xE5, 0x10, 0xC4, 0x38, 0xD3, 0x5C, 0xBF, 0x3A, 0x95, 0x00, 0x0D, 0xE1, 0x54, 0xC9, 0x99, 0xA4, 0xFF, 0x2A, 0x83, 0xF3, 0xF7, 0x5D, 0x6D, 0xAE, 0x4F, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x02, 0x27, 
+    0x66, 0x00, 0x49, 0x9E, 0xA4, 0xC9, 0x97, 0x14, 0xE8, 0x40, 0x31, 0x76, 0xA6, 0x2D, 0xCD, 0xF5, 0x79, 0x00, 0x60, 0x32, 0x27, 0x4D, 0xE2, 0x24, 0xDA, 0x1B, 0xF1, 0x10, 0xFF, 0x31, 0x19, 0x0F, 
+    0xFF, 0x40, 0x00, 0x90, 0x24, 0xB6, 0xBD, 0x6D, 0xFF, 0x40, 0x00, 0x90, 0x24, 0xB6, 0xBD, 0x6D, 0xFF, 0x40, 0x50, 0x9F, 0xE4, 0xB6, 0xBF, 0xF5, 0xC8, 0x00, 0x4F, 0xF2, 0xA4, 0x4F, 0xF6, 0x04, 
+    0xBF, 0x09, 0x49, 0x62, 0xDB, 0xDE, 0xE6, 0x61, 0xC8, 0x09, 0x49, 0x62, 0xDB, 0xDB, 0x2A, 0xA8, 0xBE, 0x00, 0x49, 0xF2, 0xC4, 0x4F, 0xF6, 0x04, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0xE2, 0xBC, 0xCB, 0x8B, 0xBC, 0xC8, 0x09, 0x49, 0x62, 0xDB, 0xDB, 0x36, 0x68, 
+    0xC8, 0x08, 0x49, 0x62, 0xDB, 0x9B, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA8, 0x00, 0x89, 0x99, 0x74, 0x39, 0x17, 0x0F, 0xA7, 0x00, 0xE2, 0x83, 0x3A, 0x53, 0x2F, 0xD0, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB6, 0x02, 0x49, 0xD2, 0xB6, 0xF3, 0x06, 0x0F, 0xB6, 0x02, 0x49, 0xD2, 0xB6, 0xDB, 0x06, 0x00, 0xB6, 0x02, 0x49, 0xD2, 0xB6, 0xDB, 0x06, 0x00, 
+    0xB6, 0x02, 0x49, 0xD2, 0xB6, 0xE3, 0x07, 0x1E, 0xE8, 0x00, 0xE1, 0x90, 0xF2, 0x71, 0x97, 0x9B, 0xA4, 0x00, 0x73, 0x22, 0x3F, 0x9C, 0x03, 0xF1, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9D, 0x00, 0x49, 0x92, 0xDC, 0x79, 0xF7, 0x0E, 0xD6, 0x06, 0xC9, 0xEF, 0xB6, 0xDC, 0x26, 0x0C, 0xCA, 0x00, 0x4F, 0x52, 0x3F, 0x63, 0x0D, 0xAD, 0x29, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 
+    0xD5, 0x16, 0x49, 0x62, 0xDB, 0x7B, 0x87, 0x57, 0xA9, 0x00, 0xFF, 0x43, 0x3A, 0xA2, 0x03, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x04, 0x09, 0x00, 0x00, 
+    0xFF, 0x00, 0x41, 0x00, 0x04, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x56, 0x00, 0x00, 0x20, 0x00, 0x0A, 0x00, 0xFF, 0x17, 0x01, 0x60, 0x00, 0x04, 0x30, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x56, 0x00, 0x89, 0x9D, 0x04, 0x49, 0x92, 0x24, 0xD5, 0x00, 0xFF, 0xDF, 0xB6, 0xD9, 0x96, 0x00, 
+    0xD5, 0x16, 0x49, 0x62, 0xDB, 0x33, 0x07, 0x53, 0x87, 0x00, 0x7F, 0x42, 0x26, 0x60, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xAA, 0x00, 0x7F, 0x42, 0x26, 0x51, 0x12, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x04, 0x49, 0x90, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x55, 0xC0, 0x0C, 0xC4, 0x40, 0x3D, 0xD2, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x6F, 0x00, 0x09, 0x91, 0x7C, 0x49, 0x9A, 0x24, 0xCB, 0x38, 0x03, 0x5D, 0x89, 0x26, 0x96, 0x0E, 0x96, 0x00, 0x4E, 0xC2, 0xC7, 0xEB, 0x0B, 0x76, 0xC5, 0x38, 0xE9, 0x60, 0x62, 0x95, 0x3A, 0xD0, 
+    0x8C, 0x00, 0xA0, 0xB3, 0x26, 0x7D, 0xE2, 0x24, 0x16, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xC5, 0x00, 0x1D, 0x64, 0x0A, 0x37, 0x95, 0x77, 0xCB, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 
+    0xC2, 0x00, 0x79, 0x17, 0x53, 0xEF, 0x60, 0x4A, 0xBD, 0x00, 0x10, 0x8D, 0xF5, 0xA2, 0xB3, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x92, 0x00, 0x27, 0x70, 0x92, 0xFF, 0x9F, 0x24, 
+    0x92, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0xFF, 0x00, 0x24, 0x69, 0xDB, 0xFF, 0x9F, 0x40, 0xD5, 0x00, 0xC3, 0x5A, 0xD1, 0x5A, 0xBF, 0x3A, 0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x49, 0x90, 0x04, 
+    0xCD, 0x3F, 0xA9, 0x98, 0x8A, 0x29, 0x98, 0x82, 0xA0, 0x00, 0xDB, 0x58, 0x9B, 0x3D, 0xD8, 0x87, 0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0xF0, 0x04, 0xFF, 0xFE, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFE, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC8, 0x8D, 0xDC, 0xC8, 0x8D, 0xDC, 0x97, 0x00, 0x5B, 0x65, 0x57, 0x48, 0x95, 0x54, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xB8, 0x10, 0xF1, 0xF0, 0x4A, 0x26, 0x56, 0x81, 0xFE, 0x35, 0xA6, 0xE3, 0xF5, 0x17, 0x1D, 0xAC, 
+    0x4D, 0x00, 0x49, 0xD2, 0x24, 0x4B, 0x02, 0x27, 0x76, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x76, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x76, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 
+    0x76, 0x00, 0x90, 0xD1, 0xB6, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x49, 0x91, 0x84, 0x49, 0x9C, 0x24, 0xAB, 0x2B, 0x02, 0x4F, 0xCC, 0x1E, 0x98, 0x7F, 0x55, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x02, 0x27, 
+    0xCE, 0x29, 0xE9, 0xF0, 0x4A, 0x27, 0xF9, 0xDF, 0xFF, 0x00, 0x00, 0xB0, 0x3C, 0xB5, 0xDD, 0x92, 0xFF, 0x0B, 0xD0, 0x9A, 0x88, 0xAE, 0x49, 0x92, 0x65, 0x00, 0x7B, 0x22, 0x27, 0x68, 0x82, 0x26, 
+    0xFF, 0x30, 0x88, 0x89, 0x98, 0x88, 0x89, 0x98, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0xFF, 0x00, 0x49, 0x90, 0x00, 0x39, 0x00, 0x03, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x00, 0x44, 0x40, 0x08, 0xC4, 0xFF, 0x4D, 0x00, 0xB0, 0x6D, 0x6D, 0x9B, 0x24, 0xFF, 0x4D, 0x00, 0xB0, 0x6D, 0x6D, 0x9B, 0x24, 0xFF, 0x4D, 0x07, 0xB0, 0x6D, 0x6D, 0x9B, 0x24, 
+    0xFF, 0x4D, 0x00, 0xB0, 0x6D, 0x6D, 0x9B, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x13, 0xFF, 0x00, 0x49, 0x90, 0x24, 0xF9, 0x63, 0xDB, 
+    0xFF, 0x00, 0x30, 0x17, 0x73, 0x31, 0x66, 0x63, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x79, 0x00, 0x49, 0x92, 0x24, 0x6D, 0x0B, 0x00, 0x79, 0x00, 0x49, 0x92, 0x24, 0x6D, 0x0B, 0x00, 
+    0x79, 0x00, 0x51, 0x92, 0x24, 0x6D, 0x0B, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xB6, 0xD1, 0xC9, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0xF2, 0xC4, 0xFF, 0x00, 0x01, 0x14, 0x43, 0x71, 0x64, 0x5B, 
+    0xAB, 0x01, 0xD8, 0xA6, 0xDA, 0x6A, 0xA2, 0xB6, 0x4D, 0x00, 0x78, 0xB2, 0x27, 0x79, 0xA2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB2, 0x00, 0xEF, 0x90, 0x53, 0x89, 0x99, 0xBC, 0xD1, 0x5A, 0x72, 0x2A, 0x7A, 0x14, 0xE5, 0x81, 0xC5, 0x00, 0x10, 0x2D, 0xFA, 0xEB, 0x43, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x75, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9A, 0xE4, 0xC4, 0x43, 0x52, 0x43, 0xCC, 0x9E, 0x7A, 0x62, 
+    0xC8, 0x35, 0x26, 0x58, 0xA9, 0x03, 0xAF, 0x35, 0x5C, 0x00, 0x68, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x38, 0x80, 0x08, 0xB1, 0x58, 0x3F, 0x3A, 0x74, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
+    0xCD, 0x3F, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0x4F, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC8, 0x83, 0x24, 0x48, 0x82, 0x24, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x7F, 0x00, 0x49, 0x9A, 0x9C, 0x89, 0x95, 0x13, 0xB8, 0x12, 0xC4, 0x3A, 0xD0, 0x1A, 0xDF, 0x35, 0xFF, 0x00, 0x87, 0x18, 0x69, 0x21, 0x69, 0xDB, 
+    0x90, 0x00, 0x73, 0xA2, 0x26, 0xA0, 0x43, 0x36, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xE3, 0x00, 0x31, 0x96, 0x24, 0x49, 0x92, 0x24, 0x71, 0x00, 0x68, 0x92, 0x24, 0x49, 0x9E, 0xC4, 
+    0xCB, 0x1D, 0x31, 0x77, 0x4A, 0x1E, 0xE6, 0x81, 0xB5, 0x00, 0x00, 0xA4, 0x91, 0xB5, 0xDD, 0x24, 0xF0, 0x1D, 0x24, 0x67, 0x6F, 0x09, 0x86, 0x61, 0x65, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xFF, 0x30, 0x88, 0x89, 0x98, 0x88, 0x89, 0x58, 0xFF, 0x29, 0x74, 0x40, 0x67, 0x34, 0x4B, 0xFA, 0xFF, 0x34, 0x00, 0x40, 0x4E, 0x76, 0x99, 0xDC, 0xFF, 0x9A, 0x00, 0x20, 0x00, 0x15, 0x10, 0x02, 
+    0xFF, 0x00, 0x40, 0x02, 0xE4, 0x40, 0x0A, 0x64, 0xB3, 0x0D, 0xA1, 0x70, 0xFE, 0x24, 0x09, 0x00, 0xAE, 0x0D, 0x74, 0x32, 0xFF, 0x24, 0x09, 0x00, 0xAE, 0x0D, 0x49, 0xF2, 0xFF, 0x24, 0x09, 0x00, 
+    0xAE, 0x0D, 0x49, 0xF2, 0xFF, 0x24, 0x09, 0x00, 0x41, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x04, 0xC4, 0x0F, 0x71, 0xE9, 0x4E, 0x1D, 0x44, 0x89, 0xC5, 0x34, 0xDC, 0x08, 0x09, 0x6C, 0xF9, 0xE4, 
+    0xC7, 0x4F, 0x0E, 0xB1, 0x06, 0x9C, 0x71, 0x12, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xAE, 0x00, 0x00, 0xC1, 0x93, 0xB6, 0x9D, 0x24, 0xB1, 0x00, 0x00, 0x00, 0x92, 0xB6, 0x9D, 0x24, 
+    0xAC, 0x00, 0x00, 0x40, 0x92, 0xB6, 0x9D, 0x48, 0xAC, 0x59, 0x80, 0x62, 0xDB, 0x49, 0xB2, 0x6D, 0x98, 0x00, 0x4F, 0xFA, 0xA4, 0x4C, 0x8A, 0xA4, 0xC9, 0x40, 0x6D, 0x41, 0x10, 0x3D, 0x9B, 0x13, 
+    0xC0, 0x40, 0x3C, 0x09, 0x80, 0x24, 0xC9, 0x27, 0x48, 0x00, 0x78, 0x82, 0x27, 0x78, 0xA2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC4, 0x00, 0xC9, 0x9B, 0x97, 0x31, 0xF5, 0x0E, 0xC6, 0x4E, 0x84, 0x24, 0x11, 0xA0, 0x37, 0xA7, 0xC2, 0x00, 0xEC, 0x23, 0x3A, 0x58, 0x0F, 0xB1, 
+    0x12, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xD4, 0x00, 0xEE, 0x10, 0x53, 0x31, 0x15, 0x53, 
+    0xBC, 0x00, 0x58, 0x2F, 0x3A, 0xE2, 0x23, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x25, 0x31, 0x10, 0x03, 0x31, 0x11, 0x13, 
+    0xFF, 0x72, 0x00, 0x04, 0x88, 0x00, 0x8D, 0x35, 0xAE, 0x00, 0x58, 0xAF, 0x3E, 0x74, 0xD2, 0x24, 0xFF, 0x00, 0x49, 0x92, 0xA4, 0x11, 0x0B, 0xB1, 0xFF, 0x00, 0x49, 0xF0, 0x04, 0x4F, 0xF0, 0x04, 
+    0xCD, 0x3F, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x97, 0x00, 0x31, 0x91, 0x24, 0x49, 0x92, 0x24, 0xD2, 0x00, 0xA0, 0x93, 0x24, 0x49, 0x92, 0x24, 0x11, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x11, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x13, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 
+    0xCD, 0x00, 0x1D, 0x66, 0x4A, 0x2F, 0x97, 0xBB, 0xD4, 0x44, 0x4F, 0xC2, 0x16, 0xDB, 0x68, 0xFB, 0xD6, 0x46, 0xE0, 0xB6, 0x6E, 0x3D, 0x97, 0xFF, 0x65, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xFF, 0x30, 0x88, 0x81, 0x18, 0x88, 0x85, 0x58, 0xC1, 0x00, 0x58, 0x2F, 0x3A, 0xA2, 0x23, 0x3A, 0x42, 0x00, 0x89, 0x91, 0x84, 0x49, 0x9A, 0x84, 0xFF, 0x5E, 0xA7, 0x90, 0x0A, 0xA9, 0x9E, 0xEA, 
+    0xFF, 0x00, 0x40, 0x00, 0x04, 0x40, 0x60, 0x04, 0xFF, 0xED, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x72, 0x92, 0x04, 0x00, 0x00, 0x0A, 0x20, 0xFF, 0x72, 0x92, 0x64, 0x00, 0x05, 0x10, 0x00, 
+    0xFF, 0xED, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xC9, 0x95, 0x18, 0x49, 0x91, 0x18, 0xCC, 0x37, 0x04, 0x3F, 0x35, 0x53, 0x33, 0x35, 0x21, 0x00, 0x48, 0x9C, 0x24, 0x49, 0x92, 0x24, 
+    0xC7, 0x13, 0xA7, 0x90, 0x0E, 0xF1, 0x90, 0x0E, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xB1, 0x14, 0x00, 0x03, 0x80, 0x02, 0xFF, 0x7E, 0xDB, 0x06, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x4A, 0x82, 0x24, 0x48, 0x82, 0x24, 0xCF, 0x10, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0x74, 0x02, 0x27, 0x74, 0x42, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x83, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x97, 0x13, 0xC8, 0x44, 0xA9, 0xE4, 0x81, 0xC4, 0x2C, 0x35, 0x7B, 0x00, 0x60, 0x35, 0x9F, 0x4D, 0xFE, 0x24, 0xCC, 0x2A, 0xC3, 0xDA, 0x81, 0xA6, 0x14, 0x0F, 
+    0xA1, 0x00, 0x4E, 0x42, 0x27, 0xEB, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xA2, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x25, 0x31, 0x11, 0x13, 0x31, 0x15, 0x53, 
+    0xE8, 0x00, 0x18, 0x2D, 0xF6, 0xAB, 0x49, 0x3F, 0xFF, 0x00, 0x4F, 0xF2, 0xFF, 0x6D, 0x9B, 0x00, 0xFF, 0x35, 0x10, 0x9D, 0xC4, 0xB6, 0x0D, 0xD1, 0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0xF0, 0x04, 
+    0xCD, 0x3F, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 0x61, 0x00, 0x7A, 0xA2, 0x27, 0x7A, 0xA2, 0x07, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x4F, 0xF0, 0x44, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0xA2, 0x24, 0x84, 0x00, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x24, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x80, 0x96, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x00, 0xAF, 0x9E, 0x0A, 0x49, 0x92, 0x24, 0x65, 0x00, 0x6E, 0x82, 0x26, 0x49, 0x92, 0x24, 
+    0xFF, 0x30, 0x88, 0x81, 0x58, 0x88, 0xA9, 0x98, 0xCF, 0x08, 0xA2, 0x83, 0xD5, 0xEA, 0xB8, 0x42, 0xBC, 0x00, 0x49, 0xFC, 0xBB, 0x2D, 0x27, 0x09, 0xFF, 0x70, 0xA9, 0x70, 0x02, 0x15, 0x30, 0x00, 
+    0xFF, 0x00, 0x40, 0x00, 0x04, 0x40, 0x02, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0x5B, 0x00, 0x89, 0x91, 0x5C, 0x49, 0x98, 0xC4, 0xC8, 0x4B, 0x44, 0x53, 0xCC, 0x1E, 0x98, 0x0E, 0xAB, 0x00, 0x4F, 0xE2, 0xDF, 0x23, 0x09, 0x09, 
+    0xC7, 0x2B, 0xE9, 0x60, 0x0A, 0xD4, 0x20, 0x12, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x04, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x38, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0xCF, 0x10, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x0A, 0x74, 0x40, 0x07, 0x74, 0x40, 0x47, 0xFF, 0x00, 0x48, 0x02, 0x24, 0x40, 0x22, 0x25, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xCB, 0x00, 0x31, 0xE5, 0x0E, 0xDD, 0x9F, 0x24, 0xBE, 0x00, 0x58, 0x4F, 0x3A, 0x7C, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA2, 0x00, 0xE9, 0x90, 0x77, 0x89, 0x9F, 0x24, 
+    0xC5, 0x00, 0x58, 0x5F, 0xAD, 0xFB, 0x99, 0x24, 0x39, 0x00, 0x49, 0xD2, 0x24, 0x48, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xF1, 0x10, 0x93, 0xF1, 0x9F, 0x24, 
+    0xA2, 0x00, 0xE0, 0x43, 0x3E, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA4, 0x00, 0x26, 0x60, 0x92, 0xFE, 0x9F, 0x24, 
+    0x60, 0x00, 0x72, 0x02, 0x00, 0xB6, 0x9D, 0x24, 0xFF, 0x00, 0x09, 0xD0, 0xB4, 0xFF, 0x9F, 0x24, 0xFF, 0x00, 0x10, 0xDB, 0xB6, 0xFF, 0x9B, 0x24, 0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0x90, 0x44, 
+    0xCD, 0x3F, 0x29, 0x98, 0x8A, 0xA9, 0x98, 0x82, 0xDA, 0x0E, 0xCE, 0xEA, 0xFF, 0x6D, 0x3B, 0xAC, 0x9F, 0x00, 0x4F, 0xF0, 0x84, 0x4F, 0xFE, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x48, 0xC2, 0xFC, 0x0F, 0x99, 0x80, 0x9E, 0x00, 0x49, 0xF5, 0x57, 0x24, 0x05, 0x00, 
+    0xC4, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0xF0, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0xFF, 0x00, 0xEC, 0x55, 0x1F, 0xFF, 0x93, 0x24, 0xFF, 0x00, 0x92, 0x80, 0x02, 0x38, 0x10, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x97, 0x00, 0xA6, 0x90, 0x97, 0x49, 0x9E, 0x24, 0xB3, 0x00, 0x00, 0xC4, 0x91, 0xB6, 0x9D, 0x24, 
+    0xC4, 0x00, 0xEB, 0x50, 0xAF, 0xF7, 0x11, 0x53, 0x87, 0x00, 0x60, 0x32, 0x26, 0x66, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0xA7, 0x70, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x6A, 0xC0, 0x86, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x42, 0x26, 0x7F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9A, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 
+    0x9A, 0x00, 0x15, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9A, 0x00, 0x00, 0x48, 0x92, 0xFF, 0x9F, 0x24, 0x21, 0x00, 0x48, 0x82, 0x24, 0x4A, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9A, 0x00, 0x09, 0x98, 0x90, 0xC9, 0x9F, 0x24, 0x9A, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9A, 0x00, 0x50, 0x43, 0x36, 0xFF, 0x9F, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x1C, 0xBF, 0x00, 0x49, 0x9E, 0xBB, 0xEE, 0xC6, 0x01, 0xB7, 0x00, 0xFF, 0xD3, 0xD6, 0xD2, 0x08, 0x40, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDD, 0xB6, 0x62, 
+    0x44, 0x00, 0x49, 0x82, 0x24, 0x48, 0x82, 0x24, 0xB0, 0x16, 0x4F, 0xF2, 0xB6, 0x27, 0x70, 0x02, 0x69, 0x00, 0x6F, 0xA2, 0x26, 0x68, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x86, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBF, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x85, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBE, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0xD5, 0x00, 0xC9, 0x9F, 0xB4, 0xC9, 0x9E, 0xE0, 0xAD, 0x16, 0x49, 0xD2, 0xB6, 0x94, 0x48, 0x80, 
+    0x2D, 0x00, 0x4D, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x16, 0x4F, 0xF2, 0xB6, 0x27, 0x70, 0x02, 
+    0x6C, 0x00, 0x6F, 0xA2, 0x26, 0x68, 0x82, 0x26, 0xB0, 0x00, 0x71, 0x12, 0xB7, 0x31, 0x17, 0x13, 0xB7, 0x00, 0x4B, 0xEE, 0xBA, 0x2B, 0xA7, 0x09, 0xC1, 0x00, 0x7F, 0xD2, 0xD6, 0xDB, 0x08, 0x40, 
+    0xFF, 0x00, 0x49, 0x90, 0x00, 0x3E, 0x50, 0x6B, 0xFF, 0x16, 0x09, 0x60, 0x03, 0x00, 0xB0, 0x09, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x70, 0x00, 0x49, 0x93, 0x94, 0x49, 0x91, 0x14, 
+    0xB0, 0x00, 0x59, 0xD2, 0xD6, 0x1B, 0x09, 0x51, 0xC9, 0x09, 0xC9, 0xE3, 0xB6, 0xDC, 0x06, 0x09, 0xB9, 0x00, 0x49, 0x52, 0x27, 0xA3, 0x03, 0xD1, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x10, 0xC2, 0x00, 0x49, 0x7E, 0xB7, 0xE5, 0x36, 0x01, 0xBF, 0x00, 0x7F, 0xD2, 0xD6, 0xDA, 0x08, 0x40, 0x82, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x82, 0x39, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB0, 0x01, 0x89, 0xD2, 0xB6, 0xDC, 0x48, 0x88, 0xB9, 0x00, 0xC9, 0xEF, 0xB6, 0xDC, 0x24, 0x00, 0xC2, 0x00, 0x4F, 0xD2, 0xFA, 0x1B, 0x0B, 0x68, 
+    0x4F, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x26, 0x09, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xB8, 0x00, 0x49, 0x92, 0xD8, 0x37, 0x67, 0x0A, 0xC6, 0x0C, 0x49, 0xD2, 0xD6, 0xDB, 0x06, 0x09, 
+    0xC0, 0x00, 0x49, 0x62, 0xDB, 0xEC, 0x26, 0x16, 0x87, 0x00, 0x49, 0xD2, 0x26, 0x60, 0x02, 0x26, 0xB0, 0x00, 0x49, 0x12, 0xB7, 0x31, 0x17, 0x13, 0xC5, 0x00, 0x49, 0x62, 0xBB, 0x1B, 0x67, 0x0A, 
+    0xC5, 0x00, 0x7F, 0xD2, 0xDA, 0xDB, 0x8E, 0xF5, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xB9, 0x00, 0x49, 0x1E, 0xB7, 0xE6, 0x46, 0x41, 0xBA, 0x00, 0x7F, 0xD2, 0xD6, 0xD2, 0x28, 0x41, 
+    0x7A, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x02, 0x3E, 0x06, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x24, 0xB1, 0x00, 0x49, 0x62, 0xDB, 0xE6, 0x66, 0x02, 0x7B, 0x00, 0x49, 0xD2, 0xB6, 0x2A, 0xA2, 0x26, 
+    0x7B, 0x00, 0x49, 0xDA, 0xA4, 0x48, 0x9A, 0xA4, 0xBA, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x38, 0x88, 0x1F, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xC4, 0xC6, 0x01, 0x49, 0x62, 0xDB, 0xDE, 0xE6, 0x61, 
+    0x51, 0x00, 0x79, 0xA2, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x89, 0x99, 0x54, 0x39, 0x95, 0x13, 0xC8, 0x00, 0x83, 0x26, 0xB1, 0x58, 0x0F, 0x3A, 0x95, 0x00, 0x9B, 0x60, 0x77, 0x49, 0x9A, 0xC4, 0xC4, 0x5F, 0x3B, 0xDA, 0xA2, 0x1F, 0x1A, 0xA2, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xB0, 0x30, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 0x69, 0x00, 0x68, 0x82, 0x26, 0xE8, 0x8F, 0x4E, 0x58, 0x00, 0x49, 0x92, 0x24, 0xF6, 0x03, 0xAC, 
+    0x09, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x83, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9C, 0xB6, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xDB, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x82, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9C, 0x54, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xD3, 0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xE0, 0xEC, 0x6C, 0x01, 0x13, 0x30, 0x01, 0x13, 0x30, 
+    0x41, 0x00, 0x4B, 0xB2, 0x24, 0x4B, 0xB2, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0xAD, 0x2D, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xC4, 0x00, 0xD2, 0x88, 0xD5, 0xA2, 0x23, 0x3E, 0xC6, 0x00, 0x9C, 0xE0, 0x0E, 0x31, 0x95, 0x53, 
+    0xBA, 0x00, 0xAB, 0x26, 0xD1, 0x98, 0x03, 0x3A, 0xD0, 0x00, 0xE4, 0x60, 0x53, 0x79, 0x97, 0x77, 0xFF, 0x3E, 0x00, 0x20, 0x00, 0x72, 0x30, 0x07, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 
+    0xD1, 0x2E, 0x1A, 0x27, 0xAC, 0x52, 0xAF, 0x35, 0x90, 0x00, 0x92, 0xD0, 0x76, 0x4F, 0x9A, 0xC4, 0xCB, 0x4A, 0x52, 0x43, 0xF0, 0xD5, 0x6C, 0xCD, 0x28, 0x00, 0x4D, 0xB2, 0x24, 0x48, 0x82, 0x24, 
+    0xCA, 0x00, 0x79, 0x17, 0x53, 0xEF, 0xF0, 0x0E, 0xB7, 0x00, 0xC0, 0x86, 0xD5, 0xEA, 0x33, 0x27, 0xB4, 0x00, 0x9C, 0x60, 0x73, 0x89, 0x99, 0xA4, 0xC3, 0x18, 0xA2, 0x03, 0xF1, 0xC3, 0x4C, 0xAC, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x4E, 0xC0, 0x04, 0xC2, 0x70, 0x19, 0x9B, 0x6D, 0x19, 0x9C, 0x29, 0xA6, 0x00, 0xD0, 0xB6, 0xDA, 0x7D, 0xE2, 0x24, 0xCC, 0x00, 0x1C, 0x64, 0x0E, 0x37, 0x95, 0x53, 
+    0xB6, 0x00, 0x73, 0xA2, 0x3E, 0xA0, 0x83, 0x39, 0x60, 0x00, 0x49, 0x9A, 0x7C, 0x89, 0x95, 0x18, 0xCC, 0x40, 0x26, 0x56, 0xA9, 0x04, 0x3F, 0x35, 0x8B, 0x00, 0x90, 0xC4, 0xB6, 0x4E, 0x9E, 0x24, 
+    0xC7, 0x1E, 0x53, 0xD1, 0x11, 0xAF, 0x90, 0x0E, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xBB, 0x00, 0x95, 0x46, 0xB1, 0x58, 0x2F, 0x3A, 
+    0x85, 0x00, 0xC0, 0x4E, 0x92, 0x49, 0x92, 0x24, 0x5B, 0x00, 0xC9, 0x95, 0x18, 0x89, 0x91, 0x5C, 0xC2, 0x38, 0xC4, 0x3A, 0x35, 0x03, 0x4F, 0x88, 0xB8, 0x20, 0xED, 0x90, 0x57, 0x7F, 0xC5, 0xD6, 
+    0xB2, 0x00, 0xA2, 0x83, 0x39, 0xA4, 0xE3, 0x39, 0x85, 0x00, 0x49, 0x92, 0xB4, 0x09, 0x91, 0x10, 0xC5, 0x28, 0xA9, 0xF4, 0x4A, 0xA8, 0x08, 0x40, 0xC0, 0x01, 0x74, 0x42, 0xDB, 0xDB, 0x0A, 0xAC, 
+    0x3A, 0x00, 0x49, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xBA, 0x5F, 0xC6, 0x62, 0x2C, 0xC6, 0x62, 0x2C, 0x1F, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xC4, 0xC6, 0x47, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA3, 0x00, 0x31, 0x91, 0x13, 0x39, 0x95, 0x74, 0xCC, 0x00, 0xA2, 0x23, 0x3A, 0x58, 0x2F, 0xB1, 0x6D, 0x00, 0x49, 0x9C, 0xC4, 0xC9, 0x49, 0x0E, 0xC4, 0x5A, 0x21, 0xFA, 0xA1, 0x16, 0x4A, 0xA2, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xD0, 0x30, 0xA9, 0x96, 0x6A, 0xA9, 0x96, 0x0A, 0xBD, 0x35, 0x2D, 0xD7, 0x01, 0x1B, 0xBB, 0x3E, 0xCB, 0x3B, 0x64, 0x2D, 0x88, 0xA5, 0x14, 0x13, 
+    0x9A, 0x00, 0x4D, 0x32, 0x27, 0xEA, 0x03, 0x3E, 0xFF, 0x00, 0xE1, 0x9B, 0xBD, 0xC1, 0x1B, 0xBC, 0xB0, 0x29, 0x5B, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x4C, 0xB2, 0x24, 0x48, 0x82, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x5B, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xE0, 0xEC, 0x6C, 0x01, 0x13, 0x30, 0x01, 0x13, 0x30, 
+    0xFF, 0x00, 0x0F, 0xF9, 0x6C, 0x0F, 0xF4, 0x60, 0xC0, 0x07, 0xDB, 0x06, 0xAC, 0x58, 0xBD, 0x3A, 0x5D, 0x00, 0x60, 0xC2, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x2D, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 
+    0xB3, 0x00, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x97, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 0xFF, 0x3E, 0x73, 0x30, 0x07, 0x73, 0x30, 0x07, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 
+    0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x31, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB1, 0x68, 0x87, 0x72, 0x28, 0x87, 0x72, 0x28, 0x28, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xC5, 0x0A, 0xAF, 0xF4, 0x0A, 0xEF, 0x10, 0x0F, 0xA3, 0x00, 0x73, 0xB2, 0x26, 0xEA, 0x83, 0xF5, 0x73, 0x00, 0x49, 0x98, 0x84, 0x89, 0x77, 0x13, 0xCB, 0x3F, 0xD5, 0x5E, 0xED, 0x04, 0x3F, 0x35, 
+    0x30, 0x00, 0x4C, 0xC0, 0x04, 0x4D, 0x90, 0x04, 0xCE, 0x6B, 0xD9, 0x92, 0x2D, 0x99, 0x9E, 0xA1, 0x61, 0x00, 0x4D, 0xD2, 0x24, 0x7B, 0x02, 0xDA, 0xC2, 0x00, 0x79, 0x95, 0x53, 0x31, 0xE5, 0x0E, 
+    0xBB, 0x00, 0x98, 0x83, 0x39, 0xA0, 0x23, 0x3E, 0x65, 0x00, 0x49, 0x91, 0x18, 0x89, 0x95, 0x7C, 0xC3, 0x37, 0x53, 0x33, 0x35, 0x03, 0x4F, 0xAC, 0x3A, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x76, 
+    0xC7, 0x13, 0xF1, 0x90, 0x0E, 0xAF, 0x60, 0x0A, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x72, 0x00, 0x49, 0x9A, 0x14, 0x49, 0x91, 0x14, 0xB8, 0x22, 0x9D, 0x70, 0x97, 0x76, 0xBF, 0x35, 0xBE, 0x0C, 0x90, 0xB6, 0x09, 0x2E, 0x95, 0x77, 
+    0xC2, 0x00, 0x74, 0x32, 0x3A, 0xA0, 0x83, 0x39, 0x80, 0x00, 0x09, 0x91, 0x90, 0x49, 0x92, 0x24, 0xF1, 0x28, 0x6D, 0x77, 0x73, 0x31, 0x17, 0x63, 0x80, 0x00, 0x02, 0x28, 0x92, 0x6A, 0xA2, 0x86, 
+    0x3A, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x44, 0xBA, 0x5F, 0xC6, 0x62, 0x2C, 0xC6, 0x62, 0xC9, 0x3C, 0x00, 0x4C, 0xCE, 0xE4, 0x4C, 0x8C, 0x56, 0xD1, 0x47, 0xA9, 0x98, 0x82, 0x21, 0xE8, 0x81, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9C, 0x00, 0x89, 0x99, 0xC4, 0xF1, 0x9C, 0x13, 0xC1, 0x32, 0x84, 0x66, 0x0A, 0x71, 0x09, 0xFE, 0xBE, 0x29, 0x24, 0x05, 0x60, 0x23, 0xEB, 0x3F, 0xC4, 0x54, 0x23, 0x6A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x44, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xB8, 0x30, 0x29, 0x90, 0x42, 0x29, 0x94, 0x42, 0x7C, 0x00, 0xE0, 0xA3, 0x26, 0x72, 0x22, 0x27, 0xB9, 0x00, 0xF1, 0x10, 0x13, 0x31, 0x11, 0x13, 
+    0xA8, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0xFF, 0x00, 0xC1, 0x1B, 0xBC, 0xC1, 0x1B, 0xBC, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xE0, 0xEC, 0x6C, 0x01, 0x13, 0x32, 0x21, 0x13, 0x30, 
+    0xEF, 0x2D, 0xC1, 0x98, 0xD1, 0xE6, 0xFE, 0x0E, 0x65, 0x00, 0xE0, 0xC3, 0x27, 0x4F, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x24, 0xAD, 0x2D, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x93, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x93, 
+    0xB3, 0x00, 0x98, 0x83, 0x39, 0x98, 0x43, 0x3A, 0x97, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x93, 0xFF, 0x3E, 0x73, 0x20, 0x47, 0x74, 0xF8, 0xFF, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x54, 
+    0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0xD3, 0x36, 0x31, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB1, 0x60, 0x87, 0x7E, 0xE8, 0x87, 0x9E, 0x24, 0x28, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x9A, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xC7, 0x33, 0x58, 0x3D, 0x68, 0xE5, 0x94, 0xBB, 0xBE, 0x4C, 0x7F, 0xB7, 0x09, 0xD2, 0x68, 0x3F, 0xC6, 0x00, 0x58, 0x3F, 0x3A, 0xF4, 0xE3, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB0, 0x24, 0x44, 0x45, 0x78, 0x04, 0x4C, 0x20, 0xB5, 0x46, 0xF3, 0x0F, 0x6D, 0x1D, 0x10, 0xB7, 0xBB, 0x2E, 0xA5, 0x20, 0x60, 0x10, 0xDB, 0x3A, 
+    0x82, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0x92, 0x24, 0x34, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 0xC7, 0x00, 0x14, 0x56, 0x0A, 0x2F, 0x97, 0xBB, 0xB4, 0x56, 0x4E, 0xAE, 0x4D, 0x02, 0x64, 0xFB, 
+    0xC7, 0x50, 0x1D, 0x21, 0x12, 0x3D, 0x91, 0x10, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x93, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x69, 0x00, 0x49, 0x91, 0x78, 0x49, 0x9A, 0x24, 0xB7, 0x2B, 0x02, 0x3D, 0x68, 0xA5, 0x10, 0xB7, 0xBF, 0x45, 0x89, 0x47, 0x0E, 0xD2, 0x58, 0xFB, 
+    0xB5, 0x00, 0x98, 0x23, 0x3A, 0x74, 0xE2, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x04, 0x01, 0x10, 0x00, 0xF1, 0x28, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 0x71, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x28, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 0xCA, 0x00, 0x14, 0xD6, 0x09, 0xEF, 0x94, 0x97, 0xB2, 0x56, 0x4E, 0xAE, 0x4D, 0x80, 0x68, 0x3F, 0xD1, 0x39, 0x24, 0xB8, 0x8A, 0xAE, 0x98, 0xDA, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x90, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 0xC7, 0x18, 0x98, 0x23, 0xD1, 0x83, 0xD8, 0x09, 0xC3, 0x02, 0x49, 0x6C, 0xBB, 0x24, 0x27, 0x01, 0xBE, 0x23, 0x15, 0x38, 0xAC, 0x10, 0x2D, 0x3A, 
+    0x37, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0xB0, 0x30, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 0x69, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB1, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 
+    0xA8, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0xFF, 0x00, 0xC1, 0x1B, 0xBC, 0xC1, 0x1B, 0xBD, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0xA2, 0x24, 
+    0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xE8, 0xEC, 0x6C, 0x01, 0x13, 0x30, 0x01, 0x13, 0x32, 
+    0xC9, 0x00, 0xEF, 0x60, 0x53, 0x7E, 0xE7, 0xB8, 0xFF, 0x99, 0x00, 0x30, 0x00, 0x16, 0x10, 0x6E, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x22, 0x25, 0xAD, 0x2D, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x30, 0x00, 0xC1, 0x96, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x12, 0x92, 0x24, 0x49, 0x92, 0x24, 0x24, 0x00, 0x81, 0x94, 0x24, 0x49, 0x92, 0x24, 
+    0x34, 0x00, 0x24, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x19, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0x09, 0x96, 0x24, 0x49, 0x92, 0x24, 
+    0x29, 0x00, 0x92, 0x90, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x28, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0xA9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xD0, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xF0, 0x69, 0x61, 0x13, 0x22, 0x21, 0x12, 0x36, 0xFF, 0x00, 0xF9, 0xFF, 0x24, 0x47, 0xF2, 0x2D, 0x32, 0x00, 0x50, 0x93, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x21, 0x00, 0x89, 0x91, 0x24, 0x49, 0x92, 0x24, 0x35, 0x00, 0x02, 0x96, 0x24, 0x49, 0x92, 0x24, 
+    0xC7, 0x11, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0x87, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0x30, 0x00, 0xC1, 0x96, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x12, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0xE9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xC0, 0x9A, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x49, 0x21, 0x99, 0xB6, 0xF1, 0x28, 0x31, 0x16, 0x73, 0x31, 0x69, 0xDB, 0x71, 0x00, 0x68, 0x82, 0x26, 0x68, 0xA2, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x27, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x80, 0x98, 0x24, 0x49, 0x92, 0x24, 0xAA, 0x00, 0x3E, 0x7E, 0x42, 0x49, 0x92, 0x24, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x10, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x8E, 0x00, 0x9D, 0x10, 0x97, 0x49, 0x9E, 0x24, 0x9B, 0x00, 0x00, 0x44, 0xB2, 0xFF, 0x9F, 0x24, 0x6F, 0x00, 0x98, 0x53, 0x27, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9E, 0x00, 0x1E, 0x60, 0x92, 0xFE, 0x9F, 0x24, 0x69, 0x00, 0x68, 0xA2, 0x26, 0x6E, 0x92, 0x24, 0xB1, 0x00, 0x31, 0x11, 0x93, 0xF1, 0x9F, 0x24, 
+    0xA8, 0x00, 0xA0, 0x43, 0x3A, 0xBF, 0x93, 0x24, 0x9F, 0x00, 0x81, 0x17, 0x92, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0xC0, 0x4C, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x48, 0xC2, 0x24, 0x8F, 0x9F, 0x8C, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x4F, 0xC1, 0x16, 0xB4, 0x28, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0x9F, 0x00, 0x09, 0x9C, 0x90, 0xC9, 0x9F, 0x24, 0x9F, 0x00, 0x03, 0x46, 0x92, 0xFF, 0x9F, 0x24, 
+    0x41, 0x00, 0xCB, 0xB1, 0xA4, 0x4D, 0x92, 0x24, 0x9F, 0x00, 0x03, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x42, 0x26, 0x7F, 0x92, 0x24, 0xAD, 0x00, 0x26, 0x60, 0x92, 0xFE, 0x9F, 0x24, 
+    0x6C, 0x00, 0x68, 0xA2, 0x26, 0x6E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x30, 0x00, 0x49, 0x90, 0x04, 0x49, 0x9E, 0x24, 0x86, 0x00, 0x02, 0x44, 0x92, 0x49, 0x92, 0x24, 0x86, 0x00, 0x06, 0x40, 0x92, 0x49, 0x92, 0x24, 0x47, 0x00, 0x49, 0x82, 0x24, 0x7F, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x90, 0x00, 0x27, 0xF0, 0xB6, 0x4F, 0x92, 0x24, 0x87, 0x00, 0x60, 0x42, 0x26, 0x61, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB5, 0x00, 0x89, 0x94, 0x08, 0x09, 0x97, 0xD8, 
+    0xC7, 0x4C, 0xB5, 0x09, 0x09, 0x24, 0x99, 0x3F, 0xC8, 0x00, 0x58, 0x2F, 0x3A, 0xEC, 0xE3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -863,18 +1447,47 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x36, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x64, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0xA4, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x04, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x41, 0x00, 0x6E, 0x9D, 0x24, 0x49, 0x02, 0x24, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x01, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x83, 0x00, 0x49, 0x92, 0x24, 0x21, 0x92, 0xB6, 
+    0x9F, 0x00, 0x49, 0x92, 0x24, 0x88, 0xD3, 0x35, 0x0B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x83, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0xB4, 0x76, 0x00, 0x49, 0x92, 0x24, 0x68, 0x42, 0x27, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x42, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x71, 0x02, 0x27, 
+    0x0E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x48, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x3F, 0x01, 0x48, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x03, 0x20, 0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0xD7, 0x00, 0x49, 0x92, 0x24, 0xEF, 0xF0, 0xDA, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x02, 0x20, 
+    0x3B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x14, 0x56, 0x00, 0x49, 0x92, 0x24, 0xF7, 0x03, 0x68, 0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0xA4, 0x04, 0xA0, 0x00, 0x49, 0x92, 0x24, 0xC7, 0xCF, 0xB6, 
+    0x16, 0x00, 0x49, 0x92, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x81, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x24, 0xB9, 0x6D, 0x00, 0x00, 0x20, 0x95, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xFF, 0x81, 0x49, 0x62, 0x92, 0x15, 0x40, 0x00, 
+    0xFF, 0x00, 0x0C, 0xB9, 0x6C, 0x08, 0x80, 0x00, 0xFF, 0x81, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x4C, 0xBC, 0xDC, 0xC8, 0x9B, 0xB8, 0xF4, 0x6B, 0xFF, 0x6F, 0x92, 0x3D, 0xC1, 0x54, 
+    0xFF, 0x00, 0x4C, 0xBE, 0xC4, 0xC8, 0x8D, 0xBC, 0xFF, 0x6C, 0xF9, 0x7F, 0x92, 0x1E, 0x50, 0x01, 0xFF, 0x00, 0x64, 0xBE, 0x25, 0x40, 0x02, 0x24, 0xC0, 0x00, 0xDD, 0x66, 0x0A, 0x37, 0x95, 0x77, 
+    0xFF, 0x00, 0x24, 0xB3, 0x2D, 0x42, 0x3E, 0xDC, 0xFF, 0x1E, 0x71, 0xFB, 0x72, 0xA6, 0xD0, 0x01, 0xFF, 0x81, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0x9C, 
+    0xC3, 0x16, 0xA4, 0x23, 0xF5, 0x02, 0x3D, 0xAC, 0x63, 0x00, 0x49, 0x9C, 0x84, 0xC9, 0xE7, 0x14, 0xC5, 0x3E, 0x2E, 0x58, 0xC9, 0x04, 0x3F, 0x35, 0x48, 0x00, 0x78, 0xB2, 0x24, 0x4D, 0x92, 0x24, 
+    0xC0, 0x22, 0x29, 0x99, 0x0A, 0x29, 0x99, 0xFF, 0xC0, 0x40, 0x24, 0x09, 0x00, 0x24, 0x99, 0x24, 0xCE, 0x40, 0x6D, 0x2B, 0x81, 0xAD, 0x18, 0xD0, 0x4E, 0x00, 0x78, 0x82, 0x27, 0x78, 0xC2, 0x24, 
+    0x7C, 0x00, 0xC9, 0x9B, 0x58, 0x49, 0x91, 0x14, 0xBD, 0x32, 0x25, 0x39, 0x40, 0x58, 0x8B, 0x3D, 0xB2, 0x00, 0xDB, 0x42, 0x20, 0x24, 0x63, 0x3B, 0xFF, 0x15, 0x71, 0x1B, 0x6F, 0x31, 0x10, 0x03, 
+    0xFF, 0x00, 0x7D, 0xD3, 0x2F, 0x3D, 0xD2, 0x23, 0xB2, 0x18, 0xE9, 0x96, 0x0A, 0x29, 0x99, 0xDF, 0xFF, 0x47, 0x00, 0x30, 0x01, 0x1D, 0xE0, 0x21, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x12, 0x20, 
+    0xB4, 0x00, 0x79, 0x19, 0x53, 0xEF, 0x70, 0x4A, 0xB6, 0x2B, 0xDB, 0x08, 0x01, 0x2C, 0xD7, 0xBC, 0xBA, 0x17, 0x7D, 0x3E, 0xD6, 0xD0, 0x46, 0x01, 0xB2, 0x24, 0x95, 0x4C, 0xCC, 0x02, 0x8F, 0x35, 
+    0x16, 0x00, 0x48, 0xB2, 0x24, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0xFF, 0x00, 0x40, 0x82, 0x24, 0x49, 0x92, 0x24, 0xF4, 0x00, 0x71, 0x77, 0x53, 0xEF, 0x64, 0x0E, 0xFF, 0xE8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x20, 0xFF, 0x00, 0x00, 0x02, 0x24, 0x49, 0x92, 0x24, 0xC8, 0x00, 0x79, 0x97, 0x53, 0x31, 0xF5, 0x0E, 0xFF, 0x25, 0x33, 0xA5, 0x77, 0x78, 0x87, 0x98, 
+    0xFF, 0x05, 0x88, 0x8B, 0x9B, 0x78, 0x29, 0x77, 0xFF, 0xBB, 0x11, 0x60, 0x00, 0x04, 0x20, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x63, 0x00, 0x49, 0x91, 0x9C, 0x49, 0x9C, 0x24, 
+    0xCC, 0x2B, 0xC3, 0xDB, 0x69, 0xA6, 0x14, 0x8B, 0xFF, 0x00, 0x13, 0xA0, 0x27, 0xF4, 0xB3, 0x3A, 0xFF, 0x00, 0x00, 0x90, 0x00, 0x49, 0x92, 0x24, 0x36, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 
+    0xBE, 0x2D, 0x95, 0xEA, 0x81, 0x27, 0x96, 0x4A, 0xBB, 0x01, 0x8E, 0xD7, 0x77, 0x35, 0x45, 0x0F, 0xC3, 0x00, 0x10, 0x8F, 0xF5, 0xA2, 0xB3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF0, 0x12, 0xFF, 0x00, 0x49, 0x12, 0x40, 0x80, 0x06, 0x8C, 0xCF, 0x00, 0x18, 0x2D, 0xFA, 0xEC, 0xD3, 0x27, 0x0E, 0x00, 0x4C, 0x92, 0x24, 0x49, 0x12, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xBC, 0x0F, 0x58, 0x83, 0x35, 0x58, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x15, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
+    0xFF, 0x00, 0x3D, 0xD2, 0x23, 0x3D, 0xD2, 0x23, 0x46, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xFF, 0x47, 0x1E, 0xE2, 0x21, 0x1E, 0xE2, 0x01, 0xFF, 0x00, 0x01, 0x12, 0x3C, 0xE9, 0x93, 0x3E, 
+    0x9C, 0x00, 0xE7, 0x76, 0x1A, 0x27, 0x90, 0x24, 0x5D, 0x00, 0x70, 0x0A, 0x27, 0x70, 0x92, 0x24, 0x7A, 0x00, 0x14, 0x70, 0xB7, 0x49, 0x92, 0x24, 0x71, 0x00, 0x58, 0x53, 0x27, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -882,6 +1495,14 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x48, 0x02, 0x20, 0x00, 0x20, 0x49, 0xFF, 0x00, 0x49, 0x9E, 0xE4, 0x48, 0x2C, 0xC9, 0xFF, 0x59, 0xE9, 0xF0, 0x0A, 0x26, 0xE0, 0x49, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x48, 0x82, 0x00, 0x08, 0xA0, 0x48, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x22, 0x49, 0xF9, 0x23, 0x31, 0xF5, 0x0E, 0xEF, 0x20, 0x49, 0xFF, 0x00, 0x88, 0x89, 0xB8, 0xC8, 0xAB, 0xDC, 
+    0xE9, 0x50, 0x4B, 0xB5, 0x53, 0x3C, 0x51, 0x01, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x40, 0x00, 0x04, 0x40, 0x20, 0x45, 0xFF, 0x00, 0x48, 0x02, 0x00, 0x00, 0x20, 0x49, 
+    0xE2, 0x00, 0xD1, 0x8A, 0xD1, 0x62, 0xBF, 0x3A, 0xFF, 0x2C, 0xAB, 0xA3, 0xF5, 0x10, 0x2D, 0x8D, 0x64, 0x00, 0x49, 0xE2, 0x24, 0x7B, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC3, 0x00, 0xEF, 0x10, 0x53, 0x79, 0x95, 0x74, 0xC1, 0x59, 0x0D, 0x31, 0x6B, 0x2A, 0x8A, 0xC9, 0x7E, 0x00, 0x60, 0x22, 0x27, 0x7C, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x22, 0x31, 0x11, 0x13, 0x31, 0x15, 0x73, 0xF7, 0x12, 0x18, 0x2D, 0xF6, 0xAB, 0x53, 0x93, 0xCE, 0x00, 0x0E, 0x96, 0xFF, 0x6D, 0xBB, 0x6D, 0x4E, 0x00, 0x78, 0x82, 0x67, 0x78, 0x8C, 0xC7, 
+    0xC0, 0x00, 0x89, 0x67, 0x77, 0xE5, 0xD4, 0x61, 0xC2, 0x00, 0x58, 0x8F, 0x35, 0xA2, 0xC3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x15, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
+    0xFF, 0x00, 0x3D, 0xD2, 0x23, 0x3D, 0xD2, 0x23, 0x46, 0x00, 0xC9, 0x91, 0x04, 0x49, 0x96, 0xA4, 0xFF, 0x47, 0x1E, 0xE2, 0x41, 0xE6, 0x14, 0xB7, 0x9F, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -890,6 +1511,14 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x08, 0xC0, 0x90, 0xCF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x48, 0xCA, 0xC4, 0x7F, 0x9E, 0x24, 
+    0x9F, 0x00, 0x03, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x40, 0x86, 0x7F, 0x9E, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x78, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x9C, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x88, 0x00, 0xA0, 0xB3, 0xF5, 0xB6, 0x9D, 0x24, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 
+    0x7E, 0x00, 0x49, 0x95, 0x78, 0x89, 0xD5, 0x12, 0xD5, 0x19, 0xC3, 0x3A, 0xD1, 0x5B, 0x2F, 0x3A, 0x22, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xE1, 0x00, 0xEF, 0xF0, 0xB6, 0xFF, 0x9F, 0x24, 0x60, 0x00, 0x6A, 0x42, 0x00, 0xB6, 0x9D, 0x24, 0xFF, 0x00, 0x80, 0xD8, 0xB6, 0xFF, 0x9F, 0x24, 0x4E, 0x00, 0x78, 0x8C, 0x47, 0x78, 0x9E, 0x24, 
+    0xB5, 0x00, 0x9D, 0xD0, 0x72, 0x89, 0x97, 0x78, 0xC5, 0x00, 0xA2, 0x83, 0x35, 0x58, 0x8F, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x15, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
+    0xFF, 0x00, 0x3D, 0xD2, 0x23, 0x3D, 0xD2, 0x23, 0x57, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x65, 0x5C, 0xFF, 0x00, 0xB7, 0x9B, 0x44, 0x5C, 0xCC, 0xC1, 0x9F, 0x00, 0xE0, 0x83, 0x3E, 0xC8, 0x03, 0x3E, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -901,7 +1530,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB7, 0x00, 0xD9, 0x16, 0x78, 0xA1, 0x17, 0xBB, 
+    0xC0, 0x44, 0x2D, 0x05, 0x40, 0x1C, 0xFB, 0x3F, 0xAF, 0x00, 0x98, 0xA3, 0x3E, 0x74, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xBC, 0x0F, 0x58, 0x83, 0x35, 0x58, 0x83, 0xF5, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0xFF, 0x15, 0x31, 0x10, 0x03, 0x31, 0x10, 0x03, 
+    0xFF, 0x00, 0x3D, 0xD2, 0x23, 0x3D, 0xD2, 0x23, 0xD7, 0x06, 0x6F, 0xF0, 0x06, 0x6F, 0xF0, 0x1E, 0xFF, 0x47, 0x18, 0xE2, 0x21, 0x1E, 0xE0, 0x21, 0x9F, 0x00, 0xE0, 0x03, 0x3E, 0xE1, 0x13, 0x3E, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -913,7 +1546,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x09, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x17, 0x00, 0x82, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7B, 0x00, 0x49, 0x91, 0x54, 0xC9, 0x99, 0xC4, 0xBB, 0x3F, 0x98, 0x2D, 0x6C, 0xDD, 0x96, 0xDB, 0x9E, 0x00, 0x24, 0x03, 0x20, 0x00, 0x42, 0x32, 0xFF, 0x15, 0x31, 0x10, 0x03, 0xF1, 0x16, 0xB7, 
+    0xFF, 0x00, 0x3D, 0xD2, 0x23, 0xFD, 0xD2, 0x37, 0xD7, 0x18, 0x71, 0x11, 0x0F, 0xF1, 0x10, 0xDB, 0xFF, 0x46, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC1, 0x03, 0x20, 0x00, 0x02, 0x20, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -928,6 +1565,8 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x17, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2E, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x2E, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x86, 0x9D, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -936,17 +1575,650 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x74, 0xC0, 0x01, 0x49, 0x62, 0xFB, 0x1B, 0x0F, 0xF1, 0x4B, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x96, 0x1C, 0xC2, 0x00, 0x49, 0xE2, 0xFA, 0x1C, 0x3B, 0xA8, 
+    0xBA, 0x00, 0x49, 0xE2, 0xFA, 0xDC, 0x3A, 0x88, 0x2D, 0x00, 0x49, 0x92, 0x24, 0x4C, 0x82, 0x24, 0x15, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x24, 0xC0, 0x00, 0x49, 0x12, 0xDB, 0xEF, 0xF6, 0x0A, 
+    0xC0, 0x01, 0x49, 0x6E, 0xDB, 0xDB, 0x0D, 0xA4, 0xC0, 0x40, 0x1E, 0x6A, 0xA5, 0xE5, 0x4C, 0xEC, 0x3C, 0x00, 0x48, 0xA2, 0x24, 0x4C, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xAD, 0x21, 0x04, 0x9F, 0xE4, 0x6D, 0x4F, 0xF0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xAE, 0x00, 0x49, 0x92, 0xDC, 0x71, 0xF7, 0x0E, 0xBD, 0x09, 0x79, 0xD2, 0xD6, 0xD3, 0x06, 0x09, 0x9B, 0x00, 0x49, 0xE2, 0x27, 0xEB, 0x83, 0x35, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 
+    0xAE, 0x00, 0x49, 0xF2, 0xB6, 0xDD, 0x46, 0x61, 0x70, 0x00, 0x49, 0x42, 0x36, 0xE0, 0xB3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7C, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x99, 0x13, 
+    0xBB, 0x00, 0xC9, 0xEF, 0xB6, 0xDC, 0x26, 0x48, 0xBE, 0x00, 0x49, 0x52, 0x3F, 0x63, 0x0F, 0xD1, 0x0B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC2, 0x00, 0x49, 0x92, 0xBB, 0x31, 0x97, 0x0E, 0x9E, 0x00, 0x49, 0xD2, 0x27, 0xEB, 0x03, 0x3E, 0xC6, 0x00, 0x49, 0x92, 0xB6, 0xD9, 0x16, 0x00, 0xC6, 0x07, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x40, 
+    0x86, 0x00, 0x49, 0x42, 0xD2, 0x50, 0x23, 0x3E, 0xC6, 0x00, 0x49, 0x92, 0xB6, 0xD9, 0x16, 0x00, 0xC5, 0x00, 0x49, 0x52, 0x3F, 0xA3, 0x83, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3D, 0x00, 0x49, 0x9A, 0x24, 0x89, 0x93, 0x00, 0x9D, 0x00, 0xFF, 0x1F, 0x92, 0xA9, 0xE0, 0x0A, 0x96, 0x00, 0x7F, 0xC2, 0xC7, 0x7C, 0xCA, 0x83, 0x20, 0x00, 0x49, 0x92, 0x44, 0x4E, 0x84, 0x44, 
+    0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0xA1, 0x00, 0x49, 0x92, 0xFF, 0x29, 0x99, 0x0A, 0xA1, 0x00, 0x49, 0xF2, 0xFF, 0x24, 0xB9, 0x02, 0x61, 0x00, 0x49, 0x62, 0x3B, 0x48, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xE3, 0x24, 0xF1, 0x90, 0x0F, 0xE9, 0x10, 0x0F, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0xF2, 0x17, 0x4F, 0x72, 0xDB, 0xEF, 0xF0, 0x6E, 
+    0xF2, 0x17, 0x49, 0x62, 0xDB, 0x00, 0xB0, 0x6D, 0xBA, 0x00, 0xBF, 0xD3, 0x3A, 0x98, 0x83, 0x39, 0x64, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 0xB3, 0x00, 0x49, 0x62, 0xFB, 0x1C, 0x2D, 0x88, 
+    0xBE, 0x00, 0x49, 0x92, 0xC4, 0x4F, 0xE6, 0x04, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x0A, 0xD1, 
+    0x28, 0x00, 0x49, 0x82, 0x24, 0x4D, 0x92, 0x24, 0x7A, 0x00, 0x49, 0x92, 0xE4, 0x89, 0x19, 0x0F, 0xC2, 0x00, 0xC9, 0x6F, 0xB7, 0xDC, 0x26, 0x00, 0xC5, 0x00, 0x7F, 0xD2, 0xFA, 0x1B, 0x0B, 0x68, 
+    0x70, 0x00, 0x49, 0xF2, 0x24, 0x7C, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x07, 0x80, 0x09, 0x98, 0x80, 0x89, 0x98, 0xE8, 0x29, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x47, 0x00, 0xC9, 0x91, 0x44, 0x49, 0x96, 0x64, 0xC6, 0x46, 0xC4, 0x5E, 0xF0, 0x15, 0x63, 0x35, 
+    0xB9, 0x53, 0x85, 0x6C, 0xED, 0xD6, 0xFE, 0x31, 0x29, 0x00, 0x48, 0xA2, 0x24, 0x4B, 0xD2, 0x24, 0xB8, 0x00, 0x79, 0x12, 0x33, 0xF1, 0x90, 0x6E, 0xEE, 0x26, 0x31, 0x91, 0x0E, 0xEF, 0xDE, 0xAA, 
+    0xFF, 0x00, 0xC0, 0x9D, 0xBC, 0xB6, 0xDB, 0xB6, 0xC7, 0x37, 0x04, 0x3F, 0x35, 0x52, 0xA3, 0xB5, 0x77, 0x00, 0x4F, 0x92, 0x24, 0x6D, 0x03, 0x20, 0x64, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 
+    0xC5, 0x04, 0xB9, 0xEB, 0x72, 0x9C, 0x30, 0x68, 0xC2, 0x47, 0x95, 0x43, 0x91, 0x10, 0x50, 0x95, 0xB5, 0x00, 0x7E, 0xC2, 0x3A, 0x18, 0x0D, 0xAC, 0x1A, 0x00, 0x49, 0x9E, 0x64, 0x49, 0xB0, 0x04, 
+    0xB1, 0x3E, 0x21, 0xF4, 0xA1, 0x96, 0xEC, 0xA9, 0x87, 0x00, 0x9A, 0x50, 0x7B, 0x4E, 0xE8, 0x9C, 0xB9, 0x20, 0x58, 0x33, 0xF1, 0x03, 0x3F, 0xF0, 0xAC, 0x00, 0x89, 0x99, 0x77, 0xEF, 0x60, 0x0A, 
+    0xBB, 0x00, 0xC3, 0x0A, 0xD1, 0xA2, 0xB3, 0x3E, 0x22, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x00, 0x31, 0x15, 0x0F, 0xF1, 0x10, 0x53, 
+    0xB2, 0x04, 0x18, 0x29, 0xDA, 0xEA, 0x2F, 0x3A, 0xD7, 0x5E, 0x5D, 0x13, 0xEE, 0xE1, 0x1E, 0x30, 0x2E, 0x00, 0x4B, 0x82, 0x24, 0x48, 0xA2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC6, 0x00, 0xE9, 0x10, 0x0F, 0x31, 0x15, 0x53, 0x9B, 0x00, 0xE0, 0x03, 0x3E, 0xEA, 0xA3, 0x26, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x4F, 0xC0, 0x0A, 0xD1, 0x50, 0x8F, 0x39, 
+    0x5D, 0x00, 0x68, 0xB2, 0x27, 0x4D, 0xF2, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x43, 0xA2, 0x83, 0xF5, 0x10, 0x0D, 0xAC, 0x53, 0x00, 0x4F, 0xD2, 0x24, 0x4B, 0x02, 0x27, 
+    0xD4, 0x00, 0x79, 0x19, 0x53, 0x31, 0xF5, 0x0E, 0xDA, 0x33, 0x7E, 0x48, 0x9A, 0xA0, 0x19, 0x93, 0xC8, 0x1D, 0x8D, 0x6A, 0x88, 0x1B, 0x5B, 0x3F, 0x4F, 0x00, 0x4B, 0x0A, 0xA7, 0x60, 0xEA, 0xA4, 
+    0xDC, 0x00, 0x5D, 0xD2, 0x21, 0x1D, 0x52, 0xDB, 0xC4, 0x05, 0xF1, 0x10, 0x0F, 0xF1, 0xD0, 0x0E, 0xE1, 0x00, 0x34, 0x40, 0x27, 0x74, 0x62, 0xDB, 0x49, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0xC0, 
+    0x73, 0x00, 0x49, 0x90, 0x24, 0xC9, 0x9B, 0x7C, 0xFE, 0x24, 0x31, 0x15, 0x53, 0x37, 0x55, 0x0E, 0xFF, 0x00, 0x47, 0x02, 0x24, 0x40, 0x02, 0x24, 0x72, 0x00, 0x04, 0xD0, 0xB6, 0x49, 0x92, 0x24, 
+    0x72, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x72, 0x00, 0x00, 0xD3, 0x36, 0x49, 0x92, 0x24, 0x73, 0x00, 0x49, 0x91, 0x54, 0xC9, 0x99, 0xE4, 0xF2, 0x0E, 0xC3, 0xCA, 0xB1, 0x6D, 0xFD, 0x3F, 
+    0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xFE, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0x40, 0x00, 0x0A, 0x20, 0xD0, 0x00, 0x58, 0x2F, 0x3A, 0xEB, 0xB3, 0x3E, 
+    0x2B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x04, 0xC5, 0x16, 0x31, 0x75, 0x0A, 0x1E, 0x56, 0x81, 0xBE, 0x00, 0xD0, 0x38, 0xD6, 0x74, 0xE2, 0x24, 0xC8, 0x00, 0x9C, 0xE0, 0x72, 0xB9, 0x99, 0xBC, 
+    0xC9, 0x08, 0xA3, 0x83, 0xF5, 0x12, 0x3D, 0xAC, 0x1B, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x80, 0x89, 0x98, 0x88, 0x89, 0x98, 0xE7, 0x21, 0x58, 0x83, 0x39, 0x98, 0x83, 0x39, 0x28, 0x00, 0x49, 0x90, 0x44, 0x49, 0x98, 0x24, 0xA6, 0x00, 0xC4, 0xCA, 0xCD, 0xB6, 0x9D, 0x24, 
+    0x9A, 0x00, 0x84, 0xCA, 0xAD, 0xB6, 0x9D, 0x24, 0x0C, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 0xB7, 0x17, 0xE9, 0xF0, 0x4A, 0x6F, 0x9B, 0x24, 0xD9, 0x19, 0x1A, 0xB4, 0x69, 0xDE, 0x1A, 0xCC, 
+    0xB7, 0x19, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xC7, 0x19, 0x90, 0x84, 0x6D, 0x60, 0x2B, 0x3E, 0xB7, 0x00, 0x00, 0x22, 0x29, 0x6D, 0xF3, 0x3F, 0x9B, 0x00, 0x49, 0x95, 0x13, 0x39, 0x91, 0x13, 
+    0xCA, 0x3B, 0x5A, 0x0F, 0x3E, 0x68, 0x02, 0x3E, 0xAD, 0x2E, 0x44, 0x4D, 0x34, 0x44, 0x43, 0x34, 0xBF, 0x35, 0x84, 0x5A, 0xA1, 0x2E, 0xE8, 0x25, 0x42, 0x00, 0x4C, 0xAC, 0x24, 0x48, 0x82, 0x24, 
+    0xB8, 0x00, 0x1D, 0x66, 0x4A, 0xEF, 0x94, 0x97, 0xBA, 0x36, 0x4F, 0xCA, 0x72, 0x00, 0x44, 0xB2, 0xBC, 0x2E, 0x53, 0x83, 0xD9, 0xEB, 0xE9, 0x57, 0xB9, 0x39, 0x1E, 0x48, 0xCC, 0x52, 0xA3, 0x3E, 
+    0x64, 0x00, 0x72, 0xD2, 0x24, 0x6E, 0x2D, 0x40, 0x47, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x02, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x90, 0x00, 0x31, 0x91, 0x74, 0x79, 0xF9, 0x0E, 
+    0xC4, 0x2D, 0x98, 0x33, 0xD1, 0x94, 0xA4, 0xA9, 0xE1, 0x00, 0x10, 0x2D, 0xF6, 0xEC, 0xE3, 0xE7, 0x49, 0x00, 0x4F, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0x49, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x03, 0x20, 
+    0xA6, 0x00, 0x31, 0x91, 0x73, 0xB9, 0x9D, 0x24, 0x7E, 0x00, 0x60, 0x82, 0x26, 0x6D, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x90, 0x18, 0xF7, 0x18, 0x58, 0x8F, 0xF5, 0xA2, 0x23, 0x3A, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xA3, 0xC0, 0x02, 0xE8, 0x00, 0x0C, 0xA0, 0x8D, 0x00, 0x73, 0xA2, 0x26, 0x68, 0x02, 0x3E, 
+    0x56, 0x00, 0x4B, 0x98, 0x18, 0x39, 0x91, 0xA4, 0xC1, 0x0C, 0x9D, 0x39, 0xBC, 0x14, 0x6E, 0x2E, 0xE3, 0x0D, 0x83, 0x42, 0xAD, 0x65, 0x6D, 0x3F, 0x51, 0x00, 0x49, 0x0A, 0xA6, 0x4D, 0x9A, 0xA4, 
+    0xF8, 0x39, 0x6F, 0x71, 0x6E, 0xB7, 0x9D, 0x24, 0xF8, 0x39, 0x68, 0xBB, 0x6D, 0xB6, 0x97, 0x64, 0xC9, 0x39, 0x24, 0x59, 0x09, 0x4D, 0xDB, 0x24, 0xC9, 0x16, 0x5B, 0x83, 0x35, 0x64, 0xF3, 0x37, 
+    0x56, 0x00, 0x89, 0x91, 0x58, 0x89, 0x9F, 0x24, 0xFF, 0x00, 0x14, 0x40, 0x01, 0x14, 0x90, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x68, 0x80, 0x0A, 0xCC, 0x00, 0x0F, 0x35, 0x72, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xD2, 0x24, 
+    0x4F, 0x00, 0x49, 0x96, 0x5C, 0xC9, 0x91, 0x1C, 0xCF, 0x4F, 0xD6, 0x5E, 0xF1, 0x05, 0x43, 0x30, 0x2C, 0x00, 0x48, 0xB2, 0x24, 0x4D, 0xE2, 0x24, 0x3B, 0x00, 0x49, 0x90, 0x64, 0x49, 0x98, 0x84, 
+    0xBE, 0x60, 0xD6, 0x7E, 0xC9, 0x19, 0x9C, 0xC1, 0x3F, 0x00, 0x4B, 0xA2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x38, 0x00, 0x0C, 0xC4, 0xDB, 0x6C, 0xDB, 0xDC, 0x0C, 0x58, 0xAF, 0x35, 0x9A, 0x43, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x15, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 0xB9, 0x2E, 0xF9, 0x7F, 0x92, 0x27, 0xE0, 0x6D, 0xCD, 0x2A, 0x07, 0x5D, 0xB1, 0x92, 0xB4, 0x35, 
+    0xB9, 0x39, 0x49, 0x40, 0x92, 0x00, 0x30, 0x6F, 0xC1, 0x39, 0x73, 0x32, 0x97, 0x04, 0xB8, 0xAD, 0x5C, 0x00, 0x70, 0xA2, 0x27, 0x4B, 0xC2, 0x24, 0x82, 0x00, 0x39, 0x91, 0x78, 0xC9, 0x9B, 0xE4, 
+    0xC0, 0x33, 0x10, 0x3D, 0x68, 0xA5, 0x10, 0x97, 0xC6, 0x2E, 0x54, 0x43, 0x35, 0x50, 0xC3, 0x49, 0xFF, 0x00, 0xE6, 0x18, 0x8A, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x4E, 0xE2, 0x24, 0x4E, 0x02, 0x24, 
+    0x2C, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x6E, 0x00, 0x24, 0x9B, 0xC4, 0xC9, 0x97, 0x13, 0xB9, 0x2D, 0xE9, 0x60, 0x62, 0x94, 0x2A, 0xF1, 0xBA, 0x36, 0xBC, 0xE9, 0x53, 0xA9, 0x14, 0x82, 
+    0xAC, 0x17, 0x02, 0x04, 0x09, 0x6C, 0xD9, 0xC4, 0xB6, 0x00, 0xA3, 0x83, 0xF5, 0xC2, 0x3C, 0xAC, 0x52, 0x00, 0x49, 0x9E, 0x84, 0xC9, 0xF5, 0x18, 0xCD, 0x41, 0xF1, 0x64, 0x8A, 0xD5, 0x4C, 0xF0, 
+    0xB0, 0x00, 0xE2, 0x40, 0x77, 0x8E, 0xF9, 0xC4, 0xFF, 0x00, 0x4A, 0x3E, 0xC1, 0x9C, 0x5E, 0xCE, 0xFF, 0x00, 0x25, 0xDB, 0xA9, 0x9D, 0xD0, 0x21, 0xFF, 0x00, 0x27, 0x73, 0x29, 0x00, 0x02, 0x20, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x99, 0x98, 0x89, 0x19, 0x98, 0xD0, 0x0C, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x03, 0x30, 0x15, 0x53, 0x31, 0x05, 0x53, 0x9A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x34, 0x00, 0x46, 0x92, 0x24, 0x49, 0x92, 0x24, 0x21, 0x00, 0x42, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD2, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x6C, 0xFD, 0x05, 0x31, 0x16, 0x63, 0xB1, 0x16, 0x93, 0x7E, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xD5, 0x00, 0x58, 0x8F, 0xF5, 0x49, 0x9F, 0xE4, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x0B, 0x18, 0xAD, 0xF5, 0xA2, 0xBF, 0x3A, 0x15, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x4E, 0x00, 0xC9, 0x91, 0x1C, 0x49, 0x94, 0x64, 0xCE, 0x50, 0x05, 0x53, 0x30, 0x15, 0xEF, 0xCD, 0x37, 0x00, 0x4E, 0xD2, 0x24, 0x4C, 0x82, 0x24, 0x46, 0x00, 0x49, 0x9A, 0x84, 0x49, 0x96, 0x1C, 
+    0xBF, 0x61, 0x19, 0x9C, 0xC1, 0x97, 0x6E, 0x2C, 0x3E, 0x00, 0x48, 0xA2, 0x24, 0x4A, 0xC2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA4, 0x00, 0x69, 0x9B, 0x98, 0x39, 0x15, 0x13, 0xE4, 0x04, 0xB6, 0xD3, 0xFA, 0x5B, 0x0D, 0xD1, 0x05, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xDF, 0x00, 0x49, 0x9E, 0xE4, 0x49, 0x92, 0x04, 0xFF, 0x00, 0xB6, 0xFD, 0xFF, 0x09, 0x20, 0x49, 0xCE, 0x06, 0x5A, 0x8B, 0x35, 0xA0, 0x23, 0x3A, 
+    0xFD, 0x29, 0x31, 0x19, 0x0F, 0xEF, 0xF0, 0x4E, 0xDF, 0x00, 0x6D, 0xFB, 0xFF, 0x49, 0x02, 0x24, 0x2C, 0x00, 0x48, 0xC2, 0x24, 0x49, 0x92, 0x24, 0x95, 0x00, 0x49, 0xF2, 0xFF, 0x24, 0x09, 0x0F, 
+    0x95, 0x00, 0xB9, 0xFB, 0x3F, 0x64, 0x03, 0x35, 0xED, 0x2E, 0x9F, 0x8B, 0xF9, 0x98, 0x83, 0x39, 0xFF, 0x4E, 0x1D, 0xF0, 0x0A, 0xE9, 0x90, 0xAE, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x4E, 0x62, 0x24, 
+    0x3D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 0xBB, 0x00, 0x31, 0xF5, 0x0E, 0x1D, 0x44, 0x89, 0xB4, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0xD2, 0x27, 0xBE, 0x1B, 0x26, 0x68, 0x82, 0xA7, 0x14, 0x0F, 
+    0x9F, 0x00, 0x4D, 0xDC, 0xC7, 0x6B, 0x09, 0x09, 0xBB, 0x29, 0xD5, 0x4C, 0xCC, 0x03, 0x8F, 0x35, 0x54, 0x00, 0x8E, 0xF1, 0x5C, 0x49, 0x96, 0xC4, 0xCD, 0x4E, 0x44, 0x53, 0xF0, 0x9E, 0x98, 0x0E, 
+    0xA9, 0x00, 0x4F, 0xE2, 0xFF, 0x63, 0x0B, 0x49, 0xBF, 0x1C, 0xEF, 0x9A, 0x57, 0xE5, 0x30, 0x41, 0xD1, 0x00, 0x83, 0x83, 0xF5, 0x12, 0xCB, 0x8A, 0x4D, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x89, 0x11, 0x00, 0x01, 0x10, 0x00, 0xEB, 0x12, 0xA2, 0x23, 0x3A, 0x58, 0x8F, 0xF5, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x09, 0x31, 0x15, 0x43, 0x00, 0x06, 0x60, 0x93, 0x00, 0xE0, 0x03, 0x3E, 0x6A, 0x32, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x13, 0x00, 0x49, 0x92, 0x04, 0x49, 0x92, 0x24, 
+    0x53, 0x00, 0x01, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x53, 0x00, 0x11, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x53, 0x00, 0x58, 0x62, 0x27, 0x49, 0x92, 0x24, 0x16, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x44, 0xFF, 0x9B, 0x00, 0x06, 0xA0, 0x80, 0xBC, 0x31, 0xA6, 0x00, 0xA0, 0x23, 0x3E, 0x6B, 0x42, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x23, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xC5, 0x06, 0x1D, 0x66, 0x4A, 0xEF, 0x10, 0x73, 0xBA, 0x00, 0x7D, 0xB2, 0xFA, 0x1A, 0x0B, 0x48, 0xC1, 0x00, 0x89, 0x79, 0x77, 0xE5, 0x24, 0x41, 
+    0xC6, 0x00, 0xC3, 0x0A, 0xD1, 0x5A, 0xBF, 0x3A, 0x13, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x8F, 0x00, 0x39, 0x91, 0x74, 0x49, 0x9C, 0x24, 0xB4, 0x00, 0xD0, 0x3C, 0xF6, 0xF6, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x98, 0x4F, 0xDE, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x04, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x42, 0x92, 0xFF, 0x9F, 0x24, 0x60, 0x00, 0x49, 0x82, 0x24, 0xB6, 0x93, 0x24, 0xFF, 0xD5, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0x30, 0xEB, 0x23, 0xD6, 0xD0, 0x08, 0x80, 0xB0, 0x1C, 0x01, 0x5D, 0x90, 0x82, 0x40, 0xF0, 0xFF, 0x69, 0xE9, 0x60, 0x02, 0x13, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xD8, 0x00, 0x89, 0x9B, 0x77, 0x37, 0x6F, 0x0E, 0xFF, 0x00, 0x5C, 0x3D, 0xFA, 0xFF, 0x03, 0x27, 0x1A, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x85, 0x00, 0xF1, 0x90, 0x98, 0x49, 0x9E, 0x24, 
+    0xB4, 0x00, 0x02, 0x40, 0x8E, 0xB6, 0x9D, 0x24, 0x8D, 0x00, 0x58, 0xC3, 0x3E, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x90, 0x00, 0xA6, 0x90, 0x97, 0x49, 0x9E, 0x24, 
+    0xB4, 0x00, 0x02, 0x40, 0x8E, 0xB6, 0x9D, 0x24, 0xAB, 0x00, 0xD0, 0x48, 0xD6, 0xFE, 0x93, 0x24, 0x9F, 0x00, 0x05, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x77, 0x00, 0xE0, 0x23, 0x31, 0xB6, 0x93, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x40, 0x98, 0x83, 0xF5, 0x10, 0x0F, 0xD0, 
+    0x45, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x82, 0x27, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x5A, 0x80, 0x0A, 0xCC, 0x10, 0x8F, 0x39, 0x62, 0x00, 0x68, 0xA2, 0x27, 0x4C, 0xE2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 0x9F, 0x00, 0x00, 0x44, 0x92, 0xFF, 0x9F, 0x24, 0x49, 0x00, 0x78, 0xB2, 0x24, 0x4D, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x62, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xB4, 0x00, 0x13, 0x50, 0x72, 0xBF, 0x9D, 0x24, 0xB3, 0x00, 0x80, 0x36, 0xB2, 0xF6, 0x93, 0x24, 
+    0x59, 0x00, 0x60, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x48, 0x92, 0x24, 
+    0xFF, 0x00, 0x48, 0x9C, 0xC4, 0x49, 0x9C, 0xC4, 0xAD, 0x2E, 0x44, 0x43, 0x34, 0x64, 0xF3, 0x3F, 0xFF, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x90, 0x6D, 0x69, 0x1B, 0xDB, 0xFF, 0x3B, 0xC0, 0xBA, 0x8D, 0xB6, 0x9D, 0x24, 
+    0x81, 0x00, 0x73, 0x02, 0x3E, 0x50, 0xDF, 0xB6, 0xFA, 0x00, 0x01, 0x90, 0x6D, 0x69, 0x1B, 0xDB, 0xE2, 0x00, 0x18, 0x2D, 0xF6, 0xAC, 0x63, 0x27, 0x05, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x02, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x01, 0x10, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0xF8, 0x01, 0x1B, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x40, 0x02, 0xC4, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x80, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x14, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x1F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x03, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x4E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x6E, 0x0A, 0x55, 0x00, 0x49, 0x92, 0x24, 0xF6, 0x03, 0x60, 0x2E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x04, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x07, 0x60, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x82, 0x24, 0x57, 0x00, 0x49, 0x92, 0x24, 0xB9, 0xED, 0x01, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 
+    0x43, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x14, 0x57, 0x00, 0x49, 0x92, 0x24, 0x76, 0x02, 0xF0, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x4F, 0x00, 0x49, 0x92, 0x24, 0x89, 0xD3, 0x21, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x00, 
+    0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x4D, 0x00, 0x49, 0x92, 0x24, 0x89, 0xB3, 0x60, 
+    0x22, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA6, 0x00, 0x31, 0x17, 0x13, 0x31, 0x15, 0xB3, 0xC0, 0x4F, 0x6D, 0x0B, 0x00, 0xA4, 0x95, 0x58, 0xFF, 0x2C, 0x75, 0x4A, 0x67, 0x72, 0x20, 0x07, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0x60, 0x00, 0x00, 0x68, 0x10, 0x0D, 0x3A, 0xFF, 0x3A, 0x00, 0xB0, 0x6D, 0x76, 0x9B, 0xE4, 0xFF, 0x92, 0x00, 0x20, 0x00, 0x15, 0x90, 0x02, 0xFF, 0x00, 0x40, 0x08, 0x64, 0x40, 0x08, 0xC4, 
+    0xC0, 0x37, 0x4C, 0x89, 0x14, 0x4C, 0xF9, 0xFF, 0xC0, 0x4E, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x4E, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x13, 0xE8, 0x28, 0xAD, 0xA3, 0x39, 0x9B, 0x83, 0x39, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7F, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x97, 0x13, 0xC3, 0x46, 0x69, 0xEB, 0x01, 0x04, 0xA1, 0x15, 
+    0xFF, 0x16, 0x75, 0x4A, 0x67, 0x74, 0x40, 0x07, 0xFF, 0x00, 0x64, 0xB2, 0x25, 0x40, 0x02, 0x24, 0x97, 0x00, 0x89, 0x97, 0x54, 0x79, 0x95, 0x13, 0xC6, 0x53, 0x6D, 0x2B, 0x00, 0x20, 0xA9, 0x26, 
+    0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0xBB, 0x03, 0x24, 0x99, 0x24, 0xFF, 0x00, 0x0C, 0xB9, 0x60, 0x0C, 0xE0, 0x00, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 
+    0xFF, 0x80, 0x49, 0x42, 0x92, 0xC0, 0x0C, 0x35, 0x9E, 0x00, 0x12, 0x8D, 0x39, 0xEB, 0xC3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x92, 0x00, 0x39, 0x95, 0x13, 0x39, 0x91, 0x93, 
+    0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0x0B, 0x60, 0x24, 0x97, 0x84, 0xC0, 0x00, 0xFC, 0xC2, 0x23, 0x7C, 0xD2, 0x27, 
+    0x96, 0x00, 0x49, 0x9C, 0x98, 0x49, 0x95, 0x13, 0xC4, 0x43, 0x71, 0xD9, 0x01, 0xD2, 0x0A, 0x3A, 0xBF, 0x37, 0x1B, 0x09, 0x00, 0x2D, 0x97, 0xDC, 0xC7, 0x00, 0xEC, 0x23, 0xF6, 0x10, 0x3D, 0xAC, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0xF0, 0x04, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x28, 0xFF, 0x3B, 0x00, 0x00, 0x6D, 0x63, 0x5D, 0x3F, 0xFF, 0x3E, 0x00, 0xB0, 0x09, 0x2E, 0x97, 0x9B, 
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x48, 0x82, 0xE4, 0x48, 0x8E, 0x24, 0xD2, 0x42, 0x29, 0x79, 0x42, 0x27, 0x14, 0xB3, 0x83, 0x00, 0x6B, 0x02, 0x26, 0x60, 0x32, 0x27, 
+    0x9E, 0x00, 0x79, 0x97, 0x13, 0x39, 0x91, 0x77, 0xD2, 0x2A, 0xA3, 0x03, 0xF1, 0x10, 0x4F, 0x3A, 0x05, 0x00, 0x49, 0x82, 0x24, 0x4A, 0x92, 0x24, 0x55, 0x00, 0x49, 0x92, 0x24, 0x49, 0x6C, 0x0E, 
+    0xAB, 0x00, 0x49, 0x92, 0xDC, 0x2E, 0xC7, 0x09, 0xC4, 0x0B, 0xB9, 0xED, 0x72, 0x9B, 0x00, 0x69, 0x9D, 0x00, 0xDC, 0x03, 0x3E, 0xA0, 0x32, 0x3E, 0xB7, 0x1D, 0x29, 0x99, 0x0A, 0xE9, 0x16, 0xDB, 
+    0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xB7, 0x4D, 0x6D, 0x0F, 0xEC, 0x24, 0x9F, 0x24, 0xB0, 0x00, 0xCF, 0xF8, 0x1C, 0x8F, 0xD8, 0x9C, 
+    0xC1, 0x1F, 0xF5, 0x33, 0xB2, 0x80, 0xC6, 0x09, 0xBE, 0x00, 0x49, 0x52, 0x3F, 0x63, 0x0D, 0x6D, 0x68, 0x00, 0x49, 0x92, 0x24, 0x75, 0x02, 0xB1, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA6, 0x00, 0x31, 0x11, 0x13, 0x31, 0x13, 0x27, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x2C, 0x72, 0x20, 0x07, 0x72, 0x20, 0x07, 0xFF, 0x00, 0x01, 0x10, 0x49, 0xB9, 0x19, 0xDB, 
+    0xDD, 0x06, 0x58, 0x2F, 0x3A, 0xA4, 0x63, 0x3B, 0x39, 0x00, 0xCF, 0x91, 0x84, 0x49, 0x98, 0x44, 0xFF, 0x62, 0xAF, 0x90, 0xEA, 0xA9, 0xFE, 0x0A, 0xFF, 0x00, 0x40, 0xE2, 0x24, 0x46, 0x02, 0x24, 
+    0x12, 0x00, 0x92, 0x94, 0x24, 0x49, 0x92, 0x04, 0xC3, 0x00, 0xFF, 0x9D, 0x9B, 0x37, 0x67, 0x0E, 0xEB, 0x00, 0xA5, 0x40, 0x21, 0xB6, 0x4F, 0xB2, 0xFF, 0x00, 0x58, 0x9F, 0xF5, 0x49, 0xE2, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 0xC4, 0x07, 0x31, 0xF5, 0x0E, 0x1D, 0x44, 0x89, 0xC3, 0x43, 0x2A, 0xC1, 0x13, 0x0E, 0x91, 0x10, 
+    0xFF, 0x16, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x48, 0x92, 0x24, 0xC3, 0x00, 0x39, 0x15, 0x53, 0xE9, 0xF0, 0x0E, 0xD4, 0x12, 0xEA, 0xB3, 0xFE, 0x74, 0x48, 0x03, 
+    0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x05, 0x20, 0x01, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x20, 0xFF, 0x00, 0x0F, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 
+    0xF6, 0x37, 0x58, 0x2F, 0x3A, 0x74, 0xDA, 0x6F, 0xFF, 0x00, 0x4F, 0x92, 0x04, 0x00, 0x30, 0x01, 0xFF, 0x00, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x09, 0x10, 0x00, 0xFF, 0x13, 0xC9, 0x0A, 0xD1, 0x58, 0x2D, 0xF6, 0x3F, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 
+    0xA6, 0x00, 0x31, 0x11, 0x13, 0x39, 0x95, 0x74, 0xB9, 0x00, 0xA0, 0x23, 0x3A, 0x58, 0x0F, 0x8D, 0x7D, 0x00, 0xC9, 0x9B, 0xA4, 0xBF, 0xB9, 0x09, 0xBB, 0x45, 0x95, 0x5C, 0xC9, 0xC4, 0x2E, 0x35, 
+    0xFF, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0x9E, 0xE4, 0xFF, 0x5B, 0x80, 0x0A, 0xCC, 0xE9, 0x1C, 0xCC, 0x6C, 0x00, 0xE0, 0xB3, 0x27, 0x4B, 0xB2, 0x27, 0x81, 0x00, 0x31, 0x91, 0x58, 0x89, 0x97, 0x78, 
+    0xFF, 0x44, 0x04, 0x40, 0x01, 0x95, 0x53, 0x39, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0x4C, 0x00, 0x1E, 0x90, 0xFC, 0x49, 0x92, 0x24, 0x2C, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3A, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x4C, 0x00, 0x00, 0xF3, 0x27, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x97, 0x18, 0x89, 0x91, 0x18, 0xC6, 0x52, 0x79, 0xC9, 0x49, 0x5C, 0x4D, 0x68, 
+    0xBC, 0x26, 0x02, 0xA4, 0xB1, 0xF5, 0x33, 0xD6, 0x8B, 0x00, 0xD0, 0xC8, 0xFA, 0x4F, 0x52, 0x3F, 0x3B, 0x00, 0x98, 0x93, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x1D, 0x49, 0x92, 0xB6, 0x29, 0x90, 0x02, 
+    0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA5, 0x1F, 0x49, 0xD2, 0xB6, 0x80, 0x0A, 0xA8, 0x29, 0x00, 0x0B, 0xC1, 0x24, 0x4C, 0xC2, 0x24, 
+    0x79, 0x00, 0x9C, 0x90, 0x9B, 0x49, 0x92, 0xDC, 0xBA, 0x14, 0x13, 0xD0, 0x72, 0xB9, 0xEB, 0x96, 0xB6, 0x65, 0xA2, 0x33, 0x60, 0x71, 0xD7, 0x01, 0x96, 0x00, 0xEC, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x2C, 0x72, 0x20, 0x07, 0x72, 0x20, 0x07, 0x0E, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x26, 0x00, 0x6D, 0x9F, 0x24, 0x49, 0x92, 0x04, 0xD0, 0x00, 0xC9, 0x9B, 0x9B, 0x2F, 0x57, 0x0A, 0xFF, 0x87, 0x29, 0xE0, 0x01, 0x04, 0x00, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x82, 0x24, 
+    0x7B, 0x00, 0xC9, 0x99, 0x04, 0x49, 0xFA, 0xFF, 0xBB, 0x00, 0x24, 0x60, 0x6E, 0xB6, 0xFD, 0x24, 0xC6, 0x00, 0x80, 0xC6, 0x09, 0x2E, 0x97, 0x9B, 0xCB, 0x00, 0xEC, 0x23, 0x3A, 0x58, 0x2F, 0xD1, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x00, 0x89, 0x99, 0x77, 0x2F, 0x65, 0x0A, 0xC0, 0x00, 0xC2, 0x0A, 0xD1, 0xA2, 0xBF, 0x3E, 0xC3, 0x04, 0xF7, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0xF4, 0x43, 0x3F, 0xF0, 0x43, 0xFF, 0x1E, 0x00, 0x49, 0x92, 0x24, 0x49, 0x8E, 0x84, 0xC0, 0x11, 0xAF, 0x74, 0x0A, 0x1E, 0x96, 0xBD, 0xA7, 0x00, 0x83, 0xA4, 0xB1, 0xF4, 0xEF, 0x24, 
+    0xEA, 0x00, 0x9C, 0xD0, 0x52, 0x77, 0x97, 0x98, 0xFF, 0xC0, 0x00, 0x30, 0x00, 0x06, 0x10, 0x00, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0xFF, 0x51, 0x80, 0x08, 0xAC, 0x50, 0x8F, 0x35, 
+    0x9C, 0x00, 0xD0, 0xB6, 0xB6, 0x7E, 0xF2, 0x24, 0xFB, 0x00, 0x9C, 0xE0, 0x52, 0x77, 0x97, 0x77, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 
+    0xFF, 0x00, 0x49, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB2, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x2C, 0xC4, 0x00, 0x58, 0x2F, 0x3A, 0xEB, 0x43, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA9, 0x00, 0xC9, 0x9B, 0xB8, 0x79, 0x17, 0x0F, 0xBD, 0x40, 0x1C, 0xD6, 0x09, 0xD2, 0x2A, 0x3E, 0xBD, 0x36, 0x9B, 0x00, 0x40, 0x2D, 0x97, 0xDC, 0xB2, 0x24, 0x9A, 0x23, 0x3A, 0xC0, 0x3C, 0x80, 
+    0xFF, 0x00, 0x49, 0x90, 0x04, 0x4F, 0xE0, 0x04, 0xFF, 0x96, 0x00, 0x03, 0xC8, 0x00, 0x08, 0x00, 0xD8, 0x00, 0x7D, 0x42, 0xFF, 0x63, 0x0B, 0x6D, 0xE7, 0x00, 0x89, 0x7B, 0x97, 0x2D, 0xB5, 0x09, 
+    0xFF, 0xAE, 0x19, 0x60, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x8E, 0xE4, 0xE3, 0x02, 0xB9, 0xFF, 0xB6, 0xE5, 0xD6, 0x41, 0x86, 0x00, 0x4F, 0xC2, 0x27, 0x6A, 0x02, 0x26, 
+    0x63, 0x00, 0x49, 0x9E, 0xE4, 0x49, 0x1E, 0xE3, 0xFF, 0x33, 0xE9, 0xE0, 0x0E, 0xEF, 0xA0, 0xEE, 0xFF, 0x00, 0xC8, 0x8B, 0xBC, 0xC8, 0x9B, 0xBC, 0xFF, 0x9C, 0x99, 0x98, 0x01, 0x19, 0x90, 0x01, 
+    0xFF, 0x8A, 0xF4, 0x03, 0x8D, 0x00, 0x00, 0x00, 0xFF, 0x39, 0xFE, 0x43, 0xD6, 0xD2, 0x08, 0x40, 0x96, 0x00, 0x7E, 0x32, 0x3E, 0xE0, 0x03, 0x3E, 0x65, 0x00, 0x16, 0xE0, 0xB6, 0x49, 0x92, 0x24, 
+    0x65, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x65, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x65, 0x00, 0x00, 0xD4, 0xB6, 0x49, 0x92, 0x24, 0xC5, 0x00, 0x4F, 0xFE, 0xB8, 0x09, 0x9B, 0x1C, 
+    0xC1, 0x27, 0xB9, 0x5B, 0x4E, 0x12, 0xA4, 0xB1, 0xBE, 0x1B, 0x9C, 0x00, 0x68, 0x63, 0x5B, 0x3F, 0xBA, 0x00, 0xD0, 0x36, 0xD6, 0xF6, 0x93, 0x24, 0x65, 0x00, 0x98, 0xD3, 0x27, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x2C, 0x72, 0x20, 0x07, 0x72, 0x20, 0x07, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x14, 
+    0xBE, 0x00, 0x89, 0x1B, 0x77, 0xE6, 0xC0, 0xC1, 0xFF, 0x00, 0x9C, 0x30, 0x01, 0x4A, 0x62, 0xDB, 0xFF, 0x00, 0x00, 0x92, 0x24, 0x49, 0x62, 0xDB, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 
+    0xCB, 0x1D, 0xB7, 0xFD, 0x6E, 0xA9, 0x14, 0x0F, 0x92, 0x00, 0x74, 0x32, 0x27, 0x6A, 0x82, 0xD5, 0x87, 0x00, 0x89, 0x97, 0x78, 0x49, 0xE5, 0x12, 0xC5, 0x30, 0x03, 0x3F, 0xF0, 0x02, 0x0F, 0x35, 
+    0xB0, 0x00, 0x49, 0x9E, 0xDC, 0x09, 0x9C, 0xD0, 0xC1, 0x59, 0x21, 0xE8, 0xCD, 0x9F, 0x74, 0xDB, 0xF0, 0x3F, 0xFF, 0x1F, 0x00, 0x24, 0x69, 0xDB, 0xF0, 0x5D, 0x89, 0x87, 0x7A, 0x24, 0xF7, 0x7B, 
+    0xB0, 0x5D, 0x49, 0xB2, 0xED, 0x80, 0x3E, 0xFB, 0xFF, 0x00, 0x4F, 0xF2, 0x24, 0x4F, 0xF4, 0x04, 0xFF, 0x51, 0x49, 0x92, 0xD6, 0xDB, 0x0A, 0x88, 0x76, 0x00, 0x7B, 0xB2, 0x27, 0x73, 0x02, 0xDA, 
+    0xA1, 0x00, 0x89, 0x97, 0x78, 0x79, 0xE5, 0x0E, 0xFF, 0x2B, 0x83, 0x33, 0x38, 0x03, 0x20, 0x00, 0xFF, 0x00, 0x08, 0x8A, 0xDC, 0x08, 0x80, 0x00, 0xFF, 0x47, 0x9D, 0x83, 0x35, 0x58, 0x0F, 0xD1, 
+    0x51, 0x00, 0x4F, 0xF2, 0x24, 0x4D, 0x02, 0xB6, 0xC7, 0x00, 0x79, 0x97, 0x57, 0x31, 0xE5, 0x0E, 0xFF, 0x45, 0x72, 0x20, 0x03, 0x02, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x4D, 0xC0, 0x0A, 0xD0, 0x50, 0x8F, 0x39, 0x5E, 0x00, 0x68, 0xB2, 0x27, 0x4D, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xCE, 0x07, 0xF1, 0x90, 0x0E, 0xE9, 0x10, 0x53, 0xA6, 0x00, 0xA2, 0xA3, 0x26, 0xEA, 0x83, 0xD5, 0x45, 0x00, 0x49, 0x98, 0xE4, 0x49, 0xDC, 0x12, 0xCE, 0x4A, 0x27, 0x9A, 0x82, 0x21, 0xE8, 0xA9, 
+    0xFF, 0x00, 0x4E, 0xE0, 0x07, 0x7E, 0xE2, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x80, 0x86, 0xE4, 0xC9, 0x9B, 0x9B, 0xFF, 0x43, 0x31, 0xF5, 0x0E, 0x1D, 0x40, 0x01, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x8E, 0x24, 0x48, 0x82, 0x24, 0xB0, 0x00, 0x15, 0x60, 0x8E, 0xB9, 0x9D, 0x24, 0x74, 0x00, 0x60, 0x32, 0x27, 0x4F, 0x92, 0x24, 
+    0x85, 0x00, 0x49, 0x9E, 0xB4, 0x09, 0x91, 0x10, 0xFF, 0x45, 0xED, 0xF2, 0x0A, 0x9D, 0x30, 0x01, 0xFF, 0x00, 0xC9, 0x8B, 0xBC, 0xC8, 0x8B, 0x24, 0xFF, 0x00, 0x14, 0x40, 0x01, 0x14, 0x90, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x04, 0x40, 0x00, 0x94, 0x24, 0x96, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x89, 0x00, 0xC9, 0x91, 0x8C, 0x89, 0x9F, 0x24, 
+    0x74, 0x00, 0x10, 0x5B, 0x3F, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xAD, 0x00, 0x31, 0x11, 0x13, 0x31, 0x15, 0x93, 0xFF, 0x2C, 0x72, 0x40, 0x47, 0x74, 0x68, 0xDB, 0xA0, 0x00, 0x79, 0x97, 0x4E, 0x01, 0x15, 0x92, 
+    0xDF, 0x5F, 0xD5, 0x2F, 0x6C, 0x24, 0x99, 0x24, 0xB6, 0x5F, 0xB6, 0x0D, 0x00, 0xDB, 0x96, 0x24, 0xB6, 0x5E, 0xB6, 0x0D, 0x80, 0xDB, 0x98, 0x24, 0x4B, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 
+    0xB1, 0x00, 0xE9, 0x90, 0x77, 0x89, 0x9B, 0xE4, 0xC2, 0x43, 0xA2, 0x2D, 0x68, 0x9D, 0x94, 0xBB, 0xBE, 0x46, 0x37, 0x35, 0x01, 0xD2, 0x5A, 0x3F, 0xBC, 0x00, 0x58, 0x3F, 0x3A, 0x74, 0xE2, 0x24, 
+    0x31, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xC3, 0x04, 0xF6, 0x10, 0x0F, 0xF1, 0x10, 0xB7, 
+    0x96, 0x00, 0xA0, 0x0D, 0x3E, 0xE0, 0x43, 0x3E, 0xFF, 0x00, 0x4F, 0x90, 0x04, 0x49, 0x90, 0x04, 0xFF, 0xCF, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x7D, 0x32, 0xB6, 0x90, 0x08, 0xFC, 
+    0xFF, 0x63, 0xB9, 0x57, 0x0E, 0x12, 0x70, 0x00, 0xFF, 0xF9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0xFF, 0xAB, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 
+    0xFF, 0x5D, 0x7E, 0xC2, 0xB6, 0x90, 0x04, 0xFC, 0xFF, 0x71, 0x31, 0x55, 0x0A, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x49, 0x21, 0x99, 0xB6, 
+    0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0xE3, 0x00, 0x58, 0x2D, 0xF6, 0xA3, 0xD3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xCB, 0x34, 0x58, 0x3D, 0x68, 0xE5, 0x94, 0xBB, 0xB6, 0x5C, 0xC9, 0xBB, 0x09, 0x80, 0x66, 0x3F, 0xCB, 0x00, 0x83, 0x08, 0xD1, 0xA3, 0x5F, 0x3F, 
+    0x31, 0x00, 0x48, 0xD2, 0x24, 0x49, 0x92, 0x24, 0x51, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x14, 0xD0, 0x11, 0x31, 0xF5, 0x0E, 0xDD, 0xD6, 0xB6, 0xFF, 0x60, 0x02, 0x20, 0x49, 0x6D, 0x9B, 0x24, 
+    0xFF, 0x60, 0x00, 0x20, 0x01, 0x6D, 0x9B, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x4C, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x47, 0x00, 0x39, 0x90, 0xE3, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x03, 0x30, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0xA4, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0xB2, 0x35, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1F, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1E, 0x00, 0x68, 0x92, 0x24, 0x49, 0x62, 0x6E, 
+    0x10, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 0x33, 0x00, 0xA7, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x10, 0x9D, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x0F, 0x69, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 0x43, 0x00, 0x41, 0x9B, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x85, 0x93, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0xC0, 0x0F, 0x00, 0x49, 0xF2, 0x27, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x80, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x2E, 0x00, 0xE9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x80, 0x96, 0x24, 0x49, 0x92, 0x24, 0x12, 0x00, 0x48, 0x92, 0x24, 0x49, 0xF2, 0xFF, 
+    0x16, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xFF, 0x00, 0xF9, 0x9F, 0x24, 0x49, 0x62, 0x0A, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x02, 0x60, 
+    0x74, 0x00, 0xB6, 0x9D, 0x24, 0x49, 0x82, 0x26, 0x20, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x14, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF2, 0x01, 
+    0x0F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x2B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xB5, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x60, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x65, 0x00, 0x49, 0x92, 0xE4, 0xC9, 0x99, 0x14, 0xFF, 0x06, 0xB9, 0x7D, 0x97, 0xE5, 0xC4, 0x09, 0xFF, 0x3C, 0xFF, 0xD3, 0xD6, 0xDB, 0x08, 0x40, 0xC3, 0x00, 0x4F, 0x52, 0x3F, 0xA3, 0x83, 0xF5, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x69, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x99, 0x13, 0xEE, 0x00, 0xC9, 0x7D, 0xB7, 0xE5, 0xC6, 0x09, 0xFF, 0x47, 0xC9, 0xEF, 0xB6, 0xDB, 0x06, 0x04, 
+    0xFF, 0x23, 0xFF, 0xD3, 0xD6, 0x1B, 0x09, 0x48, 0xB3, 0x00, 0x49, 0xD2, 0x27, 0xA3, 0x0F, 0xD1, 0x0C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x12, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC5, 0x0C, 0xF1, 0xF0, 0x92, 0xA6, 0xD0, 0x61, 0xC1, 0x00, 0x73, 0xB2, 0x3E, 0xA2, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x9C, 0xC4, 0xC9, 0x40, 0x49, 0xF2, 0xB6, 0x27, 0x70, 0x82, 0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC9, 0x1E, 0xFF, 0x43, 0xD6, 0x90, 0xB6, 0x09, 
+    0x9F, 0x00, 0x49, 0xD2, 0x27, 0xEB, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9C, 0x00, 0x49, 0x92, 0xDC, 0x79, 0xF7, 0x0E, 0xCC, 0x1A, 0xB9, 0xED, 0x72, 0x94, 0x00, 0x6D, 
+    0xCB, 0x41, 0xFF, 0x43, 0xB2, 0x00, 0x44, 0x72, 0xC1, 0x00, 0x7E, 0xC2, 0x3A, 0x1A, 0x0D, 0x8C, 0x37, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x96, 0x00, 0x79, 0x9B, 0x53, 0x39, 0x91, 0x13, 
+    0xC9, 0x40, 0x49, 0xD2, 0xB6, 0x00, 0x00, 0x92, 0xC0, 0x33, 0x7F, 0x42, 0xB2, 0x00, 0xB4, 0x4D, 0xBE, 0x00, 0x7F, 0xC2, 0xFA, 0x1A, 0x0B, 0x88, 0x4A, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x26, 
+    0x56, 0x00, 0x89, 0x97, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x40, 0x49, 0xD2, 0xB6, 0x04, 0x40, 0x90, 0xC0, 0x40, 0x49, 0x42, 0x92, 0x00, 0xB0, 0x6D, 0xC0, 0x40, 0x49, 0x42, 0xB2, 0x00, 0xBA, 0xAD, 
+    0xC0, 0x00, 0x76, 0xEE, 0xE5, 0x46, 0xEE, 0xE5, 0xD2, 0x40, 0x4F, 0xF2, 0xB6, 0xA7, 0x70, 0x92, 0xD2, 0x40, 0x49, 0xD2, 0xB6, 0x12, 0x40, 0x92, 0xD2, 0x40, 0x49, 0xD2, 0xB6, 0x00, 0x44, 0x92, 
+    0x74, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x3D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x1C, 0xDF, 0x00, 0xC9, 0x1F, 0xB7, 0x2E, 0xD7, 0x09, 0xFF, 0x40, 0xC9, 0xEF, 0xB6, 0xDB, 0x06, 0xD8, 
+    0xFF, 0x1B, 0xFE, 0xC3, 0xD6, 0x1B, 0x09, 0x68, 0x9B, 0x00, 0x49, 0xE2, 0x27, 0xEB, 0x83, 0x35, 0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xD6, 0x40, 0x49, 0xF2, 0xB6, 0xA7, 0x7A, 0xA2, 
+    0xFF, 0x00, 0xB6, 0xE3, 0x30, 0xCE, 0xE2, 0x20, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xB5, 0x40, 0x4D, 0x5A, 0xB2, 0x15, 0x5A, 0xA1, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x40, 0x49, 0xF2, 0xB6, 0x27, 0x78, 0x82, 0x4A, 0x00, 0x7A, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xF9, 0x9F, 0x92, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x6D, 0x02, 0x26, 0x60, 0x02, 0x26, 0xD6, 0x16, 0xB1, 0x1D, 0x93, 0xF1, 0x14, 0x0F, 0xC0, 0x00, 0xB6, 0xBD, 0x66, 0x6B, 0xB0, 0x26, 
+    0x88, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x17, 0x13, 0xFF, 0x40, 0x49, 0x62, 0xDB, 0xDD, 0x46, 0x01, 0xFF, 0x00, 0x76, 0x42, 0x26, 0x5B, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xA6, 0x00, 0x79, 0x95, 0x13, 0x31, 0x11, 0x93, 0xFF, 0x66, 0x14, 0x30, 0x49, 0x6D, 0x9B, 0x24, 0xFF, 0x10, 0x00, 0x20, 0x00, 0x64, 0xDC, 0x02, 0xFF, 0x3E, 0xA2, 0x83, 0xF5, 0x5D, 0x8F, 0xF5, 
+    0x26, 0x00, 0x49, 0xD2, 0x24, 0x4C, 0xDA, 0x04, 0xFF, 0x05, 0x79, 0xF9, 0x72, 0xEE, 0x54, 0x0A, 0xFF, 0xC3, 0x19, 0x20, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x31, 0x40, 0x00, 0xD8, 0xDA, 0xC6, 0xB6, 
+    0xFF, 0x94, 0x00, 0x00, 0x00, 0x14, 0x10, 0x0B, 0xFF, 0x66, 0xA7, 0x03, 0xD1, 0x80, 0x0A, 0x60, 0x92, 0x00, 0x4D, 0x42, 0x27, 0x6A, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x69, 0x00, 0x49, 0x9A, 0x84, 0x89, 0x95, 0x14, 0xE1, 0x08, 0x9D, 0x49, 0xBD, 0xD4, 0x3B, 0xC4, 0xC7, 0x23, 0x58, 0x23, 0xF1, 0x03, 0x4D, 0xAC, 0x29, 0x00, 0x49, 0x92, 0x24, 0x4D, 0x82, 0x24, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4E, 0x00, 0x00, 0x80, 0xFF, 0x78, 0x82, 0x27, 0xAA, 0x00, 0xE5, 0xF0, 0x57, 0x49, 0x97, 0x57, 
+    0xCA, 0x12, 0x98, 0x83, 0x35, 0x58, 0x8F, 0x35, 0x43, 0x00, 0x49, 0x92, 0xA4, 0x49, 0x96, 0x1C, 0xCA, 0x33, 0xF1, 0x70, 0x42, 0x1D, 0x48, 0xA9, 0xA9, 0x00, 0x18, 0xBB, 0xFA, 0x7D, 0xE2, 0x24, 
+    0x6A, 0x00, 0x9B, 0x90, 0xBF, 0x49, 0x92, 0x24, 0xCD, 0x10, 0x13, 0x56, 0x4A, 0xEF, 0x10, 0x93, 0xA1, 0x00, 0x74, 0xB2, 0x26, 0xE2, 0x03, 0x3A, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x58, 0x8B, 0x39, 0x98, 0x83, 0x39, 0x6B, 0x00, 0x9B, 0xF0, 0xBB, 0x49, 0x92, 0x24, 0xCF, 0x00, 0x14, 0x54, 0x0E, 0x37, 0x95, 0x77, 0xCC, 0x00, 0x74, 0x32, 0x3A, 0x5A, 0x83, 0xF5, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4A, 0x04, 0x4F, 0x30, 0x04, 0x43, 0x30, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x4F, 0xF2, 0x24, 0xFF, 0x00, 0xB6, 0xFD, 0xFF, 0x49, 0x82, 0x25, 
+    0x53, 0x00, 0x40, 0x6C, 0xC7, 0x49, 0x9C, 0xC4, 0xFF, 0x53, 0xE9, 0x92, 0xCE, 0xE9, 0x90, 0x0E, 0x53, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x53, 0x00, 0x60, 0x62, 0x27, 0x49, 0x92, 0x24, 0xBB, 0x00, 0x89, 0x99, 0x77, 0x31, 0x15, 0x0F, 0xFF, 0x00, 0x1C, 0x30, 0x00, 0x02, 0x00, 0x20, 0xFF, 0x00, 0x80, 0x0D, 0x24, 0x71, 0x17, 0x77, 
+    0xFF, 0x64, 0x00, 0x20, 0x49, 0x68, 0x8B, 0x24, 0xE4, 0x29, 0xA2, 0x83, 0xF5, 0x1B, 0x6D, 0xDB, 0x22, 0x00, 0x49, 0xE6, 0x64, 0x4B, 0x86, 0x64, 0xFF, 0x56, 0xE9, 0x9C, 0xCE, 0xE9, 0x90, 0xCE, 
+    0xFF, 0x00, 0x0E, 0xE0, 0x24, 0x4E, 0xE2, 0x24, 0x2B, 0x00, 0x49, 0x90, 0x04, 0x49, 0xF0, 0x1F, 0xB5, 0x6B, 0x11, 0x1E, 0xE1, 0x11, 0x1E, 0xE1, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xBE, 0x00, 0x4E, 0xE2, 0x24, 0x1E, 0xE2, 0x41, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x74, 0x02, 0x27, 0x70, 0x0E, 0xBF, 
+    0xFE, 0x00, 0x77, 0xE7, 0x4E, 0xA5, 0xC0, 0x21, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x26, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xFF, 0x9F, 0x24, 0x49, 0x10, 0x00, 0xFF, 0x26, 0x01, 0x00, 0x00, 0x80, 0x06, 0xAD, 0xF2, 0x00, 0x18, 0x2D, 0xF6, 0xAB, 0x53, 0x3F, 
+    0x57, 0x00, 0x49, 0x96, 0x5C, 0x89, 0x91, 0x18, 0xFF, 0x16, 0x1D, 0xD0, 0xA1, 0x14, 0x4C, 0x39, 0xEB, 0x0A, 0x92, 0xF6, 0x92, 0xB6, 0x9D, 0x04, 0xED, 0x1C, 0xF5, 0xEF, 0xFC, 0x0E, 0xA0, 0x6D, 
+    0xFF, 0x40, 0xEF, 0x10, 0x0F, 0xF6, 0x40, 0x0F, 0xFF, 0x0B, 0x00, 0xE4, 0x00, 0x0E, 0xEA, 0xBC, 0xBF, 0x00, 0xA2, 0x03, 0x3A, 0x98, 0xA3, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC1, 0x00, 0x89, 0x97, 0x77, 0x31, 0x95, 0x0E, 0xFF, 0x00, 0x43, 0x2E, 0xE4, 0x42, 0xF2, 0xFF, 0xCB, 0x28, 0x9D, 0x68, 0x62, 0xA7, 0x96, 0x4E, 0x81, 0x00, 0x4D, 0xB2, 0x27, 0x6A, 0x02, 0x3E, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x14, 0x82, 0xB5, 0x36, 0x4F, 0xD2, 0xB6, 0x00, 0xB0, 0x6D, 0xBE, 0x36, 0x79, 0x57, 0x0E, 0xC0, 0xB8, 0x49, 
+    0xBF, 0x00, 0x58, 0x2F, 0x3A, 0x74, 0x32, 0x3A, 0x5C, 0x00, 0xC9, 0x95, 0x18, 0x89, 0x91, 0x18, 0xCF, 0x4C, 0x04, 0x4F, 0x30, 0x44, 0x43, 0x34, 0x1F, 0x00, 0x48, 0xC2, 0x24, 0x4D, 0xD2, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB5, 0x00, 0xF1, 0x10, 0x53, 0x79, 0x92, 0x24, 0xB8, 0x00, 0xA6, 0x83, 0x39, 0x49, 0x92, 0x24, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7C, 0x00, 0x09, 0x91, 0x54, 0x89, 0x95, 0x54, 0xBB, 0x2F, 0x50, 0x23, 0x30, 0x02, 0x2F, 0xF0, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xD6, 0x4A, 0x54, 0x43, 0xD5, 0x44, 0x45, 0x92, 0xFF, 0x00, 0x09, 0x90, 0xB6, 0xDB, 0x46, 0x92, 0xFF, 0x44, 0x98, 0x63, 0x3B, 0xA4, 0xD3, 0x3A, 
+    0x16, 0x00, 0x4F, 0xF0, 0x04, 0x4F, 0xF0, 0x04, 0xD6, 0x56, 0x21, 0x1A, 0xFE, 0xE1, 0x16, 0x6E, 0xA8, 0x29, 0x4E, 0xD2, 0xB6, 0x00, 0x00, 0x00, 0xA8, 0x29, 0x49, 0xD2, 0xB6, 0x80, 0x0A, 0xA8, 
+    0x1B, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 0xDC, 0x11, 0x31, 0x15, 0x0F, 0xE9, 0x90, 0x0E, 0xFF, 0x00, 0x00, 0x42, 0x27, 0x74, 0x42, 0x27, 0xB9, 0x00, 0xB1, 0x1D, 0x93, 0xF1, 0x10, 0x4F, 
+    0xFF, 0x2C, 0x49, 0x62, 0x00, 0x24, 0x49, 0x92, 0xE9, 0x2C, 0x49, 0x6C, 0xCC, 0xC0, 0x4C, 0xCE, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xD6, 0x56, 0x21, 0x1A, 0xDA, 0x21, 0x14, 0xAA, 
+    0xC2, 0x43, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC2, 0x43, 0x49, 0x42, 0x92, 0x00, 0x40, 0x92, 0xC2, 0x6B, 0x99, 0xEE, 0xE9, 0x80, 0xDE, 0xEA, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xBE, 0x3F, 0x21, 0x16, 0x62, 0x21, 0x16, 0x62, 0x5C, 0x00, 0x48, 0x82, 0x24, 0x70, 0x02, 0x27, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x02, 0x26, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0xEF, 0xC9, 0x20, 0x8C, 0x49, 0x53, 0xEF, 0xD0, 0x61, 
+    0xD0, 0x01, 0xA2, 0x83, 0xF5, 0x13, 0x5D, 0xAC, 0x2C, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x10, 0x00, 0xDB, 0x16, 0x92, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x9B, 0xD9, 0xB8, 0xE3, 0x00, 0x18, 0x2B, 0xF6, 0xA2, 0x43, 0x3A, 0x38, 0x00, 0x70, 0xF2, 0x24, 0x49, 0x92, 0x24, 
+    0x57, 0x00, 0x89, 0x91, 0x1C, 0xC9, 0x95, 0x84, 0xFF, 0x17, 0xA4, 0x43, 0x01, 0x1D, 0xD0, 0x09, 0xFF, 0x00, 0x01, 0x06, 0x88, 0xAE, 0x08, 0x68, 0x92, 0x1F, 0xD8, 0x46, 0xFF, 0x4D, 0x2E, 0x72, 
+    0xFF, 0x43, 0x37, 0x11, 0x0F, 0x2F, 0x5B, 0x53, 0xFF, 0x0E, 0x0E, 0xEA, 0x00, 0x00, 0x04, 0x68, 0xBD, 0x00, 0x98, 0x03, 0x3A, 0xE2, 0xB3, 0x3E, 0x29, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 
+    0xC6, 0x23, 0xE9, 0x7C, 0x6A, 0x26, 0xD4, 0x81, 0xB8, 0x52, 0x49, 0x42, 0x92, 0x00, 0xD0, 0xB6, 0xC5, 0x52, 0x49, 0x41, 0x52, 0x92, 0x64, 0xDB, 0xC3, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x4F, 0xF5, 
+    0x16, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x55, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x9F, 0x00, 0xE4, 0xF0, 0x57, 0x89, 0x97, 0x78, 
+    0xBC, 0x19, 0x58, 0x03, 0xF5, 0x02, 0x0F, 0xF0, 0x56, 0x00, 0x89, 0x91, 0x5C, 0x49, 0x96, 0xA4, 0xD3, 0x56, 0x04, 0x53, 0xF1, 0xDE, 0x7C, 0x82, 0x68, 0x00, 0x4E, 0xD2, 0x24, 0x7B, 0x02, 0x3E, 
+    0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xC3, 0x00, 0xF9, 0x1F, 0xB7, 0xEF, 0x66, 0x0A, 0x97, 0x00, 0xFF, 0x43, 0x3A, 0x98, 0x23, 0x3E, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xC9, 0x0A, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x13, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0xBE, 0x00, 0x89, 0x99, 0x77, 0x31, 0xE5, 0x0E, 0xCB, 0x02, 0x12, 0x0D, 0xF1, 0x58, 0x2F, 0x3A, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x4A, 0x5D, 0xD2, 0x39, 0x1D, 0xD2, 0x39, 0x53, 0x00, 0x00, 0x60, 0xDB, 0x4F, 0xF2, 0x24, 0x53, 0x00, 0x00, 0x64, 0xDB, 0x49, 0x92, 0x24, 
+    0x16, 0x00, 0x4F, 0xF0, 0x04, 0x49, 0x90, 0x04, 0xFF, 0x56, 0xE9, 0x9F, 0xCE, 0xE9, 0x90, 0xCE, 0x69, 0x00, 0x00, 0xB0, 0xB6, 0x7B, 0xB2, 0x27, 0x69, 0x00, 0x00, 0xD4, 0xB6, 0x49, 0x92, 0x24, 
+    0x1B, 0x00, 0x48, 0x82, 0x24, 0x49, 0x92, 0x24, 0xD4, 0x00, 0xEF, 0x10, 0x0F, 0x31, 0x95, 0x77, 0xFF, 0x00, 0x40, 0x02, 0x20, 0x00, 0x22, 0x00, 0x62, 0x00, 0x21, 0x10, 0xDB, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x6D, 0xFB, 0xFF, 0x49, 0x92, 0x00, 0xE9, 0x62, 0x21, 0x73, 0x32, 0x06, 0x23, 0x30, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x52, 0x00, 0x00, 0x20, 0xDB, 0x7A, 0xA2, 0x27, 0x52, 0x00, 0x00, 0x60, 0x9B, 0x49, 0x98, 0x84, 0xF4, 0x6B, 0x29, 0x9F, 0xF2, 0x29, 0x1F, 0xF0, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xBC, 0x24, 0x4F, 0xF2, 0xB6, 0xA7, 0x74, 0x42, 0x5F, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 
+    0xC1, 0x1F, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x81, 0x00, 0x60, 0x02, 0x26, 0x60, 0x82, 0x26, 0xD6, 0x16, 0xF1, 0x1C, 0x0F, 0xF1, 0x10, 0x0F, 0xE0, 0x00, 0xD4, 0x88, 0xD1, 0x62, 0xBF, 0x3E, 
+    0xFF, 0x00, 0xC6, 0x78, 0x68, 0x01, 0x16, 0x40, 0xAE, 0x00, 0x7D, 0x42, 0x27, 0xEA, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0x79, 0x19, 0x53, 0xF1, 0x10, 0x53, 0xE6, 0x00, 0xAD, 0x33, 0xF6, 0x58, 0x2F, 0xF6, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x22, 0x00, 0x49, 0x90, 0xC4, 0x49, 0x92, 0x24, 0xFF, 0x00, 0xA5, 0xE0, 0x4E, 0x37, 0x97, 0x97, 0xFF, 0xBC, 0x00, 0x0A, 0x00, 0x03, 0x10, 0x02, 0xFF, 0x1A, 0x23, 0x29, 0x49, 0x30, 0x00, 0x24, 
+    0xFF, 0x00, 0x2B, 0x07, 0x97, 0xC9, 0x8D, 0x60, 0xCF, 0x00, 0x80, 0xB6, 0xB1, 0xAD, 0xBF, 0x3E, 0x60, 0x00, 0x68, 0xC2, 0x24, 0x49, 0x92, 0x24, 0x80, 0x00, 0x49, 0x9A, 0x7C, 0x49, 0x95, 0x10, 
+    0xCC, 0x2B, 0xD5, 0x4A, 0xD0, 0x13, 0xBF, 0x35, 0x39, 0x00, 0x00, 0xD0, 0x24, 0x4F, 0x92, 0x24, 0xDF, 0x00, 0xB6, 0x9D, 0x24, 0x09, 0x90, 0x6D, 0xFF, 0x39, 0xA1, 0x83, 0xF5, 0x12, 0x4D, 0xD2, 
+    0x41, 0x00, 0x49, 0xEC, 0xC4, 0x4B, 0x8C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x16, 0x92, 0xAE, 0x2E, 0x4E, 0x42, 0x92, 0x00, 0x20, 0x49, 0xC5, 0x2E, 0x89, 0xD9, 0x52, 0x12, 0xB4, 0x8D, 
+    0xC3, 0x00, 0x10, 0x8D, 0xF5, 0xA3, 0x53, 0x3F, 0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xC2, 0x00, 0xA5, 0xF0, 0x0E, 0x71, 0x97, 0xB8, 0xC7, 0x33, 0xEB, 0x83, 0xB1, 0x02, 0x54, 0x4E, 
+    0xC3, 0x29, 0xC9, 0xDD, 0x96, 0x92, 0x20, 0x69, 0xCA, 0x20, 0x1D, 0x36, 0x88, 0x18, 0xCD, 0x3A, 0x6D, 0x00, 0x68, 0xB2, 0x27, 0x4E, 0x92, 0x24, 0x96, 0x00, 0x39, 0x91, 0x13, 0x39, 0x91, 0x13, 
+    0xD6, 0x35, 0xE2, 0x23, 0xB6, 0x90, 0xB4, 0x6D, 0xC8, 0x35, 0x49, 0xDE, 0x96, 0x92, 0xB0, 0x8D, 0xC0, 0x2B, 0x9D, 0x20, 0x60, 0x10, 0xCD, 0x3A, 0x8A, 0x00, 0xA0, 0xB3, 0x26, 0x4D, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xF4, 0x4A, 0x55, 0x53, 0xDB, 0x15, 0x59, 0x01, 0xF4, 0x35, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xF4, 0x35, 0x49, 0x62, 0xDB, 0xDB, 0x0A, 0xAC, 
+    0x3C, 0x00, 0x4A, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 0xD6, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xB2, 0xFF, 0x00, 0x4E, 0xE2, 0x00, 0x8E, 0xE4, 0x90, 0xDF, 0x00, 0x49, 0x92, 0x24, 0x48, 0xB2, 0x25, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7B, 0x00, 0x39, 0x91, 0x78, 0x49, 0x9A, 0x24, 0xFF, 0x2B, 0x14, 0xD0, 0x09, 0x2E, 0x97, 0xBB, 0xFF, 0x25, 0x40, 0x02, 0xD8, 0x12, 0x40, 0x6E, 
+    0xFF, 0x62, 0x00, 0x04, 0x88, 0x1A, 0x5D, 0x3F, 0xB6, 0x3B, 0xA0, 0x3A, 0xAB, 0x8D, 0x2A, 0xA9, 0x29, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xFF, 0x00, 0x09, 0x1E, 0xE0, 0x91, 0x1E, 0xF2, 0xF4, 0x6B, 0x01, 0x1F, 0xF0, 0x29, 0x9F, 0xF6, 0x35, 0x00, 0x48, 0x8A, 0xA4, 0x48, 0x8A, 0xA4, 
+    0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0xCC, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x95, 0x97, 0xCC, 0x24, 0x7D, 0xB2, 0xB6, 0xD0, 0x36, 0x49, 
+    0xCD, 0x41, 0xA9, 0xD4, 0x81, 0xC2, 0x3A, 0xF6, 0x75, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xE2, 0x24, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 
+    0xFF, 0x00, 0x01, 0x10, 0x00, 0x91, 0x14, 0x92, 0xEE, 0x29, 0xA2, 0x83, 0xF5, 0x12, 0x4D, 0xB2, 0x54, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x6D, 0x00, 0xF1, 0x90, 0xBC, 0x49, 0x92, 0x24, 0x76, 0x00, 0x50, 0x53, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x62, 0x00, 0x39, 0x91, 0xBC, 0x49, 0x92, 0x24, 0xE5, 0x00, 0x9C, 0x50, 0x72, 0x77, 0x9B, 0xFC, 0xFF, 0x3E, 0xC0, 0xBF, 0xB5, 0x6E, 0x9B, 0x24, 
+    0xFF, 0x15, 0x80, 0xB6, 0xB1, 0xAD, 0xFD, 0x3F, 0xA1, 0x00, 0x58, 0xB3, 0x3E, 0x7E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0x31, 0x10, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x80, 0x6C, 0x3B, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x92, 0x04, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x57, 0x00, 0x70, 0xDC, 0xA6, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x80, 0x66, 0x3F, 0x49, 0x92, 0x24, 
+    0x28, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x6C, 0x00, 0x9C, 0x90, 0xBB, 0x49, 0x92, 0x24, 
+    0x71, 0x00, 0x00, 0xD4, 0xD6, 0x49, 0x92, 0x24, 0x49, 0x00, 0x98, 0xF3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0xB1, 0x10, 0xDB, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x64, 0xFB, 0x49, 0x92, 0x24, 0x43, 0x00, 0x98, 0xF3, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 
+    0x3C, 0x00, 0x48, 0x8A, 0xA4, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x3B, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x62, 0xDB, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x49, 0x82, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x50, 0x00, 0xF1, 0x90, 0xC4, 0x49, 0x92, 0x24, 0x73, 0x00, 0x02, 0xE0, 0xB6, 0x49, 0x92, 0x24, 
+    0x6B, 0x00, 0xD0, 0x5A, 0xDF, 0x49, 0x92, 0x24, 0x61, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x29, 0x00, 0x48, 0xA8, 0x84, 0x49, 0x92, 0x24, 0x60, 0x00, 0x02, 0x20, 0xDB, 0x49, 0x92, 0x24, 
+    0x4A, 0x00, 0x78, 0x82, 0x27, 0x49, 0x92, 0x24, 0x60, 0x00, 0x01, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x35, 0x00, 0x48, 0xCA, 0xA4, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x02, 0x20, 0xDB, 0x49, 0x92, 0x24, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x49, 0x92, 0x24, 0x3E, 0x00, 0x49, 0x91, 0xE4, 0x49, 0x92, 0x24, 0x72, 0x00, 0x03, 0xE0, 0xB6, 0x49, 0x92, 0x24, 
+    0x6A, 0x00, 0x10, 0x5D, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x60, 0x00, 0x16, 0x60, 0xD9, 0x49, 0x92, 0x24, 0x60, 0x00, 0xD8, 0xE3, 0x3D, 0x49, 0x92, 0x24, 
+    0x60, 0x00, 0x09, 0x10, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x00, 0x60, 0xDB, 0x49, 0x92, 0x24, 0x60, 0x00, 0x60, 0x62, 0x27, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x62, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x25, 0x01, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x24, 0x40, 0x00, 0xF9, 0x9F, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x4F, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x06, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x30, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x44, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x0E, 0x55, 0x00, 0x49, 0x92, 0x24, 0xB7, 0x0F, 0x40, 0x42, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x18, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x3C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x35, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x01, 0x10, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x0E, 0xC0, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x07, 0x60, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x02, 0x20, 0xD6, 0x00, 0x49, 0x92, 0x24, 0xEF, 0xF0, 0xDA, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x60, 0xDB, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x08, 0x60, 0x03, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x40, 0x02, 0x24, 
+    0x04, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 0x53, 0x00, 0x49, 0x92, 0x24, 0xC9, 0xDD, 0x09, 0x56, 0x00, 0x49, 0x92, 0x24, 0xFE, 0x03, 0x88, 0x1A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x1C, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x5E, 0x00, 0x49, 0x92, 0x24, 0x89, 0xB1, 0x18, 0xC1, 0x00, 0x49, 0x92, 0x24, 0xC2, 0x6C, 0xDB, 0x02, 0x00, 0x49, 0x92, 0x24, 0x48, 0x82, 0x24, 
+    0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x08, 0x40, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x60, 0x80, 0x00, 0x49, 0x92, 0x24, 0x09, 0x91, 0x58, 0xF7, 0x00, 0x49, 0x92, 0x24, 0x43, 0x6F, 0xD3, 
+    0x0C, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB3, 0x00, 0x49, 0x92, 0x24, 0x39, 0x15, 0x0F, 0xC2, 0x00, 0x49, 0x92, 0x24, 0x58, 0x63, 0x3A, 
+    0xE8, 0x00, 0x49, 0x92, 0x24, 0xEF, 0xF0, 0xDA, 0x8C, 0x00, 0x49, 0x92, 0x24, 0x6A, 0x02, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA8, 0x00, 0x49, 0x92, 0x24, 0xA7, 0xE4, 0x41, 
+    0x5D, 0x00, 0x49, 0x92, 0x24, 0x7A, 0x02, 0x27, 0x1F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 0xD8, 0x00, 0x49, 0x92, 0x24, 0x26, 0xD6, 0x99, 0x5E, 0x00, 0x49, 0x92, 0x24, 0x70, 0xA2, 0x27, 
+    0xD6, 0x16, 0x31, 0x19, 0x4F, 0xF1, 0x10, 0x0F, 0xFF, 0x0A, 0x75, 0x4A, 0x67, 0x74, 0x40, 0x07, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x24, 0xB3, 0x2D, 0x00, 0x02, 0x20, 
+    0xF1, 0x16, 0x71, 0x1B, 0x73, 0x31, 0x11, 0x43, 0xCF, 0x00, 0xEC, 0xB3, 0x3E, 0xA2, 0x83, 0xF5, 0xC0, 0x00, 0x49, 0x92, 0x04, 0x49, 0x92, 0x24, 0xFF, 0x80, 0x49, 0x42, 0x92, 0x00, 0x00, 0x00, 
+    0xFF, 0x80, 0x49, 0x42, 0xF2, 0xC0, 0xAE, 0xEE, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xD6, 0x56, 0xB1, 0x1D, 0x6A, 0x21, 0x10, 0x8A, 0xBD, 0x00, 0x7D, 0x42, 0x27, 0xA2, 0x83, 0xF5, 
+    0xFF, 0x00, 0x21, 0x99, 0x6D, 0x09, 0x90, 0x00, 0xC8, 0x57, 0x6D, 0x1B, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x99, 0x00, 0x49, 0x9E, 0xBC, 0x79, 0x17, 0x0F, 
+    0xC9, 0x34, 0x71, 0x6B, 0x0A, 0x83, 0x06, 0xD1, 0xCD, 0x46, 0x24, 0x09, 0x00, 0x6C, 0xF9, 0xE4, 0xC4, 0x30, 0xAC, 0x03, 0xB1, 0x03, 0x56, 0x0A, 0x94, 0x00, 0x4F, 0xD2, 0x27, 0x6B, 0x82, 0x39, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC9, 0x4F, 0x6D, 0x4B, 0x00, 0x04, 0x49, 0x34, 0xC0, 0x4F, 0x6D, 0x0B, 0x00, 0x24, 0x99, 0x24, 0xC3, 0x36, 0xAD, 0x03, 0xB1, 0x13, 0x66, 0x0A, 
+    0x89, 0x00, 0x4F, 0xD2, 0x27, 0x6B, 0x02, 0x3E, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0xFF, 0x46, 0x30, 0x0A, 0x6D, 0x6C, 0xED, 0x27, 
+    0xFF, 0x47, 0x80, 0xB1, 0x09, 0x2E, 0x97, 0xDC, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0x10, 0x02, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xC9, 0x16, 0x29, 0x99, 0x0E, 0xE9, 0x90, 0x0E, 
+    0xCF, 0x4F, 0x6D, 0x0B, 0x09, 0x24, 0xD9, 0x24, 0xFF, 0x4F, 0x36, 0xB0, 0x4D, 0x6D, 0x99, 0xC4, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x05, 0x10, 0x02, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0xBC, 0x00, 0xC9, 0x9D, 0x98, 0x31, 0x95, 0x0E, 0xC6, 0x3F, 0x2F, 0x49, 0x01, 0x10, 0xAB, 0x3E, 0xC2, 0x3A, 0x23, 0x0B, 0x40, 0xE5, 0x90, 0x98, 0xC3, 0x00, 0x75, 0xB2, 0x3E, 0x5A, 0x0F, 0xD1, 
+    0x49, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xC0, 0x53, 0x6D, 0x5B, 0x00, 0x25, 0x99, 0x24, 0xC0, 0x53, 0x6D, 0x0B, 0x00, 0xE4, 0x90, 0x0F, 0xC0, 0x53, 0x6D, 0x0B, 0x00, 0x24, 0xD9, 0x24, 
+    0xC0, 0x20, 0x64, 0x03, 0x35, 0x5B, 0x63, 0xDB, 0xC0, 0x00, 0xCB, 0x8B, 0xBC, 0xCB, 0xDB, 0xBC, 0xC1, 0x42, 0x6D, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x64, 0x03, 0x35, 0x50, 0x03, 0x35, 0x52, 0x00, 0x89, 0x91, 0x64, 0x49, 0x9A, 0xE4, 0xC9, 0x4A, 0x44, 0x6F, 0xC9, 0x1F, 0x98, 0x62, 
+    0x67, 0x00, 0x4E, 0xC2, 0x24, 0x7B, 0x82, 0x26, 0x1F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9C, 0x04, 0xC9, 0x17, 0x31, 0xF9, 0x4A, 0xA6, 0xD4, 0x61, 0x95, 0x00, 0xE0, 0xA3, 0x26, 0x73, 0xC2, 0x27, 
+    0xC4, 0x00, 0xE9, 0x10, 0x53, 0x39, 0x95, 0x77, 0xCA, 0x00, 0xEC, 0x23, 0x3A, 0x58, 0x83, 0xF5, 0x3D, 0x00, 0x49, 0x9E, 0xA4, 0x49, 0x96, 0x04, 0xE1, 0x42, 0x69, 0xFB, 0x4A, 0x26, 0xE4, 0xD1, 
+    0xA8, 0x00, 0x73, 0xB2, 0x26, 0xE2, 0x03, 0x3A, 0x68, 0x00, 0x49, 0x9A, 0x64, 0x89, 0x95, 0x14, 0xCB, 0x3F, 0xAE, 0x5A, 0xCD, 0x04, 0x3F, 0x35, 0x39, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x0A, 0x74, 0x40, 0x07, 0x74, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x48, 0x92, 0x24, 
+    0xF7, 0x16, 0x31, 0x17, 0x63, 0x31, 0x17, 0x73, 0xC4, 0x36, 0x53, 0x43, 0xF0, 0xD4, 0xCC, 0x89, 0x43, 0x00, 0x49, 0xE2, 0x24, 0x4B, 0x82, 0x27, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x20, 
+    0xDA, 0x80, 0x30, 0xBC, 0xCF, 0xCD, 0xFC, 0xCC, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xC5, 0x40, 0x52, 0x43, 0xCC, 0x1E, 0xF8, 0x4A, 
+    0xFF, 0x00, 0x49, 0xF0, 0x24, 0x7E, 0x52, 0x27, 0xC8, 0x57, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x8E, 0xC7, 0xCD, 0x17, 0x31, 0xF5, 0x0A, 0xA6, 0xE4, 0x61, 
+    0xAE, 0x00, 0x58, 0xAD, 0x3E, 0x73, 0xC2, 0x27, 0x15, 0x00, 0x72, 0x91, 0x24, 0x49, 0x92, 0x24, 0xB4, 0x00, 0xEE, 0x10, 0x53, 0x89, 0x97, 0x9C, 0xCB, 0x11, 0xA2, 0x83, 0xF5, 0x12, 0x3D, 0xD0, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0xF1, 0x18, 0xC9, 0x4A, 0x04, 0x43, 0x30, 0x04, 0x43, 0x30, 0x12, 0x00, 0x92, 0xC0, 0x24, 0x4C, 0xC2, 0x24, 0xC8, 0x00, 0xEF, 0x10, 0x53, 0x31, 0x15, 0x13, 
+    0xB3, 0x00, 0xE2, 0x03, 0x3A, 0x98, 0x03, 0x3A, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x1A, 0x00, 0xFF, 0x1F, 0x10, 0x8B, 0xD5, 0x62, 0x2F, 0x3A, 0x50, 0x00, 0xA0, 0xDF, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x37, 0x91, 0xA4, 0x49, 0x92, 0x24, 0xFF, 0x26, 0x9D, 0xE0, 0x0E, 0xEF, 0x14, 0x53, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 
+    0x8A, 0x00, 0xE0, 0x0F, 0x3E, 0xE0, 0x03, 0x3E, 0x48, 0x00, 0x76, 0x91, 0x64, 0x49, 0x98, 0x58, 0xFF, 0x6C, 0x27, 0x90, 0xF2, 0xA9, 0x7E, 0x02, 0xFF, 0x00, 0x40, 0x62, 0x24, 0x40, 0x02, 0x24, 
+    0xCD, 0x0A, 0xE9, 0xF0, 0x0E, 0xE9, 0x10, 0x53, 0xAF, 0x00, 0xEA, 0xB3, 0x26, 0xAA, 0x8F, 0xB1, 0x6F, 0x00, 0x49, 0x91, 0x58, 0x89, 0xC5, 0xFA, 0xC6, 0x00, 0x12, 0x4D, 0xD0, 0xB2, 0x1D, 0xAC, 
+    0x13, 0x00, 0x49, 0x91, 0x24, 0x4F, 0xD2, 0x24, 0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x7C, 0x00, 0xE8, 0x8F, 0x26, 0x68, 0x82, 0x26, 
+    0x13, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x5E, 0x00, 0x8F, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCF, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x95, 0x77, 
+    0xC2, 0x00, 0x73, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 0x7A, 0x00, 0x49, 0x9A, 0x9C, 0x89, 0x95, 0x10, 0xC4, 0x34, 0x95, 0x4A, 0xCC, 0x03, 0x2F, 0x35, 0x3C, 0x00, 0x48, 0xC2, 0x24, 0x4E, 0x92, 0x24, 
+    0x7B, 0x00, 0x09, 0x91, 0x54, 0xC9, 0x97, 0x84, 0xCE, 0x30, 0x5A, 0x33, 0xF1, 0x04, 0x4D, 0xCD, 0x89, 0x00, 0xC9, 0x99, 0x78, 0x4F, 0xE5, 0x13, 0xCA, 0x1E, 0xC3, 0x3C, 0xD0, 0x52, 0x8F, 0x39, 
+    0xF3, 0x04, 0xA3, 0x23, 0xFA, 0x5A, 0x8F, 0xD5, 0xB2, 0x00, 0x89, 0x97, 0x57, 0x39, 0x15, 0x0F, 0xCA, 0x00, 0x12, 0x8D, 0xF5, 0xA0, 0x23, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x74, 0x40, 0x07, 0x74, 0x40, 0x27, 0xFF, 0x00, 0x40, 0x82, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0xC3, 0x47, 0xAC, 0x48, 0x4F, 0x0C, 0xC1, 0x58, 0xA4, 0x00, 0x7C, 0x32, 0x27, 0xEA, 0x03, 0x3A, 0xFF, 0x6E, 0x80, 0x0A, 0xCC, 0x00, 0x0F, 0x35, 
+    0xC5, 0x46, 0x2D, 0xE8, 0x82, 0x29, 0x98, 0x82, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0xC6, 0x0A, 0xEE, 0x60, 0x53, 0x8E, 0xE9, 0xBC, 
+    0xC6, 0x00, 0xA3, 0x83, 0xF5, 0x12, 0x3D, 0xAC, 0xFF, 0x2D, 0xC7, 0x7A, 0xAC, 0xC7, 0x1A, 0xAE, 0x49, 0x00, 0x78, 0x8C, 0xA7, 0x78, 0x8A, 0xC7, 0xD3, 0x55, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0x82, 
+    0x56, 0x00, 0x78, 0xA2, 0x27, 0x7A, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5D, 0x00, 0x89, 0x91, 0x5C, 0x89, 0x95, 0x18, 0xD3, 0x4E, 0x04, 0x43, 0x30, 0x04, 0x43, 0x34, 
+    0x56, 0x00, 0x8F, 0xE1, 0x18, 0x8E, 0xF1, 0x18, 0xD6, 0x4A, 0x54, 0x43, 0xF5, 0x14, 0x49, 0x48, 0xB9, 0x17, 0x49, 0xD2, 0xB6, 0x92, 0x04, 0x00, 0xCD, 0x31, 0x31, 0x51, 0x4A, 0x93, 0xA8, 0xD1, 
+    0x9E, 0x00, 0xA0, 0xA3, 0x3E, 0x74, 0xE2, 0x24, 0xFF, 0x00, 0xB9, 0x11, 0x94, 0x79, 0x19, 0x00, 0xD4, 0x0C, 0x98, 0x03, 0x3A, 0x98, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x65, 0x00, 0x49, 0x92, 0x3C, 0x31, 0xEF, 0x81, 0xDB, 0x13, 0xF1, 0x10, 0x13, 0xF1, 0x90, 0x0E, 0xFF, 0x00, 0xF4, 0x43, 0x23, 0xF4, 0x03, 0x20, 0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xC2, 0x43, 0x4C, 0x42, 0x92, 0x00, 0x40, 0x92, 0xCB, 0x43, 0xC9, 0xDD, 0x72, 0x00, 0x4A, 0x72, 0xFF, 0x00, 0x14, 0x30, 0x00, 0x4E, 0xD2, 0x27, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x49, 0x92, 0x24, 
+    0x98, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0x24, 0xCC, 0x1D, 0xD0, 0x38, 0x01, 0x2E, 0x97, 0xDB, 0xC6, 0x50, 0xF5, 0x23, 0x8D, 0x9B, 0x70, 0x77, 0xC9, 0x00, 0x7E, 0xC2, 0x3E, 0x62, 0x0F, 0xD1, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5E, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xC1, 0x42, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x02, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x76, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB6, 0x2B, 0x50, 0x03, 0x35, 0x50, 0x03, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x8B, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0x9C, 
+    0xCA, 0x26, 0x58, 0x23, 0xF1, 0x03, 0x4D, 0xAC, 0xC9, 0x00, 0x79, 0x17, 0x53, 0xF7, 0xE0, 0x0E, 0xCC, 0x00, 0x58, 0x2F, 0x3A, 0xA2, 0xB3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x32, 0x00, 0x49, 0x90, 0x64, 0x49, 0x9C, 0x24, 0xC8, 0x39, 0x95, 0xEA, 0x81, 0x27, 0x96, 0x4A, 0xC7, 0x22, 0x4F, 0xE7, 0x57, 0x35, 0x51, 0x0F, 0xC2, 0x00, 0x58, 0x23, 0x3A, 0xEA, 0xB3, 0x3E, 
+    0xFF, 0x4F, 0x98, 0x03, 0xF5, 0x10, 0x0F, 0xCC, 0xC4, 0x12, 0xF1, 0xF0, 0x0E, 0xA7, 0x64, 0x42, 0x9A, 0x00, 0xE0, 0xA3, 0x3E, 0x6B, 0x42, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x74, 0x02, 0x27, 0x74, 0x42, 0xFF, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x35, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x34, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 0x93, 0x10, 0x2A, 0xA1, 0x56, 0xEA, 0xA9, 0xA6, 0xC1, 0x0B, 0x98, 0x83, 0xF5, 0x12, 0x3D, 0xAC, 0xFF, 0x0E, 0x10, 0x8D, 0xF5, 0xA2, 0xBF, 0x3A, 
+    0xC5, 0x46, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x1A, 0xA2, 0x4A, 0x00, 0x78, 0x86, 0xC7, 0x78, 0x82, 0x27, 
+    0xC7, 0x04, 0x14, 0x56, 0x4A, 0xEF, 0x10, 0x53, 0xC8, 0x3E, 0x1F, 0xD8, 0x80, 0x34, 0x28, 0x82, 0x49, 0x00, 0x78, 0x8E, 0x27, 0x78, 0x82, 0x27, 0xD0, 0x09, 0x26, 0x66, 0x4A, 0xEF, 0x10, 0x53, 
+    0xC3, 0x00, 0x74, 0x32, 0x3F, 0xA2, 0x8F, 0xB1, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x0D, 0xC9, 0x00, 0x89, 0x99, 0x77, 0x37, 0x55, 0x0E, 0xC9, 0x02, 0x02, 0x0D, 0xD1, 0x58, 0x2F, 0x3A, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x4A, 0xB5, 0xDD, 0x39, 0x9D, 0xD3, 0x21, 0x79, 0x00, 0x00, 0xD0, 0xB6, 0x4F, 0xF2, 0x24, 0x73, 0x00, 0xD0, 0x5A, 0x3F, 0x49, 0x92, 0x24, 
+    0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x2A, 0xA2, 0x83, 0xF5, 0x10, 0x0D, 0xAC, 0x86, 0x00, 0x49, 0xFC, 0x78, 0x7D, 0x20, 0xD6, 
+    0xE4, 0x28, 0x2E, 0xDD, 0x8D, 0x03, 0x96, 0xBC, 0xFA, 0x00, 0xEF, 0x50, 0x0E, 0x9C, 0x32, 0xF9, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x49, 0x92, 0x24, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x90, 0x0E, 
+    0x8A, 0x00, 0x20, 0x09, 0xFE, 0xE0, 0x03, 0x3E, 0xFF, 0x00, 0xB6, 0x97, 0x44, 0x09, 0x90, 0x00, 0xD3, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC8, 0x16, 0x49, 0x72, 0xDB, 0xEF, 0x96, 0x0E, 0x8E, 0x00, 0x7F, 0xCE, 0x26, 0x6A, 0x02, 0xD6, 0x6F, 0x00, 0x2E, 0x91, 0x7C, 0xC9, 0x67, 0x13, 0xD0, 0x44, 0x53, 0x43, 0xF0, 0x04, 0x3F, 0x35, 
+    0x11, 0x00, 0x4C, 0x82, 0x24, 0x48, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5E, 0x00, 0x89, 0x91, 0x18, 0xC9, 0x95, 0x64, 0xCB, 0x42, 0x43, 0x33, 0x30, 0x04, 0x5F, 0xA9, 0x56, 0x00, 0x49, 0xF2, 0x24, 0x4D, 0x82, 0xB5, 
+    0xAC, 0x00, 0x89, 0x97, 0x74, 0x79, 0xE5, 0x0E, 0xCB, 0x0E, 0x52, 0x2F, 0xF5, 0x58, 0x0F, 0x3A, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x49, 0x90, 0x84, 0x49, 0x92, 0x24, 
+    0xCD, 0x28, 0x9D, 0x68, 0x62, 0xAF, 0x94, 0x4E, 0xC5, 0x45, 0xA9, 0x74, 0x62, 0x1E, 0x58, 0xC9, 0x77, 0x00, 0x68, 0x22, 0x27, 0x7C, 0xD2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xCC, 0x00, 0xAF, 0xF0, 0x0E, 0x31, 0x15, 0x53, 0xCB, 0x6C, 0xCE, 0xD6, 0x8B, 0x34, 0xBA, 0xEA, 0x77, 0x00, 0x68, 0x22, 0x27, 0x7B, 0xC2, 0x24, 
+    0xFF, 0x99, 0x00, 0x03, 0xEC, 0x80, 0x0C, 0xA0, 0xCA, 0x56, 0x21, 0xFA, 0xC9, 0xD6, 0x5E, 0x31, 0x50, 0x00, 0x70, 0xB2, 0x24, 0x4C, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD6, 0x16, 0xF1, 0x1A, 0x0F, 0xF1, 0x10, 0xB7, 0xF4, 0x60, 0xFF, 0x4F, 0x92, 0x00, 0x90, 0x24, 0xF4, 0x60, 0xFF, 0x4F, 0x92, 0x00, 0x96, 0x24, 0x93, 0x00, 0xE2, 0x03, 0x3E, 0xE0, 0x33, 0x3E, 
+    0xC6, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x96, 0xB6, 0x86, 0x00, 0x60, 0x0A, 0xE6, 0x60, 0x32, 0x26, 0xCC, 0x26, 0xD5, 0xEA, 0x01, 0xA7, 0x94, 0xDA, 0xA7, 0x00, 0x98, 0x23, 0x3E, 0x6B, 0x42, 0x27, 
+    0xC5, 0x46, 0x29, 0x98, 0x82, 0x29, 0x98, 0xFF, 0x57, 0x00, 0x70, 0x0C, 0xC7, 0x70, 0x0C, 0xC7, 0xC9, 0x56, 0x21, 0x1A, 0xA2, 0x21, 0x9B, 0xFF, 0x4A, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 
+    0x81, 0x00, 0x39, 0x91, 0x78, 0x49, 0x9A, 0xE4, 0xEB, 0x4C, 0xC3, 0xDA, 0xAD, 0xE6, 0x1A, 0xFF, 0x49, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x84, 0x00, 0x31, 0x91, 0x78, 0x49, 0x9C, 0x24, 
+    0xC4, 0x18, 0x82, 0x48, 0x01, 0xE6, 0x94, 0xBB, 0xB2, 0x67, 0x4F, 0x0E, 0x09, 0x02, 0xF4, 0x3F, 0xC9, 0x13, 0x14, 0x04, 0x8C, 0x63, 0x5D, 0x3F, 0x7E, 0x00, 0xE0, 0x33, 0x27, 0x4E, 0x92, 0x24, 
+    0x56, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xD6, 0x4A, 0x44, 0x43, 0x34, 0x64, 0xF3, 0x3F, 0xFF, 0x00, 0x41, 0x12, 0x49, 0x21, 0x99, 0xB6, 0x9F, 0x00, 0x49, 0x92, 0x24, 0x48, 0x42, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x7E, 0x80, 0x08, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x67, 0x7D, 0x32, 0xB6, 0x80, 0x0A, 0xE0, 
+    0xFF, 0x00, 0x2D, 0xB7, 0xCD, 0x02, 0x5E, 0x24, 0xBD, 0x33, 0x12, 0x4F, 0xA8, 0x1E, 0x16, 0x8F, 0x70, 0x00, 0x4E, 0xC2, 0x27, 0xE0, 0xB3, 0x26, 0xC9, 0x16, 0xE9, 0x90, 0x0E, 0xE9, 0x96, 0xB6, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x33, 0x3E, 0xFF, 0x00, 0x01, 0x10, 0x49, 0x21, 0x99, 0xB4, 0xEF, 0x42, 0x98, 0x23, 0xF5, 0x24, 0xFD, 0xFF, 0x5C, 0x00, 0x4F, 0xD2, 0x24, 0x7B, 0x82, 0x26, 
+    0xB7, 0x00, 0xEF, 0x10, 0x73, 0x89, 0x9B, 0xE4, 0xC1, 0x44, 0xA2, 0x2D, 0x68, 0x9D, 0x94, 0xBB, 0xC6, 0x51, 0xBF, 0xB9, 0x09, 0xD2, 0x68, 0x3F, 0xC5, 0x00, 0x10, 0x2D, 0xF6, 0xEC, 0xE3, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBC, 0x24, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0xB6, 0x7C, 0x00, 0x68, 0x82, 0x26, 0x68, 0xB2, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x25, 0x00, 0x49, 0x90, 0xE4, 0x49, 0x92, 0x24, 0xC5, 0x00, 0x1D, 0x64, 0x0E, 0x37, 0x97, 0xB8, 0xC6, 0x5E, 0xF5, 0x0F, 0x6D, 0x9C, 0x94, 0xFF, 
+    0xCE, 0x33, 0xE5, 0x20, 0x69, 0x1B, 0x5D, 0x3F, 0x9D, 0x00, 0x98, 0xB3, 0x3E, 0x7D, 0xF2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC4, 0x00, 0xEF, 0x10, 0x53, 0x79, 0x97, 0xB8, 0xDF, 0x15, 0x14, 0x0D, 0xD1, 0x5B, 0xDF, 0x3A, 0x1D, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x95, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0x98, 0xD2, 0x30, 0xD8, 0x2C, 0xD0, 0x5B, 0x6F, 0x3B, 0xDF, 0x00, 0x4F, 0xF2, 0x04, 0x49, 0x92, 0x24, 
+    0xFF, 0x60, 0x00, 0x26, 0x49, 0x6D, 0x9B, 0x24, 0xDF, 0x0C, 0x13, 0x8D, 0xF5, 0x5B, 0xDF, 0x3A, 0x06, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x56, 0x00, 0x46, 0x9B, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x53, 0x00, 0x85, 0x93, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x80, 0x93, 0x24, 0x49, 0x92, 0x24, 0x85, 0x00, 0x37, 0x90, 0x24, 0x49, 0x92, 0x24, 0x48, 0x00, 0x78, 0x9E, 0x24, 0x49, 0x92, 0x24, 
+    0x46, 0x00, 0x68, 0x9B, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x70, 0x9A, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x70, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x90, 0x94, 0x24, 0x49, 0x92, 0x24, 0x49, 0x00, 0x78, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x23, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x02, 0x94, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0xC9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x47, 0x02, 0x24, 0x48, 0x92, 0x24, 0x68, 0x00, 0x27, 0x94, 0xD3, 0xC9, 0x93, 0x24, 0x27, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x03, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x80, 0x93, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x32, 0x00, 0xA7, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xD0, 0x9A, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x24, 0x00, 0x90, 0x94, 0x24, 0x49, 0x92, 0x24, 0x3C, 0x00, 0x44, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x14, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x2E, 0x00, 0x58, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x09, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x91, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x94, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x00, 0x49, 0x62, 0x3F, 0x5B, 0x0F, 0xD1, 0xC0, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x96, 0x04, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 
+    0xAF, 0x01, 0x49, 0xD2, 0xB6, 0x1B, 0x8D, 0xF5, 0xC0, 0x00, 0x49, 0xF2, 0xD8, 0xC9, 0x96, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0x60, 0x4F, 0x00, 0x49, 0xE2, 0x24, 0x4C, 0x02, 0x27, 
+    0xC0, 0x00, 0x49, 0x12, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0xAC, 0xC0, 0x00, 0x49, 0xE2, 0xC7, 0x4E, 0xF6, 0x04, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xEF, 0xF6, 0x0A, 
+    0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x0A, 0xA8, 0x1E, 0x00, 0x49, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xBF, 0x09, 0x49, 0x62, 0xDB, 0xDE, 0xE6, 0x01, 0xB2, 0x09, 0x49, 0xD2, 0xB6, 0xDB, 0x08, 0x80, 0xB2, 0x00, 0x49, 0xD2, 0xC6, 0x5F, 0x7C, 0xE4, 0xBE, 0x00, 0x49, 0x62, 0xDB, 0xDC, 0xD6, 0x61, 
+    0x55, 0x00, 0x49, 0xD2, 0x24, 0x4B, 0x02, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x89, 0x91, 0x18, 0x89, 0x91, 0x18, 0xFF, 0x48, 0x1D, 0x90, 0x24, 0xB6, 0x54, 0x92, 
+    0xC8, 0x08, 0x98, 0xE3, 0x39, 0x9B, 0x83, 0x39, 0xC0, 0x00, 0x49, 0x12, 0xDB, 0xD9, 0x16, 0x00, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xC0, 0x00, 0x49, 0x62, 0x3B, 0x5B, 0x0F, 0xF1, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB6, 0x00, 0x71, 0x12, 0xB7, 0xF1, 0x16, 0x0F, 0xF6, 0x02, 0x49, 0x62, 0xDB, 0x00, 0xB0, 0x6D, 0xF6, 0x02, 0x49, 0x62, 0xDB, 0x00, 0xB8, 0x6D, 
+    0xA1, 0x00, 0xC9, 0xD3, 0x3E, 0xE2, 0x03, 0x3E, 0xA4, 0x00, 0x49, 0x12, 0xDB, 0x21, 0x19, 0x00, 0xA4, 0x00, 0x49, 0x62, 0x3F, 0xA4, 0x03, 0xF1, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x56, 0x00, 0x00, 0x24, 0x96, 0xC4, 0xB6, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 
+    0xB0, 0x00, 0xF9, 0x1F, 0xB7, 0x31, 0x15, 0x13, 0xD5, 0x16, 0x49, 0x62, 0xDB, 0xEB, 0xB7, 0x1E, 0xD5, 0x00, 0xFF, 0xDF, 0xB6, 0xDB, 0x02, 0x24, 0x16, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x65, 0x00, 0x49, 0x92, 0x24, 0xC9, 0x99, 0x10, 0xC2, 0x00, 0xC9, 0x7F, 0xB7, 0xE5, 0x36, 0x41, 0xBC, 0x00, 0x7F, 0xD2, 0xDA, 0xDA, 0x08, 0x40, 
+    0x70, 0x00, 0x49, 0xF2, 0x24, 0x7C, 0x02, 0x3E, 0xFF, 0x00, 0x01, 0x12, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x40, 0x02, 0x20, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xD0, 0x11, 0x49, 0x12, 0xB7, 0xF1, 0x16, 0x0F, 0xD5, 0x00, 0xFF, 0xD3, 0x36, 0xF4, 0x42, 0x23, 0x36, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9E, 0x04, 0xB7, 0x00, 0x49, 0x9E, 0xBB, 0xEE, 0xC6, 0x01, 
+    0xB6, 0x02, 0xFF, 0xD3, 0xD6, 0xD2, 0x06, 0x00, 0x93, 0x00, 0x49, 0xE2, 0x24, 0xEC, 0x83, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x94, 0x00, 0x49, 0x92, 0xC4, 0x49, 0x17, 0x0F, 
+    0xD1, 0x09, 0x49, 0xE2, 0xB6, 0xDC, 0x26, 0x68, 0x4D, 0x00, 0x4F, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x5D, 0x98, 0x03, 0xD1, 0xC0, 0x0A, 0x60, 0x96, 0x00, 0x4E, 0xC2, 0x27, 0x6B, 0x02, 0x3A, 0xFF, 0x56, 0x00, 0x08, 0xAC, 0x10, 0x0D, 0x3A, 
+    0x8C, 0x00, 0xA0, 0xB3, 0x26, 0x7D, 0xE2, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0xA6, 0x00, 0x03, 0xC0, 0x00, 0x06, 0x00, 0xCB, 0x00, 0x74, 0xB2, 0x3E, 0xA2, 0x83, 0xF5, 
+    0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x14, 0x68, 0xD9, 0x00, 0x58, 0x2D, 0xFA, 0xEB, 0x43, 0x27, 0x92, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 0x92, 0x00, 0x27, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x92, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0xD1, 0x13, 0xDB, 0x66, 0x9B, 0x31, 0xF5, 0x0E, 0xFF, 0x5E, 0x5E, 0x43, 0x35, 0x52, 0x03, 0x34, 0x1E, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xBF, 0x3F, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x72, 0x00, 0x00, 0xB4, 0xB6, 0x7B, 0xB2, 0x27, 0x72, 0x00, 0x46, 0xD2, 0x26, 0x49, 0x92, 0x24, 0xBF, 0x00, 0xA6, 0xF4, 0x0E, 0xF1, 0x10, 0x53, 
+    0xB2, 0x00, 0x74, 0xB2, 0x3E, 0xE2, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x89, 0x91, 0x98, 0x49, 0x92, 0x24, 0x84, 0x00, 0x92, 0xD0, 0x12, 0x09, 0x91, 0x10, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x70, 0x80, 0x08, 0xCC, 0x00, 0x0F, 0x35, 0xB8, 0x3F, 0x44, 0x53, 0xED, 0x9E, 0x1A, 0x82, 
+    0x4D, 0x00, 0x49, 0xD2, 0x24, 0x4B, 0x02, 0x27, 0x76, 0x00, 0x21, 0x90, 0xB6, 0x49, 0x92, 0x24, 0x76, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 0x76, 0x00, 0x00, 0xD0, 0xB6, 0x49, 0x92, 0x24, 
+    0x76, 0x00, 0x90, 0xD3, 0x3A, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x91, 0x14, 0x60, 0x69, 0x9B, 0xFF, 0xE3, 0x35, 0x98, 0xB3, 0xF1, 0x6D, 0x9D, 0x24, 0xFC, 0x00, 0x49, 0xF0, 0x64, 0x4E, 0xFA, 0xC7, 
+    0xFC, 0x3D, 0x80, 0xB8, 0xAD, 0xB6, 0x9D, 0x24, 0xF4, 0x23, 0xB5, 0xED, 0x24, 0xFF, 0x7F, 0x00, 0xFA, 0x33, 0xA5, 0xFA, 0x0E, 0x31, 0x51, 0x13, 0xFF, 0x00, 0x00, 0x02, 0x20, 0x05, 0xD2, 0x23, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x00, 0xE8, 0x81, 0x3E, 0xEB, 0xB3, 0xDC, 0x58, 0x00, 0x49, 0x92, 0x24, 0xB6, 0x0F, 0x40, 0x34, 0x00, 0x49, 0x92, 0x24, 0x49, 0x82, 0x26, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC9, 0x00, 0x79, 0x17, 0x53, 0xEF, 0xF0, 0x4A, 0xBF, 0x00, 0xD0, 0x28, 0xD6, 0xEB, 0x43, 0x27, 0xC7, 0x00, 0x9C, 0x60, 0x53, 0x79, 0x97, 0x98, 
+    0xBC, 0x00, 0xA2, 0x83, 0x35, 0x5B, 0xDF, 0xF6, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x82, 0x24, 0xC0, 0x03, 0x23, 
+    0xD0, 0x11, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0x9E, 0x00, 0x89, 0x99, 0x74, 0x39, 0x95, 0x13, 0xC0, 0x39, 0xC3, 0xAA, 0x35, 0xE0, 0xA3, 0xB6, 
+    0x99, 0x2B, 0xE4, 0x90, 0x9C, 0xFF, 0xBD, 0x6D, 0xC5, 0x25, 0x98, 0x33, 0xF1, 0xC4, 0x4C, 0xCC, 0x41, 0x00, 0x49, 0x92, 0x3C, 0xCE, 0xD3, 0x1C, 0xCA, 0x02, 0x31, 0x95, 0x0E, 0xEF, 0xE0, 0x0E, 
+    0xFF, 0x01, 0x40, 0x0B, 0xFC, 0x74, 0x42, 0xDB, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x49, 0xA2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0xE4, 0xD8, 0x13, 0xA2, 0x83, 0xF5, 0x16, 0xD5, 0x61, 0xD2, 0x00, 0x58, 0x2D, 0xFA, 0xEB, 0x53, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x5A, 0x0D, 0xB1, 0xC0, 0x18, 0x8B, 
+    0xFF, 0x0C, 0x81, 0x78, 0xAD, 0x1E, 0x6D, 0xF6, 0x5C, 0x00, 0x68, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x97, 0x00, 0x49, 0x9C, 0x9C, 0x49, 0x17, 0x0F, 0xFF, 0x5B, 0x31, 0x61, 0x0A, 0x1D, 0x30, 0x00, 0xFF, 0x5E, 0x40, 0x03, 0x34, 0x00, 0x02, 0x20, 0x1E, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xBF, 0x3F, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x89, 0x00, 0x39, 0x91, 0x54, 0x89, 0x97, 0xA4, 
+    0xC4, 0x17, 0x98, 0x23, 0xF5, 0x03, 0x4D, 0xAC, 0x21, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0x00, 0xFF, 0x00, 0x89, 0x89, 0x98, 0x88, 0x89, 0x98, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0xFF, 0x00, 0x01, 0x10, 0x49, 0x21, 0x19, 0xDB, 0xFF, 0x12, 0x10, 0xAD, 0xF5, 0xA4, 0x6F, 0x3B, 0xB8, 0x00, 0xA6, 0xF4, 0x0E, 0x31, 0x97, 0x57, 
+    0x96, 0x00, 0x73, 0xA2, 0x26, 0xA0, 0xC3, 0x35, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0x90, 0xE4, 
+    0xFF, 0x00, 0x49, 0x14, 0x68, 0x80, 0x68, 0x8C, 0xC8, 0x06, 0x90, 0x34, 0xB2, 0xF5, 0xEF, 0xE4, 0xF2, 0x30, 0xF1, 0x10, 0x0F, 0xF1, 0xF0, 0x8E, 0xFF, 0x00, 0x3D, 0xD2, 0x23, 0x3D, 0xD2, 0x23, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xB9, 0x37, 0x8A, 0x99, 0x0E, 0x9E, 0x58, 0xF5, 0xC2, 0x34, 0xDB, 0x28, 0x01, 0x2D, 0x97, 0xBC, 0xCB, 0x00, 0xEC, 0x23, 0xF6, 0x10, 0x3D, 0xAC, 
+    0x1B, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0xC2, 0x0D, 0xAF, 0xF4, 0x0A, 0xEF, 0x10, 0x0F, 0x9B, 0x00, 0x73, 0x32, 0x27, 0xEA, 0x83, 0xF9, 0x92, 0x00, 0x89, 0x9F, 0xD8, 0x49, 0x77, 0x13, 
+    0xAE, 0x0D, 0x09, 0xFF, 0xFF, 0x64, 0x8F, 0x35, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x7B, 0x00, 0x00, 0x60, 0xC0, 0x0A, 0x35, 0xFF, 0x34, 0x00, 0x30, 0x72, 0xB5, 0xFB, 0x24, 
+    0xD1, 0x11, 0xF1, 0x00, 0x0F, 0xF3, 0xD0, 0x0D, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x39, 0x91, 0x57, 0xC0, 0x2C, 0xAA, 0xA0, 0xA6, 0xE0, 0x83, 0x39, 
+    0xF9, 0x00, 0xDB, 0x06, 0xB4, 0x7F, 0x9E, 0xDC, 0xBE, 0x19, 0x82, 0x1A, 0xAA, 0x6D, 0xCB, 0xAD, 0x46, 0x00, 0xCD, 0xD1, 0x1C, 0xCC, 0xD1, 0x5C, 0xC9, 0x40, 0x3D, 0x4B, 0x00, 0x6D, 0x91, 0x04, 
+    0xC0, 0x40, 0x24, 0x49, 0x80, 0x3C, 0xC9, 0x27, 0x48, 0x00, 0x78, 0x82, 0x27, 0x78, 0xA2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC4, 0x00, 0xC9, 0x9B, 0x97, 0x31, 0xF5, 0x0E, 0xF9, 0x18, 0xDC, 0x3A, 0x73, 0x7A, 0x89, 0xB8, 0xFF, 0x00, 0x4E, 0xF2, 0x24, 0x02, 0x30, 0x00, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x82, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xBC, 0x00, 0x58, 0x2F, 0x3A, 0xE3, 0xA3, 0x3F, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x5C, 0x00, 0x49, 0x92, 0xE4, 0x49, 0x98, 0x14, 
+    0xFF, 0x20, 0x71, 0xF7, 0x52, 0xA6, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xBF, 0x3F, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2C, 0x00, 0x49, 0x90, 0xA4, 0x49, 0x92, 0x24, 
+    0xC6, 0x21, 0x9D, 0xE8, 0x61, 0xA7, 0x96, 0x0E, 0x7E, 0x00, 0x4D, 0xC2, 0x27, 0x72, 0x02, 0x26, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x04, 0x88, 0x89, 0x98, 0x88, 0x89, 0x98, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x11, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x11, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7C, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 
+    0xC6, 0x00, 0x58, 0x93, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 
+    0xFF, 0x92, 0x00, 0x03, 0xA8, 0x00, 0x04, 0x00, 0xFF, 0x45, 0x4F, 0x5E, 0xBB, 0xDB, 0x06, 0x03, 0xF0, 0x1A, 0xED, 0xB0, 0x6E, 0x31, 0x19, 0xDB, 0xFF, 0x00, 0x3D, 0xD2, 0x2B, 0x3D, 0xD3, 0x36, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xC1, 0x00, 0x58, 0x2F, 0x3A, 0xA2, 0x23, 0x3A, 0x42, 0x00, 0x89, 0x91, 0x84, 0x49, 0x9A, 0x84, 0xBB, 0x5E, 0x86, 0xFE, 0xC1, 0x19, 0x9C, 0xC1, 
+    0x3C, 0x00, 0x4B, 0xA2, 0x24, 0x48, 0x82, 0x24, 0xA3, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xC3, 0x3D, 0xA0, 0x2F, 0x68, 0x9D, 0x94, 0xBB, 0xBD, 0x40, 0x37, 0x31, 0x41, 0xD2, 0x5A, 0x3F, 
+    0xA9, 0x00, 0x98, 0xB3, 0x3E, 0x75, 0xF2, 0x24, 0xFF, 0x00, 0x01, 0x10, 0xA0, 0x01, 0x1A, 0xBC, 0xFF, 0x37, 0x58, 0x8F, 0x39, 0xA0, 0x83, 0x39, 0x21, 0x00, 0x48, 0x9C, 0x24, 0x49, 0x92, 0x24, 
+    0xE7, 0x13, 0xEF, 0x10, 0x13, 0x31, 0x15, 0x53, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0x6A, 0x00, 0x49, 0x91, 0x7C, 0x49, 0x9C, 0x24, 0xB9, 0x18, 0xC2, 0x4A, 0x41, 0xE6, 0x94, 0xB7, 
+    0xB2, 0x4C, 0xC9, 0x3B, 0x4E, 0x00, 0xD6, 0xFA, 0xB6, 0x00, 0xC2, 0x8A, 0xF1, 0xA3, 0x53, 0x27, 0x08, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x71, 0x14, 0x43, 0x01, 0x14, 0x43, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x48, 0x00, 0x79, 0x82, 0x27, 0x79, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x83, 0x00, 0x49, 0x9E, 0xA4, 0x89, 0x97, 0x13, 0xFF, 0x4B, 0x31, 0xF5, 0x0E, 0x1D, 0x40, 0x49, 0xFF, 0x00, 0xC8, 0x8B, 0xC4, 0x48, 0xAE, 0x24, 0xFF, 0x2A, 0x1C, 0x60, 0x0A, 0xEF, 0x14, 0x77, 
+    0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0xA2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 
+    0xFF, 0x00, 0xE8, 0x83, 0x1E, 0xE8, 0xC1, 0x5E, 0xFF, 0x00, 0x49, 0x02, 0x00, 0x00, 0x20, 0x49, 0xFF, 0x00, 0x49, 0x02, 0x24, 0x40, 0x22, 0xE5, 0xDF, 0x00, 0xB9, 0x19, 0x73, 0xEF, 0x74, 0x0A, 
+    0xE8, 0x00, 0x43, 0x62, 0xDB, 0x24, 0xB9, 0x6D, 0xB4, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0xB4, 0x00, 0x49, 0x62, 0xDB, 0xDB, 0x08, 0x88, 0x20, 0x00, 0x49, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0xBF, 0x3F, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, 0x4D, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xBC, 0x00, 0xE9, 0x10, 0x53, 0x79, 0x97, 0x98, 0xC4, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x2F, 0xF1, 0xFF, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x88, 0x89, 0x98, 0x89, 0x99, 0x98, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x38, 0x02, 0x20, 0x49, 0x92, 0x24, 0x20, 0x00, 0x04, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xCF, 0x08, 0xA2, 0x83, 0xD5, 0xDA, 0x38, 0x4A, 0xBC, 0x00, 0x49, 0xFC, 0xBB, 0x2D, 0x27, 0x09, 0xC3, 0x2B, 0x95, 0x4A, 0xAC, 0x02, 0x8F, 0x39, 
+    0x33, 0x00, 0x48, 0xB2, 0x24, 0x4E, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x32, 0x00, 0xA7, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0x10, 0x9F, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x4B, 0x98, 0x03, 0xF5, 0xC0, 0x0A, 0x6B, 0xAB, 0x00, 0x4F, 0xE2, 0xDF, 0x23, 0x09, 0x09, 
+    0xDF, 0x2B, 0xF1, 0xF0, 0x0A, 0x1D, 0xB5, 0x53, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x2B, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x29, 0x00, 0x09, 0x91, 0x24, 0x49, 0x92, 0x24, 
+    0x33, 0x00, 0x80, 0x96, 0x24, 0x49, 0x92, 0x24, 0x0D, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x48, 0xFF, 0x10, 0x31, 0x16, 0x63, 0x31, 0x16, 0x6B, 
+    0x8A, 0x00, 0xE0, 0x03, 0x3E, 0xE0, 0x03, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9F, 0x00, 0xE9, 0x60, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x42, 0x26, 0x7F, 0x92, 0x24, 0x9F, 0x00, 0xE9, 0x90, 0x97, 0xC9, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0xA9, 0x90, 0x92, 0xF9, 0x9F, 0x24, 
+    0x9F, 0x00, 0xA0, 0x41, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x40, 0x40, 0x86, 0x7F, 0x9E, 0x24, 0x9F, 0x00, 0x26, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x48, 0x92, 0xFF, 0x9F, 0x24, 0x20, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 
+    0xBF, 0x3F, 0x21, 0x18, 0x82, 0x21, 0x18, 0x62, 0x9E, 0x00, 0x7D, 0xD2, 0xFF, 0x24, 0x09, 0x80, 0x21, 0x00, 0x49, 0xA2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x5F, 0x00, 0x49, 0x91, 0x7C, 0x49, 0x98, 0x24, 0xCE, 0x00, 0x13, 0x4D, 0xAC, 0xFF, 0x99, 0x24, 0x57, 0x00, 0x49, 0xE2, 0xD8, 0x8C, 0x91, 0x18, 0x9E, 0x00, 0x49, 0xF5, 0x57, 0x24, 0x09, 0x00, 
+    0xC8, 0x08, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB0, 0x00, 0x31, 0x11, 0x93, 0xF1, 0x1F, 0x13, 0x9C, 0x00, 0xA0, 0x40, 0x96, 0xE0, 0x2F, 0x26, 0xB3, 0x00, 0x00, 0xC4, 0x91, 0xB6, 0x9F, 0x24, 0x84, 0x00, 0x58, 0x43, 0x27, 0x4F, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x92, 0x84, 0x16, 0xF8, 0x03, 0x20, 
+    0xF2, 0x00, 0x30, 0x17, 0xB7, 0xF9, 0x9F, 0x24, 0x9F, 0x00, 0x2A, 0x42, 0x32, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x09, 0x90, 0x90, 0xC9, 0x9F, 0x24, 0x9F, 0x00, 0x27, 0x70, 0x92, 0xFF, 0x9F, 0x24, 
+    0x8A, 0x00, 0xE0, 0x33, 0x3E, 0xF6, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xDD, 0x00, 0xA6, 0xE0, 0xB6, 0xFE, 0x9F, 0x24, 0xDD, 0x00, 0xC0, 0xDA, 0xB6, 0xFF, 0x9F, 0x24, 0x21, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x57, 0x00, 0x89, 0x91, 0x18, 0x89, 0x9D, 0x24, 0x9A, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9A, 0x00, 0x50, 0x43, 0x36, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0x00, 0x78, 0x62, 0x23, 0x00, 0xB2, 0x4D, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDD, 0xD6, 0x61, 
+    0xD5, 0x00, 0x49, 0x6E, 0xA7, 0x4E, 0xE6, 0x04, 0xB0, 0x16, 0x49, 0xD2, 0xB6, 0xA7, 0x74, 0x02, 0x69, 0x00, 0x7F, 0xA2, 0x26, 0x68, 0x82, 0x26, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x92, 0x04, 0x01, 0x00, 0x00, 0x86, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBF, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x85, 0x00, 0x49, 0x92, 0xBC, 0x49, 0x97, 0x10, 0xBE, 0x00, 0x49, 0xD2, 0x3A, 0x5B, 0x0D, 0xCC, 0x2D, 0x00, 0x49, 0x9A, 0x04, 0x49, 0x90, 0x04, 0xAD, 0x16, 0x49, 0xD2, 0xB6, 0x94, 0x44, 0x80, 
+    0xD5, 0x16, 0x49, 0x62, 0xDB, 0xDB, 0x06, 0x00, 0x95, 0x00, 0xFF, 0xC3, 0x24, 0x48, 0x92, 0x24, 0xD5, 0x00, 0x49, 0x9E, 0xA4, 0x49, 0x96, 0x04, 0xAD, 0x16, 0x49, 0xD2, 0xB6, 0xA7, 0x74, 0x02, 
+    0x6C, 0x00, 0x7F, 0xA2, 0x26, 0x68, 0x82, 0x26, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0x33, 0x07, 0x53, 0xF6, 0x00, 0x49, 0x62, 0x27, 0xEC, 0xB1, 0x6A, 0xFF, 0x00, 0x3F, 0x62, 0x23, 0x00, 0xB2, 0xE9, 
+    0xC8, 0x00, 0x49, 0x9E, 0xBB, 0x2F, 0x57, 0x0A, 0xD6, 0x00, 0x7F, 0xD2, 0xDA, 0x1B, 0x09, 0x68, 0x79, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x02, 0x3E, 0xC0, 0x00, 0x49, 0x12, 0xDB, 0x99, 0x19, 0x98, 
+    0xD3, 0x01, 0x49, 0x62, 0xFB, 0x64, 0xAF, 0x15, 0xFF, 0x00, 0xC1, 0x11, 0x18, 0x00, 0xB0, 0x4D, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 
+    0x5D, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x10, 0xC2, 0x00, 0x49, 0x7E, 0xB7, 0xE5, 0x36, 0x01, 0xBF, 0x00, 0x7F, 0xD2, 0xD6, 0xDA, 0x08, 0x40, 0x82, 0x00, 0x49, 0xF2, 0x24, 0x74, 0x82, 0x39, 
+    0xC0, 0x00, 0x49, 0x92, 0xD8, 0xC9, 0x9C, 0xC0, 0xB0, 0x01, 0x49, 0xD2, 0xB6, 0xDC, 0x48, 0x88, 0xFF, 0x00, 0x09, 0xFE, 0xC0, 0x07, 0xA0, 0x6D, 0xFF, 0x15, 0x01, 0x60, 0x00, 0x00, 0x30, 0x01, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x00, 0x02, 0x1B, 0x00, 0xB0, 0x6D, 
+    0xD2, 0x00, 0x49, 0x12, 0xDB, 0x31, 0x09, 0x4F, 0xC0, 0x00, 0x49, 0x62, 0x3B, 0xDB, 0xB2, 0x22, 0xB0, 0x00, 0x31, 0x11, 0xB3, 0x31, 0x17, 0x13, 0xC5, 0x00, 0x6B, 0xB2, 0xBA, 0x2B, 0x27, 0x0A, 
+    0xD1, 0x00, 0x4F, 0xD2, 0xFA, 0x5B, 0x8F, 0xF5, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x86, 0x39, 0xFF, 0x18, 0x01, 0x60, 0x03, 0x12, 0x40, 0x4E, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0x71, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xC0, 0x00, 0x49, 0x92, 0xD8, 0xC9, 0x9C, 0xC0, 0xBA, 0x01, 0x49, 0x62, 0xDB, 0xDB, 0x38, 0x88, 0x1F, 0x00, 0x49, 0x82, 0xC4, 0x48, 0x8C, 0xC4, 0xC0, 0x01, 0x49, 0x62, 0xDB, 0xDD, 0xD6, 0x61, 
+    0x51, 0x00, 0x49, 0x22, 0x25, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18, 0xFF, 0x00, 0xD0, 0xA8, 0xD5, 0xA3, 0xBF, 0x3A, 0x95, 0x00, 0x9B, 0x60, 0x77, 0x49, 0x9A, 0xC4, 0xEA, 0x50, 0xA9, 0xDC, 0xCA, 0x26, 0x7C, 0xCA, 
+    0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xB0, 0x30, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 0xFF, 0x00, 0x7D, 0xD2, 0x27, 0x7D, 0xD2, 0x07, 0xFF, 0x00, 0x09, 0x10, 0x00, 0x07, 0x60, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x83, 0x00, 0x09, 0x91, 0x78, 0x49, 0x9C, 0x54, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xD3, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 
+    0x82, 0x00, 0x09, 0x91, 0x78, 0x49, 0x4C, 0x92, 0xB7, 0x00, 0xC0, 0xBC, 0xF5, 0xF6, 0x63, 0xDB, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xEC, 0x6C, 0x21, 0x12, 0x22, 0x21, 0x12, 0x22, 
+    0xFF, 0x00, 0x00, 0x02, 0x24, 0x48, 0x82, 0xE4, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0x60, 0x07, 0xEC, 0x2D, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xFF, 0x30, 0x88, 0x85, 0x98, 0x88, 0x85, 0x98, 0xC4, 0x00, 0xE2, 0x88, 0xD5, 0xA2, 0x23, 0x3E, 0xBA, 0x00, 0x9C, 0xEC, 0x0E, 0x31, 0x95, 0x53, 
+    0xFF, 0x34, 0xA6, 0xD0, 0x01, 0x1A, 0x20, 0x07, 0xFF, 0x18, 0x05, 0x74, 0x00, 0x00, 0x80, 0x18, 0xBE, 0x00, 0xE2, 0x03, 0x3A, 0x98, 0x83, 0x39, 0xFF, 0x00, 0xC1, 0x1B, 0xBC, 0xC1, 0x1B, 0xBC, 
+    0xF7, 0x2E, 0xA0, 0x09, 0xD1, 0x58, 0x0F, 0x3A, 0x90, 0x00, 0x92, 0xD0, 0x76, 0x4F, 0x9A, 0xC4, 0xFF, 0x66, 0x14, 0xE0, 0x01, 0x27, 0xF2, 0x2A, 0xFF, 0x00, 0x40, 0x02, 0x24, 0x47, 0x72, 0x24, 
+    0xCA, 0x00, 0x79, 0x17, 0x53, 0xEF, 0xF0, 0x0E, 0xB7, 0x00, 0xC0, 0x86, 0xD5, 0xEA, 0x33, 0x27, 0xB4, 0x00, 0x9C, 0x60, 0x73, 0x89, 0x99, 0xA4, 0xC3, 0x18, 0xA2, 0x03, 0xF1, 0xC3, 0x4C, 0xAC, 
+    0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0xFE, 0xE0, 0xFE, 0x65, 0x6F, 0x73, 0xB5, 0x07, 0x7D, 0xF5, 0xA6, 0x00, 0xD0, 0xB6, 0xDA, 0x7D, 0xE2, 0x24, 0xF5, 0x00, 0x9C, 0xE0, 0x52, 0x37, 0x97, 0x77, 
+    0xFF, 0xE3, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0xA0, 0xFF, 0x40, 0x80, 0x08, 0xD1, 0x58, 0x8F, 0x39, 0x8B, 0x00, 0x90, 0xC4, 0xB6, 0x4E, 0x9E, 0x24, 
+    0xE7, 0x1E, 0x34, 0x65, 0x52, 0xEF, 0x10, 0x53, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x97, 0x0F, 0x61, 0x0B, 0x2E, 0x20, 0x00, 
+    0xD9, 0x05, 0x64, 0x6F, 0xFB, 0x49, 0x8E, 0xF5, 0xFF, 0x00, 0x01, 0x10, 0xA0, 0x01, 0x90, 0x04, 0xFF, 0x38, 0x58, 0x0D, 0x3A, 0x58, 0x0F, 0xB1, 0xB8, 0x20, 0xED, 0x90, 0x57, 0x7F, 0xCB, 0xD6, 
+    0xE2, 0x22, 0x00, 0xB0, 0x6D, 0xB6, 0x9D, 0x24, 0xC0, 0x00, 0x49, 0x12, 0xDB, 0x49, 0x97, 0x14, 0xC0, 0x28, 0xA9, 0xF4, 0x4A, 0xA4, 0x04, 0x00, 0xC0, 0x01, 0x74, 0x42, 0xDB, 0xDB, 0x06, 0xAC, 
+    0xFF, 0x00, 0x09, 0xEC, 0xC0, 0x0C, 0xBC, 0xC0, 0xDF, 0x5F, 0x07, 0x73, 0x30, 0x07, 0x73, 0x30, 0x1F, 0x00, 0x48, 0x8C, 0xC4, 0x48, 0x8C, 0xC4, 0xC6, 0x47, 0x29, 0x98, 0x82, 0x29, 0x98, 0x82, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x78, 0x81, 0x17, 0x00, 0x10, 0x00, 0xE7, 0x00, 0xA2, 0x23, 0x3A, 0x62, 0x8F, 0xB1, 0x6D, 0x00, 0x49, 0x9C, 0xC4, 0xC9, 0x49, 0x0E, 0xEE, 0x5A, 0xA9, 0x9C, 0xCA, 0x27, 0xDC, 0xCA, 
+    0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xE9, 0x30, 0xF1, 0x16, 0x6F, 0xF1, 0x16, 0x43, 0xFB, 0x29, 0x0E, 0x60, 0x6D, 0x66, 0x4B, 0x3F, 0xFF, 0x3B, 0x00, 0xC0, 0x09, 0x2E, 0x95, 0x77, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x5B, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x99, 0x6C, 0x09, 0x90, 0x00, 
+    0xFF, 0x30, 0x6D, 0xBC, 0xC5, 0x40, 0x0C, 0xC4, 0xB0, 0x29, 0x5B, 0x03, 0x34, 0x40, 0x03, 0x34, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xEC, 0x00, 0x1D, 0xDA, 0xA1, 0xDD, 0xD2, 0x2D, 
+    0xC9, 0x00, 0xC9, 0x9D, 0x9B, 0x37, 0x65, 0x0E, 0xFF, 0x75, 0xF9, 0x6F, 0x92, 0x04, 0x00, 0x00, 0xFF, 0x00, 0x64, 0xB0, 0x05, 0x40, 0x00, 0x04, 0xEC, 0x2D, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xFF, 0x30, 0x88, 0x89, 0x98, 0x88, 0x89, 0x98, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x03, 0x3A, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 
+    0xFF, 0x34, 0x72, 0x20, 0x07, 0x72, 0x20, 0x07, 0xFF, 0x18, 0x88, 0x81, 0x18, 0x88, 0x81, 0x18, 0xBE, 0x00, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0xFF, 0x00, 0xC1, 0x1B, 0xBC, 0xC1, 0x1B, 0xBC, 
+    0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x31, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xF1, 0x68, 0x21, 0x12, 0x22, 0x21, 0x12, 0x22, 0xFF, 0x00, 0x47, 0x72, 0x24, 0x47, 0x72, 0x24, 
+    0xC5, 0x0A, 0xAF, 0xF4, 0x0A, 0xEF, 0x10, 0x0F, 0xA3, 0x00, 0x73, 0xB2, 0x26, 0xEA, 0x83, 0xF5, 0x73, 0x00, 0x49, 0x98, 0x84, 0x89, 0x77, 0x13, 0xCB, 0x3F, 0xD5, 0x5E, 0xED, 0x04, 0x3F, 0x35, 
+    0xFF, 0x00, 0x0F, 0xFE, 0xE0, 0x0F, 0x9E, 0xE0, 0xF7, 0x6B, 0x51, 0x13, 0x35, 0x01, 0x9F, 0xCE, 0x61, 0x00, 0x4D, 0xD2, 0x24, 0x7B, 0x02, 0xDA, 0xC2, 0x00, 0x79, 0x95, 0x53, 0x31, 0xE5, 0x0E, 
+    0xFF, 0x79, 0x0B, 0xB0, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x00, 0xC1, 0x1B, 0xA0, 0x01, 0x10, 0x00, 0xFF, 0x37, 0xA0, 0x83, 0x39, 0x58, 0x0F, 0xD1, 0x3A, 0x00, 0x49, 0x92, 0x24, 0x4E, 0x82, 0x76, 
+    0xF3, 0x13, 0x31, 0x15, 0x53, 0x2F, 0xE5, 0x0E, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 0xFF, 0x29, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 
+    0xFF, 0x1A, 0xA2, 0x23, 0x3A, 0xA0, 0x03, 0x20, 0x72, 0x00, 0x49, 0x92, 0xFC, 0x49, 0x99, 0x14, 0xFF, 0x09, 0x80, 0x96, 0x04, 0xB6, 0x4D, 0x92, 0xFF, 0x48, 0x64, 0x0D, 0x6D, 0x01, 0x64, 0xA7, 
+    0xC2, 0x00, 0x74, 0x32, 0x3A, 0xA0, 0x83, 0x39, 0x80, 0x00, 0x09, 0x11, 0x92, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x1B, 0xF0, 0x02, 0x29, 0x90, 0x02, 0x80, 0x00, 0x00, 0x20, 0x92, 0x6A, 0xA2, 0x26, 
+    0xFF, 0x00, 0x0C, 0xEC, 0xC0, 0x09, 0x9C, 0x00, 0xFF, 0x5F, 0x57, 0x73, 0x35, 0x57, 0x03, 0xF1, 0x3C, 0x00, 0x4C, 0xCE, 0xE4, 0x4C, 0x8C, 0x56, 0xDD, 0x47, 0xA9, 0x9A, 0xAA, 0xA9, 0x6A, 0xA2, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x49, 0x90, 0x24, 0xFF, 0xDF, 0xB6, 0xFF, 0x00, 0xD0, 0x18, 0x48, 0xFF, 0xD1, 0x3A, 0xFF, 0x00, 0x2D, 0xB9, 0x4D, 0x00, 0x6E, 0xE4, 0xD5, 0x54, 0xA9, 0x9A, 0xAA, 0xA9, 0x1A, 0xC2, 
+    0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 0xF5, 0x30, 0x31, 0x16, 0x8F, 0xF1, 0x18, 0x8F, 0x7C, 0x00, 0xE0, 0xA3, 0x26, 0x72, 0x22, 0x27, 0xB9, 0x00, 0xF1, 0x10, 0x13, 0x31, 0x11, 0x13, 
+    0xFF, 0x26, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 
+    0xFF, 0x30, 0x40, 0x0C, 0xC4, 0x40, 0x0C, 0xC4, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC7, 0x3C, 0x96, 0x62, 0xC9, 0x96, 0x69, 0x11, 
+    0xC4, 0x3D, 0x5E, 0x33, 0xCC, 0x18, 0x38, 0x47, 0xFF, 0x00, 0x49, 0xF0, 0x24, 0x7E, 0x52, 0x27, 0xFF, 0x00, 0x40, 0x10, 0x04, 0x49, 0x90, 0x04, 0xEC, 0x2D, 0x31, 0x16, 0x63, 0x31, 0x16, 0x63, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xFF, 0x30, 0x88, 0xA9, 0x98, 0x8C, 0x69, 0xDB, 0xA9, 0x00, 0xA0, 0x03, 0x3A, 0xA0, 0x43, 0x3A, 0xA4, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x93, 
+    0xFF, 0x34, 0x72, 0x20, 0x47, 0x74, 0x68, 0xDB, 0xFF, 0x18, 0x88, 0xA1, 0x58, 0x8C, 0xE9, 0xD8, 0xBE, 0x00, 0x98, 0x83, 0x39, 0x9A, 0x43, 0x3A, 0xFF, 0x00, 0xC1, 0x1B, 0xBD, 0xE1, 0x9B, 0xB6, 
+    0xB0, 0x29, 0x40, 0x03, 0x34, 0x52, 0xD3, 0x36, 0x31, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xF1, 0x60, 0x27, 0x72, 0x36, 0x6F, 0x93, 0x24, 0xFF, 0x00, 0x47, 0x72, 0x25, 0x67, 0xD2, 0x26, 
+    0x9A, 0x00, 0xF1, 0x90, 0x77, 0xC9, 0x9B, 0xE4, 0xC7, 0x33, 0x58, 0x3D, 0x68, 0xE5, 0x94, 0xBB, 0xBE, 0x4C, 0x7F, 0xB7, 0x09, 0xD2, 0x68, 0x3F, 0xC6, 0x00, 0x58, 0x3F, 0x3A, 0xF4, 0xE3, 0x24, 
+    0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xE0, 0xB0, 0x69, 0x87, 0x72, 0x28, 0x87, 0x72, 0x28, 0xFF, 0x00, 0xAC, 0xBD, 0x91, 0x97, 0xF4, 0xA0, 0xFF, 0x66, 0x79, 0x55, 0x0A, 0x02, 0x70, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0x94, 0x50, 0x03, 0xA8, 0x00, 0x00, 0x00, 0xFF, 0x56, 0x4F, 0xDE, 0xB6, 0xDA, 0x84, 0x03, 
+    0xC7, 0x11, 0xD4, 0x20, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x23, 0xB0, 0x00, 0x31, 0x11, 0x13, 0x31, 0x15, 0x93, 0xFF, 0x29, 0x70, 0x40, 0x47, 0x74, 0x68, 0xDB, 
+    0xFF, 0x60, 0x00, 0x20, 0x49, 0x6D, 0x9B, 0x24, 0x69, 0x00, 0x49, 0x91, 0x78, 0x49, 0x9A, 0x24, 0xED, 0x2B, 0x94, 0xD4, 0x09, 0x2E, 0x97, 0xDB, 0xFF, 0x4F, 0x03, 0x64, 0x89, 0x64, 0xFD, 0x3F, 
+    0xB5, 0x00, 0x98, 0x23, 0x3A, 0x74, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x29, 0x90, 0x02, 0x29, 0x90, 0x02, 0x71, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 
+    0xFF, 0x00, 0x09, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFF, 0x95, 0x00, 0x03, 0xA8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xB5, 0x3B, 0x92, 0x9A, 0x84, 0x22, 0xD1, 0x34, 0x24, 0x78, 0x8A, 0xE9, 0x18, 0xDB, 
+    0x51, 0x00, 0x78, 0x82, 0x27, 0x78, 0x82, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0xA9, 0x49, 0xB2, 0x6D, 0x00, 0x00, 0x00, 0xFF, 0x18, 0xAC, 0x23, 0xD6, 0x18, 0x0B, 0x68, 0xCA, 0x00, 0x49, 0x6C, 0xBB, 0x24, 0x27, 0x09, 0xFF, 0x68, 0xA9, 0x60, 0x02, 0x14, 0xA0, 0x03, 
+    0xFF, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00, 0x44, 0xB0, 0x30, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, 0x69, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB1, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x13, 
+    0xFF, 0x28, 0x70, 0x00, 0x07, 0x70, 0x40, 0x47, 0x70, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0xFF, 0x00, 0x09, 0x90, 0x04, 0x49, 0x92, 0x24, 
+    0xFF, 0x27, 0x40, 0x0C, 0xC4, 0x40, 0x1C, 0xC4, 0xB0, 0x29, 0x40, 0x03, 0x34, 0x40, 0x03, 0x34, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x04, 0xC9, 0x6C, 0x19, 0x98, 0x2D, 0xD9, 0x92, 0x2D, 
+    0xFF, 0x00, 0x75, 0xE4, 0x07, 0x0F, 0xF0, 0x48, 0xDF, 0x00, 0xEB, 0x23, 0xFA, 0x58, 0x0D, 0xAD, 0xFF, 0x00, 0x49, 0x90, 0x04, 0x49, 0xF0, 0x44, 0xEC, 0x2D, 0x31, 0x16, 0x63, 0x31, 0x16, 0x6F, 
+    0x6C, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0xA9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xD0, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x09, 0x9E, 0xE0, 0x09, 0x9E, 0xEC, 0xB0, 0x69, 0x87, 0x72, 0x28, 0x87, 0x72, 0x28, 0xFF, 0x00, 0x4F, 0xFE, 0x04, 0x4F, 0xF2, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 
+    0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0xFF, 0xFF, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x38, 0x02, 0x24, 0x48, 0x92, 0x24, 
+    0xD0, 0x11, 0xF1, 0x10, 0x0F, 0xF1, 0x10, 0x0F, 0xFF, 0x00, 0x34, 0x42, 0x23, 0x34, 0x42, 0x2F, 0x20, 0x00, 0x01, 0x90, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x30, 0x00, 0xE9, 0x90, 0x24, 0x49, 0x92, 0x24, 0x33, 0x00, 0xC0, 0x9A, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xB1, 0x28, 0x29, 0x90, 0x02, 0x29, 0x90, 0xB6, 0x71, 0x00, 0x68, 0x82, 0x26, 0x68, 0xA2, 0x26, 
+    0xFF, 0x00, 0x09, 0x90, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x38, 0x02, 0x24, 0x49, 0x92, 0x24, 0x20, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x20, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0xE0, 0x1A, 0xFF, 0x91, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x40, 0x08, 0xA4, 0x40, 0x9E, 0x24, 0x9E, 0x00, 0x1E, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x69, 0x00, 0x68, 0xA2, 0x26, 0x76, 0x92, 0x24, 0x9F, 0x00, 0xF1, 0x10, 0x93, 0xF9, 0x9F, 0x24, 
+    0x9F, 0x00, 0x98, 0x41, 0x92, 0xFF, 0x9F, 0x24, 0x70, 0x00, 0x49, 0x91, 0x54, 0x89, 0x9D, 0x24, 0x9F, 0x00, 0xC0, 0x4C, 0xD2, 0xFF, 0x9F, 0x24, 0x17, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x04, 
+    0xFF, 0x30, 0x71, 0x9C, 0xC6, 0xEF, 0xFC, 0x0A, 0xE6, 0x28, 0x9B, 0xB3, 0x39, 0x9B, 0x83, 0x39, 0x2D, 0x00, 0x49, 0x90, 0x04, 0x49, 0x90, 0x24, 0xAD, 0x00, 0x04, 0x48, 0x92, 0xFF, 0x9F, 0x24, 
+    0x9F, 0x00, 0x0E, 0xE0, 0x84, 0xCE, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x46, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x7D, 0x40, 0x87, 0x7F, 0x9E, 0x24, 0x9F, 0x00, 0x1E, 0x40, 0x92, 0xFF, 0x9F, 0x24, 
+    0x6C, 0x00, 0x68, 0xA2, 0x26, 0x76, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x86, 0x00, 0x09, 0x9A, 0x90, 0x49, 0x92, 0x24, 0x86, 0x00, 0x02, 0x44, 0x92, 0x49, 0x92, 0x24, 0x29, 0x00, 0x48, 0x82, 0x24, 0x4F, 0x92, 0x24, 0xFF, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0xFF, 0x00, 0x00, 0x10, 0x00, 0x09, 0x90, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x92, 0x24, 0xFF, 0x00, 0x40, 0x82, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x86, 0x00, 0x27, 0x70, 0x92, 0x49, 0x92, 0x24, 0x86, 0x00, 0x00, 0x42, 0x32, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x28, 0x00, 0x90, 0x94, 0x24, 0x49, 0x92, 0x24, 0x31, 0x00, 0x43, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x3B, 0x00, 0x49, 0x98, 0x44, 0x49, 0x90, 0x1C, 
+    0xFF, 0x4C, 0xAF, 0x71, 0x6A, 0x6E, 0x9B, 0x3C, 0xD2, 0x00, 0x58, 0x2F, 0x3A, 0xEC, 0xE3, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -959,24 +2231,62 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x9C, 0x00, 0x49, 0x92, 0x24, 0x55, 0xE0, 0xB6, 0x78, 0x00, 0x49, 0x92, 0x24, 0x71, 0x02, 0x26, 0x36, 0x00, 0x49, 0x92, 0x24, 0x49, 0x98, 0x04, 0x95, 0x00, 0x49, 0x92, 0x24, 0x41, 0xD4, 0xB6, 
+    0x74, 0x00, 0x49, 0x92, 0x24, 0x4B, 0xD1, 0x98, 0x80, 0x00, 0x49, 0x92, 0x24, 0x49, 0x42, 0x82, 0x2B, 0x00, 0x49, 0x92, 0x24, 0x49, 0xF8, 0x04, 0x91, 0x00, 0x49, 0x92, 0x24, 0x81, 0xB2, 0x96, 
+    0x1C, 0x00, 0x49, 0x92, 0x24, 0x49, 0xBC, 0x04, 0x89, 0x00, 0x49, 0x92, 0x24, 0x41, 0xB2, 0x16, 0x6A, 0x00, 0x49, 0x92, 0x24, 0x72, 0xC0, 0x87, 0x7A, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x12, 
+    0x46, 0x00, 0x6F, 0x9D, 0x24, 0x49, 0x02, 0x27, 0x77, 0x00, 0x49, 0x92, 0x24, 0x79, 0x90, 0x92, 0x8D, 0x00, 0x49, 0x92, 0x24, 0x89, 0x58, 0xD4, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x12, 0x00, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x20, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x06, 
+    0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0x41, 0x00, 0x49, 0x92, 0x24, 0x49, 0x02, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x49, 0xE0, 0x04, 
+    0xFF, 0x00, 0x49, 0x92, 0x24, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x80, 0x08, 0xD8, 0x60, 0x00, 0x49, 0x92, 0x24, 0x70, 0x02, 0x27, 0xA5, 0x00, 0x49, 0x92, 0x24, 0xA7, 0x70, 0xDA, 
+    0x66, 0x00, 0x49, 0x92, 0x24, 0x68, 0x82, 0x26, 0x48, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 0x44, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3B, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x14, 0x56, 0x00, 0x49, 0x92, 0x24, 0xF7, 0x03, 0x68, 0x23, 0x00, 0x49, 0x92, 0x24, 0x49, 0xAA, 0x04, 0x4D, 0x00, 0x49, 0x92, 0x24, 0xFF, 0x0F, 0x00, 
+    0x4D, 0x00, 0x49, 0x92, 0x24, 0x4F, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0xB4, 0x00, 0xAF, 0x16, 0x0F, 0x39, 0x95, 0x77, 0xBF, 0x00, 0xEB, 0x23, 0x3A, 0x58, 0x03, 0xF5, 0x95, 0x00, 0xC9, 0x99, 0x78, 0x49, 0x95, 0x13, 0xC0, 0x0F, 0xDB, 0x2A, 0xD0, 0x50, 0x8F, 0x39, 
+    0x4D, 0x00, 0xCD, 0x91, 0x64, 0x49, 0x9A, 0xC4, 0xC7, 0x4E, 0x45, 0x63, 0xCD, 0x9F, 0x9A, 0x82, 0x79, 0x00, 0x4E, 0xD8, 0x7C, 0x8C, 0xB5, 0x13, 0xCC, 0x52, 0x6E, 0x4F, 0xC8, 0xE3, 0x2B, 0x86, 
+    0x6B, 0x00, 0x4D, 0xCA, 0x84, 0xBB, 0x25, 0x17, 0xC4, 0x37, 0xA5, 0x4A, 0xCC, 0x03, 0x2F, 0x35, 0x38, 0x00, 0x48, 0xB8, 0x24, 0x4E, 0x92, 0x24, 0xC2, 0x00, 0x1D, 0x66, 0x0A, 0x37, 0x95, 0x77, 
+    0xBB, 0x00, 0x74, 0xB2, 0x3E, 0x58, 0x0D, 0xB1, 0xBE, 0x1E, 0xF1, 0x68, 0x4A, 0x1D, 0x36, 0xAC, 0x9D, 0x00, 0x98, 0xB3, 0x3E, 0x7C, 0xE2, 0x24, 0xFF, 0x00, 0x21, 0x99, 0x6D, 0x01, 0x10, 0x00, 
+    0xFF, 0x16, 0xAD, 0x33, 0xFA, 0x58, 0x0F, 0xD1, 0xFF, 0x00, 0x09, 0x99, 0x6C, 0x09, 0xF0, 0x04, 0xFF, 0x3E, 0xB6, 0xBD, 0xD1, 0x58, 0x0F, 0x3A, 0xC0, 0x00, 0x4D, 0xE6, 0x04, 0x4F, 0x96, 0xC4, 
+    0xC0, 0x40, 0x24, 0x09, 0x0F, 0x24, 0x99, 0x24, 0xC0, 0x40, 0x24, 0x09, 0x00, 0x24, 0x99, 0xC4, 0xCE, 0x80, 0x49, 0x22, 0xE9, 0x29, 0x6E, 0xE0, 0xFF, 0x00, 0x4E, 0xE0, 0x04, 0x4E, 0xE0, 0x04, 
+    0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x32, 0x68, 0x8B, 0x91, 0xA2, 0xBD, 0x3E, 0x60, 0x00, 0x70, 0x02, 0x27, 0x70, 0x42, 0x27, 0xA5, 0x15, 0x29, 0x99, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0xB2, 0x32, 0xDB, 0x06, 0x0B, 0x24, 0x99, 0xE4, 0xC5, 0x14, 0xAC, 0x03, 0xF5, 0x03, 0x4D, 0xCC, 0x07, 0x00, 0x49, 0x92, 0x24, 0x4B, 0x82, 0x24, 
+    0xC6, 0x00, 0x79, 0x19, 0x53, 0xEF, 0xF0, 0x4E, 0xFF, 0x6A, 0xB6, 0xB3, 0xB2, 0x0A, 0xD4, 0x16, 0xFC, 0x17, 0x7E, 0xC2, 0xFA, 0x23, 0x0B, 0x69, 0xFF, 0x56, 0xB7, 0x73, 0x6E, 0x1D, 0x30, 0x00, 
+    0xFF, 0x00, 0x4F, 0xA2, 0x24, 0x48, 0x82, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x6C, 0x00, 0x49, 0x91, 0x58, 0x49, 0x98, 0xC4, 0xC9, 0x3B, 0x53, 0x43, 0xF0, 0xD5, 0xEC, 0xA9, 0xC4, 0x00, 0x31, 0xF5, 0x0E, 0xA6, 0x64, 0x62, 0xA7, 0x00, 0x98, 0x23, 0x3E, 0x73, 0xC2, 0x27, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xC8, 0x00, 0xA6, 0xF4, 0x4A, 0xEF, 0x10, 0x53, 0xC2, 0x2A, 0x8D, 0xC7, 0x77, 0x33, 0xB5, 0x12, 0xEB, 0x0C, 0xA2, 0xB7, 0x5E, 0xEC, 0x45, 0x07, 
+    0xB9, 0x38, 0xCD, 0xC9, 0x7B, 0x73, 0xA5, 0x12, 0xC3, 0x00, 0x50, 0x8F, 0xF5, 0xA2, 0xA3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x63, 0x00, 0x49, 0x91, 0x9C, 0x49, 0x9C, 0xA4, 
+    0xCB, 0x4F, 0x04, 0xED, 0x89, 0xA9, 0x70, 0x4A, 0xBB, 0x00, 0x12, 0x8D, 0xF5, 0xA2, 0x23, 0x3A, 0x0D, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 
+    0xFF, 0x6D, 0x50, 0x03, 0xF0, 0xC0, 0x0C, 0xA8, 0xFF, 0x00, 0x4F, 0xE0, 0x04, 0x7D, 0xD4, 0x47, 0xDA, 0x00, 0x58, 0x2F, 0xFA, 0xA2, 0xB3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x3F, 0x00, 0x49, 0x92, 0x24, 0x49, 0x9A, 0x1C, 0xFF, 0x00, 0x79, 0x79, 0x73, 0xEE, 0x54, 0x0A, 0xFF, 0x00, 0x83, 0x28, 0x80, 0x00, 0x88, 0x24, 0xFF, 0x00, 0x4E, 0xE0, 0xE4, 0x49, 0x9E, 0xE4, 
+    0xFF, 0x3C, 0x40, 0x7C, 0xC4, 0x6F, 0xFC, 0xC6, 0xCE, 0x0F, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0x91, 0x1C, 0xC5, 0x47, 0x05, 0x53, 0x30, 0x05, 0x53, 0x30, 0x07, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
+    0x6C, 0x00, 0x16, 0xE0, 0xB6, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x7D, 0xF1, 0xFF, 0x49, 0x92, 0x24, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x90, 0x24, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x24, 
+    0xFF, 0x00, 0x48, 0x82, 0x24, 0x48, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x0D, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 0xBE, 0x01, 0x1D, 0x64, 0x4A, 0xEF, 0x10, 0x13, 0xBE, 0x36, 0x1E, 0x58, 0xA9, 0x04, 0x3F, 0x35, 0x45, 0x00, 0x78, 0xC2, 0x24, 0x4E, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA0, 0x00, 0x31, 0x91, 0x53, 0x49, 0x97, 0x98, 0xDE, 0x73, 0x4C, 0xB9, 0xB3, 0xF4, 0x5E, 0x30, 0xFF, 0x00, 0x7D, 0xD0, 0x07, 0x4E, 0xE0, 0x48, 
+    0xE0, 0x83, 0xCB, 0xA7, 0xBB, 0x70, 0x0D, 0x2C, 0x85, 0x00, 0xE0, 0xA3, 0x26, 0x73, 0xC2, 0x27, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xBD, 0x00, 0xC9, 0x9B, 0x98, 0x31, 0xF5, 0x0E, 
+    0xBF, 0x26, 0xC4, 0x26, 0xB1, 0x98, 0xBD, 0x3E, 0xC7, 0x2C, 0x98, 0x33, 0xD1, 0x94, 0xEA, 0x61, 0x64, 0x00, 0x49, 0xE2, 0x24, 0x7B, 0x82, 0x26, 0xFF, 0x00, 0x01, 0x10, 0x00, 0x49, 0x90, 0x24, 
+    0xFF, 0x00, 0x00, 0x06, 0x40, 0x00, 0x90, 0x04, 0xC8, 0x0F, 0x73, 0xB4, 0x5E, 0x22, 0x86, 0x89, 0x7E, 0x00, 0x60, 0x22, 0x27, 0x7C, 0xD2, 0x24, 0x15, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x04, 
+    0xDD, 0x00, 0x89, 0x9B, 0x77, 0x2F, 0x65, 0x0E, 0xFD, 0x00, 0x14, 0xB2, 0xFF, 0x6D, 0x4B, 0x92, 0xA1, 0x00, 0x49, 0xF2, 0xFF, 0x24, 0x09, 0x40, 0x4E, 0x00, 0x49, 0xDC, 0xC7, 0x78, 0x8C, 0xC7, 
+    0xFF, 0x56, 0xE9, 0x9C, 0x0E, 0xE9, 0x96, 0xD2, 0xCE, 0x00, 0x58, 0x8F, 0x35, 0xA2, 0xC3, 0x3E, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0xC9, 0x91, 0x04, 0x49, 0x96, 0xA4, 0xC5, 0x47, 0x05, 0x53, 0xF0, 0x9E, 0x18, 0x13, 0x9F, 0x00, 0x49, 0x62, 0x3F, 0xE3, 0x03, 0x3E, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -985,6 +2295,14 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x9A, 0x00, 0x31, 0x91, 0x97, 0xC9, 0x9F, 0x24, 0x9F, 0x00, 0x10, 0x4F, 0x36, 0xFF, 0x93, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x51, 0x00, 0x89, 0x91, 0x64, 0x49, 0x9A, 0x24, 0x9F, 0x00, 0x02, 0x48, 0xB2, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x4E, 0xF0, 0x84, 0xC9, 0x9F, 0x24, 
+    0x9F, 0x00, 0x00, 0x46, 0x92, 0xFF, 0x9F, 0x24, 0x32, 0x00, 0x48, 0xC2, 0x24, 0x4F, 0x92, 0x24, 0x5B, 0x00, 0x49, 0x9E, 0x84, 0x49, 0x90, 0x24, 0xD3, 0x00, 0xA6, 0xD4, 0x61, 0xFB, 0x9F, 0x24, 
+    0x78, 0x00, 0xE0, 0x33, 0x27, 0x4D, 0x92, 0x24, 0xBC, 0x00, 0xA6, 0xF0, 0x8E, 0xF9, 0x97, 0x24, 0xAC, 0x00, 0xEA, 0x83, 0xF5, 0x3F, 0x9D, 0x24, 0x37, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x00, 
+    0x7E, 0x00, 0x49, 0x9A, 0x9C, 0x89, 0xD5, 0x12, 0xD5, 0x19, 0xC5, 0x4A, 0xD1, 0x5B, 0x2F, 0x3A, 0x22, 0x00, 0x48, 0xE2, 0x24, 0x49, 0x92, 0x24, 0x9F, 0x00, 0x49, 0x90, 0x84, 0x49, 0x9E, 0x24, 
+    0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x40, 0x92, 0xFF, 0x9F, 0x24, 0x9F, 0x00, 0x00, 0x44, 0x92, 0xFF, 0x9F, 0x24, 0x4E, 0x00, 0x78, 0x8C, 0xC7, 0x7D, 0x9E, 0x24, 
+    0xB5, 0x00, 0x9D, 0xD0, 0x72, 0x89, 0x97, 0x78, 0xFF, 0x00, 0x7E, 0x32, 0x24, 0x83, 0x33, 0x38, 0xFF, 0x00, 0x49, 0x92, 0x24, 0x48, 0x82, 0x27, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0x49, 0x96, 0x04, 0xC9, 0x91, 0x1C, 0xC5, 0x47, 0x9E, 0x56, 0xD0, 0x05, 0x53, 0x30, 0x89, 0x00, 0x98, 0x43, 0x3A, 0x4F, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -996,7 +2314,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x7D, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x94, 
+    0xC0, 0x44, 0x2D, 0x05, 0x40, 0x1C, 0xFB, 0x3F, 0xAF, 0x00, 0x98, 0xA3, 0x3E, 0x74, 0xE2, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7C, 0x00, 0x49, 0x91, 0x14, 0x49, 0x91, 0x14, 0xFF, 0x0F, 0x83, 0x33, 0x20, 0x03, 0x32, 0x28, 0x60, 0x00, 0x70, 0x02, 0x27, 0x70, 0x62, 0x27, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x0A, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x46, 0x00, 0xC9, 0x91, 0x1C, 0xC9, 0xD1, 0x16, 0xC5, 0x47, 0x05, 0x53, 0x30, 0x05, 0x53, 0x30, 0x07, 0x00, 0x48, 0x82, 0x24, 0x48, 0x82, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -1008,7 +2330,11 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x09, 0x00, 0x49, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x17, 0x00, 0x82, 0x9C, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x7B, 0x00, 0x49, 0x91, 0x54, 0xC9, 0x99, 0xC4, 0xF9, 0x3F, 0x83, 0xCE, 0x91, 0x6E, 0x9B, 0xFF, 0x60, 0x00, 0x70, 0x02, 0x27, 0x70, 0x02, 0x27, 0xA5, 0x15, 0xA9, 0x90, 0x0A, 0xA9, 0x90, 0x92, 
+    0x66, 0x00, 0x68, 0x82, 0x26, 0x68, 0x82, 0x26, 0x9E, 0x57, 0xFF, 0x8F, 0x08, 0x88, 0x90, 0x24, 0xC5, 0x00, 0xC3, 0x2C, 0xD1, 0x63, 0x5F, 0x3F, 0x06, 0x00, 0x48, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
@@ -1023,6 +2349,8 @@ static const uint8_t default_font_atlas[] =
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
+    0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x17, 0x90, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x2E, 0x00, 0x05, 0x90, 0x24, 0x49, 0x92, 0x24, 
+    0x2E, 0x00, 0x50, 0x92, 0x24, 0x49, 0x92, 0x24, 0x1B, 0x00, 0x00, 0x90, 0x24, 0x49, 0x92, 0x24, 0x17, 0x00, 0x68, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
     0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x00, 0x00, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 
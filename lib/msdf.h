@@ -0,0 +1,492 @@
+#ifndef __MSDF_H__
+#define __MSDF_H__
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Multi-channel signed distance field of a glyph, a simplified version of Chlumsky's msdfgen
+//      * the contours come from stbtt_GetGlyphShape(), the lines and the quadratic curves are stored as cubic curves
+//      * the edges are colored (red, green, blue bits) so that the two edges of a corner share only one channel
+//      * each channel is the signed pseudo-distance to the nearest edge having its color, the median of the three
+//        channels keeps the corners sharp at any scale
+//      * the texels whose median is on the wrong side of the outline (nonzero winding) get the true signed distance
+//        in the three channels, the texels clashing with a neighbor (the bilinear filtering would create a false
+//        edge between them) get their median in the three channels
+//
+// Included by the builder and the library, must be included after stb_truetype.h
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MSDF_CHANNELS (3)
+#define MSDF_FLATTEN_STEPS (8)          // segments per curve for the winding number
+#define MSDF_SEARCH_STEPS (8)           // samples per curve before the newton iterations
+#define MSDF_NEWTON_ITERATIONS (4)
+#define MSDF_CORNER_THRESHOLD (0.14112f)    // sin(3 rad), msdfgen default
+
+enum msdf_color
+{
+    msdf_red = 1,
+    msdf_green = 2,
+    msdf_blue = 4,
+    msdf_yellow = msdf_red | msdf_green,
+    msdf_magenta = msdf_red | msdf_blue,
+    msdf_cyan = msdf_green | msdf_blue,
+    msdf_white = msdf_red | msdf_green | msdf_blue
+};
+
+typedef struct msdf_vec2 {float x, y;} msdf_vec2;
+
+typedef struct msdf_edge
+{
+    msdf_vec2 p[4];             // cubic curve in pixels
+    msdf_vec2 min, max;         // bounding box of the control points
+    uint32_t color;
+} msdf_edge;
+
+typedef struct msdf_distance
+{
+    float distance;             // signed, positive on the left of the edge
+    float orthogonality;        // |dot(tangent, direction to the point)|, breaks the ties at the corners
+    float t;
+} msdf_distance;
+
+typedef struct msdf_crossing
+{
+    float x;
+    int winding;
+} msdf_crossing;
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline msdf_vec2 msdf_sub(msdf_vec2 a, msdf_vec2 b) {msdf_vec2 r = {a.x - b.x, a.y - b.y}; return r;}
+static inline msdf_vec2 msdf_mix(msdf_vec2 a, msdf_vec2 b, float t) {msdf_vec2 r = {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t}; return r;}
+static inline float msdf_dot(msdf_vec2 a, msdf_vec2 b) {return a.x * b.x + a.y * b.y;}
+static inline float msdf_cross(msdf_vec2 a, msdf_vec2 b) {return a.x * b.y - a.y * b.x;}
+static inline float msdf_length(msdf_vec2 a) {return sqrtf(msdf_dot(a, a));}
+
+static inline msdf_vec2 msdf_normalize(msdf_vec2 a)
+{
+    float length = msdf_length(a);
+    msdf_vec2 r = {0.f, 0.f};
+    if (length > 0.f)
+    {
+        r.x = a.x / length;
+        r.y = a.y / length;
+    }
+    return r;
+}
+
+static inline float msdf_median(float a, float b, float c)
+{
+    return fmaxf(fminf(a, b), fminf(fmaxf(a, b), c));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline msdf_vec2 msdf_point(const msdf_edge* e, float t)
+{
+    float s = 1.f - t;
+    float a = s * s * s, b = 3.f * s * s * t, c = 3.f * s * t * t, d = t * t * t;
+    msdf_vec2 r = {a * e->p[0].x + b * e->p[1].x + c * e->p[2].x + d * e->p[3].x,
+                   a * e->p[0].y + b * e->p[1].y + c * e->p[2].y + d * e->p[3].y};
+    return r;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline msdf_vec2 msdf_derivative(const msdf_edge* e, float t)
+{
+    float s = 1.f - t;
+    float a = 3.f * s * s, b = 6.f * s * t, c = 3.f * t * t;
+    msdf_vec2 r = {a * (e->p[1].x - e->p[0].x) + b * (e->p[2].x - e->p[1].x) + c * (e->p[3].x - e->p[2].x),
+                   a * (e->p[1].y - e->p[0].y) + b * (e->p[2].y - e->p[1].y) + c * (e->p[3].y - e->p[2].y)};
+    return r;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// tangent direction, the control points next to the end points can be on them
+static inline msdf_vec2 msdf_direction(const msdf_edge* e, float t)
+{
+    msdf_vec2 d = msdf_derivative(e, t);
+    if (msdf_dot(d, d) > 1e-12f)
+        return msdf_normalize(d);
+
+    return msdf_normalize(msdf_sub(e->p[3], e->p[0]));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// closest point of the curve : coarse search then newton iterations on dot(B(t) - p, B'(t))
+static msdf_distance msdf_edge_distance(const msdf_edge* e, msdf_vec2 p)
+{
+    float best_t = 0.f, best_sq = FLT_MAX;
+    for(int i=0; i<=MSDF_SEARCH_STEPS; ++i)
+    {
+        float t = (float) i / (float) MSDF_SEARCH_STEPS;
+        msdf_vec2 d = msdf_sub(msdf_point(e, t), p);
+        float sq = msdf_dot(d, d);
+        if (sq < best_sq)
+        {
+            best_sq = sq;
+            best_t = t;
+        }
+    }
+
+    for(int i=0; i<MSDF_NEWTON_ITERATIONS; ++i)
+    {
+        float s = 1.f - best_t;
+        msdf_vec2 q = msdf_sub(msdf_point(e, best_t), p);
+        msdf_vec2 d1 = msdf_derivative(e, best_t);
+        msdf_vec2 d2 = {6.f * s * (e->p[2].x - 2.f * e->p[1].x + e->p[0].x) + 6.f * best_t * (e->p[3].x - 2.f * e->p[2].x + e->p[1].x),
+                        6.f * s * (e->p[2].y - 2.f * e->p[1].y + e->p[0].y) + 6.f * best_t * (e->p[3].y - 2.f * e->p[2].y + e->p[1].y)};
+        float denominator = msdf_dot(d1, d1) + msdf_dot(q, d2);
+        if (fabsf(denominator) < 1e-12f)
+            break;
+
+        float t = fminf(fmaxf(best_t - msdf_dot(q, d1) / denominator, 0.f), 1.f);
+        msdf_vec2 d = msdf_sub(msdf_point(e, t), p);
+        float sq = msdf_dot(d, d);
+        if (sq > best_sq)
+            break;
+
+        best_sq = sq;
+        best_t = t;
+    }
+
+    msdf_vec2 q = msdf_sub(p, msdf_point(e, best_t));
+    msdf_vec2 tangent = msdf_direction(e, best_t);
+    float distance = sqrtf(best_sq);
+
+    msdf_distance result;
+    result.distance = (msdf_cross(tangent, q) >= 0.f) ? distance : -distance;
+    result.orthogonality = (distance > 0.f) ? fabsf(msdf_dot(tangent, q)) / distance : 0.f;
+    result.t = best_t;
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// closer edge first, at equal distance the edge seen the most perpendicularly (the corners)
+static inline bool msdf_closer(msdf_distance a, msdf_distance b)
+{
+    float da = fabsf(a.distance), db = fabsf(b.distance);
+    if (fabsf(da - db) > 1e-5f)
+        return da < db;
+
+    return a.orthogonality < b.orthogonality;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// distance to the tangent lines extended from the end points, keeps the channels straight past the corners
+static inline float msdf_pseudo_distance(const msdf_edge* e, msdf_distance d, msdf_vec2 p)
+{
+    if (d.t <= 0.f)
+    {
+        msdf_vec2 direction = msdf_direction(e, 0.f);
+        msdf_vec2 q = msdf_sub(p, e->p[0]);
+        if (msdf_dot(q, direction) < 0.f)
+        {
+            float pseudo = msdf_cross(direction, q);
+            if (fabsf(pseudo) <= fabsf(d.distance))
+                return pseudo;
+        }
+    }
+    else if (d.t >= 1.f)
+    {
+        msdf_vec2 direction = msdf_direction(e, 1.f);
+        msdf_vec2 q = msdf_sub(p, e->p[3]);
+        if (msdf_dot(q, direction) > 0.f)
+        {
+            float pseudo = msdf_cross(direction, q);
+            if (fabsf(pseudo) <= fabsf(d.distance))
+                return pseudo;
+        }
+    }
+    return d.distance;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// distance from [p] to the bounding box of the control points, a lower bound of the distance to the curve
+static inline float msdf_box_distance(const msdf_edge* e, msdf_vec2 p)
+{
+    float dx = fmaxf(fmaxf(e->min.x - p.x, p.x - e->max.x), 0.f);
+    float dy = fmaxf(fmaxf(e->min.y - p.y, p.y - e->max.y), 0.f);
+    return sqrtf(dx * dx + dy * dy);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// two channels change side between [a] and [b], only the texel farther from the outline is flagged (msdfgen detectClash)
+static inline bool msdf_clash(const uint8_t* a, const uint8_t* b, int plane_stride, float threshold)
+{
+    float a0 = a[0], a1 = a[plane_stride], a2 = a[plane_stride * 2];
+    float b0 = b[0], b1 = b[plane_stride], b2 = b[plane_stride * 2];
+    float t;
+
+    // sorts the pairs by decreasing difference
+    if (fabsf(b0 - a0) < fabsf(b1 - a1)) {t = a0; a0 = a1; a1 = t; t = b0; b0 = b1; b1 = t;}
+    if (fabsf(b1 - a1) < fabsf(b2 - a2))
+    {
+        t = a1; a1 = a2; a2 = t; t = b1; b1 = b2; b2 = t;
+        if (fabsf(b0 - a0) < fabsf(b1 - a1)) {t = a0; a0 = a1; a1 = t; t = b0; b0 = b1; b1 = t;}
+    }
+
+    return fabsf(b1 - a1) >= threshold && !(b0 == b1 && b0 == b2) && fabsf(a2 - 127.5f) >= fabsf(b2 - 127.5f);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline bool msdf_is_corner(msdf_vec2 a, msdf_vec2 b)
+{
+    return msdf_dot(a, b) <= 0.f || fabsf(msdf_cross(a, b)) > MSDF_CORNER_THRESHOLD;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// edges of a contour : white without corner, yellow/white/magenta with one corner, cyan/magenta/yellow switched at
+// each corner otherwise (the last spline never takes the color of the first one)
+static void msdf_color_contour(msdf_edge* edges, int count)
+{
+    if (count == 0)
+        return;
+
+    int corners[64];
+    int num_corners = 0;
+    for(int i=0; i<count && num_corners<64; ++i)
+    {
+        const msdf_edge* previous = &edges[(i + count - 1) % count];
+        if (msdf_is_corner(msdf_direction(previous, 1.f), msdf_direction(&edges[i], 0.f)))
+            corners[num_corners++] = i;
+    }
+
+    if (num_corners == 0 || count < 3)
+    {
+        for(int i=0; i<count; ++i)
+            edges[i].color = msdf_white;
+    }
+    else if (num_corners == 1)
+    {
+        static const uint32_t colors[3] = {msdf_magenta, msdf_white, msdf_yellow};
+        for(int i=0; i<count; ++i)
+        {
+            int third = (int) (3.f * (float) i / (float) count);
+            edges[(corners[0] + i) % count].color = colors[third < 3 ? third : 2];
+        }
+    }
+    else
+    {
+        static const uint32_t colors[3] = {msdf_cyan, msdf_magenta, msdf_yellow};
+        int spline = 0;
+        for(int i=0; i<count; ++i)
+        {
+            int index = (corners[0] + i) % count;
+            if (i > 0 && spline + 1 < num_corners && index == corners[spline + 1])
+                spline++;
+
+            uint32_t color = colors[spline % 3];
+            if (spline == num_corners - 1 && spline > 0 && color == colors[0])
+                color = colors[1];
+            edges[index].color = color;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline void msdf_push_edge(msdf_edge* edges, int* count, msdf_vec2 p0, msdf_vec2 p1, msdf_vec2 p2, msdf_vec2 p3)
+{
+    // degenerate edges have no tangent
+    if (p0.x == p3.x && p0.y == p3.y && p0.x == p1.x && p0.y == p1.y && p0.x == p2.x && p0.y == p2.y)
+        return;
+
+    msdf_edge* e = &edges[(*count)++];
+    e->p[0] = p0; e->p[1] = p1; e->p[2] = p2; e->p[3] = p3;
+    e->min.x = fminf(fminf(p0.x, p1.x), fminf(p2.x, p3.x));
+    e->min.y = fminf(fminf(p0.y, p1.y), fminf(p2.y, p3.y));
+    e->max.x = fmaxf(fmaxf(p0.x, p1.x), fmaxf(p2.x, p3.x));
+    e->max.y = fmaxf(fmaxf(p0.y, p1.y), fmaxf(p2.y, p3.y));
+    e->color = msdf_white;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// Writes the distance field of [glyph] in three planes of [width]x[height] texels, [stride] bytes per row and
+// [plane_stride] bytes between the planes. The top left corner of stbtt_GetGlyphBitmapBox() at [scale] is at
+// ([padding], [padding]). A texel is 0.5 (127.5) on the outline and moves by 0.5/[range] per pixel, inside is brighter.
+// Returns false if the memory can't be allocated, the glyphs without contour (space) are empty.
+static bool msdf_glyph(const stbtt_fontinfo* info, int glyph, float scale, int padding, float range,
+                       uint8_t* output, int width, int height, int stride, int plane_stride)
+{
+    for(int c=0; c<MSDF_CHANNELS; ++c)
+        for(int y=0; y<height; ++y)
+            memset(output + c * plane_stride + y * stride, 0, (size_t) width);
+
+    stbtt_vertex* vertices = NULL;
+    int num_vertices = stbtt_GetGlyphShape(info, glyph, &vertices);
+    if (num_vertices <= 0)
+        return true;
+
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBox(info, glyph, scale, scale, &x0, &y0, &x1, &y1);
+    const float offset_x = (float) (padding - x0);
+    const float offset_y = (float) (padding - y0);
+
+    // a vertex is one edge at most, the contours are [contour_starts[i]; contour_starts[i+1]]
+    msdf_edge* edges = (msdf_edge*) malloc(sizeof(msdf_edge) * (size_t) num_vertices);
+    int* contour_starts = (int*) malloc(sizeof(int) * (size_t) (num_vertices + 1));
+    msdf_crossing* crossings = (msdf_crossing*) malloc(sizeof(msdf_crossing) * (size_t) num_vertices * MSDF_FLATTEN_STEPS);
+    uint8_t* clashes = (uint8_t*) malloc((size_t) (width * height));
+    if (edges == NULL || contour_starts == NULL || crossings == NULL || clashes == NULL)
+    {
+        free(edges);
+        free(contour_starts);
+        free(crossings);
+        free(clashes);
+        stbtt_FreeShape(info, vertices);
+        return false;
+    }
+
+    int num_edges = 0, num_contours = 0;
+    msdf_vec2 current = {0.f, 0.f};
+    for(int i=0; i<num_vertices; ++i)
+    {
+        const stbtt_vertex* v = &vertices[i];
+        msdf_vec2 p = {(float) v->x * scale + offset_x, -(float) v->y * scale + offset_y};
+        msdf_vec2 c0 = {(float) v->cx * scale + offset_x, -(float) v->cy * scale + offset_y};
+        msdf_vec2 c1 = {(float) v->cx1 * scale + offset_x, -(float) v->cy1 * scale + offset_y};
+
+        switch(v->type)
+        {
+        case STBTT_vmove: contour_starts[num_contours++] = num_edges; break;
+        case STBTT_vline: msdf_push_edge(edges, &num_edges, current, msdf_mix(current, p, 1.f/3.f), msdf_mix(current, p, 2.f/3.f), p); break;
+        case STBTT_vcurve: msdf_push_edge(edges, &num_edges, current, msdf_mix(current, c0, 2.f/3.f), msdf_mix(p, c0, 2.f/3.f), p); break;
+        case STBTT_vcubic: msdf_push_edge(edges, &num_edges, current, c0, c1, p); break;
+        }
+        current = p;
+    }
+    contour_starts[num_contours] = num_edges;
+    stbtt_FreeShape(info, vertices);
+
+    // the left side of the edges is inside when the contours turn counterclockwise (positive area)
+    float area = 0.f;
+    for(int i=0; i<num_edges; ++i)
+        for(int j=0; j<3; ++j)
+            area += msdf_cross(edges[i].p[j], edges[i].p[j+1]);
+    const float orientation = (area >= 0.f) ? 1.f : -1.f;
+
+    for(int i=0; i<num_contours; ++i)
+        msdf_color_contour(&edges[contour_starts[i]], contour_starts[i+1] - contour_starts[i]);
+
+    for(int y=0; y<height; ++y)
+    {
+        // crossings of the row with the flattened edges, for the nonzero winding rule
+        const float row = (float) y + .5f;
+        int num_crossings = 0;
+        for(int i=0; i<num_edges; ++i)
+        {
+            if (row < edges[i].min.y || row >= edges[i].max.y)
+                continue;
+
+            msdf_vec2 a = edges[i].p[0];
+            for(int s=1; s<=MSDF_FLATTEN_STEPS; ++s)
+            {
+                msdf_vec2 b = msdf_point(&edges[i], (float) s / (float) MSDF_FLATTEN_STEPS);
+                if ((a.y <= row) != (b.y <= row))
+                {
+                    crossings[num_crossings].x = a.x + (row - a.y) * (b.x - a.x) / (b.y - a.y);
+                    crossings[num_crossings++].winding = (b.y > a.y) ? 1 : -1;
+                }
+                a = b;
+            }
+        }
+
+        for(int x=0; x<width; ++x)
+        {
+            const msdf_vec2 p = {(float) x + .5f, row};
+
+            int winding = 0;
+            for(int i=0; i<num_crossings; ++i)
+                if (crossings[i].x > p.x)
+                    winding += crossings[i].winding;
+
+            msdf_distance closest[MSDF_CHANNELS], overall;
+            int closest_edge[MSDF_CHANNELS] = {-1, -1, -1};
+            for(int c=0; c<MSDF_CHANNELS; ++c)
+                closest[c].distance = FLT_MAX;
+            overall.distance = FLT_MAX;
+
+            for(int i=0; i<num_edges; ++i)
+            {
+                float bound = msdf_box_distance(&edges[i], p);
+                float farthest = fabsf(overall.distance);
+                for(int c=0; c<MSDF_CHANNELS; ++c)
+                    if (edges[i].color & (1u << c))
+                        farthest = fmaxf(farthest, fabsf(closest[c].distance));
+
+                if (bound > farthest + 1e-4f)
+                    continue;
+
+                msdf_distance d = msdf_edge_distance(&edges[i], p);
+                if (msdf_closer(d, overall))
+                    overall = d;
+
+                for(int c=0; c<MSDF_CHANNELS; ++c)
+                {
+                    if ((edges[i].color & (1u << c)) && msdf_closer(d, closest[c]))
+                    {
+                        closest[c] = d;
+                        closest_edge[c] = i;
+                    }
+                }
+            }
+
+            float channels[MSDF_CHANNELS];
+            for(int c=0; c<MSDF_CHANNELS; ++c)
+                channels[c] = (closest_edge[c] >= 0) ? msdf_pseudo_distance(&edges[closest_edge[c]], closest[c], p) * orientation : -FLT_MAX;
+
+            // the median must agree with the winding, the artifacts (clashing channels) get the true distance
+            const bool inside = (winding != 0);
+            float median = msdf_median(channels[0], channels[1], channels[2]);
+            if ((median > 0.f) != inside)
+            {
+                float distance = inside ? fabsf(overall.distance) : -fabsf(overall.distance);
+                channels[0] = channels[1] = channels[2] = distance;
+            }
+
+            for(int c=0; c<MSDF_CHANNELS; ++c)
+            {
+                float value = (.5f + channels[c] / (2.f * range)) * 255.f + .5f;
+                output[c * plane_stride + y * stride + x] = (uint8_t) fminf(fmaxf(value, 0.f), 255.f);
+            }
+        }
+    }
+
+    // a bit more than one pixel of distance between two channels of neighbor texels
+    const float threshold = 1.001f * 255.f / (2.f * range);
+    for(int y=0; y<height; ++y)
+    {
+        for(int x=0; x<width; ++x)
+        {
+            const uint8_t* texel = output + y * stride + x;
+            clashes[y * width + x] = (x > 0 && msdf_clash(texel, texel - 1, plane_stride, threshold)) ||
+                                     (x < width - 1 && msdf_clash(texel, texel + 1, plane_stride, threshold)) ||
+                                     (y > 0 && msdf_clash(texel, texel - stride, plane_stride, threshold)) ||
+                                     (y < height - 1 && msdf_clash(texel, texel + stride, plane_stride, threshold));
+        }
+    }
+
+    for(int y=0; y<height; ++y)
+    {
+        for(int x=0; x<width; ++x)
+        {
+            if (!clashes[y * width + x])
+                continue;
+
+            uint8_t* texel = output + y * stride + x;
+            float median = msdf_median(texel[0], texel[plane_stride], texel[plane_stride * 2]);
+            texel[0] = texel[plane_stride] = texel[plane_stride * 2] = (uint8_t) median;
+        }
+    }
+
+    free(edges);
+    free(contour_starts);
+    free(crossings);
+    free(clashes);
+    return true;
+}
+
+#endif
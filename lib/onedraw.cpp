@@ -1,15 +1,64 @@
+#if defined(__APPLE__) && !defined(ONEDRAW_NO_METAL)
+#define ONEDRAW_METAL
+#endif
+
+#ifdef ONEDRAW_METAL
 #define NS_PRIVATE_IMPLEMENTATION
 #define MTL_PRIVATE_IMPLEMENTATION
 #define CA_PRIVATE_IMPLEMENTATION
 #include "Metal.hpp"
+#else
+// the structures only hold pointers on metal objects, no need for metal-cpp
+namespace MTL
+{
+    class Device;
+    class CommandQueue;
+    class CommandBuffer;
+    class ComputePipelineState;
+    class RenderPipelineState;
+    class DepthStencilState;
+    class Buffer;
+    class Texture;
+    class IndirectCommandBuffer;
+}
+#endif
+
+#include <math.h>
+#include <float.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 #include "onedraw.h"
 #include "common.h"
 #include "default_font.h"
 #include "default_font_atlas.h"
+#ifdef ONEDRAW_METAL
 #include "binning.h"
 #include "rasterization.h"
-#include <stdatomic.h>
+#endif
+#include "cpu_binning.h"
+#include "cpu_rasterizer.h"
+#include "cpu_thread_pool.h"
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#include "stb_truetype.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#include "msdf.h"
 
 // ---------------------------------------------------------------------------------------------------------------------------
 // Macros
@@ -19,6 +68,7 @@
 #define UNUSED_VARIABLE(a) (void)(a)
 #define LAST_CLIP_INDEX ((uint8_t) r->commands.clipshapes_buffer.GetNumElements()-1)
 #define assert_msg(expr, msg) assert((expr) && (msg))
+#define MAX_NARROW_VIEWPORT ((UINT8_MAX + 1) * TILE_SIZE)        // 8 bits tile coordinates
 
 // ---------------------------------------------------------------------------------------------------------------------------
 // Constants
@@ -28,8 +78,30 @@ constexpr size_t STRING_BUFFER_SIZE = 512U;
 constexpr float VEC2_SQR2 = 1.41421356237f;
 constexpr float HALF_PIXEL = .5f;
 constexpr float VEC2_PI = 3.14159265f;
-constexpr uint32_t TESSELATION_STACK_MAX = 1024U;
-constexpr float COLINEAR_THRESHOLD = .1f;
+constexpr float CURVE_TOLERANCE = .25f;                // max distance in pixels between a bezier curve and its capsules
+constexpr uint32_t MAX_CURVE_QUADRATICS = 16U;         // quadratic approximations of a cubic curve
+constexpr uint32_t STATS_DEFAULT_WINDOW = 60U;
+constexpr uint32_t STATS_MAX_WINDOW = 1024U;
+constexpr uint32_t MAX_CONTEXTS = 64U;
+constexpr uint32_t MAX_RUN_DATA = 1U + MAX_RUN_GLYPHS + (MAX_RUN_GLYPHS + 3U) / 4U;     // text_run_size(MAX_RUN_GLYPHS)
+constexpr size_t TEXT_CACHE_DEFAULT_SIZE = 256U << 10U;
+constexpr size_t TEXT_CACHE_BYTES_PER_BUCKET = 512U;
+constexpr size_t TEXT_CACHE_MIN_BUCKETS = 64U;
+constexpr uint32_t FONT_ATLAS_CELLS = 16U;                 // per side, FONT_ATLAS_CELLS^2 == MAX_FONT_SLOTS
+constexpr uint32_t NO_FONT_SLOT = UINT32_MAX;
+constexpr float FONT_MSDF_HEIGHT = 32.f;              // the loaded fonts are rasterized at this height whatever their size
+constexpr float FONT_MSDF_RANGE = 2.f;                // texels of distance on each side of the outline
+constexpr uint32_t FONT_MSDF_PADDING = 2U;
+constexpr float MIN_FONT_HEIGHT = 4.f;
+constexpr float MAX_FONT_HEIGHT = 200.f;
+
+// the frame buffers grow up to these, a frame with more commands than a binning pass can hold is binned in several passes
+// (LAST_COMMAND ends the region lists so a pass has one command less than the 16 bits index can address)
+constexpr uint32_t MAX_PASS_COMMANDS = LAST_COMMAND;
+constexpr uint32_t MAX_FRAME_COMMANDS = MAX_COMMANDS * 16U;
+constexpr uint32_t MAX_FRAME_DRAW_DATA = MAX_FRAME_COMMANDS * MAX_DRAW_VALUES;
+constexpr uint32_t MAX_FRAME_NODES = MAX_NODES_COUNT * 16U;
+constexpr uint32_t MAX_BINNING_PASSES = 64U;
 
 // ---------------------------------------------------------------------------------------------------------------------------
 // Templates
@@ -38,6 +110,7 @@ template<class T> void swap(T& a, T& b) {T tmp = a; a = b; b = tmp;}
 template<class T> T min(T a, T b) {return (a<b) ? a : b;}
 template<class T> T max(T a, T b) {return (a>b) ? a : b;}
 
+// when no device is provided (cpu backend), the buffer is allocated in host memory and is not multi-buffered
 template<typename T>
 class DynamicBuffer
 {
@@ -47,6 +120,8 @@ public:
 private:
     uint32_t GetIndex(uint32_t currentFrameIndex) {return currentFrameIndex % DynamicBuffer::MaxInflightBuffers;}
     MTL::Buffer* m_Buffers[MaxInflightBuffers];
+    MTL::Device* m_pDevice {nullptr};
+    T* m_pHostData {nullptr};
     T* m_pData {nullptr};
     size_t m_NumElements {0};
     size_t m_MaxElements {0};
@@ -54,19 +129,83 @@ private:
 public:
     DynamicBuffer() {for(uint32_t i=0; i<DynamicBuffer::MaxInflightBuffers; ++i) m_Buffers[i] = nullptr;}
 
-    void Init(MTL::Device* device, NS::UInteger length)
+    void Init(MTL::Device* device, size_t length)
     {
-        for(uint32_t i=0; i<DynamicBuffer::MaxInflightBuffers; ++i)
-            m_Buffers[i] = device->newBuffer(length, MTL::ResourceStorageModeShared);
-    
+#ifdef ONEDRAW_METAL
+        m_pDevice = device;
+        if (device != nullptr)
+        {
+            for(uint32_t i=0; i<DynamicBuffer::MaxInflightBuffers; ++i)
+                m_Buffers[i] = device->newBuffer(length, MTL::ResourceStorageModeShared);
+        }
+        else
+#endif
+        {
+            UNUSED_VARIABLE(device);
+            m_pHostData = (T*) malloc(length);
+        }
+
         m_pData = nullptr;
         m_NumElements = 0;
         m_MaxElements = length / sizeof(T);
     }
 
+    // reallocates the buffer for [num_elements] keeping the content, false if out of memory
+    // only the metal buffer of the current frame is replaced, the other in-flight buffers are when they are mapped
+    bool Grow(size_t num_elements, uint32_t currentFrameIndex)
+    {
+        if (num_elements <= m_MaxElements)
+            return true;
+
+#ifdef ONEDRAW_METAL
+        if (m_pHostData == nullptr)
+        {
+            MTL::Buffer* buffer = m_pDevice->newBuffer(num_elements * sizeof(T), MTL::ResourceStorageModeShared);
+            if (buffer == nullptr)
+                return false;
+
+            MTL::Buffer*& current = m_Buffers[GetIndex(currentFrameIndex)];
+            memcpy(buffer->contents(), current->contents(), m_NumElements * sizeof(T));
+            current->release();
+            current = buffer;
+            m_pData = (m_pData != nullptr) ? (T*)buffer->contents() : nullptr;
+        }
+        else
+#endif
+        {
+            UNUSED_VARIABLE(currentFrameIndex);
+            T* data = (T*) realloc(m_pHostData, num_elements * sizeof(T));
+            if (data == nullptr)
+                return false;
+
+            m_pData = (m_pData != nullptr) ? data : nullptr;
+            m_pHostData = data;
+        }
+
+        m_MaxElements = num_elements;
+        return true;
+    }
+
     T* Map(uint32_t currentFrameIndex)
     {
-        m_pData = (T*)m_Buffers[GetIndex(currentFrameIndex)]->contents();
+#ifdef ONEDRAW_METAL
+        if (m_pHostData == nullptr)
+        {
+            // the buffer of this frame was in flight when the others grew
+            MTL::Buffer*& buffer = m_Buffers[GetIndex(currentFrameIndex)];
+            if (buffer->length() < m_MaxElements * sizeof(T))
+            {
+                buffer->release();
+                buffer = m_pDevice->newBuffer(m_MaxElements * sizeof(T), MTL::ResourceStorageModeShared);
+            }
+            m_pData = (T*)buffer->contents();
+        }
+        else
+#endif
+        {
+            UNUSED_VARIABLE(currentFrameIndex);
+            m_pData = m_pHostData;
+        }
         m_NumElements = 0;
         return m_pData;
     }
@@ -81,21 +220,16 @@ public:
         return nullptr;
     }
 
-    T* NewMultiple(uint32_t count)
-    {
-        T* output = nullptr;
-        if (m_NumElements + count < m_MaxElements)
-        {
-            output = &m_pData[m_NumElements];
-            m_NumElements += count;
-        }
-        return output;
-    }
+    // reservation split in a check and a push, so several buffers can be checked before writing to any of them
+    bool HasRoom(size_t count) const {return m_NumElements + count <= m_MaxElements;}
+    T* Push(size_t count) {T* output = &m_pData[m_NumElements]; m_NumElements += count; return output;}
 
     void RemoveLast() {if (m_NumElements>0) m_NumElements--;}
+    void RemoveMultiple(size_t count) {m_NumElements = (count < m_NumElements) ? m_NumElements - count : 0;}
 
     void Terminate()
     {
+#ifdef ONEDRAW_METAL
         for(uint32_t i=0; i<DynamicBuffer::MaxInflightBuffers; ++i)
         {
             if (m_Buffers[i] != nullptr)
@@ -104,13 +238,30 @@ public:
                 m_Buffers[i] = nullptr;
             }
         }
+#endif
+        free(m_pHostData);
+        m_pHostData = nullptr;
     }
 
     size_t GetNumElements() const {return m_NumElements;}
     size_t GetMaxElements() const {return m_MaxElements;}
+    T* GetData() {return m_pData;}
+#ifdef ONEDRAW_METAL
     MTL::Buffer* GetBuffer(uint32_t currentFrameIndex) {return m_Buffers[GetIndex(currentFrameIndex)];}
     NS::UInteger GetLength() const {return m_Buffers[0]->length();}
-    size_t GetTotalSize() const {return m_Buffers[0]->allocatedSize() * DynamicBuffer::MaxInflightBuffers;}
+    size_t GetTotalSize() const
+    {
+        if (m_pHostData != nullptr)
+            return m_MaxElements * sizeof(T);
+
+        size_t total = 0;
+        for(uint32_t i=0; i<DynamicBuffer::MaxInflightBuffers; ++i)
+            total += (m_Buffers[i] != nullptr) ? m_Buffers[i]->allocatedSize() : 0;
+        return total;
+    }
+#else
+    size_t GetTotalSize() const {return m_MaxElements * sizeof(T);}
+#endif
 };
 
 // ---------------------------------------------------------------------------------------------------------------------------
@@ -131,22 +282,100 @@ typedef struct aabb {vec2 min, max;} aabb;
 typedef struct quadratic_bezier {vec2 c0, c1, c2;} quadratic_bezier;
 typedef struct cubic_bezier {vec2 c0, c1, c2, c3;} cubic_bezier;
 
+// one bit per tile of the viewport, used by the occlusion culling
+typedef struct tile_bitmap
+{
+    uint64_t* bits {nullptr};
+    uint32_t words_per_row {0};
+} tile_bitmap;
+
 struct alphabet
 {
     od_glyph glyphs[MAX_GLYPHS];
     float font_height;
+    float distance_range;
     uint16_t num_glyphs;
     uint16_t first_glyph;
     uint16_t texture_width;
     uint16_t texture_height;
 };
 
+// glyph of a loaded font, the metrics are kept when the glyph leaves the atlas
+typedef struct font_glyph
+{
+    uint32_t codepoint;
+    uint32_t slot;                      // cell of the atlas, NO_FONT_SLOT when not rasterized
+    int32_t index;                      // in the font file, 0 when the font doesn't have the codepoint
+    uint16_t width;                     // of the distance field, clamped to the cell
+    uint16_t height;
+    od_glyph metrics;                   // x0, y0, x1, y1 : rectangle in the atlas, valid with the slot
+} font_glyph;
+
+// truetype font loaded by od_load_font(), the glyphs are rasterized on first use in the cells of the atlas
+typedef struct od_font
+{
+    stbtt_fontinfo info;
+    struct onedraw* owner;              // renderer whose atlas receives the glyphs
+    float scale;
+    float msdf_scale;                   // of the distance fields, rasterized at FONT_MSDF_HEIGHT
+    float font_height;
+    float baseline;                     // from the top of the line
+    float fallback_advance;             // codepoints missing from the font
+    uint32_t cell_size;
+    uint32_t atlas_size;                // width and height of a plane
+    font_glyph* glyphs;                 // open addressing on the codepoint, UINT32_MAX for the empty entries
+    uint32_t glyphs_mask;
+    uint32_t num_glyphs;
+    uint32_t slot_codepoints[MAX_FONT_SLOTS];
+    uint32_t slot_frames[MAX_FONT_SLOTS];           // last frame using the slot
+    uint32_t slot_pins[MAX_FONT_SLOTS];             // retained lists drawing the slot, the pinned slots are not evicted
+    font_char table[MAX_FONT_SLOTS];                // copy of the glyph table of the backend
+    uint32_t num_slots;                 // cells used so far, the next ones evict
+    uint32_t frame;
+    uint32_t num_evictions;             // the cached text layouts built before an eviction are stale
+    uint32_t full_frame;                // last frame the "atlas full" warning was logged
+    uint32_t num_dropped;               // glyphs not rasterized for lack of a free cell, the layouts missing one aren't cached
+    uint32_t num_lists;                 // retained lists pinning some slots, the font is freed with the last one
+    uint8_t* bitmap;                    // cell_size * cell_size * FONT_PLANES
+    std::mutex mutex;                   // the contexts record text on worker threads
+} od_font;
+
+// text run of a cached layout, relative to the position of the string
+typedef struct text_layout_run
+{
+    aabb box;
+    float top;
+    uint32_t first;                     // index of the first glyph in the layout
+    uint32_t count;
+} text_layout_run;
+
+// a string laid out at (0, 0), allocated in one block : the header, the runs, the left edges, the glyphs and the string
+typedef struct text_layout
+{
+    struct text_layout* next;           // in the bucket
+    struct text_layout* lru_previous;   // more recently used
+    struct text_layout* lru_next;
+    uint64_t hash;
+    size_t size;
+    uint32_t length;
+    uint32_t num_runs;
+    uint32_t num_glyphs;
+    uint32_t num_evictions;             // of the loaded font when the layout was built
+    float width;                        // see od_text_width()
+    text_layout_run* runs;
+    float* lefts;
+    uint8_t* glyphs;
+    const char* text;
+} text_layout;
+
 struct onedraw
 {
     MTL::Device* device;
     MTL::CommandQueue* command_queue;
     MTL::CommandBuffer* command_buffer;
+#ifdef ONEDRAW_METAL
     dispatch_semaphore_t semaphore;
+#endif
 
     struct
     {
@@ -154,14 +383,51 @@ struct onedraw
         DynamicBuffer<tiles_data> bin_output_arg;
         DynamicBuffer<draw_command> buffer;
         DynamicBuffer<draw_color> colors;
-        DynamicBuffer<quantized_aabb> aabb_buffer;
+        DynamicBuffer<uint32_t> aabb_buffer;
         DynamicBuffer<float> data_buffer;
         DynamicBuffer<clip_shape> clipshapes_buffer;
         uint32_t count;
-        quantized_aabb* group_aabb {nullptr};
-        quantized_aabb* draw_aabb {nullptr};
+        uint32_t* group_aabb {nullptr};
+        quantized_aabb group_box;       // merged boxes of the group's shapes, written at the end of the group
+        aabb visible;                   // bounds of the current clip shape inside the viewport
+        bool packed {false};            // draw data written as 16 bits values when they fit
+        bool wide_aabb {false};         // bounding boxes with 16 bits tile coordinates (two words per command)
     } commands;
 
+    // retained list being recorded, the commands are written in the frame buffers then moved in the list
+    struct
+    {
+        aabb* boxes {nullptr};          // unquantized bounding boxes of the recorded commands (max_commands)
+        uint32_t first_command;
+        uint32_t first_data;
+        uint32_t group_index;
+        uint32_t font_slots[MAX_FONT_SLOTS / 32];      // one bit per glyph of the loaded font drawn in the list
+        bool recording {false};
+    } list;
+
+    // occlusion culling
+    struct
+    {
+        tile_bitmap covered;
+    } occlusion;
+
+    // capacities of the frame, start at onedraw_def.limits and grow when a frame needs more
+    struct
+    {
+        uint32_t max_commands;
+        uint32_t max_draw_data;
+        uint32_t max_nodes;
+        uint32_t max_clips;
+    } limits;
+
+    // recording contexts ended during the frame, merged by od_end_frame
+    struct
+    {
+        od_context* ended[MAX_CONTEXTS];
+        std::atomic<uint32_t> num_ended {0};
+        struct onedraw* parent {nullptr};       // set on the renderer of a context
+    } contexts;
+
     // region binning
     struct
     {
@@ -175,6 +441,7 @@ struct onedraw
         uint16_t num_height;
         uint16_t count;
         uint32_t num_groups;
+        uint32_t capacity;              // commands per pass the region buffers can hold
     } regions;
 
     // tile binning
@@ -184,6 +451,7 @@ struct onedraw
         MTL::ComputePipelineState* binning_pso {nullptr};
         MTL::ComputePipelineState* write_icb_pso {nullptr};
         MTL::Buffer* counters_buffer {nullptr};
+        MTL::Buffer* counters_readback {nullptr};
         MTL::Buffer* indirect_arg {nullptr};
         MTL::Buffer* indices {nullptr};
         MTL::Buffer* nodes {nullptr};
@@ -205,9 +473,14 @@ struct onedraw
         uint16_t height;
         float aa_width {VEC2_SQR2};
         float group_smoothness {0.f};
-        sdf_operator group_op;
+        sdf_operator group_op {op_overwrite};
         float outline_width {0.f};
+        uint32_t num_slices {0};
+        uint32_t slice_num_pixels {0};
+        float2 atlas_half_texel {.x = 0.f, .y = 0.f};
+        uint32_t opaque_slices[256 / 32] {};   // one bit per slice without transparent texel
         bool srgb_backbuffer {true}; 
+        bool occlusion_culling {true};
     } rasterizer;
 
     // font
@@ -216,8 +489,22 @@ struct onedraw
         MTL::Texture* texture {nullptr};
         MTL::Buffer* glyphs {nullptr};
         alphabet desc;
+        od_font* loaded {nullptr};      // od_load_font(), the built-in font (desc) when null
     } font;
 
+    // layouts of the strings drawn or measured, kept between frames (no cache on the renderer of a context)
+    struct
+    {
+        text_layout** buckets {nullptr};
+        text_layout* lru_head {nullptr};        // most recently used
+        text_layout* lru_tail {nullptr};
+        uint32_t bucket_mask {0};
+        size_t size {0};
+        size_t max_size {0};
+        uint32_t num_hits {0};
+        uint32_t num_misses {0};
+    } text_cache;
+
     // screenshot service
     struct
     {
@@ -235,16 +522,78 @@ struct onedraw
     {
         uint32_t peak_num_draw_cmd {0};
         uint32_t num_draw_data {0};
-        _Atomic(float) gpu_time;
+        std::atomic<float> gpu_time {0.f};
+        float binning_time {0.f};
+        float raster_time {0.f};
+        float recording_time {0.f};
+        uint32_t num_nodes {0};
+        uint32_t num_tiles {0};
+        uint32_t num_overflow_nodes {0};
+        uint32_t max_tile_nodes {0};
+        uint32_t num_binning_passes {0};
+        uint32_t num_changed_tiles {0};
+        uint32_t num_occluded_commands {0};
+        uint32_t num_text_cache_hits {0};
+        uint32_t num_text_cache_misses {0};
         float average_gpu_time {0.f};
         float accumulated_gpu_time {0.f};
         uint32_t frame_index {0};
+        std::chrono::steady_clock::time_point frame_start;
+        float frame_times[STATS_MAX_WINDOW];
+        uint32_t window {STATS_DEFAULT_WINDOW};
+        uint32_t frame_time_index {0};
+        uint32_t num_frame_times {0};
     } stats;
 
+    // cpu backend, used when no metal device is provided
+    struct
+    {
+        ThreadPool pool;
+        draw_cmd_arguments args;
+        cpu::counters counters;
+        uint8_t* predicate {nullptr};
+        uint16_t* scan {nullptr};
+        uint16_t* region_indices {nullptr};
+        uint32_t* head {nullptr};
+        tile_node* nodes {nullptr};
+        uint32_t* tile_indices {nullptr};
+        uint32_t* tile_costs {nullptr};
+        float* heatmap {nullptr};               // list lengths then costs of the tiles, summed over the passes before the last one
+        uint32_t num_heatmap_passes {0};
+
+        // incremental rendering, tiles whose command list hash did not change keep their pixels
+        uint64_t* command_hashes {nullptr};
+        uint64_t* tile_hashes {nullptr};
+        uint32_t* changed_indices {nullptr};
+        uint32_t* changed_costs {nullptr};
+        const void* previous_drawable {nullptr};
+        bool incremental {false};
+        bool full_redraw {true};
+
+        cpu::texture font;
+        cpu::texture atlas;
+        font_char glyphs[MAX_FONT_SLOTS];
+    } cpu;
+
+    // frame capture
+    struct
+    {
+        FILE* file {nullptr};
+        uint32_t num_frames {0};
+        uint32_t num_skipped_frames {0};        // drawn with a loaded font
+    } capture;
+
     void (*custom_log)(const char* string);
     char string_buffer[STRING_BUFFER_SIZE];
 };
 
+struct od_context
+{
+    struct onedraw renderer;    // only the command buffers and the recording state are used
+    uint32_t order_key;
+    bool recording;
+};
+
 
 // ---------------------------------------------------------------------------------------------------------------------------
 // private functions
@@ -289,21 +638,6 @@ static inline vec2 vec2_lerp(vec2 a, vec2 b, float t)
     return (vec2) {.x = fmaf(a.x , one_minus_t, b.x * t), .y = fmaf(a.y , one_minus_t, b.y * t)};
 }
 
-//----------------------------------------------------------------------------------------------------------------------------------------------------------
-static inline bool is_colinear(vec2 p0, vec2 p1, vec2 p2, float threshold)
-{
-    vec2 v0 = vec2_sub(p1, p0);
-    vec2 v1 = vec2_sub(p2, p0);
-    float squared_area = fabsf(v0.x * v1.y - v0.y * v1.x);
-    float base2 = vec2_dot(v0, v0);
-
-    if (base2 < FLT_EPSILON)
-        return true;
-
-    float squared_height = (squared_area * squared_area) / base2;
-    return squared_height <= (threshold * threshold);
-}
-
 //----------------------------------------------------------------------------------------------------------------------------
 static inline void aabb_grow(aabb* box, vec2 amount)
 {
@@ -357,6 +691,24 @@ static inline aabb aabb_from_rounded_obb(vec2 p0, vec2 p1, float width, float bo
     return box;
 }
 
+//----------------------------------------------------------------------------------------------------------------------------
+static inline aabb aabb_invalid()
+{
+    return (aabb) {.min = vec2_splat(FLT_MAX), .max = vec2_splat(-FLT_MAX)};
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline aabb aabb_merge(aabb a, aabb b)
+{
+    return (aabb) {.min = vec2_min(a.min, b.min), .max = vec2_max(a.max, b.max)};
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline bool aabb_overlap(aabb a, aabb b)
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y;
+}
+
 //----------------------------------------------------------------------------------------------------------------------------
 static inline float srgb_to_linear(float c)
 {
@@ -374,6 +726,14 @@ static inline float bitcast_u32_to_float(uint32_t value)
     return c.f;
 }
 
+//----------------------------------------------------------------------------------------------------------------------------
+static inline uint32_t bitcast_float_to_u32(float value)
+{
+    union {float f; uint32_t u;} c;
+    c.f = value;
+    return c.u;
+}
+
 //----------------------------------------------------------------------------------------------------------------------------
 void od_log(struct onedraw* r, const char* string, ...)
 {
@@ -388,33 +748,144 @@ void od_log(struct onedraw* r, const char* string, ...)
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------------
+// capacity doubled until it holds [needed], up to [maximum]
+static inline uint32_t od_grow_capacity(uint32_t capacity, uint32_t needed, uint32_t maximum)
+{
+    while (capacity < needed && capacity < maximum)
+        capacity = min(max(capacity, 1U) * 2, maximum);
+    return capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// binning counters of the passes of a frame
+typedef struct binning_totals
+{
+    uint32_t num_nodes;
+    uint32_t num_overflow_nodes;
+    uint32_t num_tiles;
+    uint32_t max_tile_nodes;
+    uint32_t num_passes;
+} binning_totals;
+
+//----------------------------------------------------------------------------------------------------------------------------
+// adds the counters of a binning pass, both backends
+//      [num_nodes]     nodes requested by the tile binning, can be higher than the max_nodes limit
+static void od_add_binning_pass(const struct onedraw* r, binning_totals* totals, uint32_t num_nodes, uint32_t num_tiles,
+                                uint32_t max_tile_nodes)
+{
+    const uint32_t max_nodes = r->limits.max_nodes;
+    totals->num_nodes += min(num_nodes, max_nodes);
+    totals->num_overflow_nodes += (num_nodes > max_nodes) ? num_nodes - max_nodes : 0;
+    totals->num_tiles = max(totals->num_tiles, num_tiles);
+    totals->max_tile_nodes = max(totals->max_tile_nodes, max_tile_nodes);
+    totals->num_passes++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// stores the binning counters of the frame
+static void od_update_binning_stats(struct onedraw* r, const binning_totals* totals)
+{
+    // the dropped nodes are shapes missing in some tiles, warn once when it starts
+    if (totals->num_overflow_nodes > 0 && r->stats.num_overflow_nodes == 0)
+        od_log(r, "tile binning overflow : %u nodes dropped (max %u), some shapes are missing", totals->num_overflow_nodes,
+               r->limits.max_nodes);
+
+    r->stats.num_nodes = totals->num_nodes;
+    r->stats.num_tiles = totals->num_tiles;
+    r->stats.num_overflow_nodes = totals->num_overflow_nodes;
+    r->stats.max_tile_nodes = totals->max_tile_nodes;
+    r->stats.num_binning_passes = totals->num_passes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// number of commands binned by the pass starting at [first], the pass ends before a group that it would cut
+// (unless the group alone is longer than a pass)
+static uint32_t od_pass_size(const draw_command* commands, uint32_t first, uint32_t num_commands)
+{
+    const uint32_t count = min(num_commands - first, MAX_PASS_COMMANDS);
+    if (first + count == num_commands)
+        return count;
+
+    for(uint32_t i=first+count; i-- > first; )
+    {
+        if (commands[i].type == end_group)
+            break;
+        if (commands[i].type == begin_group)
+            return (i > first) ? i - first : count;
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the arguments of each binning pass have their own slot in the argument buffer
+static inline size_t od_pass_arguments_offset(uint32_t pass)
+{
+    // offsets of buffers in the constant address space are aligned on 256 bytes
+    return ((sizeof(draw_cmd_arguments) + 255) & ~(size_t)255) * pass;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// restricts the arguments of the frame to the commands of a pass, the draw data and the clips are shared by the passes
+// the passes after the first one are blended over the pixels of the previous ones
+static void od_set_pass_arguments(draw_cmd_arguments* args, const draw_cmd_arguments* frame, uint32_t first, uint32_t count,
+                                  uint32_t pass)
+{
+    *args = *frame;
+    args->commands = frame->commands + first;
+    args->colors = frame->colors + first;
+    args->commands_aabb = frame->commands_aabb + first * (frame->wide_aabb ? 2 : 1);
+    args->num_commands = count;
+    args->num_groups = (count + SIMD_GROUP_SIZE - 1) / SIMD_GROUP_SIZE;
+    args->num_elements_per_thread = (count + MAX_THREADS_PER_THREADGROUP-1) / MAX_THREADS_PER_THREADGROUP;
+    args->load_backbuffer = (pass > 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static int compare_float(const void* a, const void* b)
+{
+    float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
 //----------------------------------------------------------------------------------------------------------------------------
 void od_init_screenshot_resources(struct onedraw* r)
 {
     if (r->screenshot.allocate_resources)
     {
-        SAFE_RELEASE(r->screenshot.texture);
+        MTL::Texture* texture = nullptr;
 
-        MTL::TextureDescriptor* pTextureDesc = MTL::TextureDescriptor::alloc()->init();
-        pTextureDesc->setWidth(r->rasterizer.width);
-        pTextureDesc->setHeight(r->rasterizer.height);
-        pTextureDesc->setPixelFormat(r->rasterizer.srgb_backbuffer ? MTL::PixelFormatBGRA8Unorm_sRGB : MTL::PixelFormatBGRA8Unorm);
-        pTextureDesc->setTextureType(MTL::TextureType2D);
-        pTextureDesc->setMipmapLevelCount(1);
-        pTextureDesc->setUsage(MTL::TextureUsageShaderRead | MTL::TextureUsageShaderWrite | MTL::TextureUsageRenderTarget);
-        pTextureDesc->setStorageMode(MTL::StorageModeShared);
+#ifdef ONEDRAW_METAL
+        if (r->device != nullptr)
+        {
+            SAFE_RELEASE(r->screenshot.texture);
+
+            MTL::TextureDescriptor* pTextureDesc = MTL::TextureDescriptor::alloc()->init();
+            pTextureDesc->setWidth(r->rasterizer.width);
+            pTextureDesc->setHeight(r->rasterizer.height);
+            pTextureDesc->setPixelFormat(r->rasterizer.srgb_backbuffer ? MTL::PixelFormatBGRA8Unorm_sRGB : MTL::PixelFormatBGRA8Unorm);
+            pTextureDesc->setTextureType(MTL::TextureType2D);
+            pTextureDesc->setMipmapLevelCount(1);
+            pTextureDesc->setUsage(MTL::TextureUsageShaderRead | MTL::TextureUsageShaderWrite | MTL::TextureUsageRenderTarget);
+            pTextureDesc->setStorageMode(MTL::StorageModeShared);
+            texture = r->device->newTexture(pTextureDesc);
+            pTextureDesc->release();
+        }
+#endif
 
+        // the cpu backend copies directly from the output buffer, no texture needed
         r->screenshot = 
         {
-            .texture = r->device->newTexture(pTextureDesc),
+            .texture = texture,
             .out_pixels = nullptr, // null because defined by the user
             .region_x = 0,
             .region_y = 0,
             .region_width = r->rasterizer.width,
-            .region_height = r->rasterizer.height
+            .region_height = r->rasterizer.height,
+            .show_region = false,
+            .capture_image = false,
+            .allocate_resources = true
         };
-
-        pTextureDesc->release();
     }
     else
     {
@@ -426,79 +897,235 @@ void od_init_screenshot_resources(struct onedraw* r)
 void od_create_atlas(struct onedraw* r, uint32_t width, uint32_t height, uint32_t slice_count)
 {
     assert_msg(slice_count < UINT8_MAX, "too many slices");
-    MTL::TextureDescriptor* desc = MTL::TextureDescriptor::alloc()->init();
-    desc->setTextureType(MTL::TextureType2DArray);
-    desc->setPixelFormat(MTL::PixelFormat::PixelFormatRGBA8Unorm_sRGB);
-    desc->setWidth(width);
-    desc->setHeight(height);
-    desc->setArrayLength(slice_count);
-    desc->setMipmapLevelCount(1);
-    desc->setUsage(MTL::TextureUsageShaderRead);
-    desc->setStorageMode(MTL::StorageModeShared);
+    r->rasterizer.num_slices = slice_count;
+    r->rasterizer.slice_num_pixels = width * height;
+    r->rasterizer.atlas_half_texel = (float2) {.x = .5f / (float)width, .y = .5f / (float)height};
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+    {
+        MTL::TextureDescriptor* desc = MTL::TextureDescriptor::alloc()->init();
+        desc->setTextureType(MTL::TextureType2DArray);
+        desc->setPixelFormat(MTL::PixelFormat::PixelFormatRGBA8Unorm_sRGB);
+        desc->setWidth(width);
+        desc->setHeight(height);
+        desc->setArrayLength(slice_count);
+        desc->setMipmapLevelCount(1);
+        desc->setUsage(MTL::TextureUsageShaderRead);
+        desc->setStorageMode(MTL::StorageModeShared);
+
+        r->rasterizer.atlas = r->device->newTexture(desc);
+        desc->release();
+
+        if (r->rasterizer.atlas == nullptr)
+            od_log(r, "can't create texture array (width:%u height:%u slice_count%u)", width, height, slice_count);
+        return;
+    }
+#endif
 
-    r->rasterizer.atlas = r->device->newTexture(desc);
-    desc->release();
+    size_t size = (size_t)width * height * slice_count * 4;
+    r->cpu.atlas = (cpu::texture) {.pixels = (uint8_t*) calloc(size, 1), .width = width, .height = height, .num_slices = slice_count};
 
-    if (r->rasterizer.atlas == nullptr)
-        od_log(r, "can't create texture array (width:%u height:%u slice_count%u)", width, height, slice_count);
+    if (r->cpu.atlas.pixels == nullptr)
+        od_log(r, "can't allocate texture array (width:%u height:%u slice_count%u)", width, height, slice_count);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_build_depthstencil_state(struct onedraw* r)
+// fills the glyphs description used by the rasterizer
+static void od_fill_glyphs(struct onedraw* r, font_char* output)
 {
-    MTL::DepthStencilDescriptor* pDsDesc = MTL::DepthStencilDescriptor::alloc()->init();
+    memset(output, 0, sizeof(font_char) * MAX_FONT_SLOTS);
+    for(uint32_t i=0; i<r->font.desc.num_glyphs; i++)
+    {
+        const od_glyph& glyph = r->font.desc.glyphs[i];
+        const float texture_height = float(r->font.desc.texture_height * FONT_PLANES);
+        output[i] = 
+        {
+            .uv_topleft = {.x = float(glyph.x0) / float(r->font.desc.texture_width), 
+                           .y = float(glyph.y0) / texture_height},
+            .uv_bottomright = {.x = float(glyph.x1) / float(r->font.desc.texture_width),
+                               .y = float(glyph.y1) / texture_height},
+            .width = glyph.width,
+            .height = glyph.height,
+            .top = glyph.bearing_y + r->font.desc.font_height,
+            .distance_range = r->font.desc.distance_range
+        };
+    }
+}
 
-    pDsDesc->setDepthCompareFunction(MTL::CompareFunction::CompareFunctionAlways);
-    pDsDesc->setDepthWriteEnabled(false);
+//----------------------------------------------------------------------------------------------------------------------------
+// fills the arguments shared by the metal and the cpu backend
+static void od_fill_draw_arguments(struct onedraw* r, draw_cmd_arguments* args)
+{
+    if (r->rasterizer.srgb_backbuffer)
+        args->clear_color = r->rasterizer.clear_color;
+    else
+    {
+        // clear color for the shader is linear the backbuffer is linear as we do
+        // the conversion to srgb at the end of the fragment
+        args->clear_color.x = srgb_to_linear(r->rasterizer.clear_color.x);
+        args->clear_color.y = srgb_to_linear(r->rasterizer.clear_color.y);
+        args->clear_color.z = srgb_to_linear(r->rasterizer.clear_color.z);
+        args->clear_color.w = r->rasterizer.clear_color.w;
+    }
+    args->aa_width = r->rasterizer.aa_width;
+    args->wide_aabb = r->commands.wide_aabb;
+    args->max_nodes = r->limits.max_nodes;
+    args->num_commands = r->commands.count;
+    args->num_tile_height = r->tiles.num_height;
+    args->num_tile_width = r->tiles.num_width;
+    args->num_region_width = r->regions.num_width;
+    args->num_region_height = r->regions.num_height;
+    args->num_groups = r->regions.num_groups;
+    args->screen_div = (float2) {.x = 1.f / (float)r->rasterizer.width, .y = 1.f / (float) r->rasterizer.height};
+    args->atlas_half_texel = r->rasterizer.atlas_half_texel;
+    args->culling_debug = r->tiles.culling_debug;
+    args->srgb_backbuffer = r->rasterizer.srgb_backbuffer;
+    args->load_backbuffer = false;
+    args->num_elements_per_thread = (r->commands.count + MAX_THREADS_PER_THREADGROUP-1) / MAX_THREADS_PER_THREADGROUP;
+}
 
-    r->rasterizer.depth_stencil_state = r->device->newDepthStencilState(pDsDesc);
+//----------------------------------------------------------------------------------------------------------------------------
+static inline quantized_aabb invalid_quantized_aabb()
+{
+    return (quantized_aabb)
+    {
+        .min_x = UINT16_MAX,
+        .min_y = UINT16_MAX,
+        .max_x = 0,
+        .max_y = 0
+    };
+}
 
-    pDsDesc->release();
+//----------------------------------------------------------------------------------------------------------------------------
+// the box is intersected with the visible area (clip shape bounds inside the viewport) so the binning doesn't test
+// regions and tiles the clip rejects, an empty intersection gives an invalid box
+static inline quantized_aabb quantize_aabb(float min_x, float min_y, float max_x, float max_y, aabb visible)
+{
+    min_x = max(min_x, visible.min.x);
+    min_y = max(min_y, visible.min.y);
+    max_x = min(max_x, visible.max.x);
+    max_y = min(max_y, visible.max.y);
+    if (min_x > max_x || min_y > max_y)
+        return invalid_quantized_aabb();
+
+    return (quantized_aabb)
+    {
+        .min_x = uint16_t(min(uint32_t(min_x) / TILE_SIZE, (uint32_t)UINT16_MAX)),
+        .min_y = uint16_t(min(uint32_t(min_y) / TILE_SIZE, (uint32_t)UINT16_MAX)),
+        .max_x = uint16_t(min(uint32_t(max_x) / TILE_SIZE, (uint32_t)UINT16_MAX)),
+        .max_y = uint16_t(min(uint32_t(max_y) / TILE_SIZE, (uint32_t)UINT16_MAX))
+    };
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-static inline uint32_t optimal_num_threads(uint32_t num_elements, uint32_t simd_group_size, uint32_t max_threads)
+// the opposite of load_quantized_aabb(), the 8 bits coordinates are clamped (an invalid box stays invalid)
+static inline void store_quantized_aabb(uint32_t* boxes, uint32_t index, quantized_aabb box, bool wide)
 {
-    uint32_t rounded = (num_elements + simd_group_size - 1) / simd_group_size;
-    rounded *= simd_group_size;
-    return min(rounded, max_threads);
+    if (wide)
+    {
+        boxes[index * 2] = (uint32_t)box.min_x | ((uint32_t)box.min_y << 16);
+        boxes[index * 2 + 1] = (uint32_t)box.max_x | ((uint32_t)box.max_y << 16);
+    }
+    else
+        boxes[index] = min((uint32_t)box.min_x, (uint32_t)UINT8_MAX) | (min((uint32_t)box.min_y, (uint32_t)UINT8_MAX) << 8) |
+                       (min((uint32_t)box.max_x, (uint32_t)UINT8_MAX) << 16) | (min((uint32_t)box.max_y, (uint32_t)UINT8_MAX) << 24);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-static inline void write_quantized_aabb(quantized_aabb* box, float min_x, float min_y, float max_x, float max_y)
+// number of words of a bounding box in the aabb stream
+static inline uint32_t aabb_words(const struct onedraw* r)
 {
-    min_x = max(min_x, 0.f);
-    min_y = max(min_y, 0.f);
-    max_x = max(max_x, 0.f);
-    max_y = max(max_y, 0.f);
-    box->min_x = uint8_t(min(uint32_t(min_x) / TILE_SIZE, (uint32_t)UINT8_MAX));
-    box->min_y = uint8_t(min(uint32_t(min_y) / TILE_SIZE, (uint32_t)UINT8_MAX));
-    box->max_x = uint8_t(min(uint32_t(max_x) / TILE_SIZE, (uint32_t)UINT8_MAX));
-    box->max_y = uint8_t(min(uint32_t(max_y) / TILE_SIZE, (uint32_t)UINT8_MAX));
+    return r->commands.wide_aabb ? 2 : 1;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-static inline void merge_quantized_aabb(quantized_aabb* merge, const quantized_aabb* other)
+// makes room for [num_commands] more commands and [num_data] more floats of draw data, the capacities double until they
+// fit and are kept for the next frames. false if the frame would go past MAX_FRAME_COMMANDS or out of memory
+static bool od_grow_commands(struct onedraw* r, size_t num_commands, size_t num_data)
 {
-    if (merge != nullptr)
+    const size_t commands = r->commands.buffer.GetNumElements() + num_commands;
+    const size_t data = r->commands.data_buffer.GetNumElements() + num_data;
+    if (commands <= r->limits.max_commands && data <= r->limits.max_draw_data)
+        return true;
+
+    if (commands > MAX_FRAME_COMMANDS || data > MAX_FRAME_DRAW_DATA)
+        return false;
+
+    const uint32_t max_commands = od_grow_capacity(r->limits.max_commands, (uint32_t) commands, MAX_FRAME_COMMANDS);
+    const uint32_t max_draw_data = od_grow_capacity(r->limits.max_draw_data, (uint32_t) data, MAX_FRAME_DRAW_DATA);
+
+    // colors and aabbs have the same capacity as the commands
+    const uint32_t* previous_aabbs = r->commands.aabb_buffer.GetData();
+    const uint32_t frame = r->stats.frame_index;
+    bool grown = r->commands.buffer.Grow(max_commands, frame) && r->commands.colors.Grow(max_commands, frame) &&
+                 r->commands.aabb_buffer.Grow(max_commands * aabb_words(r), frame) &&
+                 r->commands.data_buffer.Grow(max_draw_data, frame);
+
+    if (grown && r->list.boxes != nullptr)
+    {
+        aabb* boxes = (aabb*) realloc(r->list.boxes, sizeof(aabb) * max_commands);
+        grown = (boxes != nullptr);
+        r->list.boxes = (boxes != nullptr) ? boxes : r->list.boxes;
+    }
+
+    // the box of the open group is written when the group ends
+    if (r->commands.group_aabb != nullptr)
+        r->commands.group_aabb = r->commands.aabb_buffer.GetData() + (r->commands.group_aabb - previous_aabbs);
+
+    if (!grown)
     {
-        merge->min_x = min(merge->min_x, other->min_x);
-        merge->min_y = min(merge->min_y, other->min_y);
-        merge->max_x = max(merge->max_x, other->max_x);
-        merge->max_y = max(merge->max_y, other->max_y);
+        od_log(r, "can't grow the command buffers to %u commands", max_commands);
+        return false;
     }
+
+    r->limits.max_commands = max_commands;
+    r->limits.max_draw_data = max_draw_data;
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-static inline quantized_aabb invalid_quantized_aabb()
+static inline quantized_aabb write_quantized_aabb(const struct onedraw* r, uint32_t* boxes, uint32_t index,
+                                                  float min_x, float min_y, float max_x, float max_y)
 {
-    return (quantized_aabb)
-    {
-        .min_x = UINT8_MAX,
-        .min_y = UINT8_MAX,
-        .max_x = 0,
-        .max_y = 0
-    };
+    quantized_aabb box = quantize_aabb(min_x, min_y, max_x, max_y, r->commands.visible);
+    store_quantized_aabb(boxes, index, box, r->commands.wide_aabb);
+    return box;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline void merge_quantized_aabb(quantized_aabb* merge, quantized_aabb other)
+{
+    merge->min_x = min(merge->min_x, other.min_x);
+    merge->min_y = min(merge->min_y, other.min_y);
+    merge->max_x = max(merge->max_x, other.max_x);
+    merge->max_y = max(merge->max_y, other.max_y);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// metal backend
+// ---------------------------------------------------------------------------------------------------------------------------
+#ifdef ONEDRAW_METAL
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_build_depthstencil_state(struct onedraw* r)
+{
+    MTL::DepthStencilDescriptor* pDsDesc = MTL::DepthStencilDescriptor::alloc()->init();
+
+    pDsDesc->setDepthCompareFunction(MTL::CompareFunction::CompareFunctionAlways);
+    pDsDesc->setDepthWriteEnabled(false);
+
+    r->rasterizer.depth_stencil_state = r->device->newDepthStencilState(pDsDesc);
+
+    pDsDesc->release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline uint32_t optimal_num_threads(uint32_t num_elements, uint32_t simd_group_size, uint32_t max_threads)
+{
+    uint32_t rounded = (num_elements + simd_group_size - 1) / simd_group_size;
+    rounded *= simd_group_size;
+    return min(rounded, max_threads);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
@@ -543,7 +1170,8 @@ void od_build_pso(struct onedraw* r)
         MTL::ArgumentEncoder* inputArgumentEncoder = pTileBinningFunction->newArgumentEncoder(0);
         MTL::ArgumentEncoder* outputArgumentEncoder = pTileBinningFunction->newArgumentEncoder(1);
 
-        r->commands.draw_arg.Init(r->device, inputArgumentEncoder->encodedLength());
+        assert(inputArgumentEncoder->encodedLength() <= od_pass_arguments_offset(1));
+        r->commands.draw_arg.Init(r->device, od_pass_arguments_offset(MAX_BINNING_PASSES));
         r->commands.bin_output_arg.Init(r->device, outputArgumentEncoder->encodedLength());
 
         pTileBinningFunction->release();
@@ -607,7 +1235,7 @@ void od_build_font(struct onedraw* r)
 {
     MTL::TextureDescriptor* pTextureDesc = MTL::TextureDescriptor::alloc()->init();
     pTextureDesc->setWidth(r->font.desc.texture_width);
-    pTextureDesc->setHeight(r->font.desc.texture_height);
+    pTextureDesc->setHeight(r->font.desc.texture_height * FONT_PLANES);
     pTextureDesc->setPixelFormat(MTL::PixelFormatBC4_RUnorm);
     pTextureDesc->setTextureType(MTL::TextureType2D);
     pTextureDesc->setMipmapLevelCount(1);
@@ -617,92 +1245,80 @@ void od_build_font(struct onedraw* r)
     r->font.texture = r->device->newTexture(pTextureDesc);
     r->font.texture->replaceRegion( MTL::Region(
         0, 0, 0,
-        r->font.desc.texture_width, r->font.desc.texture_height, 1 ),
+        r->font.desc.texture_width, r->font.desc.texture_height * FONT_PLANES, 1 ),
         0, default_font_atlas, (r->font.desc.texture_width/4) * 8);
     pTextureDesc->release();
 
     // fill the glyph description to be upload on the gpu
-    font_char cpu_buffer[MAX_GLYPHS];
-    for(uint32_t i=0; i<r->font.desc.num_glyphs; i++)
-    {
-        const od_glyph& glyph = r->font.desc.glyphs[i];
-        cpu_buffer[i] = 
-        {
-            .width = float(glyph.x1 - glyph.x0),
-            .height = float(glyph.y1 - glyph.y0),
-            .uv_topleft = {.x = float(glyph.x0) / float(r->font.desc.texture_width), 
-                           .y = float(glyph.y0) / float(r->font.desc.texture_height)},
-            .uv_bottomright = {.x = float(glyph.x1) / float(r->font.desc.texture_width),
-                               .y = float(glyph.y1) / float(r->font.desc.texture_height)}
-        };
-    }
+    font_char cpu_buffer[MAX_FONT_SLOTS];
+    od_fill_glyphs(r, cpu_buffer);
     r->font.glyphs = r->device->newBuffer(cpu_buffer, sizeof(cpu_buffer), MTL::ResourceStorageModeShared);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_bin_commands(struct onedraw* r)
+// atlas of a loaded font, starts empty and receives the glyphs one cell at a time
+void od_metal_build_font_atlas(struct onedraw* r, uint32_t size)
 {
-    if (r->tiles.binning_pso == nullptr || r->regions.binning_pso == nullptr || r->regions.exclusive_scan_pso == nullptr)
-        return;
-
-    assert(r->commands.buffer.GetNumElements() == r->commands.colors.GetNumElements());
-    assert(r->commands.buffer.GetNumElements() == r->commands.aabb_buffer.GetNumElements());
+    SAFE_RELEASE(r->font.texture);
 
-    // clear buffers
+    MTL::TextureDescriptor* pTextureDesc = MTL::TextureDescriptor::alloc()->init();
+    pTextureDesc->setWidth(size);
+    pTextureDesc->setHeight(size * FONT_PLANES);
+    pTextureDesc->setPixelFormat(MTL::PixelFormatR8Unorm);
+    pTextureDesc->setTextureType(MTL::TextureType2D);
+    pTextureDesc->setMipmapLevelCount(1);
+    pTextureDesc->setUsage(MTL::ResourceUsageRead);
+    pTextureDesc->setStorageMode(MTL::StorageModeShared);
+    r->font.texture = r->device->newTexture(pTextureDesc);
+    pTextureDesc->release();
+
+    uint8_t* zeros = (uint8_t*) calloc(size, size * FONT_PLANES);
+    if (zeros != nullptr)
+        r->font.texture->replaceRegion(MTL::Region(0, 0, 0, size, size * FONT_PLANES, 1), 0, zeros, size);
+    free(zeros);
+
+    memset(r->font.glyphs->contents(), 0, sizeof(font_char) * MAX_FONT_SLOTS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// [pixels] holds the FONT_PLANES planes of the cell one after the other
+void od_metal_upload_glyph(struct onedraw* r, uint32_t slot, uint32_t x, uint32_t y, uint32_t size, const uint8_t* pixels,
+                           const font_char* glyph)
+{
+    const uint32_t plane_height = uint32_t(r->font.texture->height()) / FONT_PLANES;
+    for(uint32_t plane=0; plane<FONT_PLANES; ++plane)
+        r->font.texture->replaceRegion(MTL::Region(x, y + plane * plane_height, 0, size, size, 1), 0, &pixels[plane * size * size], size);
+    ((font_char*) r->font.glyphs->contents())[slot] = *glyph;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// bins the commands of the pass whose arguments are already written in the argument buffer
+void od_bin_commands(struct onedraw* r, const draw_cmd_arguments* args, uint32_t pass)
+{
+    if (r->tiles.binning_pso == nullptr || r->regions.binning_pso == nullptr || r->regions.exclusive_scan_pso == nullptr)
+        return;
+
+    // clear buffers
     MTL::BlitCommandEncoder* blit_encoder = r->command_buffer->blitCommandEncoder();
     blit_encoder->fillBuffer(r->tiles.counters_buffer, NS::Range(0, r->tiles.counters_buffer->length()), 0);
     blit_encoder->fillBuffer(r->tiles.head, NS::Range(0, r->tiles.head->length()), 0xff);
     blit_encoder->fillBuffer(r->regions.indices, NS::Range(0, r->regions.indices->length()), 0xff);
     blit_encoder->endEncoding();
 
-
-    // fill common structures
-    draw_cmd_arguments* args = r->commands.draw_arg.Map(r->stats.frame_index);
-
-    if (r->rasterizer.srgb_backbuffer)
-        args->clear_color = r->rasterizer.clear_color;
-    else
-    {
-        // clear color for the shader is linear the backbuffer is linear as we do
-        // the conversion to srgb at the end of the fragment
-        args->clear_color.x = srgb_to_linear(r->rasterizer.clear_color.x);
-        args->clear_color.y = srgb_to_linear(r->rasterizer.clear_color.y);
-        args->clear_color.z = srgb_to_linear(r->rasterizer.clear_color.z);
-        args->clear_color.w = r->rasterizer.clear_color.w;
-    }
-    args->aa_width = r->rasterizer.aa_width;
-    args->commands_aabb = (quantized_aabb*) r->commands.aabb_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
-    args->commands = (draw_command*) r->commands.buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
-    args->colors = (draw_color*) r->commands.colors.GetBuffer(r->stats.frame_index)->gpuAddress();
-    args->draw_data = (float*) r->commands.data_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
-    args->clips = (clip_shape*) r->commands.clipshapes_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
-    args->glyphs = (font_char*) r->font.glyphs->gpuAddress();
-    args->font = r->font.texture->gpuResourceID()._impl;
-    args->atlas = r->rasterizer.atlas->gpuResourceID()._impl;
-    args->max_nodes = MAX_NODES_COUNT;
-    args->num_commands = r->commands.count;
-    args->num_tile_height = r->tiles.num_height;
-    args->num_tile_width = r->tiles.num_width;
-    args->num_region_width = r->regions.num_width;
-    args->num_region_height = r->regions.num_height;
-    args->num_groups = r->regions.num_groups;
-    args->screen_div = (float2) {.x = 1.f / (float)r->rasterizer.width, .y = 1.f / (float) r->rasterizer.height};
-    args->culling_debug = r->tiles.culling_debug;
-    args->srgb_backbuffer = r->rasterizer.srgb_backbuffer;
-    args->num_elements_per_thread = (r->commands.count + MAX_THREADS_PER_THREADGROUP-1) / MAX_THREADS_PER_THREADGROUP;
-
+    const uint32_t num_commands = args->num_commands;
+    const size_t args_offset = od_pass_arguments_offset(pass);
     const uint32_t simd_group_count = MAX_THREADS_PER_THREADGROUP / SIMD_GROUP_SIZE;
-    const uint32_t threads_for_commands = optimal_num_threads(r->commands.count, SIMD_GROUP_SIZE, MAX_THREADS_PER_THREADGROUP);
+    const uint32_t threads_for_commands = optimal_num_threads(num_commands, SIMD_GROUP_SIZE, MAX_THREADS_PER_THREADGROUP);
 
     // predicate
     MTL::ComputeCommandEncoder* compute_encoder = r->command_buffer->computeCommandEncoder();
     compute_encoder->setComputePipelineState(r->regions.predicate_pso);
-    compute_encoder->setBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), 0, 0);
+    compute_encoder->setBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), args_offset, 0);
     compute_encoder->setBuffer(r->regions.predicate, 0, 1);
     compute_encoder->useResource(r->commands.aabb_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-    compute_encoder->dispatchThreads(MTL::Size(r->commands.count, 1, 1), MTL::Size(threads_for_commands, 1, 1));
+    compute_encoder->dispatchThreads(MTL::Size(num_commands, 1, 1), MTL::Size(threads_for_commands, 1, 1));
 
-    uint32_t threads_per_region = (r->commands.count + args->num_elements_per_thread - 1) / args->num_elements_per_thread;
+    uint32_t threads_per_region = (num_commands + args->num_elements_per_thread - 1) / args->num_elements_per_thread;
 
     compute_encoder->setComputePipelineState(r->regions.exclusive_scan_pso);
     compute_encoder->setBuffer(r->regions.scan, 0, 2);
@@ -714,16 +1330,10 @@ void od_bin_commands(struct onedraw* r)
     compute_encoder->setComputePipelineState(r->regions.binning_pso);
     compute_encoder->setBuffer(r->regions.indices, 0, 1);
     compute_encoder->setBuffer(r->regions.predicate, 0, 3);
-    compute_encoder->dispatchThreads(MTL::Size(r->commands.count, r->regions.count, 1), MTL::Size(16, 16, 1));
+    compute_encoder->dispatchThreads(MTL::Size(num_commands, r->regions.count, 1), MTL::Size(16, 16, 1));
 
     // tile binning
     compute_encoder->setComputePipelineState(r->tiles.binning_pso);
-
-    tiles_data* output = (tiles_data*) r->commands.bin_output_arg.Map(r->stats.frame_index);
-    output->head = (uint32_t*) r->tiles.head->gpuAddress();
-    output->nodes = (tile_node*) r->tiles.nodes->gpuAddress();
-    output->tile_indices = (uint16_t*) r->tiles.indices->gpuAddress();
-
     compute_encoder->setBuffer(r->commands.bin_output_arg.GetBuffer(r->stats.frame_index), 0, 1);
     compute_encoder->setBuffer(r->tiles.counters_buffer, 0, 2);
     compute_encoder->setBuffer(r->regions.indices, 0, 3);
@@ -731,6 +1341,7 @@ void od_bin_commands(struct onedraw* r)
     compute_encoder->useResource(r->commands.buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
     compute_encoder->useResource(r->commands.data_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
     compute_encoder->useResource(r->commands.clipshapes_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+    compute_encoder->useResource(r->font.glyphs, MTL::ResourceUsageRead);
     compute_encoder->useResource(r->tiles.head, MTL::ResourceUsageRead|MTL::ResourceUsageWrite);
     compute_encoder->useResource(r->tiles.nodes, MTL::ResourceUsageWrite);
     compute_encoder->useResource(r->tiles.indices, MTL::ResourceUsageWrite);
@@ -741,6 +1352,11 @@ void od_bin_commands(struct onedraw* r)
     compute_encoder->useResource(r->tiles.indirect_cb, MTL::ResourceUsageWrite);
     compute_encoder->dispatchThreads(MTL::Size(1, 1, 1), MTL::Size(1, 1, 1));
     compute_encoder->endEncoding();
+
+    // counters are read back for the stats at the end of the frame, one slot per pass
+    blit_encoder = r->command_buffer->blitCommandEncoder();
+    blit_encoder->copyFromBuffer(r->tiles.counters_buffer, 0, r->tiles.counters_readback, sizeof(counters) * pass, sizeof(counters));
+    blit_encoder->endEncoding();
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
@@ -748,47 +1364,82 @@ void od_flush(struct onedraw* r, void* drawable)
 {
     assert_msg((uint16_t)((CA::MetalDrawable*)drawable)->texture()->width() == r->rasterizer.width, "drawable/renderer size mismatch");
     assert_msg((uint16_t)((CA::MetalDrawable*)drawable)->texture()->height() == r->rasterizer.height, "drawable/renderer size mismatch");
+    assert(r->commands.buffer.GetNumElements() == r->commands.colors.GetNumElements());
+    assert(r->commands.buffer.GetNumElements() * aabb_words(r) == r->commands.aabb_buffer.GetNumElements());
 
     r->command_buffer = r->command_queue->commandBuffer();
 
     dispatch_semaphore_wait(r->semaphore, DISPATCH_TIME_FOREVER);
 
-    if (r->commands.count)
-        od_bin_commands(r);
+    // arguments of the whole frame, restricted to the commands of each pass
+    draw_cmd_arguments frame;
+    od_fill_draw_arguments(r, &frame);
+    frame.commands_aabb = (uint32_t*) r->commands.aabb_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
+    frame.commands = (draw_command*) r->commands.buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
+    frame.colors = (draw_color*) r->commands.colors.GetBuffer(r->stats.frame_index)->gpuAddress();
+    frame.draw_data = (float*) r->commands.data_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
+    frame.clips = (clip_shape*) r->commands.clipshapes_buffer.GetBuffer(r->stats.frame_index)->gpuAddress();
+    frame.glyphs = (font_char*) r->font.glyphs->gpuAddress();
+    frame.font = r->font.texture->gpuResourceID()._impl;
+    frame.atlas = r->rasterizer.atlas->gpuResourceID()._impl;
+
+    uint8_t* arguments = (uint8_t*) r->commands.draw_arg.Map(r->stats.frame_index);
+    tiles_data* output = (tiles_data*) r->commands.bin_output_arg.Map(r->stats.frame_index);
+    output->head = (uint32_t*) r->tiles.head->gpuAddress();
+    output->nodes = (tile_node*) r->tiles.nodes->gpuAddress();
+    output->tile_indices = (uint32_t*) r->tiles.indices->gpuAddress();
 
     MTL::RenderPassDescriptor* renderPassDescriptor = MTL::RenderPassDescriptor::alloc()->init();
     MTL::RenderPassColorAttachmentDescriptor* cd = renderPassDescriptor->colorAttachments()->object(0);
     cd->setTexture(((CA::MetalDrawable*)drawable)->texture());
-    cd->setLoadAction(MTL::LoadActionClear);
     cd->setClearColor(MTL::ClearColor(r->rasterizer.clear_color.x, r->rasterizer.clear_color.y, r->rasterizer.clear_color.z, r->rasterizer.clear_color.w));
     cd->setStoreAction(MTL::StoreActionStore);
 
-    MTL::RenderCommandEncoder* render_encoder = r->command_buffer->renderCommandEncoder(renderPassDescriptor);
-    if (r->commands.count)
-    {
-        render_encoder->setViewport((MTL::Viewport){.originX = 0, .originY = 0, .width = (double)r->rasterizer.width, .height = (double)r->rasterizer.height});
-        render_encoder->setCullMode(MTL::CullModeNone);
-        render_encoder->setDepthStencilState(r->rasterizer.depth_stencil_state);
-        render_encoder->setVertexBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), 0, 0);
-        render_encoder->setVertexBuffer(r->tiles.indices, 0, 1);
-        render_encoder->setFragmentBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), 0, 0);
-        render_encoder->setFragmentBuffer(r->commands.bin_output_arg.GetBuffer(r->stats.frame_index), 0, 1);
-        render_encoder->useResource(r->commands.draw_arg.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-        render_encoder->useResource(r->commands.buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-        render_encoder->useResource(r->commands.colors.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-        render_encoder->useResource(r->commands.data_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-        render_encoder->useResource(r->commands.clipshapes_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
-        render_encoder->useResource(r->tiles.head, MTL::ResourceUsageRead);
-        render_encoder->useResource(r->tiles.nodes, MTL::ResourceUsageRead);
-        render_encoder->useResource(r->tiles.indices, MTL::ResourceUsageRead);
-        render_encoder->useResource(r->tiles.indirect_cb, MTL::ResourceUsageRead);
-        render_encoder->useResource(r->font.texture, MTL::ResourceUsageRead);
-        if (r->rasterizer.atlas != nullptr)
-            render_encoder->useResource(r->rasterizer.atlas, MTL::ResourceUsageRead);
-        render_encoder->setRenderPipelineState(r->rasterizer.pso);
-        render_encoder->executeCommandsInBuffer(r->tiles.indirect_cb, NS::Range(0, 1));
-    }
-    render_encoder->endEncoding();
+    // a frame with more commands than a pass can bin is rendered in several passes, each one over the previous
+    uint32_t num_passes = 0;
+    uint32_t first = 0;
+    do
+    {
+        const uint32_t count = od_pass_size(r->commands.buffer.GetData(), first, r->commands.count);
+        const size_t args_offset = od_pass_arguments_offset(num_passes);
+        draw_cmd_arguments* args = (draw_cmd_arguments*) (arguments + args_offset);
+        od_set_pass_arguments(args, &frame, first, count, num_passes);
+
+        if (count)
+            od_bin_commands(r, args, num_passes);
+
+        cd->setLoadAction((num_passes == 0) ? MTL::LoadActionClear : MTL::LoadActionLoad);
+        MTL::RenderCommandEncoder* render_encoder = r->command_buffer->renderCommandEncoder(renderPassDescriptor);
+        if (count)
+        {
+            render_encoder->setViewport((MTL::Viewport){.originX = 0, .originY = 0, .width = (double)r->rasterizer.width, .height = (double)r->rasterizer.height});
+            render_encoder->setCullMode(MTL::CullModeNone);
+            render_encoder->setDepthStencilState(r->rasterizer.depth_stencil_state);
+            render_encoder->setVertexBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), args_offset, 0);
+            render_encoder->setVertexBuffer(r->tiles.indices, 0, 1);
+            render_encoder->setFragmentBuffer(r->commands.draw_arg.GetBuffer(r->stats.frame_index), args_offset, 0);
+            render_encoder->setFragmentBuffer(r->commands.bin_output_arg.GetBuffer(r->stats.frame_index), 0, 1);
+            render_encoder->useResource(r->commands.draw_arg.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+            render_encoder->useResource(r->commands.buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+            render_encoder->useResource(r->commands.colors.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+            render_encoder->useResource(r->commands.data_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+            render_encoder->useResource(r->commands.clipshapes_buffer.GetBuffer(r->stats.frame_index), MTL::ResourceUsageRead);
+            render_encoder->useResource(r->tiles.head, MTL::ResourceUsageRead);
+            render_encoder->useResource(r->tiles.nodes, MTL::ResourceUsageRead);
+            render_encoder->useResource(r->tiles.indices, MTL::ResourceUsageRead);
+            render_encoder->useResource(r->tiles.indirect_cb, MTL::ResourceUsageRead);
+            render_encoder->useResource(r->font.texture, MTL::ResourceUsageRead);
+            render_encoder->useResource(r->font.glyphs, MTL::ResourceUsageRead);
+            if (r->rasterizer.atlas != nullptr)
+                render_encoder->useResource(r->rasterizer.atlas, MTL::ResourceUsageRead);
+            render_encoder->setRenderPipelineState(r->rasterizer.pso);
+            render_encoder->executeCommandsInBuffer(r->tiles.indirect_cb, NS::Range(0, 1));
+        }
+        render_encoder->endEncoding();
+
+        first += count;
+        num_passes++;
+    } while (first < r->commands.count && num_passes < MAX_BINNING_PASSES);
 
     const bool take_screenshot = (r->screenshot.out_pixels != nullptr) && (r->screenshot.capture_image) && (r->screenshot.texture != nullptr);
 
@@ -820,48 +1471,47 @@ void od_flush(struct onedraw* r, void* drawable)
     r->command_buffer->commit();
     r->command_buffer->waitUntilCompleted();
 
-    renderPassDescriptor->release();
-}
+    binning_totals totals = {};
+    uint32_t max_requested_nodes = 0;
+    const counters* readback = (const counters*) r->tiles.counters_readback->contents();
+    for(uint32_t pass=0; pass<num_passes && r->commands.count; ++pass)
+    {
+        od_add_binning_pass(r, &totals, readback[pass].num_nodes, readback[pass].num_tiles, readback[pass].max_tile_nodes);
+        max_requested_nodes = max(max_requested_nodes, readback[pass].num_nodes);
+    }
+    od_update_binning_stats(r, &totals);
 
-// ---------------------------------------------------------------------------------------------------------------------------
-// public functions
-// ---------------------------------------------------------------------------------------------------------------------------
+    // the frame is already presented, the next ones get enough nodes
+    uint32_t max_nodes = od_grow_capacity(r->limits.max_nodes, max_requested_nodes, MAX_FRAME_NODES);
+    if (max_nodes != r->limits.max_nodes)
+    {
+        MTL::Buffer* nodes = r->device->newBuffer(sizeof(tile_node) * max_nodes, MTL::ResourceStorageModePrivate);
+        if (nodes != nullptr)
+        {
+            r->tiles.nodes->release();
+            r->tiles.nodes = nodes;
+            r->limits.max_nodes = max_nodes;
+        }
+    }
 
-//----------------------------------------------------------------------------------------------------------------------------
-size_t od_min_memory_size(void)
-{
-    return sizeof(struct onedraw);
+    renderPassDescriptor->release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-struct onedraw* od_init(onedraw_def* def)
+void od_metal_init(struct onedraw* r)
 {
-    assert_msg(def->preallocated_buffer != nullptr, "forgot to allocate memory?");
-    assert_msg(((uintptr_t)def->preallocated_buffer)%sizeof(uintptr_t) == 0, "preallocated_buffer must be aligned on sizeof(uintptr_t)");
-    assert(def->metal_device != nullptr);
-    assert_msg(((MTL::Device*)def->metal_device)->supportsFamily(MTL::GPUFamilyApple7), "onedraw supports only M1/A14 GPU and later");
-
-    onedraw* r = new(def->preallocated_buffer) onedraw;
+    assert_msg(r->device->supportsFamily(MTL::GPUFamilyApple7), "onedraw supports only M1/A14 GPU and later");
 
-    r->custom_log = def->log_func;
-    r->device = (MTL::Device*)def->metal_device;
     r->command_queue = r->device->newCommandQueue();
-    r->screenshot.allocate_resources = def->allow_screenshot;
-    r->rasterizer.srgb_backbuffer = def->srgb_backbuffer;
-
     if (r->command_queue == nullptr)
     {
         od_log(r, "can't create a command queue");
         exit(EXIT_FAILURE);
     }
 
-    r->commands.buffer.Init(r->device, sizeof(draw_command) * MAX_COMMANDS);
-    r->commands.colors.Init(r->device, sizeof(draw_color) * MAX_COMMANDS);
-    r->commands.data_buffer.Init(r->device, sizeof(float) * MAX_DRAWDATA);
-    r->commands.aabb_buffer.Init(r->device, sizeof(quantized_aabb) * MAX_COMMANDS);
-    r->commands.clipshapes_buffer.Init(r->device, sizeof(clip_shape) * MAX_CLIPS);
     r->tiles.counters_buffer = r->device->newBuffer(sizeof(counters), MTL::ResourceStorageModePrivate);
-    r->tiles.nodes = r->device->newBuffer(sizeof(tile_node) * MAX_NODES_COUNT, MTL::ResourceStorageModePrivate);
+    r->tiles.counters_readback = r->device->newBuffer(sizeof(counters) * MAX_BINNING_PASSES, MTL::ResourceStorageModeShared);
+    r->tiles.nodes = r->device->newBuffer(sizeof(tile_node) * r->limits.max_nodes, MTL::ResourceStorageModePrivate);
 
     MTL::IndirectCommandBufferDescriptor* icb_desc = MTL::IndirectCommandBufferDescriptor::alloc()->init();
     icb_desc->setCommandTypes(MTL::IndirectCommandTypeDraw);
@@ -873,88 +1523,20 @@ struct onedraw* od_init(onedraw_def* def)
     icb_desc->release();
 
     r->semaphore = dispatch_semaphore_create(DynamicBuffer<float>::MaxInflightBuffers);
-    r->stats.average_gpu_time = 0.f;
-    r->stats.accumulated_gpu_time = 0.f;
-    atomic_store(&r->stats.gpu_time, 0.f);
-
-    assert(sizeof(alphabet) == default_font_size);
-    r->font.desc = *((alphabet*) default_font);
 
     od_build_pso(r);
     od_build_font(r);
     od_build_depthstencil_state(r);
-    od_resize(r, def->viewport_width, def->viewport_height);
-
-    if (def->atlas.width != 0)
-        od_create_atlas(r, def->atlas.width, def->atlas.height, def->atlas.num_slices);
-
-    return r;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_upload_slice(struct onedraw* r, const void* pixel_data, uint32_t slice_index)
-{
-    assert_msg(slice_index<r->rasterizer.atlas->arrayLength(), "slice_index is out of bound");
-
-    const NS::UInteger bpp = 4;   // MTL::PixelFormat::PixelFormatRGBA8Unorm_sRGB
-    const NS::UInteger bytes_per_row = r->rasterizer.atlas->width() * bpp;
-
-    MTL::Region region = MTL::Region::Make2D(0, 0, r->rasterizer.atlas->width(), r->rasterizer.atlas->height());
-
-    r->rasterizer.atlas->replaceRegion(
-        region,
-        0,  // no mipmap
-        slice_index,
-        pixel_data,
-        bytes_per_row,
-        bytes_per_row * r->rasterizer.atlas->height()
-    );
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_set_capture_region(struct onedraw* r, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
-{
-    assert_msg(x<=r->rasterizer.width && width<=r->rasterizer.width && y<=r->rasterizer.height && height<=r->rasterizer.height,
-               "capture region cannot be bigger than the rendertarget");
-    r->screenshot.region_x = x;
-    r->screenshot.region_y = y;
-    r->screenshot.region_width = width;
-    r->screenshot.region_height = height;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_get_capture_region_dimensions(struct onedraw *r, uint32_t* width, uint32_t* height)
-{
-    *width = r->screenshot.region_width;
-    *height = r->screenshot.region_height;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_take_screenshot(struct onedraw* r, void* out_pixels)
-{
-    assert_msg(r->screenshot.texture != nullptr, "set allow_screenshot to true when calling od_init()");
-    r->screenshot.capture_image = true;
-    r->screenshot.out_pixels = out_pixels;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_resize(struct onedraw* r, uint32_t width, uint32_t height)
+void od_metal_resize(struct onedraw* r)
 {
-    od_log(r, "resizing the framebuffer to %dx%d", width, height);
-    r->rasterizer.width = (uint16_t) width;
-    r->rasterizer.height = (uint16_t) height;
-    r->tiles.num_width = (uint16_t)((width + TILE_SIZE - 1) / TILE_SIZE);
-    r->tiles.num_height = (uint16_t)((height + TILE_SIZE - 1) / TILE_SIZE);
-    r->tiles.count = r->tiles.num_width * r->tiles.num_height;
-    r->regions.num_width = (r->tiles.num_width + REGION_SIZE - 1) / REGION_SIZE;
-    r->regions.num_height = (r->tiles.num_height + REGION_SIZE - 1) / REGION_SIZE;
-    r->regions.count = r->regions.num_width * r->regions.num_height;
-
     SAFE_RELEASE(r->regions.indices);
     SAFE_RELEASE(r->regions.predicate);
     SAFE_RELEASE(r->regions.scan);
 
-    size_t num_indices = r->regions.count * MAX_COMMANDS;
+    size_t num_indices = r->regions.count * r->regions.capacity;
     r->regions.indices = r->device->newBuffer(num_indices * sizeof(uint16_t), MTL::ResourceStorageModePrivate);
     r->regions.predicate = r->device->newBuffer(num_indices * sizeof(uint8_t), MTL::ResourceStorageModePrivate);
     r->regions.scan = r->device->newBuffer(num_indices * sizeof(uint16_t), MTL::ResourceStorageModePrivate);
@@ -962,69 +1544,14 @@ void od_resize(struct onedraw* r, uint32_t width, uint32_t height)
     SAFE_RELEASE(r->tiles.head);
     SAFE_RELEASE(r->tiles.indices);
     r->tiles.head = r->device->newBuffer(r->tiles.count * sizeof(uint32_t), MTL::ResourceStorageModePrivate);
-    r->tiles.indices = r->device->newBuffer(r->tiles.num_width * r->tiles.num_height * sizeof(uint16_t), MTL::ResourceStorageModePrivate);
-
-    od_log(r, "%ux%u tiles", r->tiles.num_width, r->tiles.num_height);
-    od_log(r, "%ux%u regions", r->regions.num_width, r->regions.num_height);
-
-    od_init_screenshot_resources(r);
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_begin_frame(struct onedraw* r)
-{
-    assert_msg(r->commands.group_aabb == nullptr, "previous frame was not ended properly with od_end_frame");
-    r->stats.frame_index++;
-    r->commands.buffer.Map(r->stats.frame_index);
-    r->commands.colors.Map(r->stats.frame_index);
-    r->commands.draw_aabb = r->commands.aabb_buffer.Map(r->stats.frame_index);
-    r->commands.data_buffer.Map(r->stats.frame_index);
-    r->commands.clipshapes_buffer.Map(r->stats.frame_index);
-    od_set_cliprect(r, 0, 0, (uint16_t) r->rasterizer.width, (uint16_t) r->rasterizer.height);
+    r->tiles.indices = r->device->newBuffer(r->tiles.count * sizeof(uint32_t), MTL::ResourceStorageModePrivate);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_end_frame(struct onedraw* r, void* drawable)
-{
-    assert_msg(r->commands.group_aabb == nullptr, "you need to call od_end_group, before od_end_frame");
-    if (r->screenshot.show_region)
-    {
-        aabb capture_region = {.min = {(float)r->screenshot.region_x, (float)r->screenshot.region_y}};
-        capture_region.max = vec2_add(capture_region.min, vec2_set(r->screenshot.region_width, r->screenshot.region_height));
-        od_draw_box(r, capture_region.min.x, capture_region.min.y, capture_region.max.x, capture_region.max.y, 0.f, 0x802020ff);
-    }
-
-    r->commands.count = (uint32_t)r->commands.buffer.GetNumElements();
-    r->stats.peak_num_draw_cmd = max(r->stats.peak_num_draw_cmd, r->commands.count);
-    r->stats.num_draw_data = (uint32_t)r->commands.data_buffer.GetNumElements();
-    r->stats.accumulated_gpu_time += atomic_load(&r->stats.gpu_time);
-    if (r->stats.frame_index%60 == 0)
-    {
-        r->stats.average_gpu_time = r->stats.accumulated_gpu_time / 60.f;
-        r->stats.accumulated_gpu_time = 0;
-    }
-    r->regions.num_groups = (r->commands.count + SIMD_GROUP_SIZE - 1) / SIMD_GROUP_SIZE;
-
-    od_flush(r, drawable);
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-float od_get_average_gputime(struct onedraw* r)
-{
-    return r->stats.average_gpu_time;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-void od_terminate(struct onedraw* r)
+void od_metal_terminate(struct onedraw* r)
 {
-    r->commands.buffer.Terminate();
-    r->commands.colors.Terminate();
-    r->commands.data_buffer.Terminate();
-    r->commands.aabb_buffer.Terminate();
-    r->commands.draw_arg.Terminate();
-    r->commands.bin_output_arg.Terminate();
-    r->commands.clipshapes_buffer.Terminate();
     SAFE_RELEASE(r->tiles.counters_buffer);
+    SAFE_RELEASE(r->tiles.counters_readback);
     SAFE_RELEASE(r->tiles.binning_pso);
     SAFE_RELEASE(r->tiles.head);
     SAFE_RELEASE(r->tiles.nodes);
@@ -1047,811 +1574,3496 @@ void od_terminate(struct onedraw* r)
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_get_stats(struct onedraw* r, od_stats* stats)
+size_t od_metal_memory_usage(struct onedraw* r)
 {
-    stats->frame_index = r->stats.frame_index;
-    stats->num_draw_cmd = r->commands.count, r->commands.buffer.GetMaxElements();
-    stats->peak_num_draw_cmd = r->stats.peak_num_draw_cmd;
-    stats->gpu_time_ms = r->stats.average_gpu_time * 1000.f;
-    size_t gpu_mem = r->commands.aabb_buffer.GetTotalSize();
-    gpu_mem += r->commands.bin_output_arg.GetTotalSize();
-    gpu_mem += r->commands.buffer.GetTotalSize();
-    gpu_mem += r->commands.clipshapes_buffer.GetTotalSize();
-    gpu_mem += r->commands.colors.GetTotalSize();
-    gpu_mem += r->commands.data_buffer.GetTotalSize();
-    gpu_mem += r->commands.draw_arg.GetTotalSize();
-    gpu_mem += r->font.texture->allocatedSize();
+    size_t gpu_mem = r->font.texture->allocatedSize();
     gpu_mem += r->font.glyphs->allocatedSize();
-    gpu_mem += r->rasterizer.atlas->allocatedSize();
+    gpu_mem += (r->rasterizer.atlas != nullptr) ? r->rasterizer.atlas->allocatedSize() : 0;
     gpu_mem += r->regions.indices->allocatedSize();
     gpu_mem += r->regions.predicate->allocatedSize();
     gpu_mem += r->regions.scan->allocatedSize();
     gpu_mem += (r->screenshot.texture != nullptr) ? r->screenshot.texture->allocatedSize() : 0;
     gpu_mem += r->tiles.counters_buffer->allocatedSize();
+    gpu_mem += r->tiles.counters_readback->allocatedSize();
     gpu_mem += r->tiles.head->allocatedSize();
     gpu_mem += r->tiles.indices->allocatedSize();
     gpu_mem += r->tiles.indirect_arg->allocatedSize();
     gpu_mem += r->tiles.nodes->allocatedSize();
-    stats->gpu_memory_usage = gpu_mem;
+    return gpu_mem;
 }
 
+#endif // ONEDRAW_METAL
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// cpu backend
+//      * runs the same kernels as the gpu (see cpu_binning.h and cpu_rasterizer.h) on a pool of threads
+//      * the output is a B8G8R8A8 srgb buffer provided by the user
+// ---------------------------------------------------------------------------------------------------------------------------
+
 //----------------------------------------------------------------------------------------------------------------------------
-void od_begin_group(struct onedraw* r, bool smoothblend, float group_smoothness, float outline_width)
+// decodes the built-in font once, the rasterizer samples a R8 texture holding the FONT_PLANES planes
+void od_cpu_build_font(struct onedraw* r)
 {
-    assert_msg(r->commands.group_aabb == nullptr, "cannot call a second time od_begin_group without closing the previous group");
-    assert_msg(group_smoothness >= 0.f, "smoothness cannot be negative");
-
-    if (!smoothblend)
-        group_smoothness = 0.f;
+    uint32_t font_width = r->font.desc.texture_width;
+    uint32_t font_height = r->font.desc.texture_height * FONT_PLANES;
+    free(r->cpu.font.pixels);
+    r->cpu.font = (cpu::texture) {.pixels = (uint8_t*) malloc(font_width * font_height), .width = font_width, .height = font_height, .num_slices = 1};
+    if (r->cpu.font.pixels != nullptr)
+        cpu::bc4_decode(default_font_atlas, r->cpu.font.pixels, font_width, font_height);
+    od_fill_glyphs(r, r->cpu.glyphs);
+}
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
-    {
-        enum sdf_operator op = smoothblend ? op_blend : op_overwrite;
-        cmd->type = begin_group;
-        cmd->fillmode = fill_solid;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->extra = (uint8_t)op;
-
-        float* data = r->commands.data_buffer.NewMultiple(2);
-        r->commands.group_aabb = r->commands.aabb_buffer.NewElement();
-        
-        if (r->commands.group_aabb != nullptr && data != nullptr)
-        {
-            write_float(data, group_smoothness + outline_width, outline_width);
+//----------------------------------------------------------------------------------------------------------------------------
+void od_cpu_build_font_atlas(struct onedraw* r, uint32_t size)
+{
+    free(r->cpu.font.pixels);
+    r->cpu.font = (cpu::texture) {.pixels = (uint8_t*) calloc(size, size * FONT_PLANES), .width = size, .height = size * FONT_PLANES, .num_slices = 1};
+    memset(r->cpu.glyphs, 0, sizeof(r->cpu.glyphs));
+}
 
-            // keep values for the end group command
-            r->rasterizer.outline_width = outline_width;
-            r->rasterizer.group_smoothness = group_smoothness;
-            r->rasterizer.group_op = op;
+//----------------------------------------------------------------------------------------------------------------------------
+void od_cpu_upload_glyph(struct onedraw* r, uint32_t slot, uint32_t x, uint32_t y, uint32_t size, const uint8_t* pixels,
+                         const font_char* glyph)
+{
+    if (r->cpu.font.pixels == nullptr)
+        return;
 
-            // reserve a aabb that we're going to update depending on the coming shapes
-            *r->commands.group_aabb = invalid_quantized_aabb();
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
-    }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+    const uint32_t plane_height = r->cpu.font.height / FONT_PLANES;
+    for(uint32_t plane=0; plane<FONT_PLANES; ++plane)
+        for(uint32_t row=0; row<size; ++row)
+            memcpy(&r->cpu.font.pixels[(y + plane * plane_height + row) * r->cpu.font.width + x], &pixels[(plane * size + row) * size], size);
+    r->cpu.glyphs[slot] = *glyph;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_end_group(struct onedraw* r, draw_color outline_color)
+void od_cpu_init(struct onedraw* r, uint32_t num_threads)
 {
-    assert(r->commands.group_aabb != nullptr);
+    cpu::init_color_tables();
+    r->cpu.pool.Init(num_threads);
+    r->cpu.nodes = (tile_node*) malloc(sizeof(tile_node) * r->limits.max_nodes);
+    r->cpu.atlas = {};
+    r->cpu.font = {};
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
-    {
-        cmd->type = end_group;
-        cmd->fillmode = (r->rasterizer.outline_width > 0.f) ? fill_outline : fill_solid;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->extra = (uint8_t) r->rasterizer.group_op;
-        *color = outline_color;
+    od_cpu_build_font(r);
 
-        // we put also the smooth value as we traverse the list in reverse order on the gpu
-        float* k = r->commands.data_buffer.NewElement();
+    if (r->cpu.nodes == nullptr || r->cpu.font.pixels == nullptr)
+    {
+        od_log(r, "can't allocate memory for the cpu backend");
+        exit(EXIT_FAILURE);
+    }
 
-        quantized_aabb* aabb = r->commands.aabb_buffer.NewElement();
-        if (aabb != nullptr && k != nullptr)
-        {
-            *aabb = *r->commands.group_aabb;
-            *k = r->rasterizer.group_smoothness + r->rasterizer.outline_width;
+    od_log(r, "cpu backend with %u threads", r->cpu.pool.GetNumThreads());
+}
 
-            r->commands.group_aabb = nullptr;
-            r->rasterizer.group_smoothness = 0.f;
-            r->rasterizer.group_op = op_overwrite;
-            r->rasterizer.outline_width = 0.f;
+//----------------------------------------------------------------------------------------------------------------------------
+void od_cpu_resize(struct onedraw* r)
+{
+    free(r->cpu.predicate);
+    free(r->cpu.scan);
+    free(r->cpu.region_indices);
+    free(r->cpu.head);
+    free(r->cpu.tile_indices);
+    free(r->cpu.tile_costs);
+    free(r->cpu.tile_hashes);
+    free(r->cpu.changed_indices);
+    free(r->cpu.changed_costs);
+    free(r->cpu.command_hashes);
+    free(r->cpu.heatmap);
+
+    size_t num_indices = r->regions.count * r->regions.capacity;
+    r->cpu.predicate = (uint8_t*) malloc(num_indices * sizeof(uint8_t));
+    r->cpu.scan = (uint16_t*) malloc(num_indices * sizeof(uint16_t));
+    r->cpu.region_indices = (uint16_t*) malloc(num_indices * sizeof(uint16_t));
+    r->cpu.head = (uint32_t*) malloc(r->tiles.count * sizeof(uint32_t));
+    r->cpu.tile_indices = (uint32_t*) malloc(r->tiles.count * sizeof(uint32_t));
+    r->cpu.tile_costs = (uint32_t*) malloc(r->tiles.count * sizeof(uint32_t));
+    r->cpu.tile_hashes = nullptr;
+    r->cpu.changed_indices = nullptr;
+    r->cpu.changed_costs = nullptr;
+    r->cpu.command_hashes = nullptr;
+    r->cpu.heatmap = nullptr;
+    r->cpu.num_heatmap_passes = 0;
+    r->cpu.full_redraw = true;
+
+    bool incremental_allocated = true;
+    if (r->cpu.incremental)
+    {
+        r->cpu.tile_hashes = (uint64_t*) malloc(r->tiles.count * sizeof(uint64_t));
+        r->cpu.changed_indices = (uint32_t*) malloc(r->tiles.count * sizeof(uint32_t));
+        r->cpu.changed_costs = (uint32_t*) malloc(r->tiles.count * sizeof(uint32_t));
+        r->cpu.command_hashes = (uint64_t*) malloc(r->regions.capacity * sizeof(uint64_t));
+        incremental_allocated = r->cpu.tile_hashes != nullptr && r->cpu.changed_indices != nullptr && r->cpu.changed_costs != nullptr &&
+                                r->cpu.command_hashes != nullptr;
+    }
 
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+    if (r->cpu.predicate == nullptr || r->cpu.scan == nullptr || r->cpu.region_indices == nullptr ||
+        r->cpu.head == nullptr || r->cpu.tile_indices == nullptr || r->cpu.tile_costs == nullptr || !incremental_allocated)
+    {
+        od_log(r, "can't allocate memory for the cpu backend");
+        exit(EXIT_FAILURE);
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-static inline float draw_cmd_aabb_bump(struct onedraw* r)
+static inline uint64_t hash_combine(uint64_t hash, uint64_t value)
 {
-    float result = r->rasterizer.aa_width + r->rasterizer.outline_width;
-    if (r->rasterizer.group_op == op_blend)
-        result += r->rasterizer.group_smoothness;
-    return result;
+    hash = (hash ^ value) * 0x9e3779b97f4a7c15ull;
+    return hash ^ (hash >> 29);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void private_draw_disc(struct onedraw* r, vec2 center, float radius, float thickness, enum primitive_fillmode fillmode,
-                       draw_color primary_color, draw_color secondary_color)
+// hash of everything that changes the pixels of a command : type, fill mode, color, draw data and clip shape
+static inline uint64_t od_cpu_hash_command(const draw_cmd_arguments* args, uint32_t index, uint32_t num_commands,
+                                           uint32_t num_draw_data)
 {
-    thickness *= .5f;
+    draw_command command = args->commands[index];
+    uint64_t hash = hash_combine(0, (uint64_t)command.type | ((uint64_t)command.fillmode << 8) | ((uint64_t)command.extra << 16) |
+                                    ((uint64_t)(command.data_index & DRAW_DATA_PACKED) << 1));
+    hash = hash_combine(hash, args->colors[index]);
+
+    // draw data are written in command order, the next command gives the size
+    uint32_t data_end = (index + 1 < num_commands) ? (args->commands[index + 1].data_index & ~DRAW_DATA_PACKED) : num_draw_data;
+    for(uint32_t i=command.data_index & ~DRAW_DATA_PACKED; i<data_end; ++i)
+        hash = hash_combine(hash, bitcast_float_to_u32(args->draw_data[i]));
+
+    const clip_shape& clip = args->clips[command.clip_index];
+    hash = hash_combine(hash, clip.type);
+    hash = hash_combine(hash, ((uint64_t)bitcast_float_to_u32(clip.rect.min_x) << 32) | bitcast_float_to_u32(clip.rect.min_y));
+    if (clip.type == clip_rect)
+        hash = hash_combine(hash, ((uint64_t)bitcast_float_to_u32(clip.rect.max_x) << 32) | bitcast_float_to_u32(clip.rect.max_y));
+    else
+        hash = hash_combine(hash, bitcast_float_to_u32(clip.disc.squared_radius));
+    return hash;
+}
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+//----------------------------------------------------------------------------------------------------------------------------
+// hashes the command list of each tile and compares it with the previous frame
+// fills r->cpu.changed_indices/changed_costs and returns the number of tiles to rasterize
+static uint32_t od_cpu_changed_tiles(struct onedraw* r, uint32_t num_draw_data, uint32_t num_tiles, bool full_redraw)
+{
+    const draw_cmd_arguments* args = &r->cpu.args;
+    const uint32_t num_commands = args->num_commands;
+    const uint32_t chunk_size = 1024;
+    r->cpu.pool.ParallelFor((num_commands + chunk_size - 1) / chunk_size, [r, args, num_commands, num_draw_data](uint32_t chunk)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fillmode;
-        cmd->type = primitive_disc;
-        *color = primary_color;
+        uint32_t end = min((chunk + 1) * chunk_size, num_commands);
+        for(uint32_t i=chunk * chunk_size; i<end; ++i)
+            r->cpu.command_hashes[i] = od_cpu_hash_command(args, i, num_commands, num_draw_data);
+    });
 
-        float* data = r->commands.data_buffer.NewMultiple((fillmode == fill_hollow || fillmode == fill_gradient) ? 4 : 3);
-        quantized_aabb* aabb = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabb != nullptr)
+    // the background is part of every tile
+    uint64_t seed = hash_combine(0, cpu::pack_bgra8_srgb(args->clear_color) | ((uint64_t)args->culling_debug << 32));
+
+    r->cpu.pool.ParallelFor(r->tiles.num_height, [r, seed](uint32_t tile_y)
+    {
+        for(uint32_t tile_x=0; tile_x<r->tiles.num_width; ++tile_x)
         {
-            float max_radius = radius + draw_cmd_aabb_bump(r);
+            uint32_t tile_index = tile_y * r->tiles.num_width + tile_x;
+            uint64_t hash = seed;
+            for(uint32_t node = r->cpu.head[tile_index]; node != INVALID_INDEX; node = r->cpu.nodes[node].next)
+                hash = hash_combine(hash, r->cpu.command_hashes[r->cpu.nodes[node].command_index]);
+
+            // the lowest bit flags a change, it is cleared in the stored hash
+            hash &= ~1ull;
+            r->cpu.tile_hashes[tile_index] = (r->cpu.tile_hashes[tile_index] == hash) ? hash : (hash | 1ull);
+        }
+    });
 
-            if (fillmode == fill_hollow)
+    uint32_t num_changed = 0;
+    if (!full_redraw)
+    {
+        // tiles with commands, in binning order with their cost
+        for(uint32_t i=0; i<num_tiles; ++i)
+        {
+            uint32_t tile_index = r->cpu.tile_indices[i];
+            if (r->cpu.tile_hashes[tile_index] & 1ull)
             {
-                max_radius += thickness;
-                write_float(data, center.x, center.y, radius, thickness);
+                r->cpu.changed_indices[num_changed] = tile_index;
+                r->cpu.changed_costs[num_changed++] = r->cpu.tile_costs[i];
             }
-            else if (fillmode == fill_gradient)
-                write_float(data, center.x, center.y, radius, bitcast_u32_to_float(secondary_color));
-            else
-                write_float(data, center.x, center.y, radius);
+        }
 
-            write_quantized_aabb(aabb, center.x - max_radius, center.y - max_radius, center.x + max_radius, center.y + max_radius);
-            merge_quantized_aabb(r->commands.group_aabb, aabb);
-            return;
+    }
+
+    for(uint32_t tile_index=0; tile_index<r->tiles.count; ++tile_index)
+    {
+        // tiles that became empty are cleared by the rasterizer
+        if (!full_redraw && (r->cpu.tile_hashes[tile_index] & 1ull) && r->cpu.head[tile_index] == INVALID_INDEX)
+        {
+            r->cpu.changed_indices[num_changed] = tile_index;
+            r->cpu.changed_costs[num_changed++] = 1;
         }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+        r->cpu.tile_hashes[tile_index] &= ~1ull;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+
+    return num_changed;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_ring(struct onedraw* r, float cx, float cy, float radius, float thickness, draw_color color)
+// region and tile binning of the commands in r->cpu.args, returns the number of nodes the tile binning asked for
+// when the nodes run out, they grow and the tiles are binned again (the region lists are still valid)
+static uint32_t od_cpu_bin(struct onedraw* r)
 {
-    private_draw_disc(r, vec2_set(cx, cy), radius, thickness, fill_hollow, color, 0);
+    draw_cmd_arguments* args = &r->cpu.args;
+    args->max_nodes = r->limits.max_nodes;      // a previous pass may have grown the nodes
+    r->cpu.counters.num_nodes.store(0, std::memory_order_relaxed);
+    r->cpu.counters.num_tiles.store(0, std::memory_order_relaxed);
+    r->cpu.counters.max_tile_nodes.store(0, std::memory_order_relaxed);
+
+    if (args->num_commands == 0)
+        return 0;
+
+    // predicate, scan and region binning : one task per region
+    r->cpu.pool.ParallelFor(r->regions.count, [r, args](uint32_t region_index)
+    {
+        cpu::predicate(*args, r->cpu.predicate, region_index);
+        cpu::exclusive_scan(*args, r->cpu.predicate, r->cpu.scan, region_index);
+        cpu::region_bin(*args, r->cpu.region_indices, r->cpu.scan, r->cpu.predicate, region_index);
+    });
+
+    for(;;)
+    {
+        // tile binning : one task per row of tiles
+        tiles_data tiles = {.head = r->cpu.head, .nodes = r->cpu.nodes, .tile_indices = r->cpu.tile_indices};
+        r->cpu.pool.ParallelFor(r->tiles.num_height, [r, args, &tiles](uint32_t tile_y)
+        {
+            for(uint32_t tile_x=0; tile_x<r->tiles.num_width; ++tile_x)
+                cpu::tile_bin(*args, tiles, r->cpu.counters, r->cpu.tile_costs, r->cpu.region_indices, tile_x, tile_y);
+        });
+
+        const uint32_t num_nodes = r->cpu.counters.num_nodes.load(std::memory_order_relaxed);
+        const uint32_t max_nodes = od_grow_capacity(r->limits.max_nodes, num_nodes, MAX_FRAME_NODES);
+        if (max_nodes == r->limits.max_nodes)
+            return num_nodes;
+
+        tile_node* nodes = (tile_node*) realloc(r->cpu.nodes, sizeof(tile_node) * max_nodes);
+        if (nodes == nullptr)
+            return num_nodes;
+
+        r->cpu.nodes = nodes;
+        r->limits.max_nodes = args->max_nodes = max_nodes;
+        r->cpu.counters.num_nodes.store(0, std::memory_order_relaxed);
+        r->cpu.counters.num_tiles.store(0, std::memory_order_relaxed);
+        r->cpu.counters.max_tile_nodes.store(0, std::memory_order_relaxed);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_disc(struct onedraw* r, float cx, float cy, float radius, draw_color color)
+// per-pixel cost of each command type relative to a disc, measured on the cpu rasterizer (full screen shapes, single thread)
+static float od_command_cost(uint8_t command_type)
 {
-    private_draw_disc(r, vec2_set(cx, cy), radius, 0.f, fill_solid, color, 0);
+    switch(command_type & COMMAND_TYPE_MASK)
+    {
+    case primitive_char : return 3.f;
+    case primitive_text_run : return 4.f;         // a glyph or two per pixel
+    case primitive_aabox : return 1.25f;
+    case primitive_oriented_box : return 1.9f;
+    case primitive_disc : return 1.f;
+    case primitive_triangle : return 2.3f;
+    case primitive_ellipse : return 7.6f;         // 3 iterations solver
+    case primitive_pie : return 1.6f;
+    case primitive_arc : return 1.6f;
+    case primitive_blurred_box : return 8.f;      // 4 erf
+    case primitive_quad : return 9.8f;            // bilinear srgb fetch
+    case primitive_oriented_quad : return 8.9f;
+    case begin_group :
+    case end_group : return 1.f;
+    default : return 1.f;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_disc_gradient(struct onedraw* r, float cx, float cy, float radius, draw_color outter_color, draw_color inner_color)
+// adds the length and the cost of the tile lists of the last binning pass to [list_lengths] and [costs] (can be NULL)
+static void od_cpu_add_tile_lists(const struct onedraw* r, float* list_lengths, float* costs)
 {
-    private_draw_disc(r, vec2_set(cx, cy), radius, 0.f, fill_gradient, outter_color, inner_color);
+    for(uint32_t tile_index=0; tile_index<r->tiles.count; ++tile_index)
+    {
+        float length = 0.f, cost = 0.f;
+        for(uint32_t node_index = r->cpu.head[tile_index]; node_index != INVALID_INDEX; node_index = r->cpu.nodes[node_index].next)
+        {
+            length += 1.f;
+            cost += od_command_cost(r->cpu.nodes[node_index].command_type);
+        }
+
+        if (list_lengths != nullptr)
+            list_lengths[tile_index] += length;
+        if (costs != nullptr)
+            costs[tile_index] += cost;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void private_draw_oriented_box(struct onedraw* r, vec2 p0, vec2 p1, float width, float roundness, float thickness,
-                               enum primitive_fillmode fillmode, draw_color primary_color, draw_color secondary_color)
+// the next binning pass overwrites the tile lists, they are summed for od_get_tile_heatmap()
+static void od_cpu_accumulate_heatmap(struct onedraw* r)
 {
-    if (vec2_similar(p0, p1, HALF_PIXEL))
+    if (r->cpu.heatmap == nullptr)
+        r->cpu.heatmap = (float*) malloc(r->tiles.count * 2 * sizeof(float));
+    if (r->cpu.heatmap == nullptr)
         return;
 
-    thickness *= .5f;
+    if (r->cpu.num_heatmap_passes == 0)
+        memset(r->cpu.heatmap, 0, r->tiles.count * 2 * sizeof(float));
+    od_cpu_add_tile_lists(r, r->cpu.heatmap, r->cpu.heatmap + r->tiles.count);
+    r->cpu.num_heatmap_passes++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// bins and rasterizes the commands pointed by r->cpu.args
+void od_cpu_render(struct onedraw* r, void* drawable, uint32_t num_draw_data)
+{
+    assert_msg(drawable != nullptr, "the cpu backend needs a B8G8R8A8 buffer of width*height pixels");
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    draw_cmd_arguments* args = &r->cpu.args;
+    const draw_cmd_arguments frame = *args;
+    uint32_t* pixels = (uint32_t*) drawable;
+    const uint32_t width = r->rasterizer.width;
+    const uint32_t height = r->rasterizer.height;
+
+    binning_totals totals = {};
+    float binning_time = 0.f;
+    uint32_t num_changed_tiles = r->tiles.count;
+    uint32_t first = 0;
+    r->cpu.num_heatmap_passes = 0;
+
+    // a frame with more commands than a pass can bin is rendered in several passes, each one over the previous
+    do
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fillmode;
-        cmd->type = primitive_oriented_box;
-        *color = primary_color;
+        std::chrono::steady_clock::time_point pass_start = std::chrono::steady_clock::now();
+        const uint32_t pass = totals.num_passes;
+        const uint32_t count = od_pass_size(frame.commands, first, frame.num_commands);
+        od_set_pass_arguments(args, &frame, first, count, pass);
+
+        const uint32_t num_requested_nodes = od_cpu_bin(r);
+        const uint32_t num_tiles = min(r->cpu.counters.num_tiles.load(std::memory_order_relaxed), r->tiles.count);
+        od_add_binning_pass(r, &totals, num_requested_nodes, num_tiles, r->cpu.counters.max_tile_nodes.load(std::memory_order_relaxed));
 
-        float* data = r->commands.data_buffer.NewMultiple((fillmode == fill_gradient) ? 7 : 6);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
+        if (r->cpu.incremental && count == frame.num_commands)
         {
-            float roundness_thickness = (fillmode == fill_hollow) ? thickness : roundness;
-            aabb bb = aabb_from_rounded_obb(p0, p1, width, roundness_thickness + draw_cmd_aabb_bump(r));
+            // the previous pixels are only there if the same buffer is used
+            bool full_redraw = r->cpu.full_redraw || drawable != r->cpu.previous_drawable;
+            num_changed_tiles = od_cpu_changed_tiles(r, num_draw_data, num_tiles, full_redraw);
+            r->cpu.previous_drawable = drawable;
+            r->cpu.full_redraw = false;
+            if (full_redraw)
+                num_changed_tiles = r->tiles.count;
+        }
+        else if (r->cpu.incremental)
+            r->cpu.full_redraw = true;      // the tile hashes only describe frames of a single pass
 
-            if (fillmode == fill_gradient)
-                write_float(data, p0.x, p0.y, p1.x, p1.y, width, roundness_thickness, bitcast_u32_to_float(secondary_color));
-            else
-                write_float(data, p0.x, p0.y, p1.x, p1.y, width, roundness_thickness);
+        binning_time += std::chrono::duration<float>(std::chrono::steady_clock::now() - pass_start).count();
 
-            write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
+        tiles_data tiles = {.head = r->cpu.head, .nodes = r->cpu.nodes, .tile_indices = r->cpu.tile_indices};
+        if (num_changed_tiles == r->tiles.count)
+        {
+            // clear the framebuffer, tiles with commands are overwritten by the rasterizer
+            if (pass == 0)
+            {
+                const uint32_t clear_pixel = cpu::pack_bgra8_srgb(args->clear_color);
+                r->cpu.pool.ParallelFor(height, [pixels, width, clear_pixel](uint32_t y)
+                {
+                    for(uint32_t x=0; x<width; ++x)
+                        pixels[y * width + x] = clear_pixel;
+                });
+            }
+
+            // rasterization : one task per tile, work-stealing scheduler with the number of nodes as cost
+            r->cpu.pool.ParallelForByCost(num_tiles, r->cpu.tile_costs, [r, args, &tiles, pixels, width, height](uint32_t index)
+            {
+                cpu::tile_fs(*args, tiles, r->cpu.font, r->cpu.atlas, tiles.tile_indices[index], pixels, width, height);
+            });
+        }
+        else
+        {
+            // only the changed tiles, the empty ones are cleared by tile_fs
+            r->cpu.pool.ParallelForByCost(num_changed_tiles, r->cpu.changed_costs, [r, args, &tiles, pixels, width, height](uint32_t index)
+            {
+                cpu::tile_fs(*args, tiles, r->cpu.font, r->cpu.atlas, r->cpu.changed_indices[index], pixels, width, height);
+            });
         }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+
+        first += count;
+        if (first < frame.num_commands && totals.num_passes < MAX_BINNING_PASSES)
+            od_cpu_accumulate_heatmap(r);
+    } while (first < frame.num_commands && totals.num_passes < MAX_BINNING_PASSES);
+
+    if (r->screenshot.out_pixels != nullptr && r->screenshot.capture_image)
+    {
+        uint32_t* output = (uint32_t*) r->screenshot.out_pixels;
+        for(uint32_t y=0; y<r->screenshot.region_height; ++y)
+            memcpy(&output[y * r->screenshot.region_width], &pixels[(r->screenshot.region_y + y) * width + r->screenshot.region_x],
+                   r->screenshot.region_width * sizeof(uint32_t));
+
+        r->screenshot.capture_image = false;
+        r->screenshot.out_pixels = nullptr;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+
+    float frame_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    r->stats.binning_time = binning_time;
+    r->stats.raster_time = frame_time - binning_time;
+    r->stats.num_changed_tiles = num_changed_tiles;
+    od_update_binning_stats(r, &totals);
+    atomic_store(&r->stats.gpu_time, frame_time);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_oriented_box(struct onedraw* r, float ax, float ay, float bx, float by, float width, float roundness, draw_color color)
+void od_cpu_flush(struct onedraw* r, void* drawable)
 {
-    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, roundness, 0.f, fill_solid, color, 0);
+    draw_cmd_arguments* args = &r->cpu.args;
+    od_fill_draw_arguments(r, args);
+    args->commands = r->commands.buffer.GetData();
+    args->colors = r->commands.colors.GetData();
+    args->commands_aabb = r->commands.aabb_buffer.GetData();
+    args->draw_data = r->commands.data_buffer.GetData();
+    args->clips = r->commands.clipshapes_buffer.GetData();
+    args->glyphs = r->cpu.glyphs;
+    od_cpu_render(r, drawable, (uint32_t)r->commands.data_buffer.GetNumElements());
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_oriented_rect(struct onedraw* r, float ax, float ay, float bx, float by, float width, float roundness, float thickness, draw_color color)
+void od_cpu_terminate(struct onedraw* r)
 {
-    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, roundness, thickness, fill_hollow, color, 0);
+    r->cpu.pool.Terminate();
+    free(r->cpu.predicate);
+    free(r->cpu.scan);
+    free(r->cpu.region_indices);
+    free(r->cpu.head);
+    free(r->cpu.nodes);
+    free(r->cpu.tile_indices);
+    free(r->cpu.tile_costs);
+    free(r->cpu.command_hashes);
+    free(r->cpu.tile_hashes);
+    free(r->cpu.changed_indices);
+    free(r->cpu.changed_costs);
+    free(r->cpu.heatmap);
+    free(r->cpu.font.pixels);
+    free(r->cpu.atlas.pixels);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_line(struct onedraw* r, float ax, float ay, float bx, float by, float width, draw_color srgb_color)
+size_t od_cpu_memory_usage(struct onedraw* r)
 {
-    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, 0.f, 0.f, fill_solid, srgb_color, 0);
+    size_t num_indices = r->regions.count * r->regions.capacity;
+    size_t mem = num_indices * (sizeof(uint8_t) + sizeof(uint16_t) * 2);
+    mem += r->tiles.count * sizeof(uint32_t) * 3;
+    mem += sizeof(tile_node) * r->limits.max_nodes;
+    if (r->cpu.incremental)
+        mem += sizeof(uint64_t) * r->regions.capacity + r->tiles.count * (sizeof(uint64_t) + sizeof(uint32_t) * 2);
+    if (r->cpu.heatmap != nullptr)
+        mem += r->tiles.count * 2 * sizeof(float);
+    mem += r->cpu.font.width * r->cpu.font.height;
+    mem += (size_t)r->cpu.atlas.width * r->cpu.atlas.height * r->cpu.atlas.num_slices * 4;
+    return mem;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------------
+// frame capture
+//      * file layout, native endianness, every block starts on a CAPTURE_ALIGNMENT boundary
+//          capture_header
+//          capture_frame | commands | colors | aabbs | draw data | clip shapes      (one per captured frame)
+//      * blocks are the raw content of the command buffers so a mapped file can be binned without any copy
+//      * the glyph table and the atlas are not captured : the frames drawn with a loaded font are skipped, the replay sets
+//        the built-in font to the height of the frame
+//      * CAPTURE_VERSION must be increased when one of the captured structures changes
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#define CAPTURE_MAGIC (0x5043444f)      // "ODCP"
+#define CAPTURE_VERSION (4)
+#define CAPTURE_ALIGNMENT (64)
+
+typedef struct capture_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_frames;
+    uint32_t header_size;
+    uint32_t sizeof_command;
+    uint32_t sizeof_aabb;            // one word, two in the wide mode (see capture_frame::aabb_words)
+    uint32_t sizeof_clip;
+    uint32_t padding[9];
+} capture_header;
+
+typedef struct capture_frame
+{
+    uint32_t frame_size;            // including this structure and the padding, offset of the next frame
+    uint32_t frame_index;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_commands;
+    uint32_t num_draw_data;
+    uint32_t num_clips;
+    uint32_t culling_debug;
+    uint32_t aabb_words;            // 2 when recorded with onedraw_def.wide_aabb
+    float clear_color[4];
+    float aa_width;
+    float font_height;              // of the built-in font
+    uint32_t commands_offset;       // offsets from the beginning of capture_frame
+    uint32_t colors_offset;
+    uint32_t aabbs_offset;
+    uint32_t draw_data_offset;
+    uint32_t clips_offset;
+} capture_frame;
+
+static_assert(sizeof(capture_header) == CAPTURE_ALIGNMENT, "capture_header must fill exactly one block");
+
+static inline uint32_t capture_align(size_t size) {return (uint32_t)((size + CAPTURE_ALIGNMENT - 1) & ~(size_t)(CAPTURE_ALIGNMENT - 1));}
+
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_capsule(struct onedraw* r, float ax, float ay, float bx, float by, float radius, draw_color srgb_color)
+static void od_capture_write_block(FILE* file, const void* data, size_t size)
 {
-    // capsule uses a specific sdf (see rasterizer shader) more efficient that oriented box
-    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), 0.f, radius, 0.f, fill_solid, srgb_color, 0);
+    static const uint8_t zeros[CAPTURE_ALIGNMENT] = {0};
+    if (size > 0)
+        fwrite(data, size, 1, file);
+    fwrite(zeros, capture_align(size) - size, 1, file);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_capsule_gradient(struct onedraw* r, float ax, float ay, float bx, float by, float radius, draw_color primary_color, draw_color secondary_color)
+// appends the current frame to the capture file, called by od_end_frame before the flush
+void od_capture_write_frame(struct onedraw* r)
 {
-    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), 0.f, radius, 0.f, fill_gradient, primary_color, secondary_color);
+    // the glyph indices of a loaded font are cells of an atlas filled at runtime
+    if (r->font.loaded != nullptr)
+    {
+        if (r->capture.num_skipped_frames++ == 0)
+            od_log(r, "the frames drawn with a font loaded by od_load_font are not captured");
+        return;
+    }
+
+    capture_frame frame = 
+    {
+        .frame_size = 0,
+        .frame_index = r->stats.frame_index,
+        .width = r->rasterizer.width,
+        .height = r->rasterizer.height,
+        .num_commands = r->commands.count,
+        .num_draw_data = (uint32_t) r->commands.data_buffer.GetNumElements(),
+        .num_clips = (uint32_t) r->commands.clipshapes_buffer.GetNumElements(),
+        .culling_debug = r->tiles.culling_debug,
+        .aabb_words = aabb_words(r),
+        .clear_color = {r->rasterizer.clear_color.x, r->rasterizer.clear_color.y, r->rasterizer.clear_color.z, r->rasterizer.clear_color.w},
+        .aa_width = r->rasterizer.aa_width,
+        .font_height = r->font.desc.font_height,
+        .commands_offset = 0, .colors_offset = 0, .aabbs_offset = 0, .draw_data_offset = 0, .clips_offset = 0
+    };
+
+    const size_t commands_size = frame.num_commands * sizeof(draw_command);
+    const size_t colors_size = frame.num_commands * sizeof(draw_color);
+    const size_t aabbs_size = frame.num_commands * frame.aabb_words * sizeof(uint32_t);
+    const size_t draw_data_size = frame.num_draw_data * sizeof(float);
+    const size_t clips_size = frame.num_clips * sizeof(clip_shape);
+
+    frame.commands_offset = capture_align(sizeof(capture_frame));
+    frame.colors_offset = frame.commands_offset + capture_align(commands_size);
+    frame.aabbs_offset = frame.colors_offset + capture_align(colors_size);
+    frame.draw_data_offset = frame.aabbs_offset + capture_align(aabbs_size);
+    frame.clips_offset = frame.draw_data_offset + capture_align(draw_data_size);
+    frame.frame_size = frame.clips_offset + capture_align(clips_size);
+
+    FILE* file = r->capture.file;
+    od_capture_write_block(file, &frame, sizeof(frame));
+    od_capture_write_block(file, r->commands.buffer.GetData(), commands_size);
+    od_capture_write_block(file, r->commands.colors.GetData(), colors_size);
+    od_capture_write_block(file, r->commands.aabb_buffer.GetData(), aabbs_size);
+    od_capture_write_block(file, r->commands.data_buffer.GetData(), draw_data_size);
+    od_capture_write_block(file, r->commands.clipshapes_buffer.GetData(), clips_size);
+    r->capture.num_frames++;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------------
+// fonts
+//      * the built-in font (font.desc) is baked in the library, the glyph index is the ascii code minus first_glyph
+//      * a loaded font (see od_load_font) rasterizes the glyphs on first use in the MAX_FONT_SLOTS cells of its atlas,
+//        the glyph index is the cell and the least recently used cells are reused when the atlas is full
+//      * both atlases hold multi-channel distance fields (see msdf.h), the glyphs are scaled to the font height
+// ---------------------------------------------------------------------------------------------------------------------------
+
 //----------------------------------------------------------------------------------------------------------------------------
-void private_draw_ellipse(struct onedraw* r, vec2 p0, vec2 p1, float width, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+// serializes the glyph lookups of the renderer and of its contexts when a font is loaded
+struct font_lock
 {
-    if (vec2_similar(p0, p1, HALF_PIXEL))
-        return;
+    std::mutex* mutex;
+    explicit font_lock(struct onedraw* r) : mutex((r->font.loaded != nullptr) ? &r->font.loaded->mutex : nullptr)
+    {
+        if (mutex != nullptr)
+            mutex->lock();
+    }
+    ~font_lock()
+    {
+        if (mutex != nullptr)
+            mutex->unlock();
+    }
+};
 
-    if (width <= HALF_PIXEL)
-        private_draw_oriented_box(r, p0, p1, 0.f, 0.f, 0.f, fill_solid, srgb_color, 0);
+//----------------------------------------------------------------------------------------------------------------------------
+// returns the codepoint at [text] and moves after it, invalid sequences give U+FFFD
+static inline uint32_t utf8_next(const char** text)
+{
+    const uint8_t* c = (const uint8_t*) *text;
+    uint32_t codepoint, length;
+    if (c[0] < 0x80)
+    {
+        *text += 1;
+        return c[0];
+    }
+    else if ((c[0] & 0xE0) == 0xC0) {codepoint = c[0] & 0x1F; length = 2;}
+    else if ((c[0] & 0xF0) == 0xE0) {codepoint = c[0] & 0x0F; length = 3;}
+    else if ((c[0] & 0xF8) == 0xF0) {codepoint = c[0] & 0x07; length = 4;}
     else
     {
-        thickness = float_max(thickness * .5f, 0.f);
-        draw_command* cmd = r->commands.buffer.NewElement();
-        draw_color* color = r->commands.colors.NewElement();
-        if (cmd != nullptr && color != nullptr)
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    // stops at the zero terminator
+    for(uint32_t i=1; i<length; ++i)
+    {
+        if ((c[i] & 0xC0) != 0x80)
         {
-            cmd->clip_index = LAST_CLIP_INDEX;
-            cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-            cmd->fillmode = fillmode;
-            cmd->type = primitive_ellipse;
-            *color = srgb_color;
-
-            float* data = r->commands.data_buffer.NewMultiple((fillmode == fill_hollow) ? 6 : 5);
-            quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-            if (data != nullptr && aabox != nullptr)
-            {
-                aabb bb = aabb_from_rounded_obb(p0, p1, width, draw_cmd_aabb_bump(r) + thickness);
-                if (fillmode == fill_hollow)
-                    write_float(data, p0.x, p0.y, p1.x, p1.y, width, thickness);
-                else
-                    write_float(data, p0.x, p0.y, p1.x, p1.y, width);
-
-                write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-                merge_quantized_aabb(r->commands.group_aabb, aabox);
-                return;
-            }
-            r->commands.buffer.RemoveLast();
-            r->commands.colors.RemoveLast();
+            *text += i;
+            return 0xFFFD;
         }
-        od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+        codepoint = (codepoint << 6) | (c[i] & 0x3F);
+    }
+    *text += length;
+    return codepoint;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline float od_font_height(const struct onedraw* r)
+{
+    return (r->font.loaded != nullptr) ? r->font.loaded->font_height : r->font.desc.font_height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// advance of the codepoints missing from the font
+static inline float od_fallback_advance(const struct onedraw* r)
+{
+    if (r->font.loaded != nullptr)
+        return r->font.loaded->fallback_advance;
+
+    return r->font.desc.glyphs['_'- r->font.desc.first_glyph].advance_x * .65f;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the distance field of the built-in font is drawn at [font_height], 0 for the height it was baked for
+static void od_set_builtin_font(struct onedraw* r, float font_height)
+{
+    assert(sizeof(alphabet) == default_font_size);
+    r->font.desc = *((const alphabet*) default_font);
+    if (font_height == 0.f)
+        return;
+
+    const float ratio = font_height / r->font.desc.font_height;
+    for(uint32_t i=0; i<r->font.desc.num_glyphs; ++i)
+    {
+        od_glyph& glyph = r->font.desc.glyphs[i];
+        glyph.width *= ratio;
+        glyph.height *= ratio;
+        glyph.bearing_x *= ratio;
+        glyph.bearing_y *= ratio;
+        glyph.advance_x *= ratio;
+    }
+    r->font.desc.font_height = font_height;
+    r->font.desc.distance_range *= ratio;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// size and top of a glyph index, used to cull the glyphs of the cached layouts
+static inline font_char od_glyph_extent(const struct onedraw* r, uint32_t glyph_index)
+{
+    if (r->font.loaded != nullptr)
+        return r->font.loaded->table[glyph_index];
+
+    const od_glyph& glyph = r->font.desc.glyphs[glyph_index];
+    font_char extent = {};
+    extent.width = glyph.width;
+    extent.height = glyph.height;
+    extent.top = glyph.bearing_y + r->font.desc.font_height;
+    return extent;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// entry of [codepoint] in the glyph hash, created with the metrics of the glyph on first use
+static font_glyph* od_font_entry(od_font* font, uint32_t codepoint)
+{
+    uint32_t index = uint32_t(hash_combine(0, codepoint)) & font->glyphs_mask;
+    while (font->glyphs[index].codepoint != codepoint)
+    {
+        if (font->glyphs[index].codepoint == UINT32_MAX)
+            break;
+        index = (index + 1) & font->glyphs_mask;
+    }
+
+    font_glyph* entry = &font->glyphs[index];
+    if (entry->codepoint == codepoint)
+        return entry;
+
+    // keep the table half empty
+    if ((font->num_glyphs + 1) * 2 > font->glyphs_mask + 1)
+    {
+        uint32_t capacity = (font->glyphs_mask + 1) * 2;
+        font_glyph* glyphs = (font_glyph*) malloc(capacity * sizeof(font_glyph));
+        if (glyphs == nullptr)
+            return nullptr;
+
+        for(uint32_t i=0; i<capacity; ++i)
+            glyphs[i].codepoint = UINT32_MAX;
+
+        for(uint32_t i=0; i<=font->glyphs_mask; ++i)
+        {
+            if (font->glyphs[i].codepoint == UINT32_MAX)
+                continue;
+
+            uint32_t new_index = uint32_t(hash_combine(0, font->glyphs[i].codepoint)) & (capacity - 1);
+            while (glyphs[new_index].codepoint != UINT32_MAX)
+                new_index = (new_index + 1) & (capacity - 1);
+            glyphs[new_index] = font->glyphs[i];
+        }
+
+        free(font->glyphs);
+        font->glyphs = glyphs;
+        font->glyphs_mask = capacity - 1;
+        return od_font_entry(font, codepoint);
+    }
+
+    font->num_glyphs++;
+    *entry = (font_glyph) {};
+    entry->codepoint = codepoint;
+    entry->slot = NO_FONT_SLOT;
+    entry->index = stbtt_FindGlyphIndex(&font->info, (int) codepoint);
+    if (entry->index != 0)
+    {
+        int advance, left_side_bearing, x0, y0, x1, y1;
+        stbtt_GetGlyphHMetrics(&font->info, entry->index, &advance, &left_side_bearing);
+        stbtt_GetGlyphBitmapBox(&font->info, entry->index, font->msdf_scale, font->msdf_scale, &x0, &y0, &x1, &y1);
+
+        // the distance field extends the box by the padding, the cells keep a texel for the bilinear filtering
+        const int padding = int(FONT_MSDF_PADDING);
+        const float ratio = font->scale / font->msdf_scale;
+        if (x1 > x0 && y1 > y0)
+        {
+            entry->width = (uint16_t) min(uint32_t(x1 - x0 + padding * 2), font->cell_size - 1);
+            entry->height = (uint16_t) min(uint32_t(y1 - y0 + padding * 2), font->cell_size - 1);
+        }
+        entry->metrics.width = float(entry->width) * ratio;
+        entry->metrics.height = float(entry->height) * ratio;
+        entry->metrics.bearing_x = float(x0 - padding) * ratio;
+        entry->metrics.bearing_y = font->baseline + float(y0 - padding) * ratio - font->font_height;  // relative to font_height, like the built-in font
+        entry->metrics.advance_x = float(advance) * font->scale;
+    }
+    return entry;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the slots drawn in a list are pinned by od_list_end() until the list is freed
+static inline void od_font_touch(struct onedraw* r, od_font* font, uint32_t slot)
+{
+    font->slot_frames[slot] = font->frame;
+    if (r->list.recording)
+        r->list.font_slots[slot / 32] |= 1u << (slot % 32);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// returns a free cell or the least recently used one, the cells used by the frames in flight and by the retained lists
+// are kept
+static uint32_t od_font_allocate_slot(od_font* font)
+{
+    if (font->num_slots < MAX_FONT_SLOTS)
+        return font->num_slots++;
+
+    uint32_t slot = NO_FONT_SLOT;
+    uint32_t oldest = UINT32_MAX;
+    for(uint32_t i=0; i<MAX_FONT_SLOTS; ++i)
+    {
+        uint32_t frame = font->slot_frames[i];
+        if (font->slot_pins[i] == 0 && frame + DynamicBuffer<float>::MaxInflightBuffers <= font->frame && frame < oldest)
+        {
+            oldest = frame;
+            slot = i;
+        }
+    }
+
+    if (slot == NO_FONT_SLOT)
+    {
+        if (font->full_frame != font->frame)
+            od_log(font->owner, "the font atlas is full (%u glyphs in use), some glyphs are not drawn", MAX_FONT_SLOTS);
+        font->full_frame = font->frame;
+        font->num_dropped++;
+        return NO_FONT_SLOT;
+    }
+
+    font_glyph* evicted = od_font_entry(font, font->slot_codepoints[slot]);
+    if (evicted != nullptr)
+        evicted->slot = NO_FONT_SLOT;
+
+    // the tiles that kept their pixels may show the previous glyph of the cell
+    font->num_evictions++;
+    font->owner->cpu.full_redraw = true;
+    return slot;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the cell is found first : a full atlas doesn't pay for the distance field
+static void od_font_rasterize(od_font* font, font_glyph* entry)
+{
+    uint32_t slot = od_font_allocate_slot(font);
+    if (slot == NO_FONT_SLOT)
+        return;
+
+    const uint32_t cell = font->cell_size;
+    memset(font->bitmap, 0, cell * cell * FONT_PLANES);
+    if (!msdf_glyph(&font->info, entry->index, font->msdf_scale, int(FONT_MSDF_PADDING), FONT_MSDF_RANGE, font->bitmap,
+                    entry->width, entry->height, int(cell), int(cell * cell)))
+    {
+        // out of memory, the cell goes back as the least recently used one
+        font->slot_codepoints[slot] = entry->codepoint;
+        font->slot_frames[slot] = 0;
+        return;
+    }
+
+    uint32_t x = (slot % FONT_ATLAS_CELLS) * cell;
+    uint32_t y = (slot / FONT_ATLAS_CELLS) * cell;
+    entry->slot = slot;
+    entry->metrics.x0 = (uint16_t) x;
+    entry->metrics.y0 = (uint16_t) y;
+    entry->metrics.x1 = (uint16_t) (x + entry->width);
+    entry->metrics.y1 = (uint16_t) (y + entry->height);
+    font->slot_codepoints[slot] = entry->codepoint;
+    font->slot_frames[slot] = font->frame;
+
+    const float atlas_size = float(font->atlas_size);
+    const float texture_height = atlas_size * FONT_PLANES;
+    font->table[slot] = (font_char)
+    {
+        .uv_topleft = {.x = float(entry->metrics.x0) / atlas_size, .y = float(entry->metrics.y0) / texture_height},
+        .uv_bottomright = {.x = float(entry->metrics.x1) / atlas_size, .y = float(entry->metrics.y1) / texture_height},
+        .width = entry->metrics.width,
+        .height = entry->metrics.height,
+        .top = entry->metrics.bearing_y + font->font_height,
+        .distance_range = 2.f * FONT_MSDF_RANGE * font->scale / font->msdf_scale
+    };
+
+    struct onedraw* r = font->owner;
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_metal_upload_glyph(r, slot, x, y, cell, font->bitmap, &font->table[slot]);
+    else
+#endif
+        od_cpu_upload_glyph(r, slot, x, y, cell, font->bitmap, &font->table[slot]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// metrics and glyph index of a codepoint, false if the font doesn't have it. [glyph_index] is NO_FONT_SLOT for the glyphs
+// without pixels (space) or without room in the atlas. [rasterize] is false when only the advance is needed.
+static inline bool od_find_glyph(struct onedraw* r, uint32_t codepoint, od_glyph* glyph, uint32_t* glyph_index, bool rasterize)
+{
+    od_font* font = r->font.loaded;
+    if (font == nullptr)
+    {
+        const alphabet& desc = r->font.desc;
+        if (codepoint < desc.first_glyph || codepoint > uint32_t(desc.first_glyph + desc.num_glyphs))
+            return false;
+
+        *glyph_index = codepoint - desc.first_glyph;
+        *glyph = desc.glyphs[*glyph_index];
+        return true;
+    }
+
+    font_glyph* entry = od_font_entry(font, codepoint);
+    if (entry == nullptr || entry->index == 0)
+        return false;
+
+    if (rasterize && entry->slot == NO_FONT_SLOT && entry->width != 0 && entry->height != 0)
+        od_font_rasterize(font, entry);
+
+    if (entry->slot != NO_FONT_SLOT)
+        od_font_touch(r, font, entry->slot);
+
+    *glyph_index = entry->slot;
+    *glyph = entry->metrics;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static void od_free_font(od_font* font)
+{
+    if (font == nullptr)
+        return;
+
+    free(font->glyphs);
+    free(font->bitmap);
+    font->~od_font();
+    free(font);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the font replaced by od_load_font() or od_terminate() is freed by the last list pinning some of its glyphs
+static void od_release_font(od_font* font)
+{
+    if (font == nullptr)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(font->mutex);
+        font->owner = nullptr;
+        if (font->num_lists != 0)
+            return;
     }
+    od_free_font(font);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// public functions
+// ---------------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------------
+size_t od_min_memory_size(void)
+{
+    return sizeof(struct onedraw);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+struct onedraw* od_init(onedraw_def* def)
+{
+    assert_msg(def->preallocated_buffer != nullptr, "forgot to allocate memory?");
+    assert_msg(((uintptr_t)def->preallocated_buffer)%sizeof(uintptr_t) == 0, "preallocated_buffer must be aligned on sizeof(uintptr_t)");
+#ifndef ONEDRAW_METAL
+    assert_msg(def->metal_device == nullptr, "onedraw was compiled without metal, only the cpu backend is available");
+#endif
+
+    onedraw* r = new(def->preallocated_buffer) onedraw;
+
+    r->custom_log = def->log_func;
+    r->device = (MTL::Device*)def->metal_device;
+    r->command_queue = nullptr;
+    r->screenshot.allocate_resources = def->allow_screenshot;
+    r->rasterizer.srgb_backbuffer = def->srgb_backbuffer;
+    r->cpu.incremental = def->cpu.incremental;
+    r->commands.packed = def->packed_draw_data;
+    r->commands.wide_aabb = def->wide_aabb;
+
+    // the clip index is 8 bits in the commands, the other limits are initial capacities that grow with the frames
+    assert_msg(def->limits.max_commands <= MAX_FRAME_COMMANDS && def->limits.max_draw_data <= MAX_FRAME_DRAW_DATA &&
+               def->limits.max_nodes <= MAX_FRAME_NODES, "limit too high");
+    assert_msg(def->limits.max_clips <= MAX_CLIPS, "max_clips cannot be higher than 256");
+    r->limits.max_commands = (def->limits.max_commands != 0) ? def->limits.max_commands : MAX_COMMANDS;
+    r->limits.max_draw_data = (def->limits.max_draw_data != 0) ? def->limits.max_draw_data : r->limits.max_commands * (MAX_DRAWDATA / MAX_COMMANDS);
+    r->limits.max_nodes = (def->limits.max_nodes != 0) ? def->limits.max_nodes : MAX_NODES_COUNT;
+    r->limits.max_clips = (def->limits.max_clips != 0) ? def->limits.max_clips : MAX_CLIPS;
+    r->regions.capacity = min(r->limits.max_commands, MAX_PASS_COMMANDS);
+
+    r->commands.buffer.Init(r->device, sizeof(draw_command) * r->limits.max_commands);
+    r->commands.colors.Init(r->device, sizeof(draw_color) * r->limits.max_commands);
+    r->commands.data_buffer.Init(r->device, sizeof(float) * r->limits.max_draw_data);
+    r->commands.aabb_buffer.Init(r->device, sizeof(uint32_t) * aabb_words(r) * r->limits.max_commands);
+    r->commands.clipshapes_buffer.Init(r->device, sizeof(clip_shape) * r->limits.max_clips);
+
+    r->stats.average_gpu_time = 0.f;
+    r->stats.accumulated_gpu_time = 0.f;
+    atomic_store(&r->stats.gpu_time, 0.f);
+    r->stats.window = (def->stats.window == 0) ? STATS_DEFAULT_WINDOW : min(def->stats.window, STATS_MAX_WINDOW);
+    r->stats.frame_start = std::chrono::steady_clock::now();
+
+    od_set_builtin_font(r, 0.f);
+
+    // a power of two number of buckets, about one per short string of the budget
+    r->text_cache.max_size = (def->text_cache.size != 0) ? def->text_cache.size : TEXT_CACHE_DEFAULT_SIZE;
+    size_t num_buckets = TEXT_CACHE_MIN_BUCKETS;
+    while (num_buckets * TEXT_CACHE_BYTES_PER_BUCKET < r->text_cache.max_size)
+        num_buckets *= 2;
+    r->text_cache.buckets = (text_layout**) calloc(num_buckets, sizeof(text_layout*));
+    r->text_cache.bucket_mask = (r->text_cache.buckets != nullptr) ? uint32_t(num_buckets - 1) : 0;
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_metal_init(r);
+    else
+#endif
+        od_cpu_init(r, def->cpu.num_threads);
+
+    od_resize(r, def->viewport_width, def->viewport_height);
+
+    if (def->atlas.width != 0)
+        od_create_atlas(r, def->atlas.width, def->atlas.height, def->atlas.num_slices);
+
+    return r;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_upload_slice(struct onedraw* r, const void* pixel_data, uint32_t slice_index)
+{
+    assert_msg(slice_index<r->rasterizer.num_slices, "slice_index is out of bound");
+
+    // quads of an opaque slice can hide the commands below them
+    const uint32_t* texels = (const uint32_t*) pixel_data;
+    bool opaque = true;
+    for(uint32_t i=0; i<r->rasterizer.slice_num_pixels && opaque; ++i)
+        opaque = (texels[i] >> 24) == 0xff;
+
+    if (opaque)
+        r->rasterizer.opaque_slices[slice_index / 32] |= 1u << (slice_index % 32);
+    else
+        r->rasterizer.opaque_slices[slice_index / 32] &= ~(1u << (slice_index % 32));
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+    {
+        const NS::UInteger bpp = 4;   // MTL::PixelFormat::PixelFormatRGBA8Unorm_sRGB
+        const NS::UInteger bytes_per_row = r->rasterizer.atlas->width() * bpp;
+
+        MTL::Region region = MTL::Region::Make2D(0, 0, r->rasterizer.atlas->width(), r->rasterizer.atlas->height());
+
+        r->rasterizer.atlas->replaceRegion(
+            region,
+            0,  // no mipmap
+            slice_index,
+            pixel_data,
+            bytes_per_row,
+            bytes_per_row * r->rasterizer.atlas->height()
+        );
+        return;
+    }
+#endif
+
+    const size_t slice_size = (size_t)r->cpu.atlas.width * r->cpu.atlas.height * 4;
+    memcpy(r->cpu.atlas.pixels + slice_size * slice_index, pixel_data, slice_size);
+    r->cpu.full_redraw = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_set_capture_region(struct onedraw* r, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    assert_msg(x<=r->rasterizer.width && width<=r->rasterizer.width && y<=r->rasterizer.height && height<=r->rasterizer.height,
+               "capture region cannot be bigger than the rendertarget");
+    r->screenshot.region_x = x;
+    r->screenshot.region_y = y;
+    r->screenshot.region_width = width;
+    r->screenshot.region_height = height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_get_capture_region_dimensions(struct onedraw *r, uint32_t* width, uint32_t* height)
+{
+    *width = r->screenshot.region_width;
+    *height = r->screenshot.region_height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_take_screenshot(struct onedraw* r, void* out_pixels)
+{
+    assert_msg(r->screenshot.allocate_resources, "set allow_screenshot to true when calling od_init()");
+    r->screenshot.capture_image = true;
+    r->screenshot.out_pixels = out_pixels;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_resize(struct onedraw* r, uint32_t width, uint32_t height)
+{
+    assert_msg(r->commands.wide_aabb || (width <= MAX_NARROW_VIEWPORT && height <= MAX_NARROW_VIEWPORT),
+               "viewports larger than 4096 pixels need onedraw_def.wide_aabb");
+
+    od_log(r, "resizing the framebuffer to %dx%d", width, height);
+    r->rasterizer.width = (uint16_t) width;
+    r->rasterizer.height = (uint16_t) height;
+    r->tiles.num_width = (uint16_t)((width + TILE_SIZE - 1) / TILE_SIZE);
+    r->tiles.num_height = (uint16_t)((height + TILE_SIZE - 1) / TILE_SIZE);
+    r->tiles.count = r->tiles.num_width * r->tiles.num_height;
+    r->regions.num_width = (r->tiles.num_width + REGION_SIZE - 1) / REGION_SIZE;
+    r->regions.num_height = (r->tiles.num_height + REGION_SIZE - 1) / REGION_SIZE;
+    r->regions.count = r->regions.num_width * r->regions.num_height;
+
+    free(r->occlusion.covered.bits);
+    r->occlusion.covered.words_per_row = (r->tiles.num_width + 63) / 64;
+    r->occlusion.covered.bits = (uint64_t*) malloc(sizeof(uint64_t) * r->occlusion.covered.words_per_row * r->tiles.num_height);
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_metal_resize(r);
+    else
+#endif
+        od_cpu_resize(r);
+
+    od_log(r, "%ux%u tiles", r->tiles.num_width, r->tiles.num_height);
+    od_log(r, "%ux%u regions", r->regions.num_width, r->regions.num_height);
+
+    od_init_screenshot_resources(r);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// recording contexts
+//      * a context owns a renderer with its own host command buffers, the draw functions don't know the difference
+//      * od_end_frame sorts the ended contexts, places them in the frame streams with a prefix sum of their sizes and
+//        copies them in parallel, fixing up the data and clip indices
+// ---------------------------------------------------------------------------------------------------------------------------
+
+struct od_context* od_context_create(struct onedraw* r)
+{
+    assert_msg(r->contexts.parent == nullptr, "cannot create a context from a context renderer");
+
+    void* memory = malloc(sizeof(od_context));
+    if (memory == nullptr)
+        return nullptr;
+
+    od_context* context = new(memory) od_context;
+    context->order_key = 0;
+    context->recording = false;
+
+    onedraw* recorder = &context->renderer;
+    recorder->custom_log = r->custom_log;
+    recorder->device = nullptr;
+    recorder->command_queue = nullptr;
+    recorder->contexts.parent = r;
+    recorder->commands.wide_aabb = r->commands.wide_aabb;
+    recorder->limits = r->limits;
+    recorder->commands.buffer.Init(nullptr, sizeof(draw_command) * r->limits.max_commands);
+    recorder->commands.colors.Init(nullptr, sizeof(draw_color) * r->limits.max_commands);
+    recorder->commands.data_buffer.Init(nullptr, sizeof(float) * r->limits.max_draw_data);
+    recorder->commands.aabb_buffer.Init(nullptr, sizeof(uint32_t) * aabb_words(r) * r->limits.max_commands);
+    recorder->commands.clipshapes_buffer.Init(nullptr, sizeof(clip_shape) * r->limits.max_clips);
+    return context;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+struct onedraw* od_context_begin(struct od_context* context, uint32_t order_key)
+{
+    assert_msg(!context->recording, "od_context_begin called twice without od_context_end");
+
+    onedraw* recorder = &context->renderer;
+    const onedraw* r = recorder->contexts.parent;
+
+    // state read by the draw functions
+    recorder->rasterizer.width = r->rasterizer.width;
+    recorder->rasterizer.height = r->rasterizer.height;
+    recorder->rasterizer.aa_width = r->rasterizer.aa_width;
+    recorder->rasterizer.num_slices = r->rasterizer.num_slices;
+    recorder->commands.packed = r->commands.packed;
+    recorder->font.desc = r->font.desc;
+    recorder->font.loaded = r->font.loaded;
+
+    recorder->commands.buffer.Map(0);
+    recorder->commands.colors.Map(0);
+    recorder->commands.aabb_buffer.Map(0);
+    recorder->commands.data_buffer.Map(0);
+    recorder->commands.clipshapes_buffer.Map(0);
+    od_set_cliprect(recorder, 0, 0, (uint16_t) r->rasterizer.width, (uint16_t) r->rasterizer.height);
+
+    context->order_key = order_key;
+    context->recording = true;
+    return recorder;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_context_end(struct od_context* context)
+{
+    onedraw* recorder = &context->renderer;
+    assert_msg(context->recording, "od_context_end called without od_context_begin");
+    assert_msg(recorder->commands.group_aabb == nullptr, "you need to call od_end_group, before od_context_end");
+    assert_msg(!recorder->list.recording, "you need to call od_list_end, before od_context_end");
+    context->recording = false;
+
+    onedraw* r = recorder->contexts.parent;
+    uint32_t slot = r->contexts.num_ended.fetch_add(1);
+    if (slot < MAX_CONTEXTS)
+        r->contexts.ended[slot] = context;
+    else
+        od_log(recorder, "too many contexts in a frame, maximum is %u", MAX_CONTEXTS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_context_destroy(struct od_context* context)
+{
+    if (context == nullptr)
+        return;
+
+    onedraw* recorder = &context->renderer;
+    recorder->commands.buffer.Terminate();
+    recorder->commands.colors.Terminate();
+    recorder->commands.data_buffer.Terminate();
+    recorder->commands.aabb_buffer.Terminate();
+    recorder->commands.clipshapes_buffer.Terminate();
+    free(recorder->list.boxes);
+    free(context);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// appends the contexts ended during the frame to the frame streams
+static void od_merge_contexts(struct onedraw* r)
+{
+    uint32_t num_contexts = min(r->contexts.num_ended.exchange(0), MAX_CONTEXTS);
+    if (num_contexts == 0)
+        return;
+
+    // stable sort on the key, the threads end their context in any order
+    od_context** contexts = r->contexts.ended;
+    for(uint32_t i=1; i<num_contexts; ++i)
+        for(uint32_t j=i; j>0 && contexts[j-1]->order_key > contexts[j]->order_key; --j)
+            swap(contexts[j-1], contexts[j]);
+
+    // exclusive prefix sum of the sizes, the frame buffers grow and only the contexts past the frame maximum are dropped
+    typedef struct context_range
+    {
+        od_context* context;
+        uint32_t first_command;
+        uint32_t first_data;
+        uint32_t first_clip;
+    } context_range;
+
+    context_range ranges[MAX_CONTEXTS];
+    uint32_t num_ranges = 0;
+    size_t num_commands = r->commands.buffer.GetNumElements();
+    size_t num_data = r->commands.data_buffer.GetNumElements();
+    size_t num_clips = r->commands.clipshapes_buffer.GetNumElements();
+    for(uint32_t i=0; i<num_contexts; ++i)
+    {
+        onedraw* recorder = &contexts[i]->renderer;
+        size_t context_commands = recorder->commands.buffer.GetNumElements();
+        size_t context_data = recorder->commands.data_buffer.GetNumElements();
+        size_t context_clips = recorder->commands.clipshapes_buffer.GetNumElements();
+
+        if (num_clips + context_clips > r->commands.clipshapes_buffer.GetMaxElements() ||
+            !od_grow_commands(r, num_commands + context_commands - r->commands.buffer.GetNumElements(),
+                              num_data + context_data - r->commands.data_buffer.GetNumElements()))
+        {
+            od_log(r, "out of draw commands/draw data/clip shapes buffer, context %u dropped", contexts[i]->order_key);
+            continue;
+        }
+
+        ranges[num_ranges++] = (context_range) {.context = contexts[i], .first_command = (uint32_t) num_commands,
+                                                .first_data = (uint32_t) num_data, .first_clip = (uint32_t) num_clips};
+        num_commands += context_commands;
+        num_data += context_data;
+        num_clips += context_clips;
+    }
+
+    r->commands.buffer.Push(num_commands - r->commands.buffer.GetNumElements());
+    r->commands.colors.Push(num_commands - r->commands.colors.GetNumElements());
+    r->commands.aabb_buffer.Push(num_commands * aabb_words(r) - r->commands.aabb_buffer.GetNumElements());
+    r->commands.data_buffer.Push(num_data - r->commands.data_buffer.GetNumElements());
+    r->commands.clipshapes_buffer.Push(num_clips - r->commands.clipshapes_buffer.GetNumElements());
+
+    auto copy_context = [r, &ranges](uint32_t index)
+    {
+        const context_range& range = ranges[index];
+        onedraw* recorder = &range.context->renderer;
+        uint32_t count = (uint32_t) recorder->commands.buffer.GetNumElements();
+
+        const draw_command* source = recorder->commands.buffer.GetData();
+        draw_command* destination = r->commands.buffer.GetData() + range.first_command;
+        for(uint32_t i=0; i<count; ++i)
+        {
+            destination[i] = source[i];
+            destination[i].data_index += range.first_data;
+            destination[i].clip_index += (uint8_t) range.first_clip;
+        }
+
+        memcpy(r->commands.colors.GetData() + range.first_command, recorder->commands.colors.GetData(), sizeof(draw_color) * count);
+        memcpy(r->commands.aabb_buffer.GetData() + range.first_command * aabb_words(r), recorder->commands.aabb_buffer.GetData(),
+               sizeof(uint32_t) * recorder->commands.aabb_buffer.GetNumElements());
+        memcpy(r->commands.data_buffer.GetData() + range.first_data, recorder->commands.data_buffer.GetData(),
+               sizeof(float) * recorder->commands.data_buffer.GetNumElements());
+        memcpy(r->commands.clipshapes_buffer.GetData() + range.first_clip, recorder->commands.clipshapes_buffer.GetData(),
+               sizeof(clip_shape) * recorder->commands.clipshapes_buffer.GetNumElements());
+    };
+
+    // the thread pool only exists on the cpu backend
+    if (r->device == nullptr)
+        r->cpu.pool.ParallelFor(num_ranges, copy_context);
+    else
+        for(uint32_t i=0; i<num_ranges; ++i)
+            copy_context(i);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// occlusion culling
+//      * the stream is traversed back to front, opaque boxes (no radius) and opaque quads outside of groups are occluders,
+//        the tiles they fully cover are accumulated in a bitmap
+//      * commands (or whole groups) whose bounding box is in covered tiles are removed from the stream
+//      * occluders are flagged, the tile binning stops at them for the tiles they cover
+// ---------------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline uint64_t tile_row_mask(uint32_t min_x, uint32_t max_x, uint32_t word)
+{
+    uint32_t first = max(min_x, word * 64), last = min(max_x, word * 64 + 63);
+    if (first > last)
+        return 0;
+
+    uint32_t count = last - first + 1;
+    return ((count == 64) ? ~0ull : ((1ull << count) - 1)) << (first - word * 64);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static bool tile_bitmap_covers(const tile_bitmap* bitmap, quantized_aabb box, uint32_t num_width, uint32_t num_height)
+{
+    // tiles outside of the viewport don't matter
+    uint32_t max_x = min((uint32_t)box.max_x, num_width - 1), max_y = min((uint32_t)box.max_y, num_height - 1);
+    for(uint32_t y=box.min_y; y<=max_y; ++y)
+        for(uint32_t word=box.min_x/64; word<=max_x/64 && box.min_x<=max_x; ++word)
+        {
+            uint64_t mask = tile_row_mask(box.min_x, max_x, word);
+            if ((bitmap->bits[y * bitmap->words_per_row + word] & mask) != mask)
+                return false;
+        }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// returns true and the tiles fully covered if the command is an occluder
+static bool od_occluder_tiles(struct onedraw* r, const draw_command* command, draw_color color, float* draw_data,
+                              const clip_shape* clip, quantized_aabb* tiles)
+{
+    if (command->fillmode != fill_solid || (color >> 24) != 0xff || clip->type != clip_rect ||
+        (command->type != primitive_aabox && command->type != primitive_quad))
+        return false;
+
+    draw_values values = load_draw_data(draw_data, command->data_index, command->type, command->fillmode);
+    const float* data = values.v;
+
+    aabb box;
+    if (command->type == primitive_aabox && data[4] == 0.f)
+        box = (aabb) {.min = {data[0] - data[2], data[1] - data[3]}, .max = {data[0] + data[2], data[1] + data[3]}};
+    else if (command->type == primitive_quad && (r->rasterizer.opaque_slices[command->extra / 32] & (1u << (command->extra % 32))))
+    {
+        // only the part sampling opaque texels, not the half texel border nor the uv outside of the texture
+        const float2 half_texel = r->rasterizer.atlas_half_texel;
+        if (!cpu::quad_opaque_range(data[0], data[2], data[4], data[6], half_texel.x, box.min.x, box.max.x) ||
+            !cpu::quad_opaque_range(data[1], data[3], data[5], data[7], half_texel.y, box.min.y, box.max.y))
+            return false;
+    }
+    else
+        return false;
+
+    // same test as is_tile_occluded() in the tile binning
+    const float aa_width = r->rasterizer.aa_width;
+    float min_x = max(box.min.x + aa_width, clip->rect.min_x), min_y = max(box.min.y + aa_width, clip->rect.min_y);
+    float max_x = min(box.max.x - aa_width, clip->rect.max_x), max_y = min(box.max.y - aa_width, clip->rect.max_y);
+    float tile_min_x = ceilf(max(min_x, 0.f) / TILE_SIZE), tile_min_y = ceilf(max(min_y, 0.f) / TILE_SIZE);
+    float tile_max_x = floorf(max_x / TILE_SIZE) - 1.f, tile_max_y = floorf(max_y / TILE_SIZE) - 1.f;
+    tile_max_x = min(tile_max_x, (float)r->tiles.num_width - 1.f);
+    tile_max_y = min(tile_max_y, (float)r->tiles.num_height - 1.f);
+    if (tile_min_x > tile_max_x || tile_min_y > tile_max_y)
+        return false;
+
+    *tiles = (quantized_aabb) {.min_x = (uint16_t)tile_min_x, .min_y = (uint16_t)tile_min_y, .max_x = (uint16_t)tile_max_x,
+                               .max_y = (uint16_t)tile_max_y};
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// removes the commands hidden by opaque ones, returns the number of commands removed
+static uint32_t od_occlusion_culling(struct onedraw* r)
+{
+    const uint32_t count = (uint32_t)r->commands.buffer.GetNumElements();
+    draw_command* commands = r->commands.buffer.GetData();
+    draw_color* colors = r->commands.colors.GetData();
+    uint32_t* aabbs = r->commands.aabb_buffer.GetData();
+    float* data = r->commands.data_buffer.GetData();
+    const clip_shape* clips = r->commands.clipshapes_buffer.GetData();
+    const uint32_t num_width = r->tiles.num_width;
+    const uint32_t num_height = r->tiles.num_height;
+    const bool wide = r->commands.wide_aabb;
+
+    tile_bitmap* covered = &r->occlusion.covered;
+    memset(covered->bits, 0, sizeof(uint64_t) * covered->words_per_row * num_height);
+    bool any_occluder = false, in_group = false, hidden_group = false;
+
+    // back to front, the commands kept are compacted at the end of the stream
+    uint32_t output = count;
+    for(uint32_t i=count; i-- > 0; )
+    {
+        draw_command command = commands[i];
+        bool hidden;
+        if (command.type == end_group)
+        {
+            // the end of a group has the bounding box of the whole group
+            hidden_group = any_occluder && tile_bitmap_covers(covered, load_quantized_aabb(aabbs, i, wide), num_width, num_height);
+            in_group = true;
+            hidden = hidden_group;
+        }
+        else if (in_group)
+        {
+            hidden = hidden_group;
+            in_group = (command.type != begin_group);
+        }
+        else
+        {
+            hidden = any_occluder && tile_bitmap_covers(covered, load_quantized_aabb(aabbs, i, wide), num_width, num_height);
+
+            quantized_aabb tiles;
+            if (!hidden && od_occluder_tiles(r, &command, colors[i], data, &clips[command.clip_index], &tiles))
+            {
+                command.fillmode |= FILLMODE_OCCLUDER;
+                for(uint32_t y=tiles.min_y; y<=tiles.max_y; ++y)
+                    for(uint32_t word=tiles.min_x/64; word<=tiles.max_x/64; ++word)
+                        covered->bits[y * covered->words_per_row + word] |= tile_row_mask(tiles.min_x, tiles.max_x, word);
+                any_occluder = true;
+            }
+        }
+
+        if (!hidden)
+        {
+            output--;
+            commands[output] = command;
+            colors[output] = colors[i];
+            store_quantized_aabb(aabbs, output, load_quantized_aabb(aabbs, i, wide), wide);
+        }
+    }
+
+    // the draw data don't move, the commands keep their data_index
+    uint32_t num_kept = count - output;
+    if (output > 0)
+    {
+        memmove(commands, commands + output, sizeof(draw_command) * num_kept);
+        memmove(colors, colors + output, sizeof(draw_color) * num_kept);
+        memmove(aabbs, aabbs + output * aabb_words(r), sizeof(uint32_t) * aabb_words(r) * num_kept);
+        r->commands.buffer.RemoveMultiple(output);
+        r->commands.colors.RemoveMultiple(output);
+        r->commands.aabb_buffer.RemoveMultiple(output * aabb_words(r));
+    }
+    return output;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the region buffers hold the commands of a binning pass, they double (with the other buffers of od_resize) for larger passes
+static void od_grow_regions(struct onedraw* r, uint32_t num_commands)
+{
+    const uint32_t capacity = od_grow_capacity(r->regions.capacity, min(num_commands, MAX_PASS_COMMANDS), MAX_PASS_COMMANDS);
+    if (capacity == r->regions.capacity)
+        return;
+
+    r->regions.capacity = capacity;
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_metal_resize(r);
+    else
+#endif
+        od_cpu_resize(r);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_begin_frame(struct onedraw* r)
+{
+    assert_msg(r->commands.group_aabb == nullptr, "previous frame was not ended properly with od_end_frame");
+    assert_msg(r->contexts.parent == nullptr, "od_begin_frame cannot be called on a context renderer");
+    r->stats.frame_index++;
+    r->stats.frame_start = std::chrono::steady_clock::now();
+    r->commands.buffer.Map(r->stats.frame_index);
+    r->commands.colors.Map(r->stats.frame_index);
+    r->commands.aabb_buffer.Map(r->stats.frame_index);
+    r->commands.data_buffer.Map(r->stats.frame_index);
+    r->commands.clipshapes_buffer.Map(r->stats.frame_index);
+    od_set_cliprect(r, 0, 0, (uint16_t) r->rasterizer.width, (uint16_t) r->rasterizer.height);
+
+    if (r->font.loaded != nullptr)
+        r->font.loaded->frame = r->stats.frame_index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_end_frame(struct onedraw* r, void* drawable)
+{
+    assert_msg(r->commands.group_aabb == nullptr, "you need to call od_end_group, before od_end_frame");
+    assert_msg(!r->list.recording, "you need to call od_list_end, before od_end_frame");
+    assert_msg(r->contexts.parent == nullptr, "od_end_frame cannot be called on a context renderer, use od_context_end");
+
+    if (r->screenshot.show_region)
+    {
+        aabb capture_region = {.min = {(float)r->screenshot.region_x, (float)r->screenshot.region_y}};
+        capture_region.max = vec2_add(capture_region.min, vec2_set(r->screenshot.region_width, r->screenshot.region_height));
+        od_draw_box(r, capture_region.min.x, capture_region.min.y, capture_region.max.x, capture_region.max.y, 0.f, 0x802020ff);
+    }
+
+    // after the last draw call of the renderer, the contexts come with their own clip shapes
+    od_merge_contexts(r);
+    r->stats.num_occluded_commands = r->rasterizer.occlusion_culling ? od_occlusion_culling(r) : 0;
+    r->stats.num_text_cache_hits = r->text_cache.num_hits;
+    r->stats.num_text_cache_misses = r->text_cache.num_misses;
+    r->text_cache.num_hits = r->text_cache.num_misses = 0;
+
+    r->stats.recording_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - r->stats.frame_start).count();
+    r->commands.count = (uint32_t)r->commands.buffer.GetNumElements();
+    r->stats.peak_num_draw_cmd = max(r->stats.peak_num_draw_cmd, r->commands.count);
+    r->stats.num_draw_data = (uint32_t)r->commands.data_buffer.GetNumElements();
+    r->stats.accumulated_gpu_time += atomic_load(&r->stats.gpu_time);
+    if (r->stats.frame_index%60 == 0)
+    {
+        r->stats.average_gpu_time = r->stats.accumulated_gpu_time / 60.f;
+        r->stats.accumulated_gpu_time = 0;
+    }
+    r->regions.num_groups = (r->commands.count + SIMD_GROUP_SIZE - 1) / SIMD_GROUP_SIZE;
+    od_grow_regions(r, r->commands.count);
+
+    if (r->capture.file != nullptr)
+        od_capture_write_frame(r);
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_flush(r, drawable);
+    else
+#endif
+        od_cpu_flush(r, drawable);
+
+    // ring buffer of the frame times for the percentiles
+    float frame_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - r->stats.frame_start).count();
+    r->stats.frame_times[r->stats.frame_time_index] = frame_time;
+    r->stats.frame_time_index = (r->stats.frame_time_index + 1) % r->stats.window;
+    r->stats.num_frame_times = min(r->stats.num_frame_times + 1, r->stats.window);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+float od_get_average_gputime(struct onedraw* r)
+{
+    return r->stats.average_gpu_time;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_terminate(struct onedraw* r)
+{
+    od_capture_end(r);
+
+    r->commands.buffer.Terminate();
+    r->commands.colors.Terminate();
+    r->commands.data_buffer.Terminate();
+    r->commands.aabb_buffer.Terminate();
+    r->commands.draw_arg.Terminate();
+    r->commands.bin_output_arg.Terminate();
+    r->commands.clipshapes_buffer.Terminate();
+    free(r->occlusion.covered.bits);
+    free(r->list.boxes);
+
+    for(text_layout* layout = r->text_cache.lru_head; layout != nullptr; )
+    {
+        text_layout* next = layout->lru_next;
+        free(layout);
+        layout = next;
+    }
+    free(r->text_cache.buckets);
+    od_release_font(r->font.loaded);
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        od_metal_terminate(r);
+    else
+#endif
+        od_cpu_terminate(r);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_get_stats(struct onedraw* r, od_stats* stats)
+{
+    stats->frame_index = r->stats.frame_index;
+    stats->num_draw_cmd = r->commands.count, r->commands.buffer.GetMaxElements();
+    stats->peak_num_draw_cmd = r->stats.peak_num_draw_cmd;
+    stats->gpu_time_ms = r->stats.average_gpu_time * 1000.f;
+    stats->binning_time_ms = r->stats.binning_time * 1000.f;
+    stats->raster_time_ms = r->stats.raster_time * 1000.f;
+    stats->recording_time_ms = r->stats.recording_time * 1000.f;
+    stats->num_nodes = r->stats.num_nodes;
+    stats->num_tiles = r->stats.num_tiles;
+    stats->num_overflow_nodes = r->stats.num_overflow_nodes;
+    stats->num_binning_passes = r->stats.num_binning_passes;
+    stats->max_tile_nodes = r->stats.max_tile_nodes;
+    stats->num_changed_tiles = r->stats.num_changed_tiles;
+    stats->num_occluded_commands = r->stats.num_occluded_commands;
+    stats->num_text_cache_hits = r->stats.num_text_cache_hits;
+    stats->num_text_cache_misses = r->stats.num_text_cache_misses;
+
+    // nearest-rank percentiles over the window
+    float sorted[STATS_MAX_WINDOW];
+    uint32_t count = r->stats.num_frame_times;
+    memcpy(sorted, r->stats.frame_times, count * sizeof(float));
+    qsort(sorted, count, sizeof(float), compare_float);
+    stats->frame_time_p50_ms = (count) ? sorted[(count * 50 + 99) / 100 - 1] * 1000.f : 0.f;
+    stats->frame_time_p95_ms = (count) ? sorted[(count * 95 + 99) / 100 - 1] * 1000.f : 0.f;
+    stats->frame_time_p99_ms = (count) ? sorted[(count * 99 + 99) / 100 - 1] * 1000.f : 0.f;
+
+    size_t gpu_mem = r->commands.aabb_buffer.GetTotalSize();
+    gpu_mem += r->commands.bin_output_arg.GetTotalSize();
+    gpu_mem += r->commands.buffer.GetTotalSize();
+    gpu_mem += r->commands.clipshapes_buffer.GetTotalSize();
+    gpu_mem += r->commands.colors.GetTotalSize();
+    gpu_mem += r->commands.data_buffer.GetTotalSize();
+    gpu_mem += r->commands.draw_arg.GetTotalSize();
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+        gpu_mem += od_metal_memory_usage(r);
+    else
+#endif
+        gpu_mem += od_cpu_memory_usage(r);
+
+    stats->gpu_memory_usage = gpu_mem;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+bool od_capture_begin(struct onedraw* r, const char* filename)
+{
+    assert_msg(r->capture.file == nullptr, "a capture is already running, call od_capture_end first");
+
+    r->capture.file = fopen(filename, "wb");
+    if (r->capture.file == nullptr)
+    {
+        od_log(r, "can't open capture file %s", filename);
+        return false;
+    }
+
+    capture_header header = 
+    {
+        .magic = CAPTURE_MAGIC,
+        .version = CAPTURE_VERSION,
+        .num_frames = 0,
+        .header_size = sizeof(capture_header),
+        .sizeof_command = sizeof(draw_command),
+        .sizeof_aabb = sizeof(uint32_t),
+        .sizeof_clip = sizeof(clip_shape),
+        .padding = {0}
+    };
+    fwrite(&header, sizeof(header), 1, r->capture.file);
+    r->capture.num_frames = 0;
+    r->capture.num_skipped_frames = 0;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_capture_end(struct onedraw* r)
+{
+    if (r->capture.file == nullptr)
+        return;
+
+    // patch the number of frames
+    fseek(r->capture.file, offsetof(capture_header, num_frames), SEEK_SET);
+    fwrite(&r->capture.num_frames, sizeof(uint32_t), 1, r->capture.file);
+    fclose(r->capture.file);
+    r->capture.file = nullptr;
+
+    od_log(r, "%u frames captured, %u skipped", r->capture.num_frames, r->capture.num_skipped_frames);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// true if the block of [count] elements at [offset] is aligned and lies between the frame structure and the end of the frame
+static inline bool capture_block_valid(const capture_frame* frame, uint32_t offset, uint32_t count, size_t element_size)
+{
+    return (offset % CAPTURE_ALIGNMENT) == 0 && offset >= sizeof(capture_frame) && offset <= frame->frame_size &&
+           (uint64_t) count * element_size <= frame->frame_size - offset;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+const void* od_capture_next_frame(const void* capture, size_t size, const void* frame)
+{
+    const uint8_t* begin = (const uint8_t*) capture;
+    const capture_header* header = (const capture_header*) capture;
+
+    if (size < sizeof(capture_header) || header->magic != CAPTURE_MAGIC || header->version != CAPTURE_VERSION ||
+        header->sizeof_command != sizeof(draw_command) || header->sizeof_aabb != sizeof(uint32_t) ||
+        header->sizeof_clip != sizeof(clip_shape) || header->header_size < sizeof(capture_header) ||
+        header->header_size > size || (header->header_size % CAPTURE_ALIGNMENT) != 0)
+        return nullptr;
+
+    // the previous frame was validated by the previous call
+    size_t offset = (frame == nullptr) ? header->header_size :
+                                         size_t((const uint8_t*) frame - begin) + ((const capture_frame*) frame)->frame_size;
+
+    // truncated file (capture not ended properly) : stop at the last complete frame
+    if (offset + sizeof(capture_frame) > size)
+        return nullptr;
+
+    const capture_frame* next = (const capture_frame*) (begin + offset);
+    if (next->frame_size < sizeof(capture_frame) || (next->frame_size % CAPTURE_ALIGNMENT) != 0 || next->frame_size > size - offset)
+        return nullptr;
+
+    // corrupted frame : the blocks must not read past the frame
+    const uint32_t aabb_size = (next->aabb_words == 2) ? sizeof(uint32_t) * 2 : sizeof(uint32_t);
+    if ((next->aabb_words != 1 && next->aabb_words != 2) ||
+        !capture_block_valid(next, next->commands_offset, next->num_commands, sizeof(draw_command)) ||
+        !capture_block_valid(next, next->colors_offset, next->num_commands, sizeof(draw_color)) ||
+        !capture_block_valid(next, next->aabbs_offset, next->num_commands, aabb_size) ||
+        !capture_block_valid(next, next->draw_data_offset, next->num_draw_data, sizeof(float)) ||
+        !capture_block_valid(next, next->clips_offset, next->num_clips, sizeof(clip_shape)))
+        return nullptr;
+
+    return next;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_capture_frame_dimensions(const void* frame, uint32_t* width, uint32_t* height)
+{
+    *width = ((const capture_frame*) frame)->width;
+    *height = ((const capture_frame*) frame)->height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_replay_frame(struct onedraw* r, const void* frame_data, void* drawable)
+{
+    assert_msg(r->commands.group_aabb == nullptr, "od_replay_frame can't be called between od_begin_frame/od_end_frame");
+    assert_msg(((uintptr_t)frame_data) % sizeof(uintptr_t) == 0, "the capture must be aligned on sizeof(uintptr_t)");
+
+    const capture_frame* frame = (const capture_frame*) frame_data;
+    const uint8_t* base = (const uint8_t*) frame_data;
+
+    if (frame->num_commands > MAX_FRAME_COMMANDS || frame->num_draw_data > MAX_FRAME_DRAW_DATA || frame->num_clips > MAX_CLIPS)
+    {
+        od_log(r, "frame %u exceeds the limits of the renderer, skipped", frame->frame_index);
+        return;
+    }
+
+    if (frame->width != r->rasterizer.width || frame->height != r->rasterizer.height)
+        od_resize(r, frame->width, frame->height);
+    od_grow_regions(r, frame->num_commands);
+
+    // the glyph indices and sizes of the text commands are the ones of the built-in font at this height
+    if (r->font.loaded != nullptr || r->font.desc.font_height != frame->font_height)
+        od_load_font(r, nullptr, 0, frame->font_height);
+
+    r->stats.frame_index++;
+    r->commands.count = frame->num_commands;
+    r->stats.peak_num_draw_cmd = max(r->stats.peak_num_draw_cmd, r->commands.count);
+    r->regions.num_groups = (r->commands.count + SIMD_GROUP_SIZE - 1) / SIMD_GROUP_SIZE;
+    r->tiles.culling_debug = (frame->culling_debug != 0);
+    r->rasterizer.clear_color = (float4) {.x = frame->clear_color[0], .y = frame->clear_color[1], .z = frame->clear_color[2], .w = frame->clear_color[3]};
+    r->rasterizer.aa_width = frame->aa_width;
+
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
+    {
+        // metal buffers can't alias the capture, blocks are copied in the in-flight buffers (grown if needed)
+        assert_msg(frame->aabb_words == aabb_words(r), "the capture and the renderer must have the same onedraw_def.wide_aabb");
+        r->commands.buffer.Map(r->stats.frame_index);
+        r->commands.colors.Map(r->stats.frame_index);
+        r->commands.aabb_buffer.Map(r->stats.frame_index);
+        r->commands.data_buffer.Map(r->stats.frame_index);
+        r->commands.clipshapes_buffer.Map(r->stats.frame_index);
+        if (!od_grow_commands(r, frame->num_commands, frame->num_draw_data) ||
+            !r->commands.clipshapes_buffer.Grow(frame->num_clips, r->stats.frame_index))
+            return;
+
+        memcpy(r->commands.buffer.GetData(), base + frame->commands_offset, frame->num_commands * sizeof(draw_command));
+        memcpy(r->commands.colors.GetData(), base + frame->colors_offset, frame->num_commands * sizeof(draw_color));
+        memcpy(r->commands.aabb_buffer.GetData(), base + frame->aabbs_offset, frame->num_commands * frame->aabb_words * sizeof(uint32_t));
+        memcpy(r->commands.data_buffer.GetData(), base + frame->draw_data_offset, frame->num_draw_data * sizeof(float));
+        memcpy(r->commands.clipshapes_buffer.GetData(), base + frame->clips_offset, frame->num_clips * sizeof(clip_shape));
+        od_flush(r, drawable);
+        return;
+    }
+#endif
+
+    // cpu backend : the kernels read the capture in place
+    draw_cmd_arguments* args = &r->cpu.args;
+    od_fill_draw_arguments(r, args);
+    args->commands = (draw_command*) (base + frame->commands_offset);
+    args->colors = (draw_color*) (base + frame->colors_offset);
+    args->commands_aabb = (uint32_t*) (base + frame->aabbs_offset);
+    args->wide_aabb = (frame->aabb_words == 2);
+    args->draw_data = (float*) (base + frame->draw_data_offset);
+    args->clips = (clip_shape*) (base + frame->clips_offset);
+    args->glyphs = r->cpu.glyphs;
+    od_cpu_render(r, drawable, frame->num_draw_data);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline float draw_cmd_aabb_bump(struct onedraw* r)
+{
+    float result = r->rasterizer.aa_width + r->rasterizer.outline_width;
+    if (r->rasterizer.group_op == op_blend)
+        result += r->rasterizer.group_smoothness;
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// command writer
+//      * a command is spread in four streams (command, color, aabb and draw data), they are reserved with a single check
+//        so nothing has to be rolled back when one of them is full
+//      * the number of floats is a compile-time constant of each primitive
+// ---------------------------------------------------------------------------------------------------------------------------
+
+typedef struct command_record
+{
+    draw_command* command;
+    draw_color* color;
+    uint32_t* aabb;
+    float* data;
+} command_record;
+
+//----------------------------------------------------------------------------------------------------------------------------
+// keeps the unquantized bounding box of a command recorded in a list, the list can then be translated by any amount
+static inline void od_list_record_aabb(struct onedraw* r, const draw_command* command, aabb box)
+{
+    uint32_t index = (uint32_t)(command - r->commands.buffer.GetData()) - r->list.first_command;
+    r->list.boxes[index] = box;
+    if (r->commands.group_aabb != nullptr)
+        r->list.boxes[r->list.group_index] = aabb_merge(r->list.boxes[r->list.group_index], box);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// rounds to the nearest half, returns false if the value is not zero or a normal half
+static inline bool float_to_half(float value, uint16_t* output)
+{
+    uint32_t bits = bitcast_float_to_u32(value);
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    if ((bits & 0x7fffffff) == 0)
+    {
+        *output = sign;
+        return true;
+    }
+
+    int32_t exponent = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = (bits & 0x7fffff) + 0x1000;
+    if (mantissa & 0x800000)
+    {
+        mantissa = 0;
+        exponent++;
+    }
+
+    if (exponent <= 0 || exponent >= 31)
+        return false;
+
+    *output = sign | (uint16_t)(exponent << 10) | (uint16_t)(mantissa >> 13);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// rewrites the draw data of a command as 16 bits values (see packed_layout()) when all of them fit their encoding
+// returns the number of floats used by the command
+static inline uint32_t od_pack_draw_data(struct onedraw* r, draw_command* command, float* data, uint32_t count)
+{
+    // lists keep floats as they are translated at submit
+    if (!r->commands.packed || r->list.recording)
+        return count;
+
+    uint16_t packed[MAX_DRAW_VALUES * 2];
+    uint32_t num_packed = 0, index = 0;
+    for(uint32_t layout = packed_layout(command->type, command->fillmode); layout != 0; layout >>= 3, ++index)
+    {
+        if (index == count)
+            return count;
+
+        float value = data[index];
+        switch(layout & 7)
+        {
+        case packed_position:
+            value = roundf(value * PACKED_POSITION_SCALE);
+            if (!(value >= 0.f && value <= (float)UINT16_MAX))
+                return count;
+            packed[num_packed++] = (uint16_t) value;
+            break;
+        case packed_unorm:
+            if (!(value >= 0.f && value <= 1.f))
+                return count;
+            packed[num_packed++] = (uint16_t) roundf(value * 65535.f);
+            break;
+        case packed_snorm:
+            if (!(value >= -1.f && value <= 1.f))
+                return count;
+            packed[num_packed++] = (uint16_t) (int16_t) roundf(value * 32767.f);
+            break;
+        case packed_half:
+            if (!float_to_half(value, &packed[num_packed++]))
+                return count;
+            break;
+        case packed_color:
+        {
+            uint32_t color = bitcast_float_to_u32(value);
+            packed[num_packed++] = (uint16_t) color;
+            packed[num_packed++] = (uint16_t) (color >> 16);
+            break;
+        }
+        }
+    }
+
+    if (index != count)
+        return count;
+
+    if (num_packed & 1)
+        packed[num_packed++] = 0;
+
+    memcpy(data, packed, num_packed * sizeof(uint16_t));
+    command->data_index |= DRAW_DATA_PACKED;
+    return num_packed / 2;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// false if the box is outside of the viewport or the current clip shape, the command would not change any pixel
+// everything is kept while recording a list as it can be translated at submit
+static inline bool od_is_visible(struct onedraw* r, aabb box)
+{
+    return r->list.recording || aabb_overlap(box, r->commands.visible);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// reserves [count] commands of DataSize floats each, returns null pointers if they don't fit
+template<uint32_t DataSize>
+static inline command_record od_reserve_commands(struct onedraw* r, uint32_t count)
+{
+    if ((!r->commands.buffer.HasRoom(count) || !r->commands.data_buffer.HasRoom(count * DataSize)) &&
+        !od_grow_commands(r, count, count * DataSize))
+        return (command_record) {.command = nullptr, .color = nullptr, .aabb = nullptr, .data = nullptr};
+
+    const uint32_t data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
+    const uint8_t clip_index = LAST_CLIP_INDEX;
+    command_record record =
+    {
+        .command = r->commands.buffer.Push(count),
+        .color = r->commands.colors.Push(count),
+        .aabb = r->commands.aabb_buffer.Push(count * aabb_words(r)),
+        .data = r->commands.data_buffer.Push(count * DataSize)
+    };
+
+    for(uint32_t i=0; i<count; ++i)
+        record.command[i] = (draw_command) {.data_index = data_index + i * DataSize, .extra = 0, .clip_index = clip_index,
+                                            .fillmode = fill_solid, .type = 0};
+    return record;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// bounding box of a recorded command, also merged in the open group and kept by the list being recorded
+static inline void od_write_record_aabb(struct onedraw* r, const command_record* record, aabb box)
+{
+    quantized_aabb quantized = write_quantized_aabb(r, record->aabb, 0, box.min.x, box.min.y, box.max.x, box.max.y);
+    if (r->commands.group_aabb != nullptr)
+        merge_quantized_aabb(&r->commands.group_box, quantized);
+    if (r->list.recording)
+        od_list_record_aabb(r, record->command, box);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// writes a command, its draw data (one float per argument) and its bounding box
+// returns the record to patch extra fields, command is null if the box is not visible or (an error is logged) out of space
+template<typename... Args>
+static inline command_record od_write_command(struct onedraw* r, enum command_type type, enum primitive_fillmode fillmode,
+                                              draw_color color, aabb box, Args... data)
+{
+    if (!od_is_visible(r, box))
+        return (command_record) {.command = nullptr, .color = nullptr, .aabb = nullptr, .data = nullptr};
+
+    command_record record = od_reserve_commands<sizeof...(Args)>(r, 1);
+    if (record.command == nullptr)
+    {
+        od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+        return record;
+    }
+
+    record.command->type = (uint8_t) type;
+    record.command->fillmode = (uint8_t) fillmode;
+    *record.color = color;
+    write_float(record.data, data...);
+    r->commands.data_buffer.RemoveMultiple(sizeof...(Args) - od_pack_draw_data(r, record.command, record.data, sizeof...(Args)));
+    od_write_record_aabb(r, &record, box);
+    return record;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_begin_group(struct onedraw* r, bool smoothblend, float group_smoothness, float outline_width)
+{
+    assert_msg(r->commands.group_aabb == nullptr, "cannot call a second time od_begin_group without closing the previous group");
+    assert_msg(group_smoothness >= 0.f, "smoothness cannot be negative");
+
+    if (!smoothblend)
+        group_smoothness = 0.f;
+
+    command_record record = od_reserve_commands<2>(r, 1);
+    if (record.command == nullptr)
+    {
+        od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+        return;
+    }
+
+    enum sdf_operator op = smoothblend ? op_blend : op_overwrite;
+    record.command->type = begin_group;
+    record.command->extra = (uint8_t)op;
+    *record.color = 0;
+    write_float(record.data, group_smoothness + outline_width, outline_width);
+    r->commands.data_buffer.RemoveMultiple(2 - od_pack_draw_data(r, record.command, record.data, 2));
+
+    // keep values for the end group command
+    r->rasterizer.outline_width = outline_width;
+    r->rasterizer.group_smoothness = group_smoothness;
+    r->rasterizer.group_op = op;
+
+    // reserve a aabb that we're going to update depending on the coming shapes
+    r->commands.group_aabb = record.aabb;
+    r->commands.group_box = invalid_quantized_aabb();
+    store_quantized_aabb(r->commands.group_aabb, 0, r->commands.group_box, r->commands.wide_aabb);
+
+    if (r->list.recording)
+    {
+        r->list.group_index = (uint32_t)(record.command - r->commands.buffer.GetData()) - r->list.first_command;
+        r->list.boxes[r->list.group_index] = aabb_invalid();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_end_group(struct onedraw* r, draw_color outline_color)
+{
+    assert(r->commands.group_aabb != nullptr);
+
+    command_record record = od_reserve_commands<1>(r, 1);
+    if (record.command != nullptr)
+    {
+        record.command->type = end_group;
+        record.command->fillmode = (r->rasterizer.outline_width > 0.f) ? fill_outline : fill_solid;
+        record.command->extra = (uint8_t) r->rasterizer.group_op;
+        *record.color = outline_color;
+
+        // the shapes' boxes are already inside their clip, the group is also limited to the current one
+        const aabb& bounds = r->commands.visible;
+        quantized_aabb visible = quantize_aabb(bounds.min.x, bounds.min.y, bounds.max.x, bounds.max.y, bounds);
+        quantized_aabb* group = &r->commands.group_box;
+        group->min_x = max(group->min_x, visible.min_x);
+        group->min_y = max(group->min_y, visible.min_y);
+        group->max_x = min(group->max_x, visible.max_x);
+        group->max_y = min(group->max_y, visible.max_y);
+        store_quantized_aabb(record.aabb, 0, *group, r->commands.wide_aabb);
+        store_quantized_aabb(r->commands.group_aabb, 0, *group, r->commands.wide_aabb);
+
+        // we put also the smooth value as we traverse the list in reverse order on the gpu
+        write_float(record.data, r->rasterizer.group_smoothness + r->rasterizer.outline_width);
+        r->commands.data_buffer.RemoveMultiple(1 - od_pack_draw_data(r, record.command, record.data, 1));
+
+        if (r->list.recording)
+            r->list.boxes[(uint32_t)(record.command - r->commands.buffer.GetData()) - r->list.first_command] =
+                r->list.boxes[r->list.group_index];
+    }
+    else
+    {
+        store_quantized_aabb(r->commands.group_aabb, 0, r->commands.group_box, r->commands.wide_aabb);
+        od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+    }
+
+    // the group is closed even when out of space
+    r->commands.group_aabb = nullptr;
+    r->rasterizer.group_smoothness = 0.f;
+    r->rasterizer.group_op = op_overwrite;
+    r->rasterizer.outline_width = 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void private_draw_disc(struct onedraw* r, vec2 center, float radius, float thickness, enum primitive_fillmode fillmode,
+                       draw_color primary_color, draw_color secondary_color)
+{
+    thickness *= .5f;
+
+    float max_radius = radius + draw_cmd_aabb_bump(r);
+    if (fillmode == fill_hollow)
+        max_radius += thickness;
+
+    aabb bb = aabb_from_circle(center, max_radius);
+
+    if (fillmode == fill_hollow)
+        od_write_command(r, primitive_disc, fillmode, primary_color, bb, center.x, center.y, radius, thickness);
+    else if (fillmode == fill_gradient)
+        od_write_command(r, primitive_disc, fillmode, primary_color, bb, center.x, center.y, radius, bitcast_u32_to_float(secondary_color));
+    else
+        od_write_command(r, primitive_disc, fillmode, primary_color, bb, center.x, center.y, radius);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_ring(struct onedraw* r, float cx, float cy, float radius, float thickness, draw_color color)
+{
+    private_draw_disc(r, vec2_set(cx, cy), radius, thickness, fill_hollow, color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_disc(struct onedraw* r, float cx, float cy, float radius, draw_color color)
+{
+    private_draw_disc(r, vec2_set(cx, cy), radius, 0.f, fill_solid, color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_disc_gradient(struct onedraw* r, float cx, float cy, float radius, draw_color outter_color, draw_color inner_color)
+{
+    private_draw_disc(r, vec2_set(cx, cy), radius, 0.f, fill_gradient, outter_color, inner_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void private_draw_oriented_box(struct onedraw* r, vec2 p0, vec2 p1, float width, float roundness, float thickness,
+                               enum primitive_fillmode fillmode, draw_color primary_color, draw_color secondary_color)
+{
+    if (vec2_similar(p0, p1, HALF_PIXEL))
+        return;
+
+    thickness *= .5f;
+
+    float roundness_thickness = (fillmode == fill_hollow) ? thickness : roundness;
+    aabb bb = aabb_from_rounded_obb(p0, p1, width, roundness_thickness + draw_cmd_aabb_bump(r));
+
+    if (fillmode == fill_gradient)
+        od_write_command(r, primitive_oriented_box, fillmode, primary_color, bb, p0.x, p0.y, p1.x, p1.y, width, roundness_thickness,
+                         bitcast_u32_to_float(secondary_color));
+    else
+        od_write_command(r, primitive_oriented_box, fillmode, primary_color, bb, p0.x, p0.y, p1.x, p1.y, width, roundness_thickness);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_oriented_box(struct onedraw* r, float ax, float ay, float bx, float by, float width, float roundness, draw_color color)
+{
+    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, roundness, 0.f, fill_solid, color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_oriented_rect(struct onedraw* r, float ax, float ay, float bx, float by, float width, float roundness, float thickness, draw_color color)
+{
+    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, roundness, thickness, fill_hollow, color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_line(struct onedraw* r, float ax, float ay, float bx, float by, float width, draw_color srgb_color)
+{
+    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), width, 0.f, 0.f, fill_solid, srgb_color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_capsule(struct onedraw* r, float ax, float ay, float bx, float by, float radius, draw_color srgb_color)
+{
+    // capsule uses a specific sdf (see rasterizer shader) more efficient that oriented box
+    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), 0.f, radius, 0.f, fill_solid, srgb_color, 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_capsule_gradient(struct onedraw* r, float ax, float ay, float bx, float by, float radius, draw_color primary_color, draw_color secondary_color)
+{
+    private_draw_oriented_box(r, vec2_set(ax, ay), vec2_set(bx, by), 0.f, radius, 0.f, fill_gradient, primary_color, secondary_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void private_draw_ellipse(struct onedraw* r, vec2 p0, vec2 p1, float width, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+{
+    if (vec2_similar(p0, p1, HALF_PIXEL))
+        return;
+
+    if (width <= HALF_PIXEL)
+        private_draw_oriented_box(r, p0, p1, 0.f, 0.f, 0.f, fill_solid, srgb_color, 0);
+    else
+    {
+        thickness = float_max(thickness * .5f, 0.f);
+        aabb bb = aabb_from_rounded_obb(p0, p1, width, draw_cmd_aabb_bump(r) + thickness);
+
+        if (fillmode == fill_hollow)
+            od_write_command(r, primitive_ellipse, fillmode, srgb_color, bb, p0.x, p0.y, p1.x, p1.y, width, thickness);
+        else
+            od_write_command(r, primitive_ellipse, fillmode, srgb_color, bb, p0.x, p0.y, p1.x, p1.y, width);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_ellipse(struct onedraw* r, float ax, float ay, float bx, float by, float width, draw_color srgb_color)
+{
+    private_draw_ellipse(r, vec2_set(ax, ay), vec2_set(bx, by), width, 0.f, fill_solid, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_ellipse_ring(struct onedraw* r, float ax, float ay, float bx, float by, float width, float thickness, draw_color srgb_color)
+{
+    private_draw_ellipse(r, vec2_set(ax, ay), vec2_set(bx, by), width, thickness, fill_hollow, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void private_draw_triangle(struct onedraw* r, const vec2* v, float roundness, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+{
+    // exclude invalid triangle
+    if (vec2_similar(v[0], v[1], HALF_PIXEL) || vec2_similar(v[2], v[1], HALF_PIXEL) || 
+        vec2_similar(v[0], v[2], HALF_PIXEL)) return;
+
+    thickness *= .5f;
+
+    float roundness_thickness = (fillmode != fill_hollow) ? roundness : thickness;
+    aabb bb = aabb_from_triangle(v[0], v[1], v[2]);
+    aabb_grow(&bb, vec2_splat(roundness_thickness + draw_cmd_aabb_bump(r)));
+
+    od_write_command(r, primitive_triangle, fillmode, srgb_color, bb, v[0].x, v[0].y, v[1].x, v[1].y, v[2].x, v[2].y, roundness_thickness);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_triangle(struct onedraw* r, const float* vertices, float roundness, draw_color srgb_color)
+{
+    private_draw_triangle(r, (const vec2*) vertices, roundness, 0.f, fill_solid, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_triangle_ring(struct onedraw* r, const float* vertices, float roundness, float thickness, draw_color srgb_color)
+{
+    private_draw_triangle(r, (const vec2*) vertices, roundness, thickness, fill_hollow, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void private_draw_pie(struct onedraw* r, vec2 center, vec2 direction, float radius, float aperture, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+{
+    if (aperture <= FLT_EPSILON)
+        return;
+    
+    aperture = float_clamp(aperture, 0.f, VEC2_PI);
+    thickness = float_max(thickness * .5f, 0.f);
+
+    aabb bb = aabb_from_circle(center, radius);
+    aabb_grow(&bb, vec2_splat(thickness + draw_cmd_aabb_bump(r)));
+
+    if (fillmode != fill_hollow)
+        od_write_command(r, primitive_pie, fillmode, srgb_color, bb, center.x, center.y, radius, direction.x, direction.y,
+                         sinf(aperture), cosf(aperture));
+    else
+        od_write_command(r, primitive_pie, fillmode, srgb_color, bb, center.x, center.y, radius, direction.x, direction.y,
+                         sinf(aperture), cosf(aperture), thickness);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_sector(struct onedraw* r, float cx, float cy, float radius, float start_angle, float sweep_angle, draw_color srgb_color)
+{
+    vec2 center = {cx, cy};
+    float aperture = sweep_angle * .5f;
+    vec2 direction = vec2_direction(start_angle + aperture);
+    private_draw_pie(r, center, direction, radius, fabs(aperture), 0.f, fill_solid, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_sector_ring(struct onedraw* r, float cx, float cy, float radius, float start_angle, float sweep_angle, float thickness, draw_color srgb_color)
+{
+    vec2 center = {cx, cy};
+    float aperture = sweep_angle * .5f;
+    vec2 direction = vec2_direction(start_angle + aperture);
+    private_draw_pie(r, center, direction, radius, fabs(aperture), thickness, fill_hollow, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_arc(struct onedraw* r, float cx, float cy, float dx, float dy, float aperture, float radius, float thickness, draw_color srgb_color)
+{
+    vec2 center = {cx, cy};
+    vec2 direction = {dx, dy};
+
+    aperture = float_clamp(aperture, 0.f, VEC2_PI);
+    thickness = float_max(thickness, 0.f);
+
+    aabb bb = aabb_from_circle(center, radius);
+    aabb_grow(&bb, vec2_splat(thickness + draw_cmd_aabb_bump(r)));
+
+    od_write_command(r, primitive_arc, fill_solid, srgb_color, bb, center.x, center.y, radius, direction.x, direction.y,
+                     sinf(aperture), cosf(aperture), thickness);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_box(struct onedraw* r, float x0, float y0, float x1, float y1, float radius, draw_color srgb_color)
+{
+    if (x0>x1) swap(x0, x1);
+    if (y0>y1) swap(y0, y1);
+
+    aabb box = {.min = {x0, y0}, .max = {x1, y1}};
+    vec2 center = vec2_scale(vec2_add(box.min, box.max), .5f);
+    vec2 half_extents = vec2_scale(vec2_sub(box.max, box.min), .5f);
+    aabb_grow(&box, vec2_splat(draw_cmd_aabb_bump(r)));
+
+    od_write_command(r, primitive_aabox, fill_solid, srgb_color, box, center.x, center.y, half_extents.x, half_extents.y, radius);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_blurred_box(struct onedraw* r, float cx, float cy, float width, float height, float roundness, draw_color srgb_color)
+{
+    float half_width = width * .5f;
+    float half_height = height * .5f;
+
+    aabb bb = {.min = {cx - half_width - roundness, cy - half_height - roundness},
+               .max = {cx + half_width + roundness, cy + half_height + roundness}};
+
+    od_write_command(r, primitive_blurred_box, fill_solid, srgb_color, bb, cx, cy, half_width, half_height, roundness);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_char(struct onedraw* r, float x, float y, char c, draw_color srgb_color)
+{
+    font_lock lock(r);
+    od_glyph glyph;
+    uint32_t glyph_index;
+    if (!od_find_glyph(r, (uint8_t) c, &glyph, &glyph_index, true) || glyph_index == NO_FONT_SLOT)
+        return;
+
+    x += glyph.bearing_x;
+    y += glyph.bearing_y + od_font_height(r);
+    aabb bb = {.min = {x, y}, .max = {x + glyph.width, y + glyph.height}};
+    command_record record = od_write_command(r, primitive_char, fill_solid, srgb_color, bb, x, y);
+    if (record.command != nullptr)
+        record.command->extra = (uint8_t) glyph_index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// glyphs of a line of text waiting to be written as a text run
+typedef struct text_run
+{
+    float lefts[MAX_RUN_GLYPHS];
+    uint8_t glyphs[MAX_RUN_GLYPHS];
+    uint32_t count;
+    float right;
+    aabb box;
+} text_run;
+
+//----------------------------------------------------------------------------------------------------------------------------
+// writes [count] glyphs as one command, the left edges are translated by [dx], see text_run_glyph() for the draw data
+static void od_write_text_run(struct onedraw* r, const float* lefts, const uint8_t* glyphs, uint32_t count, float dx,
+                              float top, aabb box, draw_color srgb_color)
+{
+    command_record record = od_reserve_commands<MAX_RUN_DATA>(r, 1);
+    if (record.command == nullptr)
+    {
+        od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+        return;
+    }
+
+    record.command->type = primitive_text_run;
+    record.command->extra = (uint8_t) count;
+    *record.color = srgb_color;
+    record.data[0] = top;
+    for(uint32_t i=0; i<count; ++i)
+        record.data[1 + i] = lefts[i] + dx;
+    memset(&record.data[1 + count], 0, (text_run_size(count) - 1 - count) * sizeof(float));
+    memcpy(&record.data[1 + count], glyphs, count);
+    r->commands.data_buffer.RemoveMultiple(MAX_RUN_DATA - text_run_size(count));
+    od_write_record_aabb(r, &record, box);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static void od_flush_text_run(struct onedraw* r, text_run* run, float top, draw_color srgb_color)
+{
+    if (run->count == 0)
+        return;
+
+    od_write_text_run(r, run->lefts, run->glyphs, run->count, 0.f, top, run->box, srgb_color);
+    run->count = 0;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// splits a string at (x, y) in text runs : a run ends with the line, after MAX_RUN_GLYPHS glyphs or when the edges of the
+// glyphs stop increasing (needed by the binning and the rasterizer), [flush] receives each run with the top of its line
+// and must empty it. The glyphs rejected by [visible] are skipped.
+template<typename Visible, typename Flush>
+static void od_layout_text(struct onedraw* r, float x, float y, const char* text, Visible visible, Flush flush)
+{
+    const float font_height = od_font_height(r);
+    text_run run;
+    run.count = 0;
+    run.right = 0.f;
+    float left = x;
+    for(const char *c = text; *c != 0; )
+    {
+        uint32_t codepoint = utf8_next(&c);
+        od_glyph glyph;
+        uint32_t glyph_index;
+        if (codepoint == '\n')
+        {
+            flush(&run, y);
+            y += font_height;
+            x = left;
+        }
+        else if (od_find_glyph(r, codepoint, &glyph, &glyph_index, true))
+        {
+            if (glyph_index != NO_FONT_SLOT)
+            {
+                vec2 top_left = {x + glyph.bearing_x, y + (glyph.bearing_y + font_height)};
+                aabb box = {.min = top_left, .max = {top_left.x + glyph.width, top_left.y + glyph.height}};
+
+                if (run.count == MAX_RUN_GLYPHS || (run.count > 0 && (box.min.x < run.lefts[run.count - 1] || box.max.x < run.right)))
+                    flush(&run, y);
+
+                if (visible(box))
+                {
+                    run.box = (run.count == 0) ? box : aabb_merge(run.box, box);
+                    run.lefts[run.count] = box.min.x;
+                    run.glyphs[run.count++] = (uint8_t) glyph_index;
+                    run.right = box.max.x;
+                }
+            }
+            x += glyph.advance_x;
+        }
+        else
+            x += od_fallback_advance(r);
+    }
+    flush(&run, y);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static float od_measure_text(struct onedraw* r, const char* text)
+{
+    float width = 0.f;
+    for(const char *c = text; *c != 0; )
+    {
+        od_glyph glyph;
+        uint32_t glyph_index;
+        if (od_find_glyph(r, utf8_next(&c), &glyph, &glyph_index, false))
+            width += glyph.advance_x;
+        else
+            width += od_fallback_advance(r);
+    }
+    return width;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline void od_text_cache_unlink(struct onedraw* r, text_layout* layout)
+{
+    if (layout->lru_previous != nullptr)
+        layout->lru_previous->lru_next = layout->lru_next;
+    else
+        r->text_cache.lru_head = layout->lru_next;
+
+    if (layout->lru_next != nullptr)
+        layout->lru_next->lru_previous = layout->lru_previous;
+    else
+        r->text_cache.lru_tail = layout->lru_previous;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline void od_text_cache_push_front(struct onedraw* r, text_layout* layout)
+{
+    layout->lru_previous = nullptr;
+    layout->lru_next = r->text_cache.lru_head;
+    if (r->text_cache.lru_head != nullptr)
+        r->text_cache.lru_head->lru_previous = layout;
+    else
+        r->text_cache.lru_tail = layout;
+    r->text_cache.lru_head = layout;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static void od_text_cache_remove(struct onedraw* r, text_layout* layout)
+{
+    od_text_cache_unlink(r, layout);
+
+    text_layout** link = &r->text_cache.buckets[layout->hash & r->text_cache.bucket_mask];
+    while (*link != layout)
+        link = &(*link)->next;
+    *link = layout->next;
+
+    r->text_cache.size -= layout->size;
+    free(layout);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static void od_text_cache_clear(struct onedraw* r)
+{
+    while (r->text_cache.lru_tail != nullptr)
+        od_text_cache_remove(r, r->text_cache.lru_tail);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// returns the layout of [text], laid out and inserted on a miss, nullptr when the cache is disabled (context renderer)
+// or the layout is larger than a quarter of the budget
+static const text_layout* od_text_cache_find(struct onedraw* r, const char* text)
+{
+    if (r->text_cache.buckets == nullptr)
+        return nullptr;
+
+    // the cache is cleared when the font changes : the string is the key
+    size_t length = strlen(text);
+    uint64_t hash = hash_combine(0, length);
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, text + i, sizeof(uint64_t));
+        hash = hash_combine(hash, word);
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, text + i, length - i);
+    hash = hash_combine(hash, tail);
+
+    // the glyph indices of a loaded font are atlas cells, an eviction may have given one of them to another glyph
+    od_font* font = r->font.loaded;
+    const uint32_t num_evictions = (font != nullptr) ? font->num_evictions : 0;
+    text_layout** bucket = &r->text_cache.buckets[hash & r->text_cache.bucket_mask];
+    for(text_layout* layout = *bucket; layout != nullptr; layout = layout->next)
+    {
+        if (layout->hash == hash && layout->length == length && memcmp(layout->text, text, length) == 0)
+        {
+            if (layout->num_evictions != num_evictions)
+            {
+                od_text_cache_remove(r, layout);
+                break;
+            }
+
+            r->text_cache.num_hits++;
+            if (layout != r->text_cache.lru_head)
+            {
+                od_text_cache_unlink(r, layout);
+                od_text_cache_push_front(r, layout);
+            }
+
+            if (font != nullptr)
+                for(uint32_t j=0; j<layout->num_glyphs; ++j)
+                    od_font_touch(r, font, layout->glyphs[j]);
+            return layout;
+        }
+    }
+
+    r->text_cache.num_misses++;
+    auto all_glyphs = [](aabb) {return true;};
+
+    const uint32_t num_dropped = (font != nullptr) ? font->num_dropped : 0;
+    uint32_t num_runs = 0, num_glyphs = 0;
+    od_layout_text(r, 0.f, 0.f, text, all_glyphs, [&](text_run* run, float)
+    {
+        num_runs += (run->count != 0) ? 1 : 0;
+        num_glyphs += run->count;
+        run->count = 0;
+    });
+
+    // a glyph without room in the atlas is missing from the layout, the string is laid out again until it gets a cell
+    if (font != nullptr && font->num_dropped != num_dropped)
+        return nullptr;
+
+    size_t size = sizeof(text_layout) + num_runs * sizeof(text_layout_run) + num_glyphs * (sizeof(float) + sizeof(uint8_t)) + length;
+    if (size > r->text_cache.max_size / 4)
+        return nullptr;
+
+    while (r->text_cache.size + size > r->text_cache.max_size)
+        od_text_cache_remove(r, r->text_cache.lru_tail);
+
+    text_layout* layout = (text_layout*) malloc(size);
+    if (layout == nullptr)
+        return nullptr;
+
+    layout->hash = hash;
+    layout->size = size;
+    layout->length = (uint32_t) length;
+    layout->num_runs = 0;
+    layout->num_glyphs = num_glyphs;
+    layout->num_evictions = (font != nullptr) ? font->num_evictions : 0;
+    layout->width = od_measure_text(r, text);
+    layout->runs = (text_layout_run*) (layout + 1);
+    layout->lefts = (float*) (layout->runs + num_runs);
+    layout->glyphs = (uint8_t*) (layout->lefts + num_glyphs);
+    layout->text = (const char*) (layout->glyphs + num_glyphs);
+    memcpy((char*) layout->text, text, length);
+
+    uint32_t first = 0;
+    od_layout_text(r, 0.f, 0.f, text, all_glyphs, [&](text_run* run, float top)
+    {
+        if (run->count == 0)
+            return;
+
+        layout->runs[layout->num_runs++] = (text_layout_run) {.box = run->box, .top = top, .first = first, .count = run->count};
+        memcpy(&layout->lefts[first], run->lefts, run->count * sizeof(float));
+        memcpy(&layout->glyphs[first], run->glyphs, run->count);
+        first += run->count;
+        run->count = 0;
+    });
+
+    layout->next = *bucket;
+    *bucket = layout;
+    od_text_cache_push_front(r, layout);
+    r->text_cache.size += size;
+    return layout;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// the runs fully visible are copied with their left edges translated, the others go through the glyph culling
+static void od_draw_text_layout(struct onedraw* r, const text_layout* layout, float x, float y, draw_color srgb_color)
+{
+    const aabb visible = r->commands.visible;
+    for(uint32_t i=0; i<layout->num_runs; ++i)
+    {
+        const text_layout_run& cached = layout->runs[i];
+        aabb box = {.min = {cached.box.min.x + x, cached.box.min.y + y}, .max = {cached.box.max.x + x, cached.box.max.y + y}};
+        if (!od_is_visible(r, box))
+            continue;
+
+        const float top = cached.top + y;
+        if (r->list.recording || (box.min.x >= visible.min.x && box.min.y >= visible.min.y &&
+                                  box.max.x <= visible.max.x && box.max.y <= visible.max.y))
+        {
+            od_write_text_run(r, &layout->lefts[cached.first], &layout->glyphs[cached.first], cached.count, x, top, box, srgb_color);
+            continue;
+        }
+
+        text_run run;
+        run.count = 0;
+        for(uint32_t j=cached.first; j<cached.first + cached.count; ++j)
+        {
+            font_char glyph = od_glyph_extent(r, layout->glyphs[j]);
+            vec2 top_left = {layout->lefts[j] + x, top + glyph.top};
+            aabb glyph_box = {.min = top_left, .max = {top_left.x + glyph.width, top_left.y + glyph.height}};
+            if (od_is_visible(r, glyph_box))
+            {
+                run.box = (run.count == 0) ? glyph_box : aabb_merge(run.box, glyph_box);
+                run.lefts[run.count] = glyph_box.min.x;
+                run.glyphs[run.count++] = layout->glyphs[j];
+            }
+        }
+        od_flush_text_run(r, &run, top, srgb_color);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// each line is recorded as text runs of up to MAX_RUN_GLYPHS glyphs, the glyphs outside of the viewport or of the clip
+// shape are skipped
+void od_draw_text(struct onedraw* r, float x, float y, const char* text, draw_color srgb_color)
+{
+    font_lock lock(r);
+    const text_layout* layout = od_text_cache_find(r, text);
+    if (layout != nullptr)
+    {
+        od_draw_text_layout(r, layout, x, y, srgb_color);
+        return;
+    }
+
+    od_layout_text(r, x, y, text, [r](aabb box) {return od_is_visible(r, box);},
+                   [r, srgb_color](text_run* run, float top) {od_flush_text_run(r, run, top, srgb_color);});
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_quad(struct onedraw* r, float x0, float y0, float x1, float y1, od_quad_uv uv, uint32_t slice_index, draw_color srgb_color)
+{
+    assert_msg(slice_index < r->rasterizer.num_slices, "slice index out of bound");
+
+    if (fabsf(x0 - x1) < HALF_PIXEL || fabsf(y0 - y1) < HALF_PIXEL)
+        return;
+
+    aabb bb = {.min = {x0, y0}, .max = {x1, y1}};
+    command_record record = od_write_command(r, primitive_quad, fill_solid, srgb_color, bb, x0, y0, x1, y1, uv.u0, uv.v0, uv.u1, uv.v1);
+    if (record.command != nullptr)
+        record.command->extra = (uint8_t) slice_index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_draw_oriented_quad(struct onedraw* r, float cx, float cy, float width, float height, float angle, od_quad_uv uv, uint32_t slice_index, draw_color srgb_color)
+{
+    assert_msg(slice_index < r->rasterizer.num_slices, "slice index out of bound");
+
+    if (width < HALF_PIXEL || height < HALF_PIXEL)
+        return;
+
+    vec2 center = {cx, cy};
+    vec2 axis = vec2_direction(angle);
+    vec2 dir = vec2_scale(axis, width*.5f);
+    vec2 p0 = vec2_sub(center, dir);
+    vec2 p1 = vec2_add(center, dir);
+
+    aabb bb = aabb_from_rounded_obb(p0, p1, height, 0.f);
+    command_record record = od_write_command(r, primitive_oriented_quad, fill_solid, srgb_color, bb, cx, cy, 1.f/width, 1.f/height,
+                                             axis.x, axis.y, uv.u0, uv.v0, uv.u1, uv.v1);
+    if (record.command != nullptr)
+        record.command->extra = (uint8_t) slice_index;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// curves flattening (Raph Levien, "Flattening quadratic Béziers")
+//      * a quadratic curve is a piece of the parabola y = x², the number of segments within a distance tolerance is
+//        proportional to the integral of the square root of the curvature, approximated in closed form
+//      * the segments are evenly spaced along that integral so they all have about the same error, they are emitted in
+//        one pass from the segment count
+//      * a cubic curve is first approximated by quadratic curves (the error only depends on its third derivative), they
+//        share the segments of the whole curve
+// ---------------------------------------------------------------------------------------------------------------------------
+
+typedef struct flatten_params
+{
+    float a0, a2;               // integral at the ends of the parabola piece
+    float u0, u_scale;
+    float val;                  // segments for a unit tolerance, 0 when the curve is a straight line
+} flatten_params;
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline float approx_parabola_integral(float x)
+{
+    const float d = .67f;
+    return x / (1.f - d + sqrtf(sqrtf(d * d * d * d + .25f * x * x)));
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline float approx_parabola_inv_integral(float x)
+{
+    const float b = .39f;
+    return x * (1.f - b + sqrtf(b * b + .25f * x * x));
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline vec2 quadratic_bezier_point(const quadratic_bezier& c, float t)
+{
+    return vec2_lerp(vec2_lerp(c.c0, c.c1, t), vec2_lerp(c.c1, c.c2, t), t);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+static inline vec2 cubic_bezier_point(const cubic_bezier& c, float t)
+{
+    vec2 c01 = vec2_lerp(c.c0, c.c1, t);
+    vec2 c12 = vec2_lerp(c.c1, c.c2, t);
+    vec2 c23 = vec2_lerp(c.c2, c.c3, t);
+    return vec2_lerp(vec2_lerp(c01, c12, t), vec2_lerp(c12, c23, t), t);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// maps the curve on the parabola y = x² : x0, x2 are the ends of the piece and scale the ratio between the two
+static flatten_params quadratic_flatten_params(const quadratic_bezier& c, float sqrt_tolerance)
+{
+    vec2 d01 = vec2_sub(c.c1, c.c0);
+    vec2 d12 = vec2_sub(c.c2, c.c1);
+    vec2 dd = vec2_sub(d01, d12);
+    vec2 chord = vec2_sub(c.c2, c.c0);
+    float cross = chord.x * dd.y - chord.y * dd.x;
+    float x0 = vec2_dot(d01, dd) / cross;
+    float x2 = vec2_dot(d12, dd) / cross;
+    float scale = fabsf(cross / (vec2_length(dd) * (x2 - x0)));
+
+    flatten_params params = {};
+    if (!isfinite(scale) || !isfinite(x0) || !isfinite(x2))
+        return params;
+
+    params.a0 = approx_parabola_integral(x0);
+    params.a2 = approx_parabola_integral(x2);
+    float da = fabsf(params.a2 - params.a0);
+    float sqrt_scale = sqrtf(scale);
+
+    if ((x0 < 0.f) == (x2 < 0.f))
+        params.val = da * sqrt_scale;
+    else
+    {
+        // the piece contains the vertex of the parabola, its curvature is bound by the tolerance
+        params.val = sqrt_tolerance * da / approx_parabola_integral(sqrt_tolerance / sqrt_scale);
+    }
+
+    params.u0 = approx_parabola_inv_integral(params.a0);
+    params.u_scale = 1.f / (approx_parabola_inv_integral(params.a2) - params.u0);
+    return params;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// parameter of the curve at [u] in [0; 1] of the integral
+static inline float quadratic_flatten_t(const flatten_params& params, float u)
+{
+    float a = params.a0 + (params.a2 - params.a0) * u;
+    return (approx_parabola_inv_integral(a) - params.u0) * params.u_scale;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// quadratic curves approximating [c] within [tolerance], returns their count (at least one)
+static uint32_t cubic_to_quadratics(const cubic_bezier& c, float tolerance, quadratic_bezier (&output)[MAX_CURVE_QUADRATICS])
+{
+    // the error of the quadratic approximation is proportional to the third derivative, constant on the curve,
+    // and decreases with the cube of the number of pieces
+    vec2 p1x2 = vec2_sub(vec2_scale(c.c1, 3.f), c.c0);
+    vec2 p2x2 = vec2_sub(vec2_scale(c.c2, 3.f), c.c3);
+    float error = vec2_sq_length(vec2_sub(p2x2, p1x2));
+    float pieces = ceilf(powf(error / (432.f * tolerance * tolerance), 1.f / 6.f));
+    uint32_t count = (pieces > 1.f) ? (uint32_t) min(pieces, float(MAX_CURVE_QUADRATICS)) : 1U;
+
+    const float step = 1.f / float(count);
+    vec2 start = c.c0;
+    vec2 start_derivative = vec2_scale(vec2_sub(c.c1, c.c0), 3.f);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        // control points of the piece of cubic from the derivatives at its ends, then the quadratic that matches
+        // its midpoint : (3 * (p1 + p2) - p0 - p3) / 4
+        float t = float(i + 1) * step;
+        vec2 end = (i + 1 == count) ? c.c3 : cubic_bezier_point(c, t);
+        float s = 1.f - t;
+        vec2 end_derivative = vec2_add(vec2_add(vec2_scale(vec2_sub(c.c1, c.c0), 3.f * s * s),
+                                                vec2_scale(vec2_sub(c.c2, c.c1), 6.f * s * t)),
+                                       vec2_scale(vec2_sub(c.c3, c.c2), 3.f * t * t));
+        vec2 control = vec2_add(vec2_scale(vec2_add(start, end), .5f), vec2_scale(vec2_sub(start_derivative, end_derivative), step * .25f));
+        output[i] = (quadratic_bezier) {.c0 = start, .c1 = control, .c2 = end};
+        start = end;
+        start_derivative = end_derivative;
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+// draws the quadratic curves as capsules, the segments are distributed on the curves by their share of the integral
+static uint32_t od_draw_flattened(struct onedraw* r, const quadratic_bezier* quadratics, uint32_t count, float tolerance,
+                                  float radius, draw_color srgb_color)
+{
+    assert(count >= 1 && count <= MAX_CURVE_QUADRATICS);
+    const float sqrt_tolerance = sqrtf(tolerance);
+    flatten_params params[MAX_CURVE_QUADRATICS];
+    float total = 0.f;
+    for(uint32_t i=0; i<count; ++i)
+    {
+        params[i] = quadratic_flatten_params(quadratics[i], sqrt_tolerance);
+        total += params[i].val;
+    }
+
+    const uint32_t num_segments = (uint32_t) max(ceilf(.5f * total / sqrt_tolerance), 1.f);
+    const float step = total / float(num_segments);
+    vec2 previous = quadratics[0].c0;
+    uint32_t segment = 1;
+    float integral = 0.f;
+    for(uint32_t i=0; i<count; ++i)
+    {
+        for(float target = float(segment) * step; segment < num_segments && target < integral + params[i].val; target = float(segment) * step)
+        {
+            vec2 point = quadratic_bezier_point(quadratics[i], quadratic_flatten_t(params[i], (target - integral) / params[i].val));
+            od_draw_capsule(r, previous.x, previous.y, point.x, point.y, radius, srgb_color);
+            previous = point;
+            segment++;
+        }
+        integral += params[i].val;
+    }
+
+    vec2 end = quadratics[count - 1].c2;
+    od_draw_capsule(r, previous.x, previous.y, end.x, end.y, radius, srgb_color);
+    return segment;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+uint32_t od_draw_quadratic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color)
+{
+    quadratic_bezier c =
+    {
+        .c0 = {control_points[0], control_points[1]},
+        .c1 = {control_points[2], control_points[3]},
+        .c2 = {control_points[4], control_points[5]},
+    };
+
+    // the curve is inside the hull of its control points
+    const float radius = width * .5f;
+    aabb hull = aabb_from_triangle(c.c0, c.c1, c.c2);
+    aabb_grow(&hull, vec2_splat(radius + draw_cmd_aabb_bump(r)));
+    if (!od_is_visible(r, hull))
+        return 0;
+
+    return od_draw_flattened(r, &c, 1, CURVE_TOLERANCE, radius, srgb_color);
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+uint32_t od_draw_cubic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color)
+{
+    cubic_bezier c =
+    {
+        .c0 = {control_points[0], control_points[1]},
+        .c1 = {control_points[2], control_points[3]},
+        .c2 = {control_points[4], control_points[5]},
+        .c3 = {control_points[6], control_points[7]}
+    };
+
+    const float radius = width * .5f;
+    aabb hull = {.min = vec2_min4(c.c0, c.c1, c.c2, c.c3), .max = vec2_max4(c.c0, c.c1, c.c2, c.c3)};
+    aabb_grow(&hull, vec2_splat(radius + draw_cmd_aabb_bump(r)));
+    if (!od_is_visible(r, hull))
+        return 0;
+
+    // a tenth of the tolerance for the quadratic approximation, the rest for the segments
+    quadratic_bezier quadratics[MAX_CURVE_QUADRATICS];
+    uint32_t count = cubic_to_quadratics(c, CURVE_TOLERANCE * .1f, quadratics);
+    return od_draw_flattened(r, quadratics, count, CURVE_TOLERANCE * .9f, radius, srgb_color);
 }
 
+// ---------------------------------------------------------------------------------------------------------------------------
+// batched draw functions
+//      * all streams are reserved once for the whole batch with the command writer, commands that don't fit are dropped
+//      * bounding boxes are computed SIMD_WIDTH commands at a time
+//      * while a list is recorded they fall back to the single draw functions, that keep the unquantized boxes
+// ---------------------------------------------------------------------------------------------------------------------------
+
+typedef struct command_batch
+{
+    draw_command* commands;
+    draw_color* colors;
+    uint32_t* aabbs;
+    float* data;
+    uint32_t count;
+    uint32_t first_data;
+    uint32_t num_data;          // floats written, the draw data of a command can be packed
+} command_batch;
+
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_ellipse(struct onedraw* r, float ax, float ay, float bx, float by, float width, draw_color srgb_color)
+// reserves [count] commands of DataSize floats each, returns a batch with the number of commands that fit
+template<uint32_t DataSize>
+static command_batch od_reserve_batch(struct onedraw* r, uint32_t count)
 {
-    private_draw_ellipse(r, vec2_set(ax, ay), vec2_set(bx, by), width, 0.f, fill_solid, srgb_color);
+    od_grow_commands(r, count, count * DataSize);
+    size_t free_commands = r->commands.buffer.GetMaxElements() - r->commands.buffer.GetNumElements();
+    size_t free_data = r->commands.data_buffer.GetMaxElements() - r->commands.data_buffer.GetNumElements();
+
+    uint32_t fit = (uint32_t) min(min((size_t)count, free_commands), free_data / DataSize);
+    if (fit < count)
+        od_log(r, "out of draw commands/draw data buffer, %u commands dropped", count - fit);
+
+    const uint32_t first_data = (uint32_t)r->commands.data_buffer.GetNumElements();
+    command_record record = od_reserve_commands<DataSize>(r, fit);
+    return (command_batch) {.commands = record.command, .colors = record.color, .aabbs = record.aabb, .data = record.data, .count = fit,
+                            .first_data = first_data, .num_data = 0};
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_ellipse_ring(struct onedraw* r, float ax, float ay, float bx, float by, float width, float thickness, draw_color srgb_color)
+// writes the draw data of a command right after the previous one, the type and fill mode must be set
+template<typename... Args>
+static inline void od_write_batch_data(struct onedraw* r, command_batch* batch, uint32_t index, Args... data)
 {
-    private_draw_ellipse(r, vec2_set(ax, ay), vec2_set(bx, by), width, thickness, fill_hollow, srgb_color);
+    float* output = &batch->data[batch->num_data];
+    batch->commands[index].data_index = batch->first_data + batch->num_data;
+    write_float(output, data...);
+    batch->num_data += od_pack_draw_data(r, &batch->commands[index], output, sizeof...(Args));
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void private_draw_triangle(struct onedraw* r, const vec2* v, float roundness, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+// releases the commands of a batch that were not written (degenerated or not visible shapes) and the unused draw data
+template<uint32_t DataSize>
+static void od_trim_batch(struct onedraw* r, const command_batch* batch, uint32_t num_written)
 {
-    // exclude invalid triangle
-    if (vec2_similar(v[0], v[1], HALF_PIXEL) || vec2_similar(v[2], v[1], HALF_PIXEL) || 
-        vec2_similar(v[0], v[2], HALF_PIXEL)) return;
-
-    thickness *= .5f;
+    uint32_t num_unused = batch->count - num_written;
+    r->commands.buffer.RemoveMultiple(num_unused);
+    r->commands.colors.RemoveMultiple(num_unused);
+    r->commands.aabb_buffer.RemoveMultiple(num_unused * aabb_words(r));
+    r->commands.data_buffer.RemoveMultiple(batch->count * DataSize - batch->num_data);
+}
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+//----------------------------------------------------------------------------------------------------------------------------
+// quantizes the SIMD_WIDTH boxes starting at [index], same result as write_quantized_aabb()
+static inline void write_quantized_aabbs(const struct onedraw* r, uint32_t* boxes, uint32_t index,
+                                         cpu::vfloat min_x, cpu::vfloat min_y, cpu::vfloat max_x, cpu::vfloat max_y)
+{
+    const aabb& visible = r->commands.visible;
+    const cpu::vfloat scale(1.f / TILE_SIZE), limit((float)UINT16_MAX);
+    float quantized[4][SIMD_WIDTH];
+    cpu::vstore(quantized[0], cpu::min(cpu::max(min_x, cpu::vfloat(visible.min.x)) * scale, limit));
+    cpu::vstore(quantized[1], cpu::min(cpu::max(min_y, cpu::vfloat(visible.min.y)) * scale, limit));
+    cpu::vstore(quantized[2], cpu::min(cpu::min(max_x, cpu::vfloat(visible.max.x)) * scale, limit));
+    cpu::vstore(quantized[3], cpu::min(cpu::min(max_y, cpu::vfloat(visible.max.y)) * scale, limit));
+
+    for(uint32_t i=0; i<SIMD_WIDTH; ++i)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fillmode;
-        cmd->type = primitive_triangle;
-        *color = srgb_color;
-
-        float* data = r->commands.data_buffer.NewMultiple(7);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            float roundness_thickness = (fillmode != fill_hollow) ? roundness : thickness;
-            aabb bb = aabb_from_triangle(v[0], v[1], v[2]);
-            aabb_grow(&bb, vec2_splat(roundness_thickness + draw_cmd_aabb_bump(r)));
-            write_float(data, v[0].x, v[0].y, v[1].x, v[1].y, v[2].x, v[2].y, roundness_thickness);
-            write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+        quantized_aabb box = invalid_quantized_aabb();
+        if (quantized[0][i] <= quantized[2][i] && quantized[1][i] <= quantized[3][i])
+            box = (quantized_aabb) {.min_x = (uint16_t)quantized[0][i], .min_y = (uint16_t)quantized[1][i],
+                                    .max_x = (uint16_t)quantized[2][i], .max_y = (uint16_t)quantized[3][i]};
+        store_quantized_aabb(boxes, index + i, box, r->commands.wide_aabb);
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_triangle(struct onedraw* r, const float* vertices, float roundness, draw_color srgb_color)
+static void od_merge_batch_aabb(struct onedraw* r, const command_batch* batch, uint32_t count)
 {
-    private_draw_triangle(r, (const vec2*) vertices, roundness, 0.f, fill_solid, srgb_color);
+    if (r->commands.group_aabb != nullptr)
+        for(uint32_t i=0; i<count; ++i)
+            merge_quantized_aabb(&r->commands.group_box, load_quantized_aabb(batch->aabbs, i, r->commands.wide_aabb));
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_triangle_ring(struct onedraw* r, const float* vertices, float roundness, float thickness, draw_color srgb_color)
+// moves the box of a batch's command when the batch is compacted
+static inline void od_move_batch_aabb(struct onedraw* r, const command_batch* batch, uint32_t to, uint32_t from)
 {
-    private_draw_triangle(r, (const vec2*) vertices, roundness, thickness, fill_hollow, srgb_color);
+    const bool wide = r->commands.wide_aabb;
+    store_quantized_aabb(batch->aabbs, to, load_quantized_aabb(batch->aabbs, from, wide), wide);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void private_draw_pie(struct onedraw* r, vec2 center, vec2 direction, float radius, float aperture, float thickness, enum primitive_fillmode fillmode, draw_color srgb_color)
+void od_draw_discs(struct onedraw* r, const float* cx, const float* cy, const float* radius, const draw_color* colors, uint32_t count)
 {
-    if (aperture <= FLT_EPSILON)
+    if (r->list.recording)
+    {
+        for(uint32_t i=0; i<count; ++i)
+            od_draw_disc(r, cx[i], cy[i], radius[i], colors[i]);
         return;
-    
-    aperture = float_clamp(aperture, 0.f, VEC2_PI);
-    thickness = float_max(thickness * .5f, 0.f);
+    }
+
+    const uint32_t data_size = 3;
+    command_batch batch = od_reserve_batch<data_size>(r, count);
+    const float bump = draw_cmd_aabb_bump(r);
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    uint32_t i = 0;
+    for(; i + SIMD_WIDTH <= batch.count; i += SIMD_WIDTH)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fillmode;
-        cmd->type = primitive_pie;
-        *color = srgb_color;
+        cpu::vfloat x = cpu::vload(&cx[i]), y = cpu::vload(&cy[i]);
+        cpu::vfloat max_radius = cpu::vload(&radius[i]) + bump;
+        write_quantized_aabbs(r, batch.aabbs, i, x - max_radius, y - max_radius, x + max_radius, y + max_radius);
+    }
+    for(; i < batch.count; ++i)
+    {
+        float max_radius = radius[i] + bump;
+        write_quantized_aabb(r, batch.aabbs, i, cx[i] - max_radius, cy[i] - max_radius, cx[i] + max_radius, cy[i] + max_radius);
+    }
 
-        float* data = r->commands.data_buffer.NewMultiple((fillmode != fill_hollow) ? 7 : 8);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            aabb bb = aabb_from_circle(center, radius);
-            aabb_grow(&bb, vec2_splat(thickness + draw_cmd_aabb_bump(r)));
-
-            if (fillmode != fill_hollow)
-                write_float(data, center.x, center.y, radius, direction.x, direction.y, sinf(aperture), cosf(aperture));
-            else
-                write_float(data, center.x, center.y, radius, direction.x, direction.y, sinf(aperture), cosf(aperture), thickness);
-                
-            write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+    // discs outside of the visible area are skipped, the batch is compacted
+    uint32_t num_written = 0;
+    for(i=0; i<batch.count; ++i)
+    {
+        if (!od_is_visible(r, aabb_from_circle(vec2_set(cx[i], cy[i]), radius[i] + bump)))
+            continue;
+
+        batch.commands[num_written].fillmode = fill_solid;
+        batch.commands[num_written].type = primitive_disc;
+        batch.colors[num_written] = colors[i];
+        od_move_batch_aabb(r, &batch, num_written, i);
+        od_write_batch_data(r, &batch, num_written, cx[i], cy[i], radius[i]);
+        num_written++;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+    od_trim_batch<data_size>(r, &batch, num_written);
+    od_merge_batch_aabb(r, &batch, num_written);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_sector(struct onedraw* r, float cx, float cy, float radius, float start_angle, float sweep_angle, draw_color srgb_color)
+void od_draw_boxes(struct onedraw* r, const float* x0, const float* y0, const float* x1, const float* y1, const float* radius,
+                   const draw_color* colors, uint32_t count)
 {
-    vec2 center = {cx, cy};
-    float aperture = sweep_angle * .5f;
-    vec2 direction = vec2_direction(start_angle + aperture);
-    private_draw_pie(r, center, direction, radius, fabs(aperture), 0.f, fill_solid, srgb_color);
-}
+    if (r->list.recording)
+    {
+        for(uint32_t i=0; i<count; ++i)
+            od_draw_box(r, x0[i], y0[i], x1[i], y1[i], (radius != nullptr) ? radius[i] : 0.f, colors[i]);
+        return;
+    }
 
-//----------------------------------------------------------------------------------------------------------------------------
-void od_draw_sector_ring(struct onedraw* r, float cx, float cy, float radius, float start_angle, float sweep_angle, float thickness, draw_color srgb_color)
-{
-    vec2 center = {cx, cy};
-    float aperture = sweep_angle * .5f;
-    vec2 direction = vec2_direction(start_angle + aperture);
-    private_draw_pie(r, center, direction, radius, fabs(aperture), thickness, fill_hollow, srgb_color);
+    const uint32_t data_size = 5;
+    command_batch batch = od_reserve_batch<data_size>(r, count);
+    const float bump = draw_cmd_aabb_bump(r);
+
+    uint32_t i = 0;
+    for(; i + SIMD_WIDTH <= batch.count; i += SIMD_WIDTH)
+    {
+        cpu::vfloat ax = cpu::vload(&x0[i]), ay = cpu::vload(&y0[i]);
+        cpu::vfloat bx = cpu::vload(&x1[i]), by = cpu::vload(&y1[i]);
+        write_quantized_aabbs(r, batch.aabbs, i, cpu::min(ax, bx) - bump, cpu::min(ay, by) - bump,
+                              cpu::max(ax, bx) + bump, cpu::max(ay, by) + bump);
+    }
+    for(; i < batch.count; ++i)
+        write_quantized_aabb(r, batch.aabbs, i, min(x0[i], x1[i]) - bump, min(y0[i], y1[i]) - bump,
+                             max(x0[i], x1[i]) + bump, max(y0[i], y1[i]) + bump);
+
+    // boxes outside of the visible area are skipped, the batch is compacted
+    uint32_t num_written = 0;
+    for(i=0; i<batch.count; ++i)
+    {
+        aabb box = {.min = {min(x0[i], x1[i]) - bump, min(y0[i], y1[i]) - bump}, .max = {max(x0[i], x1[i]) + bump, max(y0[i], y1[i]) + bump}};
+        if (!od_is_visible(r, box))
+            continue;
+
+        batch.commands[num_written].fillmode = fill_solid;
+        batch.commands[num_written].type = primitive_aabox;
+        batch.colors[num_written] = colors[i];
+        od_move_batch_aabb(r, &batch, num_written, i);
+        od_write_batch_data(r, &batch, num_written, (x0[i] + x1[i]) * .5f, (y0[i] + y1[i]) * .5f, fabsf(x1[i] - x0[i]) * .5f,
+                            fabsf(y1[i] - y0[i]) * .5f, (radius != nullptr) ? radius[i] : 0.f);
+        num_written++;
+    }
+    od_trim_batch<data_size>(r, &batch, num_written);
+    od_merge_batch_aabb(r, &batch, num_written);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_arc(struct onedraw* r, float cx, float cy, float dx, float dy, float aperture, float radius, float thickness, draw_color srgb_color)
+void od_draw_capsules(struct onedraw* r, const float* ax, const float* ay, const float* bx, const float* by, const float* radius,
+                      const draw_color* colors, uint32_t count)
 {
-    vec2 center = {cx, cy};
-    vec2 direction = {dx, dy};
-
-    aperture = float_clamp(aperture, 0.f, VEC2_PI);
-    thickness = float_max(thickness, 0.f);
-
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    if (r->list.recording)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fill_solid;
-        cmd->type = primitive_arc;
+        for(uint32_t i=0; i<count; ++i)
+            od_draw_capsule(r, ax[i], ay[i], bx[i], by[i], radius[i], colors[i]);
+        return;
+    }
 
-        *color = srgb_color;
+    const uint32_t data_size = 6;
+    command_batch batch = od_reserve_batch<data_size>(r, count);
+    const float bump = draw_cmd_aabb_bump(r);
 
-        float* data = r->commands.data_buffer.NewMultiple(8);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            aabb bb = aabb_from_circle(center, radius);
-            aabb_grow(&bb, vec2_splat(thickness + draw_cmd_aabb_bump(r)));
+    // the box around the segment grown by the radius is exact for a capsule
+    uint32_t i = 0;
+    for(; i + SIMD_WIDTH <= batch.count; i += SIMD_WIDTH)
+    {
+        cpu::vfloat p0x = cpu::vload(&ax[i]), p0y = cpu::vload(&ay[i]);
+        cpu::vfloat p1x = cpu::vload(&bx[i]), p1y = cpu::vload(&by[i]);
+        cpu::vfloat border = cpu::vload(&radius[i]) + bump;
+        write_quantized_aabbs(r, batch.aabbs, i, cpu::min(p0x, p1x) - border, cpu::min(p0y, p1y) - border,
+                              cpu::max(p0x, p1x) + border, cpu::max(p0y, p1y) + border);
+    }
+    for(; i < batch.count; ++i)
+    {
+        float border = radius[i] + bump;
+        write_quantized_aabb(r, batch.aabbs, i, min(ax[i], bx[i]) - border, min(ay[i], by[i]) - border,
+                             max(ax[i], bx[i]) + border, max(ay[i], by[i]) + border);
+    }
 
-            write_float(data, center.x, center.y, radius, direction.x, direction.y, sinf(aperture), cosf(aperture), thickness);
-            write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+    // degenerated and not visible capsules are skipped like od_draw_capsule() does, the batch is compacted
+    uint32_t num_written = 0;
+    for(i=0; i<batch.count; ++i)
+    {
+        if (vec2_similar(vec2_set(ax[i], ay[i]), vec2_set(bx[i], by[i]), HALF_PIXEL))
+            continue;
+
+        float border = radius[i] + bump;
+        aabb box = {.min = {min(ax[i], bx[i]) - border, min(ay[i], by[i]) - border}, .max = {max(ax[i], bx[i]) + border, max(ay[i], by[i]) + border}};
+        if (!od_is_visible(r, box))
+            continue;
+
+        batch.commands[num_written].fillmode = fill_solid;
+        batch.commands[num_written].type = primitive_oriented_box;
+        batch.colors[num_written] = colors[i];
+        od_move_batch_aabb(r, &batch, num_written, i);
+        od_write_batch_data(r, &batch, num_written, ax[i], ay[i], bx[i], by[i], 0.f, radius[i]);
+        num_written++;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+    od_trim_batch<data_size>(r, &batch, num_written);
+    od_merge_batch_aabb(r, &batch, num_written);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_box(struct onedraw* r, float x0, float y0, float x1, float y1, float radius, draw_color srgb_color)
+void od_draw_quads(struct onedraw* r, const float* x0, const float* y0, const float* x1, const float* y1, const od_quad_uv* uvs,
+                   uint32_t slice_index, const draw_color* colors, uint32_t count)
 {
-    if (x0>x1) swap(x0, x1);
-    if (y0>y1) swap(y0, y1);
-
-    aabb box = {.min = {x0, y0}, .max = {x1, y1}};
+    assert_msg(slice_index < r->rasterizer.num_slices, "slice index out of bound");
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    if (r->list.recording)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fill_solid;
-        cmd->type = primitive_aabox;
+        for(uint32_t i=0; i<count; ++i)
+            od_draw_quad(r, x0[i], y0[i], x1[i], y1[i], uvs[i], slice_index, colors[i]);
+        return;
+    }
 
-        *color = srgb_color;
+    const uint32_t data_size = 8;
+    command_batch batch = od_reserve_batch<data_size>(r, count);
 
-        float* data = r->commands.data_buffer.NewMultiple(5);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            vec2 center = vec2_scale(vec2_add(box.min, box.max), .5f);
-            vec2 half_extents = vec2_scale(vec2_sub(box.max, box.min), .5f);
-            aabb_grow(&box, vec2_splat(draw_cmd_aabb_bump(r)));
-            write_float(data, center.x, center.y, half_extents.x, half_extents.y, radius);
-            write_quantized_aabb(aabox, box.min.x, box.min.y, box.max.x, box.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+    uint32_t i = 0;
+    for(; i + SIMD_WIDTH <= batch.count; i += SIMD_WIDTH)
+        write_quantized_aabbs(r, batch.aabbs, i, cpu::vload(&x0[i]), cpu::vload(&y0[i]), cpu::vload(&x1[i]), cpu::vload(&y1[i]));
+    for(; i < batch.count; ++i)
+        write_quantized_aabb(r, batch.aabbs, i, x0[i], y0[i], x1[i], y1[i]);
+
+    // degenerated and not visible quads are skipped like od_draw_quad() does, the batch is compacted
+    uint32_t num_written = 0;
+    for(i=0; i<batch.count; ++i)
+    {
+        if (fabsf(x0[i] - x1[i]) < HALF_PIXEL || fabsf(y0[i] - y1[i]) < HALF_PIXEL)
+            continue;
+
+        if (!od_is_visible(r, (aabb) {.min = {min(x0[i], x1[i]), min(y0[i], y1[i])}, .max = {max(x0[i], x1[i]), max(y0[i], y1[i])}}))
+            continue;
+
+        batch.commands[num_written].fillmode = fill_solid;
+        batch.commands[num_written].type = primitive_quad;
+        batch.commands[num_written].extra = (uint8_t) slice_index;
+        batch.colors[num_written] = colors[i];
+        od_move_batch_aabb(r, &batch, num_written, i);
+        od_write_batch_data(r, &batch, num_written, x0[i], y0[i], x1[i], y1[i], uvs[i].u0, uvs[i].v0, uvs[i].u1, uvs[i].v1);
+        num_written++;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+    od_trim_batch<data_size>(r, &batch, num_written);
+    od_merge_batch_aabb(r, &batch, num_written);
 }
 
-//----------------------------------------------------------------------------------------------------------------------------
-void od_draw_blurred_box(struct onedraw* r, float cx, float cy, float width, float height, float roundness, draw_color srgb_color)
-{
-    float half_width = width * .5f;
-    float half_height = height * .5f;
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
-    {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->type = primitive_blurred_box;
-        cmd->fillmode = fill_solid;
+// ---------------------------------------------------------------------------------------------------------------------------
+// retained lists
+//      * recording goes through the draw functions in the frame buffers, od_list_end() moves the commands in the list
+//      * the bounding boxes are kept unquantized so the list can be translated by any amount, they are quantized at submit
+//      * positions are always the first floats of the draw data, a per-float weight tells which ones are x or y
+// ---------------------------------------------------------------------------------------------------------------------------
 
-        *color = srgb_color;
+struct od_list
+{
+    draw_command* commands;
+    draw_color* colors;
+    float* boxes[4];            // min_x, min_y, max_x, max_y of each command
+    float* data;
+    float* offset_x;            // 1.f for the x coordinates of the draw data, 0.f otherwise
+    float* offset_y;
+    uint32_t num_commands;
+    uint32_t num_data;
+    od_font* font;                              // loaded font whose glyphs are pinned until the list is freed
+    uint32_t font_slots[MAX_FONT_SLOTS / 32];
+};
 
-        float* data = r->commands.data_buffer.NewMultiple(5);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            write_float(data, cx, cy, half_width, half_height, roundness);
-            write_quantized_aabb(aabox, cx - half_width - roundness, cy - half_height - roundness,
-                                 cx + half_width + roundness, cy + half_height + roundness);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+//----------------------------------------------------------------------------------------------------------------------------
+// number of points at the beginning of the draw data of a command
+static inline uint32_t od_command_num_points(uint8_t type)
+{
+    switch(type)
+    {
+    case primitive_oriented_box :
+    case primitive_ellipse :
+    case primitive_quad : return 2;
+    case primitive_triangle : return 3;
+    case primitive_text_run :                   // top of the line and left edges, see od_list_end()
+    case begin_group :
+    case end_group : return 0;
+    default : return 1;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_char(struct onedraw* r, float x, float y, char c, draw_color srgb_color)
+void od_list_begin(struct onedraw* r)
 {
-    if (c < r->font.desc.first_glyph || c > (r->font.desc.first_glyph + r->font.desc.num_glyphs))
-        return;
+    assert_msg(!r->list.recording, "od_list_begin called twice without od_list_end");
+    assert_msg(r->commands.group_aabb == nullptr, "a list cannot be recorded inside a group");
+    assert_msg(r->commands.buffer.GetData() != nullptr, "a list is recorded between od_begin_frame and od_end_frame");
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
-    {
-        uint32_t glyph_index = c - r->font.desc.first_glyph;
+    if (r->list.boxes == nullptr)
+        r->list.boxes = (aabb*) malloc(sizeof(aabb) * r->limits.max_commands);
+
+    r->list.first_command = (uint32_t)r->commands.buffer.GetNumElements();
+    r->list.first_data = (uint32_t)r->commands.data_buffer.GetNumElements();
+    memset(r->list.font_slots, 0, sizeof(r->list.font_slots));
+    r->list.recording = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+struct od_list* od_list_end(struct onedraw* r)
+{
+    assert_msg(r->list.recording, "od_list_end called without od_list_begin");
+    assert_msg(r->commands.group_aabb == nullptr, "you need to call od_end_group, before od_list_end");
+    r->list.recording = false;
 
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fill_solid;
-        cmd->type = primitive_char;
-        cmd->extra = (uint8_t) glyph_index;
+    uint32_t num_commands = (uint32_t)r->commands.buffer.GetNumElements() - r->list.first_command;
+    uint32_t num_data = (uint32_t)r->commands.data_buffer.GetNumElements() - r->list.first_data;
+    if (num_commands == 0)
+        return nullptr;
 
-        *color = srgb_color;
+    size_t total_size = sizeof(od_list) + (sizeof(draw_command) + sizeof(draw_color) + sizeof(float) * 4) * num_commands +
+                        sizeof(float) * num_data * 3;
 
-        const od_glyph& glyph = r->font.desc.glyphs[glyph_index];
-        x += glyph.bearing_x;
-        y += glyph.bearing_y + r->font.desc.font_height;
-        float glyph_width = float(glyph.x1 - glyph.x0);
-        float glyph_height = float(glyph.y1 - glyph.y0);
+    od_list* list = (od_list*) malloc(total_size);
+    if (list == nullptr)
+        return nullptr;
 
-        float* data = r->commands.data_buffer.NewMultiple(2);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
+    list->num_commands = num_commands;
+    list->num_data = num_data;
+    list->commands = (draw_command*) (list + 1);
+    list->colors = (draw_color*) (list->commands + num_commands);
+    list->boxes[0] = (float*) (list->colors + num_commands);
+    for(uint32_t i=1; i<4; ++i)
+        list->boxes[i] = list->boxes[i-1] + num_commands;
+    list->data = list->boxes[3] + num_commands;
+    list->offset_x = list->data + num_data;
+    list->offset_y = list->offset_x + num_data;
+
+    memcpy(list->commands, r->commands.buffer.GetData() + r->list.first_command, sizeof(draw_command) * num_commands);
+    memcpy(list->colors, r->commands.colors.GetData() + r->list.first_command, sizeof(draw_color) * num_commands);
+    memcpy(list->data, r->commands.data_buffer.GetData() + r->list.first_data, sizeof(float) * num_data);
+    memset(list->offset_x, 0, sizeof(float) * num_data * 2);
+
+    for(uint32_t i=0; i<num_commands; ++i)
+    {
+        const aabb& box = r->list.boxes[i];
+        list->boxes[0][i] = box.min.x;
+        list->boxes[1][i] = box.min.y;
+        list->boxes[2][i] = box.max.x;
+        list->boxes[3][i] = box.max.y;
+
+        // data indices become relative to the list
+        draw_command* command = &list->commands[i];
+        command->data_index -= r->list.first_data;
+        if (command->type == primitive_text_run)
         {
-            write_float(data, x, y);
-            write_quantized_aabb(aabox, x, y, x + glyph_width, y + glyph_height);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
+            list->offset_y[command->data_index] = 1.f;
+            for(uint32_t j=0; j<command->extra; ++j)
+                list->offset_x[command->data_index + 1 + j] = 1.f;
+        }
+        for(uint32_t j=0; j<od_command_num_points(command->type); ++j)
+        {
+            list->offset_x[command->data_index + j*2] = 1.f;
+            list->offset_y[command->data_index + j*2 + 1] = 1.f;
         }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
-}
 
-//----------------------------------------------------------------------------------------------------------------------------
-void od_draw_text(struct onedraw* r, float x, float y, const char* text, draw_color srgb_color)
-{
-    float left = x;
-    for(const char *c = text; *c != 0; c++)
+    // the glyphs of the loaded font drawn in the list can't leave the atlas while the list exists
+    list->font = nullptr;
+    memcpy(list->font_slots, r->list.font_slots, sizeof(list->font_slots));
+    if (r->font.loaded != nullptr)
     {
-        if (*c == '\n')
-        {
-            y += r->font.desc.font_height;
-            x = left;
-        }
-        else if (*c >= r->font.desc.first_glyph && *c <= (r->font.desc.first_glyph + r->font.desc.num_glyphs))
+        font_lock lock(r);
+        for(uint32_t i=0; i<MAX_FONT_SLOTS; ++i)
         {
-            od_draw_char(r, x, y, *c, srgb_color);
-            uint32_t glyph_index = *c - r->font.desc.first_glyph;
-            x += r->font.desc.glyphs[glyph_index].advance_x;
+            if (list->font_slots[i / 32] & (1u << (i % 32)))
+            {
+                r->font.loaded->slot_pins[i]++;
+                list->font = r->font.loaded;
+            }
         }
-        else
-            x += r->font.desc.glyphs['_'- r->font.desc.first_glyph].advance_x * .65f;
+        if (list->font != nullptr)
+            list->font->num_lists++;
     }
+
+    // the recorded commands are not part of the frame
+    r->commands.buffer.RemoveMultiple(num_commands);
+    r->commands.colors.RemoveMultiple(num_commands);
+    r->commands.aabb_buffer.RemoveMultiple(num_commands * aabb_words(r));
+    r->commands.data_buffer.RemoveMultiple(num_data);
+    return list;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_quad(struct onedraw* r, float x0, float y0, float x1, float y1, od_quad_uv uv, uint32_t slice_index, draw_color srgb_color)
+void od_list_submit(struct onedraw* r, const struct od_list* list, float dx, float dy)
 {
-    assert_msg(slice_index < r->rasterizer.atlas->arrayLength(), "slice index out of bound");
+    assert_msg(!r->list.recording, "a list cannot be submitted while recording a list");
+    assert_msg(r->commands.group_aabb == nullptr, "a list cannot be submitted inside a group");
 
-    if (fabsf(x0 - x1) < HALF_PIXEL || fabsf(y0 - y1) < HALF_PIXEL)
+    if (list == nullptr)
         return;
 
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    if (!od_grow_commands(r, list->num_commands, list->num_data))
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fill_solid;
-        cmd->type = primitive_quad;
-        cmd->extra = (uint8_t) slice_index;
+        od_log(r, "out of draw commands/draw data buffer, list of %u commands dropped", list->num_commands);
+        return;
+    }
 
-        *color = srgb_color;
+    const uint32_t data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
+    const uint8_t clip_index = LAST_CLIP_INDEX;
+    draw_command* commands = r->commands.buffer.Push(list->num_commands);
+    draw_color* colors = r->commands.colors.Push(list->num_commands);
+    uint32_t* aabbs = r->commands.aabb_buffer.Push(list->num_commands * aabb_words(r));
+    float* data = r->commands.data_buffer.Push(list->num_data);
 
-        float* data = r->commands.data_buffer.NewMultiple(8);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            write_float(data, x0, y0, x1, y1, uv.u0, uv.v0, uv.u1, uv.v1);
-            write_quantized_aabb(aabox, x0, y0, x1, y1);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
+    memcpy(colors, list->colors, sizeof(draw_color) * list->num_commands);
+    for(uint32_t i=0; i<list->num_commands; ++i)
+    {
+        commands[i] = list->commands[i];
+        commands[i].data_index += data_index;
+        commands[i].clip_index = clip_index;
     }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+
+    // translate the positions, the other floats (and colors stored as floats) are copied bit for bit
+    const cpu::vfloat offset_x(dx), offset_y(dy), zero(0.f);
+    uint32_t i = 0;
+    for(; i + SIMD_WIDTH <= list->num_data; i += SIMD_WIDTH)
+    {
+        cpu::vfloat weight_x = cpu::vload(&list->offset_x[i]), weight_y = cpu::vload(&list->offset_y[i]);
+        cpu::vfloat value = cpu::vload(&list->data[i]);
+        cpu::vstore(&data[i], cpu::select(weight_x + weight_y > zero, value + weight_x * offset_x + weight_y * offset_y, value));
+    }
+    for(; i < list->num_data; ++i)
+        data[i] = (list->offset_x[i] + list->offset_y[i] > 0.f) ? list->data[i] + list->offset_x[i] * dx + list->offset_y[i] * dy
+                                                                : list->data[i];
+
+    i = 0;
+    for(; i + SIMD_WIDTH <= list->num_commands; i += SIMD_WIDTH)
+        write_quantized_aabbs(r, aabbs, i, cpu::vload(&list->boxes[0][i]) + offset_x, cpu::vload(&list->boxes[1][i]) + offset_y,
+                              cpu::vload(&list->boxes[2][i]) + offset_x, cpu::vload(&list->boxes[3][i]) + offset_y);
+    for(; i < list->num_commands; ++i)
+        write_quantized_aabb(r, aabbs, i, list->boxes[0][i] + dx, list->boxes[1][i] + dy, list->boxes[2][i] + dx, list->boxes[3][i] + dy);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-void od_draw_oriented_quad(struct onedraw* r, float cx, float cy, float width, float height, float angle, od_quad_uv uv, uint32_t slice_index, draw_color srgb_color)
+uint32_t od_list_num_commands(const struct od_list* list)
 {
-    assert_msg(slice_index < r->rasterizer.atlas->arrayLength(), "slice index out of bound");
+    return (list != nullptr) ? list->num_commands : 0;
+}
 
-    if (width < HALF_PIXEL || height < HALF_PIXEL)
+//----------------------------------------------------------------------------------------------------------------------------
+void od_list_free(struct od_list* list)
+{
+    if (list == nullptr)
         return;
 
-    vec2 center = {cx, cy};
-    vec2 axis = vec2_direction(angle);
-    vec2 dir = vec2_scale(axis, width*.5f);
-    vec2 p0 = vec2_sub(center, dir);
-    vec2 p1 = vec2_add(center, dir);
-
-    draw_command* cmd = r->commands.buffer.NewElement();
-    draw_color* color = r->commands.colors.NewElement();
-    if (cmd != nullptr && color != nullptr)
+    od_font* font = list->font;
+    bool free_font = false;
+    if (font != nullptr)
     {
-        cmd->clip_index = LAST_CLIP_INDEX;
-        cmd->data_index = (uint32_t)r->commands.data_buffer.GetNumElements();
-        cmd->fillmode = fill_solid;
-        cmd->type = primitive_oriented_quad;
-        cmd->extra = (uint8_t) slice_index;
+        std::lock_guard<std::mutex> lock(font->mutex);
+        for(uint32_t i=0; i<MAX_FONT_SLOTS; ++i)
+            if (list->font_slots[i / 32] & (1u << (i % 32)))
+                font->slot_pins[i]--;
+
+        // the font was replaced or the renderer terminated while the list was alive
+        font->num_lists--;
+        free_font = (font->owner == nullptr && font->num_lists == 0);
+    }
 
-        *color = srgb_color;
+    if (free_font)
+        od_free_font(font);
+    free(list);
+}
 
-        float* data = r->commands.data_buffer.NewMultiple(10);
-        quantized_aabb* aabox = r->commands.aabb_buffer.NewElement();
-        if (data != nullptr && aabox != nullptr)
-        {
-            write_float(data, cx, cy, 1.f/width, 1.f/height, axis.x, axis.y, uv.u0, uv.v0, uv.u1, uv.v1);
-            aabb bb = aabb_from_rounded_obb(p0, p1, height, 0.f);
-            write_quantized_aabb(aabox, bb.min.x, bb.min.y, bb.max.x, bb.max.y);
-            merge_quantized_aabb(r->commands.group_aabb, aabox);
-            return;
-        }
-        r->commands.buffer.RemoveLast();
-        r->commands.colors.RemoveLast();
-    }
-    od_log(r, "out of draw commands/draw data buffer, expect graphical artefacts");
+//----------------------------------------------------------------------------------------------------------------------------
+float od_text_height(struct onedraw* r)
+{
+    return od_font_height(r);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
-// Breaks the bezier quadratic curve into multiple capsules, using De Casteljau’s algorithm and colinear detection
-uint32_t od_draw_quadratic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color)
+float od_text_width(struct onedraw* r, const char* text)
 {
-    quadratic_bezier stack[TESSELATION_STACK_MAX];
-    uint32_t stack_index = 0;
+    font_lock lock(r);
+    const text_layout* layout = od_text_cache_find(r, text);
+    return (layout != nullptr) ? layout->width : od_measure_text(r, text);
+}
 
-    const float radius = width * .5f;
-    uint32_t num_capsules = 0;
+//----------------------------------------------------------------------------------------------------------------------------
+bool od_load_font(struct onedraw* r, const void* ttf_data, size_t ttf_size, float font_height)
+{
+    assert_msg(r->contexts.parent == nullptr, "od_load_font cannot be called on a context renderer");
+    assert_msg(r->commands.group_aabb == nullptr && !r->list.recording, "od_load_font cannot be called during a group or a list");
 
-    stack[stack_index++] = 
-    {
-        .c0 = {control_points[0], control_points[1]},
-        .c1 = {control_points[2], control_points[3]},
-        .c2 = {control_points[4], control_points[5]},
-    };
+    assert_msg(font_height == 0.f || (font_height >= MIN_FONT_HEIGHT && font_height <= MAX_FONT_HEIGHT), "font_height must be in [4; 200]");
 
-    while (stack_index != 0)
+    od_font* font = nullptr;
+    if (ttf_data != nullptr)
     {
-        quadratic_bezier c = stack[--stack_index];
+        assert_msg(font_height != 0.f, "font_height must be in [4; 200]");
 
-        // splits proportionally to segment lengths
-        float d0 = vec2_distance(c.c0, c.c1);
-        float d1 = vec2_distance(c.c1, c.c2);
-        float split = d0 / (d0 + d1);
-
-        vec2 left = vec2_lerp( c.c0, c.c1, split);
-        vec2 right = vec2_lerp(c.c1, c.c2, split);
-        vec2 middle = vec2_lerp(left, right, split);
-        
-        if (is_colinear(c.c0, c.c2, middle, COLINEAR_THRESHOLD))
+        const unsigned char* data = (const unsigned char*) ttf_data;
+        int offset = (ttf_size >= 12) ? stbtt_GetFontOffsetForIndex(data, 0) : -1;
+        void* memory = malloc(sizeof(od_font));
+        if (offset < 0 || memory == nullptr)
         {
-            od_draw_capsule(r, c.c0.x, c.c0.y, c.c2.x, c.c2.y, radius, srgb_color);
-            num_capsules++;
+            od_log(r, "can't read the font");
+            free(memory);
+            return false;
         }
-        else
+
+        font = new(memory) od_font;
+        font->glyphs = nullptr;
+        font->bitmap = nullptr;
+        if (!stbtt_InitFont(&font->info, data, offset))
         {
-            if (stack_index + 2 <= TESSELATION_STACK_MAX)
-            {
-                stack[stack_index++] =
-                {
-                    .c0 = c.c0,
-                    .c1 = left,
-                    .c2 = middle,
-                };
+            od_log(r, "can't read the font");
+            od_free_font(font);
+            return false;
+        }
 
-                stack[stack_index++] =
-                {
-                    .c0 = middle,
-                    .c1 = right,
-                    .c2 = c.c2,
-                };
-            }
-            else
-                return UINT32_MAX;
+        int ascent, descent, line_gap;
+        stbtt_GetFontVMetrics(&font->info, &ascent, &descent, &line_gap);
+        font->owner = r;
+        font->scale = stbtt_ScaleForPixelHeight(&font->info, font_height);
+        font->msdf_scale = stbtt_ScaleForPixelHeight(&font->info, FONT_MSDF_HEIGHT);
+        font->font_height = font_height;
+        font->baseline = float(ascent) * font->scale;
+        font->cell_size = uint32_t(FONT_MSDF_HEIGHT) + FONT_MSDF_PADDING * 2 + 2;
+        font->atlas_size = font->cell_size * FONT_ATLAS_CELLS;
+        font->num_glyphs = 0;
+        font->num_slots = 0;
+        font->frame = r->stats.frame_index;
+        font->num_evictions = 0;
+        font->num_dropped = 0;
+        font->full_frame = UINT32_MAX;
+        font->num_lists = 0;
+        font->glyphs_mask = MAX_FONT_SLOTS - 1;
+        font->glyphs = (font_glyph*) malloc(MAX_FONT_SLOTS * sizeof(font_glyph));
+        font->bitmap = (uint8_t*) malloc(font->cell_size * font->cell_size * FONT_PLANES);
+        memset(font->table, 0, sizeof(font->table));
+        memset(font->slot_pins, 0, sizeof(font->slot_pins));
+        if (font->glyphs == nullptr || font->bitmap == nullptr)
+        {
+            od_log(r, "can't allocate memory for the font");
+            od_free_font(font);
+            return false;
         }
-    }
-    return num_capsules;
-}
 
-//----------------------------------------------------------------------------------------------------------------------------
-uint32_t od_draw_cubic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color)
-{
-    cubic_bezier stack[TESSELATION_STACK_MAX];
-    uint32_t stack_index = 0;
+        for(uint32_t i=0; i<MAX_FONT_SLOTS; ++i)
+            font->glyphs[i].codepoint = UINT32_MAX;
 
-    const float radius = width * .5f;
-    uint32_t num_capsules = 0;
+        int underscore = stbtt_FindGlyphIndex(&font->info, '_');
+        int advance = 0, left_side_bearing;
+        if (underscore != 0)
+            stbtt_GetGlyphHMetrics(&font->info, underscore, &advance, &left_side_bearing);
+        font->fallback_advance = (underscore != 0) ? float(advance) * font->scale * .65f : font_height * .3f;
+    }
 
-    stack[stack_index++] = 
-    {
-        .c0 = {control_points[0], control_points[1]},
-        .c1 = {control_points[2], control_points[3]},
-        .c2 = {control_points[4], control_points[5]},
-        .c3 = {control_points[6], control_points[7]}
-    };
+    // the layouts and the tiles kept by the incremental mode use the glyphs of the previous font
+    od_text_cache_clear(r);
+    od_release_font(r->font.loaded);
+    r->font.loaded = font;
+    r->cpu.full_redraw = true;
+    od_set_builtin_font(r, (font == nullptr) ? font_height : 0.f);
 
-    while (stack_index != 0)
+#ifdef ONEDRAW_METAL
+    if (r->device != nullptr)
     {
-        cubic_bezier c = stack[--stack_index];
-
-        // the halfway point along the control polygon roughly corresponds to halfway along the curve arc length
-        float d0 = vec2_distance(c.c0, c.c1);
-        float d1 = vec2_distance(c.c1, c.c2);
-        float d2 = vec2_distance(c.c2, c.c3);
-        float total = d0 + d1 + d2;
-        float split = (d0 + 0.5f * d1) / total;
-
-        vec2 c01 = vec2_lerp(c.c0, c.c1, split);
-        vec2 c12 = vec2_lerp(c.c1, c.c2, split);
-        vec2 c23 = vec2_lerp(c.c2, c.c3, split);
-        vec2 c01c12 = vec2_lerp(c01, c12, split);
-        vec2 c12c23 = vec2_lerp(c12, c23, split);
-        vec2 middle = vec2_lerp(c01c12, c12c23, split);
-
-        if (is_colinear(c.c0, c.c3, middle, COLINEAR_THRESHOLD))
-        {
-            od_draw_capsule(r, c.c0.x, c.c0.y, c.c2.x, c.c2.y, radius, srgb_color);
-            num_capsules++;
-        }
+        if (font != nullptr)
+            od_metal_build_font_atlas(r, font->atlas_size);
         else
         {
-            if (stack_index + 2 <= TESSELATION_STACK_MAX)
-            {
-                stack[stack_index++] =
-                {
-                    .c0 = c.c0,
-                    .c1 = c01,
-                    .c2 = c01c12,
-                    .c3 = middle
-                };
-
-                stack[stack_index++] =
-                {
-                    .c0 = middle,
-                    .c1 = c12c23,
-                    .c2 = c23,
-                    .c3 = c.c3,
-                };
-            }
-            else
-                return UINT32_MAX;
+            SAFE_RELEASE(r->font.texture);
+            SAFE_RELEASE(r->font.glyphs);
+            od_build_font(r);
         }
     }
-
-    return num_capsules;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-float od_text_height(struct onedraw* r)
-{
-    return r->font.desc.font_height;
-}
-
-//----------------------------------------------------------------------------------------------------------------------------
-float od_text_width(struct onedraw* r, const char* text)
-{
-    float width = 0.f;
-    for(const char *c = text; *c != 0; c++)
+    else
+#endif
     {
-        if (*c >= r->font.desc.first_glyph && *c <= (r->font.desc.first_glyph + r->font.desc.num_glyphs))
-            width += r->font.desc.glyphs[*c - r->font.desc.first_glyph].advance_x;
+        if (font != nullptr)
+            od_cpu_build_font_atlas(r, font->atlas_size);
         else
-            width += r->font.desc.glyphs['_'- r->font.desc.first_glyph].advance_x * .65f;
+            od_cpu_build_font(r);
     }
-    return width;
+    return true;
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
@@ -1878,9 +5090,22 @@ void od_set_clear_color(struct onedraw* r, draw_color srgb_color)
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------------
+// keeps the visible area of the new clip shape for the record time rejection
+static inline void od_set_visible(struct onedraw* r, aabb clip_bounds)
+{
+    r->commands.visible = (aabb)
+    {
+        .min = vec2_max(clip_bounds.min, vec2_splat(0.f)),
+        .max = vec2_min(clip_bounds.max, vec2_set((float)r->rasterizer.width, (float)r->rasterizer.height))
+    };
+}
+
 //----------------------------------------------------------------------------------------------------------------------------
 void od_set_cliprect(struct onedraw* r, float min_x, float min_y, float max_x, float max_y)
 {
+    assert_msg(!r->list.recording, "clip shapes cannot be changed while recording a list");
+
     // avoid redundant clip rect
     if (r->commands.clipshapes_buffer.GetNumElements()>0)
     {
@@ -1891,21 +5116,24 @@ void od_set_cliprect(struct onedraw* r, float min_x, float min_y, float max_x, f
             return;
     }
 
-    if (r->commands.clipshapes_buffer.GetNumElements() < MAX_CLIPS)
+    if (r->commands.clipshapes_buffer.GetNumElements() < r->limits.max_clips)
     {
         *r->commands.clipshapes_buffer.NewElement() = (clip_shape) 
         {
             .rect = {.min_x = min_x, .min_y = min_y, .max_x = max_x, .max_y = max_y},
             .type = clip_rect
         };
+        od_set_visible(r, (aabb) {.min = {min_x, min_y}, .max = {max_x, max_y}});
     }
     else
-        od_log(r, "too many clip shapes! maximum is %d", MAX_CLIPS);
+        od_log(r, "too many clip shapes! maximum is %u", r->limits.max_clips);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
 void od_set_clipdisc(struct onedraw* r, float cx, float cy, float radius)
 {
+    assert_msg(!r->list.recording, "clip shapes cannot be changed while recording a list");
+
     if (r->commands.clipshapes_buffer.GetNumElements()>0)
     {
         clip_shape* clip = r->commands.clipshapes_buffer.LastElement();
@@ -1915,16 +5143,17 @@ void od_set_clipdisc(struct onedraw* r, float cx, float cy, float radius)
             return;
     }
 
-    if (r->commands.clipshapes_buffer.GetNumElements() < MAX_CLIPS)
+    if (r->commands.clipshapes_buffer.GetNumElements() < r->limits.max_clips)
     {
         *r->commands.clipshapes_buffer.NewElement() = (clip_shape) 
         {
             .disc = {.center_x = cx, .center_y = cy, .squared_radius = radius * radius},
             .type = clip_disc
         };
+        od_set_visible(r, aabb_from_circle(vec2_set(cx, cy), radius));
     }
     else
-        od_log(r, "too many clip shapes! maximum is %d", MAX_CLIPS);
+        od_log(r, "too many clip shapes! maximum is %u", r->limits.max_clips);
 }
 
 //----------------------------------------------------------------------------------------------------------------------------
@@ -1933,3 +5162,51 @@ void od_set_culling_debug(struct onedraw* r, bool b)
     r->tiles.culling_debug = b;
 }
 
+//----------------------------------------------------------------------------------------------------------------------------
+void od_force_full_redraw(struct onedraw* r)
+{
+    r->cpu.full_redraw = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_set_occlusion_culling(struct onedraw* r, bool enable)
+{
+    r->rasterizer.occlusion_culling = enable;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+void od_get_tile_dimensions(struct onedraw* r, uint32_t* width, uint32_t* height)
+{
+    *width = r->tiles.num_width;
+    *height = r->tiles.num_height;
+}
+
+//----------------------------------------------------------------------------------------------------------------------------
+bool od_get_tile_heatmap(struct onedraw* r, float* list_lengths, float* costs)
+{
+    const uint32_t num_tiles = r->tiles.count;
+    if (list_lengths != nullptr)
+        memset(list_lengths, 0, num_tiles * sizeof(float));
+    if (costs != nullptr)
+        memset(costs, 0, num_tiles * sizeof(float));
+
+    // the tiles linked lists are only visible from the cpu with the cpu backend
+    if (r->device != nullptr)
+        return false;
+
+    // head is not cleared when there is nothing to bin
+    if (r->commands.count == 0)
+        return true;
+
+    // the tile lists hold the last binning pass, the previous ones were summed by od_cpu_render()
+    if (r->cpu.num_heatmap_passes != 0)
+    {
+        if (list_lengths != nullptr)
+            memcpy(list_lengths, r->cpu.heatmap, num_tiles * sizeof(float));
+        if (costs != nullptr)
+            memcpy(costs, r->cpu.heatmap + num_tiles, num_tiles * sizeof(float));
+    }
+    od_cpu_add_tile_lists(r, list_lengths, costs);
+    return true;
+}
+
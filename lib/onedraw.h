@@ -40,6 +40,8 @@
 //----------------------------------------------------------------------------------------------------------------------------
 
 struct onedraw;
+struct od_list;
+struct od_context;
 
 typedef struct od_quad_uv
 {
@@ -54,11 +56,33 @@ typedef struct od_stats
     uint32_t peak_num_draw_cmd;
     size_t gpu_memory_usage;
     float gpu_time_ms;
+
+    // last frame
+    float recording_time_ms;        // cpu time between od_begin_frame() and od_end_frame()
+    uint32_t num_nodes;             // number of tile nodes written by the binning
+    uint32_t num_tiles;             // number of tiles with at least one command
+    uint32_t num_overflow_nodes;    // nodes dropped because the binning ran out of nodes, shapes are missing if not zero
+    uint32_t max_tile_nodes;        // length of the longest tile list
+    uint32_t num_binning_passes;    // more than one when the frame has more commands than a pass can bin (65535)
+    uint32_t num_occluded_commands; // commands removed because opaque boxes or quads drawn after them hide them
+    uint32_t num_text_cache_hits;   // od_draw_text() and od_text_width() calls served by the text layout cache
+    uint32_t num_text_cache_misses; // strings laid out because they were not in the cache (or too large for it)
+
+    // last frame, cpu backend only (zero with metal)
+    float binning_time_ms;          // predicate, scan, region and tile binning
+    float raster_time_ms;           // clear and tiles rasterization
+    uint32_t num_changed_tiles;     // tiles rasterized, all of them unless onedraw_def.cpu.incremental is set
+
+    // od_begin_frame() to the end of od_end_frame(), over the last onedraw_def.stats.window frames
+    float frame_time_p50_ms;
+    float frame_time_p95_ms;
+    float frame_time_p99_ms;
 } od_stats;
 
 typedef struct od_glyph
 {
     uint16_t x0, y0, x1, y1;
+    float width, height;
     float bearing_x, bearing_y;
     float advance_x;
 } od_glyph;
@@ -72,6 +96,8 @@ typedef struct onedraw_def
     void (*log_func)(const char* string);
     bool allow_screenshot;
     bool srgb_backbuffer;
+    bool packed_draw_data;
+    bool wide_aabb;
 
     struct
     {
@@ -79,6 +105,30 @@ typedef struct onedraw_def
         uint32_t num_slices;        // Max 256
     } atlas;
 
+    struct
+    {
+        uint32_t num_threads;       // 0 means one thread per core
+        bool incremental;           // only rasterizes the tiles that changed since the previous frame
+    } cpu;
+
+    struct
+    {
+        uint32_t window;            // number of frames for the frame time percentiles, 0 means 60, max 1024
+    } stats;
+
+    struct
+    {
+        uint32_t size;              // bytes of text layouts kept between frames, 0 means 256KB
+    } text_cache;
+
+    struct
+    {
+        uint32_t max_commands;      // 0 means 65536, grows up to 1M
+        uint32_t max_draw_data;     // number of floats, 0 means 4 per command, grows up to 10M
+        uint32_t max_nodes;         // tile binning nodes, 0 means 4M, grows up to 64M
+        uint32_t max_clips;         // 0 means 256 (also the maximum)
+    } limits;
+
 } onedraw_def;
 
 typedef uint32_t draw_color; // color is expected to be B8G8R8A8 and in sRGB color space
@@ -101,14 +151,40 @@ size_t od_min_memory_size(void);
 // Initializes the library
 //      [preallocated_buffer]   user-allocated memory of od_min_memory_size() bytes, must be aligned on sizeof(uintptr_t)
 //      [metal_device]          pointer to (MTL::Device*) device or obj-C equivalent
+//                              if NULL, the headless cpu backend is used (always the case when not compiled on Apple)
 //      [viewport_width]
 //      [viewport_height]
 //      [log_func]              pointer to the log function, can be NULL if no log required
 //      [allow_screenshot]      if true buffers are allocated for screenshot
+//      [packed_draw_data]      stores the draw data of a command on 16 bits per value when they fit : positions and sizes
+//                              in [0; 8192[ with 1/8 pixel precision, unorm uvs, snorm directions and half floats
+//                              the other commands (negative or larger coordinates, lists) keep 32 bits floats
+//      [wide_aabb]             stores the bounding boxes with 16 bits tile coordinates (8 bytes per command instead of 4),
+//                              needed for viewports larger than 4096 pixels (8K, video walls)
 //      [texture_array]
 //          [width]             width of all textures in the array, if 0 (undefined) the array won't be created
 //          [height]            
 //          [num_slices]        must be <= 256. each quad can use a specific slice. 
+//      [cpu]
+//          [num_threads]       number of threads used by the cpu backend, 0 means one thread per core
+//          [incremental]       hashes the command list of each tile and only rasterizes the tiles that changed, the others
+//                              keep the pixels of the previous frame : od_end_frame() must receive the same buffer every
+//                              frame (a different buffer redraws everything), see od_force_full_redraw()
+//      [stats]
+//          [window]            number of frames used for the frame time percentiles of od_stats, 0 means 60
+//      [text_cache]
+//          [size]              memory budget of the text layout cache, the strings drawn or measured are laid out once
+//                              and the least recently used layouts are evicted, 0 means 256KB
+//      [limits]                initial capacities of the frame, the memory used scales with them (0 keeps the default)
+//                              the buffers double when a frame needs more and keep their size for the next frames
+//          [max_commands]      draw commands per frame (begin/end group included), the binning buffers take
+//                              min(max_commands, 65535) * 5 bytes per 256x256 pixels region : larger frames are binned
+//                              in several passes (see od_stats.num_binning_passes)
+//          [max_draw_data]     floats of draw data per frame
+//          [max_nodes]         command/tile pairs of the tile binning, 8 bytes each (32MB by default), the cpu backend
+//                              grows them and bins the frame again, metal grows them for the next frame and drops shapes
+//                              of the current one (see od_stats.num_overflow_nodes)
+//          [max_clips]         clip shapes per frame, does not grow
 struct onedraw* od_init(onedraw_def* def);
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -149,6 +225,7 @@ void od_begin_frame(struct onedraw* r);
 //-----------------------------------------------------------------------------------------------------------------------------
 // Ends the collect of draw commands, renders everything
 //      [drawable]              pointer to CA::MetalDrawable* from obj-C
+//                              cpu backend : pointer to a B8G8R8A8 srgb buffer of (width*height*4) bytes
 void od_end_frame(struct onedraw* r, void* drawable);
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -164,6 +241,38 @@ void od_terminate(struct onedraw* r);
 //      [stats]     non-NULL pointer to the structure
 void od_get_stats(struct onedraw* r, od_stats* stats);
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Starts a capture : od_end_frame() appends every frame (command buffers, viewport and clear state) to [filename]
+// until od_capture_end() is called. The texture array content is not captured, nor the atlas of a font loaded with
+// od_load_font() : the frames drawn with a truetype font are skipped (and logged), the built-in font is captured at any
+// height. Returns false if the file can't be created
+bool od_capture_begin(struct onedraw* r, const char* filename);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Ends the capture and closes the file
+void od_capture_end(struct onedraw* r);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Iterates over the frames of a capture file loaded or mapped in memory
+//      [capture]               content of the file, must be aligned on sizeof(uintptr_t) (mmap() result is fine)
+//      [size]                  size of the file in bytes
+//      [frame]                 NULL to get the first frame, otherwise the previous frame returned
+// Returns NULL at the end of the capture, at the first truncated or corrupted frame, or if the file is not a capture of
+// this version of the library
+const void* od_capture_next_frame(const void* capture, size_t size, const void* frame);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Returns the viewport dimensions of a captured frame
+void od_capture_frame_dimensions(const void* frame, uint32_t* width, uint32_t* height);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Renders a captured frame without going through the draw functions, the renderer is resized if needed
+//      [frame]                 returned by od_capture_next_frame(), must stay valid during the call
+//      [drawable]              same as od_end_frame()
+// The cpu backend bins and rasterizes the capture in place (no copy), the metal backend copies it in its buffers
+// The font of the renderer is replaced by the built-in font at the height of the frame if needed
+void od_replay_frame(struct onedraw* r, const void* frame, void* drawable);
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Sets the clear color
 void od_set_clear_color(struct onedraw* r, draw_color srgb_color);
@@ -183,6 +292,29 @@ void od_set_clipdisc(struct onedraw* r, float cx, float cy, float radius);
 // Outputs a blue color as the background of each tile. Mainly use to debug binning.
 void od_set_culling_debug(struct onedraw* r, bool b);
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Incremental cpu rendering : the next frame rasterizes every tile, call it when the output buffer was modified outside
+// of the library. The texture array uploads and od_resize() do it automatically.
+void od_force_full_redraw(struct onedraw* r);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Enables (default) or disables the occlusion culling : opaque boxes without radius and opaque quads (color and texture
+// slice) drawn outside of groups hide the commands drawn before them, they are removed before the binning
+void od_set_occlusion_culling(struct onedraw* r, bool enable);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Gets the number of tiles (16x16 pixels) in the viewport, the size of the heatmap
+void od_get_tile_dimensions(struct onedraw* r, uint32_t* width, uint32_t* height);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Fills per-tile profiling data of the last frame, call after od_end_frame(). cpu backend only : to profile a metal frame
+// capture it and replay it headless. The frames binned in several passes give the sum of the passes.
+//      [list_lengths]          tiles_width*tiles_height floats, number of commands in the list of the tile (can be NULL)
+//      [costs]                 tiles_width*tiles_height floats, estimated cost of the tile (can be NULL) : sum of the
+//                              commands weight, a disc is 1, an ellipse or a blurred box is ~8
+// Returns false if the data is not available
+bool od_get_tile_heatmap(struct onedraw* r, float* list_lengths, float* costs);
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Begins a group
 //      [smoothblend]       if true, [smooth_value] will be used for smoothmin
@@ -203,6 +335,20 @@ float od_text_height(struct onedraw* r);
 // Returns the width of the string [text] in pixels
 float od_text_width(struct onedraw* r, const char* text);
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Replaces the font of the text functions with a truetype/opentype font, call it outside of a frame
+// the glyphs are rasterized on first use in an atlas of 256 cells, the least recently used are evicted when it is full
+// (the glyphs of the retained lists stay until the lists are freed), a frame can show up to 256 different glyphs
+// the glyphs are multi-channel distance fields of the same resolution whatever the height, the atlas is about 1MB
+// the strings are decoded as UTF-8, with both fonts
+//      [ttf_data]              font file in memory, read until the next od_load_font() or od_terminate()
+//                              NULL restores the built-in font
+//      [ttf_size]              size of the file in bytes
+//      [font_height]           in pixels, from the highest ascender to the lowest descender, in [4; 200]
+//                              can be 0 with the built-in font, for its default height (32 pixels)
+// returns false if the font can't be read, the current font is kept
+bool od_load_font(struct onedraw* r, const void* ttf_data, size_t ttf_size, float font_height);
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // Draws a ring (circle)
 //      [cx, cy]        center of the disc
@@ -324,6 +470,8 @@ void od_draw_char(struct onedraw* r, float x, float y, char c, draw_color srgb_c
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // Draws a zero-terminated string, carriage return (\n) are taken in account
+// each line is one command per 255 glyphs (a text run), the glyphs outside of the viewport or of the clip are skipped
+// the layout of the string is kept in the text cache and reused by the next calls with the same string
 //      [x, y]                  top-left coordinates of the string
 //      [text]                  string to be rendered
 void od_draw_text(struct onedraw* r, float x, float y, const char* text, draw_color srgb_color);
@@ -345,17 +493,98 @@ void od_draw_quad(struct onedraw* r, float x0, float y0, float x1, float y1, od_
 void od_draw_oriented_quad(struct onedraw* r, float cx, float cy, float width, float height, float angle, od_quad_uv uv, uint32_t slice_index, draw_color srgb_color);
 
 //-----------------------------------------------------------------------------------------------------------------------------
-// Draws a quadratic bezier curve using adaptative tesselation
+// Draws a quadratic bezier curve with capsules, the number of capsules is computed from the curvature so the curve is
+// within a quarter of pixel of them
 //      [control_points]        an array of 6 floats that represent the control points coordinates (x, y)
 //      [width]
-// Returns the number of capsules used or UINT32_MAX if the tesselation failed somehow
+// Returns the number of capsules used, 0 if the curve is not visible
 uint32_t od_draw_quadratic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color);
 
 
 //-----------------------------------------------------------------------------------------------------------------------------
-// Draws a cubic bezier curve using adaptative tesselation
+// Draws a cubic bezier curve with capsules, see od_draw_quadratic_bezier()
+//      [control_points]        an array of 8 floats
 uint32_t od_draw_cubic_bezier(struct onedraw* r, const float* control_points, float width, draw_color srgb_color);
 
+//-----------------------------------------------------------------------------------------------------------------------------
+// Batched versions of the draw functions for large amount of shapes (scatter plots, particles, sprites)
+// Arrays are structure of arrays of [count] elements, the command buffers are reserved once for the whole batch. Commands
+// that don't fit are dropped (and logged).
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Draws [count] discs, see od_draw_disc()
+void od_draw_discs(struct onedraw* r, const float* cx, const float* cy, const float* radius, const draw_color* srgb_colors, uint32_t count);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Draws [count] boxes, see od_draw_box()
+//      [radius]                can be NULL for sharp corners
+void od_draw_boxes(struct onedraw* r, const float* x0, const float* y0, const float* x1, const float* y1, const float* radius,
+                   const draw_color* srgb_colors, uint32_t count);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Draws [count] capsules, see od_draw_capsule()
+void od_draw_capsules(struct onedraw* r, const float* ax, const float* ay, const float* bx, const float* by, const float* radius,
+                      const draw_color* srgb_colors, uint32_t count);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Draws [count] textured quads from the same slice, see od_draw_quad()
+void od_draw_quads(struct onedraw* r, const float* x0, const float* y0, const float* x1, const float* y1, const od_quad_uv* uvs,
+                   uint32_t slice_index, const draw_color* srgb_colors, uint32_t count);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Retained command lists for static content (UI panels, labels, map layers) that is redrawn every frame
+// A list is recorded once with the regular draw functions, then submitted each frame with a copy of its command buffers
+// and a translation, without going through the draw functions again.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Starts recording a list, the draw calls until od_list_end() go in the list instead of the frame
+// Must be called between od_begin_frame() and od_end_frame(), outside of a group. The clip shapes can't be changed while
+// recording, a list is drawn with the clip shape active when it is submitted.
+void od_list_begin(struct onedraw* r);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Ends the recording
+// Returns the list (to be released with od_list_free()) or NULL if nothing was recorded
+struct od_list* od_list_end(struct onedraw* r);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Draws a list translated by [dx, dy] pixels, outside of a group
+// The list is dropped entirely (and logged) if it does not fit in the command buffers
+void od_list_submit(struct onedraw* r, const struct od_list* list, float dx, float dy);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Returns the number of commands of a list
+uint32_t od_list_num_commands(const struct od_list* list);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Frees a list, the glyphs of the loaded font it draws can leave the atlas again
+void od_list_free(struct od_list* list);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Recording contexts, to record draw calls from several threads
+// Each context records in its own command buffers with the regular draw functions, od_end_frame() appends the contexts
+// ended during the frame after the commands recorded directly on the renderer, in increasing [order_key].
+// A context is used by one thread at a time, the draw functions of different contexts can run concurrently.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Creates a context for the renderer, it allocates its own command buffers (about 2MB)
+struct od_context* od_context_create(struct onedraw* r);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Starts recording a context for the current frame
+//      [order_key]             contexts are drawn in increasing order, use different keys for a deterministic order
+// Returns the renderer to pass to the draw functions, it starts with the full viewport clip rect. Functions of the frame
+// (od_begin_frame, od_end_frame, od_resize, ...) can't be called on it.
+struct onedraw* od_context_begin(struct od_context* context, uint32_t order_key);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Ends the recording, the context will be merged by the next od_end_frame() of the renderer
+// Must be called before od_end_frame() and the context can't be used again before it returns
+void od_context_end(struct od_context* context);
+
+//-----------------------------------------------------------------------------------------------------------------------------
+void od_context_destroy(struct od_context* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3,7 +3,7 @@
 
 #include <stddef.h>
 
-static const size_t rasterization_shader_size = 25584;
+static const size_t rasterization_shader_size = 35950;
 static const char rasterization_shader[] =
     "#include <metal_stdlib>\n"
     "#define RASTERIZER_SHADER\n"
@@ -15,7 +15,8 @@ static const char rasterization_shader[] =
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
-    "// renderer constants\n"
+    "// renderer constants, the MAX_* are the defaults of onedraw_def.limits (the clips can't go higher, a binning pass\n"
+    "// holds LAST_COMMAND commands at most)\n"
     "#define TILE_SIZE (16)\n"
     "#define REGION_SIZE (16)\n"
     "#define MAX_NODES_COUNT (1<<22)\n"
@@ -27,6 +28,10 @@ static const char rasterization_shader[] =
     "#define LAST_COMMAND (MAX_COMMANDS-1)\n"
     "#define MAX_THREADS_PER_THREADGROUP (1024)\n"
     "#define MAX_GLYPHS (128)\n"
+    "#define MAX_FONT_SLOTS (256)         // entries of the glyph table, the commands store 8 bits glyph indices\n"
+    "#define MAX_RUN_GLYPHS (255)\n"
+    "#define FONT_PLANES (3)              // the font textures stack the red, green and blue planes of the msdf vertically\n"
+    "#define MAX_DRAW_VALUES (10)\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "// cpp compatibility\n"
@@ -38,6 +43,7 @@ static const char rasterization_shader[] =
     "#define command_buffer void*\n"
     "#define texture_half uint64_t\n"
     "#define texture_array uint64_t\n"
+    "#include <string.h>\n"
     "#ifdef __cplusplus\n"
     "    typedef struct alignas(8) {float x, y;} float2;\n"
     "    typedef struct alignas(16) {float x, y, z, w;} float4;\n"
@@ -65,6 +71,7 @@ static const char rasterization_shader[] =
     "    primitive_blurred_box = 8,\n"
     "    primitive_quad = 9,\n"
     "    primitive_oriented_quad = 10,\n"
+    "    primitive_text_run = 11,\n"
     "    \n"
     "    begin_group = 32,\n"
     "    end_group = 33\n"
@@ -78,11 +85,29 @@ static const char rasterization_shader[] =
     "    fill_gradient = 3,\n"
     "};\n"
     "\n"
+    "// set in the fillmode of opaque boxes and quads by the occlusion pass, the tile binning stops at them\n"
+    "#define FILLMODE_OCCLUDER (0x80)\n"
+    "\n"
     "#define COMMAND_TYPE_MASK   (0x3f)\n"
     "#define PRIMITIVE_FILLMODE_MASK (0xC0)\n"
     "#define PRIMITIVE_FILLMODE_SHIFT (6)\n"
     "\n"
     "\n"
+    "// set in the data_index of the commands with packed draw data\n"
+    "#define DRAW_DATA_PACKED (0x80000000)\n"
+    "#define PACKED_POSITION_SCALE (8.f)\n"
+    "\n"
+    "// encoding of a value in packed draw data\n"
+    "enum packed_kind\n"
+    "{\n"
+    "    packed_end = 0,\n"
+    "    packed_position = 1,    // unsigned 13.3 fixed point : positions and lengths in [0; 8192[\n"
+    "    packed_unorm = 2,       // uv in [0; 1]\n"
+    "    packed_snorm = 3,       // direction, sin/cos in [-1; 1]\n"
+    "    packed_half = 4,        // other floats\n"
+    "    packed_color = 5        // two 16 bits, the 32 bits color is bitcast to a float\n"
+    "};\n"
+    "\n"
     "enum sdf_operator\n"
     "{\n"
     "    op_overwrite = 0,\n"
@@ -108,14 +133,15 @@ static const char rasterization_shader[] =
     "    uint32_t next;\n"
     "    uint16_t command_index;\n"
     "    uint8_t command_type;\n"
-    "    uint8_t padding;\n"
+    "    uint8_t first_glyph;        // text runs : first glyph overlapping the tile\n"
     "} tile_node;\n"
     "\n"
     "typedef struct counters\n"
     "{\n"
     "    atomic_uint num_nodes;\n"
     "    atomic_uint num_tiles;\n"
-    "    uint32_t pad[2];\n"
+    "    atomic_uint max_tile_nodes;\n"
+    "    uint32_t pad;\n"
     "} counters;\n"
     "\n"
     "enum clip_type \n"
@@ -134,16 +160,14 @@ static const char rasterization_shader[] =
     "    enum clip_type type;\n"
     "} clip_shape;\n"
     "\n"
+    "// tile coordinates of a command's bounding box, stored on 8 bits (one word per command) or on 16 bits when the wide\n"
+    "// mode is enabled (two words per command), see load_quantized_aabb()\n"
     "typedef struct quantized_aabb\n"
     "{\n"
-    "#ifdef RASTERIZER_SHADER\n"
-    "    uint32_t packed_data;\n"
-    "#else\n"
-    "    uint8_t min_x;\n"
-    "    uint8_t min_y;\n"
-    "    uint8_t max_x;\n"
-    "    uint8_t max_y;\n"
-    "#endif\n"
+    "    uint16_t min_x;\n"
+    "    uint16_t min_y;\n"
+    "    uint16_t max_x;\n"
+    "    uint16_t max_y;\n"
     "} quantized_aabb;\n"
     "\n"
     "typedef struct font_char\n"
@@ -152,13 +176,15 @@ static const char rasterization_shader[] =
     "    float2 uv_bottomright;\n"
     "    float width;\n"
     "    float height;\n"
+    "    float top;                  // from the top of the text line to the top of the glyph\n"
+    "    float distance_range;       // pixels of distance between the texel values 0 and 1\n"
     "} font_char;\n"
     "\n"
     "typedef struct draw_cmd_arguments\n"
     "{\n"
     "    constant draw_command* commands;\n"
     "    constant uint32_t* colors;\n"
-    "    constant quantized_aabb* commands_aabb;\n"
+    "    constant uint32_t* commands_aabb;\n"
     "    constant float* draw_data;\n"
     "    constant clip_shape* clips;\n"
     "    constant font_char* glyphs;\n"
@@ -174,16 +200,19 @@ static const char rasterization_shader[] =
     "    uint32_t num_groups;\n"
     "    float aa_width;\n"
     "    float2 screen_div;\n"
+    "    float2 atlas_half_texel;    // half texel of the atlas in uv, the bilinear sampler fades to zero beyond it\n"
     "    uint32_t num_elements_per_thread;\n"
     "    bool culling_debug;\n"
     "    bool srgb_backbuffer;\n"
+    "    bool wide_aabb;\n"
+    "    bool load_backbuffer;       // blends over the pixels of the previous binning pass instead of the clear color\n"
     "} draw_cmd_arguments;\n"
     "\n"
     "typedef struct tiles_data\n"
     "{\n"
     "    device uint32_t* head;\n"
     "    device tile_node* nodes;\n"
-    "    device uint16_t* tile_indices;\n"
+    "    device uint32_t* tile_indices;\n"
     "} tiles_data;\n"
     "\n"
     "typedef struct output_command_buffer\n"
@@ -191,6 +220,141 @@ static const char rasterization_shader[] =
     "    command_buffer cmd_buffer;\n"
     "} output_command_buffer;\n"
     "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// packed draw data\n"
+    "//      * a command's values are stored as 16 bits when they fit in their encoding, see od_pack_draw_data()\n"
+    "//      * the layout is an octal number, one digit (packed_kind) per value, the first value in the lowest digit\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "\n"
+    "typedef struct draw_values\n"
+    "{\n"
+    "    float v[MAX_DRAW_VALUES];\n"
+    "} draw_values;\n"
+    "\n"
+    "static inline uint32_t packed_layout(uint32_t type, uint32_t fillmode)\n"
+    "{\n"
+    "    switch(type)\n"
+    "    {\n"
+    "    case primitive_char: return packed_end;     // glyphs are sampled at their exact position\n"
+    "    case primitive_text_run: return packed_end;\n"
+    "    case primitive_aabox: return 011111;\n"
+    "    case primitive_oriented_box: return (fillmode == fill_gradient) ? 05111111 : 0111111;\n"
+    "    case primitive_disc: return (fillmode == fill_hollow) ? 01111 : ((fillmode == fill_gradient) ? 05111 : 0111);\n"
+    "    case primitive_triangle: return 01111111;\n"
+    "    case primitive_ellipse: return (fillmode == fill_hollow) ? 0111111 : 011111;\n"
+    "    case primitive_pie: return (fillmode == fill_hollow) ? 013333111 : 03333111;\n"
+    "    case primitive_arc: return 013333111;\n"
+    "    case primitive_blurred_box: return 011111;\n"
+    "    case primitive_quad: return 022221111;\n"
+    "    case primitive_oriented_quad: return 02222334411;\n"
+    "    case begin_group: return 011;\n"
+    "    case end_group: return 01;\n"
+    "    default: return packed_end;\n"
+    "    }\n"
+    "}\n"
+    "\n"
+    "#ifndef __METAL_VERSION__\n"
+    "static inline float half_to_float(uint16_t value)\n"
+    "{\n"
+    "    // the packing doesn't produce denormals, infinites and nans\n"
+    "    uint32_t bits = (uint32_t)(value & 0x8000) << 16;\n"
+    "    if ((value & 0x7fff) != 0)\n"
+    "        bits |= ((uint32_t)(value & 0x7fff) << 13) + ((127 - 15) << 23);\n"
+    "\n"
+    "    float result;\n"
+    "    memcpy(&result, &bits, sizeof(float));\n"
+    "    return result;\n"
+    "}\n"
+    "#endif\n"
+    "\n"
+    "// returns the draw data of a command, decoded if packed\n"
+    "static inline draw_values load_draw_data(constant float* draw_data, uint32_t data_index, uint32_t type, uint32_t fillmode)\n"
+    "{\n"
+    "    draw_values values;\n"
+    "    uint32_t layout = packed_layout(type, fillmode);\n"
+    "\n"
+    "    if ((data_index & DRAW_DATA_PACKED) == 0)\n"
+    "    {\n"
+    "        for(uint32_t i=0; (layout >> (i * 3)) != 0; ++i)\n"
+    "            values.v[i] = draw_data[data_index + i];\n"
+    "        return values;\n"
+    "    }\n"
+    "\n"
+    "    constant uint16_t* packed = (constant uint16_t*) &draw_data[data_index & ~DRAW_DATA_PACKED];\n"
+    "    for(uint32_t i=0; layout != 0; ++i, layout >>= 3)\n"
+    "    {\n"
+    "        uint16_t value = *packed++;\n"
+    "        switch(layout & 7)\n"
+    "        {\n"
+    "        case packed_position: values.v[i] = (float) value * (1.f / PACKED_POSITION_SCALE); break;\n"
+    "        case packed_unorm: values.v[i] = (float) value * (1.f / 65535.f); break;\n"
+    "        case packed_snorm: values.v[i] = (float) (int16_t) value * (1.f / 32767.f); break;\n"
+    "#ifdef __METAL_VERSION__\n"
+    "        case packed_half: values.v[i] = (float) as_type<half>(value); break;\n"
+    "        case packed_color: values.v[i] = as_type<float>((uint32_t) value | ((uint32_t) (*packed++) << 16)); break;\n"
+    "#else\n"
+    "        case packed_half: values.v[i] = half_to_float(value); break;\n"
+    "        case packed_color:\n"
+    "        {\n"
+    "            uint32_t color = (uint32_t) value | ((uint32_t) (*packed++) << 16);\n"
+    "            memcpy(&values.v[i], &color, sizeof(float));\n"
+    "            break;\n"
+    "        }\n"
+    "#endif\n"
+    "        }\n"
+    "    }\n"
+    "    return values;\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// returns the bounding box of a command, the 8 bits coordinates are in the bytes of the word (min_x in the lowest)\n"
+    "static inline quantized_aabb load_quantized_aabb(constant uint32_t* boxes, uint32_t index, bool wide)\n"
+    "{\n"
+    "    quantized_aabb box;\n"
+    "    if (wide)\n"
+    "    {\n"
+    "        uint32_t min_xy = boxes[index * 2], max_xy = boxes[index * 2 + 1];\n"
+    "        box.min_x = (uint16_t) (min_xy & 0xffff); box.min_y = (uint16_t) (min_xy >> 16);\n"
+    "        box.max_x = (uint16_t) (max_xy & 0xffff); box.max_y = (uint16_t) (max_xy >> 16);\n"
+    "    }\n"
+    "    else\n"
+    "    {\n"
+    "        uint32_t packed = boxes[index];\n"
+    "        box.min_x = (uint16_t) (packed & 0xff); box.min_y = (uint16_t) ((packed >> 8) & 0xff);\n"
+    "        box.max_x = (uint16_t) ((packed >> 16) & 0xff); box.max_y = (uint16_t) (packed >> 24);\n"
+    "    }\n"
+    "    return box;\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// text runs\n"
+    "//      * the draw data are the top of the text line, the left edge of each glyph and the glyph indices (4 per float)\n"
+    "//      * the number of glyphs is in the extra field of the command, left and right edges of the glyphs are increasing\n"
+    "//      * the tile binning keeps the first glyph overlapping the tile in the node, the rasterizer walks from there\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "\n"
+    "static inline uint32_t text_run_size(uint32_t count) {return 1 + count + (count + 3) / 4;}\n"
+    "\n"
+    "static inline uint32_t text_run_glyph(constant const float* run, uint32_t count, uint32_t index)\n"
+    "{\n"
+    "    return ((constant const uint8_t*) &run[1 + count])[index];\n"
+    "}\n"
+    "\n"
+    "// first glyph whose right edge is after [min_x], [count] if none\n"
+    "static inline uint32_t text_run_first_glyph(constant const float* run, uint32_t count, constant const font_char* glyphs, float min_x)\n"
+    "{\n"
+    "    uint32_t first = 0, last = count;\n"
+    "    while (first < last)\n"
+    "    {\n"
+    "        uint32_t middle = (first + last) / 2;\n"
+    "        if (run[1 + middle] + glyphs[text_run_glyph(run, count, middle)].width < min_x)\n"
+    "            first = middle + 1;\n"
+    "        else\n"
+    "            last = middle;\n"
+    "    }\n"
+    "    return first;\n"
+    "}\n"
+    "\n"
     "#ifdef __METAL_VERSION__\n"
     "inline float2 skew(float2 v) {return float2(-v.y, v.x);}\n"
     "inline float cross2(float2 a, float2 b ) {return a.x*b.y - a.y*b.x;}\n"
@@ -352,7 +516,7 @@ static const char rasterization_shader[] =
     "{\n"
     "    switch(clip.type)\n"
     "    {\n"
-    "    case clip_rect: return (pos.x < clip.rect.min_x || pos.y < clip.rect.min_y && \n"
+    "    case clip_rect: return (pos.x < clip.rect.min_x || pos.y < clip.rect.min_y || \n"
     "                            pos.x > clip.rect.max_x || pos.y > clip.rect.max_y);\n"
     "    case clip_disc: return (distance_squared(pos, float2(clip.disc.center_x, clip.disc.center_y)) > clip.disc.squared_radius);\n"
     "    }\n"
@@ -408,10 +572,39 @@ static const char rasterization_shader[] =
     "                 linear_to_srgb_channel(linear_color.b),linear_color.a);\n"
     "}\n"
     "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "static inline half srgb_to_linear_channel(half c)\n"
+    "{\n"
+    "    if (c <= 0.04045h)\n"
+    "        return c / 12.92h;\n"
+    "    else\n"
+    "        return pow((c + 0.055h) / 1.055h, 2.4h);\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "half4 srgb_to_linear(half4 srgb_color)\n"
+    "{\n"
+    "    return half4(srgb_to_linear_channel(srgb_color.r), srgb_to_linear_channel(srgb_color.g),\n"
+    "                 srgb_to_linear_channel(srgb_color.b), srgb_color.a);\n"
+    "}\n"
+    "\n"
+    "// ---------------------------------------------------------------------------------------------------------------------------\n"
+    "// coverage of a glyph : the median of the msdf planes is the distance to the outline, 0.5 on the edge\n"
+    "static inline half msdf_coverage(texture_half font, float2 uv, float distance_range, float aa_width)\n"
+    "{\n"
+    "    constexpr sampler s_font(address::clamp_to_zero, filter::linear);\n"
+    "    float2 plane = float2(0.f, 1.f / FONT_PLANES);\n"
+    "    float r = font.sample(s_font, uv).r;\n"
+    "    float g = font.sample(s_font, uv + plane).r;\n"
+    "    float b = font.sample(s_font, uv + plane * 2.f).r;\n"
+    "    float median = max(min(r, g), min(max(r, g), b));\n"
+    "    return half(saturate((median - .5f) * distance_range / aa_width + .5f));\n"
+    "}\n"
+    "\n"
     "struct vs_out\n"
     "{\n"
     "    float4 pos [[position]];\n"
-    "    uint16_t tile_index [[flat]];\n"
+    "    uint32_t tile_index [[flat]];\n"
     "};\n"
     "\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
@@ -420,11 +613,11 @@ static const char rasterization_shader[] =
     "vertex vs_out tile_vs(uint instance_id [[instance_id]],\n"
     "                      uint vertex_id [[vertex_id]],\n"
     "                      constant draw_cmd_arguments& input [[buffer(0)]],\n"
-    "                      constant uint16_t* tile_indices [[buffer(1)]])\n"
+    "                      constant uint32_t* tile_indices [[buffer(1)]])\n"
     "{\n"
     "    vs_out out;\n"
     "\n"
-    "    uint16_t tile_index = tile_indices[instance_id];\n"
+    "    uint32_t tile_index = tile_indices[instance_id];\n"
     "    uint16_t tile_x = tile_index % input.num_tile_width;\n"
     "    uint16_t tile_y = tile_index / input.num_tile_width;\n"
     "    \n"
@@ -446,11 +639,16 @@ static const char rasterization_shader[] =
     "// fragment shader\n"
     "// ---------------------------------------------------------------------------------------------------------------------------\n"
     "fragment half4 tile_fs(vs_out in [[stage_in]],\n"
+    "                       half4 backbuffer [[color(0)]],\n"
     "                       constant draw_cmd_arguments& input [[buffer(0)]],\n"
     "                       device tiles_data& tiles [[buffer(1)]])\n"
     "{\n"
     "    constexpr sampler s_linear(address::clamp_to_zero, filter::linear );\n"
     "    half4 output = input.culling_debug ? half4(0.f, 0.f, 1.0f, 1.0f) : half4(input.clear_color);\n"
+    "\n"
+    "    // binning passes after the first one blend over the pixels already written (programmable blending)\n"
+    "    if (input.load_backbuffer)\n"
+    "        output = input.srgb_backbuffer ? backbuffer : srgb_to_linear(backbuffer);\n"
     "    uint32_t node_index = tiles.head[in.tile_index];\n"
     "    if (node_index == INVALID_INDEX)\n"
     "        return output;\n"
@@ -482,7 +680,8 @@ static const char rasterization_shader[] =
     "        if (!clip_pixel(clip, in.pos.xy))\n"
     "        {\n"
     "            float distance = 10.f;\n"
-    "            constant float* data = &input.draw_data[data_index];\n"
+    "            draw_values values = load_draw_data(input.draw_data, data_index, type, fillmode);\n"
+    "            thread const float* data = values.v;\n"
     "\n"
     "            if (type == begin_group)\n"
     "            {\n"
@@ -556,21 +755,39 @@ static const char rasterization_shader[] =
     "                }\n"
     "                case primitive_char:\n"
     "                {\n"
-    "                    uint glyph_index = extra;\n"
-    "                    if (glyph_index<MAX_GLYPHS)\n"
+    "                    // never packed, load_draw_data() doesn't read the position\n"
+    "                    float2 top_left = float2(input.draw_data[data_index], input.draw_data[data_index + 1]);\n"
+    "                    constant font_char& g = input.glyphs[extra];\n"
+    "                    float2 uv_topleft = g.uv_topleft;\n"
+    "                    float2 uv_bottomright = g.uv_bottomright;\n"
+    "                    float2 char_size = float2(g.width, g.height);\n"
+    "                    float2 t = (in.pos.xy - top_left) / char_size.xy;\n"
+    "\n"
+    "                    if (all(t >= 0.f && t <= 1.f))\n"
+    "                    {\n"
+    "                        float2 uv = mix(uv_topleft, uv_bottomright, t);\n"
+    "                        half coverage = msdf_coverage(input.font, uv, g.distance_range, input.aa_width);\n"
+    "                        distance = (1.h - coverage) * input.aa_width;\n"
+    "                    }\n"
+    "                    break;\n"
+    "                }\n"
+    "                case primitive_text_run:\n"
+    "                {\n"
+    "                    // overlapping glyphs are composited like separate commands (the transparencies multiply),\n"
+    "                    // the walk stops at the first glyph on the right of the pixel\n"
+    "                    constant float* run = &input.draw_data[data_index];\n"
+    "                    uint count = extra;\n"
+    "                    half transparency = 1.h;\n"
+    "                    for(uint i=node.first_glyph; i<count && run[1 + i] <= in.pos.x; ++i)\n"
     "                    {\n"
-    "                        float2 top_left = float2(data[0], data[1]);\n"
-    "                        constant font_char& g = input.glyphs[glyph_index];\n"
-    "                        float2 uv_topleft = g.uv_topleft;\n"
-    "                        float2 uv_bottomright = g.uv_bottomright;\n"
-    "                        float2 char_size = float2(g.width, g.height);\n"
-    "                        float2 t = (in.pos.xy - top_left) / char_size.xy;\n"
+    "                        constant font_char& g = input.glyphs[text_run_glyph(run, count, i)];\n"
+    "                        float2 t = (in.pos.xy - float2(run[1 + i], run[0] + g.top)) / float2(g.width, g.height);\n"
     "\n"
     "                        if (all(t >= 0.f && t <= 1.f))\n"
     "                        {\n"
-    "                            float2 uv = mix(uv_topleft, uv_bottomright, t);\n"
-    "                            half texel = 1.h - input.font.sample(s_linear, uv).r;\n"
-    "                            distance = texel * input.aa_width;\n"
+    "                            float2 uv = mix(g.uv_topleft, g.uv_bottomright, t);\n"
+    "                            transparency *= 1.h - msdf_coverage(input.font, uv, g.distance_range, input.aa_width);\n"
+    "                            distance = transparency * input.aa_width;\n"
     "                        }\n"
     "                    }\n"
     "                    break;\n"
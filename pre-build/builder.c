@@ -3,9 +3,11 @@
 #include "bin2h.h"
 #include "bc4_encoder.h"
 #include "../src/font.h"
+#include "../src/shaders/common.h"
 
 #define STB_TRUETYPE_IMPLEMENTATION
 #include "stb_truetype.h"
+#include "../src/msdf.h"
 
 #include "shader_reader.h"
 
@@ -52,11 +54,13 @@ void* read_file(const char* filename, size_t* file_size, Arena* arena)
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------
-bool build_font(Arena *arena, float font_height, uint32_t atlas_width, uint32_t atlas_height)
+// the glyphs are baked as multi-channel distance fields at [msdf_height] and drawn at [font_height], the rectangles are
+// packed in rows of [atlas_width] texels and the atlas stacks the FONT_PLANES planes before the BC4 compression
+bool build_font(Arena *arena, float font_height, float msdf_height, float range, uint32_t atlas_width)
 {
-    if ((atlas_width%4) != 0 || (atlas_height%4) != 0)
+    if ((atlas_width%4) != 0)
     {
-        fprintf(stdout, "font atlas width and height must be a multiple of 4\n");
+        fprintf(stdout, "font atlas width must be a multiple of 4\n");
         return false;
     }
 
@@ -68,64 +72,101 @@ bool build_font(Arena *arena, float font_height, uint32_t atlas_width, uint32_t
     if (font_data == NULL)
         return false;
 
-    fprintf(stdout, "ok\nbaking %dx%d atlas : ", atlas_width, atlas_height);
+    stbtt_fontinfo info;
+    if (!stbtt_InitFont(&info, font_data, stbtt_GetFontOffsetForIndex(font_data, 0)))
+        return false;
 
-    uint8_t* atlas_pixels = arena_alloc(arena, atlas_height * atlas_width);
-    if (atlas_pixels == NULL)
+    struct alphabet* font = arena_alloc(arena, sizeof(struct alphabet));
+    if (font == NULL)
         return false;
 
-    stbtt_bakedchar glyphs[FONT_NUM_CHARS];
-    int result = stbtt_BakeFontBitmap(font_data, 0, font_height, atlas_pixels, atlas_width, atlas_height,
-                                      FONT_CHAR_FIRST, FONT_NUM_CHARS, glyphs);
+    memset(font, 0, sizeof(struct alphabet));
+    font->first_glyph = FONT_CHAR_FIRST;
+    font->num_glyphs = FONT_NUM_CHARS;
+    font->texture_width = atlas_width;
+    font->font_height = font_height;
+
+    const float scale = stbtt_ScaleForPixelHeight(&info, msdf_height);
+    const float ratio = font_height / msdf_height;
+    const int padding = (int) ceilf(range);
+    font->distance_range = 2.f * range * ratio;
+
+    fprintf(stdout, "ok\npacking glyphs : ");
 
-    if (result == 0)
+    // rows of glyphs with one texel between the rectangles for the bilinear filtering
+    int glyph_index[FONT_NUM_CHARS];
+    uint32_t x = 0, y = 0, row_height = 0;
+    for(uint32_t i=0; i<FONT_NUM_CHARS; ++i)
+    {
+        int x0, y0, x1, y1, advance, left_side_bearing;
+        glyph_index[i] = stbtt_FindGlyphIndex(&info, (int) (FONT_CHAR_FIRST + i));
+        stbtt_GetGlyphHMetrics(&info, glyph_index[i], &advance, &left_side_bearing);
+        stbtt_GetGlyphBitmapBox(&info, glyph_index[i], scale, scale, &x0, &y0, &x1, &y1);
+
+        struct glyph* g = &font->glyphs[i];
+        g->advance_x = (float) advance * scale * ratio;
+        if (glyph_index[i] == 0 || x1 <= x0 || y1 <= y0)
+            continue;
+
+        uint32_t width = (uint32_t) (x1 - x0 + padding * 2);
+        uint32_t height = (uint32_t) (y1 - y0 + padding * 2);
+        if (x + width > atlas_width)
+        {
+            x = 0;
+            y += row_height + 1;
+            row_height = 0;
+        }
+
+        g->x0 = (uint16_t) x;
+        g->y0 = (uint16_t) y;
+        g->x1 = (uint16_t) (x + width);
+        g->y1 = (uint16_t) (y + height);
+        g->width = (float) width * ratio;
+        g->height = (float) height * ratio;
+        g->bearing_x = (float) (x0 - padding) * ratio;
+        g->bearing_y = (float) (y0 - padding) * ratio;
+
+        x += width + 1;
+        row_height = (height > row_height) ? height : row_height;
+    }
+
+    uint32_t atlas_height = ((y + row_height) + 3) & ~3u;
+    font->texture_height = atlas_height;
+
+    fprintf(stdout, "ok\nbaking %dx%d msdf atlas : ", atlas_width, atlas_height * FONT_PLANES);
+
+    const size_t plane_size = atlas_width * atlas_height;
+    uint8_t* atlas_pixels = arena_alloc(arena, plane_size * FONT_PLANES);
+    if (atlas_pixels == NULL)
         return false;
-    else if (result < 0)
-        fprintf(stdout, "warning only %d chars could fit in the atlas\n", -result);
-    else fprintf(stdout, "ok\n");
 
-    fprintf(stdout, "compressing atlas in BC4 : ");
+    memset(atlas_pixels, 0, plane_size * FONT_PLANES);
+    for(uint32_t i=0; i<FONT_NUM_CHARS; ++i)
+    {
+        const struct glyph* g = &font->glyphs[i];
+        if (g->x1 == g->x0)
+            continue;
+
+        if (!msdf_glyph(&info, glyph_index[i], scale, padding, range, &atlas_pixels[g->y0 * atlas_width + g->x0],
+                        g->x1 - g->x0, g->y1 - g->y0, (int) atlas_width, (int) plane_size))
+            return false;
+    }
+
+    fprintf(stdout, "ok\ncompressing atlas in BC4 : ");
 
-    size_t bc4_image_size = (atlas_width/4) * (atlas_height/4) * 8;
+    size_t bc4_image_size = (atlas_width/4) * ((atlas_height * FONT_PLANES)/4) * 8;
     uint8_t* compressed_atlas = arena_alloc(arena, bc4_image_size);
 
     if (compressed_atlas == NULL)
         return false;
 
-    bc4_encode(atlas_pixels, compressed_atlas, atlas_width, atlas_height);
+    bc4_encode(atlas_pixels, compressed_atlas, atlas_width, atlas_height * FONT_PLANES);
 
     fprintf(stdout, "ok\nwritting %s : ", FONT_H);
 
     if (!bin2h(FONT_H, "default_font_atlas", compressed_atlas, bc4_image_size))
         return false;
 
-    fprintf(stdout, "ok\nfilling glyphs structure : ");
-
-    struct alphabet* font = arena_alloc(arena, sizeof(struct alphabet));
-    if (font == NULL)
-        return false;
-
-    memset(font, 0, sizeof(struct alphabet));
-    font->first_glyph = FONT_CHAR_FIRST;
-    font->num_glyphs = FONT_NUM_CHARS;
-    font->texture_width = atlas_width;
-    font->texture_height = atlas_height;
-    font->font_height = font_height;
-
-    for(uint32_t i=0; i<FONT_NUM_CHARS; ++i)
-    {
-        font->glyphs[i] = (struct glyph)
-        {
-            .x0 = glyphs[i].x0,
-            .y0 = glyphs[i].y0,
-            .x1 = glyphs[i].x1,
-            .y1 = glyphs[i].y1,
-            .bearing_x = glyphs[i].xoff,
-            .bearing_y = glyphs[i].yoff,
-            .advance_x = glyphs[i].xadvance
-        };
-    }
-
     fprintf(stdout, "ok\nwritting %s : ", GLYPH_H);
 
     if (!bin2h(GLYPH_H, "default_font", font, sizeof(struct alphabet)))
@@ -174,6 +215,13 @@ bool copy_files(void)
     if (!copy_file(SHADERS_FOLDER"common.h", LIB_FOLDER"common.h"))
         return false;
 
+    // the runtime fonts (od_load_font) are rasterized with the same stb_truetype and msdf generator
+    if (!copy_file("pre-build/stb_truetype.h", LIB_FOLDER"stb_truetype.h"))
+        return false;
+
+    if (!copy_file(SOURCE_FOLDER"msdf.h", LIB_FOLDER"msdf.h"))
+        return false;
+
     fprintf(stdout, " ok\n");
 
     return true;
@@ -189,7 +237,7 @@ int main(int argc, const char * argv[])
 
     fprintf(stdout, "onedraw %u.%u library builder\n\n", ONEDRAW_MAJOR_VERSION, ONEDRAW_MINOR_VERSION);
 
-    bool success = build_font(&arena, 32.f, 256, 256);
+    bool success = build_font(&arena, 32.f, 32.f, 2.f, 256);
     if (!success)
         fprintf(stdout, "failed\n");
 
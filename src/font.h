@@ -5,9 +5,11 @@
 
 #define MAX_GLYPHS (128)
 
+// x0, y0, x1, y1 : rectangle of the distance field in the atlas, width and height : size of the rectangle on screen
 struct glyph
 {
     uint16_t x0, y0, x1, y1;
+    float width, height;
     float bearing_x, bearing_y;
     float advance_x;
 };
@@ -16,10 +18,11 @@ struct alphabet
 {
     struct glyph glyphs[MAX_GLYPHS];
     float font_height;
+    float distance_range;
     uint16_t num_glyphs;
     uint16_t first_glyph;
     uint16_t texture_width;
-    uint16_t texture_height;
+    uint16_t texture_height;    // of one plane, the texture stacks FONT_PLANES planes
 };
 
 #endif
\ No newline at end of file
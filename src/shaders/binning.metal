@@ -332,7 +332,7 @@ bool is_aabb_inside_pie(float2 center, float2 direction, float2 aperture, float
 // ---------------------------------------------------------------------------------------------------------------------------
 // returns true if the command intersects with the tile
 // ---------------------------------------------------------------------------------------------------------------------------
-bool intersection_tile_command(aabb tile_aabb, draw_command cmd, sdf_operator op, constant float* data, float aabb_margin)
+bool intersection_tile_command(aabb tile_aabb, draw_command cmd, sdf_operator op, thread const float* data, float aabb_margin)
 {
     // grow the bounding box for anti-aliasing, smooth blend and outline
     aabb tile_enlarge_aabb = aabb_grow(tile_aabb, aabb_margin);
@@ -441,7 +441,8 @@ bool intersection_tile_command(aabb tile_aabb, draw_command cmd, sdf_operator op
         case primitive_aabox :
         case primitive_blurred_box :
         case primitive_quad:
-        case primitive_char : intersection = true; break;
+        case primitive_char :
+        case primitive_text_run : intersection = true; break;     // the glyphs are tested by tile_bin()
         default : intersection = false; break;
     }
 
@@ -461,7 +462,7 @@ kernel void predicate(constant draw_cmd_arguments& input [[buffer(0)]],
     // reverse order for the tile linked list 
     uint cmd_index = input.num_commands - index - 1;
 
-    quantized_aabb aabb = input.commands_aabb[cmd_index];
+    quantized_aabb aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);
     aabb.min_x /= REGION_SIZE; aabb.min_y /= REGION_SIZE;
     aabb.max_x /= REGION_SIZE; aabb.max_y /= REGION_SIZE;
 
@@ -568,7 +569,7 @@ kernel void region_bin(constant draw_cmd_arguments& input [[buffer(0)]],
 // linked-list cleaning
 //      * detect combination with no primitive and skip it
 // ---------------------------------------------------------------------------------------------------------------------------
-void clean_list(device tiles_data& tiles, uint16_t tile_index)
+void clean_list(device tiles_data& tiles, uint32_t tile_index)
 {
     uint32_t node_index = tiles.head[tile_index];
     uint32_t previous_index = INVALID_INDEX;
@@ -627,6 +628,45 @@ static inline bool clip_tile(aabb tile, clip_shape clip)
     return false;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------------
+// range on one axis of a quad where the sampled texels are opaque, the sampler fades to zero in the half texel border
+// and outside of [0, 1], returns false if there is no such range
+static inline bool quad_opaque_range(float p0, float p1, float uv0, float uv1, float half_texel, thread float& range_min, thread float& range_max)
+{
+    float uv_min = max(min(uv0, uv1), half_texel), uv_max = min(max(uv0, uv1), 1.f - half_texel);
+    if (uv_min > uv_max)
+        return false;
+
+    float a = (uv0 != uv1) ? mix(p0, p1, (uv_min - uv0) / (uv1 - uv0)) : p0;
+    float b = (uv0 != uv1) ? mix(p0, p1, (uv_max - uv0) / (uv1 - uv0)) : p1;
+    range_min = min(a, b);
+    range_max = max(a, b);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// true if an occluder (opaque box or quad) fully covers the tile, anti-aliased edges and clip rect excluded
+static inline bool is_tile_occluded(aabb tile, draw_command cmd, thread const float* data, clip_shape clip, float aa_width, float2 half_texel)
+{
+    if (clip.type != clip_rect)
+        return false;
+
+    aabb occluder;
+    if (cmd.type == primitive_aabox)
+    {
+        occluder.min = float2(data[0], data[1]) - float2(data[2], data[3]);
+        occluder.max = float2(data[0], data[1]) + float2(data[2], data[3]);
+    }
+    else if (!quad_opaque_range(data[0], data[2], data[4], data[6], half_texel.x, occluder.min.x, occluder.max.x) ||
+             !quad_opaque_range(data[1], data[3], data[5], data[7], half_texel.y, occluder.min.y, occluder.max.y))
+        return false;
+    occluder = aabb_grow(occluder, -aa_width);
+    occluder.min = max(occluder.min, float2(clip.rect.min_x, clip.rect.min_y));
+    occluder.max = min(occluder.max, float2(clip.rect.max_x, clip.rect.max_y));
+
+    return all(tile.min >= occluder.min) && all(tile.max <= occluder.max);
+}
+
 // ---------------------------------------------------------------------------------------------------------------------------
 // for each tile of the screen, we traverse the list of commands of the region and if the command has an impact on the tile
 // we add the command to the linked list of the tile
@@ -647,7 +687,8 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
     if (tile_xy.x >= input.num_tile_width || tile_xy.y >= input.num_tile_height)
         return;
 
-    ushort tile_index = tile_xy.y * input.num_tile_width + tile_xy.x;
+    // more than 65536 tiles above 4K
+    uint tile_index = uint(tile_xy.y) * input.num_tile_width + tile_xy.x;
 
     // compute tile bounding box
     aabb tile_aabb = {.min = float2(tile_xy), .max = float2(tile_xy.x + 1, tile_xy.y + 1)};
@@ -655,6 +696,7 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
 
     float aabb_margin = 0.f;
     sdf_operator group_op = op_overwrite;
+    uint num_nodes = 0;
     constant const uint16_t* indices = &regions_indices[region_index * input.num_commands];
 
     for(uint32_t i=0; i<input.num_commands; ++i)
@@ -663,7 +705,7 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
         if (cmd_index == LAST_COMMAND)
             break;
 
-        quantized_aabb cmd_aabb = input.commands_aabb[cmd_index];
+        quantized_aabb cmd_aabb = load_quantized_aabb(input.commands_aabb, cmd_index, input.wide_aabb);
         if (any(ushort4(tile_xy, cmd_aabb.max_x, cmd_aabb.max_y) < ushort4(cmd_aabb.min_x, cmd_aabb.min_y, tile_xy)))
             continue;
 
@@ -677,10 +719,21 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
         if (clip_tile(tile_box, clip))
             continue;
 
-        constant float* data = &input.draw_data[cmd.data_index];
+        draw_values values = load_draw_data(input.draw_data, cmd.data_index, cmd.type, cmd.fillmode);
+        thread const float* data = values.v;
 
         bool to_be_added = intersection_tile_command(tile_aabb, cmd, group_op, data, input.aa_width + aabb_margin);
 
+        // a text run is added if one of its glyphs overlaps the tile, the node starts at this glyph
+        uint32_t first_glyph = 0;
+        if (to_be_added && cmd.type == primitive_text_run)
+        {
+            constant float* run = &input.draw_data[cmd.data_index];
+            float margin = input.aa_width + aabb_margin;
+            first_glyph = text_run_first_glyph(run, cmd.extra, input.glyphs, tile_aabb.min.x - margin);
+            to_be_added = (first_glyph < cmd.extra) && (run[1 + first_glyph] <= tile_aabb.max.x + margin);
+        }
+
         // we traverse in reverse order, so the end comes first
         if (cmd.type == begin_group)
         {
@@ -697,6 +750,7 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
         {
             // allocate one node
             uint new_node_index = atomic_fetch_add_explicit(&counter.num_nodes, 1, memory_order_relaxed);
+            num_nodes++;
 
             // avoid access beyond the end of the buffer
             if (new_node_index<input.max_nodes)
@@ -706,16 +760,25 @@ kernel void tile_bin(constant draw_cmd_arguments& input [[buffer(0)]],
                 {
                     .command_index = (uint16_t)cmd_index,
                     .next  = output.head[tile_index],
-                    .command_type = (uint8_t) cmd.type
+                    .command_type = (uint8_t) cmd.type,
+                    .first_glyph = (uint8_t) first_glyph
                 };
 
                 output.head[tile_index] = new_node_index;
             }
+
+            // outside of a group, the commands below an occluder covering the tile are hidden
+            if ((cmd.fillmode & FILLMODE_OCCLUDER) && aabb_margin == 0.f && is_tile_occluded(tile_aabb, cmd, data, clip, input.aa_width, input.atlas_half_texel))
+                break;
         }
     }
 
     clean_list(output, tile_index);
 
+    // longest list, reported in the stats (nodes dropped by an overflow included)
+    if (num_nodes > 0)
+        atomic_fetch_max_explicit(&counter.max_tile_nodes, num_nodes, memory_order_relaxed);
+
     // if the tile has some draw command to proceed
     if (output.head[tile_index] != INVALID_INDEX)
     {
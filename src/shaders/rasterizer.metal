@@ -140,7 +140,7 @@ static inline bool clip_pixel(constant clip_shape& clip, float2 pos)
 {
     switch(clip.type)
     {
-    case clip_rect: return (pos.x < clip.rect.min_x || pos.y < clip.rect.min_y && 
+    case clip_rect: return (pos.x < clip.rect.min_x || pos.y < clip.rect.min_y || 
                             pos.x > clip.rect.max_x || pos.y > clip.rect.max_y);
     case clip_disc: return (distance_squared(pos, float2(clip.disc.center_x, clip.disc.center_y)) > clip.disc.squared_radius);
     }
@@ -196,10 +196,39 @@ half4 linear_to_srgb(half4 linear_color)
                  linear_to_srgb_channel(linear_color.b),linear_color.a);
 }
 
+// ---------------------------------------------------------------------------------------------------------------------------
+static inline half srgb_to_linear_channel(half c)
+{
+    if (c <= 0.04045h)
+        return c / 12.92h;
+    else
+        return pow((c + 0.055h) / 1.055h, 2.4h);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+half4 srgb_to_linear(half4 srgb_color)
+{
+    return half4(srgb_to_linear_channel(srgb_color.r), srgb_to_linear_channel(srgb_color.g),
+                 srgb_to_linear_channel(srgb_color.b), srgb_color.a);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// coverage of a glyph : the median of the msdf planes is the distance to the outline, 0.5 on the edge
+static inline half msdf_coverage(texture_half font, float2 uv, float distance_range, float aa_width)
+{
+    constexpr sampler s_font(address::clamp_to_zero, filter::linear);
+    float2 plane = float2(0.f, 1.f / FONT_PLANES);
+    float r = font.sample(s_font, uv).r;
+    float g = font.sample(s_font, uv + plane).r;
+    float b = font.sample(s_font, uv + plane * 2.f).r;
+    float median = max(min(r, g), min(max(r, g), b));
+    return half(saturate((median - .5f) * distance_range / aa_width + .5f));
+}
+
 struct vs_out
 {
     float4 pos [[position]];
-    uint16_t tile_index [[flat]];
+    uint32_t tile_index [[flat]];
 };
 
 // ---------------------------------------------------------------------------------------------------------------------------
@@ -208,11 +237,11 @@ struct vs_out
 vertex vs_out tile_vs(uint instance_id [[instance_id]],
                       uint vertex_id [[vertex_id]],
                       constant draw_cmd_arguments& input [[buffer(0)]],
-                      constant uint16_t* tile_indices [[buffer(1)]])
+                      constant uint32_t* tile_indices [[buffer(1)]])
 {
     vs_out out;
 
-    uint16_t tile_index = tile_indices[instance_id];
+    uint32_t tile_index = tile_indices[instance_id];
     uint16_t tile_x = tile_index % input.num_tile_width;
     uint16_t tile_y = tile_index / input.num_tile_width;
     
@@ -234,11 +263,16 @@ vertex vs_out tile_vs(uint instance_id [[instance_id]],
 // fragment shader
 // ---------------------------------------------------------------------------------------------------------------------------
 fragment half4 tile_fs(vs_out in [[stage_in]],
+                       half4 backbuffer [[color(0)]],
                        constant draw_cmd_arguments& input [[buffer(0)]],
                        device tiles_data& tiles [[buffer(1)]])
 {
     constexpr sampler s_linear(address::clamp_to_zero, filter::linear );
     half4 output = input.culling_debug ? half4(0.f, 0.f, 1.0f, 1.0f) : half4(input.clear_color);
+
+    // binning passes after the first one blend over the pixels already written (programmable blending)
+    if (input.load_backbuffer)
+        output = input.srgb_backbuffer ? backbuffer : srgb_to_linear(backbuffer);
     uint32_t node_index = tiles.head[in.tile_index];
     if (node_index == INVALID_INDEX)
         return output;
@@ -270,7 +304,8 @@ fragment half4 tile_fs(vs_out in [[stage_in]],
         if (!clip_pixel(clip, in.pos.xy))
         {
             float distance = 10.f;
-            constant float* data = &input.draw_data[data_index];
+            draw_values values = load_draw_data(input.draw_data, data_index, type, fillmode);
+            thread const float* data = values.v;
 
             if (type == begin_group)
             {
@@ -344,21 +379,39 @@ fragment half4 tile_fs(vs_out in [[stage_in]],
                 }
                 case primitive_char:
                 {
-                    uint glyph_index = extra;
-                    if (glyph_index<MAX_GLYPHS)
+                    // never packed, load_draw_data() doesn't read the position
+                    float2 top_left = float2(input.draw_data[data_index], input.draw_data[data_index + 1]);
+                    constant font_char& g = input.glyphs[extra];
+                    float2 uv_topleft = g.uv_topleft;
+                    float2 uv_bottomright = g.uv_bottomright;
+                    float2 char_size = float2(g.width, g.height);
+                    float2 t = (in.pos.xy - top_left) / char_size.xy;
+
+                    if (all(t >= 0.f && t <= 1.f))
+                    {
+                        float2 uv = mix(uv_topleft, uv_bottomright, t);
+                        half coverage = msdf_coverage(input.font, uv, g.distance_range, input.aa_width);
+                        distance = (1.h - coverage) * input.aa_width;
+                    }
+                    break;
+                }
+                case primitive_text_run:
+                {
+                    // overlapping glyphs are composited like separate commands (the transparencies multiply),
+                    // the walk stops at the first glyph on the right of the pixel
+                    constant float* run = &input.draw_data[data_index];
+                    uint count = extra;
+                    half transparency = 1.h;
+                    for(uint i=node.first_glyph; i<count && run[1 + i] <= in.pos.x; ++i)
                     {
-                        float2 top_left = float2(data[0], data[1]);
-                        constant font_char& g = input.glyphs[glyph_index];
-                        float2 uv_topleft = g.uv_topleft;
-                        float2 uv_bottomright = g.uv_bottomright;
-                        float2 char_size = float2(g.width, g.height);
-                        float2 t = (in.pos.xy - top_left) / char_size.xy;
+                        constant font_char& g = input.glyphs[text_run_glyph(run, count, i)];
+                        float2 t = (in.pos.xy - float2(run[1 + i], run[0] + g.top)) / float2(g.width, g.height);
 
                         if (all(t >= 0.f && t <= 1.f))
                         {
-                            float2 uv = mix(uv_topleft, uv_bottomright, t);
-                            half texel = 1.h - input.font.sample(s_linear, uv).r;
-                            distance = texel * input.aa_width;
+                            float2 uv = mix(g.uv_topleft, g.uv_bottomright, t);
+                            transparency *= 1.h - msdf_coverage(input.font, uv, g.distance_range, input.aa_width);
+                            distance = transparency * input.aa_width;
                         }
                     }
                     break;
@@ -0,0 +1,449 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "../lib/onedraw.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// od_bench : headless benchmark of the cpu backend over synthetic scenes
+//
+//      od_bench [--frames n] [--threads n] [--scale f] [--scene name] [--packed] [--csv | --json] [--output file] [--capture file]
+//
+//      * each scene is recorded and rendered [frames] times after WARMUP_FRAMES warm-up frames
+//      * [scale] multiplies the number of primitives of every scene
+//      * results are printed as a table, or as csv/json to track regressions between releases
+//      * --packed enables onedraw_def.packed_draw_data (16 bits draw data)
+//      * --capture writes the measured frames of the scene in a capture file (see od_replay), requires --scene
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define WARMUP_FRAMES (2)
+
+typedef struct scene
+{
+    const char* name;
+    uint32_t width, height;
+    void (*draw)(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame);
+} scene;
+
+typedef struct result
+{
+    const char* name;
+    uint32_t width, height;
+    uint32_t num_frames;
+    uint32_t num_draw_cmd;
+    double record_ms;
+    double binning_ms;
+    double raster_ms;
+    double frame_ms;
+    double num_nodes;
+    double num_tiles;
+    uint32_t max_tile_nodes;
+    uint32_t num_overflow_nodes;
+    float frame_p50_ms, frame_p95_ms, frame_p99_ms;
+} result;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// deterministic random numbers, every run draws the same scenes
+static uint32_t g_seed;
+
+static inline uint32_t rand_u32(void)
+{
+    g_seed ^= g_seed << 13;
+    g_seed ^= g_seed >> 17;
+    g_seed ^= g_seed << 5;
+    return g_seed;
+}
+
+static inline float rand_float(float min_value, float max_value)
+{
+    return min_value + (max_value - min_value) * (float)(rand_u32() & 0xffffff) / (float)0xffffff;
+}
+
+static inline draw_color rand_color(void)
+{
+    return 0xff000000 | (rand_u32() & 0xffffff);
+}
+
+static inline double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// scenes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_discs(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    (void) frame;
+    uint32_t count = (uint32_t)(10000.f * scale);
+    for(uint32_t i=0; i<count; ++i)
+        od_draw_disc(r, rand_float(0.f, width), rand_float(0.f, height), rand_float(2.f, 20.f), rand_color());
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// scatter plot of small dots with the batched api
+#define MAX_SCATTER_POINTS (1<<16)
+static void draw_scatter(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    static float x[MAX_SCATTER_POINTS], y[MAX_SCATTER_POINTS], radius[MAX_SCATTER_POINTS];
+    static draw_color colors[MAX_SCATTER_POINTS];
+
+    (void) frame;
+    uint32_t count = (uint32_t)(40000.f * scale);
+    count = (count < MAX_SCATTER_POINTS) ? count : MAX_SCATTER_POINTS;
+    for(uint32_t i=0; i<count; ++i)
+    {
+        x[i] = rand_float(0.f, width);
+        y[i] = rand_float(0.f, height);
+        radius[i] = rand_float(1.f, 3.f);
+        colors[i] = rand_color();
+    }
+    od_draw_discs(r, x, y, radius, colors, count);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_text(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    static const char* lines[] =
+    {
+        "The quick brown fox jumps over the lazy dog 0123456789",
+        "onedraw bins every command in tiles then evaluates signed distances",
+        "{[(<+-*/=>)]} !?#$%&@ ~^_|;:,. \"quoted\" 'single'",
+    };
+
+    (void) frame;
+    float line_height = od_text_height(r);
+    uint32_t num_lines = (uint32_t)(height / line_height);
+    uint32_t count = (uint32_t)((float)num_lines * scale);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        float y = (float)(i % num_lines) * line_height;
+        for(float x=0.f; x<(float)width; x+=600.f)
+            od_draw_text(r, x, y, lines[i%3], 0xff000000);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_groups(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    (void) frame;
+    uint32_t count = (uint32_t)(500.f * scale);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        float x = rand_float(0.f, width), y = rand_float(0.f, height);
+        od_begin_group(r, true, 10.f, (i&1) ? 2.f : 0.f);
+        for(uint32_t j=0; j<8; ++j)
+            od_draw_disc(r, x + rand_float(-40.f, 40.f), y + rand_float(-40.f, 40.f), rand_float(5.f, 20.f), rand_color());
+        od_draw_capsule(r, x - 30.f, y, x + 30.f, y + 20.f, 6.f, rand_color());
+        od_end_group(r, 0xff000000);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_clips(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    (void) frame;
+    uint32_t count = (uint32_t)(8000.f * scale);
+    uint32_t num_clips = 250;  // MAX_CLIPS minus the frame clip rect
+    for(uint32_t i=0; i<count; ++i)
+    {
+        if (i % (count / num_clips + 1) == 0)
+        {
+            float x = rand_float(0.f, width), y = rand_float(0.f, height);
+            if ((i/num_clips)&1)
+                od_set_clipdisc(r, x, y, rand_float(50.f, 200.f));
+            else
+                od_set_cliprect(r, x - 150.f, y - 100.f, x + 150.f, y + 100.f);
+        }
+
+        if (i&1)
+            od_draw_box(r, rand_float(0.f, width), rand_float(0.f, height), rand_float(0.f, width), rand_float(0.f, height), 4.f, rand_color());
+        else
+            od_draw_ellipse(r, rand_float(0.f, width), rand_float(0.f, height), rand_float(0.f, width), rand_float(0.f, height), 20.f, rand_color());
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_beziers(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    (void) frame;
+    uint32_t count = (uint32_t)(500.f * scale);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        float points[8];
+        for(uint32_t j=0; j<8; j+=2)
+        {
+            points[j] = rand_float(0.f, width);
+            points[j+1] = rand_float(0.f, height);
+        }
+
+        if (i&1)
+            od_draw_cubic_bezier(r, points, rand_float(1.f, 4.f), rand_color());
+        else
+            od_draw_quadratic_bezier(r, points, rand_float(1.f, 4.f), rand_color());
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// a bit of everything on a 4K viewport
+static void draw_mix(struct onedraw* r, uint32_t width, uint32_t height, float scale, uint32_t frame)
+{
+    draw_discs(r, width, height, scale * .5f, frame);
+    draw_groups(r, width, height, scale * .5f, frame);
+    draw_beziers(r, width, height, scale * .25f, frame);
+
+    uint32_t count = (uint32_t)(2000.f * scale);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        float x = rand_float(0.f, width), y = rand_float(0.f, height);
+        switch(i%4)
+        {
+        case 0 : od_draw_blurred_box(r, x, y, 40.f, 20.f, 10.f, rand_color()); break;
+        case 1 : od_draw_sector(r, x, y, 30.f, rand_float(0.f, 6.f), 2.f, rand_color()); break;
+        case 2 : od_draw_oriented_box(r, x, y, x + 60.f, y + 30.f, 10.f, 2.f, rand_color()); break;
+        default : od_draw_text(r, x, y, "4K", 0xff000000); break;
+        }
+    }
+}
+
+static const scene scenes[] =
+{
+    {"discs", 1920, 1080, draw_discs},
+    {"scatter", 1920, 1080, draw_scatter},
+    {"text", 1920, 1080, draw_text},
+    {"groups", 1920, 1080, draw_groups},
+    {"clips", 1920, 1080, draw_clips},
+    {"beziers", 1920, 1080, draw_beziers},
+    {"4k", 3840, 2160, draw_mix},
+};
+
+#define NUM_SCENES (sizeof(scenes) / sizeof(scenes[0]))
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static result run_scene(const scene* s, uint32_t num_frames, uint32_t num_threads, float scale, bool packed, const char* capture_filename)
+{
+    struct onedraw* renderer = od_init( &(onedraw_def)
+    {
+        .preallocated_buffer = malloc(od_min_memory_size()),
+        .metal_device = NULL,
+        .viewport_width = s->width,
+        .viewport_height = s->height,
+        .packed_draw_data = packed,
+        .cpu.num_threads = num_threads,
+        .stats.window = num_frames
+    });
+
+    uint32_t* pixels = (uint32_t*) malloc(s->width * s->height * sizeof(uint32_t));
+    result res = {.name = s->name, .width = s->width, .height = s->height, .num_frames = num_frames};
+
+    for(uint32_t frame=0; frame<num_frames + WARMUP_FRAMES; ++frame)
+    {
+        g_seed = 0x12345678;
+
+        double start = now_ms();
+        od_begin_frame(renderer);
+        s->draw(renderer, s->width, s->height, scale, frame);
+        double recorded = now_ms();
+        od_end_frame(renderer, pixels);
+        double end = now_ms();
+
+        if (frame < WARMUP_FRAMES)
+        {
+            if (frame + 1 == WARMUP_FRAMES && capture_filename != NULL)
+                od_capture_begin(renderer, capture_filename);
+            continue;
+        }
+
+        od_stats stats;
+        od_get_stats(renderer, &stats);
+
+        res.num_draw_cmd = stats.num_draw_cmd;
+        res.record_ms += recorded - start;
+        res.frame_ms += end - start;
+        res.binning_ms += stats.binning_time_ms;
+        res.raster_ms += stats.raster_time_ms;
+        res.num_nodes += stats.num_nodes;
+        res.num_tiles += stats.num_tiles;
+        res.max_tile_nodes = (stats.max_tile_nodes > res.max_tile_nodes) ? stats.max_tile_nodes : res.max_tile_nodes;
+        res.num_overflow_nodes = (stats.num_overflow_nodes > res.num_overflow_nodes) ? stats.num_overflow_nodes : res.num_overflow_nodes;
+        res.frame_p50_ms = stats.frame_time_p50_ms;
+        res.frame_p95_ms = stats.frame_time_p95_ms;
+        res.frame_p99_ms = stats.frame_time_p99_ms;
+    }
+
+    if (res.num_overflow_nodes > 0)
+        fprintf(stderr, "warning: scene %s dropped up to %u tile nodes per frame\n", s->name, res.num_overflow_nodes);
+
+    res.record_ms /= num_frames;
+    res.frame_ms /= num_frames;
+    res.binning_ms /= num_frames;
+    res.raster_ms /= num_frames;
+    res.num_nodes /= num_frames;
+    res.num_tiles /= num_frames;
+
+    od_capture_end(renderer);
+    od_terminate(renderer);
+    free(renderer);
+    free(pixels);
+    return res;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static inline double ns_per_command(double ms, uint32_t num_draw_cmd) {return (num_draw_cmd) ? ms * 1000000.0 / num_draw_cmd : 0.0;}
+static inline double mpixels_per_second(const result* res) {return (double)res->width * res->height / (res->frame_ms * 1000.0);}
+static inline double mcommands_per_second(const result* res) {return res->num_draw_cmd / (res->frame_ms * 1000.0);}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void print_table(FILE* f, const result* results, uint32_t count)
+{
+    fprintf(f, "%-8s %9s %8s %10s %10s %10s %10s %10s %10s %10s %11s %8s %8s %8s\n", "scene", "viewport", "commands",
+            "record/cmd", "binning", "raster", "frame", "p95", "p99", "nodes", "nodes/cmd", "longest", "Mpix/s", "Mcmd/s");
+
+    for(uint32_t i=0; i<count; ++i)
+    {
+        const result* res = &results[i];
+        char viewport[32];
+        snprintf(viewport, sizeof(viewport), "%ux%u", res->width, res->height);
+        fprintf(f, "%-8s %9s %8u %8.1fns %8.3fms %8.3fms %8.3fms %8.3fms %8.3fms %10.0f %11.2f %8u %8.1f %8.2f\n",
+                res->name, viewport, res->num_draw_cmd, ns_per_command(res->record_ms, res->num_draw_cmd), res->binning_ms,
+                res->raster_ms, res->frame_ms, res->frame_p95_ms, res->frame_p99_ms, res->num_nodes,
+                (res->num_draw_cmd) ? res->num_nodes / res->num_draw_cmd : 0.0, res->max_tile_nodes,
+                mpixels_per_second(res), mcommands_per_second(res));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void print_csv(FILE* f, const result* results, uint32_t count)
+{
+    fprintf(f, "scene,width,height,frames,commands,record_ms,binning_ms,raster_ms,frame_ms,record_ns_per_cmd,"
+               "frame_ns_per_cmd,frame_p50_ms,frame_p95_ms,frame_p99_ms,nodes,tiles,longest_tile_list,overflow_nodes,"
+               "mpixels_per_s,mcommands_per_s\n");
+
+    for(uint32_t i=0; i<count; ++i)
+    {
+        const result* res = &results[i];
+        fprintf(f, "%s,%u,%u,%u,%u,%.4f,%.4f,%.4f,%.4f,%.2f,%.2f,%.4f,%.4f,%.4f,%.0f,%.0f,%u,%u,%.2f,%.4f\n", res->name,
+                res->width, res->height, res->num_frames, res->num_draw_cmd, res->record_ms, res->binning_ms, res->raster_ms,
+                res->frame_ms, ns_per_command(res->record_ms, res->num_draw_cmd), ns_per_command(res->frame_ms, res->num_draw_cmd),
+                res->frame_p50_ms, res->frame_p95_ms, res->frame_p99_ms, res->num_nodes, res->num_tiles, res->max_tile_nodes,
+                res->num_overflow_nodes, mpixels_per_second(res), mcommands_per_second(res));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void print_json(FILE* f, const result* results, uint32_t count, uint32_t num_threads, float scale)
+{
+    fprintf(f, "{\n  \"threads\": %u,\n  \"scale\": %g,\n  \"scenes\": [\n", num_threads, scale);
+    for(uint32_t i=0; i<count; ++i)
+    {
+        const result* res = &results[i];
+        fprintf(f, "    {\"scene\": \"%s\", \"width\": %u, \"height\": %u, \"frames\": %u, \"commands\": %u, "
+                   "\"record_ms\": %.4f, \"binning_ms\": %.4f, \"raster_ms\": %.4f, \"frame_ms\": %.4f, "
+                   "\"record_ns_per_cmd\": %.2f, \"frame_ns_per_cmd\": %.2f, \"frame_p50_ms\": %.4f, \"frame_p95_ms\": %.4f, "
+                   "\"frame_p99_ms\": %.4f, \"nodes\": %.0f, \"tiles\": %.0f, \"longest_tile_list\": %u, \"overflow_nodes\": %u, "
+                   "\"mpixels_per_s\": %.2f, \"mcommands_per_s\": %.4f}%s\n",
+                res->name, res->width, res->height, res->num_frames, res->num_draw_cmd, res->record_ms, res->binning_ms,
+                res->raster_ms, res->frame_ms, ns_per_command(res->record_ms, res->num_draw_cmd),
+                ns_per_command(res->frame_ms, res->num_draw_cmd), res->frame_p50_ms, res->frame_p95_ms, res->frame_p99_ms,
+                res->num_nodes, res->num_tiles, res->max_tile_nodes, res->num_overflow_nodes,
+                mpixels_per_second(res), mcommands_per_second(res), (i + 1 < count) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void usage(void)
+{
+    printf("usage: od_bench [--frames n] [--threads n] [--scale f] [--scene name] [--packed] [--csv | --json] [--output file] [--capture file]\n");
+    printf("scenes :");
+    for(uint32_t i=0; i<NUM_SCENES; ++i)
+        printf(" %s", scenes[i].name);
+    printf("\n");
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    uint32_t num_frames = 20;
+    uint32_t num_threads = 0;
+    float scale = 1.f;
+    const char* scene_name = NULL;
+    const char* output_filename = NULL;
+    const char* capture_filename = NULL;
+    bool packed = false;
+    enum {format_table, format_csv, format_json} format = format_table;
+
+    for(int i=1; i<argc; ++i)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i+1 < argc)
+            num_frames = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i+1 < argc)
+            num_threads = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--scale") == 0 && i+1 < argc)
+            scale = (float) atof(argv[++i]);
+        else if (strcmp(argv[i], "--scene") == 0 && i+1 < argc)
+            scene_name = argv[++i];
+        else if (strcmp(argv[i], "--output") == 0 && i+1 < argc)
+            output_filename = argv[++i];
+        else if (strcmp(argv[i], "--capture") == 0 && i+1 < argc)
+            capture_filename = argv[++i];
+        else if (strcmp(argv[i], "--packed") == 0)
+            packed = true;
+        else if (strcmp(argv[i], "--csv") == 0)
+            format = format_csv;
+        else if (strcmp(argv[i], "--json") == 0)
+            format = format_json;
+        else
+        {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (num_frames == 0)
+        num_frames = 1;
+
+    if (capture_filename != NULL && scene_name == NULL)
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    result results[NUM_SCENES];
+    uint32_t count = 0;
+    for(uint32_t i=0; i<NUM_SCENES; ++i)
+        if (scene_name == NULL || strcmp(scene_name, scenes[i].name) == 0)
+            results[count++] = run_scene(&scenes[i], num_frames, num_threads, scale, packed, capture_filename);
+
+    if (count == 0)
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    FILE* f = stdout;
+    if (output_filename != NULL && (f = fopen(output_filename, "w")) == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", output_filename);
+        return EXIT_FAILURE;
+    }
+
+    switch(format)
+    {
+    case format_csv : print_csv(f, results, count); break;
+    case format_json : print_json(f, results, count, num_threads, scale); break;
+    default : print_table(f, results, count); break;
+    }
+
+    if (f != stdout)
+        fclose(f);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1305 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "../lib/onedraw.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// od_golden : golden-image regression tests on the cpu backend
+//
+//      od_golden [--reference-dir dir] [--output-dir dir] [--tolerance n] [--scene name] [--font file] [--packed] [--wide]
+//                [--grow] [--incremental] [--update]
+//
+//      * renders a catalog of scenes and compares them to the reference images (run-length encoded tga)
+//      * a pixel fails if one of its channels differs by more than [tolerance] (default 2)
+//      * failing scenes write <scene>_actual.tga and <scene>_diff.tga (failing pixels in red) in the output dir
+//      * --packed renders with onedraw_def.packed_draw_data against the same references, the positions are quantized to
+//        1/8 pixel so edges and texel boundaries move a bit : 1% of the pixels can exceed the tolerance
+//      * --wide renders with onedraw_def.wide_aabb against the same references, then draws the same shapes in the top-left
+//        and bottom-right corners of a 7680x4320 viewport and compares both blocks
+//      * --grow starts with tiny onedraw_def.limits so the scenes make the buffers grow, then renders 80k commands (several
+//        binning passes) and compares them to the same scene rendered band by band, each band in a single pass, the tile
+//        heatmap of the frame must be the sum of the heatmaps of the bands
+//      * --incremental renders with onedraw_def.cpu.incremental, every scene in the same buffer, then renders frames where
+//        a disc moves, a box disappears (its tiles become empty), nothing changes and the buffer is overwritten before
+//        od_force_full_redraw() : each frame must match a full redraw and rasterize the expected tiles
+//      * --font loads a truetype font with od_load_font(), renders the font scene after filling the atlas with a retained
+//        list freed before the reference frame (some glyphs are evicted), draws a label once the atlas is full and checks
+//        it gets its glyphs when there is room again, then restores the built-in font and checks the text scene again
+//      * the occlusion scene is also rendered with od_set_occlusion_culling(false), the pixels must be identical
+//      * batches draws discs, boxes (sharp and in a group), capsules and quads with the batched functions and with the
+//        single ones, including entries off-screen or degenerated, the pixels must be identical
+//      * text_cache draws more labels than a small text layout cache holds, then a few of them and a string too large for
+//        the cache, it checks the hit and miss counters and compares the frames with a renderer that caches nothing
+//      * text_scaled draws the built-in font at several heights (od_load_font with a NULL font), one per band of the image
+//      * --update overwrites the references with the current output (cmake --build . --target golden_update)
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define WIDTH (320)
+#define HEIGHT (240)
+#define ATLAS_SIZE (64)
+#define WIDE_WIDTH (7680)
+#define WIDE_HEIGHT (4320)
+#define BLOCK_SIZE (128)
+#define MULTIPASS_WIDTH (1280)
+#define MULTIPASS_HEIGHT (1024)
+#define MULTIPASS_BANDS (4)
+#define PATH_SIZE (1024)
+#define FONT_HEIGHT (24.f)
+#define FONT_WARMUP_FRAMES (4)
+#define FONT_FULL_LABEL "← ↑ → ↓ ∞ ≈ ≠ ≤ ≥"   // glyphs drawn for the first time once the atlas is full
+#define INCREMENTAL_FRAMES (6)
+#define TEXT_CACHE_LABELS (24)
+#define TEXT_CACHE_SIZE (2048)      // about 11 labels
+#define BATCH_DISCS (13)            // not multiples of the simd width
+#define BATCH_BOXES (11)
+#define BATCH_GROUP_BOXES (6)
+#define BATCH_CAPSULES (10)
+#define BATCH_QUADS (9)
+
+typedef struct golden_options
+{
+    const char* reference_dir;
+    const char* output_dir;
+    const char* font_file;
+    uint32_t tolerance;
+    int update;
+    bool packed;
+} golden_options;
+
+typedef struct scene
+{
+    const char* name;
+    void (*draw)(struct onedraw* r);
+} scene;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// tga with run-length encoding, the pixels are B8G8R8A8
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static int write_tga_rle(const char* filename, const uint32_t* pixels, uint32_t width, uint32_t height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return 0;
+
+    uint8_t header[18] = {0};
+    header[2] = 10;                     // run-length encoded true-color
+    header[12] = width & 0xff;
+    header[13] = (width >> 8) & 0xff;
+    header[14] = height & 0xff;
+    header[15] = (height >> 8) & 0xff;
+    header[16] = 32;
+    header[17] = 0x28;                  // top-left origin, 8 bits alpha
+    fwrite(header, sizeof(header), 1, f);
+
+    // packets don't cross scanlines
+    for(uint32_t y=0; y<height; ++y)
+    {
+        const uint32_t* row = &pixels[y * width];
+        uint32_t x = 0;
+        while (x < width)
+        {
+            uint32_t run = 1;
+            while (x + run < width && run < 128 && row[x + run] == row[x])
+                run++;
+
+            if (run > 1)
+            {
+                uint8_t packet = (uint8_t)(0x80 | (run - 1));
+                fwrite(&packet, 1, 1, f);
+                fwrite(&row[x], sizeof(uint32_t), 1, f);
+            }
+            else
+            {
+                // raw packet until the next run of at least 2 pixels
+                run = 1;
+                while (x + run < width && run < 128 && (x + run + 1 >= width || row[x + run] != row[x + run + 1]))
+                    run++;
+
+                uint8_t packet = (uint8_t)(run - 1);
+                fwrite(&packet, 1, 1, f);
+                fwrite(&row[x], sizeof(uint32_t), run, f);
+            }
+            x += run;
+        }
+    }
+
+    fclose(f);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// reads an uncompressed or run-length encoded 32 bits tga, returns NULL on failure
+static uint32_t* read_tga(const char* filename, uint32_t* width, uint32_t* height)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return NULL;
+
+    uint8_t header[18];
+    if (fread(header, sizeof(header), 1, f) != 1 || (header[2] != 2 && header[2] != 10) || header[16] != 32)
+    {
+        fclose(f);
+        return NULL;
+    }
+
+    fseek(f, header[0], SEEK_CUR);     // image id
+    *width = header[12] | (header[13] << 8);
+    *height = header[14] | (header[15] << 8);
+    uint32_t count = (*width) * (*height);
+    uint32_t* pixels = (uint32_t*) malloc(count * sizeof(uint32_t));
+
+    uint32_t index = 0;
+    if (header[2] == 2)
+        index = (uint32_t) fread(pixels, sizeof(uint32_t), count, f);
+    else
+    {
+        uint8_t packet;
+        while (index < count && fread(&packet, 1, 1, f) == 1)
+        {
+            uint32_t run = (packet & 0x7f) + 1;
+            if (index + run > count)
+                break;
+
+            if (packet & 0x80)
+            {
+                uint32_t pixel;
+                if (fread(&pixel, sizeof(uint32_t), 1, f) != 1)
+                    break;
+                for(uint32_t i=0; i<run; ++i)
+                    pixels[index++] = pixel;
+            }
+            else
+            {
+                if (fread(&pixels[index], sizeof(uint32_t), run, f) != run)
+                    break;
+                index += run;
+            }
+        }
+    }
+    fclose(f);
+
+    // bottom-left origin
+    if (!(header[17] & 0x20))
+    {
+        for(uint32_t y=0; y<(*height)/2; ++y)
+            for(uint32_t x=0; x<*width; ++x)
+            {
+                uint32_t tmp = pixels[y * (*width) + x];
+                pixels[y * (*width) + x] = pixels[((*height) - 1 - y) * (*width) + x];
+                pixels[((*height) - 1 - y) * (*width) + x] = tmp;
+            }
+    }
+
+    if (index != count)
+    {
+        free(pixels);
+        return NULL;
+    }
+    return pixels;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// scenes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_discs(struct onedraw* r)
+{
+    od_draw_disc(r, 60.f, 60.f, 40.f, 0xff3040e0);
+    od_draw_ring(r, 160.f, 60.f, 40.f, 6.f, 0xff208020);
+    od_draw_disc_gradient(r, 260.f, 60.f, 40.f, 0xffe07030, 0xff30e0e0);
+    od_draw_disc(r, 60.f, 170.f, 2.f, 0xff000000);
+    od_draw_disc(r, 80.f, 170.f, .75f, 0xff000000);
+    od_draw_ring(r, 160.f, 170.f, 50.f, 1.f, 0x80ff0000);
+    od_draw_disc(r, 260.f, 170.f, 45.f, 0x800000ff);
+    od_draw_disc(r, 280.f, 190.f, 45.f, 0x8000ff00);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_boxes(struct onedraw* r)
+{
+    od_draw_box(r, 10.f, 10.f, 90.f, 70.f, 0.f, 0xff808080);
+    od_draw_box(r, 110.f, 10.f, 190.f, 70.f, 15.f, 0xff404080);
+    od_draw_blurred_box(r, 260.f, 40.f, 40.f, 25.f, 12.f, 0xff000000);
+    od_draw_oriented_box(r, 20.f, 100.f, 90.f, 150.f, 20.f, 4.f, 0xff30a030);
+    od_draw_oriented_rect(r, 120.f, 100.f, 190.f, 150.f, 30.f, 2.f, 3.f, 0xffa03030);
+    od_draw_line(r, 220.f, 100.f, 300.f, 140.f, 3.f, 0xff000000);
+    od_draw_capsule(r, 30.f, 200.f, 130.f, 180.f, 12.f, 0xff2080e0);
+    od_draw_capsule_gradient(r, 170.f, 210.f, 300.f, 180.f, 15.f, 0xffe02080, 0xff20e0e0);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_ellipses_triangles(struct onedraw* r)
+{
+    od_draw_ellipse(r, 20.f, 60.f, 140.f, 60.f, 60.f, 0xffa030a0);
+    od_draw_ellipse_ring(r, 180.f, 20.f, 300.f, 100.f, 40.f, 3.f, 0xff3030a0);
+
+    const float triangle[6] = {20.f, 220.f, 60.f, 130.f, 110.f, 210.f};
+    const float rounded[6] = {130.f, 220.f, 170.f, 140.f, 210.f, 220.f};
+    const float ring[6] = {230.f, 140.f, 310.f, 150.f, 260.f, 225.f};
+    od_draw_triangle(r, triangle, 0.f, 0xff20a0a0);
+    od_draw_triangle(r, rounded, 8.f, 0xffa0a020);
+    od_draw_triangle_ring(r, ring, 0.f, 4.f, 0xff2020a0);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_sectors(struct onedraw* r)
+{
+    od_draw_sector(r, 60.f, 60.f, 45.f, 0.f, 2.5f, 0xff2080e0);
+    od_draw_sector(r, 160.f, 60.f, 45.f, 1.f, 5.f, 0xffe08020);
+    od_draw_sector_ring(r, 260.f, 60.f, 45.f, 0.5f, 3.f, 4.f, 0xff208020);
+    od_draw_arc(r, 80.f, 170.f, 0.f, -1.f, 1.2f, 50.f, 8.f, 0xff800080);
+    od_draw_arc(r, 230.f, 170.f, 0.7071f, 0.7071f, 2.5f, 45.f, 3.f, 0xff008080);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_quads(struct onedraw* r)
+{
+    od_draw_quad(r, 10.f, 10.f, 140.f, 110.f, (od_quad_uv) {0.f, 0.f, 1.f, 1.f}, 0, 0xffffffff);
+    od_draw_quad(r, 170.f, 10.f, 300.f, 110.f, (od_quad_uv) {.25f, .25f, .75f, .75f}, 1, 0xff80ff80);
+    od_draw_oriented_quad(r, 80.f, 180.f, 100.f, 60.f, .5f, (od_quad_uv) {0.f, 0.f, 1.f, 1.f}, 1, 0xffffffff);
+    od_draw_oriented_quad(r, 240.f, 180.f, 80.f, 80.f, -1.f, (od_quad_uv) {0.f, 0.f, 1.f, 1.f}, 0, 0x80ffffff);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_groups(struct onedraw* r)
+{
+    // smoothmin with outline
+    od_begin_group(r, true, 20.f, 3.f);
+    od_draw_disc(r, 50.f, 60.f, 35.f, 0xff4060ff);
+    od_draw_disc(r, 110.f, 60.f, 35.f, 0xffff6040);
+    od_end_group(r, 0xff000000);
+
+    // smoothmin without outline
+    od_begin_group(r, true, 15.f, 0.f);
+    od_draw_box(r, 170.f, 30.f, 230.f, 90.f, 0.f, 0xff40a040);
+    od_draw_disc(r, 260.f, 60.f, 30.f, 0xffa040a0);
+    od_end_group(r, 0);
+
+    // union with outline
+    od_begin_group(r, false, 0.f, 2.f);
+    od_draw_capsule(r, 30.f, 180.f, 130.f, 150.f, 15.f, 0xff20c0c0);
+    od_draw_sector(r, 90.f, 190.f, 40.f, 0.f, 2.f, 0xffc0c020);
+    od_end_group(r, 0xff2020ff);
+
+    // translucent group
+    od_begin_group(r, true, 10.f, 0.f);
+    od_draw_ellipse(r, 180.f, 180.f, 300.f, 180.f, 40.f, 0x80ff0000);
+    od_draw_ellipse(r, 240.f, 130.f, 240.f, 230.f, 40.f, 0x800000ff);
+    od_end_group(r, 0);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_clips(struct onedraw* r)
+{
+    od_set_cliprect(r, 20.f, 20.f, 140.f, 100.f);
+    od_draw_disc(r, 80.f, 60.f, 60.f, 0xff404040);
+    od_draw_box(r, 0.f, 50.f, 320.f, 70.f, 0.f, 0xff2020a0);
+
+    od_set_clipdisc(r, 240.f, 60.f, 45.f);
+    od_draw_box(r, 180.f, 0.f, 300.f, 120.f, 0.f, 0xff20a020);
+    od_draw_text(r, 190.f, 50.f, "clipped text", 0xffffffff);
+
+    // group partially clipped
+    od_set_cliprect(r, 40.f, 140.f, 280.f, 200.f);
+    od_begin_group(r, true, 20.f, 3.f);
+    od_draw_disc(r, 120.f, 170.f, 45.f, 0xff4060ff);
+    od_draw_disc(r, 200.f, 170.f, 45.f, 0xffff6040);
+    od_end_group(r, 0xff000000);
+
+    od_set_cliprect(r, 0.f, 0.f, WIDTH, HEIGHT);
+    od_draw_ring(r, 160.f, 120.f, 110.f, 1.f, 0xff000000);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_text(struct onedraw* r)
+{
+    float height = od_text_height(r);
+    od_draw_text(r, 4.f, 0.f, "The quick brown fox\njumps over the lazy dog", 0xff000000);
+    od_draw_text(r, 4.f, height * 2.f, "0123456789 {[(<+-*/=>)]}", 0xff2020c0);
+    od_draw_text(r, 4.f, height * 3.f, "!?#$%&@ ~^_|;:,. \"'`\\", 0xffc02020);
+    od_draw_box(r, 0.f, height * 4.f, WIDTH, HEIGHT, 0.f, 0xff202020);
+    od_draw_text(r, 4.f, height * 4.f, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 0xffffffff);
+    od_draw_text(r, 4.f, height * 5.f, "abcdefghijklmnopqrstuvwxyz", 0xffe0e0e0);
+
+    float x = 4.f;
+    for(char c='a'; c<='m'; ++c, x += 24.f)
+        od_draw_char(r, x, height * 6.f, c, 0xff40c0ff);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void draw_beziers(struct onedraw* r)
+{
+    const float quadratic[6] = {20.f, 100.f, 80.f, 0.f, 140.f, 100.f};
+    const float cubic[8] = {170.f, 100.f, 190.f, 0.f, 280.f, 200.f, 300.f, 40.f};
+    const float loop[8] = {40.f, 220.f, 280.f, 120.f, 40.f, 120.f, 280.f, 220.f};
+    od_draw_quadratic_bezier(r, quadratic, 4.f, 0xffc04020);
+    od_draw_cubic_bezier(r, cubic, 2.f, 0xff2040c0);
+    od_draw_cubic_bezier(r, loop, 1.f, 0xff000000);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// a widget recorded once and submitted at several positions, fractional offsets and under a clip rect
+static void draw_lists(struct onedraw* r)
+{
+    od_list_begin(r);
+    od_draw_box(r, 0.f, 0.f, 140.f, 70.f, 8.f, 0xff303030);
+    od_draw_ring(r, 30.f, 35.f, 20.f, 3.f, 0xff40c0ff);
+    od_begin_group(r, true, 6.f, 1.5f);
+    od_draw_disc(r, 80.f, 35.f, 14.f, 0xff40ff40);
+    od_draw_capsule(r, 90.f, 20.f, 125.f, 50.f, 6.f, 0xff40ff40);
+    od_end_group(r, 0xff000000);
+    od_draw_text(r, 6.f, 52.f, "list", 0xffffffff);
+    struct od_list* list = od_list_end(r);
+
+    od_list_submit(r, list, 10.f, 10.f);
+    od_list_submit(r, list, 170.25f, 15.5f);
+    od_set_cliprect(r, 0.f, 120.f, 120.f, HEIGHT);
+    od_list_submit(r, list, 40.f, 140.f);
+    od_set_cliprect(r, 0.f, 0.f, WIDTH, HEIGHT);
+    od_list_submit(r, list, 200.f, 200.f);
+    od_list_free(list);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// two contexts ended in reverse order, with their own clip shapes, merged after the renderer commands
+static struct od_context* contexts[2];
+
+static void draw_contexts(struct onedraw* r)
+{
+    od_draw_box(r, 20.f, 20.f, 300.f, 220.f, 12.f, 0xff404040);
+
+    struct onedraw* c = od_context_begin(contexts[0], 2);
+    od_set_clipdisc(c, 160.f, 120.f, 70.f);
+    od_draw_box(c, 60.f, 60.f, 260.f, 180.f, 0.f, 0xff20c020);
+    od_context_end(contexts[0]);
+
+    c = od_context_begin(contexts[1], 1);
+    od_set_cliprect(c, 40.f, 40.f, 280.f, 200.f);
+    od_draw_disc(c, 160.f, 120.f, 110.f, 0xffc02020);
+    od_set_cliprect(c, 0.f, 0.f, WIDTH, HEIGHT);
+    od_draw_text(c, 30.f, 200.f, "context", 0xffffffff);
+    od_context_end(contexts[1]);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// stacked opaque panels hiding shapes and a group, a clipped occluder and a transparent quad that hides nothing
+static void draw_occlusion(struct onedraw* r)
+{
+    od_draw_disc(r, 60.f, 60.f, 40.f, 0xffc02020);
+    od_begin_group(r, true, 8.f, 2.f);
+    od_draw_disc(r, 120.f, 80.f, 20.f, 0xff2020c0);
+    od_draw_disc(r, 150.f, 80.f, 20.f, 0xff2020c0);
+    od_end_group(r, 0xff000000);
+    od_draw_box(r, 10.f, 10.f, 200.f, 150.f, 0.f, 0xff404040);
+
+    od_draw_text(r, 20.f, 20.f, "hidden text", 0xffffffff);
+    od_set_cliprect(r, 100.f, 50.f, 260.f, 200.f);
+    od_draw_box(r, 0.f, 0.f, WIDTH, HEIGHT, 0.f, 0xff20a020);
+    od_set_cliprect(r, 0.f, 0.f, WIDTH, HEIGHT);
+
+    od_draw_disc(r, 250.f, 180.f, 40.f, 0xffc0c020);
+    od_draw_quad(r, 220.f, 150.f, 300.f, 230.f, (od_quad_uv) {0.f, 0.f, 1.f, 1.f}, 1, 0xffffffff);
+    od_draw_box(r, 30.f, 170.f, 120.f, 230.f, 0.f, 0x80ff00ff);
+
+    // opaque texture over opaque boxes : the half texel border of the magnified texels and the uv outside of the texture
+    // are transparent, the boxes must not be culled there
+    od_draw_quad(r, 14.f, 14.f, 94.f, 94.f, (od_quad_uv) {0.f, 0.f, .0625f, .0625f}, 0, 0xffffffff);
+    od_draw_box(r, 262.f, 4.f, 318.f, 136.f, 0.f, 0xff8040a0);
+    od_draw_quad(r, 266.f, 8.f, 314.f, 64.f, (od_quad_uv) {0.f, 0.f, 1.f, 1.f}, 0, 0xffffffff);
+    od_draw_quad(r, 266.f, 72.f, 314.f, 132.f, (od_quad_uv) {0.f, 0.f, 2.f, 2.f}, 0, 0xffffffff);
+}
+
+static const scene scenes[] =
+{
+    {"discs", draw_discs},
+    {"boxes", draw_boxes},
+    {"ellipses_triangles", draw_ellipses_triangles},
+    {"sectors", draw_sectors},
+    {"quads", draw_quads},
+    {"groups", draw_groups},
+    {"clips", draw_clips},
+    {"text", draw_text},
+    {"beziers", draw_beziers},
+    {"lists", draw_lists},
+    {"contexts", draw_contexts},
+};
+
+#define NUM_SCENES (sizeof(scenes) / sizeof(scenes[0]))
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// two procedural slices : a checkerboard and a gradient with alpha
+static void upload_atlas(struct onedraw* r)
+{
+    uint32_t pixels[ATLAS_SIZE * ATLAS_SIZE];
+    for(uint32_t y=0; y<ATLAS_SIZE; ++y)
+        for(uint32_t x=0; x<ATLAS_SIZE; ++x)
+            pixels[y * ATLAS_SIZE + x] = (((x / 8) + (y / 8)) & 1) ? 0xffffffff : 0xff2060c0;
+    od_upload_slice(r, pixels, 0);
+
+    for(uint32_t y=0; y<ATLAS_SIZE; ++y)
+        for(uint32_t x=0; x<ATLAS_SIZE; ++x)
+            pixels[y * ATLAS_SIZE + x] = ((x * 4) << 24) | ((y * 4) << 16) | (128 << 8) | (255 - x * 4);
+    od_upload_slice(r, pixels, 1);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// returns the number of failing pixels, fills the diff image
+static uint32_t compare_images(const uint32_t* reference, const uint32_t* actual, uint32_t* diff, uint32_t count, uint32_t tolerance)
+{
+    uint32_t num_failures = 0;
+    for(uint32_t i=0; i<count; ++i)
+    {
+        uint32_t max_delta = 0;
+        for(uint32_t shift=0; shift<32; shift+=8)
+        {
+            int32_t a = (int32_t)((reference[i] >> shift) & 0xff);
+            int32_t b = (int32_t)((actual[i] >> shift) & 0xff);
+            uint32_t delta = (uint32_t) abs(a - b);
+            max_delta = (delta > max_delta) ? delta : max_delta;
+        }
+
+        if (max_delta > tolerance)
+        {
+            diff[i] = 0xffff0000;
+            num_failures++;
+        }
+        else
+        {
+            // dimmed reference
+            uint32_t luma = (((reference[i] >> 16) & 0xff) + ((reference[i] >> 8) & 0xff) + (reference[i] & 0xff)) / 12;
+            diff[i] = 0xff000000 | (luma << 16) | (luma << 8) | luma;
+        }
+    }
+    return num_failures;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// a few shapes in a BLOCK_SIZE square, drawn at both ends of the wide viewport
+static void draw_wide_block(struct onedraw* r, float x, float y)
+{
+    od_draw_box(r, x + 8.f, y + 8.f, x + 120.f, y + 56.f, 8.f, 0xff4080c0);
+    od_begin_group(r, true, 10.f, 2.f);
+    od_draw_disc(r, x + 30.f, y + 90.f, 22.f, 0xffc04040);
+    od_draw_disc(r, x + 70.f, y + 90.f, 22.f, 0xff40c040);
+    od_end_group(r, 0xff000000);
+    od_set_cliprect(r, x + 96.f, y + 64.f, x + 128.f, y + 128.f);
+    od_draw_disc(r, x + 100.f, y + 96.f, 24.f, 0xff2020a0);
+    od_set_cliprect(r, 0.f, 0.f, WIDE_WIDTH, WIDE_HEIGHT);
+    od_draw_text(r, x + 12.f, y + 12.f, "8K", 0xffffffff);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the bottom-right block has tile coordinates above 255 and tile indices above 65535, it must match the top-left one
+static uint32_t check_wide_viewport(struct onedraw* r, uint32_t tolerance)
+{
+    uint32_t* pixels = (uint32_t*) malloc((size_t)WIDE_WIDTH * WIDE_HEIGHT * sizeof(uint32_t));
+    uint32_t top_left[BLOCK_SIZE * BLOCK_SIZE], bottom_right[BLOCK_SIZE * BLOCK_SIZE], diff[BLOCK_SIZE * BLOCK_SIZE];
+    const uint32_t x = WIDE_WIDTH - BLOCK_SIZE, y = WIDE_HEIGHT - BLOCK_SIZE;
+
+    od_resize(r, WIDE_WIDTH, WIDE_HEIGHT);
+    od_begin_frame(r);
+    draw_wide_block(r, 0.f, 0.f);
+    draw_wide_block(r, (float)x, (float)y);
+    od_end_frame(r, pixels);
+    od_resize(r, WIDTH, HEIGHT);
+
+    for(uint32_t row=0; row<BLOCK_SIZE; ++row)
+    {
+        memcpy(&top_left[row * BLOCK_SIZE], &pixels[(size_t)row * WIDE_WIDTH], BLOCK_SIZE * sizeof(uint32_t));
+        memcpy(&bottom_right[row * BLOCK_SIZE], &pixels[(size_t)(y + row) * WIDE_WIDTH + x], BLOCK_SIZE * sizeof(uint32_t));
+    }
+    free(pixels);
+
+    uint32_t num_failures = compare_images(top_left, bottom_right, diff, BLOCK_SIZE * BLOCK_SIZE, tolerance);
+    if (num_failures == 0)
+        printf("%-20s ok\n", "wide_viewport");
+    else
+        printf("%-20s FAILED : %u pixels differ by more than %u\n", "wide_viewport", num_failures, tolerance);
+    return num_failures;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4x4 boxes over the whole viewport, a group across the end of the first binning pass and a translucent box over everything
+static void draw_multipass_scene(struct onedraw* r)
+{
+    const uint32_t columns = MULTIPASS_WIDTH / 4;
+    for(uint32_t i=0; i<columns * (MULTIPASS_HEIGHT / 4); ++i)
+    {
+        if (i == 65533)
+        {
+            od_begin_group(r, true, 8.f, 2.f);
+            od_draw_disc(r, 600.f, 300.f, 30.f, 0xffc04040);
+            od_draw_disc(r, 640.f, 300.f, 30.f, 0xff40c040);
+            od_end_group(r, 0xff000000);
+        }
+
+        float x = (float)(i % columns) * 4.f, y = (float)(i / columns) * 4.f;
+        od_draw_box(r, x, y, x + 4.f, y + 4.f, 0.f, 0xff000000 | ((i * 2654435761u) >> 8));
+    }
+    od_draw_box(r, 100.f, 100.f, MULTIPASS_WIDTH - 100.f, MULTIPASS_HEIGHT - 100.f, 20.f, 0x80ffffff);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the frame is binned in several passes, the reference clips the scene to one band at a time : the commands outside of the
+// band are rejected when recorded and each band fits in a single pass
+static uint32_t check_multipass(struct onedraw* r, uint32_t tolerance)
+{
+    const size_t num_pixels = (size_t)MULTIPASS_WIDTH * MULTIPASS_HEIGHT;
+    uint32_t* pixels = (uint32_t*) malloc(num_pixels * sizeof(uint32_t));
+    uint32_t* reference = (uint32_t*) malloc(num_pixels * sizeof(uint32_t));
+    uint32_t* band = (uint32_t*) malloc(num_pixels * sizeof(uint32_t));
+    uint32_t* diff = (uint32_t*) malloc(num_pixels * sizeof(uint32_t));
+    const uint32_t band_height = MULTIPASS_HEIGHT / MULTIPASS_BANDS;
+
+    od_resize(r, MULTIPASS_WIDTH, MULTIPASS_HEIGHT);
+    od_begin_frame(r);
+    draw_multipass_scene(r);
+    od_end_frame(r, pixels);
+
+    od_stats stats;
+    od_get_stats(r, &stats);
+    const uint32_t num_passes = stats.num_binning_passes;
+    bool single_pass_bands = true;
+
+    // the heatmap of the frame sums all its passes, it must match the sum of the heatmaps of the bands
+    uint32_t tiles_width, tiles_height;
+    od_get_tile_dimensions(r, &tiles_width, &tiles_height);
+    const uint32_t num_tiles = tiles_width * tiles_height;
+    float* lengths = (float*) malloc(num_tiles * sizeof(float));
+    float* band_lengths = (float*) malloc(num_tiles * sizeof(float));
+    float* sum_lengths = (float*) calloc(num_tiles, sizeof(float));
+    bool heatmap_ok = od_get_tile_heatmap(r, lengths, NULL);
+
+    for(uint32_t i=0; i<MULTIPASS_BANDS; ++i)
+    {
+        od_begin_frame(r);
+        od_set_cliprect(r, 0.f, (float)(i * band_height), MULTIPASS_WIDTH, (float)((i + 1) * band_height));
+        draw_multipass_scene(r);
+        od_end_frame(r, band);
+        od_get_stats(r, &stats);
+        single_pass_bands = single_pass_bands && (stats.num_binning_passes == 1);
+        od_get_tile_heatmap(r, band_lengths, NULL);
+        for(uint32_t j=0; j<num_tiles; ++j)
+            sum_lengths[j] += band_lengths[j];
+        memcpy(&reference[(size_t)i * band_height * MULTIPASS_WIDTH], &band[(size_t)i * band_height * MULTIPASS_WIDTH],
+               (size_t)band_height * MULTIPASS_WIDTH * sizeof(uint32_t));
+    }
+    od_resize(r, WIDTH, HEIGHT);
+
+    // the antialiasing of the boxes on the edge of a band reaches the tiles of the next band, except with the cliprect
+    const uint32_t band_rows = tiles_height / MULTIPASS_BANDS;
+    uint32_t num_heatmap_failures = 0;
+    for(uint32_t i=0; i<num_tiles; ++i)
+    {
+        uint32_t row = i / tiles_width;
+        bool band_edge = (row % band_rows == 0 && row != 0) || (row % band_rows == band_rows - 1 && row != tiles_height - 1);
+        num_heatmap_failures += (!band_edge && lengths[i] != sum_lengths[i]) ? 1 : 0;
+    }
+    heatmap_ok = heatmap_ok && (num_heatmap_failures == 0);
+
+    uint32_t num_failures = compare_images(reference, pixels, diff, (uint32_t)num_pixels, tolerance);
+    const bool passes_ok = (num_passes > 1) && single_pass_bands;
+    if (!passes_ok)
+        printf("%-20s FAILED : %u binning passes for the frame, expected several and one per band\n", "multipass", num_passes);
+    else if (!heatmap_ok)
+        printf("%-20s FAILED : %u tiles of the heatmap differ from the bands\n", "multipass", num_heatmap_failures);
+    else if (num_failures == 0)
+        printf("%-20s ok (%u passes)\n", "multipass", num_passes);
+    else
+        printf("%-20s FAILED : %u pixels differ by more than %u\n", "multipass", num_failures, tolerance);
+
+    free(pixels);
+    free(reference);
+    free(band);
+    free(diff);
+    free(lengths);
+    free(band_lengths);
+    free(sum_lengths);
+    return (passes_ok && heatmap_ok) ? num_failures : 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the sectors scene with a disc moving during the first frames and a box in an empty area removed at frame 3
+static void draw_incremental_frame(struct onedraw* r, uint32_t frame)
+{
+    draw_sectors(r);
+    od_draw_disc(r, 40.f + (float)((frame < 2) ? frame : 2) * 30.f, 120.f, 10.f, 0xffc02020);
+    if (frame < 3)
+        od_draw_box(r, 292.f, 116.f, 316.f, 156.f, 0.f, 0xff20a040);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// [r] was created with onedraw_def.cpu.incremental, each frame is compared with a renderer that redraws everything
+static uint32_t check_incremental(struct onedraw* r, uint32_t tolerance)
+{
+    struct onedraw* full = od_init( &(onedraw_def)
+    {
+        .preallocated_buffer = malloc(od_min_memory_size()),
+        .metal_device = NULL,
+        .viewport_width = WIDTH,
+        .viewport_height = HEIGHT
+    });
+
+    uint32_t* pixels = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t* reference = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t* diff = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t tiles_width, tiles_height;
+    od_get_tile_dimensions(r, &tiles_width, &tiles_height);
+    const uint32_t num_tiles = tiles_width * tiles_height;
+    uint32_t num_failed = 0;
+
+    for(uint32_t frame=0; frame<INCREMENTAL_FRAMES && num_failed == 0; ++frame)
+    {
+        // the last frame overwrites the buffer outside of the library
+        const bool force_full_redraw = (frame == INCREMENTAL_FRAMES - 1);
+        if (force_full_redraw)
+        {
+            for(uint32_t i=0; i<WIDTH * HEIGHT; ++i)
+                pixels[i] = 0xffff00ff;
+            od_force_full_redraw(r);
+        }
+
+        od_set_clear_color(r, 0xffe0f0ff);
+        od_begin_frame(r);
+        draw_incremental_frame(r, frame);
+        od_end_frame(r, pixels);
+
+        od_set_clear_color(full, 0xffe0f0ff);
+        od_begin_frame(full);
+        draw_incremental_frame(full, frame);
+        od_end_frame(full, reference);
+
+        // first frame (new buffer) and forced redraw : every tile, frame 4 : nothing changed, otherwise some tiles
+        od_stats stats;
+        od_get_stats(r, &stats);
+        bool tiles_ok;
+        if (frame == 0 || force_full_redraw)
+            tiles_ok = (stats.num_changed_tiles == num_tiles);
+        else if (frame == 4)
+            tiles_ok = (stats.num_changed_tiles == 0);
+        else
+            tiles_ok = (stats.num_changed_tiles > 0 && stats.num_changed_tiles < num_tiles);
+
+        uint32_t num_failures = compare_images(reference, pixels, diff, WIDTH * HEIGHT, tolerance);
+        if (!tiles_ok)
+            printf("%-20s FAILED : frame %u rasterized %u tiles out of %u\n", "incremental", frame, stats.num_changed_tiles, num_tiles);
+        else if (num_failures != 0)
+            printf("%-20s FAILED : frame %u, %u pixels differ by more than %u\n", "incremental", frame, num_failures, tolerance);
+        num_failed += (!tiles_ok || num_failures != 0) ? 1 : 0;
+    }
+
+    if (num_failed == 0)
+        printf("%-20s ok (%u frames)\n", "incremental", INCREMENTAL_FRAMES);
+
+    od_terminate(full);
+    free(full);
+    free(pixels);
+    free(reference);
+    free(diff);
+    return num_failed;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// compares [pixels] with the reference image [name], or overwrites the reference with --update, returns 1 on failure
+static uint32_t check_image(const golden_options* o, const char* name, const uint32_t* pixels, uint32_t* diff)
+{
+    char path[PATH_SIZE];
+    snprintf(path, PATH_SIZE, "%s/%s.tga", o->reference_dir, name);
+
+    if (o->update)
+    {
+        if (write_tga_rle(path, pixels, WIDTH, HEIGHT))
+        {
+            printf("%-20s updated\n", name);
+            return 0;
+        }
+        printf("%-20s can't write %s\n", name, path);
+        return 1;
+    }
+
+    uint32_t width, height;
+    uint32_t* reference = read_tga(path, &width, &height);
+    if (reference == NULL || width != WIDTH || height != HEIGHT)
+    {
+        printf("%-20s FAILED : can't read %s (run with --update to create it)\n", name, path);
+        free(reference);
+        return 1;
+    }
+
+    uint32_t num_failures = compare_images(reference, pixels, diff, WIDTH * HEIGHT, o->tolerance);
+    free(reference);
+    if (num_failures == 0 || (o->packed && num_failures <= WIDTH * HEIGHT / 100))
+    {
+        printf("%-20s ok\n", name);
+        return 0;
+    }
+
+    printf("%-20s FAILED : %u pixels differ by more than %u\n", name, num_failures, o->tolerance);
+    snprintf(path, PATH_SIZE, "%s/%s_actual.tga", o->output_dir, name);
+    write_tga_rle(path, pixels, WIDTH, HEIGHT);
+    snprintf(path, PATH_SIZE, "%s/%s_diff.tga", o->output_dir, name);
+    write_tga_rle(path, diff, WIDTH, HEIGHT);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// latin-1 and latin extended-a glyphs, they fill most of the font atlas before the reference frame
+static void draw_font_warmup(struct onedraw* r)
+{
+    char line[256];
+    uint32_t length = 0;
+    float y = 0.f;
+    for(uint32_t codepoint=0xA1; codepoint<=0x17F; ++codepoint)
+    {
+        line[length++] = (char) (0xC0 | (codepoint >> 6));
+        line[length++] = (char) (0x80 | (codepoint & 0x3F));
+        if ((codepoint & 31) == 31 || codepoint == 0x17F)
+        {
+            line[length] = 0;
+            od_draw_text(r, 4.f, y, line, 0xff000000);
+            y += od_text_height(r);
+            length = 0;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the text scene with a truetype font, utf-8 strings and a string cut by a clip rect
+static void draw_font(struct onedraw* r)
+{
+    draw_text(r);
+    float height = od_text_height(r);
+    od_draw_text(r, 4.f, height * 7.f, "Ça déjà vu, naïve façade – 25°C ½", 0xffffffff);
+    od_set_cliprect(r, 200.f, height * 8.f, WIDTH, HEIGHT);
+    od_draw_text(r, 4.f, height * 8.f, "Œuvre, Ångström, Ħ Łódź Ÿ", 0xff40c0ff);
+    od_set_cliprect(r, 0.f, 0.f, WIDTH, HEIGHT);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// more glyphs than the atlas holds in one frame : the label drawn last is laid out without its glyphs, once the frames in
+// flight are gone it must be drawn as with a freshly loaded font
+static uint32_t check_font_atlas_full(struct onedraw* r, const void* data, size_t size, uint32_t* pixels, uint32_t* diff)
+{
+    char ascii[0x7f - 0x21 + 1];
+    for(uint32_t c=0x21; c<0x7f; ++c)
+        ascii[c - 0x21] = (char) c;
+    ascii[0x7f - 0x21] = 0;
+
+    od_begin_frame(r);
+    draw_font_warmup(r);
+    od_draw_text(r, 4.f, 200.f, ascii, 0xff000000);
+    od_draw_text(r, 4.f, 4.f, FONT_FULL_LABEL, 0xff000000);
+    od_end_frame(r, pixels);
+
+    for(uint32_t frame=0; frame<FONT_WARMUP_FRAMES; ++frame)
+    {
+        od_begin_frame(r);
+        od_end_frame(r, pixels);
+    }
+
+    od_begin_frame(r);
+    od_draw_text(r, 4.f, 4.f, FONT_FULL_LABEL, 0xff000000);
+    od_end_frame(r, pixels);
+
+    // a new font starts with an empty atlas and an empty text cache
+    uint32_t* expected = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    od_load_font(r, data, size, FONT_HEIGHT);
+    od_begin_frame(r);
+    od_draw_text(r, 4.f, 4.f, FONT_FULL_LABEL, 0xff000000);
+    od_end_frame(r, expected);
+
+    uint32_t num_failures = compare_images(expected, pixels, diff, WIDTH * HEIGHT, 0);
+    free(expected);
+    if (num_failures != 0)
+        printf("%-20s FAILED : %u pixels differ from the label drawn with an empty atlas\n", "font_atlas_full", num_failures);
+    else
+        printf("%-20s ok\n", "font_atlas_full");
+    return (num_failures != 0) ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// loads the font, fills the atlas and lets the frames in flight go so the glyphs of the reference frame evict some of the
+// previous ones (and the cached layout of the first line), then restores the built-in font and checks the text scene again
+static uint32_t check_font(const golden_options* o, struct onedraw* r, uint32_t* pixels, uint32_t* diff)
+{
+    FILE* f = fopen(o->font_file, "rb");
+    if (f == NULL)
+    {
+        printf("%-20s FAILED : can't open %s\n", "font", o->font_file);
+        return 1;
+    }
+
+    fseek(f, 0L, SEEK_END);
+    size_t size = (size_t) ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    void* data = malloc(size);
+    size_t read = fread(data, 1, size, f);
+    fclose(f);
+
+    if (read != size || !od_load_font(r, data, size, FONT_HEIGHT))
+    {
+        printf("%-20s FAILED : can't load %s\n", "font", o->font_file);
+        free(data);
+        return 1;
+    }
+
+    od_set_clear_color(r, 0xffe0f0ff);
+    for(uint32_t frame=0; frame<FONT_WARMUP_FRAMES; ++frame)
+    {
+        od_begin_frame(r);
+        if (frame == 0)
+        {
+            // a list pins its glyphs until it is freed, they must be evicted by the reference frame
+            od_list_begin(r);
+            draw_font_warmup(r);
+            struct od_list* list = od_list_end(r);
+            od_list_submit(r, list, 0.f, 0.f);
+            od_list_free(list);
+            od_draw_text(r, 4.f, 0.f, "The quick brown fox\njumps over the lazy dog", 0xff000000);
+        }
+        od_end_frame(r, pixels);
+    }
+
+    od_begin_frame(r);
+    draw_font(r);
+    od_end_frame(r, pixels);
+    uint32_t num_failed = check_image(o, "font", pixels, diff);
+    if (!o->update)
+        num_failed += check_font_atlas_full(r, data, size, pixels, diff);
+
+    od_load_font(r, NULL, 0, 0.f);
+    free(data);
+    if (o->update)
+        return num_failed;
+
+    od_begin_frame(r);
+    draw_text(r);
+    od_end_frame(r, pixels);
+    return num_failed + check_image(o, "text", pixels, diff);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the same shapes with the batched or the single draw functions, some entries of each batch are off-screen or
+// degenerated so the batches are compacted, the last entries go through the scalar tail
+static void draw_batches(struct onedraw* r, bool batched)
+{
+    float x[16], y[16], z[16], w[16], radius[16];
+    draw_color colors[16];
+    od_quad_uv uvs[16];
+
+    for(uint32_t i=0; i<BATCH_DISCS; ++i)
+    {
+        x[i] = 12.f + (float) i * 23.f;
+        y[i] = 20.f + (float)(i % 3) * 6.f;
+        radius[i] = 6.f + (float)(i % 4) * 2.f;
+        colors[i] = 0xff000000 | (i * 0x1f3a5b);
+    }
+    x[0] = -40.f;
+    y[6] = HEIGHT + 40.f;
+    if (batched)
+        od_draw_discs(r, x, y, radius, colors, BATCH_DISCS);
+    else
+        for(uint32_t i=0; i<BATCH_DISCS; ++i)
+            od_draw_disc(r, x[i], y[i], radius[i], colors[i]);
+
+    // sharp boxes (no radius array), some with swapped corners
+    for(uint32_t i=0; i<BATCH_BOXES; ++i)
+    {
+        x[i] = 6.f + (float) i * 28.f;
+        y[i] = 50.f;
+        z[i] = x[i] + ((i & 1) ? -18.f : 18.f) + ((i & 1) ? 36.f : 0.f);
+        w[i] = 50.f + 14.f + (float)(i % 3) * 5.f;
+        colors[i] = 0xff204080 + i * 0x0c0a04;
+    }
+    x[5] = z[5] = WIDTH + 50.f;
+    if (batched)
+        od_draw_boxes(r, x, y, z, w, NULL, colors, BATCH_BOXES);
+    else
+        for(uint32_t i=0; i<BATCH_BOXES; ++i)
+            od_draw_box(r, x[i], y[i], z[i], w[i], 0.f, colors[i]);
+
+    // rounded boxes blended in a group
+    for(uint32_t i=0; i<BATCH_GROUP_BOXES; ++i)
+    {
+        x[i] = 20.f + (float) i * 40.f;
+        y[i] = 90.f + (float)(i & 1) * 10.f;
+        z[i] = x[i] + 36.f;
+        w[i] = y[i] + 30.f;
+        radius[i] = (float) i * 3.f;
+        colors[i] = 0xffa04020 + i * 0x00102030;
+    }
+    y[0] = w[0] = -100.f;
+    od_begin_group(r, true, 10.f, 2.f);
+    if (batched)
+        od_draw_boxes(r, x, y, z, w, radius, colors, BATCH_GROUP_BOXES);
+    else
+        for(uint32_t i=0; i<BATCH_GROUP_BOXES; ++i)
+            od_draw_box(r, x[i], y[i], z[i], w[i], radius[i], colors[i]);
+    od_end_group(r, 0xff000000);
+
+    for(uint32_t i=0; i<BATCH_CAPSULES; ++i)
+    {
+        x[i] = 10.f + (float) i * 31.f;
+        y[i] = 140.f;
+        z[i] = x[i] + 20.f;
+        w[i] = 170.f - (float)(i % 3) * 8.f;
+        radius[i] = 2.f + (float)(i % 3) * 2.f;
+        colors[i] = 0xff30a060 + i * 0x00080c10;
+    }
+    z[0] = x[0];
+    w[0] = y[0];
+    x[4] = z[4] = -60.f;
+    if (batched)
+        od_draw_capsules(r, x, y, z, w, radius, colors, BATCH_CAPSULES);
+    else
+        for(uint32_t i=0; i<BATCH_CAPSULES; ++i)
+            od_draw_capsule(r, x[i], y[i], z[i], w[i], radius[i], colors[i]);
+
+    for(uint32_t i=0; i<BATCH_QUADS; ++i)
+    {
+        x[i] = 4.f + (float) i * 35.f;
+        y[i] = 190.f;
+        z[i] = x[i] + 30.f;
+        w[i] = 230.f;
+        uvs[i] = (od_quad_uv) {0.f, 0.f, .25f + (float) i * .1f, 1.f};
+        colors[i] = (i & 1) ? 0xffffffff : 0xc0ffc0c0;
+    }
+    z[0] = x[0] + .25f;
+    y[3] = w[3] = HEIGHT + 10.f;
+    if (batched)
+        od_draw_quads(r, x, y, z, w, uvs, 0, colors, BATCH_QUADS);
+    else
+        for(uint32_t i=0; i<BATCH_QUADS; ++i)
+            od_draw_quad(r, x[i], y[i], z[i], w[i], uvs[i], 0, colors[i]);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static uint32_t check_batches(struct onedraw* r, uint32_t* pixels, uint32_t* diff)
+{
+    uint32_t* single = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    od_set_clear_color(r, 0xffe0f0ff);
+    od_begin_frame(r);
+    draw_batches(r, true);
+    od_end_frame(r, pixels);
+
+    od_stats stats;
+    od_get_stats(r, &stats);
+    const uint32_t num_batched = stats.num_draw_cmd;
+
+    od_begin_frame(r);
+    draw_batches(r, false);
+    od_end_frame(r, single);
+    od_get_stats(r, &stats);
+
+    uint32_t num_failures = compare_images(single, pixels, diff, WIDTH * HEIGHT, 0);
+    free(single);
+    if (num_batched != stats.num_draw_cmd)
+        printf("%-20s FAILED : %u commands batched, %u single\n", "batches", num_batched, stats.num_draw_cmd);
+    else if (num_failures != 0)
+        printf("%-20s FAILED : %u pixels differ from the single draw calls\n", "batches", num_failures);
+    else
+        printf("%-20s ok (%u commands)\n", "batches", num_batched);
+    return (num_batched != stats.num_draw_cmd || num_failures != 0) ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the occlusion scene must cull some commands and give exactly the pixels of the same scene rendered without culling
+static uint32_t check_occlusion(const golden_options* o, struct onedraw* r, uint32_t* pixels, uint32_t* diff)
+{
+    od_set_clear_color(r, 0xffe0f0ff);
+    od_begin_frame(r);
+    draw_occlusion(r);
+    od_end_frame(r, pixels);
+
+    od_stats stats;
+    od_get_stats(r, &stats);
+    uint32_t num_failed = check_image(o, "occlusion", pixels, diff);
+    if (o->update)
+        return num_failed;
+
+    uint32_t* unculled = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    od_set_occlusion_culling(r, false);
+    od_begin_frame(r);
+    draw_occlusion(r);
+    od_end_frame(r, unculled);
+    od_set_occlusion_culling(r, true);
+
+    uint32_t num_failures = compare_images(unculled, pixels, diff, WIDTH * HEIGHT, 0);
+    free(unculled);
+    if (stats.num_occluded_commands == 0)
+        printf("%-20s FAILED : no command culled\n", "occlusion_culling");
+    else if (num_failures != 0)
+        printf("%-20s FAILED : %u pixels differ from the frame rendered without culling\n", "occlusion_culling", num_failures);
+    else
+        printf("%-20s ok (%u commands culled)\n", "occlusion_culling", stats.num_occluded_commands);
+
+    return num_failed + ((stats.num_occluded_commands == 0 || num_failures != 0) ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// frame 0 and 1 : all the labels, the least recently used are evicted before being drawn again (no hit)
+// frame 2 : the last labels (hits) and a string larger than a quarter of the cache drawn twice (not cached, two misses)
+static void draw_text_cache_frame(struct onedraw* r, uint32_t frame)
+{
+    const float height = od_text_height(r);
+    const uint32_t first = (frame < 2) ? 0 : TEXT_CACHE_LABELS - 4;
+    for(uint32_t i=first; i<TEXT_CACHE_LABELS; ++i)
+    {
+        char label[16];
+        snprintf(label, sizeof(label), "label %02u", i);
+        od_draw_text(r, 4.f + (float)(i % 3) * 105.f, (float)(i / 3) * height * .9f, label, 0xff202020);
+    }
+
+    if (frame == 2)
+    {
+        const char* long_text = "a string too large for the text layout cache, it is laid out again each time it is drawn and"
+                                " measured, its layout is not kept between the frames";
+        od_draw_text(r, 4.f, 0.f, long_text, 0xffc02020);
+        od_draw_text(r, 4.f, height, long_text, 0xff2020c0);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// a renderer with a small text layout cache against a renderer whose cache can't hold any layout
+static uint32_t check_text_cache(uint32_t tolerance)
+{
+    static const uint32_t expected_hits[] = {0, 0, 4};
+    static const uint32_t expected_misses[] = {TEXT_CACHE_LABELS, TEXT_CACHE_LABELS, 2};
+    struct onedraw* renderers[2];
+    for(uint32_t i=0; i<2; ++i)
+    {
+        renderers[i] = od_init( &(onedraw_def)
+        {
+            .preallocated_buffer = malloc(od_min_memory_size()),
+            .metal_device = NULL,
+            .viewport_width = WIDTH,
+            .viewport_height = HEIGHT,
+            .text_cache = {.size = (i == 0) ? TEXT_CACHE_SIZE : 64}
+        });
+        od_set_clear_color(renderers[i], 0xffe0f0ff);
+    }
+
+    uint32_t* pixels = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t* reference = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t* diff = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t num_failed = 0;
+
+    for(uint32_t frame=0; frame<3 && num_failed == 0; ++frame)
+    {
+        od_begin_frame(renderers[0]);
+        draw_text_cache_frame(renderers[0], frame);
+        od_end_frame(renderers[0], pixels);
+
+        od_begin_frame(renderers[1]);
+        draw_text_cache_frame(renderers[1], frame);
+        od_end_frame(renderers[1], reference);
+
+        od_stats stats, uncached;
+        od_get_stats(renderers[0], &stats);
+        od_get_stats(renderers[1], &uncached);
+        uint32_t num_failures = compare_images(reference, pixels, diff, WIDTH * HEIGHT, tolerance);
+        bool counters_ok = stats.num_text_cache_hits == expected_hits[frame] && stats.num_text_cache_misses == expected_misses[frame] &&
+                           uncached.num_text_cache_hits == 0;
+        if (!counters_ok)
+            printf("%-20s FAILED : frame %u, %u hits and %u misses, expected %u and %u (%u hits without cache)\n", "text_cache", frame,
+                   stats.num_text_cache_hits, stats.num_text_cache_misses, expected_hits[frame], expected_misses[frame],
+                   uncached.num_text_cache_hits);
+        else if (num_failures != 0)
+            printf("%-20s FAILED : frame %u, %u pixels differ by more than %u\n", "text_cache", frame, num_failures, tolerance);
+        num_failed += (!counters_ok || num_failures != 0) ? 1 : 0;
+    }
+
+    if (num_failed == 0)
+        printf("%-20s ok\n", "text_cache");
+
+    for(uint32_t i=0; i<2; ++i)
+    {
+        od_terminate(renderers[i]);
+        free(renderers[i]);
+    }
+    free(pixels);
+    free(reference);
+    free(diff);
+    return num_failed;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// the distance field of the built-in font drawn smaller and larger than its baked height, the font is changed between
+// frames so each height renders its band into the same image
+static uint32_t check_text_scaled(const golden_options* o, struct onedraw* r, uint32_t* pixels, uint32_t* diff)
+{
+    static const float heights[] = {12.f, 20.f, 48.f, 96.f};
+    uint32_t* image = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t y = 0;
+
+    od_set_clear_color(r, 0xffe0f0ff);
+    for(uint32_t i=0; i<sizeof(heights)/sizeof(heights[0]); ++i)
+    {
+        uint32_t band = (uint32_t) (heights[i] * 1.3f);
+        od_load_font(r, NULL, 0, heights[i]);
+        od_begin_frame(r);
+        od_draw_text(r, 4.f, (float) y, (heights[i] < 40.f) ? "The quick brown fox jumps over the lazy dog" : "Ag&@ 42%", 0xff202020);
+        od_end_frame(r, pixels);
+        memcpy(&image[y * WIDTH], &pixels[y * WIDTH], band * WIDTH * sizeof(uint32_t));
+        y += band;
+    }
+    memset(&image[y * WIDTH], 0, (HEIGHT - y) * WIDTH * sizeof(uint32_t));
+
+    od_load_font(r, NULL, 0, 0.f);
+    uint32_t num_failed = check_image(o, "text_scaled", image, diff);
+    free(image);
+    return num_failed;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void usage(void)
+{
+    printf("usage: od_golden [--reference-dir dir] [--output-dir dir] [--tolerance n] [--scene name] [--font file] [--packed] [--wide] [--grow] [--incremental] [--update]\n");
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    golden_options options = {.reference_dir = "golden", .output_dir = ".", .font_file = NULL, .tolerance = 2, .update = 0, .packed = false};
+    const char* scene_name = NULL;
+    bool wide = false, grow = false, incremental = false;
+
+    for(int i=1; i<argc; ++i)
+    {
+        if (strcmp(argv[i], "--reference-dir") == 0 && i+1 < argc)
+            options.reference_dir = argv[++i];
+        else if (strcmp(argv[i], "--output-dir") == 0 && i+1 < argc)
+            options.output_dir = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && i+1 < argc)
+            options.tolerance = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--scene") == 0 && i+1 < argc)
+            scene_name = argv[++i];
+        else if (strcmp(argv[i], "--font") == 0 && i+1 < argc)
+            options.font_file = argv[++i];
+        else if (strcmp(argv[i], "--packed") == 0)
+            options.packed = true;
+        else if (strcmp(argv[i], "--wide") == 0)
+            wide = true;
+        else if (strcmp(argv[i], "--grow") == 0)
+            grow = true;
+        else if (strcmp(argv[i], "--incremental") == 0)
+            incremental = true;
+        else if (strcmp(argv[i], "--update") == 0)
+            options.update = 1;
+        else
+        {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((options.packed || wide || grow || incremental) && options.update)
+    {
+        printf("--packed, --wide, --grow and --incremental outputs can't be used as reference\n");
+        return EXIT_FAILURE;
+    }
+
+    struct onedraw* renderer = od_init( &(onedraw_def)
+    {
+        .preallocated_buffer = malloc(od_min_memory_size()),
+        .metal_device = NULL,
+        .viewport_width = WIDTH,
+        .viewport_height = HEIGHT,
+        .packed_draw_data = options.packed,
+        .wide_aabb = wide,
+        .cpu = {.incremental = incremental},
+        .limits = {.max_commands = grow ? 4 : 0, .max_draw_data = grow ? 4 : 0, .max_nodes = grow ? 16 : 0},
+        .atlas = {.width = ATLAS_SIZE, .height = ATLAS_SIZE, .num_slices = 2}
+    });
+    upload_atlas(renderer);
+    contexts[0] = od_context_create(renderer);
+    contexts[1] = od_context_create(renderer);
+
+    uint32_t* pixels = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t* diff = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+    uint32_t num_failed = 0, num_run = 0;
+
+    for(uint32_t i=0; i<NUM_SCENES; ++i)
+    {
+        const scene* s = &scenes[i];
+        if (scene_name != NULL && strcmp(scene_name, s->name) != 0)
+            continue;
+
+        od_set_clear_color(renderer, 0xffe0f0ff);
+        od_begin_frame(renderer);
+        s->draw(renderer);
+        od_end_frame(renderer, pixels);
+        num_run++;
+        num_failed += check_image(&options, s->name, pixels, diff);
+    }
+
+    if (wide && scene_name == NULL)
+    {
+        num_failed += (check_wide_viewport(renderer, options.tolerance) != 0) ? 1 : 0;
+        num_run++;
+    }
+
+    if (grow && scene_name == NULL)
+    {
+        num_failed += (check_multipass(renderer, options.tolerance) != 0) ? 1 : 0;
+        num_run++;
+    }
+
+    if (incremental && scene_name == NULL)
+    {
+        num_failed += (check_incremental(renderer, options.tolerance) != 0) ? 1 : 0;
+        num_run++;
+    }
+
+    if (scene_name == NULL || strcmp(scene_name, "occlusion") == 0)
+    {
+        num_failed += check_occlusion(&options, renderer, pixels, diff);
+        num_run += options.update ? 1 : 2;
+    }
+
+    if (!options.update && (scene_name == NULL || strcmp(scene_name, "batches") == 0))
+    {
+        num_failed += check_batches(renderer, pixels, diff);
+        num_run++;
+    }
+
+    if (!options.update && (scene_name == NULL || strcmp(scene_name, "text_cache") == 0))
+    {
+        num_failed += (check_text_cache(options.tolerance) != 0) ? 1 : 0;
+        num_run++;
+    }
+
+    if (scene_name == NULL || strcmp(scene_name, "text_scaled") == 0)
+    {
+        num_failed += check_text_scaled(&options, renderer, pixels, diff);
+        num_run++;
+    }
+
+    if (options.font_file != NULL && (scene_name == NULL || strcmp(scene_name, "font") == 0))
+    {
+        num_failed += (check_font(&options, renderer, pixels, diff) != 0) ? 1 : 0;
+        num_run++;
+    }
+
+    if (num_run == 0)
+    {
+        usage();
+        num_failed = 1;
+    }
+    else if (!options.update)
+        printf("%u/%u scenes passed\n", num_run - num_failed, num_run);
+
+    od_context_destroy(contexts[0]);
+    od_context_destroy(contexts[1]);
+    od_terminate(renderer);
+    free(renderer);
+    free(pixels);
+    free(diff);
+    return (num_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
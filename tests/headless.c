@@ -0,0 +1,82 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../lib/onedraw.h"
+
+#define WIDTH (1280)
+#define HEIGHT (720)
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// writes a uncompressed 32 bits tga, the pixels are already in B8G8R8A8 order
+static int write_tga(const char* filename, const uint32_t* pixels, uint32_t width, uint32_t height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return 0;
+
+    uint8_t header[18] = {0};
+    header[2] = 2;                      // uncompressed true-color
+    header[12] = width & 0xff;
+    header[13] = (width >> 8) & 0xff;
+    header[14] = height & 0xff;
+    header[15] = (height >> 8) & 0xff;
+    header[16] = 32;
+    header[17] = 0x28;                  // top-left origin, 8 bits alpha
+
+    fwrite(header, sizeof(header), 1, f);
+    fwrite(pixels, width * height * sizeof(uint32_t), 1, f);
+    fclose(f);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    const char* filename = (argc > 1) ? argv[1] : "headless.tga";
+
+    struct onedraw* renderer = od_init( &(onedraw_def)
+    {
+        .preallocated_buffer = malloc(od_min_memory_size()),
+        .metal_device = NULL,   // headless : cpu backend
+        .viewport_width = WIDTH,
+        .viewport_height = HEIGHT
+    });
+
+    uint32_t* pixels = (uint32_t*) malloc(WIDTH * HEIGHT * sizeof(uint32_t));
+
+    od_set_clear_color(renderer, 0xffe0f0ff);
+    od_begin_frame(renderer);
+
+    od_draw_disc(renderer, 200.f, 200.f, 100.f, 0xff3040e0);
+    od_draw_disc_gradient(renderer, 450.f, 200.f, 100.f, 0xffe07030, 0xff30e0e0);
+    od_draw_box(renderer, 600.f, 100.f, 800.f, 300.f, 20.f, 0xff808080);
+    od_draw_oriented_box(renderer, 900.f, 100.f, 1100.f, 300.f, 40.f, 5.f, 0xff30a030);
+    od_draw_ellipse(renderer, 100.f, 500.f, 300.f, 500.f, 100.f, 0xffa030a0);
+    od_draw_sector(renderer, 450.f, 500.f, 100.f, 0.f, 2.f, 0xff2080e0);
+
+    od_begin_group(renderer, true, 20.f, 4.f);
+    od_draw_disc(renderer, 650.f, 500.f, 60.f, 0xff4060ff);
+    od_draw_disc(renderer, 750.f, 500.f, 60.f, 0xffff6040);
+    od_end_group(renderer, 0xff000000);
+
+    od_set_cliprect(renderer, 900.f, 400.f, 1100.f, 600.f);
+    od_draw_disc(renderer, 1000.f, 500.f, 150.f, 0xff404040);
+    od_set_cliprect(renderer, 0.f, 0.f, WIDTH, HEIGHT);
+
+    od_draw_text(renderer, 10.f, 10.f, "Hello from the cpu backend!", 0xff000000);
+    od_end_frame(renderer, pixels);
+
+    od_stats stats;
+    od_get_stats(renderer, &stats);
+    printf("%u draw commands, %zu bytes used\n", stats.num_draw_cmd, stats.gpu_memory_usage);
+
+    int result = write_tga(filename, pixels, WIDTH, HEIGHT);
+    if (result)
+        printf("%s written\n", filename);
+
+    od_terminate(renderer);
+    free(renderer);
+    free(pixels);
+    return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,333 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../lib/onedraw.h"
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// od_replay : replays a capture made with od_capture_begin/od_capture_end on the cpu backend
+//
+//      od_replay capture.odc [--loops n] [--threads n] [--output last_frame.tga] [--heatmap prefix]
+//
+//      * the file is mapped and the frames are binned/rasterized in place, nothing goes through the draw functions
+//      * --heatmap writes the tiles list length and estimated cost of the last frame, as png (normalized, for viewing)
+//        and pfm (raw float) : prefix_length.png, prefix_cost.png, prefix_length.pfm, prefix_cost.pfm
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static inline double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static int write_tga(const char* filename, const uint32_t* pixels, uint32_t width, uint32_t height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return 0;
+
+    uint8_t header[18] = {0};
+    header[2] = 2;                      // uncompressed true-color
+    header[12] = width & 0xff;
+    header[13] = (width >> 8) & 0xff;
+    header[14] = height & 0xff;
+    header[15] = (height >> 8) & 0xff;
+    header[16] = 32;
+    header[17] = 0x28;                  // top-left origin, 8 bits alpha
+
+    fwrite(header, sizeof(header), 1, f);
+    fwrite(pixels, width * height * sizeof(uint32_t), 1, f);
+    fclose(f);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+    crc = ~crc;
+    for(size_t i=0; i<size; ++i)
+    {
+        crc ^= data[i];
+        for(int k=0; k<8; ++k)
+            crc = (crc >> 1) ^ (0xedb88320 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void write_be32(uint8_t* output, uint32_t value)
+{
+    output[0] = (uint8_t)(value >> 24); output[1] = (uint8_t)(value >> 16);
+    output[2] = (uint8_t)(value >> 8);  output[3] = (uint8_t)value;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static void write_png_chunk(FILE* f, const char* type, const uint8_t* data, uint32_t size)
+{
+    uint8_t header[8];
+    write_be32(header, size);
+    memcpy(&header[4], type, 4);
+    fwrite(header, sizeof(header), 1, f);
+    fwrite(data, size, 1, f);
+
+    uint8_t crc[4];
+    write_be32(crc, crc32(crc32(0, (const uint8_t*)type, 4), data, size));
+    fwrite(crc, sizeof(crc), 1, f);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8 bits rgb png, zlib stream made of uncompressed blocks (heatmaps are a few thousand pixels)
+static int write_png(const char* filename, const uint8_t* rgb, uint32_t width, uint32_t height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return 0;
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(signature, sizeof(signature), 1, f);
+
+    uint8_t ihdr[13] = {0};
+    write_be32(&ihdr[0], width);
+    write_be32(&ihdr[4], height);
+    ihdr[8] = 8;        // bits per channel
+    ihdr[9] = 2;        // rgb
+    write_png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+
+    // raw scanlines with a filter byte (none)
+    const uint32_t stride = width * 3 + 1;
+    const uint32_t raw_size = stride * height;
+    uint8_t* raw = (uint8_t*) malloc(raw_size);
+    for(uint32_t y=0; y<height; ++y)
+    {
+        raw[y * stride] = 0;
+        memcpy(&raw[y * stride + 1], &rgb[y * width * 3], width * 3);
+    }
+
+    const uint32_t max_block = 65535;
+    const uint32_t num_blocks = (raw_size + max_block - 1) / max_block;
+    const uint32_t idat_size = 2 + num_blocks * 5 + raw_size + 4;
+    uint8_t* idat = (uint8_t*) malloc(idat_size);
+    uint8_t* output = idat;
+    *output++ = 0x78; *output++ = 0x01;
+
+    uint32_t a = 1, b = 0;
+    for(uint32_t offset=0; offset<raw_size; offset += max_block)
+    {
+        uint32_t size = (raw_size - offset < max_block) ? raw_size - offset : max_block;
+        *output++ = (offset + size == raw_size) ? 1 : 0;
+        *output++ = (uint8_t)size; *output++ = (uint8_t)(size >> 8);
+        *output++ = (uint8_t)~size; *output++ = (uint8_t)(~size >> 8);
+        memcpy(output, &raw[offset], size);
+        output += size;
+
+        for(uint32_t i=0; i<size; ++i)
+        {
+            a = (a + raw[offset + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+    }
+    write_be32(output, (b << 16) | a);
+    write_png_chunk(f, "IDAT", idat, idat_size);
+    write_png_chunk(f, "IEND", NULL, 0);
+
+    free(raw);
+    free(idat);
+    fclose(f);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// portable float map, one channel, rows are stored bottom to top
+static int write_pfm(const char* filename, const float* values, uint32_t width, uint32_t height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return 0;
+
+    fprintf(f, "Pf\n%u %u\n-1.0\n", width, height);
+    for(uint32_t y=height; y-->0; )
+        fwrite(&values[y * width], width * sizeof(float), 1, f);
+    fclose(f);
+    return 1;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// black (empty tile) -> blue -> red -> yellow -> white (most expensive tile of the frame)
+static void heat_color(float t, uint8_t* rgb)
+{
+    static const float ramp[5][3] = {{0.f, 0.f, 0.f}, {0.f, 0.f, 1.f}, {1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {1.f, 1.f, 1.f}};
+    float position = t * 4.f;
+    int index = (position >= 4.f) ? 3 : (int)position;
+    float fraction = position - (float)index;
+    for(int c=0; c<3; ++c)
+        rgb[c] = (uint8_t)((ramp[index][c] + (ramp[index + 1][c] - ramp[index][c]) * fraction) * 255.f + .5f);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+static int write_heatmap(const char* prefix, const char* name, const float* values, uint32_t width, uint32_t height)
+{
+    float max_value = 0.f;
+    for(uint32_t i=0; i<width * height; ++i)
+        max_value = (values[i] > max_value) ? values[i] : max_value;
+
+    uint8_t* rgb = (uint8_t*) malloc(width * height * 3);
+    for(uint32_t i=0; i<width * height; ++i)
+        heat_color((max_value > 0.f) ? values[i] / max_value : 0.f, &rgb[i * 3]);
+
+    char filename[1024];
+    snprintf(filename, sizeof(filename), "%s_%s.png", prefix, name);
+    int result = write_png(filename, rgb, width, height);
+    snprintf(filename, sizeof(filename), "%s_%s.pfm", prefix, name);
+    result = result && write_pfm(filename, values, width, height);
+
+    if (result)
+        printf("%s_%s.png/.pfm written (max %.1f)\n", prefix, name, max_value);
+    free(rgb);
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    const char* filename = NULL;
+    const char* output_filename = NULL;
+    const char* heatmap_prefix = NULL;
+    uint32_t num_loops = 1;
+    uint32_t num_threads = 0;
+
+    for(int i=1; i<argc; ++i)
+    {
+        if (strcmp(argv[i], "--loops") == 0 && i+1 < argc)
+            num_loops = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i+1 < argc)
+            num_threads = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i+1 < argc)
+            output_filename = argv[++i];
+        else if (strcmp(argv[i], "--heatmap") == 0 && i+1 < argc)
+            heatmap_prefix = argv[++i];
+        else if (argv[i][0] != '-' && filename == NULL)
+            filename = argv[i];
+        else
+        {
+            filename = NULL;
+            break;
+        }
+    }
+
+    if (filename == NULL)
+    {
+        printf("usage: od_replay capture.odc [--loops n] [--threads n] [--output last_frame.tga] [--heatmap prefix]\n");
+        return EXIT_FAILURE;
+    }
+
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        fprintf(stderr, "can't open %s\n", filename);
+        return EXIT_FAILURE;
+    }
+
+    size_t size = (size_t) st.st_size;
+    const void* capture = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (capture == MAP_FAILED)
+    {
+        fprintf(stderr, "can't map %s\n", filename);
+        return EXIT_FAILURE;
+    }
+
+    const void* first_frame = od_capture_next_frame(capture, size, NULL);
+    if (first_frame == NULL)
+    {
+        fprintf(stderr, "%s is not a valid capture or is empty\n", filename);
+        munmap((void*)capture, size);
+        return EXIT_FAILURE;
+    }
+
+    struct onedraw* renderer = od_init( &(onedraw_def)
+    {
+        .preallocated_buffer = malloc(od_min_memory_size()),
+        .metal_device = NULL,
+        .viewport_width = 16,       // resized by the first frame
+        .viewport_height = 16,
+        .wide_aabb = true,          // any capture size, the frames keep their own aabb format
+        .cpu.num_threads = num_threads
+    });
+
+    uint32_t* pixels = NULL;
+    size_t pixels_size = 0;
+    uint32_t width = 0, height = 0;
+    uint32_t num_frames = 0;
+    uint64_t num_commands = 0;
+    double binning_ms = 0.0, raster_ms = 0.0;
+
+    double start = now_ms();
+    for(uint32_t loop=0; loop<num_loops; ++loop)
+    {
+        for(const void* frame = first_frame; frame != NULL; frame = od_capture_next_frame(capture, size, frame))
+        {
+            od_capture_frame_dimensions(frame, &width, &height);
+            if ((size_t)width * height * sizeof(uint32_t) > pixels_size)
+            {
+                pixels_size = (size_t)width * height * sizeof(uint32_t);
+                free(pixels);
+                pixels = (uint32_t*) malloc(pixels_size);
+            }
+
+            od_replay_frame(renderer, frame, pixels);
+
+            od_stats stats;
+            od_get_stats(renderer, &stats);
+            binning_ms += stats.binning_time_ms;
+            raster_ms += stats.raster_time_ms;
+            num_commands += stats.num_draw_cmd;
+            num_frames++;
+        }
+    }
+    double elapsed = now_ms() - start;
+
+    printf("%u frames replayed in %.2fms (%.3fms per frame, %.1fns per command)\n", num_frames, elapsed,
+           elapsed / num_frames, (num_commands) ? elapsed * 1000000.0 / (double)num_commands : 0.0);
+    printf("binning %.3fms, rasterization %.3fms per frame\n", binning_ms / num_frames, raster_ms / num_frames);
+
+    int result = EXIT_SUCCESS;
+    if (output_filename != NULL)
+    {
+        if (write_tga(output_filename, pixels, width, height))
+            printf("%s written\n", output_filename);
+        else
+            result = EXIT_FAILURE;
+    }
+
+    if (heatmap_prefix != NULL)
+    {
+        uint32_t tiles_width, tiles_height;
+        od_get_tile_dimensions(renderer, &tiles_width, &tiles_height);
+
+        float* lengths = (float*) malloc(tiles_width * tiles_height * sizeof(float));
+        float* costs = (float*) malloc(tiles_width * tiles_height * sizeof(float));
+        if (!od_get_tile_heatmap(renderer, lengths, costs) ||
+            !write_heatmap(heatmap_prefix, "length", lengths, tiles_width, tiles_height) ||
+            !write_heatmap(heatmap_prefix, "cost", costs, tiles_width, tiles_height))
+            result = EXIT_FAILURE;
+
+        free(lengths);
+        free(costs);
+    }
+
+    od_terminate(renderer);
+    free(renderer);
+    free(pixels);
+    munmap((void*)capture, size);
+    return result;
+}